@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 58
-#define YY_END_OF_BUFFER 59
+#define YY_NUM_RULES 61
+#define YY_END_OF_BUFFER 62
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,43 +700,45 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[320] =
+static const flex_int16_t yy_accept[341] =
     {   0,
-       51,   51,    0,    0,    0,    0,    0,    0,    0,    0,
-       59,   57,   10,   11,   57,    1,   51,   48,   51,   51,
-       57,   50,   49,   57,   57,   57,   57,   57,   44,   45,
-       57,   57,   57,   46,   47,    5,    5,    5,   57,   57,
-       57,   10,   11,    0,    0,   40,    0,    0,    0,    0,
+       54,   54,    0,    0,    0,    0,    0,    0,    0,    0,
+       62,   60,   10,   11,   60,    1,   54,   51,   54,   54,
+       60,   53,   52,   60,   60,   60,   60,   60,   47,   48,
+       60,   60,   60,   49,   50,    5,    5,    5,   60,   60,
+       60,   10,   11,    0,    0,   43,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    1,   51,   51,    0,   50,   51,    3,    2,    6,
-        0,   51,    0,    0,    0,    0,    0,    0,    4,    0,
-        0,    9,    0,   41,    0,    0,    0,    0,    0,   43,
+        0,    0,    0,    1,   54,   54,    0,   53,    3,    2,
+        6,    0,   54,    0,    0,    0,    0,    0,    0,    4,
+        0,    0,    9,   44,    0,    0,    0,    0,    0,   46,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
-        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
-        0,    0,   42,    0,    0,    0,   20,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   56,   54,    0,   53,   52,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    8,    0,
+        0,    0,    0,   45,    0,    0,    0,    0,   20,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   59,   57,    0,
+       56,   55,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   55,   52,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   58,
+       55,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,    0,   23,
-
-        0,    0,    0,    0,   37,   38,    0,    0,    0,    0,
-        0,   18,   19,   32,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    7,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   34,
-       31,    0,    0,    0,    0,    0,    0,    0,   27,   16,
-        0,    0,    0,    0,    0,   25,   28,   33,    0,    0,
-        0,    0,    0,    0,    0,   39,    0,    0,    0,    0,
-        0,    0,    0,   36,    0,    0,    0,    0,    0,    0,
-        0,   13,   14,    0,    0,    0,    0,    0,    0,    0,
-       35,    0,    0,   26,    0,    0,    0,    0,    0,    0,
-
-        0,   21,   22,    0,    0,    0,    0,    0,   15,   12,
-        0,    0,    0,    0,    0,   30,   17,   24,    0
+
+        0,    0,   29,    0,    0,    0,    0,    0,    0,   23,
+        0,    0,    0,    0,   40,   41,    0,    0,   35,    0,
+        0,    0,   18,   19,   32,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    7,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   34,   31,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   27,   16,    0,    0,    0,    0,    0,
+       25,   28,   33,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   42,    0,    0,    0,    0,    0,    0,   37,
+        0,    0,   39,    0,    0,    0,    0,    0,    0,    0,
+
+       13,   14,    0,    0,    0,    0,    0,    0,    0,    0,
+       38,    0,    0,   26,   36,    0,    0,    0,    0,    0,
+        0,    0,   21,   22,    0,    0,    0,    0,    0,   15,
+       12,    0,    0,    0,    0,    0,   30,   17,   24,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -753,8 +755,8 @@ static const YY_CHAR yy_ec[256] =
        34,   35,   36,    5,   37,    5,   38,   39,   40,   41,
 
        42,   43,   44,   45,   46,    5,   47,   48,   49,   50,
-       51,   52,    5,   53,   54,   55,   56,   57,    5,   58,
-       59,   60,   61,    5,   62,    5,    5,    5,    5,    5,
+       51,   52,   53,   54,   55,   56,   57,   58,   59,   60,
+       61,   62,   63,    5,   64,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -771,342 +773,279 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[63] =
+static const YY_CHAR yy_meta[65] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    3,    3,    3,
-        3,    5,    5,    5,    5,    5,    5,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    5,    5,    5,
-        5,    5,    5,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[332] =
+static const flex_int16_t yy_base[341] =
     {   0,
-        0,    0,   61,   64,   67,    0,   65,   69,   49,   66,
-      277, 2102,   86,  269,  129,    0,  124, 2102,  172,  129,
-       84,  178, 2102,  250,   91,   76,   71,   89, 2102, 2102,
-       96,   91,   95, 2102, 2102, 2102,   87,  250,  196,    0,
-      222,  119,  236,  114,  199, 2102,  205,  215,  222,  209,
-      235,  252,  273,  279,  287,  297,  304,  310,  317,  323,
-      345,    0,  345,  367,  361,  374,  387, 2102,    0, 2102,
-      144,  215,  128,  134,  119,  171,  185,  135, 2102,  172,
-      204, 2102,  161, 2102,  392,  405,  416,  422,  203,  435,
-      457,  457,  484,  502,  508,  514,  520,  526,  533,  544,
-
-      550,  556,  563,  572,  581,  591,  598,  608,    0,  172,
-      199,  209,  212,  221,  219,  149, 2102,    0,  618,  626,
-      633,  167, 2102,  665,  661,  639, 2102,  696,  710,  716,
-      722,  731,  737,  747,  753,  762,  773,  783,  792,  800,
-      810,  827,  242, 2102, 2102,  275, 2102, 2102,  109,    0,
-      835,  847,  854,  887,  873,  884,  915,  930,  937,  950,
-      960,  967,  973,  985,  991,  997, 1008, 1016, 1022, 1034,
-     1043, 1052, 2102, 2102,  122,    0, 1065, 1071, 1078, 1087,
-     1095, 1132, 1101, 1109, 1117, 1131, 1161, 1175, 1181, 1187,
-     1196, 1202, 1211, 1217, 2102, 1223, 1232, 1241, 1258, 2102,
-
-     1279,  109,    0, 1288, 2102, 2102, 1294, 1302, 1314, 1324,
-     1332, 2102, 2102, 2102, 1349, 1355, 1374, 1380, 1386, 1392,
-     1398, 1410, 1416, 1429, 1435, 1447, 2102, 1454, 1460, 1466,
-     1472, 1485, 1491, 1503, 1509, 1515, 1521, 1527, 1534, 2102,
-     2102, 1540, 1551, 1564, 1570, 1576, 1586, 1594, 2102, 2102,
-     1600, 1606, 1612, 1630, 1636, 2102, 2102, 2102, 1643, 1654,
-     1661, 1667, 1673, 1680, 1698, 2102, 1708, 1691, 1715, 1721,
-     1728, 1735, 1743, 2102, 1751, 1759, 1770, 1778, 1786, 1800,
-     1813, 2102, 2102, 1821, 1827, 1835, 1841, 1851, 1857, 1863,
-     2102, 1878, 1887, 2102, 1893, 1899, 1913, 1923, 1934, 1940,
-
-     1948, 2102, 2102, 1954, 1960, 1971, 1978, 1990, 2102, 2102,
-     1998, 2006, 2013, 2021, 2028, 2102, 2102, 2102, 2102, 2063,
-     2068, 2073, 2078, 2083, 2088, 2093, 2096,  132,  128,  121,
-      111
+        1,    0,   66,    0,  131,    0,  988, 1088, 1099, 1106,
+        0,  719,  977,  849,  196,  716, 1099,  784, 1143, 1070,
+     1056, 1149,  914,  983,  996,  986, 1038, 1068,  995, 1039,
+      987, 1067, 1072, 1055, 1065, 1101,  978, 1118, 1073,  846,
+     1130, 1117, 1135,  261,  326, 1129, 1201, 1208, 1205,  391,
+     1204, 1210, 1012, 1214, 1077, 1091, 1226, 1229,  855, 1230,
+     1213, 1177, 1171,    0, 1180, 1156, 1026, 1162, 1144,  781,
+     1146, 1186, 1193, 1139, 1183, 1148, 1184, 1189, 1190, 1271,
+     1225, 1272, 1272, 1273, 1097, 1274, 1274, 1274,  911,    0,
+      456, 1274,  935, 1275, 1274, 1275, 1274, 1274, 1274, 1277,
+
+     1275, 1274, 1274, 1276, 1275, 1274, 1278, 1275, 1281, 1276,
+     1284, 1199, 1192, 1213, 1214, 1215, 1216, 1227, 1274,  976,
+     1280, 1277, 1283, 1276,  521, 1287, 1289, 1283, 1277, 1283,
+     1289, 1287, 1296, 1292, 1291, 1302, 1178, 1305, 1296, 1295,
+     1312, 1294, 1310, 1306, 1294, 1301, 1218, 1282, 1283, 1224,
+     1284, 1285, 1229, 1006, 1302,  972, 1311,  586, 1318, 1317,
+     1306, 1317, 1218, 1317, 1308, 1287, 1326, 1323, 1320, 1325,
+     1287, 1311, 1326, 1321, 1329, 1318, 1331, 1288, 1288, 1287,
+     1289, 1238, 1036, 1323, 1290, 1291, 1334, 1326,  651, 1294,
+     1327, 1327, 1331, 1295, 1296, 1297, 1293, 1196, 1326, 1327,
+
+     1320, 1329, 1290, 1328, 1337, 1344, 1294, 1341, 1332, 1291,
+     1349, 1246, 1066, 1342, 1292, 1295, 1341, 1348, 1306, 1337,
+     1346, 1353, 1307, 1308, 1309, 1348, 1346, 1347, 1338, 1345,
+     1359, 1396, 1243, 1352, 1348, 1350, 1350, 1396, 1357, 1310,
+     1398, 1355, 1405, 1406, 1402, 1356, 1369, 1361, 1363, 1412,
+     1413, 1414, 1311, 1312, 1421, 1421, 1421, 1421, 1421, 1201,
+     1421, 1421, 1421, 1421, 1422, 1423, 1423, 1423, 1423, 1425,
+     1423, 1424, 1425, 1431, 1426, 1430, 1426, 1427, 1426, 1426,
+     1429, 1426, 1426, 1435, 1428, 1435, 1428, 1429, 1434, 1428,
+     1436, 1431, 1429, 1443, 1441, 1432, 1433, 1437, 1430, 1430,
+
+     1430, 1431, 1448, 1437, 1438, 1453, 1454, 1437, 1448, 1452,
+     1437, 1446, 1450, 1438, 1439, 1440, 1441, 1446, 1447, 1462,
+     1459, 1456, 1440, 1441, 1442, 1443, 1451, 1466, 1454, 1442,
+     1445, 1455, 1456, 1450, 1451, 1452, 1450, 1451, 1452, 1531
     } ;
 
-static const flex_int16_t yy_def[332] =
+static const flex_int16_t yy_def[341] =
     {   0,
-      319,    1,  320,  320,    1,    5,    5,    5,    5,    5,
-      319,  319,  319,  319,  321,  322,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  323,
-      319,  319,  319,  324,  321,  319,  321,  321,  321,  325,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  322,  319,  319,  319,  319,  319,  319,  326,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      323,  319,  324,  319,  319,  321,  321,  321,  327,  321,
-      325,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-
-      321,  321,  321,  321,  321,  321,  321,  321,  326,  319,
-      319,  319,  319,  319,  319,  319,  319,  328,  321,  321,
-      321,  327,  319,  325,  321,  321,  319,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  321,  319,  319,  319,  319,  319,  319,  319,  329,
-      321,  321,  321,  325,  321,  321,  321,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  321,  319,  319,  319,  330,  321,  321,  321,  321,
-      321,  325,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  321,  321,  321,  319,  321,  321,  321,  321,  319,
-
-      321,  319,  331,  321,  319,  319,  321,  321,  321,  321,
-      321,  319,  319,  319,  321,  321,  321,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  319,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  319,
-      319,  321,  321,  321,  321,  321,  321,  321,  319,  319,
-      321,  321,  321,  321,  321,  319,  319,  319,  321,  321,
-      321,  321,  321,  321,  321,  319,  321,  321,  321,  321,
-      321,  321,  321,  319,  321,  321,  321,  321,  321,  321,
-      321,  319,  319,  321,  321,  321,  321,  321,  321,  321,
-      319,  321,  321,  319,  321,  321,  321,  321,  321,  321,
-
-      321,  319,  319,  321,  321,  321,  321,  321,  319,  319,
-      321,  321,  321,  321,  321,  319,  319,  319,    0,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319
+      340,    1,  340,    3,  340,    5,    5,    5,    5,    5,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,   45,   45,   45,  340,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   16,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,   40,  340,  340,  340,   45,   45,   45,  340,   45,
+      340,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+       45,   45,   45,  340,  340,   45,   45,   45,  340,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  340,  340,  340,  340,
+      340,  340,  340,  340,   45,   45,   45,  340,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  340,
+      340,  340,  340,   45,   45,   45,   45,   45,  340,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,  340,   45,   45,   45,   45,   45,   45,  340,
+       45,  340,  340,   45,  340,  340,   45,   45,  340,   45,
+       45,   45,  340,  340,  340,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  340,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  340,  340,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,  340,  340,   45,   45,   45,   45,   45,
+      340,  340,  340,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  340,   45,   45,   45,   45,   45,   45,  340,
+       45,   45,  340,   45,   45,   45,   45,   45,   45,   45,
+
+      340,  340,   45,   45,   45,   45,   45,   45,   45,   45,
+      340,   45,   45,  340,  340,   45,   45,   45,   45,   45,
+       45,   45,  340,  340,   45,   45,   45,   45,   45,  340,
+      340,   45,   45,   45,   45,   45,  340,  340,  340,    0
     } ;
 
-static const flex_int16_t yy_nxt[2165] =
+static const flex_int16_t yy_nxt[1596] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   12,   12,   25,   26,   12,   27,   12,
-       12,   28,   12,   29,   12,   30,   12,   12,   12,   12,
-       12,   25,   31,   12,   12,   12,   12,   12,   12,   32,
-       12,   12,   12,   12,   33,   12,   12,   12,   12,   12,
-       34,   35,   37,   14,   37,   37,   14,   37,   38,   41,
-       40,   38,   12,   12,   40,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   41,   42,   42,   42,
-       42,   68,   12,   12,   12,   12,   69,   73,   12,   71,
-
-       12,   71,   12,   74,   72,   72,   72,   72,   12,   12,
-       12,   12,   39,   73,   12,   83,   12,   73,   75,   84,
-       42,   12,   42,   74,   75,  203,   74,   12,   12,   44,
-       44,   44,  176,   76,   46,   63,  150,   64,   64,   64,
-       64,   75,   67,   67,   67,   67,   77,   78,   85,   65,
-      227,  112,   47,   48,   65,  110,   49,   72,   72,   72,
-       72,  111,  202,   50,  175,   65,   84,  112,   51,   52,
-       65,   53,  123,   54,  112,  110,   55,   56,   57,   58,
-       59,  111,   60,   63,   61,   66,   66,   66,   66,   63,
-      115,   66,   66,   66,   66,   85,  149,   65,  110,   44,
-
-       44,   44,  143,   65,   46,   44,   44,   44,  123,  117,
-       46,  116,  111,   65,   90,   44,   44,   44,  113,   65,
-       46,   45,   44,   44,   44,  143,  144,   46,   72,   72,
-       72,   72,  114,   50,  145,   44,   44,   44,   43,   50,
-       46,   82,  143,   45,  145,   80,  144,   45,  144,   50,
-      145,   45,   44,   44,   44,   86,   50,   46,   45,   87,
-      148,   45,   79,   45,   91,  146,   93,  173,  147,   50,
-       70,   43,   88,   44,   44,   44,  319,  319,   46,   44,
-       44,   44,  319,  173,   46,   92,   50,   44,   44,   44,
-      319,  319,   46,   94,  319,  319,   95,   44,   44,   44,
-
-      173,  319,   46,  319,   44,   44,   44,   50,  319,   46,
-       44,   44,   44,   50,  319,   46,  174,   44,   44,   44,
-       96,   50,   46,   44,   44,   44,  319,  319,   46,   97,
-      319,   50,   99,   98,  101,  319,  319,  100,   50,  319,
-      319,  102,  319,  319,   50,   44,   44,   44,  319,  319,
-       46,   50,  319,  319,  104,  319,  319,   50,   67,   67,
-       67,   67,  319,  319,  105,  103,  319,  319,  319,   71,
-       65,   71,  319,  106,   72,   72,   72,   72,   63,   50,
-       64,   64,   64,   64,  319,   63,   65,   66,   66,   66,
-       66,  319,   65,  319,  107,  319,  319,   83,  108,   65,
-
-       67,   67,   67,   67,   83,   44,   44,   44,   65,  319,
-       46,  319,   65,  319,  319,   65,   44,   44,   44,  319,
-      319,   46,   44,   44,   44,  319,   83,   46,   65,  319,
-       83,  319,  319,  319,   83,   44,   44,   44,  319,   50,
-       46,   83,  319,  319,   83,  319,   83,  118,  319,  319,
-       50,  319,  319,  319,  119,  120,   50,   44,   44,   44,
-      319,  319,   46,  319,  319,  121,  319,  319,  319,   50,
-      124,  124,  124,  124,  319,  319,  319,  319,  124,  124,
-      124,  124,  124,  124,   44,   44,   44,  319,  319,  127,
-      319,   50,  319,  319,  124,  124,  124,  124,  124,  124,
-
-      319,  319,   44,   44,   44,  125,  126,   46,   44,   44,
-       44,  319,  319,   46,   44,   44,   44,  319,   50,   46,
-       44,   44,   44,  319,  319,   46,   44,   44,   44,  319,
-      319,   46,  319,   44,   44,   44,   50,  319,   46,  319,
-      128,  319,   50,  319,   44,   44,   44,  129,   50,   46,
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-       50,   46,  319,   44,   44,   44,  319,   50,   46,  130,
-      131,  133,   44,   44,   44,  319,  319,   46,   50,  319,
-      132,   44,   44,   44,   50,  319,   46,  134,  319,  319,
-       50,   44,   44,   44,  319,  319,   46,   50,   44,   44,
-
-       44,  319,  319,   46,  136,  319,   50,  135,   44,   44,
-       44,  319,  319,   46,  319,   50,  319,  137,   44,   44,
-       44,  319,  319,   46,  138,   50,   44,   44,   44,  319,
-      140,   46,   50,   44,   44,   44,  319,  139,   46,   44,
-       44,   44,   50,  141,   46,  319,  319,  319,  319,  142,
-      319,  319,   50,  319,  319,  319,  319,  319,  319,  319,
-       50,   44,   44,   44,  319,  319,   46,   50,  319,  319,
-      319,  319,  151,   50,  319,  319,  153,  152,  154,  154,
-      154,  154,  319,  319,  319,  319,  154,  154,  154,  154,
-      154,  154,  319,  156,  319,   50,   44,   44,   44,  319,
-
-      319,   46,  154,  154,  154,  154,  154,  154,  319,  155,
-       44,   44,   44,  319,  319,   46,   44,   44,   44,  319,
-      319,   46,   44,   44,   44,  319,  319,   46,  319,  319,
-       50,   44,   44,   44,  319,  319,   46,   44,   44,   44,
-      319,  319,   46,  319,   50,  319,  319,   44,   44,   44,
-       50,  157,   46,   44,   44,   44,   50,  319,   46,  319,
-      319,  158,   44,   44,   44,   50,  319,   46,  160,  159,
-      319,   50,  319,   44,   44,   44,  319,  319,   46,  319,
-      319,   50,  161,   44,   44,   44,  319,   50,   46,  162,
-      163,  319,   44,   44,   44,  319,   50,   46,  319,  319,
-
-       44,   44,   44,  166,  319,   46,  164,   50,  319,  165,
-       44,   44,   44,  319,  319,   46,  319,   50,  319,  319,
-      168,  319,  319,  319,  167,  319,   50,   44,   44,   44,
-      319,  319,   46,  169,   50,   44,   44,   44,  319,  319,
-       46,  319,  319,  319,   50,  319,  170,   44,   44,   44,
-      319,  319,   46,  319,   44,   44,   44,  319,  319,   46,
-      319,   50,  178,  179,  319,  319,  319,  171,  319,   50,
-      319,  180,  319,   44,   44,   44,  319,  319,   46,  172,
-      319,   50,  319,  319,   44,   44,   44,  177,   50,   46,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  181,
-
-      182,  182,  182,  182,  319,  319,  319,   50,  182,  182,
-      182,  182,  182,  182,  183,   44,   44,   44,   50,  319,
-       46,  319,  319,  319,  182,  182,  182,  182,  182,  182,
-       44,   44,   44,  319,  319,   46,  184,   44,   44,   44,
-      319,  319,   46,  319,  319,  186,  187,  319,  319,   50,
-       44,   44,   44,  319,  319,   46,  319,  319,  185,  319,
-       44,   44,   44,  319,   50,   46,  319,   44,   44,   44,
-      190,   50,   46,   44,   44,   44,  319,  319,   46,  319,
-      319,  188,  319,  319,   50,   44,   44,   44,  319,  319,
-       46,   44,   44,   44,   50,  319,   46,   44,   44,   44,
-
-      319,   50,  195,  189,  191,  319,  319,   50,   44,   44,
-       44,  319,  319,   46,  192,  319,   44,   44,   44,   50,
-      319,   46,   44,   44,   44,   50,  319,   46,  319,  319,
-      193,   50,  194,  319,   44,   44,   44,  319,  319,   46,
-      319,  319,   50,   44,   44,   44,  319,  319,  200,  319,
-       50,  319,   44,   44,   44,  319,   50,   46,  319,  319,
-      319,  319,  201,  196,  197,   44,   44,   44,   50,  319,
-       46,   44,   44,   44,  198,  199,  205,   50,   44,   44,
-       44,  319,  319,  206,  319,  319,   50,   44,   44,   44,
-      319,  319,   46,  319,  319,   44,   44,   44,  319,   50,
-
-       46,   44,   44,   44,  319,   50,   46,  319,  319,   44,
-       44,   44,   50,  319,   46,  204,  319,   44,   44,   44,
-      319,   50,   46,  319,  319,  319,  319,  207,  319,   50,
-      319,   44,   44,   44,  319,   50,  212,  319,  319,  319,
-      319,  319,  319,   50,  208,   45,   45,   45,   45,  319,
-      209,   50,  319,   45,   45,   45,   45,   45,   45,  210,
-      319,   44,   44,   44,  211,   50,  213,  319,  319,   45,
-       45,   45,   45,   45,   45,   44,   44,   44,  319,  319,
-      214,   44,   44,   44,  319,  319,   46,   44,   44,   44,
-      319,  215,   46,  319,  319,   50,   44,   44,   44,  319,
-
-      319,   46,   44,   44,   44,  319,  319,   46,  319,   50,
-      319,   44,   44,   44,  319,   50,   46,   44,   44,   44,
-      319,   50,   46,   44,   44,   44,  319,  319,   46,  319,
-       50,  216,   44,   44,   44,  319,   50,   46,  217,  319,
-      319,   44,   44,   44,  319,   50,   46,  319,  218,  319,
-      319,   50,  319,  319,  219,  319,  319,   50,   44,   44,
-       44,  319,  319,   46,  319,  319,   50,  319,  319,  221,
-      220,  319,  319,  223,  319,   50,  319,  222,  319,   44,
-       44,   44,  319,  319,   46,  319,  224,  319,   44,   44,
-       44,  319,   50,   46,   44,   44,   44,  319,  319,   46,
-
-      319,  319,   44,   44,   44,  319,  319,   46,  319,  319,
-      319,  319,  225,   50,   44,   44,   44,  319,  226,   46,
-      319,  319,   50,  319,   44,   44,   44,  319,   50,   46,
-      319,  319,   44,   44,   44,  228,   50,   46,  319,  319,
-      319,  319,  319,  229,  319,  230,  319,  319,   50,   44,
-       44,   44,  319,  319,   46,   44,   44,   44,   50,  319,
-       46,  319,  319,  319,  319,  319,   50,  319,  231,  319,
-      319,  232,  319,  233,   44,   44,   44,  319,  319,   46,
-       44,   44,   44,   50,  319,   46,   44,   44,   44,   50,
-      319,   46,   44,   44,   44,  319,  234,   46,   44,   44,
-
-       44,  319,  319,  240,  319,  235,  319,  319,   50,  319,
-       44,   44,   44,  319,   50,  241,   44,   44,   44,  319,
-       50,   46,  319,  319,  236,  319,   50,  319,  319,   44,
-       44,   44,   50,  239,   46,   44,   44,   44,  237,  238,
-       46,  319,  319,  319,   50,  245,  242,   44,   44,   44,
-       50,  319,   46,  319,   44,   44,   44,  319,  319,   46,
-       44,   44,   44,   50,  247,   46,   44,   44,   44,   50,
-      243,  249,   44,   44,   44,  319,  319,  250,  319,  319,
-      319,   50,  319,  244,  319,   44,   44,   44,   50,  319,
-       46,   44,   44,   44,   50,  251,   46,  246,  319,  319,
-
-       50,  319,  319,   44,   44,   44,   50,  319,   46,   44,
-       44,   44,  319,  248,   46,   44,   44,   44,  319,   50,
-       46,   44,   44,   44,  319,   50,  256,   44,   44,   44,
-      319,  319,  257,  319,   44,   44,   44,   50,  319,  258,
-       44,   44,   44,   50,  319,   46,  319,  252,  253,   50,
-      319,   44,   44,   44,  319,   50,   46,  319,  319,  319,
-      319,   50,  254,  319,   44,   44,   44,  255,   50,   46,
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-      319,   46,  319,  319,  319,   50,   44,   44,   44,  319,
-      259,   46,  260,  319,   44,   44,   44,  319,   50,  266,
-
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-       50,   46,   44,   44,   44,  319,  319,   46,  319,  262,
-       50,  319,  261,  265,  263,  264,  319,  319,   50,  319,
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-       50,   46,  319,   44,   44,   44,   50,  268,   46,  319,
-      269,  319,  319,  267,   44,   44,   44,  319,  319,   46,
-      319,   44,   44,   44,   50,  319,  274,   44,   44,   44,
-       50,  319,   46,   44,   44,   44,  319,   50,   46,  319,
-       44,   44,   44,  319,  270,   46,  319,  319,   50,  319,
-      271,   44,   44,   44,  272,   50,   46,  319,   44,   44,
-
-       44,   50,  319,   46,  275,  319,  273,   50,   44,   44,
-       44,  319,  319,   46,   50,   44,   44,   44,  319,  319,
-       46,   44,   44,   44,  319,   50,  282,  319,   44,   44,
-       44,  276,   50,  283,  277,   44,   44,   44,  280,  319,
-       46,  278,   50,   44,   44,   44,  319,  319,   46,   50,
-      319,   44,   44,   44,  319,   50,   46,  319,  279,   44,
-       44,   44,   50,  319,   46,  319,  319,  281,  319,   50,
-       44,   44,   44,  319,  319,   46,  319,   50,   44,   44,
-       44,  319,  319,   46,  319,   50,   44,   44,   44,  284,
-      319,   46,  319,   50,  319,  319,  285,  319,  319,  286,
-
-       44,   44,   44,  319,   50,  291,  319,  319,  319,  319,
-      287,  288,   50,   44,   44,   44,  319,  319,   46,  289,
-       50,   44,   44,   44,  319,  290,   46,   44,   44,   44,
-      319,  319,  294,  319,   50,   44,   44,   44,  319,  319,
-       46,   44,   44,   44,  319,  319,   46,   50,  319,  319,
-      292,   44,   44,   44,  319,   50,   46,   44,   44,   44,
-      319,   50,   46,   44,   44,   44,  293,  319,   46,   50,
-      319,  319,  319,  319,  319,   50,  295,  319,   44,   44,
-       44,  319,  296,   46,  319,   50,  319,   44,   44,   44,
-      319,   50,   46,   44,   44,   44,  319,   50,  302,   44,
-
-       44,   44,  319,  319,  303,  319,  298,  319,  297,  299,
-      319,  319,   50,   44,   44,   44,  319,  319,   46,  319,
-      319,   50,  319,   44,   44,   44,  319,   50,   46,  319,
-      300,  319,  319,   50,   44,   44,   44,  301,  319,   46,
-       44,   44,   44,  319,  319,   46,  319,   50,   44,   44,
-       44,  319,  319,   46,   44,   44,   44,   50,  319,  309,
-       44,   44,   44,  319,  319,  310,  319,  304,   50,  319,
-      319,   44,   44,   44,   50,  306,   46,  305,   44,   44,
-       44,  319,   50,   46,  319,  307,  319,  319,   50,  319,
-       44,   44,   44,  319,   50,   46,  319,  308,   44,   44,
-
-       44,  319,  319,   46,  319,   50,   44,   44,   44,  319,
-      319,   46,   50,   44,   44,   44,  319,  319,  316,  312,
-      319,   44,   44,   44,   50,  311,  317,  319,   44,   44,
-       44,  319,   50,  318,  319,  319,  319,  319,  319,  319,
-       50,  319,  319,  313,  319,  319,  319,   50,  319,  319,
-      319,  314,  319,  319,  319,   50,  319,  319,  319,  315,
-      319,  319,   50,   36,   36,   36,   36,   36,   45,   45,
-       45,   45,   45,   62,  319,   62,   62,   62,   81,  319,
-       81,  319,   81,   83,   83,   83,   83,   83,   89,   89,
-       89,   89,   89,  109,  319,  109,  109,  109,  122,  122,
-
-      122,   11,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319
+       11,   12,   13,   14,   13,   12,   15,   16,   12,   17,
+       18,   19,   20,   21,   22,   22,   22,   22,   23,   24,
+       12,   12,   12,   12,   12,   12,   25,   26,   12,   27,
+       12,   12,   28,   12,   29,   12,   30,   12,   12,   12,
+       12,   12,   25,   31,   12,   12,   12,   12,   12,   12,
+       32,   12,   12,   12,   12,   12,   33,   12,   12,   12,
+       12,   12,   12,   34,   35,   11,   36,   37,   14,   37,
+       36,   36,   36,   38,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       11,   12,   13,   14,   13,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   39,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   11,   44,   44,   44,   45,
+
+       45,   46,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
+       48,   45,   45,   49,   45,   45,   45,   45,   45,   45,
+       50,   45,   45,   51,   45,   52,   53,   45,   54,   45,
+       55,   45,   45,   56,   57,   58,   59,   60,   61,   45,
+       62,   45,   63,   45,   45,   45,   45,   45,   45,   45,
+       11,   44,   44,   44,   44,   44,   84,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   85,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   11,   44,   44,   44,   45,
+       45,   46,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       50,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       11,   89,   89,   89,   89,   89,   90,   89,   89,   89,
+
+       89,   89,   89,   45,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   45,   89,   89,   89,   45,
+       89,   89,   89,   45,   89,   89,   89,   89,   89,   89,
+       45,   89,   89,   89,   45,   89,   45,   91,   89,   89,
+       89,   89,   89,   89,   89,   11,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,  125,
+      125,  125,  125,   89,   89,   89,   89,  125,  125,  125,
+      125,  125,  125,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,  125,  125,  125,  125,  125,  125,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       11,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,  158,  158,  158,  158,   89,   89,
+       89,   89,  158,  158,  158,  158,  158,  158,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,  158,  158,
+      158,  158,  158,  158,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   11,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,  189,
+
+      189,  189,  189,   89,   89,   89,   89,  189,  189,  189,
+      189,  189,  189,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,  189,  189,  189,  189,  189,  189,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       11,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   45,   45,   45,   45,   89,   89,
+       89,   89,   45,   45,   45,   45,   45,   45,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   45,   45,
+       45,   45,   45,   45,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   11,   64,   64,   11,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       11,   70,   70,   11,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   11,   82,   82,   11,   82,
+       82,   43,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       11,  104,  105,   11,   89,   89,  124,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   11,   11,   11,   42,   42,
+       42,   42,   11,  127,  128,   11,   11,  185,  186,  154,
+      154,  154,  154,   40,   11,   11,  187,  154,  154,  154,
+
+      154,  154,  154,   71,   72,   11,   72,   74,   74,   73,
+       73,   73,   73,  154,  154,  154,  154,  154,  154,  183,
+      183,  183,  183,   74,   77,   11,   94,  183,  183,  183,
+      183,  183,  183,   12,   72,   11,   72,   11,   11,   73,
+       73,   73,   73,  183,  183,  183,  183,  183,  183,  213,
+      213,  213,  213,   95,   11,   11,   96,  213,  213,  213,
+      213,  213,  213,   69,   11,   11,   11,   11,   70,   11,
+       75,   11,   11,  213,  213,  213,  213,  213,  213,   44,
+       44,   44,   44,   65,   65,   65,   65,   44,   44,   44,
+       44,   44,   44,   40,   75,   67,   11,   76,   11,   75,
+
+       11,   76,   44,   44,   44,   44,   44,   44,   44,   44,
+       65,   67,   66,   66,   66,   66,   11,   11,   42,   41,
+       42,   76,   81,   78,   67,   79,   41,   98,   11,   11,
+       80,   44,   99,   12,   11,   44,  100,   43,   11,   44,
+       67,  101,   11,   11,   12,   11,   44,   11,   11,   83,
+       44,   12,   44,  120,   65,   11,   68,   68,   68,   68,
+       65,   11,   68,   68,   68,   68,  112,   65,   67,   66,
+       66,   66,   66,   65,   67,   68,   68,   68,   68,   11,
+      114,   67,   11,   11,   67,   11,  112,   67,   11,   11,
+       67,   11,   11,   65,   65,   65,   65,   67,   11,   73,
+
+       73,   73,   73,   67,  114,   67,   73,   73,   73,   73,
+      113,  112,   11,   11,   11,   11,  113,   11,  108,  148,
+      110,   67,  114,   11,   11,  111,   11,  109,   11,  147,
+      113,  115,  169,  194,  195,  170,  116,   11,  149,  148,
+      227,  149,  148,  180,  147,   11,  117,  228,  254,  180,
+      279,   86,   87,  147,  149,   88,  280,  152,   92,  180,
+       93,   97,  151,  102,  118,  181,  103,  106,  150,  107,
+       11,   11,   11,   11,  153,   11,   11,  119,  212,  255,
+      129,   11,   11,   11,   11,  182,   11,  240,   11,   11,
+       11,   11,  203,  210,   11,  215,  216,  198,  211,  219,
+
+      223,  224,  225,  226,  236,   11,   11,   11,   11,   11,
+       11,   11,  130,  122,  131,  135,  140,  123,  136,  142,
+      144,  145,  138,  121,  133,  146,  157,  141,  156,  134,
+      132,  139,  143,  137,  126,  155,  159,  160,  161,  162,
+      163,  164,  165,  166,  167,  168,  171,  172,  173,  174,
+      175,  176,  177,  178,  179,  184,  188,  190,  191,  192,
+      193,  196,  197,  199,  200,  201,  202,  204,  205,  206,
+      207,  208,  209,  214,  217,  218,  220,  221,  222,  229,
+      230,  231,  232,  233,  234,  235,  237,  238,  239,  241,
+      242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+
+      252,  253,  256,  257,  258,  259,  260,  261,  262,  263,
+      264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
+       11,   11,   11,   11,   11,   11,  283,   11,   11,   11,
+       11,  290,  293,  301,  302,  311,   11,   11,   11,   11,
+       11,   11,  314,  315,   11,  323,  324,  330,  331,   11,
+       11,   11,  340,  340,  340,  337,  338,  339,  282,  340,
+      340,  286,  276,  294,  285,  340,  277,  312,  340,  297,
+      281,  274,  305,  308,  309,  299,  310,  284,  287,  275,
+      288,  278,  289,  291,  296,  298,  295,  292,  300,  303,
+      304,  306,  307,  313,  316,  317,  318,  319,  320,  321,
+
+      322,  325,  326,  327,  328,  329,  332,  333,  334,  335,
+      336,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340
     } ;
 
-static const flex_int16_t yy_chk[2165] =
+static const flex_int16_t yy_chk[1596] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1114,238 +1053,175 @@ static const flex_int16_t yy_chk[2165] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    4,    4,    4,    3,    9,
-        7,    4,    5,    5,    8,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,   10,   13,   37,   13,
-       37,   21,    5,    5,    9,    5,   21,   26,    5,   25,
-
-        5,   25,    5,   27,   25,   25,   25,   25,    5,    5,
-        7,   10,    5,   26,    8,  331,    5,   31,   28,   44,
-       42,    5,   42,   32,   33,  330,   27,    5,    5,   15,
-       15,   15,  329,   31,   15,   17,  328,   17,   17,   17,
-       17,   28,   20,   20,   20,   20,   32,   33,   44,   17,
-      202,   75,   15,   15,   20,   73,   15,   71,   71,   71,
-       71,   74,  175,   15,  149,   17,   83,   78,   15,   15,
-       20,   15,  122,   15,   75,   73,   15,   15,   15,   15,
-       15,   74,   15,   19,   15,   19,   19,   19,   19,   22,
-       78,   22,   22,   22,   22,   83,  116,   19,   76,   45,
-
-       45,   45,  110,   22,   45,   47,   47,   47,   89,   81,
-       47,   80,   77,   19,   50,   48,   48,   48,   76,   22,
-       48,   50,   49,   49,   49,  110,  111,   49,   72,   72,
-       72,   72,   77,   45,  112,   51,   51,   51,   43,   47,
-       51,   41,  113,   50,  115,   39,  111,   50,  114,   48,
-      112,   50,   52,   52,   52,   47,   49,   52,   50,   48,
-      115,   50,   38,   50,   50,  113,   52,  143,  114,   51,
-       24,   14,   49,   53,   53,   53,   11,    0,   53,   54,
-       54,   54,    0,  143,   54,   51,   52,   55,   55,   55,
-        0,    0,   55,   52,    0,    0,   52,   56,   56,   56,
-
-      146,    0,   56,    0,   57,   57,   57,   53,    0,   57,
-       58,   58,   58,   54,    0,   58,  146,   59,   59,   59,
-       53,   55,   59,   60,   60,   60,    0,    0,   60,   54,
-        0,   56,   55,   54,   56,    0,    0,   55,   57,    0,
-        0,   57,    0,    0,   58,   61,   61,   61,    0,    0,
-       61,   59,    0,    0,   59,    0,    0,   60,   63,   63,
-       63,   63,    0,    0,   60,   58,    0,    0,    0,   65,
-       63,   65,    0,   60,   65,   65,   65,   65,   64,   61,
-       64,   64,   64,   64,    0,   66,   63,   66,   66,   66,
-       66,    0,   64,    0,   61,    0,    0,   85,   61,   66,
-
-       67,   67,   67,   67,   85,   86,   86,   86,   64,    0,
-       86,    0,   67,    0,    0,   66,   87,   87,   87,    0,
-        0,   87,   88,   88,   88,    0,   85,   88,   67,    0,
-       85,    0,    0,    0,   85,   90,   90,   90,    0,   86,
-       90,   85,    0,    0,   85,    0,   85,   85,    0,    0,
-       87,    0,    0,    0,   86,   87,   88,   92,   92,   92,
-        0,    0,   92,    0,    0,   88,    0,    0,    0,   90,
-       91,   91,   91,   91,    0,    0,    0,    0,   91,   91,
-       91,   91,   91,   91,   93,   93,   93,    0,    0,   93,
-        0,   92,    0,    0,   91,   91,   91,   91,   91,   91,
-
-        0,    0,   94,   94,   94,   92,   92,   94,   95,   95,
-       95,    0,    0,   95,   96,   96,   96,    0,   93,   96,
-       97,   97,   97,    0,    0,   97,   98,   98,   98,    0,
-        0,   98,    0,   99,   99,   99,   94,    0,   99,    0,
-       94,    0,   95,    0,  100,  100,  100,   95,   96,  100,
-      101,  101,  101,    0,   97,  101,  102,  102,  102,    0,
-       98,  102,    0,  103,  103,  103,    0,   99,  103,   96,
-       97,   99,  104,  104,  104,    0,    0,  104,  100,    0,
-       98,  105,  105,  105,  101,    0,  105,  100,    0,    0,
-      102,  106,  106,  106,    0,    0,  106,  103,  107,  107,
-
-      107,    0,    0,  107,  102,    0,  104,  101,  108,  108,
-      108,    0,    0,  108,    0,  105,    0,  103,  119,  119,
-      119,    0,    0,  119,  104,  106,  120,  120,  120,    0,
-      106,  120,  107,  121,  121,  121,    0,  105,  121,  126,
-      126,  126,  108,  107,  126,    0,    0,    0,    0,  108,
-        0,    0,  119,    0,    0,    0,    0,    0,    0,    0,
-      120,  125,  125,  125,    0,    0,  125,  121,    0,    0,
-        0,    0,  119,  126,    0,    0,  121,  120,  124,  124,
-      124,  124,    0,    0,    0,    0,  124,  124,  124,  124,
-      124,  124,    0,  126,    0,  125,  128,  128,  128,    0,
-
-        0,  128,  124,  124,  124,  124,  124,  124,    0,  125,
-      129,  129,  129,    0,    0,  129,  130,  130,  130,    0,
-        0,  130,  131,  131,  131,    0,    0,  131,    0,    0,
-      128,  132,  132,  132,    0,    0,  132,  133,  133,  133,
-        0,    0,  133,    0,  129,    0,    0,  134,  134,  134,
-      130,  128,  134,  135,  135,  135,  131,    0,  135,    0,
-        0,  129,  136,  136,  136,  132,    0,  136,  131,  130,
-        0,  133,    0,  137,  137,  137,    0,    0,  137,    0,
-        0,  134,  132,  138,  138,  138,    0,  135,  138,  133,
-      134,    0,  139,  139,  139,    0,  136,  139,    0,    0,
-
-      140,  140,  140,  136,    0,  140,  135,  137,    0,  135,
-      141,  141,  141,    0,    0,  141,    0,  138,    0,    0,
-      138,    0,    0,    0,  137,    0,  139,  142,  142,  142,
-        0,    0,  142,  139,  140,  151,  151,  151,    0,    0,
-      151,    0,    0,    0,  141,    0,  140,  152,  152,  152,
-        0,    0,  152,    0,  153,  153,  153,    0,    0,  153,
-        0,  142,  152,  152,    0,    0,    0,  141,    0,  151,
-        0,  152,    0,  155,  155,  155,    0,    0,  155,  142,
-        0,  152,    0,    0,  156,  156,  156,  151,  153,  156,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  153,
-
-      154,  154,  154,  154,    0,    0,    0,  155,  154,  154,
-      154,  154,  154,  154,  155,  157,  157,  157,  156,    0,
-      157,    0,    0,    0,  154,  154,  154,  154,  154,  154,
-      158,  158,  158,    0,    0,  158,  156,  159,  159,  159,
-        0,    0,  159,    0,    0,  158,  158,    0,    0,  157,
-      160,  160,  160,    0,    0,  160,    0,    0,  157,    0,
-      161,  161,  161,    0,  158,  161,    0,  162,  162,  162,
-      161,  159,  162,  163,  163,  163,    0,    0,  163,    0,
-        0,  159,    0,    0,  160,  164,  164,  164,    0,    0,
-      164,  165,  165,  165,  161,    0,  165,  166,  166,  166,
-
-        0,  162,  166,  160,  162,    0,    0,  163,  167,  167,
-      167,    0,    0,  167,  163,    0,  168,  168,  168,  164,
-        0,  168,  169,  169,  169,  165,    0,  169,    0,    0,
-      164,  166,  165,    0,  170,  170,  170,    0,    0,  170,
-        0,    0,  167,  171,  171,  171,    0,    0,  171,    0,
-      168,    0,  172,  172,  172,    0,  169,  172,    0,    0,
-        0,    0,  172,  167,  168,  177,  177,  177,  170,    0,
-      177,  178,  178,  178,  169,  170,  178,  171,  179,  179,
-      179,    0,    0,  179,    0,    0,  172,  180,  180,  180,
-        0,    0,  180,    0,    0,  181,  181,  181,    0,  177,
-
-      181,  183,  183,  183,    0,  178,  183,    0,    0,  184,
-      184,  184,  179,    0,  184,  177,    0,  185,  185,  185,
-        0,  180,  185,    0,    0,    0,    0,  180,    0,  181,
-        0,  186,  186,  186,    0,  183,  186,    0,    0,    0,
-        0,    0,    0,  184,  181,  182,  182,  182,  182,    0,
-      183,  185,    0,  182,  182,  182,  182,  182,  182,  184,
-        0,  187,  187,  187,  185,  186,  187,    0,    0,  182,
-      182,  182,  182,  182,  182,  188,  188,  188,    0,    0,
-      188,  189,  189,  189,    0,    0,  189,  190,  190,  190,
-        0,  189,  190,    0,    0,  187,  191,  191,  191,    0,
-
-        0,  191,  192,  192,  192,    0,    0,  192,    0,  188,
-        0,  193,  193,  193,    0,  189,  193,  194,  194,  194,
-        0,  190,  194,  196,  196,  196,    0,    0,  196,    0,
-      191,  190,  197,  197,  197,    0,  192,  197,  190,    0,
-        0,  198,  198,  198,    0,  193,  198,    0,  191,    0,
-        0,  194,    0,    0,  192,    0,    0,  196,  199,  199,
-      199,    0,    0,  199,    0,    0,  197,    0,    0,  194,
-      193,    0,    0,  197,    0,  198,    0,  196,    0,  201,
-      201,  201,    0,    0,  201,    0,  198,    0,  204,  204,
-      204,    0,  199,  204,  207,  207,  207,    0,    0,  207,
-
-        0,    0,  208,  208,  208,    0,    0,  208,    0,    0,
-        0,    0,  199,  201,  209,  209,  209,    0,  201,  209,
-        0,    0,  204,    0,  210,  210,  210,    0,  207,  210,
-        0,    0,  211,  211,  211,  204,  208,  211,    0,    0,
-        0,    0,    0,  207,    0,  208,    0,    0,  209,  215,
-      215,  215,    0,    0,  215,  216,  216,  216,  210,    0,
-      216,    0,    0,    0,    0,    0,  211,    0,  209,    0,
-        0,  210,    0,  211,  217,  217,  217,    0,    0,  217,
-      218,  218,  218,  215,    0,  218,  219,  219,  219,  216,
-        0,  219,  220,  220,  220,    0,  215,  220,  221,  221,
-
-      221,    0,    0,  221,    0,  216,    0,    0,  217,    0,
-      222,  222,  222,    0,  218,  222,  223,  223,  223,    0,
-      219,  223,    0,    0,  217,    0,  220,    0,    0,  224,
-      224,  224,  221,  220,  224,  225,  225,  225,  218,  219,
-      225,    0,    0,    0,  222,  225,  222,  226,  226,  226,
-      223,    0,  226,    0,  228,  228,  228,    0,    0,  228,
-      229,  229,  229,  224,  228,  229,  230,  230,  230,  225,
-      223,  230,  231,  231,  231,    0,    0,  231,    0,    0,
-        0,  226,    0,  224,    0,  232,  232,  232,  228,    0,
-      232,  233,  233,  233,  229,  232,  233,  226,    0,    0,
-
-      230,    0,    0,  234,  234,  234,  231,    0,  234,  235,
-      235,  235,    0,  229,  235,  236,  236,  236,    0,  232,
-      236,  237,  237,  237,    0,  233,  237,  238,  238,  238,
-        0,    0,  238,    0,  239,  239,  239,  234,    0,  239,
-      242,  242,  242,  235,    0,  242,    0,  233,  234,  236,
-        0,  243,  243,  243,    0,  237,  243,    0,    0,    0,
-        0,  238,  235,    0,  244,  244,  244,  236,  239,  244,
-      245,  245,  245,    0,  242,  245,  246,  246,  246,    0,
-        0,  246,    0,    0,    0,  243,  247,  247,  247,    0,
-      242,  247,  243,    0,  248,  248,  248,    0,  244,  248,
-
-      251,  251,  251,    0,  245,  251,  252,  252,  252,    0,
-      246,  252,  253,  253,  253,    0,    0,  253,    0,  245,
-      247,    0,  244,  247,  245,  246,    0,    0,  248,    0,
-      254,  254,  254,    0,  251,  254,  255,  255,  255,    0,
-      252,  255,    0,  259,  259,  259,  253,  252,  259,    0,
-      253,    0,    0,  251,  260,  260,  260,    0,    0,  260,
-        0,  261,  261,  261,  254,    0,  261,  262,  262,  262,
-      255,    0,  262,  263,  263,  263,    0,  259,  263,    0,
-      264,  264,  264,    0,  254,  264,    0,    0,  260,    0,
-      255,  268,  268,  268,  259,  261,  268,    0,  265,  265,
-
-      265,  262,    0,  265,  262,    0,  260,  263,  267,  267,
-      267,    0,    0,  267,  264,  269,  269,  269,    0,    0,
-      269,  270,  270,  270,    0,  268,  270,    0,  271,  271,
-      271,  263,  265,  271,  264,  272,  272,  272,  268,    0,
-      272,  265,  267,  273,  273,  273,    0,    0,  273,  269,
-        0,  275,  275,  275,    0,  270,  275,    0,  267,  276,
-      276,  276,  271,    0,  276,    0,    0,  269,    0,  272,
-      277,  277,  277,    0,    0,  277,    0,  273,  278,  278,
-      278,    0,    0,  278,    0,  275,  279,  279,  279,  272,
-        0,  279,    0,  276,    0,    0,  273,    0,    0,  275,
-
-      280,  280,  280,    0,  277,  280,    0,    0,    0,    0,
-      276,  277,  278,  281,  281,  281,    0,    0,  281,  278,
-      279,  284,  284,  284,    0,  279,  284,  285,  285,  285,
-        0,    0,  285,    0,  280,  286,  286,  286,    0,    0,
-      286,  287,  287,  287,    0,    0,  287,  281,    0,    0,
-      281,  288,  288,  288,    0,  284,  288,  289,  289,  289,
-        0,  285,  289,  290,  290,  290,  284,    0,  290,  286,
-        0,    0,    0,    0,    0,  287,  286,    0,  292,  292,
-      292,    0,  287,  292,    0,  288,    0,  293,  293,  293,
-        0,  289,  293,  295,  295,  295,    0,  290,  295,  296,
-
-      296,  296,    0,    0,  296,    0,  289,    0,  288,  290,
-        0,    0,  292,  297,  297,  297,    0,    0,  297,    0,
-        0,  293,    0,  298,  298,  298,    0,  295,  298,    0,
-      292,    0,    0,  296,  299,  299,  299,  293,    0,  299,
-      300,  300,  300,    0,    0,  300,    0,  297,  301,  301,
-      301,    0,    0,  301,  304,  304,  304,  298,    0,  304,
-      305,  305,  305,    0,    0,  305,    0,  297,  299,    0,
-        0,  306,  306,  306,  300,  299,  306,  298,  307,  307,
-      307,    0,  301,  307,    0,  300,    0,    0,  304,    0,
-      308,  308,  308,    0,  305,  308,    0,  301,  311,  311,
-
-      311,    0,    0,  311,    0,  306,  312,  312,  312,    0,
-        0,  312,  307,  313,  313,  313,    0,    0,  313,  307,
-        0,  314,  314,  314,  308,  306,  314,    0,  315,  315,
-      315,    0,  311,  315,    0,    0,    0,    0,    0,    0,
-      312,    0,    0,  308,    0,    0,    0,  313,    0,    0,
-        0,  311,    0,    0,    0,  314,    0,    0,    0,  312,
-        0,    0,  315,  320,  320,  320,  320,  320,  321,  321,
-      321,  321,  321,  322,    0,  322,  322,  322,  323,    0,
-      323,    0,  323,  324,  324,  324,  324,  324,  325,  325,
-      325,  325,  325,  326,    0,  326,  326,  326,  327,  327,
-
-      327,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319
+        1,    1,    1,    1,    1,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,   15,   15,   15,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,   16,   16,   16,   12,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       70,   70,   70,   18,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   40,   40,   40,   14,   40,
+       40,   14,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       89,   59,   59,   23,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,  120,   13,   37,   13,   37,
+       13,   37,   24,   93,   93,   26,   31,  156,  156,  120,
+      120,  120,  120,    7,   29,   25,  156,  120,  120,  120,
+
+      120,  120,  120,   24,   25,  154,   25,   26,   31,   25,
+       25,   25,   25,  120,  120,  120,  120,  120,  120,  154,
+      154,  154,  154,   26,   31,   67,   53,  154,  154,  154,
+      154,  154,  154,    7,   67,  183,   67,   27,   30,   67,
+       67,   67,   67,  154,  154,  154,  154,  154,  154,  183,
+      183,  183,  183,   53,   34,   21,   53,  183,  183,  183,
+      183,  183,  183,   21,   35,  213,   32,   28,   21,   20,
+       27,   33,   39,  183,  183,  183,  183,  183,  183,  213,
+      213,  213,  213,   20,   20,   20,   20,  213,  213,  213,
+      213,  213,  213,    8,   27,   20,   85,   28,   17,   32,
+
+       36,   33,   85,  213,  213,  213,  213,  213,  213,   85,
+       17,   20,   17,   17,   17,   17,   42,   38,   42,    9,
+       42,   28,   39,   32,   17,   33,   10,   55,   46,   41,
+       38,   85,   55,    8,   43,   85,   56,   43,   74,   85,
+       17,   56,   19,   69,    9,   71,   85,   76,   22,   41,
+       85,   10,   85,   85,   19,   66,   19,   19,   19,   19,
+       22,   68,   22,   22,   22,   22,   74,   66,   19,   66,
+       66,   66,   66,   68,   22,   68,   68,   68,   68,   65,
+       76,   66,   75,   77,   19,   72,   74,   68,   78,   79,
+       22,  113,   73,   65,   65,   65,   65,   66,  112,   72,
+
+       72,   72,   72,   68,   76,   65,   73,   73,   73,   73,
+       75,   77,  114,  115,  116,  117,   78,  147,   62,  113,
+       63,   65,   79,  150,   81,   63,  118,   62,  153,  112,
+       75,   77,  137,  163,  163,  137,   78,  182,  114,  113,
+      198,  117,  116,  147,  115,  212,   79,  198,  233,  150,
+      260,   47,   48,  112,  114,   49,  260,  117,   51,  147,
+       52,   54,  116,   57,   81,  150,   58,   60,  115,   61,
+       80,   83,   84,  119,  118,  124,  129,   82,  182,  233,
+       94,  148,  149,  151,  152,  153,  180,  212,  181,  203,
+      210,  215,  171,  178,  216,  185,  186,  166,  179,  190,
+
+      194,  195,  196,  197,  207,  219,  223,  224,  225,  240,
+      253,  254,   95,   87,   96,  100,  105,   88,  101,  107,
+      109,  110,  103,   86,   98,  111,  123,  106,  122,   99,
+       97,  104,  108,  102,   92,  121,  126,  127,  128,  130,
+      131,  132,  133,  134,  135,  136,  138,  139,  140,  141,
+      142,  143,  144,  145,  146,  155,  157,  159,  160,  161,
+      162,  164,  165,  167,  168,  169,  170,  172,  173,  174,
+      175,  176,  177,  184,  187,  188,  191,  192,  193,  199,
+      200,  201,  202,  204,  205,  206,  208,  209,  211,  214,
+      217,  218,  220,  221,  222,  226,  227,  228,  229,  230,
+
+      231,  232,  234,  235,  236,  237,  238,  239,  241,  242,
+      243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+      264,  265,  271,  272,  273,  283,  263,  290,  293,  301,
+      302,  275,  278,  287,  288,  299,  311,  314,  315,  323,
+      324,  330,  304,  305,  331,  316,  317,  325,  326,  337,
+      338,  339,    0,    0,    0,  334,  335,  336,  262,    0,
+        0,  268,  257,  279,  267,    0,  258,  300,    0,  282,
+      261,  255,  292,  296,  297,  285,  298,  266,  269,  256,
+      270,  259,  274,  276,  281,  284,  280,  277,  286,  289,
+      291,  294,  295,  303,  306,  307,  308,  309,  310,  312,
+
+      313,  318,  319,  320,  321,  322,  327,  328,  329,  332,
+      333,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1354,14 +1230,14 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[58] =
+static const flex_int16_t yy_rule_linenum[61] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  195,  204,  215,  226,  235,  244,  253,
       262,  271,  280,  289,  298,  307,  316,  325,  334,  343,
       352,  361,  370,  379,  388,  397,  406,  415,  424,  433,
-      532,  537,  542,  547,  548,  549,  550,  551,  552,  554,
-      572,  585,  590,  594,  596,  598,  600
+      442,  451,  460,  559,  564,  569,  574,  575,  576,  577,
+      578,  579,  581,  599,  612,  617,  621,  623,  625,  627
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1416,7 +1292,7 @@ using isc::agent::AgentParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::agent::ParserContext::fatal(msg)
-#line 1419 "agent_lexer.cc"
+#line 1295 "agent_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1442,8 +1318,8 @@ using isc::agent::AgentParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1445 "agent_lexer.cc"
-#line 1446 "agent_lexer.cc"
+#line 1321 "agent_lexer.cc"
+#line 1322 "agent_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1757,7 +1633,7 @@ YY_DECL
     }
 
 
-#line 1760 "agent_lexer.cc"
+#line 1636 "agent_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1786,13 +1662,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 320 )
+				if ( yy_current_state >= 341 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 319 );
+		while ( yy_current_state != 340 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1811,13 +1687,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 58 )
+			else if ( yy_act < 61 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 58 )
+			else if ( yy_act == 61 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 59 )
+			else if ( yy_act == 62 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2204,6 +2080,42 @@ YY_RULE_SETUP
 case 35:
 YY_RULE_SETUP
 #line 388 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+#line 397 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return AgentParser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 406 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return AgentParser::make_STRING("overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+#line 415 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2213,9 +2125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 39:
 YY_RULE_SETUP
-#line 397 "agent_lexer.ll"
+#line 424 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2225,9 +2137,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 40:
 YY_RULE_SETUP
-#line 406 "agent_lexer.ll"
+#line 433 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2237,9 +2149,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 41:
 YY_RULE_SETUP
-#line 415 "agent_lexer.ll"
+#line 442 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2249,9 +2161,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 42:
 YY_RULE_SETUP
-#line 424 "agent_lexer.ll"
+#line 451 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2261,9 +2173,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 43:
 YY_RULE_SETUP
-#line 433 "agent_lexer.ll"
+#line 460 "agent_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2363,65 +2275,65 @@ YY_RULE_SETUP
     return AgentParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 41:
-/* rule 41 can match eol */
+case 44:
+/* rule 44 can match eol */
 YY_RULE_SETUP
-#line 532 "agent_lexer.ll"
+#line 559 "agent_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 42:
-/* rule 42 can match eol */
+case 45:
+/* rule 45 can match eol */
 YY_RULE_SETUP
-#line 537 "agent_lexer.ll"
+#line 564 "agent_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 43:
+case 46:
 YY_RULE_SETUP
-#line 542 "agent_lexer.ll"
+#line 569 "agent_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 44:
+case 47:
 YY_RULE_SETUP
-#line 547 "agent_lexer.ll"
+#line 574 "agent_lexer.ll"
 { return AgentParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 45:
+case 48:
 YY_RULE_SETUP
-#line 548 "agent_lexer.ll"
+#line 575 "agent_lexer.ll"
 { return AgentParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 46:
+case 49:
 YY_RULE_SETUP
-#line 549 "agent_lexer.ll"
+#line 576 "agent_lexer.ll"
 { return AgentParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 47:
+case 50:
 YY_RULE_SETUP
-#line 550 "agent_lexer.ll"
+#line 577 "agent_lexer.ll"
 { return AgentParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 48:
+case 51:
 YY_RULE_SETUP
-#line 551 "agent_lexer.ll"
+#line 578 "agent_lexer.ll"
 { return AgentParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 49:
+case 52:
 YY_RULE_SETUP
-#line 552 "agent_lexer.ll"
+#line 579 "agent_lexer.ll"
 { return AgentParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 50:
+case 53:
 YY_RULE_SETUP
-#line 554 "agent_lexer.ll"
+#line 581 "agent_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2440,9 +2352,9 @@ YY_RULE_SETUP
     return AgentParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 51:
+case 54:
 YY_RULE_SETUP
-#line 572 "agent_lexer.ll"
+#line 599 "agent_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2456,43 +2368,43 @@ YY_RULE_SETUP
     return AgentParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 52:
+case 55:
 YY_RULE_SETUP
-#line 585 "agent_lexer.ll"
+#line 612 "agent_lexer.ll"
 {
     string tmp(yytext);
     return AgentParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 53:
+case 56:
 YY_RULE_SETUP
-#line 590 "agent_lexer.ll"
+#line 617 "agent_lexer.ll"
 {
    return AgentParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 54:
+case 57:
 YY_RULE_SETUP
-#line 594 "agent_lexer.ll"
+#line 621 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 55:
+case 58:
 YY_RULE_SETUP
-#line 596 "agent_lexer.ll"
+#line 623 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 56:
+case 59:
 YY_RULE_SETUP
-#line 598 "agent_lexer.ll"
+#line 625 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 57:
+case 60:
 YY_RULE_SETUP
-#line 600 "agent_lexer.ll"
+#line 627 "agent_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 602 "agent_lexer.ll"
+#line 629 "agent_lexer.ll"
 {
     if (driver.states_.empty()) {
         return AgentParser::make_END(driver.loc_);
@@ -2516,12 +2428,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 58:
+case 61:
 YY_RULE_SETUP
-#line 625 "agent_lexer.ll"
+#line 652 "agent_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2524 "agent_lexer.cc"
+#line 2436 "agent_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2840,7 +2752,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 320 )
+			if ( yy_current_state >= 341 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2873,11 +2785,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 320 )
+		if ( yy_current_state >= 341 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 319);
+	yy_is_jam = (yy_current_state == 340);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3626,8 +3538,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 625 "agent_lexer.ll"
-
+#line 652 "agent_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -3729,4 +3640,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
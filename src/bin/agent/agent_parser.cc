@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.3.2.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 33 "agent_parser.yy" // lalr1.cc:435
+#line 33 "agent_parser.yy"
 
 #include <agent/parser_context.h>
 
-#line 51 "agent_parser.cc" // lalr1.cc:435
+#line 52 "agent_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if AGENT_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !AGENT_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,57 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "agent_parser.yy" // lalr1.cc:510
+#line 14 "agent_parser.yy"
 namespace isc { namespace agent {
-#line 146 "agent_parser.cc" // lalr1.cc:510
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  AgentParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "agent_parser.cc"
 
   /// Build a parser object.
   AgentParser::AgentParser (isc::agent::ParserContext& ctx_yyarg)
-    :
 #if AGENT_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -201,9 +160,9 @@ namespace isc { namespace agent {
   AgentParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -233,13 +192,13 @@ namespace isc { namespace agent {
     : state (s)
   {}
 
-  AgentParser::symbol_number_type
-  AgentParser::by_state::type_get () const YY_NOEXCEPT
+  AgentParser::symbol_kind_type
+  AgentParser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   AgentParser::stack_symbol_type::stack_symbol_type ()
@@ -248,27 +207,27 @@ namespace isc { namespace agent {
   AgentParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,27 +244,27 @@ namespace isc { namespace agent {
   AgentParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -314,35 +273,71 @@ namespace isc { namespace agent {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  AgentParser::stack_symbol_type&
+  AgentParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   AgentParser::stack_symbol_type&
   AgentParser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -368,69 +363,67 @@ namespace isc { namespace agent {
 #if AGENT_DEBUG
   template <typename Base>
   void
-  AgentParser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  AgentParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 41: // "constant string"
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 392 "agent_parser.cc" // lalr1.cc:676
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "agent_parser.cc"
         break;
 
-      case 42: // "integer"
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 398 "agent_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_INTEGER: // "integer"
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "agent_parser.cc"
         break;
 
-      case 43: // "floating point"
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < double > (); }
-#line 404 "agent_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "agent_parser.cc"
         break;
 
-      case 44: // "boolean"
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 410 "agent_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "agent_parser.cc"
         break;
 
-      case 53: // value
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 416 "agent_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_value: // value
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "agent_parser.cc"
         break;
 
-      case 56: // map_value
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 422 "agent_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_map_value: // map_value
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "agent_parser.cc"
         break;
 
-      case 107: // socket_type_value
-#line 103 "agent_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 428 "agent_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_socket_type_value: // socket_type_value
+#line 106 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "agent_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -454,7 +447,7 @@ namespace isc { namespace agent {
   }
 
   void
-  AgentParser::yypop_ (int n)
+  AgentParser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -489,21 +482,21 @@ namespace isc { namespace agent {
   AgentParser::state_type
   AgentParser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  AgentParser::yy_pact_value_is_default_ (int yyvalue)
+  AgentParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  AgentParser::yy_table_value_is_error_ (int yyvalue)
+  AgentParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -517,7 +510,6 @@ namespace isc { namespace agent {
   int
   AgentParser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -553,7 +545,8 @@ namespace isc { namespace agent {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -567,14 +560,14 @@ namespace isc { namespace agent {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -593,11 +586,23 @@ namespace isc { namespace agent {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -614,7 +619,7 @@ namespace isc { namespace agent {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -622,7 +627,7 @@ namespace isc { namespace agent {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -641,25 +646,25 @@ namespace isc { namespace agent {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -683,208 +688,208 @@ namespace isc { namespace agent {
         {
           switch (yyn)
             {
-  case 2:
-#line 114 "agent_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.NO_KEYWORDS; }
-#line 690 "agent_parser.cc" // lalr1.cc:919
+  case 2: // $@1: %empty
+#line 117 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.NO_KEYWORDS; }
+#line 695 "agent_parser.cc"
     break;
 
-  case 4:
-#line 115 "agent_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 696 "agent_parser.cc" // lalr1.cc:919
+  case 4: // $@2: %empty
+#line 118 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "agent_parser.cc"
     break;
 
-  case 6:
-#line 116 "agent_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.AGENT; }
-#line 702 "agent_parser.cc" // lalr1.cc:919
+  case 6: // $@3: %empty
+#line 119 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.AGENT; }
+#line 707 "agent_parser.cc"
     break;
 
-  case 8:
-#line 124 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 8: // $@4: %empty
+#line 127 "agent_parser.yy"
+                          {
     // Parse the Control-agent map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 712 "agent_parser.cc" // lalr1.cc:919
+#line 717 "agent_parser.cc"
     break;
 
-  case 9:
-#line 128 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 9: // sub_agent: "{" $@4 global_params "}"
+#line 131 "agent_parser.yy"
+                               {
     // parsing completed
 }
-#line 720 "agent_parser.cc" // lalr1.cc:919
+#line 725 "agent_parser.cc"
     break;
 
-  case 10:
-#line 135 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 10: // json: value
+#line 138 "agent_parser.yy"
+            {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 729 "agent_parser.cc" // lalr1.cc:919
+#line 734 "agent_parser.cc"
     break;
 
-  case 11:
-#line 141 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 735 "agent_parser.cc" // lalr1.cc:919
+  case 11: // value: "integer"
+#line 144 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 740 "agent_parser.cc"
     break;
 
-  case 12:
-#line 142 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 741 "agent_parser.cc" // lalr1.cc:919
+  case 12: // value: "floating point"
+#line 145 "agent_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 746 "agent_parser.cc"
     break;
 
-  case 13:
-#line 143 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 747 "agent_parser.cc" // lalr1.cc:919
+  case 13: // value: "boolean"
+#line 146 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 752 "agent_parser.cc"
     break;
 
-  case 14:
-#line 144 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 753 "agent_parser.cc" // lalr1.cc:919
+  case 14: // value: "constant string"
+#line 147 "agent_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 758 "agent_parser.cc"
     break;
 
-  case 15:
-#line 145 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 759 "agent_parser.cc" // lalr1.cc:919
+  case 15: // value: "null"
+#line 148 "agent_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 764 "agent_parser.cc"
     break;
 
-  case 16:
-#line 146 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 765 "agent_parser.cc" // lalr1.cc:919
+  case 16: // value: map
+#line 149 "agent_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 770 "agent_parser.cc"
     break;
 
-  case 17:
-#line 147 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 771 "agent_parser.cc" // lalr1.cc:919
+  case 17: // value: list_generic
+#line 150 "agent_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 776 "agent_parser.cc"
     break;
 
-  case 18:
-#line 151 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 18: // $@5: %empty
+#line 154 "agent_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 782 "agent_parser.cc" // lalr1.cc:919
+#line 787 "agent_parser.cc"
     break;
 
-  case 19:
-#line 156 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 19: // map: "{" $@5 map_content "}"
+#line 159 "agent_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 792 "agent_parser.cc" // lalr1.cc:919
+#line 797 "agent_parser.cc"
     break;
 
-  case 20:
-#line 162 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 798 "agent_parser.cc" // lalr1.cc:919
+  case 20: // map_value: map
+#line 165 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 803 "agent_parser.cc"
     break;
 
-  case 23:
-#line 176 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 23: // not_empty_map: "constant string" ":" value
+#line 179 "agent_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 807 "agent_parser.cc" // lalr1.cc:919
+#line 812 "agent_parser.cc"
     break;
 
-  case 24:
-#line 180 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 24: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 183 "agent_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 817 "agent_parser.cc" // lalr1.cc:919
+#line 822 "agent_parser.cc"
     break;
 
-  case 25:
-#line 187 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 25: // $@6: %empty
+#line 190 "agent_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 826 "agent_parser.cc" // lalr1.cc:919
+#line 831 "agent_parser.cc"
     break;
 
-  case 26:
-#line 190 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 26: // list_generic: "[" $@6 list_content "]"
+#line 193 "agent_parser.yy"
+                               {
 }
-#line 833 "agent_parser.cc" // lalr1.cc:919
+#line 838 "agent_parser.cc"
     break;
 
-  case 29:
-#line 197 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 29: // not_empty_list: value
+#line 200 "agent_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 842 "agent_parser.cc" // lalr1.cc:919
+#line 847 "agent_parser.cc"
     break;
 
-  case 30:
-#line 201 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 30: // not_empty_list: not_empty_list "," value
+#line 204 "agent_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 851 "agent_parser.cc" // lalr1.cc:919
+#line 856 "agent_parser.cc"
     break;
 
-  case 31:
-#line 214 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 31: // unknown_map_entry: "constant string" ":"
+#line 217 "agent_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 862 "agent_parser.cc" // lalr1.cc:919
+#line 867 "agent_parser.cc"
     break;
 
-  case 32:
-#line 223 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 32: // $@7: %empty
+#line 226 "agent_parser.yy"
+                                 {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 873 "agent_parser.cc" // lalr1.cc:919
+#line 878 "agent_parser.cc"
     break;
 
-  case 33:
-#line 228 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 33: // agent_syntax_map: "{" $@7 global_objects "}"
+#line 231 "agent_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 883 "agent_parser.cc" // lalr1.cc:919
+#line 888 "agent_parser.cc"
     break;
 
-  case 42:
-#line 249 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 42: // $@8: %empty
+#line 252 "agent_parser.yy"
+                            {
 
     // Let's create a MapElement that will represent it, add it to the
     // top level map (that's already on the stack) and put the new map
@@ -895,58 +900,58 @@ namespace isc { namespace agent {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.AGENT);
 }
-#line 899 "agent_parser.cc" // lalr1.cc:919
+#line 904 "agent_parser.cc"
     break;
 
-  case 43:
-#line 259 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 43: // agent_object: "Control-agent" $@8 ":" "{" global_params "}"
+#line 262 "agent_parser.yy"
+                                                    {
     // Ok, we're done with parsing control-agent. Let's take the map
     // off the stack.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 910 "agent_parser.cc" // lalr1.cc:919
+#line 915 "agent_parser.cc"
     break;
 
-  case 53:
-#line 281 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 53: // $@9: %empty
+#line 284 "agent_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 918 "agent_parser.cc" // lalr1.cc:919
+#line 923 "agent_parser.cc"
     break;
 
-  case 54:
-#line 283 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 54: // http_host: "http-host" $@9 ":" "constant string"
+#line 286 "agent_parser.yy"
+               {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-host", host);
     ctx.leave();
 }
-#line 928 "agent_parser.cc" // lalr1.cc:919
+#line 933 "agent_parser.cc"
     break;
 
-  case 55:
-#line 289 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 55: // http_port: "http-port" ":" "integer"
+#line 292 "agent_parser.yy"
+                                   {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-port", prf);
 }
-#line 937 "agent_parser.cc" // lalr1.cc:919
+#line 942 "agent_parser.cc"
     break;
 
-  case 56:
-#line 294 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 56: // $@10: %empty
+#line 297 "agent_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 945 "agent_parser.cc" // lalr1.cc:919
+#line 950 "agent_parser.cc"
     break;
 
-  case 57:
-#line 296 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 57: // user_context: "user-context" $@10 ":" map_value
+#line 299 "agent_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -968,20 +973,20 @@ namespace isc { namespace agent {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 972 "agent_parser.cc" // lalr1.cc:919
+#line 977 "agent_parser.cc"
     break;
 
-  case 58:
-#line 319 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 58: // $@11: %empty
+#line 322 "agent_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 980 "agent_parser.cc" // lalr1.cc:919
+#line 985 "agent_parser.cc"
     break;
 
-  case 59:
-#line 321 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 59: // comment: "comment" $@11 ":" "constant string"
+#line 324 "agent_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1005,442 +1010,479 @@ namespace isc { namespace agent {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1009 "agent_parser.cc" // lalr1.cc:919
+#line 1014 "agent_parser.cc"
     break;
 
-  case 60:
-#line 347 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 60: // $@12: %empty
+#line 350 "agent_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1020 "agent_parser.cc" // lalr1.cc:919
+#line 1025 "agent_parser.cc"
     break;
 
-  case 61:
-#line 352 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 61: // hooks_libraries: "hooks-libraries" $@12 ":" "[" hooks_libraries_list "]"
+#line 355 "agent_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1029 "agent_parser.cc" // lalr1.cc:919
+#line 1034 "agent_parser.cc"
     break;
 
-  case 66:
-#line 365 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 66: // $@13: %empty
+#line 368 "agent_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1039 "agent_parser.cc" // lalr1.cc:919
+#line 1044 "agent_parser.cc"
     break;
 
-  case 67:
-#line 369 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 67: // hooks_library: "{" $@13 hooks_params "}"
+#line 372 "agent_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1047 "agent_parser.cc" // lalr1.cc:919
+#line 1052 "agent_parser.cc"
     break;
 
-  case 73:
-#line 382 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 73: // $@14: %empty
+#line 385 "agent_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1055 "agent_parser.cc" // lalr1.cc:919
+#line 1060 "agent_parser.cc"
     break;
 
-  case 74:
-#line 384 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 74: // library: "library" $@14 ":" "constant string"
+#line 387 "agent_parser.yy"
+               {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1065 "agent_parser.cc" // lalr1.cc:919
+#line 1070 "agent_parser.cc"
     break;
 
-  case 75:
-#line 390 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 75: // $@15: %empty
+#line 393 "agent_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1073 "agent_parser.cc" // lalr1.cc:919
+#line 1078 "agent_parser.cc"
     break;
 
-  case 76:
-#line 392 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 76: // parameters: "parameters" $@15 ":" value
+#line 395 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1082 "agent_parser.cc" // lalr1.cc:919
+#line 1087 "agent_parser.cc"
     break;
 
-  case 77:
-#line 400 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 77: // $@16: %empty
+#line 403 "agent_parser.yy"
+                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("control-sockets", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKETS);
 }
-#line 1093 "agent_parser.cc" // lalr1.cc:919
+#line 1098 "agent_parser.cc"
     break;
 
-  case 78:
-#line 405 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 78: // control_sockets: "control-sockets" ":" "{" $@16 control_sockets_params "}"
+#line 408 "agent_parser.yy"
+                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1102 "agent_parser.cc" // lalr1.cc:919
+#line 1107 "agent_parser.cc"
     break;
 
-  case 85:
-#line 426 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 85: // $@17: %empty
+#line 429 "agent_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1113 "agent_parser.cc" // lalr1.cc:919
+#line 1118 "agent_parser.cc"
     break;
 
-  case 86:
-#line 431 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 86: // dhcp4_server_socket: "dhcp4" $@17 ":" "{" control_socket_params "}"
+#line 434 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1122 "agent_parser.cc" // lalr1.cc:919
+#line 1127 "agent_parser.cc"
     break;
 
-  case 87:
-#line 437 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 87: // $@18: %empty
+#line 440 "agent_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1133 "agent_parser.cc" // lalr1.cc:919
+#line 1138 "agent_parser.cc"
     break;
 
-  case 88:
-#line 442 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 88: // dhcp6_server_socket: "dhcp6" $@18 ":" "{" control_socket_params "}"
+#line 445 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1142 "agent_parser.cc" // lalr1.cc:919
+#line 1147 "agent_parser.cc"
     break;
 
-  case 89:
-#line 448 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 89: // $@19: %empty
+#line 451 "agent_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1153 "agent_parser.cc" // lalr1.cc:919
+#line 1158 "agent_parser.cc"
     break;
 
-  case 90:
-#line 453 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 90: // d2_server_socket: "d2" $@19 ":" "{" control_socket_params "}"
+#line 456 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1162 "agent_parser.cc" // lalr1.cc:919
+#line 1167 "agent_parser.cc"
     break;
 
-  case 98:
-#line 472 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 98: // $@20: %empty
+#line 475 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1170 "agent_parser.cc" // lalr1.cc:919
+#line 1175 "agent_parser.cc"
     break;
 
-  case 99:
-#line 474 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 99: // socket_name: "socket-name" $@20 ":" "constant string"
+#line 477 "agent_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1180 "agent_parser.cc" // lalr1.cc:919
+#line 1185 "agent_parser.cc"
     break;
 
-  case 100:
-#line 481 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 100: // $@21: %empty
+#line 484 "agent_parser.yy"
+                         {
     ctx.enter(ctx.SOCKET_TYPE);
 }
-#line 1188 "agent_parser.cc" // lalr1.cc:919
+#line 1193 "agent_parser.cc"
     break;
 
-  case 101:
-#line 483 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 101: // socket_type: "socket-type" $@21 ":" socket_type_value
+#line 486 "agent_parser.yy"
+                          {
     ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1197 "agent_parser.cc" // lalr1.cc:919
+#line 1202 "agent_parser.cc"
     break;
 
-  case 102:
-#line 489 "agent_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
-#line 1203 "agent_parser.cc" // lalr1.cc:919
+  case 102: // socket_type_value: "unix"
+#line 492 "agent_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
+#line 1208 "agent_parser.cc"
     break;
 
-  case 103:
-#line 495 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 103: // $@22: %empty
+#line 498 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1211 "agent_parser.cc" // lalr1.cc:919
+#line 1216 "agent_parser.cc"
     break;
 
-  case 104:
-#line 497 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 104: // dhcp4_json_object: "Dhcp4" $@22 ":" value
+#line 500 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1220 "agent_parser.cc" // lalr1.cc:919
+#line 1225 "agent_parser.cc"
     break;
 
-  case 105:
-#line 502 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 105: // $@23: %empty
+#line 505 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1228 "agent_parser.cc" // lalr1.cc:919
+#line 1233 "agent_parser.cc"
     break;
 
-  case 106:
-#line 504 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 106: // dhcp6_json_object: "Dhcp6" $@23 ":" value
+#line 507 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1237 "agent_parser.cc" // lalr1.cc:919
+#line 1242 "agent_parser.cc"
     break;
 
-  case 107:
-#line 509 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 107: // $@24: %empty
+#line 512 "agent_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1245 "agent_parser.cc" // lalr1.cc:919
+#line 1250 "agent_parser.cc"
     break;
 
-  case 108:
-#line 511 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 108: // dhcpddns_json_object: "DhcpDdns" $@24 ":" value
+#line 514 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1254 "agent_parser.cc" // lalr1.cc:919
+#line 1259 "agent_parser.cc"
     break;
 
-  case 109:
-#line 521 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 109: // $@25: %empty
+#line 524 "agent_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1265 "agent_parser.cc" // lalr1.cc:919
+#line 1270 "agent_parser.cc"
     break;
 
-  case 110:
-#line 526 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 110: // logging_object: "Logging" $@25 ":" "{" logging_params "}"
+#line 529 "agent_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1274 "agent_parser.cc" // lalr1.cc:919
+#line 1279 "agent_parser.cc"
     break;
 
-  case 114:
-#line 543 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 114: // $@26: %empty
+#line 546 "agent_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1285 "agent_parser.cc" // lalr1.cc:919
+#line 1290 "agent_parser.cc"
     break;
 
-  case 115:
-#line 548 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 115: // loggers: "loggers" $@26 ":" "[" loggers_entries "]"
+#line 551 "agent_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1294 "agent_parser.cc" // lalr1.cc:919
+#line 1299 "agent_parser.cc"
     break;
 
-  case 118:
-#line 560 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 118: // $@27: %empty
+#line 563 "agent_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1304 "agent_parser.cc" // lalr1.cc:919
+#line 1309 "agent_parser.cc"
     break;
 
-  case 119:
-#line 564 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 119: // logger_entry: "{" $@27 logger_params "}"
+#line 567 "agent_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1312 "agent_parser.cc" // lalr1.cc:919
+#line 1317 "agent_parser.cc"
     break;
 
-  case 129:
-#line 581 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 129: // $@28: %empty
+#line 584 "agent_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1320 "agent_parser.cc" // lalr1.cc:919
+#line 1325 "agent_parser.cc"
     break;
 
-  case 130:
-#line 583 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 130: // name: "name" $@28 ":" "constant string"
+#line 586 "agent_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1330 "agent_parser.cc" // lalr1.cc:919
+#line 1335 "agent_parser.cc"
     break;
 
-  case 131:
-#line 589 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 131: // debuglevel: "debuglevel" ":" "integer"
+#line 592 "agent_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1339 "agent_parser.cc" // lalr1.cc:919
+#line 1344 "agent_parser.cc"
     break;
 
-  case 132:
-#line 594 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 132: // $@29: %empty
+#line 597 "agent_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1347 "agent_parser.cc" // lalr1.cc:919
+#line 1352 "agent_parser.cc"
     break;
 
-  case 133:
-#line 596 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 133: // severity: "severity" $@29 ":" "constant string"
+#line 599 "agent_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1357 "agent_parser.cc" // lalr1.cc:919
+#line 1362 "agent_parser.cc"
     break;
 
-  case 134:
-#line 602 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 134: // $@30: %empty
+#line 605 "agent_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1368 "agent_parser.cc" // lalr1.cc:919
+#line 1373 "agent_parser.cc"
     break;
 
-  case 135:
-#line 607 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 135: // output_options_list: "output_options" $@30 ":" "[" output_options_list_content "]"
+#line 610 "agent_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1377 "agent_parser.cc" // lalr1.cc:919
+#line 1382 "agent_parser.cc"
     break;
 
-  case 138:
-#line 616 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 138: // $@31: %empty
+#line 619 "agent_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1387 "agent_parser.cc" // lalr1.cc:919
+#line 1392 "agent_parser.cc"
     break;
 
-  case 139:
-#line 620 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 139: // output_entry: "{" $@31 output_params_list "}"
+#line 623 "agent_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1395 "agent_parser.cc" // lalr1.cc:919
+#line 1400 "agent_parser.cc"
     break;
 
-  case 146:
-#line 634 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 149: // $@32: %empty
+#line 640 "agent_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1403 "agent_parser.cc" // lalr1.cc:919
+#line 1408 "agent_parser.cc"
     break;
 
-  case 147:
-#line 636 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 150: // output: "output" $@32 ":" "constant string"
+#line 642 "agent_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1413 "agent_parser.cc" // lalr1.cc:919
+#line 1418 "agent_parser.cc"
     break;
 
-  case 148:
-#line 642 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 151: // flush: "flush" ":" "boolean"
+#line 648 "agent_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1422 "agent_parser.cc" // lalr1.cc:919
+#line 1427 "agent_parser.cc"
     break;
 
-  case 149:
-#line 647 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 152: // maxsize: "maxsize" ":" "integer"
+#line 653 "agent_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1431 "agent_parser.cc" // lalr1.cc:919
+#line 1436 "agent_parser.cc"
     break;
 
-  case 150:
-#line 652 "agent_parser.yy" // lalr1.cc:919
-    {
+  case 153: // maxver: "maxver" ":" "integer"
+#line 658 "agent_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1440 "agent_parser.cc" // lalr1.cc:919
+#line 1445 "agent_parser.cc"
+    break;
+
+  case 154: // async: "async" ":" "boolean"
+#line 663 "agent_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1454 "agent_parser.cc"
     break;
 
+  case 155: // queue_size: "queue-size" ":" "integer"
+#line 668 "agent_parser.yy"
+                                     {
+    ElementPtr queue_size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+#line 1463 "agent_parser.cc"
+    break;
+
+  case 156: // $@33: %empty
+#line 673 "agent_parser.yy"
+                          {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1471 "agent_parser.cc"
+    break;
+
+  case 157: // overflow: "overflow" $@33 ":" "constant string"
+#line 675 "agent_parser.yy"
+               {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+#line 1481 "agent_parser.cc"
+    break;
+
+
+#line 1485 "agent_parser.cc"
 
-#line 1444 "agent_parser.cc" // lalr1.cc:919
             default:
               break;
             }
@@ -1456,7 +1498,6 @@ namespace isc { namespace agent {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -1472,7 +1513,9 @@ namespace isc { namespace agent {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1483,7 +1526,7 @@ namespace isc { namespace agent {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1509,6 +1552,7 @@ namespace isc { namespace agent {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -1517,37 +1561,39 @@ namespace isc { namespace agent {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -1579,6 +1625,7 @@ namespace isc { namespace agent {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1612,18 +1659,103 @@ namespace isc { namespace agent {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  AgentParser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  AgentParser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
 
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  AgentParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // AgentParser::context.
+  AgentParser::context::context (const AgentParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  AgentParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  AgentParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1642,41 +1774,32 @@ namespace isc { namespace agent {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  AgentParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1697,11 +1820,11 @@ namespace isc { namespace agent {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1710,39 +1833,40 @@ namespace isc { namespace agent {
   }
 
 
-  const signed char AgentParser::yypact_ninf_ = -68;
+  const short AgentParser::yypact_ninf_ = -142;
 
   const signed char AgentParser::yytable_ninf_ = -1;
 
   const short
   AgentParser::yypact_[] =
   {
-      59,   -68,   -68,   -68,     6,     8,     9,    34,   -68,   -68,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
-     -68,   -68,   -68,   -68,     8,   -29,    -5,    -4,   -68,    41,
-      51,    98,    85,   100,   -68,   -68,   -68,   -68,   -68,   101,
-     -68,    11,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   102,
-     -68,   -68,   103,   -68,   -68,    21,   -68,   -68,   -68,   -68,
-     -68,   -68,   -68,   -68,     8,     8,   -68,    63,   104,   105,
-     106,   107,   109,   -68,    -5,   -68,   111,    74,   113,   114,
-     112,   116,    -4,   -68,   -68,   -68,   117,   115,   118,     8,
-       8,     8,   -68,    83,   -68,   119,    87,   -68,   122,   -68,
-       8,    -4,    97,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
-       5,   123,   -68,    64,   -68,    65,   -68,   -68,   -68,   -68,
-     -68,   -68,    71,   -68,   -68,   -68,   -68,   -68,   125,   126,
-     -68,   -68,   128,    97,   -68,   129,   130,   131,     5,   -68,
-      37,   -68,   123,   132,   -68,   133,   134,   135,   -68,   -68,
-     -68,   -68,    78,   -68,   -68,   -68,   -68,   136,    14,    14,
-      14,   140,   141,    42,   -68,   -68,    32,   -68,   -68,   -68,
-     -68,   -68,   -68,    79,   -68,   -68,   -68,    80,    82,    95,
-       8,   -68,    12,   136,   -68,   142,   143,    14,   -68,   -68,
-     -68,   -68,   -68,   -68,   -68,   144,   -68,   -68,   -68,   -68,
-      86,   -68,   -68,   -68,   -68,   -68,   -68,   108,   138,   -68,
-     146,   147,    96,   148,    12,   -68,   -68,   -68,   -68,   120,
-     149,   -68,   121,   -68,   -68,   156,   -68,   -68,    89,   -68,
-      30,   156,   -68,   -68,   151,   160,   161,    88,   -68,   -68,
-     -68,   -68,   -68,   -68,   162,   124,   127,   137,    30,   -68,
-     139,   -68,   -68,   -68,   -68,   -68
+      31,  -142,  -142,  -142,    11,     5,     6,    21,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+    -142,  -142,  -142,  -142,     5,    -6,    -5,    10,  -142,    34,
+      50,    55,    58,    82,  -142,  -142,  -142,  -142,  -142,   104,
+    -142,    38,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   105,
+    -142,  -142,   106,  -142,  -142,    39,  -142,  -142,  -142,  -142,
+    -142,  -142,  -142,  -142,     5,     5,  -142,    67,   109,   111,
+     112,   113,   114,  -142,    -5,  -142,   115,    75,   117,   118,
+     116,   120,    10,  -142,  -142,  -142,   121,   119,   122,     5,
+       5,     5,  -142,    83,  -142,   123,    84,  -142,   126,  -142,
+       5,    10,    78,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+      -1,   125,  -142,    52,  -142,    59,  -142,  -142,  -142,  -142,
+    -142,  -142,    60,  -142,  -142,  -142,  -142,  -142,   127,   131,
+    -142,  -142,   132,    78,  -142,   133,   134,   135,    -1,  -142,
+     -17,  -142,   125,   130,  -142,   136,   137,   138,  -142,  -142,
+    -142,  -142,    89,  -142,  -142,  -142,  -142,   139,    17,    17,
+      17,   143,   144,   -15,  -142,  -142,    23,  -142,  -142,  -142,
+    -142,  -142,  -142,    90,  -142,  -142,  -142,    91,    93,    96,
+       5,  -142,    51,   139,  -142,   145,   146,    17,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,   147,  -142,  -142,  -142,  -142,
+      97,  -142,  -142,  -142,  -142,  -142,  -142,    98,   140,  -142,
+     148,   149,   110,   150,    51,  -142,  -142,  -142,  -142,   124,
+     154,  -142,   128,  -142,  -142,   155,  -142,  -142,   100,  -142,
+      54,   155,  -142,  -142,   159,   160,   161,   162,   163,  -142,
+      99,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+     165,    94,   129,   141,   151,   142,   166,    54,  -142,   152,
+    -142,  -142,  -142,  -142,  -142,   153,  -142,  -142,  -142
   };
 
   const unsigned char
@@ -1771,30 +1895,32 @@ namespace isc { namespace agent {
        0,   120,   122,   124,   125,   123,   117,     0,     0,    92,
        0,     0,     0,     0,     0,   119,    99,   102,   101,     0,
        0,   131,     0,   121,   130,     0,   133,   138,     0,   136,
-       0,     0,   135,   146,     0,     0,     0,     0,   140,   142,
-     143,   144,   145,   137,     0,     0,     0,     0,     0,   139,
-       0,   148,   149,   150,   141,   147
+       0,     0,   135,   149,     0,     0,     0,     0,     0,   156,
+       0,   140,   142,   143,   144,   145,   146,   147,   148,   137,
+       0,     0,     0,     0,     0,     0,     0,     0,   139,     0,
+     151,   152,   153,   154,   155,     0,   141,   150,   157
   };
 
-  const signed char
+  const short
   AgentParser::yypgoto_[] =
   {
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -20,    44,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -26,   -68,
-     -68,   -68,    93,   -68,   -68,    52,    90,   -68,   -68,   -68,
-     -25,   -68,   -24,   -68,   -68,   -68,   -68,   -68,    28,   -68,
-     -68,    10,   -68,   -68,   -68,   -68,   -68,   -68,   -68,    33,
-     -68,   -68,   -68,   -68,   -68,   -68,   -59,   -13,   -68,   -68,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
-     -68,   -68,    43,   -68,   -68,   -68,    -8,   -68,   -68,   -37,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -53,   -68,
-     -68,   -67,   -68,   -68,   -68,   -68,   -68
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   -20,    76,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   -26,  -142,
+    -142,  -142,   101,  -142,  -142,    72,    95,  -142,  -142,  -142,
+     -25,  -142,   -24,  -142,  -142,  -142,  -142,  -142,    36,  -142,
+    -142,    13,  -142,  -142,  -142,  -142,  -142,  -142,  -142,    41,
+    -142,  -142,  -142,  -142,  -142,  -142,  -141,    -7,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+    -142,  -142,    48,  -142,  -142,  -142,     0,  -142,  -142,   -32,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   -47,  -142,
+    -142,   -72,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+    -142
   };
 
   const short
   AgentParser::yydefgoto_[] =
   {
-      -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
+       0,     4,     5,     6,     7,    23,    27,    16,    17,    18,
       25,   108,    32,    33,    19,    24,    29,    30,   170,    21,
       26,    41,    42,    43,    68,    55,    56,    57,    76,    58,
      171,    78,   172,    79,    61,    81,   128,   129,   130,   140,
@@ -1803,112 +1929,114 @@ namespace isc { namespace agent {
      176,   186,   218,    44,    70,    45,    71,    46,    72,    47,
       69,   115,   116,   117,   132,   166,   167,   182,   200,   201,
      202,   210,   203,   204,   213,   205,   211,   228,   229,   230,
-     237,   238,   239,   244,   240,   241,   242
+     240,   241,   242,   250,   243,   244,   245,   246,   247,   248,
+     256
   };
 
-  const unsigned char
+  const short
   AgentParser::yytable_[] =
   {
-      40,    54,    59,    60,    28,    34,     8,    48,    49,    50,
-      51,    52,    31,     9,    74,    10,    20,    11,    53,    75,
-      35,   118,   119,   120,    82,    50,    51,    50,    51,    83,
-      36,    37,    38,   168,   169,   183,    39,    39,   184,   193,
-     194,    22,   195,   196,    84,    85,    39,    63,    40,    12,
-      13,    14,    15,    39,    64,    39,    54,    59,    60,   233,
-     149,   150,   234,   235,   236,   149,   150,    82,   133,   103,
-     104,   105,   131,   134,   138,    54,    59,    60,    39,   139,
-     112,   163,   187,   187,   121,   187,   164,   188,   189,   214,
-     190,   248,   231,    66,   215,   232,   249,     1,     2,     3,
-     177,   178,    65,    67,    86,    73,    77,    80,    87,    88,
-      89,    90,   121,    91,   151,    93,    94,    95,    96,    97,
-      98,   100,   101,   114,   106,   102,    10,   111,   109,   142,
-     127,   141,   143,   145,   146,   147,   191,   157,   221,   107,
-     158,   159,   160,   165,   179,   180,   207,   208,   212,   216,
-     219,   220,   222,   113,   225,   245,   197,   198,   199,   217,
-     192,   224,   226,   227,   246,   247,   250,    92,   251,   252,
-     156,   148,    99,   181,   209,   206,   144,   223,   243,   253,
-     255,   254,     0,     0,     0,     0,     0,     0,   197,   198,
-     199
+      40,    54,    59,    60,    28,    34,   149,   150,   149,   150,
+       9,     8,    10,    20,    11,   118,   119,   120,   177,   178,
+      35,    48,    49,    50,    51,    52,   183,    39,    22,   184,
+      50,    51,    53,    36,    37,    38,   168,   169,    31,    39,
+      63,    74,    82,    39,    84,    85,    75,    83,    40,    12,
+      13,    14,    15,    64,    39,    82,    54,    59,    60,    65,
+     131,    39,   133,   138,    50,    51,    66,   134,   139,   103,
+     104,   105,     1,     2,     3,    54,    59,    60,   193,   194,
+     112,   195,   196,   233,   121,    67,   234,   235,   236,   237,
+     238,   239,   163,   187,   187,    39,   187,   164,   188,   189,
+     214,   190,   257,   231,   114,   215,   232,   258,    73,    77,
+      80,    86,   121,    87,   151,    88,    89,    90,    91,    93,
+      94,    95,    96,    97,    98,   100,   101,   106,   109,   102,
+      10,   111,   127,   141,   142,   157,   143,   145,   146,   147,
+     191,   260,   216,   158,   159,   160,   165,   179,   180,   207,
+     208,   212,   219,   220,   222,   221,   197,   198,   199,   225,
+     192,   217,   227,   251,   252,   253,   254,   255,   224,   259,
+     265,   107,   226,   113,   261,    92,   181,    99,   156,   148,
+     209,   144,   223,   206,   249,   266,   262,   264,   197,   198,
+     199,     0,     0,     0,     0,     0,   267,   268,   263
   };
 
   const short
   AgentParser::yycheck_[] =
   {
-      26,    27,    27,    27,    24,    10,     0,    11,    12,    13,
-      14,    15,    41,     5,     3,     7,     7,     9,    22,     8,
-      25,    16,    17,    18,     3,    13,    14,    13,    14,     8,
-      35,    36,    37,    19,    20,     3,    41,    41,     6,    27,
-      28,     7,    30,    31,    64,    65,    41,     6,    74,    41,
-      42,    43,    44,    41,     3,    41,    82,    82,    82,    29,
-      23,    24,    32,    33,    34,    23,    24,     3,     3,    89,
-      90,    91,     8,     8,     3,   101,   101,   101,    41,     8,
-     100,     3,     3,     3,   110,     3,     8,     8,     8,     3,
-       8,     3,     3,     8,     8,     6,     8,    38,    39,    40,
-     159,   160,     4,     3,    41,     4,     4,     4,     4,     4,
-       4,     4,   138,     4,   140,     4,    42,     4,     4,     7,
-       4,     4,     7,    26,    41,     7,     7,     5,    41,     3,
-       7,     6,     4,     4,     4,     4,    41,     5,    42,    95,
-       7,     7,     7,     7,     4,     4,     4,     4,     4,    41,
-       4,     4,     4,   101,     5,     4,   182,   182,   182,    21,
-     180,    41,    41,     7,     4,     4,     4,    74,    44,    42,
-     142,   138,    82,   163,   187,   183,   133,   214,   231,    42,
-      41,   248,    -1,    -1,    -1,    -1,    -1,    -1,   214,   214,
-     214
+      26,    27,    27,    27,    24,    10,    23,    24,    23,    24,
+       5,     0,     7,     7,     9,    16,    17,    18,   159,   160,
+      25,    11,    12,    13,    14,    15,     3,    44,     7,     6,
+      13,    14,    22,    38,    39,    40,    19,    20,    44,    44,
+       6,     3,     3,    44,    64,    65,     8,     8,    74,    44,
+      45,    46,    47,     3,    44,     3,    82,    82,    82,     4,
+       8,    44,     3,     3,    13,    14,     8,     8,     8,    89,
+      90,    91,    41,    42,    43,   101,   101,   101,    27,    28,
+     100,    30,    31,    29,   110,     3,    32,    33,    34,    35,
+      36,    37,     3,     3,     3,    44,     3,     8,     8,     8,
+       3,     8,     3,     3,    26,     8,     6,     8,     4,     4,
+       4,    44,   138,     4,   140,     4,     4,     4,     4,     4,
+      45,     4,     4,     7,     4,     4,     7,    44,    44,     7,
+       7,     5,     7,     6,     3,     5,     4,     4,     4,     4,
+      44,    47,    44,     7,     7,     7,     7,     4,     4,     4,
+       4,     4,     4,     4,     4,    45,   182,   182,   182,     5,
+     180,    21,     7,     4,     4,     4,     4,     4,    44,     4,
+       4,    95,    44,   101,    45,    74,   163,    82,   142,   138,
+     187,   133,   214,   183,   231,   257,    45,    45,   214,   214,
+     214,    -1,    -1,    -1,    -1,    -1,    44,    44,    47
   };
 
   const unsigned char
   AgentParser::yystos_[] =
   {
-       0,    38,    39,    40,    46,    47,    48,    49,     0,     5,
-       7,     9,    41,    42,    43,    44,    52,    53,    54,    59,
-       7,    64,     7,    50,    60,    55,    65,    51,    53,    61,
-      62,    41,    57,    58,    10,    25,    35,    36,    37,    41,
-      63,    66,    67,    68,   108,   110,   112,   114,    11,    12,
-      13,    14,    15,    22,    63,    70,    71,    72,    74,    75,
-      77,    79,    91,     6,     3,     4,     8,     3,    69,   115,
-     109,   111,   113,     4,     3,     8,    73,     4,    76,    78,
-       4,    80,     3,     8,    53,    53,    41,     4,     4,     4,
-       4,     4,    67,     4,    42,     4,     4,     7,     4,    71,
-       4,     7,     7,    53,    53,    53,    41,    54,    56,    41,
-      92,     5,    53,    70,    26,   116,   117,   118,    16,    17,
-      18,    63,    93,    94,    95,    97,    99,     7,    81,    82,
-      83,     8,   119,     3,     8,    96,    98,   100,     3,     8,
-      84,     6,     3,     4,   117,     4,     4,     4,    94,    23,
-      24,    63,    85,    86,    87,    89,    83,     5,     7,     7,
-       7,    88,    90,     3,     8,     7,   120,   121,    19,    20,
-      63,    75,    77,   101,   102,   103,   105,   101,   101,     4,
-       4,    86,   122,     3,     6,   104,   106,     3,     8,     8,
-       8,    41,    53,    27,    28,    30,    31,    63,    75,    77,
-     123,   124,   125,   127,   128,   130,   121,     4,     4,   102,
-     126,   131,     4,   129,     3,     8,    41,    21,   107,     4,
-       4,    42,     4,   124,    41,     5,    41,     7,   132,   133,
-     134,     3,     6,    29,    32,    33,    34,   135,   136,   137,
-     139,   140,   141,   133,   138,     4,     4,     4,     3,     8,
-       4,    44,    42,    42,   136,    41
+       0,    41,    42,    43,    49,    50,    51,    52,     0,     5,
+       7,     9,    44,    45,    46,    47,    55,    56,    57,    62,
+       7,    67,     7,    53,    63,    58,    68,    54,    56,    64,
+      65,    44,    60,    61,    10,    25,    38,    39,    40,    44,
+      66,    69,    70,    71,   111,   113,   115,   117,    11,    12,
+      13,    14,    15,    22,    66,    73,    74,    75,    77,    78,
+      80,    82,    94,     6,     3,     4,     8,     3,    72,   118,
+     112,   114,   116,     4,     3,     8,    76,     4,    79,    81,
+       4,    83,     3,     8,    56,    56,    44,     4,     4,     4,
+       4,     4,    70,     4,    45,     4,     4,     7,     4,    74,
+       4,     7,     7,    56,    56,    56,    44,    57,    59,    44,
+      95,     5,    56,    73,    26,   119,   120,   121,    16,    17,
+      18,    66,    96,    97,    98,   100,   102,     7,    84,    85,
+      86,     8,   122,     3,     8,    99,   101,   103,     3,     8,
+      87,     6,     3,     4,   120,     4,     4,     4,    97,    23,
+      24,    66,    88,    89,    90,    92,    86,     5,     7,     7,
+       7,    91,    93,     3,     8,     7,   123,   124,    19,    20,
+      66,    78,    80,   104,   105,   106,   108,   104,   104,     4,
+       4,    89,   125,     3,     6,   107,   109,     3,     8,     8,
+       8,    44,    56,    27,    28,    30,    31,    66,    78,    80,
+     126,   127,   128,   130,   131,   133,   124,     4,     4,   105,
+     129,   134,     4,   132,     3,     8,    44,    21,   110,     4,
+       4,    45,     4,   127,    44,     5,    44,     7,   135,   136,
+     137,     3,     6,    29,    32,    33,    34,    35,    36,    37,
+     138,   139,   140,   142,   143,   144,   145,   146,   147,   136,
+     141,     4,     4,     4,     4,     4,   148,     3,     8,     4,
+      47,    45,    45,    47,    45,     4,   139,    44,    44
   };
 
   const unsigned char
   AgentParser::yyr1_[] =
   {
-       0,    45,    47,    46,    48,    46,    49,    46,    51,    50,
-      52,    53,    53,    53,    53,    53,    53,    53,    55,    54,
-      56,    57,    57,    58,    58,    60,    59,    61,    61,    62,
-      62,    63,    65,    64,    66,    66,    67,    67,    67,    67,
-      67,    67,    69,    68,    70,    70,    71,    71,    71,    71,
-      71,    71,    71,    73,    72,    74,    76,    75,    78,    77,
-      80,    79,    81,    81,    82,    82,    84,    83,    85,    85,
-      85,    86,    86,    88,    87,    90,    89,    92,    91,    93,
-      93,    94,    94,    94,    94,    96,    95,    98,    97,   100,
-      99,   101,   101,   102,   102,   102,   102,   102,   104,   103,
-     106,   105,   107,   109,   108,   111,   110,   113,   112,   115,
-     114,   116,   116,   117,   119,   118,   120,   120,   122,   121,
-     123,   123,   124,   124,   124,   124,   124,   124,   124,   126,
-     125,   127,   129,   128,   131,   130,   132,   132,   134,   133,
-     135,   135,   136,   136,   136,   136,   138,   137,   139,   140,
-     141
+       0,    48,    50,    49,    51,    49,    52,    49,    54,    53,
+      55,    56,    56,    56,    56,    56,    56,    56,    58,    57,
+      59,    60,    60,    61,    61,    63,    62,    64,    64,    65,
+      65,    66,    68,    67,    69,    69,    70,    70,    70,    70,
+      70,    70,    72,    71,    73,    73,    74,    74,    74,    74,
+      74,    74,    74,    76,    75,    77,    79,    78,    81,    80,
+      83,    82,    84,    84,    85,    85,    87,    86,    88,    88,
+      88,    89,    89,    91,    90,    93,    92,    95,    94,    96,
+      96,    97,    97,    97,    97,    99,    98,   101,   100,   103,
+     102,   104,   104,   105,   105,   105,   105,   105,   107,   106,
+     109,   108,   110,   112,   111,   114,   113,   116,   115,   118,
+     117,   119,   119,   120,   122,   121,   123,   123,   125,   124,
+     126,   126,   127,   127,   127,   127,   127,   127,   127,   129,
+     128,   130,   132,   131,   134,   133,   135,   135,   137,   136,
+     138,   138,   139,   139,   139,   139,   139,   139,   139,   141,
+     140,   142,   143,   144,   145,   146,   148,   147
   };
 
-  const unsigned char
+  const signed char
   AgentParser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     4,
@@ -1925,90 +2053,91 @@ namespace isc { namespace agent {
        6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
        1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
        4,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
-       3
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     3,     3,     3,     3,     0,     4
   };
 
 
-
+#if AGENT_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const AgentParser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Control-agent\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Control-agent\"",
   "\"http-host\"", "\"http-port\"", "\"user-context\"", "\"comment\"",
   "\"control-sockets\"", "\"dhcp4\"", "\"dhcp6\"", "\"d2\"",
   "\"socket-name\"", "\"socket-type\"", "\"unix\"", "\"hooks-libraries\"",
   "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
   "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"",
-  "\"Dhcp6\"", "\"DhcpDdns\"", "START_JSON", "START_AGENT",
-  "START_SUB_AGENT", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "sub_agent", "$@4", "json", "value", "map", "$@5", "map_value",
-  "map_content", "not_empty_map", "list_generic", "$@6", "list_content",
-  "not_empty_list", "unknown_map_entry", "agent_syntax_map", "$@7",
-  "global_objects", "global_object", "agent_object", "$@8",
-  "global_params", "global_param", "http_host", "$@9", "http_port",
-  "user_context", "$@10", "comment", "$@11", "hooks_libraries", "$@12",
-  "hooks_libraries_list", "not_empty_hooks_libraries_list",
-  "hooks_library", "$@13", "hooks_params", "hooks_param", "library",
-  "$@14", "parameters", "$@15", "control_sockets", "$@16",
-  "control_sockets_params", "control_socket", "dhcp4_server_socket",
-  "$@17", "dhcp6_server_socket", "$@18", "d2_server_socket", "$@19",
-  "control_socket_params", "control_socket_param", "socket_name", "$@20",
-  "socket_type", "$@21", "socket_type_value", "dhcp4_json_object", "$@22",
-  "dhcp6_json_object", "$@23", "dhcpddns_json_object", "$@24",
-  "logging_object", "$@25", "logging_params", "logging_param", "loggers",
-  "$@26", "loggers_entries", "logger_entry", "$@27", "logger_params",
-  "logger_param", "name", "$@28", "debuglevel", "severity", "$@29",
-  "output_options_list", "$@30", "output_options_list_content",
-  "output_entry", "$@31", "output_params_list", "output_params", "output",
-  "$@32", "flush", "maxsize", "maxver", YY_NULLPTR
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"queue-size\"", "\"overflow\"", "\"Dhcp4\"", "\"Dhcp6\"",
+  "\"DhcpDdns\"", "START_JSON", "START_AGENT", "START_SUB_AGENT",
+  "\"constant string\"", "\"integer\"", "\"floating point\"",
+  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "sub_agent",
+  "$@4", "json", "value", "map", "$@5", "map_value", "map_content",
+  "not_empty_map", "list_generic", "$@6", "list_content", "not_empty_list",
+  "unknown_map_entry", "agent_syntax_map", "$@7", "global_objects",
+  "global_object", "agent_object", "$@8", "global_params", "global_param",
+  "http_host", "$@9", "http_port", "user_context", "$@10", "comment",
+  "$@11", "hooks_libraries", "$@12", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@13",
+  "hooks_params", "hooks_param", "library", "$@14", "parameters", "$@15",
+  "control_sockets", "$@16", "control_sockets_params", "control_socket",
+  "dhcp4_server_socket", "$@17", "dhcp6_server_socket", "$@18",
+  "d2_server_socket", "$@19", "control_socket_params",
+  "control_socket_param", "socket_name", "$@20", "socket_type", "$@21",
+  "socket_type_value", "dhcp4_json_object", "$@22", "dhcp6_json_object",
+  "$@23", "dhcpddns_json_object", "$@24", "logging_object", "$@25",
+  "logging_params", "logging_param", "loggers", "$@26", "loggers_entries",
+  "logger_entry", "$@27", "logger_params", "logger_param", "name", "$@28",
+  "debuglevel", "severity", "$@29", "output_options_list", "$@30",
+  "output_options_list_content", "output_entry", "$@31",
+  "output_params_list", "output_params", "output", "$@32", "flush",
+  "maxsize", "maxver", "async", "queue_size", "overflow", "$@33", YY_NULLPTR
   };
+#endif
+
 
 #if AGENT_DEBUG
-  const unsigned short
+  const short
   AgentParser::yyrline_[] =
   {
-       0,   114,   114,   114,   115,   115,   116,   116,   124,   124,
-     135,   141,   142,   143,   144,   145,   146,   147,   151,   151,
-     162,   167,   168,   176,   180,   187,   187,   193,   194,   197,
-     201,   214,   223,   223,   235,   236,   240,   241,   242,   243,
-     244,   245,   249,   249,   266,   267,   272,   273,   274,   275,
-     276,   277,   278,   281,   281,   289,   294,   294,   319,   319,
-     347,   347,   357,   358,   361,   362,   365,   365,   373,   374,
-     375,   378,   379,   382,   382,   390,   390,   400,   400,   413,
-     414,   419,   420,   421,   422,   426,   426,   437,   437,   448,
-     448,   459,   460,   464,   465,   466,   467,   468,   472,   472,
-     481,   481,   489,   495,   495,   502,   502,   509,   509,   521,
-     521,   534,   535,   539,   543,   543,   555,   556,   560,   560,
-     568,   569,   572,   573,   574,   575,   576,   577,   578,   581,
-     581,   589,   594,   594,   602,   602,   612,   613,   616,   616,
-     624,   625,   628,   629,   630,   631,   634,   634,   642,   647,
-     652
+       0,   117,   117,   117,   118,   118,   119,   119,   127,   127,
+     138,   144,   145,   146,   147,   148,   149,   150,   154,   154,
+     165,   170,   171,   179,   183,   190,   190,   196,   197,   200,
+     204,   217,   226,   226,   238,   239,   243,   244,   245,   246,
+     247,   248,   252,   252,   269,   270,   275,   276,   277,   278,
+     279,   280,   281,   284,   284,   292,   297,   297,   322,   322,
+     350,   350,   360,   361,   364,   365,   368,   368,   376,   377,
+     378,   381,   382,   385,   385,   393,   393,   403,   403,   416,
+     417,   422,   423,   424,   425,   429,   429,   440,   440,   451,
+     451,   462,   463,   467,   468,   469,   470,   471,   475,   475,
+     484,   484,   492,   498,   498,   505,   505,   512,   512,   524,
+     524,   537,   538,   542,   546,   546,   558,   559,   563,   563,
+     571,   572,   575,   576,   577,   578,   579,   580,   581,   584,
+     584,   592,   597,   597,   605,   605,   615,   616,   619,   619,
+     627,   628,   631,   632,   633,   634,   635,   636,   637,   640,
+     640,   648,   653,   658,   663,   668,   673,   673
   };
 
-  // Print the state stack on the debug stream.
   void
-  AgentParser::yystack_print_ ()
+  AgentParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  AgentParser::yy_reduce_print_ (int yyrule)
+  AgentParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2021,10 +2150,11 @@ namespace isc { namespace agent {
 #endif // AGENT_DEBUG
 
 
-#line 14 "agent_parser.yy" // lalr1.cc:1242
+#line 14 "agent_parser.yy"
 } } // isc::agent
-#line 2027 "agent_parser.cc" // lalr1.cc:1242
-#line 657 "agent_parser.yy" // lalr1.cc:1243
+#line 2156 "agent_parser.cc"
+
+#line 681 "agent_parser.yy"
 
 
 void
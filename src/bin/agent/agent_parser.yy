@@ -77,6 +77,9 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow"
 
   DHCP4 "Dhcp4"
   DHCP6 "Dhcp6"
@@ -629,6 +632,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow
              ;
 
 output: OUTPUT {
@@ -654,6 +660,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 }
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+}
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr queue_size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+
+overflow: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON STRING {
+    ElementPtr overflow(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+
 %%
 
 void
@@ -18,19 +18,102 @@
 #include <cc/data.h>
 #include <cc/json_feed.h>
 #include <config/client_connection.h>
+#include <config/config_log.h>
 #include <config/timeouts.h>
+#include <hooks/hooks_manager.h>
 #include <boost/pointer_cast.hpp>
 #include <iterator>
 #include <sstream>
 #include <string>
 #include <vector>
 
+using namespace isc::agent;
 using namespace isc::asiolink;
 using namespace isc::config;
 using namespace isc::data;
 using namespace isc::hooks;
 using namespace isc::process;
 
+namespace {
+
+/// @brief Returns the Control Agent process or null.
+CtrlAgentProcessPtr
+getCtrlAgentProcess() {
+    // There is a hierarchy of the objects through which we need to pass to get
+    // the process. We may simplify this at some point but since we're in the
+    // singleton we want to make sure that we're using most current
+    // configuration.
+    boost::shared_ptr<CtrlAgentController> controller =
+        boost::dynamic_pointer_cast<CtrlAgentController>(CtrlAgentController::instance());
+    if (controller) {
+        return (controller->getCtrlAgentProcess());
+    }
+    return (CtrlAgentProcessPtr());
+}
+
+/// @brief Extracts the answer to a forwarded command.
+///
+/// @param service Name of the service the command has been forwarded to.
+/// @param cmd_name Command name.
+/// @param ec Error code of the transaction with the server.
+/// @param feed Feed holding the server's answer.
+///
+/// @return Server's answer.
+/// @throw CommandForwardingError when the transaction has failed or the
+/// answer can't be parsed.
+ConstElementPtr
+getForwardedAnswer(const std::string& service, const std::string& cmd_name,
+                   const boost::system::error_code& ec,
+                   const ConstJSONFeedPtr& feed) {
+    if (ec) {
+        isc_throw(CommandForwardingError, "unable to forward command to the "
+                  << service << " service: " << ec.message()
+                  << ". The server is likely to be offline");
+    }
+
+    // This shouldn't happen because the fact that there was no time out indicates
+    // that the whole response has been read and it should be stored within the
+    // feed. But, let's check to prevent assertions.
+    if (!feed) {
+        isc_throw(CommandForwardingError, "internal server error: empty response"
+                  " received from the unix domain socket");
+    }
+
+    ConstElementPtr answer;
+    try {
+        answer = feed->toElement();
+
+        LOG_INFO(agent_logger, CTRL_AGENT_COMMAND_FORWARDED)
+            .arg(cmd_name).arg(service);
+
+    } catch (const std::exception& ex) {
+        isc_throw(CommandForwardingError, "internal server error: unable to parse"
+                  " server's answer to the forwarded message: " << ex.what());
+    }
+
+    return (answer);
+}
+
+/// @brief State of a command forwarded to several servers at once.
+struct ForwardedCommand {
+    /// @brief Command name.
+    std::string name_;
+
+    /// @brief Command arguments.
+    ConstElementPtr arg_;
+
+    /// @brief Answers of the servers in the order of the services.
+    std::vector<ConstElementPtr> answers_;
+
+    /// @brief Number of the servers which haven't answered yet.
+    size_t pending_;
+
+    /// @brief Callback invoked when all servers have answered.
+    CtrlAgentCommandMgr::ResponseHandler handler_;
+};
+
+}
+
 namespace isc {
 namespace agent {
 
@@ -64,6 +147,82 @@ CtrlAgentCommandMgr::handleCommand(const std::string& cmd_name,
     return (answer_list);
 }
 
+void
+CtrlAgentCommandMgr::processCommandAsync(const ConstElementPtr& cmd,
+                                         const ResponseHandler& handler) {
+    std::string name;
+    ConstElementPtr arg;
+    ConstElementPtr services;
+    try {
+        name = parseCommand(arg, cmd);
+        services = cmd->get(CONTROL_SERVICE);
+
+    } catch (...) {
+        // The error response is generated by the processCommand.
+    }
+
+    // Only the commands forwarded to the servers rather than processed by
+    // the Control Agent or the hooks libraries are asynchronous.
+    bool forward = (services && (services->getType() == Element::list) &&
+                    !services->empty() &&
+                    !HooksManager::commandHandlersPresent(name));
+    for (unsigned i = 0; forward && (i < services->size()); ++i) {
+        forward = (services->get(i)->getType() == Element::string);
+    }
+    if (!forward) {
+        handler(processCommand(cmd));
+        return;
+    }
+
+    LOG_INFO(command_logger, COMMAND_RECEIVED).arg(name);
+
+    boost::shared_ptr<ForwardedCommand> forwarded(new ForwardedCommand());
+    forwarded->name_ = name;
+    forwarded->arg_ = arg;
+    forwarded->answers_.resize(services->size());
+    forwarded->pending_ = services->size();
+    forwarded->handler_ = handler;
+
+    // The command is sent to all servers at once. The answers are put in
+    // the order of the services when they arrive.
+    for (unsigned i = 0; i < services->size(); ++i) {
+        forwardCommandAsync(services->get(i)->stringValue(), name, cmd,
+            [this, forwarded, i](const ConstElementPtr& answer) {
+            forwarded->answers_[i] = answer;
+            if (--forwarded->pending_ > 0) {
+                return;
+            }
+
+            ElementPtr answer_list = Element::createList();
+            for (auto a = forwarded->answers_.begin();
+                 a != forwarded->answers_.end(); ++a) {
+                answer_list->add(boost::const_pointer_cast<Element>(*a));
+            }
+
+            ConstElementPtr response = answer_list;
+            try {
+                callCommandProcessedCallouts(forwarded->name_, forwarded->arg_,
+                                             response);
+            } catch (const Exception& ex) {
+                LOG_WARN(command_logger, COMMAND_PROCESS_ERROR2).arg(ex.what());
+                response = createAnswer(CONTROL_RESULT_ERROR,
+                                        std::string("Error during command processing: ")
+                                        + ex.what());
+            }
+            forwarded->handler_(response);
+        });
+    }
+}
+
+void
+CtrlAgentCommandMgr::closeConnections() {
+    // The callbacks of the aborted commands may look up the connections.
+    std::map<std::string, ServiceConnectionPtr> connections;
+    connections.swap(connections_);
+    for (auto conn = connections.begin(); conn != connections.end(); ++conn) {
+        conn->second->close();
+    }
+}
 
 ConstElementPtr
 CtrlAgentCommandMgr::handleCommandInternal(std::string cmd_name,
@@ -176,26 +335,16 @@ CtrlAgentCommandMgr::handleCommandInternal(std::string cmd_name,
     return (answer_list);
 }
 
-ConstElementPtr
-CtrlAgentCommandMgr::forwardCommand(const std::string& service,
-                                    const std::string& cmd_name,
-                                    const isc::data::ConstElementPtr& command) {
+std::string
+CtrlAgentCommandMgr::getSocketName(const std::string& service) const {
     // Context will hold the server configuration.
     CtrlAgentCfgContextPtr ctx;
 
-    // There is a hierarchy of the objects through which we need to pass to get
-    // the configuration context. We may simplify this at some point but since
-    // we're in the singleton we want to make sure that we're using most current
-    // configuration.
-    boost::shared_ptr<CtrlAgentController> controller =
-        boost::dynamic_pointer_cast<CtrlAgentController>(CtrlAgentController::instance());
-    if (controller) {
-        CtrlAgentProcessPtr process = controller->getCtrlAgentProcess();
-        if (process) {
-            CtrlAgentCfgMgrPtr cfgmgr = process->getCtrlAgentCfgMgr();
-            if (cfgmgr) {
-                ctx = cfgmgr->getCtrlAgentCfgContext();
-            }
+    CtrlAgentProcessPtr process = getCtrlAgentProcess();
+    if (process) {
+        CtrlAgentCfgMgrPtr cfgmgr = process->getCtrlAgentCfgMgr();
+        if (cfgmgr) {
+            ctx = cfgmgr->getCtrlAgentCfgContext();
         }
     }
 
@@ -217,7 +366,81 @@ CtrlAgentCommandMgr::forwardCommand(const std::string& service,
 
     // If the configuration does its job properly the socket-name must be
     // specified and must be a string value.
-    std::string socket_name = socket_info->get("socket-name")->stringValue();
+    return (socket_info->get("socket-name")->stringValue());
+}
+
+ServiceConnectionPtr
+CtrlAgentCommandMgr::getServiceConnection(const std::string& service) {
+    CtrlAgentProcessPtr process = getCtrlAgentProcess();
+    if (!process) {
+        isc_throw(CommandForwardingError, "internal server error: unable to retrieve"
+                  " Control Agent configuration information");
+    }
+
+    std::string socket_name = getSocketName(service);
+
+    // Reuse the connection unless the socket or the process has changed.
+    auto conn = connections_.find(service);
+    if (conn != connections_.end()) {
+        if ((conn->second->getSocketName() == socket_name) &&
+            (conn->second->getIOService() == process->getIoService())) {
+            return (conn->second);
+        }
+        ServiceConnectionPtr old_conn = conn->second;
+        connections_.erase(conn);
+        old_conn->close();
+    }
+
+    ServiceConnectionPtr new_conn(new ServiceConnection(process->getIoService(),
+                                                        socket_name,
+                                                        TIMEOUT_AGENT_FORWARD_COMMAND));
+    connections_[service] = new_conn;
+    return (new_conn);
+}
+
+void
+CtrlAgentCommandMgr::forwardCommandAsync(const std::string& service,
+                                         const std::string& cmd_name,
+                                         const ConstElementPtr& command,
+                                         const ResponseHandler& handler) {
+    LOG_DEBUG(agent_logger, isc::log::DBGLVL_COMMAND,
+              CTRL_AGENT_COMMAND_FORWARD_BEGIN)
+        .arg(cmd_name).arg(service);
+
+    ServiceConnectionPtr conn;
+    try {
+        conn = getServiceConnection(service);
+
+    } catch (const CommandForwardingError& ex) {
+        LOG_DEBUG(agent_logger, isc::log::DBGLVL_COMMAND,
+                  CTRL_AGENT_COMMAND_FORWARD_FAILED)
+            .arg(cmd_name).arg(ex.what());
+        handler(createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+        return;
+    }
+
+    conn->sendCommand(command,
+        [service, cmd_name, handler]
+        (const boost::system::error_code& ec, const ConstJSONFeedPtr& feed) {
+        ConstElementPtr answer;
+        try {
+            answer = getForwardedAnswer(service, cmd_name, ec, feed);
+
+        } catch (const CommandForwardingError& ex) {
+            LOG_DEBUG(agent_logger, isc::log::DBGLVL_COMMAND,
+                      CTRL_AGENT_COMMAND_FORWARD_FAILED)
+                .arg(cmd_name).arg(ex.what());
+            answer = createAnswer(CONTROL_RESULT_ERROR, ex.what());
+        }
+        handler(answer);
+    });
+}
+
+ConstElementPtr
+CtrlAgentCommandMgr::forwardCommand(const std::string& service,
+                                    const std::string& cmd_name,
+                                    const isc::data::ConstElementPtr& command) {
+    std::string socket_name = getSocketName(service);
 
     // Forward command and receive reply.
     IOServicePtr io_service(new IOService());;
@@ -237,33 +460,7 @@ CtrlAgentCommandMgr::forwardCommand(const std::string& service,
                }, ClientConnection::Timeout(TIMEOUT_AGENT_FORWARD_COMMAND));
     io_service->run();
 
-    if (received_ec) {
-        isc_throw(CommandForwardingError, "unable to forward command to the "
-                  << service << " service: " << received_ec.message()
-                  << ". The server is likely to be offline");
-    }
-
-    // This shouldn't happen because the fact that there was no time out indicates
-    // that the whole response has been read and it should be stored within the
-    // feed. But, let's check to prevent assertions.
-    if (!received_feed) {
-        isc_throw(CommandForwardingError, "internal server error: empty response"
-                  " received from the unix domain socket");
-    }
-
-    ConstElementPtr answer;
-    try {
-        answer = received_feed->toElement();
-
-        LOG_INFO(agent_logger, CTRL_AGENT_COMMAND_FORWARDED)
-            .arg(cmd_name).arg(service);
-
-    } catch (const std::exception& ex) {
-        isc_throw(CommandForwardingError, "internal server error: unable to parse"
-                  " server's answer to the forwarded message: " << ex.what());
-    }
-
-    return (answer);
+    return (getForwardedAnswer(service, cmd_name, received_ec, received_feed));
 }
 
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,10 +7,14 @@
 #ifndef CTRL_AGENT_COMMAND_MGR_H
 #define CTRL_AGENT_COMMAND_MGR_H
 
+#include <agent/ca_service_connection.h>
 #include <config/hooked_command_mgr.h>
 #include <exceptions/exceptions.h>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
+#include <functional>
+#include <map>
+#include <string>
 
 namespace isc {
 namespace agent {
@@ -34,13 +38,44 @@ public:
 /// are registered using @c CtrlAgentCommandMgr::instance().registerCommand().
 /// The @ref CtrlAgentResponseCreator uses the sole instance of the Command
 /// Manager to handle incoming commands.
+///
+/// The commands are forwarded to the servers over persistent connections,
+/// one per service, without blocking the Control Agent when the
+/// @ref processCommandAsync is used. The @ref handleCommand forwards the
+/// commands synchronously over connections opened for each command.
 class CtrlAgentCommandMgr : public config::HookedCommandMgr,
                             public boost::noncopyable {
 public:
 
+    /// @brief Type of the callback receiving the response to a command.
+    typedef std::function<void(const isc::data::ConstElementPtr&)> ResponseHandler;
+
     /// @brief Returns sole instance of the Command Manager.
     static CtrlAgentCommandMgr& instance();
 
+    /// @brief Triggers asynchronous command processing.
+    ///
+    /// The commands with a non-empty 'service' parameter which aren't
+    /// handled by the hooks libraries are forwarded to all listed services
+    /// at the same time, over the persistent connections to the servers.
+    /// This method returns at once and the handler is invoked from the IO
+    /// service of the Control Agent when all servers have responded. The
+    /// list of responses is in the order of the services.
+    ///
+    /// The other commands are processed by @c processCommand and the handler
+    /// is invoked before this method returns.
+    ///
+    /// @param cmd Pointer to the data element representing command in JSON
+    /// format.
+    /// @param handler Callback invoked with the response.
+    void processCommandAsync(const isc::data::ConstElementPtr& cmd,
+                             const ResponseHandler& handler);
+
+    /// @brief Closes the connections to the servers.
+    ///
+    /// The commands waiting for the responses get an error response.
+    void closeConnections();
+
     /// @brief Handles the command having a given name and arguments.
     ///
     /// This method extends the base implementation with the ability to forward
@@ -100,12 +135,47 @@ private:
     forwardCommand(const std::string& service, const std::string& cmd_name,
                    const isc::data::ConstElementPtr& command);
 
+    /// @brief Forwards received control command to a specified server
+    /// asynchronously.
+    ///
+    /// @param service Contains name of the service where the command should be
+    /// forwarded.
+    /// @param cmd_name Command name.
+    /// @param command Pointer to the object representing the forwarded command.
+    /// @param handler Callback invoked with the response to the forwarded
+    /// command or with an error response.
+    void forwardCommandAsync(const std::string& service,
+                             const std::string& cmd_name,
+                             const isc::data::ConstElementPtr& command,
+                             const ResponseHandler& handler);
+
+    /// @brief Returns the path of the control socket of a specified server.
+    ///
+    /// @param service Name of the service.
+    ///
+    /// @return Path of the socket.
+    /// @throw CommandForwardingError when the socket isn't configured.
+    std::string getSocketName(const std::string& service) const;
+
+    /// @brief Returns the persistent connection to a specified server.
+    ///
+    /// The connection is created when there is none or when the control
+    /// socket of the server has been reconfigured.
+    ///
+    /// @param service Name of the service.
+    ///
+    /// @return Pointer to the connection.
+    /// @throw CommandForwardingError when the socket isn't configured.
+    ServiceConnectionPtr getServiceConnection(const std::string& service);
+
     /// @brief Private constructor.
     ///
     /// The instance should be created using @ref CtrlAgentCommandMgr::instance,
     /// thus the constructor is private.
     CtrlAgentCommandMgr();
 
+    /// @brief Persistent connections to the servers, by service.
+    std::map<std::string, ServiceConnectionPtr> connections_;
 };
 
 } // end of namespace isc::agent
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 #include <asiolink/asio_wrapper.h>
 #include <agent/ca_process.h>
+#include <agent/ca_command_mgr.h>
 #include <agent/ca_controller.h>
 #include <agent/ca_response_creator_factory.h>
 #include <agent/ca_log.h>
@@ -77,6 +78,9 @@ CtrlAgentProcess::run() {
             boost::dynamic_pointer_cast<CtrlAgentController>(
                 CtrlAgentController::instance());
         controller->deregisterCommands();
+
+        // Close the connections to the servers.
+        CtrlAgentCommandMgr::instance().closeConnections();
     } catch (const std::exception&) {
         // What to do? Simply ignore...
     }
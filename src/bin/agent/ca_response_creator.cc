@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -79,6 +79,35 @@ createDynamicHttpResponse(const ConstHttpRequestPtr& request) {
     // null response, if the handler is not implemented properly. This is
     // again an internal server issue.
     ConstElementPtr response = CtrlAgentCommandMgr::instance().processCommand(command);
+    return (createCommandHttpResponse(request, response));
+}
+
+void
+CtrlAgentResponseCreator::
+createDynamicHttpResponseAsync(const ConstHttpRequestPtr& request,
+                               const HttpResponseHandler& handler) {
+    // See createDynamicHttpResponse.
+    ConstPostHttpRequestJsonPtr request_json = boost::dynamic_pointer_cast<
+        const PostHttpRequestJson>(request);
+    if (!request_json) {
+        handler(createStockHttpResponse(request, HttpStatusCode::INTERNAL_SERVER_ERROR));
+        return;
+    }
+
+    ConstElementPtr command = request_json->getBodyAsJson();
+
+    // The connection invoking this method holds a pointer to this object
+    // until the handler has been invoked.
+    CtrlAgentCommandMgr::instance().processCommandAsync(command,
+        [this, request, handler](const ConstElementPtr& response) {
+        handler(createCommandHttpResponse(request, response));
+    });
+}
+
+HttpResponsePtr
+CtrlAgentResponseCreator::
+createCommandHttpResponse(const ConstHttpRequestPtr& request,
+                          const ConstElementPtr& response) const {
     if (!response) {
         // Notify the client that we have a problem with our server.
         return (createStockHttpResponse(request, HttpStatusCode::INTERNAL_SERVER_ERROR));
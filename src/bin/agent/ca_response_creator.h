@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -77,6 +77,28 @@ private:
     /// @return Pointer to an object representing HTTP response.
     virtual http::HttpResponsePtr
     createDynamicHttpResponse(const http::ConstHttpRequestPtr& request);
+
+    /// @brief Creates implementation specific HTTP response asynchronously.
+    ///
+    /// The commands forwarded to the servers are processed without blocking
+    /// the Control Agent, the handler is invoked when the servers have
+    /// responded.
+    ///
+    /// @param request Pointer to an object representing HTTP request.
+    /// @param handler Callback invoked with an object representing HTTP
+    /// response.
+    virtual void
+    createDynamicHttpResponseAsync(const http::ConstHttpRequestPtr& request,
+                                   const http::HttpResponseHandler& handler);
+
+    /// @brief Creates HTTP response carrying the response to a command.
+    ///
+    /// @param request Pointer to an object representing HTTP request.
+    /// @param response Response to the command carried in the request.
+    /// @return Pointer to an object representing HTTP response.
+    http::HttpResponsePtr
+    createCommandHttpResponse(const http::ConstHttpRequestPtr& request,
+                              const data::ConstElementPtr& response) const;
 };
 
 } // end of namespace isc::agent
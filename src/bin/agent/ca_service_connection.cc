@@ -0,0 +1,288 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/asio_wrapper.h>
+#include <agent/ca_service_connection.h>
+#include <cc/command_interpreter.h>
+#include <boost/bind.hpp>
+
+using namespace isc::asiolink;
+using namespace isc::config;
+using namespace isc::data;
+
+namespace isc {
+namespace agent {
+
+ServiceConnection::ServiceConnection(const IOServicePtr& io_service,
+                                     const std::string& socket_name,
+                                     const long timeout)
+    : io_service_(io_service), socket_name_(socket_name), timeout_(timeout),
+      socket_(), connected_(false), reused_(false), queue_(),
+      in_progress_(false), sent_(false), received_(false), feed_(),
+      read_buf_(),
+      timer_(*io_service) {
+}
+
+void
+ServiceConnection::sendCommand(const ConstElementPtr& command,
+                               const Handler& handler) {
+    // Ask the server to wait for the next command once it has responded.
+    ElementPtr keep_alive_command = copy(command, 0);
+    keep_alive_command->set(CONTROL_KEEP_ALIVE, Element::create(true));
+
+    Transaction transaction;
+    transaction.command_ = keep_alive_command->str();
+    transaction.handler_ = handler;
+    transaction.retried_ = false;
+    queue_.push_back(transaction);
+
+    if (!in_progress_) {
+        startNext();
+    }
+}
+
+void
+ServiceConnection::close() {
+    timer_.cancel();
+    closeSocket();
+
+    // Take the transactions out of the queue before invoking the callbacks
+    // as they may send new commands.
+    std::list<Transaction> aborted;
+    aborted.swap(queue_);
+    in_progress_ = false;
+    for (auto transaction = aborted.begin(); transaction != aborted.end();
+         ++transaction) {
+        try {
+            transaction->handler_(boost::asio::error::operation_aborted,
+                                  ConstJSONFeedPtr());
+        } catch (...) {
+            // The handler should not throw but if it has been
+            // misimplemented, we don't want to propagate it.
+        }
+    }
+}
+
+void
+ServiceConnection::startNext() {
+    if (queue_.empty()) {
+        in_progress_ = false;
+        return;
+    }
+
+    in_progress_ = true;
+    sent_ = false;
+    received_ = false;
+    feed_.reset();
+    scheduleTimer();
+
+    if (!socket_) {
+        doConnect();
+
+    } else if (connected_) {
+        doSend(0);
+    }
+    // Otherwise the command is sent when the connect completes.
+}
+
+void
+ServiceConnection::doConnect() {
+    socket_.reset(new UnixDomainSocket(*io_service_));
+    connected_ = false;
+    reused_ = false;
+    socket_->asyncConnect(socket_name_,
+                          boost::bind(&ServiceConnection::connectCallback,
+                                      shared_from_this(), socket_, _1));
+}
+
+void
+ServiceConnection::connectCallback(const SocketPtr& socket,
+                                   const boost::system::error_code& ec) {
+    // The connection has been closed in the meantime.
+    if (socket != socket_) {
+        return;
+    }
+
+    if (ec) {
+        fail(ec);
+        return;
+    }
+
+    connected_ = true;
+    doReceive();
+    if (in_progress_) {
+        doSend(0);
+    }
+}
+
+void
+ServiceConnection::doSend(const size_t offset) {
+    const std::string& command = queue_.front().command_;
+    socket_->asyncSend(command.data() + offset, command.size() - offset,
+                       boost::bind(&ServiceConnection::sendCallback,
+                                   shared_from_this(), socket_, offset,
+                                   _1, _2));
+}
+
+void
+ServiceConnection::sendCallback(const SocketPtr& socket,
+                                const size_t offset,
+                                const boost::system::error_code& ec,
+                                const size_t length) {
+    if (socket != socket_) {
+        return;
+    }
+
+    // Once a part of the command has been written the server may run it,
+    // even if the rest of the write fails.
+    if (length > 0) {
+        sent_ = true;
+    }
+
+    if (ec) {
+        fail(ec);
+        return;
+    }
+
+    // Sending is in progress, so push back the timeout.
+    scheduleTimer();
+
+    // Send the rest of the command, if any. The response is received
+    // by the pending receive.
+    if (offset + length < queue_.front().command_.size()) {
+        doSend(offset + length);
+    }
+}
+
+void
+ServiceConnection::doReceive() {
+    socket_->asyncReceive(&read_buf_[0], read_buf_.size(),
+                          boost::bind(&ServiceConnection::receiveCallback,
+                                      shared_from_this(), socket_, _1, _2));
+}
+
+void
+ServiceConnection::receiveCallback(const SocketPtr& socket,
+                                   const boost::system::error_code& ec,
+                                   const size_t length) {
+    if (socket != socket_) {
+        return;
+    }
+
+    if (ec || (length == 0)) {
+        // The server closes the connection which has been idle for too long.
+        if (!in_progress_) {
+            closeSocket();
+        } else {
+            fail(ec ? ec : boost::asio::error::eof);
+        }
+        return;
+    }
+
+    // The server never sends anything without being asked to.
+    if (!in_progress_) {
+        closeSocket();
+        return;
+    }
+
+    // Receiving is in progress, so push back the timeout.
+    received_ = true;
+    scheduleTimer();
+
+    if (!feed_) {
+        feed_.reset(new JSONFeed());
+        feed_->initModel();
+    }
+    feed_->postBuffer(&read_buf_[0], length);
+    feed_->poll();
+
+    // Keep receiving whether or not the response is complete, so as
+    // the connection closed by the server is noticed.
+    doReceive();
+
+    if (!feed_->needData()) {
+        reused_ = true;
+        // The next transaction gets a new feed.
+        ConstJSONFeedPtr response = feed_;
+        complete(boost::system::error_code(), response);
+    }
+}
+
+void
+ServiceConnection::timeoutCallback() {
+    if (in_progress_) {
+        fail(boost::asio::error::timed_out);
+    }
+}
+
+void
+ServiceConnection::scheduleTimer() {
+    if (timeout_ > 0) {
+        // Pass raw pointer rather than shared pointer to this object
+        // because the timer is canceled when this object is destroyed.
+        timer_.setup(boost::bind(&ServiceConnection::timeoutCallback, this),
+                     timeout_, IntervalTimer::ONE_SHOT);
+    }
+}
+
+void
+ServiceConnection::closeSocket() {
+    if (socket_) {
+        try {
+            socket_->close();
+        } catch (...) {
+            // Closing the socket should not fail and nothing more can
+            // be done about it anyway.
+        }
+        socket_.reset();
+    }
+    connected_ = false;
+    reused_ = false;
+}
+
+void
+ServiceConnection::fail(const boost::system::error_code& ec) {
+    const bool reused = reused_;
+    closeSocket();
+
+    // The server closes the idle connections without waiting for the next
+    // command, so the connection used before may be found closed when the
+    // command is sent. The command is sent once again over a new
+    // connection, but only if writing it has failed: once the server has
+    // got a part of the command it may have run it before closing the
+    // connection, and running a command twice is worse than reporting
+    // the error.
+    Transaction& transaction = queue_.front();
+    if (reused && !sent_ && !received_ && !transaction.retried_ &&
+        (ec != boost::asio::error::timed_out)) {
+        transaction.retried_ = true;
+        startNext();
+        return;
+    }
+
+    complete(ec, ConstJSONFeedPtr());
+}
+
+void
+ServiceConnection::complete(const boost::system::error_code& ec,
+                            const ConstJSONFeedPtr& feed) {
+    timer_.cancel();
+    Handler handler = queue_.front().handler_;
+    queue_.pop_front();
+    startNext();
+
+    try {
+        handler(ec, feed);
+    } catch (...) {
+        // The handler should not throw but if it has been misimplemented,
+        // we don't want to propagate it.
+    }
+}
+
+} // end of namespace isc::agent
+} // end of namespace isc
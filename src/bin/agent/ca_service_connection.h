@@ -0,0 +1,239 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CTRL_AGENT_SERVICE_CONNECTION_H
+#define CTRL_AGENT_SERVICE_CONNECTION_H
+
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+#include <asiolink/unix_domain_socket.h>
+#include <cc/data.h>
+#include <cc/json_feed.h>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/system/error_code.hpp>
+#include <array>
+#include <functional>
+#include <list>
+#include <string>
+
+namespace isc {
+namespace agent {
+
+/// @brief Persistent connection to the control socket of a Kea server.
+///
+/// The Control Agent used to open a new connection to the server's
+/// control socket for every forwarded command and to wait for the
+/// response, blocking all other clients in the meantime. This class
+/// keeps the connection open between the commands and exchanges them
+/// asynchronously, within the IO service of the Control Agent.
+///
+/// The server processes the commands received over a connection one
+/// after another, so the commands are queued and sent one at a time,
+/// each after the response to the previous one has been received. The
+/// commands sent include the "keep-alive" parameter which makes the
+/// server wait for the next command rather than close the connection.
+///
+/// The server closes the connection when it remains idle for longer than
+/// its connection timeout. The connection is then re-established when the
+/// next command is sent. If the server has closed the connection before
+/// any part of the command could be written, the command is sent once
+/// again over a new connection. When the connection is lost after the
+/// command has been written, the error is reported instead, as the server
+/// may have run the command already.
+class ServiceConnection : public boost::enable_shared_from_this<ServiceConnection>,
+                          public boost::noncopyable {
+public:
+
+    /// @brief Type of the callback invoked when the transaction completes.
+    ///
+    /// The callback receives the error code and the feed holding the
+    /// response, which is null when an error has occurred.
+    typedef std::function<void(const boost::system::error_code&,
+                               const config::ConstJSONFeedPtr&)> Handler;
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service Pointer to the IO service.
+    /// @param socket_name Path of the server's control socket.
+    /// @param timeout Timeout of a transaction in milliseconds.
+    ServiceConnection(const asiolink::IOServicePtr& io_service,
+                      const std::string& socket_name,
+                      const long timeout);
+
+    /// @brief Returns the IO service used by the connection.
+    const asiolink::IOServicePtr& getIOService() const {
+        return (io_service_);
+    }
+
+    /// @brief Returns the path of the server's control socket.
+    const std::string& getSocketName() const {
+        return (socket_name_);
+    }
+
+    /// @brief Checks if the connection to the server is open.
+    bool isOpen() const {
+        return (static_cast<bool>(socket_));
+    }
+
+    /// @brief Sends a command to the server.
+    ///
+    /// The command is sent when the responses to all commands previously
+    /// sent over this connection have been received. The connection is
+    /// established if it isn't open.
+    ///
+    /// @param command Command to be sent, without the "keep-alive"
+    /// parameter.
+    /// @param handler Callback invoked with the response or the error.
+    void sendCommand(const data::ConstElementPtr& command,
+                     const Handler& handler);
+
+    /// @brief Closes the connection.
+    ///
+    /// The callbacks of the commands which haven't been answered are
+    /// invoked with the @c boost::asio::error::operation_aborted.
+    void close();
+
+private:
+
+    /// @brief Pointer to the socket.
+    typedef boost::shared_ptr<asiolink::UnixDomainSocket> SocketPtr;
+
+    /// @brief Command waiting for its response.
+    struct Transaction {
+        /// @brief Command in the wire format.
+        std::string command_;
+
+        /// @brief Callback invoked when the transaction completes.
+        Handler handler_;
+
+        /// @brief Indicates if the command has already been sent again
+        /// after the connection has been closed by the server.
+        bool retried_;
+    };
+
+    /// @brief Starts the first transaction from the queue, if any.
+    void startNext();
+
+    /// @brief Starts asynchronous connect to the server.
+    void doConnect();
+
+    /// @brief Callback invoked when the connect completes.
+    ///
+    /// @param socket Socket being connected.
+    /// @param ec Error code.
+    void connectCallback(const SocketPtr& socket,
+                         const boost::system::error_code& ec);
+
+    /// @brief Starts asynchronous send of the current command.
+    ///
+    /// @param offset Offset of the data not yet sent.
+    void doSend(const size_t offset);
+
+    /// @brief Callback invoked when a chunk of the command has been sent.
+    ///
+    /// @param socket Socket over which the data have been sent.
+    /// @param offset Offset of the data sent.
+    /// @param ec Error code.
+    /// @param length Number of bytes sent.
+    void sendCallback(const SocketPtr& socket,
+                      const size_t offset,
+                      const boost::system::error_code& ec,
+                      const size_t length);
+
+    /// @brief Starts asynchronous receive from the server.
+    ///
+    /// The receive is pending as long as the connection is open, so the
+    /// connection closed by the server is noticed even when it is idle.
+    void doReceive();
+
+    /// @brief Callback invoked when data have been received.
+    ///
+    /// @param socket Socket over which the data have been received.
+    /// @param ec Error code.
+    /// @param length Number of bytes received.
+    void receiveCallback(const SocketPtr& socket,
+                         const boost::system::error_code& ec,
+                         const size_t length);
+
+    /// @brief Callback invoked when the transaction timeout occurs.
+    void timeoutCallback();
+
+    /// @brief Schedules or reschedules the transaction timer.
+    void scheduleTimer();
+
+    /// @brief Closes the socket.
+    void closeSocket();
+
+    /// @brief Closes the connection after an error and completes or
+    /// restarts the current transaction.
+    ///
+    /// @param ec Error code.
+    void fail(const boost::system::error_code& ec);
+
+    /// @brief Removes the current transaction from the queue, starts the
+    /// next one and invokes the callback of the removed one.
+    ///
+    /// @param ec Error code.
+    /// @param feed Feed holding the response or null.
+    void complete(const boost::system::error_code& ec,
+                  const config::ConstJSONFeedPtr& feed);
+
+    /// @brief Pointer to the IO service.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief Path of the server's control socket.
+    std::string socket_name_;
+
+    /// @brief Timeout of a transaction in milliseconds.
+    long timeout_;
+
+    /// @brief Socket, null when the connection isn't open.
+    ///
+    /// A new socket is created for every connection, so the callbacks of
+    /// the operations on a closed connection can be told apart.
+    SocketPtr socket_;
+
+    /// @brief Indicates if the socket is connected.
+    bool connected_;
+
+    /// @brief Indicates if a response has been received over the socket.
+    bool reused_;
+
+    /// @brief Queue of the transactions, the first one is in progress
+    /// when @c in_progress_ is set.
+    std::list<Transaction> queue_;
+
+    /// @brief Indicates if the first transaction is in progress.
+    bool in_progress_;
+
+    /// @brief Indicates if a part of the current command has been written
+    /// to the socket.
+    bool sent_;
+
+    /// @brief Indicates if a part of the response to the current command
+    /// has been received.
+    bool received_;
+
+    /// @brief Feed holding the response to the current command.
+    config::JSONFeedPtr feed_;
+
+    /// @brief Buffer into which chunks of the responses are received.
+    std::array<char, 32768> read_buf_;
+
+    /// @brief Timer protecting the transaction in progress.
+    asiolink::IntervalTimer timer_;
+};
+
+/// @brief Pointer to the @ref ServiceConnection.
+typedef boost::shared_ptr<ServiceConnection> ServiceConnectionPtr;
+
+} // end of namespace isc::agent
+} // end of namespace isc
+
+#endif
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,13 +21,16 @@
 #include <boost/pointer_cast.hpp>
 #include <gtest/gtest.h>
 #include <testutils/sandbox.h>
+#include <array>
 #include <cstdlib>
+#include <functional>
 #include <vector>
 
 using namespace isc::agent;
 using namespace isc::asiolink;
 using namespace isc::data;
 using namespace isc::process;
+using namespace boost::asio::local;
 
 namespace {
 
@@ -56,9 +59,11 @@ public:
 
     /// @brief Destructor.
     ///
-    /// Deregisters all commands except 'list-commands'.
+    /// Deregisters all commands except 'list-commands' and closes the
+    /// connections to the servers.
     virtual ~CtrlAgentCommandMgrTest() {
         mgr_.deregisterAll();
+        mgr_.closeConnections();
         removeUnixSocketFile();
     }
 
@@ -257,6 +262,56 @@ public:
         checkAnswer(answer, expected_result0, expected_result1, expected_result2);
     }
 
+    /// @brief Test forwarding the command asynchronously.
+    ///
+    /// @param configured_services Services for which the client socket
+    /// should be configured.
+    /// @param service Service to be included in the command.
+    /// @param expected_result0 Expected first result in response from the server.
+    /// @param expected_result1 Expected second result in response from the server.
+    /// @param expected_result2 Expected third result in response from the server.
+    /// @param expected_responses Number of responses sent by the server.
+    void testForwardAsync(const std::vector<std::string>& configured_services,
+                          const std::string& service,
+                          const int expected_result0,
+                          const int expected_result1 = -1,
+                          const int expected_result2 = -1,
+                          const size_t expected_responses = 1) {
+        // Configure client side sockets.
+        for (auto s = configured_services.begin();
+             s != configured_services.end(); ++s) {
+            configureControlSocket(*s);
+        }
+        // Create server side socket. The client side communication is
+        // asynchronous so both run in the same IO service.
+        bindServerSocket("{ \"result\": 0 }");
+
+        ConstElementPtr answer;
+        ConstElementPtr command = createCommand("foo", service);
+        mgr_.processCommandAsync(command,
+                                 [this, &answer](const ConstElementPtr& rsp) {
+            answer = rsp;
+            getIOService()->stop();
+        });
+
+        // Run until the answer is received or the test times out.
+        if (!answer) {
+            getIOService()->run();
+        }
+
+        // Cancel all asynchronous operations on the server.
+        server_socket_->stopServer();
+
+        // We have some cancelled operations for which we need to invoke the
+        // handlers with the operation_aborted error code.
+        getIOService()->get_io_service().reset();
+        getIOService()->poll();
+
+        ASSERT_TRUE(answer);
+        EXPECT_EQ(expected_responses, server_socket_->getResponseNum());
+        checkAnswer(answer, expected_result0, expected_result1, expected_result2);
+    }
+
     /// @brief a convenience reference to control agent command manager
     CtrlAgentCommandMgr& mgr_;
 
@@ -414,4 +469,110 @@ TEST_F(CtrlAgentCommandMgrTest, forwardListCommands) {
     checkAnswer(answer, 3);
 }
 
+// Check that the command is forwarded asynchronously to a server.
+TEST_F(CtrlAgentCommandMgrTest, forwardAsyncToDHCPv4Server) {
+    testForwardAsync({ "dhcp4" }, "dhcp4", isc::config::CONTROL_RESULT_SUCCESS);
+}
+
+// Check that the command is forwarded asynchronously to two servers at
+// once and that the answers are in the order of the services.
+TEST_F(CtrlAgentCommandMgrTest, forwardAsyncToBothDHCPServers) {
+    testForwardAsync({ "dhcp4", "dhcp6" }, "dhcp4,dhcp6",
+                     isc::config::CONTROL_RESULT_SUCCESS,
+                     isc::config::CONTROL_RESULT_SUCCESS, -1, 2);
+}
+
+// Check that an error is returned for the service which socket isn't
+// configured while the other service gets the command.
+TEST_F(CtrlAgentCommandMgrTest, forwardAsyncFailForwardToServer) {
+    testForwardAsync({ "dhcp6" }, "dhcp4,dhcp6",
+                     isc::config::CONTROL_RESULT_ERROR,
+                     isc::config::CONTROL_RESULT_SUCCESS);
+}
+
+// Check that a command is not sent again when the server closes the
+// connection after having read it, as the server may have run it.
+TEST_F(CtrlAgentCommandMgrTest, forwardAsyncNoResendAfterClose) {
+    configureControlSocket("dhcp4");
+
+    // The server responds to the first command, keeping the connection
+    // open, and closes the connection after reading the second one.
+    boost::asio::io_service& io_service = getIOService()->get_io_service();
+    stream_protocol::acceptor acceptor(io_service,
+        stream_protocol::endpoint(unixSocketFilePath()));
+    stream_protocol::socket socket(io_service);
+    std::array<char, 1024> buf;
+    size_t commands_num = 0;
+    std::function<void()> do_accept;
+    std::function<void()> do_read = [&]() {
+        socket.async_read_some(boost::asio::buffer(buf),
+            [&](const boost::system::error_code& ec, size_t) {
+            if (ec) {
+                return;
+            }
+            if (++commands_num == 1) {
+                std::string response("{ \"result\": 0 }");
+                boost::asio::write(socket, boost::asio::buffer(response));
+                do_read();
+            } else {
+                socket.close();
+                do_accept();
+            }
+        });
+    };
+    do_accept = [&]() {
+        acceptor.async_accept(socket, [&](const boost::system::error_code& ec) {
+            if (!ec) {
+                do_read();
+            }
+        });
+    };
+    do_accept();
+
+    IntervalTimer timer(*getIOService());
+    timer.setup([this]() {
+        getIOService()->stop();
+        ADD_FAILURE() << "timeout";
+    }, TEST_TIMEOUT, IntervalTimer::ONE_SHOT);
+
+    ConstElementPtr answer1;
+    ConstElementPtr answer2;
+    mgr_.processCommandAsync(createCommand("foo", "dhcp4"),
+                             [&](const ConstElementPtr& rsp) {
+        answer1 = rsp;
+        mgr_.processCommandAsync(createCommand("bar", "dhcp4"),
+                                 [&](const ConstElementPtr& rsp) {
+            answer2 = rsp;
+            getIOService()->stop();
+        });
+    });
+    getIOService()->run();
+
+    timer.cancel();
+    acceptor.close();
+    socket.close();
+    mgr_.closeConnections();
+    getIOService()->get_io_service().reset();
+    getIOService()->poll();
+
+    ASSERT_TRUE(answer1);
+    checkAnswer(answer1, isc::config::CONTROL_RESULT_SUCCESS);
+    ASSERT_TRUE(answer2);
+    checkAnswer(answer2, isc::config::CONTROL_RESULT_ERROR);
+
+    // The second command has been received once.
+    EXPECT_EQ(2, commands_num);
+}
+
+// Check that the commands without the service are processed at once.
+TEST_F(CtrlAgentCommandMgrTest, processAsyncNoService) {
+    ConstElementPtr answer;
+    ConstElementPtr command = createCommand("list-commands", "");
+    mgr_.processCommandAsync(command, [&answer](const ConstElementPtr& rsp) {
+        answer = rsp;
+    });
+    ASSERT_TRUE(answer);
+    checkAnswer(answer, isc::config::CONTROL_RESULT_SUCCESS);
+}
+
 }
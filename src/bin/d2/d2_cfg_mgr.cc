@@ -82,6 +82,11 @@ D2CfgContext::toElement() const {
     const dhcp_ddns::NameChangeFormat& ncr_format = d2_params_->getNcrFormat();
     d2->set("ncr-format",
             Element::create(dhcp_ddns::ncrFormatToString(ncr_format)));
+    // Set spill-file
+    const std::string& spill_file = d2_params_->getSpillFile();
+    if (!spill_file.empty()) {
+        d2->set("spill-file", Element::create(spill_file));
+    }
     // Set forward-ddns
     ElementPtr forward_ddns = Element::createMap();
     forward_ddns->set("ddns-domains", forward_mgr_->toElement());
@@ -31,12 +31,14 @@ D2Params::D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format)
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const std::string& spill_file)
     : ip_address_(ip_address),
     port_(port),
     dns_server_timeout_(dns_server_timeout),
     ncr_protocol_(ncr_protocol),
-    ncr_format_(ncr_format) {
+    ncr_format_(ncr_format),
+    spill_file_(spill_file) {
     validateContents();
 }
 
@@ -44,7 +46,7 @@ D2Params::D2Params()
     : ip_address_(isc::asiolink::IOAddress("127.0.0.1")),
      port_(53001), dns_server_timeout_(100),
      ncr_protocol_(dhcp_ddns::NCR_UDP),
-     ncr_format_(dhcp_ddns::FMT_JSON) {
+     ncr_format_(dhcp_ddns::FMT_JSON), spill_file_() {
     validateContents();
 }
 
@@ -66,7 +68,8 @@ D2Params::validateContents() {
                   "D2Params: DNS server timeout must be larger than 0");
     }
 
-    if (ncr_format_ != dhcp_ddns::FMT_JSON) {
+    if ((ncr_format_ != dhcp_ddns::FMT_JSON) &&
+        (ncr_format_ != dhcp_ddns::FMT_BINARY)) {
         isc_throw(D2CfgError, "D2Params: NCR Format:"
                   << dhcp_ddns::ncrFormatToString(ncr_format_)
                   << " is not yet supported");
@@ -93,7 +96,8 @@ D2Params::operator == (const D2Params& other) const {
             (port_ == other.port_) &&
             (dns_server_timeout_ == other.dns_server_timeout_) &&
             (ncr_protocol_ == other.ncr_protocol_) &&
-            (ncr_format_ == other.ncr_format_));
+            (ncr_format_ == other.ncr_format_) &&
+            (spill_file_ == other.spill_file_));
 }
 
 bool
@@ -113,6 +117,10 @@ D2Params::toText() const {
            << ", ncr-format: " << ncr_format_
            << dhcp_ddns::ncrFormatToString(ncr_format_);
 
+    if (!spill_file_.empty()) {
+        stream << ", spill-file: " << spill_file_;
+    }
+
     return (stream.str());
 }
 
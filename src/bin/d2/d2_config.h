@@ -149,18 +149,23 @@ public:
     /// wait for a response to a single DNS update request.
     /// @param ncr_protocol socket protocol D2 should use to receive NCRS
     /// @param ncr_format packet format of the inbound NCRs
+    /// @param spill_file name of the file in which to spill the requests
+    /// which do not fit in the request queue. Empty (the default) disables
+    /// spilling.
     ///
     /// @throw D2CfgError if:
     /// -# ip_address is 0.0.0.0 or ::
     /// -# port is 0
     /// -# dns_server_timeout is < 1
     /// -# ncr_protocol is invalid, currently only NCR_UDP is supported
-    /// -# ncr_format is invalid, currently only FMT_JSON is supported
+    /// -# ncr_format is invalid, currently FMT_JSON and FMT_BINARY are
+    /// supported
     D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format);
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const std::string& spill_file = "");
 
     /// @brief Default constructor
     /// The default constructor creates an instance that has updates disabled.
@@ -194,6 +199,11 @@ public:
         return(ncr_format_);
     }
 
+    /// @brief Return the name of the spill file, empty if none.
+    const std::string& getSpillFile() const {
+        return(spill_file_);
+    }
+
     /// @brief Return summary of the configuration used by D2.
     ///
     /// The returned summary of the configuration is meant to be appended to
@@ -243,6 +253,9 @@ private:
     /// @brief Format of the inbound requests (NCRs).
     /// Currently only JSON format is supported.
     dhcp_ddns::NameChangeFormat ncr_format_;
+
+    /// @brief Name of the spill file, empty if none.
+    std::string spill_file_;
 };
 
 /// @brief Dumps the contents of a D2Params as text to an output stream
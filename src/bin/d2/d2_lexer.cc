@@ -1,6 +1,6 @@
-#line 2 "d2_lexer.cc"
+#line 1 "d2_lexer.cc"
 
-#line 4 "d2_lexer.cc"
+#line 3 "d2_lexer.cc"
 
 #define  YY_INT_ALIGNED short int
 
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 67
-#define YY_END_OF_BUFFER 68
+#define YY_NUM_RULES 72
+#define YY_END_OF_BUFFER 73
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,54 +700,58 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[417] =
+static const flex_int16_t yy_accept[454] =
     {   0,
-       60,   60,    0,    0,    0,    0,    0,    0,    0,    0,
-       68,   66,   10,   11,   66,    1,   60,   57,   60,   60,
-       66,   59,   58,   66,   66,   66,   66,   66,   53,   54,
-       66,   66,   66,   55,   56,    5,    5,    5,   66,   66,
-       66,   10,   11,    0,    0,   49,    0,    0,    0,    0,
+       65,   65,    0,    0,    0,    0,    0,    0,    0,    0,
+       73,   71,   10,   11,   71,    1,   65,   62,   65,   65,
+       71,   64,   63,   71,   71,   71,   71,   71,   58,   59,
+       71,   71,   71,   60,   61,    5,    5,    5,   71,   71,
+       71,   10,   11,    0,    0,   54,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-       60,   60,    0,   59,   60,    3,    2,    6,    0,   60,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
-        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    1,   65,   65,    0,   64,    3,    2,    6,    0,
+       65,    0,    0,    0,    0,    0,    0,    4,    0,    0,
+        9,   55,    0,    0,    0,    0,    0,    0,    0,    0,
 
-       52,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   57,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
-        0,   51,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
+        0,    0,    0,    0,    0,   56,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   65,   63,
-        0,   62,   61,    0,    0,    0,    0,    0,    0,   19,
-       18,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   70,   68,    0,   67,
+       66,    0,    0,    0,    0,    0,    0,    0,   20,   19,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   64,   61,    0,
-        0,    0,    0,    0,    0,   20,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   43,    0,    0,    0,   14,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   46,   47,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   40,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    7,    0,    0,    0,    0,
+       69,   66,    0,    0,    0,    0,    0,    0,    0,   21,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   48,    0,
+        0,    0,    0,   14,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   51,   52,    0,    0,
+        0,   45,    0,    0,    0,    0,    0,    0,   42,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   42,    0,    0,   39,    0,    0,   32,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    7,   22,
 
-        0,    0,    0,    0,    0,   36,    0,   22,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   37,   41,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   44,    0,    0,   41,
+        0,    0,    0,    0,   34,    0,    0,    0,    0,    0,
+        0,    0,   38,    0,   24,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   39,   43,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   12,
-        0,    0,    0,    0,    0,    0,    0,   28,    0,   26,
-        0,    0,    0,    0,   45,    0,    0,    0,    0,    0,
-       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,    0,   44,
-        0,    0,    0,    0,   13,   17,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   31,    0,   27,    0,    0,
-        0,    0,   35,   34,    0,    0,    0,   25,    0,   23,
-
-       16,    0,   24,   21,   48,    0,    0,    0,   33,    0,
-       38,    0,    0,    0,   15,    0
+        0,    0,    0,    0,    0,    0,    0,   30,    0,   28,
+        0,    0,    0,   47,    0,    0,   50,    0,    0,    0,
+        0,    0,    0,   32,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+
+        0,    0,    0,    0,   49,    0,    0,    0,    0,   13,
+       17,    0,    0,   46,    0,    0,    0,   18,    0,    0,
+        0,    0,   33,    0,   29,    0,    0,    0,    0,   37,
+       36,    0,    0,    0,   27,    0,   25,   16,    0,   26,
+       23,   53,    0,    0,    0,   35,    0,   40,    0,    0,
+        0,   15,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -759,13 +763,13 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,    5,    5,   27,    5,   28,    5,   29,   30,   31,
-        5,   32,   33,   34,   35,    5,    5,    5,    5,    5,
-       36,   37,   38,    5,   39,    5,   40,   41,   42,   43,
+        5,    5,   27,   28,    5,   29,    5,   30,   31,   32,
+        5,   33,   34,   35,   36,    5,    5,    5,   37,    5,
+       38,   39,   40,    5,   41,    5,   42,   43,   44,   45,
 
-       44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,    5,   56,   57,   58,   59,   60,   61,   62,
-       63,   64,   65,    5,   66,    5,    5,    5,    5,    5,
+       46,   47,   48,   49,   50,   28,   51,   52,   53,   54,
+       55,   56,   57,   58,   59,   60,   61,   62,   63,   64,
+       65,   66,   67,    5,   68,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -782,213 +786,329 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[67] =
+static const YY_CHAR yy_meta[69] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
-        5,    5,    5,    5,    5,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[428] =
+static const flex_int16_t yy_base[454] =
     {   0,
-        0,    0,   65,   68,   71,    0,   69,   73,   54,   70,
-      735,  736,   89,  731,  137,    0,  192,  736,  197,  200,
-       86,  212,  736,  713,   97,   74,   63,   69,  736,  736,
-       83,   68,   78,  736,  736,  736,  124,  719,  678,    0,
-      711,  128,  726,  212,  234,  736,  674,  680,  172,  672,
-      196,  196,  257,  674,  670,  187,  191,  669,  667,  677,
-      666,  679,   91,  659,  663,  672,  179,  209,  210,    0,
-      281,  289,  308,  314,  293,  736,    0,  736,  232,  257,
-      224,  227,  276,  292,  293,  277,  736,  673,  708,  736,
-      294,  736,  328,  660,  670,  297,  665,  301,  307,  704,
-
-        0,  374,  663,  207,  655,  666,  660,  648,  645,  647,
-      645,  690,  637,  653,  636,  645,  640,  637,  638,  633,
-      300,  650,  643,  646,    0,  307,  317,  255,  313,  320,
-      322,  638,  736,    0,  630,  632,  321,  640,  679,  678,
-      677,  736,  406,  628,  629,  622,  622,  619,  633,  665,
-      618,  613,  615,  632,  660,  624,  292,  625,  657,  612,
-      608,  621,  608,  619,  612,  615,  604,  328,  736,  736,
-      332,  736,  736,  600,    0,  602,  339,  651,  608,  736,
-      736,  438,  599,  610,  597,  641,  605,  593,  592,  601,
-      607,  593,  602,  591,  599,  594,  597,  634,  209,  580,
-
-      632,  581,  592,  579,  590,  622,  621,  736,  736,  588,
-        0,  576,  623,  622,  584,  736,  573,  470,  577,  571,
-      569,  579,  570,  562,  575,  612,  561,  576,  572,  574,
-      557,  548,  555,  736,  556,  553,  550,  736,  550,  548,
-      557,  546,  553,  560,  557,    0,  549,  736,  736,  546,
-      552,  539,  538,  544,  540,  549,  581,  535,  736,  547,
-      537,  532,  535,  529,  541,  578,  527,  528,  204,  537,
-      574,  521,  567,  533,  522,  736,  564,  517,  567,  525,
-      565,  559,  517,  508,  526,  506,  554,  520,  519,  518,
-      555,  554,  736,  507,  500,  736,  503,  545,  736,  492,
-
-      322,  491,  500,  512,  545,  736,  498,  736,  492,  502,
-      485,  479,  478,  466,  502,  450,  500,  736,  736,  465,
-      450,  448,  459,  495,  460,  436,  441,  439,  444,  736,
-      483,  434,  439,  426,  418,  419,  431,  736,  416,  736,
-      414,  429,  412,  426,  736,  416,  412,  460,  421,  414,
-      736,  415,  403,  449,  388,  348,  391,  437,  436,  387,
-      392,  386,  394,  393,  736,  374,  382,  384,  376,  736,
-      420,  367,  418,  366,  736,  736,  362,  358,  354,  404,
-      403,  350,  349,  362,  398,  736,  355,  736,  396,  395,
-      341,  387,  736,  736,  386,  385,  327,  736,  331,  736,
-
-      736,  325,  736,  736,  736,  373,  334,  371,  736,  313,
-      736,  302,  207,  244,  736,  736,  515,  520,  525,  530,
-      535,  540,  543,  216,  130,  115,   87
+        1,    0,   70,    0,  139,    0, 1038, 1195, 1036, 1105,
+        0,  763, 1041,  901,  208,  760, 1134,  832, 1151, 1208,
+     1077, 1158,  969, 1168, 1220, 1047, 1116, 1104, 1040, 1076,
+     1114, 1117, 1124, 1115, 1147, 1164, 1185, 1266, 1259,  898,
+     1048, 1210, 1066,  277,  346, 1211, 1249, 1333, 1333, 1102,
+     1334, 1259, 1262,  415, 1241, 1335,  992, 1236, 1336, 1336,
+     1335, 1338, 1333,  926, 1235, 1339, 1334, 1337, 1171, 1110,
+     1136,    0, 1225, 1184, 1242, 1191, 1333,  829, 1334, 1039,
+     1087, 1215, 1218, 1202, 1232, 1243, 1213, 1339, 1278, 1340,
+     1340, 1341, 1132, 1262, 1342, 1342, 1270, 1349, 1270, 1273,
+
+      967,    0,  484, 1350, 1342, 1255, 1345, 1342, 1352, 1342,
+     1342, 1344, 1345, 1342, 1343, 1357, 1342, 1356, 1352, 1351,
+     1366, 1355, 1368, 1353, 1268, 1343, 1366, 1367, 1372, 1221,
+     1246, 1248, 1228, 1252, 1260, 1283, 1342, 1036, 1294, 1359,
+     1364, 1284, 1373, 1343, 1344, 1343,  553, 1367, 1369, 1371,
+     1365, 1367, 1366, 1382, 1344, 1370, 1367, 1371, 1390, 1345,
+     1385, 1258, 1388, 1346, 1379, 1378, 1377, 1377, 1393, 1382,
+     1395, 1391, 1391, 1396, 1387, 1264, 1344, 1345, 1265, 1347,
+     1348, 1318, 1049, 1161, 1388, 1253, 1352, 1397, 1352, 1354,
+      622, 1390, 1405, 1404, 1393, 1360, 1404, 1394, 1395, 1406,
+
+     1414, 1403, 1413, 1405, 1414, 1411, 1416, 1359, 1272, 1402,
+     1417, 1361, 1419, 1408, 1421, 1410, 1423, 1418, 1361, 1362,
+     1359, 1360, 1321, 1084, 1286, 1416, 1362, 1363, 1427, 1361,
+     1419,  691, 1424, 1368, 1421, 1421, 1432, 1426, 1419, 1434,
+     1370, 1423, 1440, 1438, 1442, 1427, 1420, 1429, 1363, 1433,
+     1431, 1430, 1439, 1364, 1481, 1434, 1434, 1445, 1436, 1486,
+     1447, 1455, 1324, 1097, 1378, 1448, 1377, 1378, 1501, 1501,
+     1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1505,
+     1503, 1505, 1505, 1505, 1505, 1503, 1507, 1504, 1321, 1511,
+     1508, 1506, 1504, 1508, 1503, 1506, 1523, 1515, 1503, 1504,
+
+     1505, 1512, 1505, 1523, 1506, 1506, 1520, 1512, 1532, 1514,
+     1507, 1531, 1532, 1533, 1509, 1513, 1505, 1527, 1521, 1506,
+     1527, 1520, 1534, 1509, 1507, 1520, 1277, 1536, 1522, 1534,
+     1547, 1515, 1508, 1537, 1522, 1532, 1550, 1547, 1544, 1549,
+     1551, 1523, 1538, 1524, 1523, 1524, 1556, 1544, 1544, 1525,
+     1535, 1557, 1526, 1561, 1539, 1553, 1547, 1547, 1560, 1525,
+     1527, 1554, 1560, 1559, 1552, 1555, 1569, 1526, 1556, 1527,
+     1556, 1573, 1558, 1528, 1573, 1575, 1534, 1568, 1566, 1577,
+     1535, 1578, 1579, 1535, 1582, 1573, 1536, 1569, 1321, 1575,
+     1537, 1538, 1575, 1581, 1539, 1578, 1587, 1588, 1540, 1536,
+
+     1571, 1582, 1586, 1579, 1537, 1541, 1579, 1634, 1582, 1538,
+     1539, 1590, 1588, 1540, 1644, 1644, 1645, 1644, 1645, 1646,
+     1645, 1646, 1645, 1646, 1646, 1647, 1648, 1647, 1649, 1647,
+     1648, 1650, 1651, 1649, 1649, 1658, 1658, 1659, 1660, 1660,
+     1661, 1662, 1663, 1664, 1664, 1663, 1665, 1664, 1665, 1665,
+     1665, 1665, 1734
     } ;
 
-static const flex_int16_t yy_def[428] =
+static const flex_int16_t yy_def[454] =
     {   0,
-      416,    1,  417,  417,    1,    5,    5,    5,    5,    5,
-      416,  416,  416,  416,  416,  418,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  419,
-      416,  416,  416,  420,   15,  416,   45,   45,   45,   45,
-       45,   45,  421,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  418,
-      416,  416,  416,  416,  416,  416,  422,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  419,  416,
-      420,  416,  416,   45,   45,   45,   45,   45,   45,  423,
-
-       45,  421,   45,   45,   45,   45,   45,   45,   45,   45,
+      453,    1,  453,    3,  453,    5,    5,    5,    5,    5,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,   45,   45,   45,   45,
+       45,   45,   45,  453,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   16,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,   40,
+      453,  453,  453,   45,   45,   45,   45,   45,   45,   45,
+
+      453,   45,  453,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  422,  416,  416,  416,  416,  416,
-      416,  416,  416,  424,   45,   45,   45,   45,   45,   45,
-      423,  416,  421,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,   45,   45,
+       45,   45,   45,   45,   45,  453,  453,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  416,  416,  416,
-      416,  416,  416,  416,  425,   45,   45,   45,   45,  416,
-      416,  421,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  453,  453,  453,  453,  453,
+      453,  453,  453,   45,   45,   45,   45,   45,  453,  453,
+      453,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,  416,  416,  416,
-      426,   45,   45,   45,   45,  416,   45,  421,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,  416,   45,   45,   45,  416,   45,   45,
-       45,   45,   45,   45,  416,  427,   45,  416,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,  416,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  416,   45,   45,   45,   45,
+      453,  453,  453,  453,   45,   45,   45,   45,   45,  453,
+       45,  453,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  453,   45,
+       45,   45,   45,  453,   45,   45,   45,   45,   45,   45,
+       45,   45,  453,  453,   45,   45,  453,  453,   45,   45,
+       45,  453,   45,   45,   45,   45,   45,   45,  453,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  453,  453,
+
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,  416,   45,   45,  416,   45,   45,  416,   45,
-
-       45,   45,   45,   45,   45,  416,   45,  416,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  416,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  416,
-       45,   45,   45,   45,   45,   45,   45,  416,   45,  416,
-       45,   45,   45,   45,  416,   45,   45,   45,   45,   45,
-      416,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  416,   45,   45,   45,   45,  416,
-       45,   45,   45,   45,  416,  416,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  416,   45,  416,   45,   45,
-       45,   45,  416,  416,   45,   45,   45,  416,   45,  416,
-
-      416,   45,  416,  416,  416,   45,   45,   45,  416,   45,
-      416,   45,   45,   45,  416,    0,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416
+       45,   45,   45,   45,   45,   45,  453,   45,   45,  453,
+       45,   45,   45,   45,  453,   45,   45,   45,   45,   45,
+       45,   45,  453,   45,  453,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,  453,  453,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  453,
+       45,   45,   45,   45,   45,   45,   45,  453,   45,  453,
+       45,   45,   45,  453,   45,   45,  453,   45,   45,   45,
+       45,   45,   45,  453,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  453,
+
+       45,   45,   45,   45,  453,   45,   45,   45,   45,  453,
+      453,   45,   45,  453,   45,   45,   45,  453,   45,   45,
+       45,   45,  453,   45,  453,   45,   45,   45,   45,  453,
+      453,   45,   45,   45,  453,   45,  453,  453,   45,  453,
+      453,  453,   45,   45,   45,  453,   45,  453,   45,   45,
+       45,  453,    0
     } ;
 
-static const flex_int16_t yy_nxt[803] =
+static const flex_int16_t yy_nxt[1803] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
-       12,   12,   12,   12,   25,   26,   12,   12,   27,   12,
-       12,   12,   12,   28,   12,   29,   12,   30,   12,   12,
-       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
-       12,   12,   32,   12,   12,   12,   12,   33,   12,   12,
-       12,   12,   12,   12,   34,   35,   37,   14,   37,   37,
-       14,   37,   38,   41,   40,   38,   12,   12,   40,   12,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   41,
-       42,   91,   42,   76,   81,   12,   12,   82,   77,   12,
-
-       83,   12,   82,   81,   12,   79,   12,   79,   12,   83,
-       80,   80,   80,   81,   12,   12,   12,   12,   39,  246,
-       12,   82,   84,   12,   83,   42,   85,   42,   12,   42,
-      116,   42,  117,   86,  211,   12,   12,   44,   44,   44,
-       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
+       11,   12,   13,   14,   13,   12,   15,   16,   12,   17,
+       18,   19,   20,   21,   22,   22,   22,   23,   24,   12,
+       12,   12,   12,   12,   12,   25,   26,   12,   12,   12,
+       27,   12,   12,   12,   12,   28,   12,   12,   29,   12,
+       30,   12,   12,   12,   12,   12,   25,   31,   12,   12,
+       12,   12,   12,   12,   32,   12,   12,   12,   12,   12,
+       33,   12,   12,   12,   12,   12,   12,   34,   35,   11,
+       36,   37,   14,   37,   36,   36,   36,   38,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   11,   12,
+       13,   14,   13,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   39,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   11,   44,   44,
+       44,   45,   45,   46,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
-       48,   45,   45,   49,   50,   45,   45,   45,   45,   45,
-       51,   52,   45,   53,   45,   45,   54,   45,   55,   56,
-       45,   57,   45,   58,   59,   49,   60,   61,   62,   63,
-       64,   65,   66,   67,   68,   69,   45,   45,   45,   45,
-
-       45,   45,   45,   71,   96,   72,   72,   72,   71,  296,
-       74,   74,   74,   75,   75,   75,   73,   92,   98,   99,
-      175,   73,  121,   71,   73,   74,   74,   74,   96,  105,
-      106,   98,  122,   99,  107,   73,   73,   98,   99,  108,
-       73,  109,  297,   73,  110,   80,   80,   80,   93,  415,
-       98,  126,   99,  235,  127,   73,   45,   45,  145,  146,
-       45,   45,  101,  236,  414,  123,  124,   45,   45,   45,
-       80,   80,   80,   45,  126,   45,   45,  127,   45,  170,
+       48,   49,   45,   45,   45,   50,   51,   45,   45,   45,
+       45,   45,   52,   53,   45,   45,   54,   45,   45,   55,
+       47,   56,   57,   45,   58,   45,   59,   60,   61,   62,
+       63,   64,   65,   66,   67,   68,   69,   70,   71,   45,
+       45,   45,   45,   45,   45,   45,   11,   44,   44,   44,
+       44,   44,   92,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   93,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   11,   44,   44,   44,   45,
+       45,   46,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   54,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   75,   75,   75,   45,  170,   92,
-
-       71,   45,   72,   72,   72,   73,   75,   75,   75,   45,
-      128,  128,   45,   73,   45,  102,   79,   73,   79,  126,
-      127,   80,   80,   80,   73,   71,  137,   74,   74,   74,
-       93,  139,   73,   91,  128,  131,   73,  140,   73,  168,
-       91,  163,  129,  130,  169,  168,  170,  169,  196,  178,
-      137,  197,  208,  213,  214,  139,  208,   73,  372,  164,
-      413,  140,  215,  168,   91,  173,  412,  169,   91,  171,
-      172,  208,   91,  178,  325,  209,  411,  410,  409,  326,
-       91,  408,  407,   91,  406,   91,  134,  143,  143,  143,
-      405,  404,  403,  402,  143,  143,  143,  143,  143,  143,
-
-      401,  400,  399,  398,  373,  397,  396,  395,  394,  393,
-      392,  391,  390,  143,  143,  143,  143,  143,  143,  182,
-      182,  182,  389,  388,  387,  386,  182,  182,  182,  182,
-      182,  182,  385,  384,  383,  382,  381,  380,  379,  378,
-      377,  376,  375,  374,  371,  182,  182,  182,  182,  182,
-      182,  218,  218,  218,  370,  369,  368,  367,  218,  218,
-      218,  218,  218,  218,  366,  365,  364,  363,  362,  361,
-      360,  359,  358,  357,  356,  355,  354,  218,  218,  218,
-      218,  218,  218,   45,   45,   45,  353,  352,  351,  350,
-       45,   45,   45,   45,   45,   45,  349,  348,  347,  346,
-
-      345,  344,  343,  342,  341,  340,  339,  338,  337,   45,
-       45,   45,   45,   45,   45,   36,   36,   36,   36,   36,
-       70,  336,   70,   70,   70,   89,  335,   89,  334,   89,
-       91,   91,   91,   91,   91,  100,  100,  100,  100,  100,
-      125,  333,  125,  125,  125,  141,  141,  141,  332,  331,
-      330,  329,  328,  327,  324,  323,  322,  321,  320,  319,
-      318,  317,  316,  315,  314,  313,  312,  311,  310,  309,
-      308,  307,  306,  305,  304,  303,  302,  301,  300,  299,
-      298,  295,  294,  293,  292,  291,  290,  289,  288,  287,
-      286,  285,  284,  283,  282,  281,  280,  279,  278,  277,
-
-      276,  275,  274,  273,  272,  271,  270,  269,  268,  267,
-      266,  265,  264,  263,  262,  261,  260,  259,  258,  257,
-      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
-      245,  244,  243,  242,  241,  240,  239,  238,  237,  234,
-      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
-      223,  222,  221,  220,  219,  217,  216,  212,  210,  207,
-      206,  205,  204,  203,  202,  201,  200,  199,  198,  195,
-      194,  193,  192,  191,  190,  189,  188,  187,  186,  185,
-      184,  183,  142,  181,  180,  179,  177,  176,  174,  167,
-      166,  165,  162,  161,  160,  159,  158,  157,  156,  155,
-
-      154,  153,  152,  151,  150,  149,  148,  147,  144,  142,
-      138,  136,  135,  133,  132,  120,  119,  118,  115,  114,
-      113,  112,  111,  104,  103,   97,   95,   94,   43,   90,
-       88,   87,   78,   43,  416,   11,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-
-      416,  416
+       45,   45,   45,   45,   11,  101,  101,  101,  101,  101,
+      102,  101,  101,  101,  101,  101,  101,   45,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,   45,  101,  101,  101,   45,  101,  101,
+      101,   45,  101,  101,  101,  101,  101,  101,   45,  101,
+      101,  101,   45,  101,   45,  103,  101,  101,  101,  101,
+      101,  101,  101,   11,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  147,  147,  147,
+
+      101,  101,  101,  101,  147,  147,  147,  147,  147,  147,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  147,  147,  147,  147,  147,
+      147,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,   11,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  191,  191,  191,  101,
+      101,  101,  101,  191,  191,  191,  191,  191,  191,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  191,  191,  191,  191,  191,  191,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,   11,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  232,  232,  232,  101,  101,
+      101,  101,  232,  232,  232,  232,  232,  232,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  232,  232,  232,  232,  232,  232,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+       11,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+
+      101,  101,  101,  101,   45,   45,   45,  101,  101,  101,
+      101,   45,   45,   45,   45,   45,   45,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,   45,   45,   45,   45,   45,   45,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,   11,
+       72,   72,   11,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   11,   78,
+       78,   11,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   11,   90,   90,
+
+       11,   90,   90,   43,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   11,  118,   11,  119,
+      101,  101,  146,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,   11,  107,  108,   11,   11,
+       11,  109,   42,   40,   42,  110,   11,   11,   11,  183,
+      183,  183,   81,   81,   81,   41,  183,  183,  183,  183,
+      183,  183,  224,  224,  224,   11,   91,   82,   43,  224,
+      224,  224,  224,  224,  224,   11,   11,  183,  183,  183,
+      183,  183,  183,   11,   77,   12,   11,   12,   82,   78,
+      224,  224,  224,  224,  224,  224,   11,  264,  264,  264,
+
+       81,   81,   81,   11,  264,  264,  264,  264,  264,  264,
+       44,   44,   44,   11,   11,   11,   11,   44,   44,   44,
+       44,   44,   44,   11,   41,  264,  264,  264,  264,  264,
+      264,   11,   99,   11,   82,   97,   84,   44,   44,   44,
+       44,   44,   44,   44,   44,   73,   11,   74,   74,   74,
+       11,   83,   83,   99,   12,   85,   84,   11,   75,  100,
+       97,   84,   73,   11,   76,   76,   76,   11,  128,   73,
+       44,   76,   76,   76,   44,   75,   83,   86,   44,   75,
+      100,   87,   75,   11,   11,   44,   42,   79,   42,   44,
+       11,   44,  138,  225,  129,   73,   75,   74,   74,   74,
+
+       40,   11,   73,   75,   76,   76,   76,   11,   75,   11,
+       11,   42,   11,   42,   11,   75,  125,   11,  225,   11,
+       11,   73,   73,   73,   11,  126,  127,   11,   80,   75,
+       80,   11,   75,   81,   81,   81,   75,  132,   73,   73,
+       73,   11,   11,  130,   12,   11,  131,   11,  132,   75,
+       80,   11,   80,   75,  176,   81,   81,   81,   11,   11,
+      130,  176,  132,   11,   11,   11,  130,  227,  228,  131,
+       75,  131,  178,  135,  177,   94,  229,   11,   88,  176,
+      177,   99,   11,  133,  178,  100,  179,  111,  221,  221,
+      112,  139,  104,  178,  134,  120,  121,  177,   94,  105,
+
+      142,  144,   99,  180,  145,  181,  100,  150,  151,  221,
+      222,  170,   89,  187,  184,  139,  206,   11,  250,  207,
+       11,  136,  265,   11,  142,  144,  320,  251,  145,  171,
+      354,  407,   11,   11,  182,  184,  355,  187,   11,   11,
+       11,   11,   11,   11,   11,  137,   11,   11,  189,  190,
+      265,   11,  159,   11,  199,  204,  209,  230,   11,   11,
+       11,  321,   11,   11,  249,  263,  254,  267,  268,  299,
+      237,  261,  262,  272,  117,  279,   11,   11,  223,  408,
+      115,   96,  124,  300,  153,  141,  172,   95,   98,  106,
+      113,  114,  116,  122,  123,  140,  143,  148,  152,  154,
+
+      155,  157,  156,  158,  161,  162,  149,  160,  163,  164,
+      165,  166,  167,  168,  169,  173,  174,  175,  185,  186,
+      188,  192,  193,  194,  195,  196,  197,  198,  200,  201,
+      202,  203,  205,  208,  210,  211,  212,  213,  214,  215,
+      216,  217,  218,  219,  220,  226,  231,  233,  234,  235,
+      236,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+      247,  248,  252,  253,  255,  256,  257,  258,  259,  260,
+      266,  269,  270,  271,  273,  274,  275,  276,  277,  278,
+      280,  281,  282,  283,  284,  285,  286,  287,  288,  289,
+      290,  291,  292,  293,  294,  295,  296,  297,  298,  301,
+
+       11,   11,   11,   11,   11,   11,   11,   11,  317,  325,
+      333,  335,  309,  327,  345,  331,  336,  341,  346,  352,
+      360,   11,   11,   11,   11,   11,   11,   11,  368,  370,
+      374,  377,  384,   11,   11,   11,   11,   11,   11,   11,
+      400,  405,  410,  411,  414,  418,  423,  308,  303,  311,
+      316,  324,  328,  306,  302,  312,  307,  314,  319,  310,
+      304,  305,  313,  315,  318,  322,  323,  326,  329,  330,
+      332,  334,  337,  338,  339,  340,  342,  343,  344,  347,
+      348,  349,  350,  351,  353,  356,  357,  358,  359,  361,
+      362,  363,  364,  365,  366,  367,  369,  371,  372,  373,
+
+      375,  376,  378,  379,  380,  381,  382,  383,  385,  386,
+      387,  388,  389,  390,  391,  392,  393,  394,  395,  396,
+      397,  398,  399,  401,  402,  403,  404,  406,  409,  412,
+      413,  415,  416,  417,  419,  420,  421,  422,  424,  425,
+      426,  427,  428,   11,   11,   11,   11,   11,   11,  430,
+      431,  435,  437,  438,  440,  441,  442,   11,   11,   11,
+       11,   11,   11,   11,   11,  453,  453,  453,  446,  448,
+      452,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      434,  453,  453,  453,  453,  436,  453,  453,  453,  453,
+
+      439,  453,  429,  453,  432,  433,  453,  453,  443,  447,
+      444,  453,  453,  453,  453,  453,  453,  453,  445,  449,
+      453,  453,  453,  453,  451,  450,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+
+      453,  453
     } ;
 
-static const flex_int16_t yy_chk[803] =
+static const flex_int16_t yy_chk[1803] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -996,89 +1116,199 @@ static const flex_int16_t yy_chk[803] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    3,    3,    3,    4,
-        4,    4,    3,    9,    7,    4,    5,    5,    8,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,   10,
-       13,  427,   13,   21,   26,    5,    5,   27,   21,    5,
-
-       28,    9,   32,   31,    5,   25,    5,   25,    5,   33,
-       25,   25,   25,   26,    5,    5,    7,   10,    5,  426,
-        8,   27,   31,    5,   28,   37,   32,   37,    5,   42,
-       63,   42,   63,   33,  425,    5,    5,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       15,   15,   15,   17,   49,   17,   17,   17,   19,  269,
-       19,   19,   19,   20,   20,   20,   17,   44,   51,   52,
-      424,   19,   67,   22,   20,   22,   22,   22,   49,   56,
-       56,   68,   67,   69,   56,   17,   22,   51,   52,   56,
-       19,   57,  269,   20,   57,   79,   79,   79,   44,  414,
-       68,   81,   69,  199,   82,   22,   45,   45,  104,  104,
-       45,   45,   53,  199,  413,   68,   69,   45,   45,   53,
-       80,   80,   80,   45,   81,   45,   45,   82,   45,  128,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   53,   71,   71,   71,   53,  128,   91,
-
-       72,   53,   72,   72,   72,   71,   75,   75,   75,   53,
-       83,   86,   53,   72,   53,   53,   73,   75,   73,   84,
-       85,   73,   73,   73,   71,   74,   96,   74,   74,   74,
-       91,   98,   72,   93,   83,   86,   75,   99,   74,  126,
-       93,  121,   84,   85,  127,  129,  131,  130,  157,  137,
-       96,  157,  168,  177,  177,   98,  171,   74,  356,  121,
-      412,   99,  177,  126,   93,  131,  410,  127,   93,  129,
-      130,  168,   93,  137,  301,  171,  408,  407,  406,  301,
-       93,  402,  399,   93,  397,   93,   93,  102,  102,  102,
-      396,  395,  392,  391,  102,  102,  102,  102,  102,  102,
-
-      390,  389,  387,  385,  356,  384,  383,  382,  381,  380,
-      379,  378,  377,  102,  102,  102,  102,  102,  102,  143,
-      143,  143,  374,  373,  372,  371,  143,  143,  143,  143,
-      143,  143,  369,  368,  367,  366,  364,  363,  362,  361,
-      360,  359,  358,  357,  355,  143,  143,  143,  143,  143,
-      143,  182,  182,  182,  354,  353,  352,  350,  182,  182,
-      182,  182,  182,  182,  349,  348,  347,  346,  344,  343,
-      342,  341,  339,  337,  336,  335,  334,  182,  182,  182,
-      182,  182,  182,  218,  218,  218,  333,  332,  331,  329,
-      218,  218,  218,  218,  218,  218,  328,  327,  326,  325,
-
-      324,  323,  322,  321,  320,  317,  316,  315,  314,  218,
-      218,  218,  218,  218,  218,  417,  417,  417,  417,  417,
-      418,  313,  418,  418,  418,  419,  312,  419,  311,  419,
-      420,  420,  420,  420,  420,  421,  421,  421,  421,  421,
-      422,  310,  422,  422,  422,  423,  423,  423,  309,  307,
-      305,  304,  303,  302,  300,  298,  297,  295,  294,  292,
-      291,  290,  289,  288,  287,  286,  285,  284,  283,  282,
-      281,  280,  279,  278,  277,  275,  274,  273,  272,  271,
-      270,  268,  267,  266,  265,  264,  263,  262,  261,  260,
-      258,  257,  256,  255,  254,  253,  252,  251,  250,  247,
-
-      245,  244,  243,  242,  241,  240,  239,  237,  236,  235,
-      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
-      223,  222,  221,  220,  219,  217,  215,  214,  213,  212,
-      210,  207,  206,  205,  204,  203,  202,  201,  200,  198,
-      197,  196,  195,  194,  193,  192,  191,  190,  189,  188,
-      187,  186,  185,  184,  183,  179,  178,  176,  174,  167,
-      166,  165,  164,  163,  162,  161,  160,  159,  158,  156,
-      155,  154,  153,  152,  151,  150,  149,  148,  147,  146,
-      145,  144,  141,  140,  139,  138,  136,  135,  132,  124,
-      123,  122,  120,  119,  118,  117,  116,  115,  114,  113,
-
-      112,  111,  110,  109,  108,  107,  106,  105,  103,  100,
-       97,   95,   94,   89,   88,   66,   65,   64,   62,   61,
-       60,   59,   58,   55,   54,   50,   48,   47,   43,   41,
-       39,   38,   24,   14,   11,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-
-      416,  416
+       45,   45,   45,   45,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  191,
+      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
+
+      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
+      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
+      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
+      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
+      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
+      232,  232,  232,  232,  232,  232,  232,  232,  232,   16,
+       16,   16,   12,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   78,   78,
+       78,   18,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   40,   40,   40,
+
+       14,   40,   40,   14,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,  101,   64,   23,   64,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  138,   57,   57,   80,   29,
+       13,   57,   13,    7,   13,   57,   26,   41,  183,  138,
+      138,  138,   80,   80,   80,    9,  138,  138,  138,  138,
+      138,  138,  183,  183,  183,   43,   41,   26,   43,  183,
+      183,  183,  183,  183,  183,   30,   21,  138,  138,  138,
+      138,  138,  138,  224,   21,    9,   81,    7,   26,   21,
+      183,  183,  183,  183,  183,  183,  264,  224,  224,  224,
+
+       81,   81,   81,   28,  224,  224,  224,  224,  224,  224,
+      264,  264,  264,   31,   34,   27,   32,  264,  264,  264,
+      264,  264,  264,   33,   10,  224,  224,  224,  224,  224,
+      224,   93,   70,   17,   31,   50,   28,   93,  264,  264,
+      264,  264,  264,  264,   93,   17,   35,   17,   17,   17,
+       19,   27,   32,   70,   10,   31,   33,   22,   17,   71,
+       50,   28,   19,   36,   19,   19,   19,   24,   70,   22,
+       93,   22,   22,   22,   93,   19,   27,   32,   93,   17,
+       71,   33,   22,   74,   37,   93,   37,   24,   37,   93,
+       76,   93,   93,  184,   71,   74,   19,   74,   74,   74,
+
+        8,   84,   76,   22,   76,   76,   76,   20,   74,   42,
+       46,   42,   87,   42,   82,   76,   69,   83,  184,   25,
+      130,   20,   20,   20,   73,   69,   69,  133,   25,   74,
+       25,   85,   20,   25,   25,   25,   76,   84,   73,   73,
+       73,   75,   86,   82,    8,  131,   83,  132,   87,   73,
+       75,  134,   75,   20,  130,   75,   75,   75,   39,  135,
+       85,  133,   84,  176,  179,   38,   82,  186,  186,   83,
+       73,   86,  132,   87,  131,   47,  186,   89,   38,  130,
+      134,   52,  136,   85,  135,   53,  133,   58,  176,  179,
+       58,   94,   55,  132,   86,   65,   65,  131,   47,   55,
+
+       97,   99,   52,  134,  100,  135,   53,  106,  106,  176,
+      179,  125,   39,  142,  139,   94,  162,  182,  209,  162,
+      223,   89,  225,  263,   97,   99,  289,  209,  100,  125,
+      327,  389,   77,   79,  136,  139,  327,  142,   88,   91,
+       92,  137,  146,  177,  178,   90,  180,  181,  144,  145,
+      225,  189,  114,  190,  155,  160,  164,  187,  221,  222,
+      230,  289,  249,  254,  208,  223,  212,  227,  228,  263,
+      196,  219,  220,  234,   63,  241,  267,  268,  182,  389,
+       61,   49,   68,  265,  108,   96,  126,   48,   51,   56,
+       59,   60,   62,   66,   67,   95,   98,  104,  107,  109,
+
+      110,  112,  111,  113,  116,  117,  105,  115,  118,  119,
+      120,  121,  122,  123,  124,  127,  128,  129,  140,  141,
+      143,  148,  149,  150,  151,  152,  153,  154,  156,  157,
+      158,  159,  161,  163,  165,  166,  167,  168,  169,  170,
+      171,  172,  173,  174,  175,  185,  188,  192,  193,  194,
+      195,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+      206,  207,  210,  211,  213,  214,  215,  216,  217,  218,
+      226,  229,  231,  233,  235,  236,  237,  238,  239,  240,
+      242,  243,  244,  245,  246,  247,  248,  250,  251,  252,
+      253,  255,  256,  257,  258,  259,  260,  261,  262,  266,
+
+      272,  279,  299,  300,  317,  320,  325,  333,  286,  293,
+      303,  305,  277,  295,  315,  301,  306,  311,  316,  324,
+      332,  335,  345,  346,  360,  368,  370,  374,  342,  344,
+      350,  353,  361,  377,  384,  400,  405,  410,  411,  414,
+      381,  387,  391,  392,  395,  399,  406,  276,  270,  280,
+      285,  292,  296,  274,  269,  281,  275,  283,  288,  278,
+      271,  273,  282,  284,  287,  290,  291,  294,  297,  298,
+      302,  304,  307,  308,  309,  310,  312,  313,  314,  318,
+      319,  321,  322,  323,  326,  328,  329,  330,  331,  334,
+      336,  337,  338,  339,  340,  341,  343,  347,  348,  349,
+
+      351,  352,  354,  355,  356,  357,  358,  359,  362,  363,
+      364,  365,  366,  367,  369,  371,  372,  373,  375,  376,
+      378,  379,  380,  382,  383,  385,  386,  388,  390,  393,
+      394,  396,  397,  398,  401,  402,  403,  404,  407,  408,
+      409,  412,  413,  418,  423,  425,  430,  431,  435,  416,
+      417,  422,  426,  427,  429,  432,  433,  437,  438,  440,
+      441,  442,  446,  448,  452,    0,    0,    0,  443,  445,
+      451,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      421,    0,    0,    0,    0,  424,    0,    0,    0,    0,
+
+      428,    0,  415,    0,  419,  420,    0,    0,  434,  444,
+      436,    0,    0,    0,    0,    0,    0,    0,  439,  447,
+        0,    0,    0,    0,  450,  449,    0,    0,    0,    0,
+        0,    0,    0,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
+
+      453,  453
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1087,15 +1317,16 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[67] =
+static const flex_int16_t yy_rule_linenum[72] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
-      170,  176,  185,  196,  207,  216,  225,  234,  244,  254,
-      264,  281,  298,  307,  316,  326,  336,  346,  357,  366,
-      376,  386,  396,  405,  414,  424,  433,  442,  451,  460,
-      469,  478,  487,  500,  509,  518,  527,  536,  546,  645,
-      650,  655,  660,  661,  662,  663,  664,  665,  667,  685,
-      698,  703,  707,  709,  711,  713
+      170,  176,  185,  196,  207,  216,  225,  234,  243,  253,
+      263,  273,  283,  300,  317,  326,  335,  345,  355,  365,
+      376,  385,  395,  405,  415,  424,  433,  443,  452,  461,
+      470,  479,  488,  497,  506,  515,  524,  533,  546,  555,
+      564,  573,  582,  592,  691,  696,  701,  706,  707,  708,
+      709,  710,  711,  713,  731,  744,  749,  753,  755,  757,
+      759
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1146,7 +1377,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::d2::D2ParserContext::fatal(msg)
-#line 1150 "d2_lexer.cc"
+#line 1380 "d2_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1172,8 +1403,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1176 "d2_lexer.cc"
-#line 1177 "d2_lexer.cc"
+#line 1406 "d2_lexer.cc"
+#line 1407 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1491,7 +1722,7 @@ YY_DECL
     }
 
 
-#line 1495 "d2_lexer.cc"
+#line 1725 "d2_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1520,13 +1751,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 417 )
+				if ( yy_current_state >= 454 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 416 );
+		while ( yy_current_state != 453 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1545,13 +1776,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 67 )
+			else if ( yy_act < 72 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 67 )
+			else if ( yy_act == 72 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 68 )
+			else if ( yy_act == 73 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1734,6 +1965,18 @@ YY_RULE_SETUP
 case 18:
 YY_RULE_SETUP
 #line 234 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_SPILL_FILE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("spill-file", driver.loc_);
+    }
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+#line 243 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
@@ -1744,9 +1987,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 19:
+case 20:
 YY_RULE_SETUP
-#line 244 "d2_lexer.ll"
+#line 253 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
@@ -1757,9 +2000,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 20:
+case 21:
 YY_RULE_SETUP
-#line 254 "d2_lexer.ll"
+#line 263 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
@@ -1770,9 +2013,22 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 21:
+case 22:
 YY_RULE_SETUP
-#line 264 "d2_lexer.ll"
+#line 273 "d2_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 23:
+YY_RULE_SETUP
+#line 283 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1790,9 +2046,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 22:
+case 24:
 YY_RULE_SETUP
-#line 281 "d2_lexer.ll"
+#line 300 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1810,9 +2066,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 23:
+case 25:
 YY_RULE_SETUP
-#line 298 "d2_lexer.ll"
+#line 317 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1822,9 +2078,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 24:
+case 26:
 YY_RULE_SETUP
-#line 307 "d2_lexer.ll"
+#line 326 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1834,9 +2090,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 25:
+case 27:
 YY_RULE_SETUP
-#line 316 "d2_lexer.ll"
+#line 335 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::FORWARD_DDNS:
@@ -1847,9 +2103,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 26:
+case 28:
 YY_RULE_SETUP
-#line 326 "d2_lexer.ll"
+#line 345 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1860,9 +2116,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 27:
+case 29:
 YY_RULE_SETUP
-#line 336 "d2_lexer.ll"
+#line 355 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1873,9 +2129,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 30:
 YY_RULE_SETUP
-#line 346 "d2_lexer.ll"
+#line 365 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DNS_SERVER:
@@ -1886,9 +2142,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 31:
 YY_RULE_SETUP
-#line 357 "d2_lexer.ll"
+#line 376 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1898,9 +2154,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 32:
 YY_RULE_SETUP
-#line 366 "d2_lexer.ll"
+#line 385 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1911,9 +2167,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 33:
 YY_RULE_SETUP
-#line 376 "d2_lexer.ll"
+#line 395 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1924,9 +2180,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 34:
 YY_RULE_SETUP
-#line 386 "d2_lexer.ll"
+#line 405 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1937,9 +2193,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 35:
 YY_RULE_SETUP
-#line 396 "d2_lexer.ll"
+#line 415 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1949,9 +2205,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 36:
 YY_RULE_SETUP
-#line 405 "d2_lexer.ll"
+#line 424 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONTROL_SOCKET:
@@ -1961,9 +2217,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 37:
 YY_RULE_SETUP
-#line 414 "d2_lexer.ll"
+#line 433 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONTROL_SOCKET:
@@ -1973,9 +2229,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 38:
 YY_RULE_SETUP
-#line 424 "d2_lexer.ll"
+#line 443 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1985,9 +2241,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 39:
 YY_RULE_SETUP
-#line 433 "d2_lexer.ll"
+#line 452 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGING:
@@ -1997,9 +2253,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 40:
 YY_RULE_SETUP
-#line 442 "d2_lexer.ll"
+#line 461 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2009,9 +2265,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 41:
 YY_RULE_SETUP
-#line 451 "d2_lexer.ll"
+#line 470 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2021,9 +2277,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 42:
 YY_RULE_SETUP
-#line 460 "d2_lexer.ll"
+#line 479 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2033,9 +2289,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 43:
 YY_RULE_SETUP
-#line 469 "d2_lexer.ll"
+#line 488 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2045,9 +2301,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 44:
 YY_RULE_SETUP
-#line 478 "d2_lexer.ll"
+#line 497 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2057,9 +2313,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 45:
 YY_RULE_SETUP
-#line 487 "d2_lexer.ll"
+#line 506 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 515 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+#line 524 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+#line 533 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2073,9 +2365,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 49:
 YY_RULE_SETUP
-#line 500 "d2_lexer.ll"
+#line 546 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2085,9 +2377,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 50:
 YY_RULE_SETUP
-#line 509 "d2_lexer.ll"
+#line 555 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2097,9 +2389,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 51:
 YY_RULE_SETUP
-#line 518 "d2_lexer.ll"
+#line 564 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2109,9 +2401,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 52:
 YY_RULE_SETUP
-#line 527 "d2_lexer.ll"
+#line 573 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2121,9 +2413,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 53:
 YY_RULE_SETUP
-#line 536 "d2_lexer.ll"
+#line 582 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2133,9 +2425,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 54:
 YY_RULE_SETUP
-#line 546 "d2_lexer.ll"
+#line 592 "d2_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2235,65 +2527,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 50:
-/* rule 50 can match eol */
+case 55:
+/* rule 55 can match eol */
 YY_RULE_SETUP
-#line 645 "d2_lexer.ll"
+#line 691 "d2_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 51:
-/* rule 51 can match eol */
+case 56:
+/* rule 56 can match eol */
 YY_RULE_SETUP
-#line 650 "d2_lexer.ll"
+#line 696 "d2_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 52:
+case 57:
 YY_RULE_SETUP
-#line 655 "d2_lexer.ll"
+#line 701 "d2_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 53:
+case 58:
 YY_RULE_SETUP
-#line 660 "d2_lexer.ll"
+#line 706 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 54:
+case 59:
 YY_RULE_SETUP
-#line 661 "d2_lexer.ll"
+#line 707 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 55:
+case 60:
 YY_RULE_SETUP
-#line 662 "d2_lexer.ll"
+#line 708 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 56:
+case 61:
 YY_RULE_SETUP
-#line 663 "d2_lexer.ll"
+#line 709 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 57:
+case 62:
 YY_RULE_SETUP
-#line 664 "d2_lexer.ll"
+#line 710 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 58:
+case 63:
 YY_RULE_SETUP
-#line 665 "d2_lexer.ll"
+#line 711 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 59:
+case 64:
 YY_RULE_SETUP
-#line 667 "d2_lexer.ll"
+#line 713 "d2_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2312,9 +2604,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 60:
+case 65:
 YY_RULE_SETUP
-#line 685 "d2_lexer.ll"
+#line 731 "d2_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2328,43 +2620,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 61:
+case 66:
 YY_RULE_SETUP
-#line 698 "d2_lexer.ll"
+#line 744 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 62:
+case 67:
 YY_RULE_SETUP
-#line 703 "d2_lexer.ll"
+#line 749 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 63:
+case 68:
 YY_RULE_SETUP
-#line 707 "d2_lexer.ll"
+#line 753 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 64:
+case 69:
 YY_RULE_SETUP
-#line 709 "d2_lexer.ll"
+#line 755 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 65:
+case 70:
 YY_RULE_SETUP
-#line 711 "d2_lexer.ll"
+#line 757 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 66:
+case 71:
 YY_RULE_SETUP
-#line 713 "d2_lexer.ll"
+#line 759 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 715 "d2_lexer.ll"
+#line 761 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2388,12 +2680,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 67:
+case 72:
 YY_RULE_SETUP
-#line 738 "d2_lexer.ll"
+#line 784 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2397 "d2_lexer.cc"
+#line 2688 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2712,7 +3004,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 417 )
+			if ( yy_current_state >= 454 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2745,11 +3037,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 417 )
+		if ( yy_current_state >= 454 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 416);
+	yy_is_jam = (yy_current_state == 453);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3498,8 +3790,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 738 "d2_lexer.ll"
-
+#line 784 "d2_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -3601,4 +3892,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -45,13 +45,20 @@ extern const isc::log::MessageID DHCP_DDNS_NO_FWD_MATCH_ERROR = "DHCP_DDNS_NO_FW
 extern const isc::log::MessageID DHCP_DDNS_NO_MATCH = "DHCP_DDNS_NO_MATCH";
 extern const isc::log::MessageID DHCP_DDNS_NO_REV_MATCH_ERROR = "DHCP_DDNS_NO_REV_MATCH_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_PROCESS_INIT = "DHCP_DDNS_PROCESS_INIT";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_PERSISTED = "DHCP_DDNS_QUEUE_MGR_PERSISTED";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_PERSIST_ERROR = "DHCP_DDNS_QUEUE_MGR_PERSIST_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_FULL = "DHCP_DDNS_QUEUE_MGR_QUEUE_FULL";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE = "DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_SPILLED = "DHCP_DDNS_QUEUE_MGR_QUEUE_SPILLED";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECONFIGURING = "DHCP_DDNS_QUEUE_MGR_RECONFIGURING";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECOVERING = "DHCP_DDNS_QUEUE_MGR_RECOVERING";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECV_ERROR = "DHCP_DDNS_QUEUE_MGR_RECV_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RESUME_ERROR = "DHCP_DDNS_QUEUE_MGR_RESUME_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RESUMING = "DHCP_DDNS_QUEUE_MGR_RESUMING";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILLING = "DHCP_DDNS_QUEUE_MGR_SPILLING";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILL_DRAINED = "DHCP_DDNS_QUEUE_MGR_SPILL_DRAINED";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILL_ERROR = "DHCP_DDNS_QUEUE_MGR_SPILL_ERROR";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILL_OPENED = "DHCP_DDNS_QUEUE_MGR_SPILL_OPENED";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_STARTED = "DHCP_DDNS_QUEUE_MGR_STARTED";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_START_ERROR = "DHCP_DDNS_QUEUE_MGR_START_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_STOPPED = "DHCP_DDNS_QUEUE_MGR_STOPPED";
@@ -75,12 +82,16 @@ extern const isc::log::MessageID DHCP_DDNS_REVERSE_REPLACE_RESP_CORRUPT = "DHCP_
 extern const isc::log::MessageID DHCP_DDNS_REV_REQUEST_IGNORED = "DHCP_DDNS_REV_REQUEST_IGNORED";
 extern const isc::log::MessageID DHCP_DDNS_RUN_EXIT = "DHCP_DDNS_RUN_EXIT";
 extern const isc::log::MessageID DHCP_DDNS_SHUTDOWN_COMMAND = "DHCP_DDNS_SHUTDOWN_COMMAND";
+extern const isc::log::MessageID DHCP_DDNS_SPILL_FILE_TRUNCATED = "DHCP_DDNS_SPILL_FILE_TRUNCATED";
+extern const isc::log::MessageID DHCP_DDNS_SPILL_SUPERSEDED = "DHCP_DDNS_SPILL_SUPERSEDED";
 extern const isc::log::MessageID DHCP_DDNS_STARTED = "DHCP_DDNS_STARTED";
 extern const isc::log::MessageID DHCP_DDNS_STARTING_TRANSACTION = "DHCP_DDNS_STARTING_TRANSACTION";
 extern const isc::log::MessageID DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR = "DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_TRANS_SEND_ERROR = "DHCP_DDNS_TRANS_SEND_ERROR";
+extern const isc::log::MessageID DHCP_DDNS_UPDATE_CHANNEL_UNEXPECTED_RESPONSE = "DHCP_DDNS_UPDATE_CHANNEL_UNEXPECTED_RESPONSE";
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_REQUEST_SENT = "DHCP_DDNS_UPDATE_REQUEST_SENT";
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_RESPONSE_RECEIVED = "DHCP_DDNS_UPDATE_RESPONSE_RECEIVED";
+extern const isc::log::MessageID DHCP_DDNS_UPDATE_RESPONSE_TRUNCATED = "DHCP_DDNS_UPDATE_RESPONSE_TRUNCATED";
 
 } // namespace d2
 } // namespace isc
@@ -126,13 +137,20 @@ const char* values[] = {
     "DHCP_DDNS_NO_MATCH", "No DNS servers match FQDN %1",
     "DHCP_DDNS_NO_REV_MATCH_ERROR", "Request ID %1: the configured list of reverse DDNS domains does not contain a match for: %2  The request has been discarded.",
     "DHCP_DDNS_PROCESS_INIT", "application init invoked",
+    "DHCP_DDNS_QUEUE_MGR_PERSISTED", "application saved %1 queued requests to the spill file %2",
+    "DHCP_DDNS_QUEUE_MGR_PERSIST_ERROR", "application could not save the queued requests to the spill file: %1",
     "DHCP_DDNS_QUEUE_MGR_QUEUE_FULL", "application request queue has reached maximum number of entries %1",
     "DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE", "Request ID %1: received and queued a request.",
+    "DHCP_DDNS_QUEUE_MGR_QUEUE_SPILLED", "Request ID %1: received and spilled a request.",
     "DHCP_DDNS_QUEUE_MGR_RECONFIGURING", "application is reconfiguring the queue manager",
     "DHCP_DDNS_QUEUE_MGR_RECOVERING", "application is attempting to recover from a queue manager IO error",
     "DHCP_DDNS_QUEUE_MGR_RECV_ERROR", "application's queue manager was notified of a request receive error by its listener.",
     "DHCP_DDNS_QUEUE_MGR_RESUME_ERROR", "application could not restart the queue manager, reason: %1",
     "DHCP_DDNS_QUEUE_MGR_RESUMING", "application is resuming listening for requests now that the request queue size has reached %1 of a maximum %2 allowed",
+    "DHCP_DDNS_QUEUE_MGR_SPILLING", "application request queue is full with %1 entries, spilling requests to %2",
+    "DHCP_DDNS_QUEUE_MGR_SPILL_DRAINED", "application has moved all requests from the spill file %1 back into the request queue",
+    "DHCP_DDNS_QUEUE_MGR_SPILL_ERROR", "application encountered an error using the spill file: %1",
+    "DHCP_DDNS_QUEUE_MGR_SPILL_OPENED", "application opened the spill file %1 holding %2 requests",
     "DHCP_DDNS_QUEUE_MGR_STARTED", "application's queue manager has begun listening for requests.",
     "DHCP_DDNS_QUEUE_MGR_START_ERROR", "application could not start the queue manager, reason: %1",
     "DHCP_DDNS_QUEUE_MGR_STOPPED", "application's queue manager has stopped listening for requests.",
@@ -156,12 +174,16 @@ const char* values[] = {
     "DHCP_DDNS_REV_REQUEST_IGNORED", "Request ID %1: Reverse updates are disabled, the reverse portion of request will be ignored: %2",
     "DHCP_DDNS_RUN_EXIT", "application is exiting the event loop",
     "DHCP_DDNS_SHUTDOWN_COMMAND", "application received shutdown command with args: %1",
+    "DHCP_DDNS_SPILL_FILE_TRUNCATED", "spill file %1 ends with a truncated record at offset %2, it is discarded",
+    "DHCP_DDNS_SPILL_SUPERSEDED", "Request ID %1: spilled request supersedes an older spilled request for the same name",
     "DHCP_DDNS_STARTED", "Kea DHCP-DDNS server version %1 started",
     "DHCP_DDNS_STARTING_TRANSACTION", "Request ID %1:",
     "DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR", "Request ID %1: application encountered an unexpected error while carrying out a NameChangeRequest: %2",
     "DHCP_DDNS_TRANS_SEND_ERROR", "Request ID %1: application encountered an unexpected error while attempting to send a DNS update: %2",
+    "DHCP_DDNS_UPDATE_CHANNEL_UNEXPECTED_RESPONSE", "received unexpected DNS response from %1 port %2",
     "DHCP_DDNS_UPDATE_REQUEST_SENT", "Request ID %1: %2 to server: %3",
     "DHCP_DDNS_UPDATE_RESPONSE_RECEIVED", "Request ID %1: to server: %2 status: %3",
+    "DHCP_DDNS_UPDATE_RESPONSE_TRUNCATED", "server %1 port %2 truncated the response to a DNS update, retrying over TCP",
     NULL
 };
 
@@ -46,13 +46,20 @@ extern const isc::log::MessageID DHCP_DDNS_NO_FWD_MATCH_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_NO_MATCH;
 extern const isc::log::MessageID DHCP_DDNS_NO_REV_MATCH_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_PROCESS_INIT;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_PERSISTED;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_PERSIST_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_FULL;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_SPILLED;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECONFIGURING;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECOVERING;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECV_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RESUME_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RESUMING;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILLING;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILL_DRAINED;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILL_ERROR;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_SPILL_OPENED;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_STARTED;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_START_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_STOPPED;
@@ -76,12 +83,16 @@ extern const isc::log::MessageID DHCP_DDNS_REVERSE_REPLACE_RESP_CORRUPT;
 extern const isc::log::MessageID DHCP_DDNS_REV_REQUEST_IGNORED;
 extern const isc::log::MessageID DHCP_DDNS_RUN_EXIT;
 extern const isc::log::MessageID DHCP_DDNS_SHUTDOWN_COMMAND;
+extern const isc::log::MessageID DHCP_DDNS_SPILL_FILE_TRUNCATED;
+extern const isc::log::MessageID DHCP_DDNS_SPILL_SUPERSEDED;
 extern const isc::log::MessageID DHCP_DDNS_STARTED;
 extern const isc::log::MessageID DHCP_DDNS_STARTING_TRANSACTION;
 extern const isc::log::MessageID DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_TRANS_SEND_ERROR;
+extern const isc::log::MessageID DHCP_DDNS_UPDATE_CHANNEL_UNEXPECTED_RESPONSE;
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_REQUEST_SENT;
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_RESPONSE_RECEIVED;
+extern const isc::log::MessageID DHCP_DDNS_UPDATE_RESPONSE_TRUNCATED;
 
 } // namespace d2
 } // namespace isc
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.3.2.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 34 "d2_parser.yy" // lalr1.cc:435
+#line 34 "d2_parser.yy"
 
 #include <d2/parser_context.h>
 
-#line 51 "d2_parser.cc" // lalr1.cc:435
+#line 52 "d2_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if D2_PARSER_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !D2_PARSER_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,57 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "d2_parser.yy" // lalr1.cc:510
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 146 "d2_parser.cc" // lalr1.cc:510
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  D2Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "d2_parser.cc"
 
   /// Build a parser object.
   D2Parser::D2Parser (isc::d2::D2ParserContext& ctx_yyarg)
-    :
 #if D2_PARSER_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -201,9 +160,9 @@ namespace isc { namespace d2 {
   D2Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -233,13 +192,13 @@ namespace isc { namespace d2 {
     : state (s)
   {}
 
-  D2Parser::symbol_number_type
-  D2Parser::by_state::type_get () const YY_NOEXCEPT
+  D2Parser::symbol_kind_type
+  D2Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   D2Parser::stack_symbol_type::stack_symbol_type ()
@@ -248,27 +207,28 @@ namespace isc { namespace d2 {
   D2Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,27 +245,28 @@ namespace isc { namespace d2 {
   D2Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -314,35 +275,73 @@ namespace isc { namespace d2 {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  D2Parser::stack_symbol_type&
+  D2Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   D2Parser::stack_symbol_type&
   D2Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -368,69 +367,73 @@ namespace isc { namespace d2 {
 #if D2_PARSER_DEBUG
   template <typename Base>
   void
-  D2Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  D2Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 56: // "constant string"
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 392 "d2_parser.cc" // lalr1.cc:676
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 388 "d2_parser.cc"
         break;
 
-      case 57: // "integer"
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 398 "d2_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_INTEGER: // "integer"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 394 "d2_parser.cc"
         break;
 
-      case 58: // "floating point"
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < double > (); }
-#line 404 "d2_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 400 "d2_parser.cc"
         break;
 
-      case 59: // "boolean"
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 410 "d2_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 406 "d2_parser.cc"
         break;
 
-      case 71: // value
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 416 "d2_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_value: // value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 412 "d2_parser.cc"
         break;
 
-      case 75: // map_value
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 422 "d2_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_map_value: // map_value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 418 "d2_parser.cc"
         break;
 
-      case 99: // ncr_protocol_value
-#line 115 "d2_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 428 "d2_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 424 "d2_parser.cc"
+        break;
+
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 430 "d2_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -454,7 +457,7 @@ namespace isc { namespace d2 {
   }
 
   void
-  D2Parser::yypop_ (int n)
+  D2Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -489,21 +492,21 @@ namespace isc { namespace d2 {
   D2Parser::state_type
   D2Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  D2Parser::yy_pact_value_is_default_ (int yyvalue)
+  D2Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  D2Parser::yy_table_value_is_error_ (int yyvalue)
+  D2Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -517,7 +520,6 @@ namespace isc { namespace d2 {
   int
   D2Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -553,7 +555,8 @@ namespace isc { namespace d2 {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -567,14 +570,14 @@ namespace isc { namespace d2 {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -593,11 +596,23 @@ namespace isc { namespace d2 {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -614,7 +629,7 @@ namespace isc { namespace d2 {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -622,7 +637,7 @@ namespace isc { namespace d2 {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -641,25 +656,26 @@ namespace isc { namespace d2 {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -683,295 +699,295 @@ namespace isc { namespace d2 {
         {
           switch (yyn)
             {
-  case 2:
-#line 124 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 690 "d2_parser.cc" // lalr1.cc:919
+  case 2: // $@1: %empty
+#line 130 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 706 "d2_parser.cc"
     break;
 
-  case 4:
-#line 125 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 696 "d2_parser.cc" // lalr1.cc:919
+  case 4: // $@2: %empty
+#line 131 "d2_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 712 "d2_parser.cc"
     break;
 
-  case 6:
-#line 126 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DHCPDDNS; }
-#line 702 "d2_parser.cc" // lalr1.cc:919
+  case 6: // $@3: %empty
+#line 132 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.DHCPDDNS; }
+#line 718 "d2_parser.cc"
     break;
 
-  case 8:
-#line 127 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.TSIG_KEY; }
-#line 708 "d2_parser.cc" // lalr1.cc:919
+  case 8: // $@4: %empty
+#line 133 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.TSIG_KEY; }
+#line 724 "d2_parser.cc"
     break;
 
-  case 10:
-#line 128 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.TSIG_KEYS; }
-#line 714 "d2_parser.cc" // lalr1.cc:919
+  case 10: // $@5: %empty
+#line 134 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.TSIG_KEYS; }
+#line 730 "d2_parser.cc"
     break;
 
-  case 12:
-#line 129 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DDNS_DOMAIN; }
-#line 720 "d2_parser.cc" // lalr1.cc:919
+  case 12: // $@6: %empty
+#line 135 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DDNS_DOMAIN; }
+#line 736 "d2_parser.cc"
     break;
 
-  case 14:
-#line 130 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DDNS_DOMAINS; }
-#line 726 "d2_parser.cc" // lalr1.cc:919
+  case 14: // $@7: %empty
+#line 136 "d2_parser.yy"
+                        { ctx.ctx_ = ctx.DDNS_DOMAINS; }
+#line 742 "d2_parser.cc"
     break;
 
-  case 16:
-#line 131 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 732 "d2_parser.cc" // lalr1.cc:919
+  case 16: // $@8: %empty
+#line 137 "d2_parser.yy"
+                      { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 748 "d2_parser.cc"
     break;
 
-  case 18:
-#line 132 "d2_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 738 "d2_parser.cc" // lalr1.cc:919
+  case 18: // $@9: %empty
+#line 138 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 754 "d2_parser.cc"
     break;
 
-  case 20:
-#line 140 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 744 "d2_parser.cc" // lalr1.cc:919
+  case 20: // value: "integer"
+#line 146 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 760 "d2_parser.cc"
     break;
 
-  case 21:
-#line 141 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 750 "d2_parser.cc" // lalr1.cc:919
+  case 21: // value: "floating point"
+#line 147 "d2_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 766 "d2_parser.cc"
     break;
 
-  case 22:
-#line 142 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 756 "d2_parser.cc" // lalr1.cc:919
+  case 22: // value: "boolean"
+#line 148 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 772 "d2_parser.cc"
     break;
 
-  case 23:
-#line 143 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 762 "d2_parser.cc" // lalr1.cc:919
+  case 23: // value: "constant string"
+#line 149 "d2_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 778 "d2_parser.cc"
     break;
 
-  case 24:
-#line 144 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 768 "d2_parser.cc" // lalr1.cc:919
+  case 24: // value: "null"
+#line 150 "d2_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 784 "d2_parser.cc"
     break;
 
-  case 25:
-#line 145 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 774 "d2_parser.cc" // lalr1.cc:919
+  case 25: // value: map2
+#line 151 "d2_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 790 "d2_parser.cc"
     break;
 
-  case 26:
-#line 146 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 780 "d2_parser.cc" // lalr1.cc:919
+  case 26: // value: list_generic
+#line 152 "d2_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 796 "d2_parser.cc"
     break;
 
-  case 27:
-#line 149 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 27: // sub_json: value
+#line 155 "d2_parser.yy"
+                {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 789 "d2_parser.cc" // lalr1.cc:919
+#line 805 "d2_parser.cc"
     break;
 
-  case 28:
-#line 154 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 28: // $@10: %empty
+#line 160 "d2_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 800 "d2_parser.cc" // lalr1.cc:919
+#line 816 "d2_parser.cc"
     break;
 
-  case 29:
-#line 159 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 29: // map2: "{" $@10 map_content "}"
+#line 165 "d2_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 810 "d2_parser.cc" // lalr1.cc:919
+#line 826 "d2_parser.cc"
     break;
 
-  case 30:
-#line 165 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 816 "d2_parser.cc" // lalr1.cc:919
+  case 30: // map_value: map2
+#line 171 "d2_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 832 "d2_parser.cc"
     break;
 
-  case 33:
-#line 172 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 33: // not_empty_map: "constant string" ":" value
+#line 178 "d2_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 825 "d2_parser.cc" // lalr1.cc:919
+#line 841 "d2_parser.cc"
     break;
 
-  case 34:
-#line 176 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 34: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 182 "d2_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 835 "d2_parser.cc" // lalr1.cc:919
+#line 851 "d2_parser.cc"
     break;
 
-  case 35:
-#line 183 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 35: // $@11: %empty
+#line 189 "d2_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 844 "d2_parser.cc" // lalr1.cc:919
+#line 860 "d2_parser.cc"
     break;
 
-  case 36:
-#line 186 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 36: // list_generic: "[" $@11 list_content "]"
+#line 192 "d2_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 852 "d2_parser.cc" // lalr1.cc:919
+#line 868 "d2_parser.cc"
     break;
 
-  case 39:
-#line 194 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 39: // not_empty_list: value
+#line 200 "d2_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 861 "d2_parser.cc" // lalr1.cc:919
+#line 877 "d2_parser.cc"
     break;
 
-  case 40:
-#line 198 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 40: // not_empty_list: not_empty_list "," value
+#line 204 "d2_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 870 "d2_parser.cc" // lalr1.cc:919
+#line 886 "d2_parser.cc"
     break;
 
-  case 41:
-#line 209 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 41: // unknown_map_entry: "constant string" ":"
+#line 215 "d2_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 881 "d2_parser.cc" // lalr1.cc:919
+#line 897 "d2_parser.cc"
     break;
 
-  case 42:
-#line 219 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 42: // $@12: %empty
+#line 225 "d2_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 892 "d2_parser.cc" // lalr1.cc:919
+#line 908 "d2_parser.cc"
     break;
 
-  case 43:
-#line 224 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 43: // syntax_map: "{" $@12 global_objects "}"
+#line 230 "d2_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 902 "d2_parser.cc" // lalr1.cc:919
+#line 918 "d2_parser.cc"
     break;
 
-  case 52:
-#line 246 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 52: // $@13: %empty
+#line 252 "d2_parser.yy"
+                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCPDDNS);
 }
-#line 913 "d2_parser.cc" // lalr1.cc:919
+#line 929 "d2_parser.cc"
     break;
 
-  case 53:
-#line 251 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 53: // dhcpddns_object: "DhcpDdns" $@13 ":" "{" dhcpddns_params "}"
+#line 257 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 922 "d2_parser.cc" // lalr1.cc:919
+#line 938 "d2_parser.cc"
     break;
 
-  case 54:
-#line 256 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 54: // $@14: %empty
+#line 262 "d2_parser.yy"
+                             {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 932 "d2_parser.cc" // lalr1.cc:919
+#line 948 "d2_parser.cc"
     break;
 
-  case 55:
-#line 260 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 55: // sub_dhcpddns: "{" $@14 dhcpddns_params "}"
+#line 266 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 940 "d2_parser.cc" // lalr1.cc:919
+#line 956 "d2_parser.cc"
     break;
 
-  case 70:
-#line 283 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 71: // $@15: %empty
+#line 290 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 948 "d2_parser.cc" // lalr1.cc:919
+#line 964 "d2_parser.cc"
     break;
 
-  case 71:
-#line 285 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 72: // ip_address: "ip-address" $@15 ":" "constant string"
+#line 292 "d2_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 958 "d2_parser.cc" // lalr1.cc:919
+#line 974 "d2_parser.cc"
     break;
 
-  case 72:
-#line 291 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 73: // port: "port" ":" "integer"
+#line 298 "d2_parser.yy"
+                         {
     if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 970 "d2_parser.cc" // lalr1.cc:919
+#line 986 "d2_parser.cc"
     break;
 
-  case 73:
-#line 299 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 74: // dns_server_timeout: "dns-server-timeout" ":" "integer"
+#line 306 "d2_parser.yy"
+                                                     {
     if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
     } else {
@@ -979,67 +995,96 @@ namespace isc { namespace d2 {
         ctx.stack_.back()->set("dns-server-timeout", i);
     }
 }
-#line 983 "d2_parser.cc" // lalr1.cc:919
+#line 999 "d2_parser.cc"
     break;
 
-  case 74:
-#line 308 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 75: // $@16: %empty
+#line 315 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 991 "d2_parser.cc" // lalr1.cc:919
+#line 1007 "d2_parser.cc"
     break;
 
-  case 75:
-#line 310 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 76: // ncr_protocol: "ncr-protocol" $@16 ":" ncr_protocol_value
+#line 317 "d2_parser.yy"
+                           {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1000 "d2_parser.cc" // lalr1.cc:919
+#line 1016 "d2_parser.cc"
     break;
 
-  case 76:
-#line 316 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 1006 "d2_parser.cc" // lalr1.cc:919
+  case 77: // ncr_protocol_value: "UDP"
+#line 323 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 1022 "d2_parser.cc"
     break;
 
-  case 77:
-#line 317 "d2_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 1012 "d2_parser.cc" // lalr1.cc:919
+  case 78: // ncr_protocol_value: "TCP"
+#line 324 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 1028 "d2_parser.cc"
     break;
 
-  case 78:
-#line 320 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 79: // $@17: %empty
+#line 327 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 1020 "d2_parser.cc" // lalr1.cc:919
+#line 1036 "d2_parser.cc"
     break;
 
-  case 79:
-#line 322 "d2_parser.yy" // lalr1.cc:919
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 80: // ncr_format: "ncr-format" $@17 ":" ncr_format_value
+#line 329 "d2_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1030 "d2_parser.cc" // lalr1.cc:919
+#line 1045 "d2_parser.cc"
     break;
 
-  case 80:
-#line 328 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 81: // ncr_format_value: "JSON"
+#line 335 "d2_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 1051 "d2_parser.cc"
+    break;
+
+  case 82: // ncr_format_value: "BINARY"
+#line 336 "d2_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 1057 "d2_parser.cc"
+    break;
+
+  case 83: // $@18: %empty
+#line 339 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1038 "d2_parser.cc" // lalr1.cc:919
+#line 1065 "d2_parser.cc"
     break;
 
-  case 81:
-#line 330 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 84: // spill_file: "spill-file" $@18 ":" "constant string"
+#line 341 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("spill-file", s);
+    ctx.leave();
+}
+#line 1075 "d2_parser.cc"
+    break;
+
+  case 85: // $@19: %empty
+#line 347 "d2_parser.yy"
+                           {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1083 "d2_parser.cc"
+    break;
+
+  case 86: // user_context: "user-context" $@19 ":" map_value
+#line 349 "d2_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -1061,20 +1106,20 @@ namespace isc { namespace d2 {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1065 "d2_parser.cc" // lalr1.cc:919
+#line 1110 "d2_parser.cc"
     break;
 
-  case 82:
-#line 353 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 87: // $@20: %empty
+#line 372 "d2_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1073 "d2_parser.cc" // lalr1.cc:919
+#line 1118 "d2_parser.cc"
     break;
 
-  case 83:
-#line 355 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 88: // comment: "comment" $@20 ":" "constant string"
+#line 374 "d2_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1098,132 +1143,132 @@ namespace isc { namespace d2 {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1102 "d2_parser.cc" // lalr1.cc:919
+#line 1147 "d2_parser.cc"
     break;
 
-  case 84:
-#line 380 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 89: // $@21: %empty
+#line 399 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.FORWARD_DDNS);
 }
-#line 1113 "d2_parser.cc" // lalr1.cc:919
+#line 1158 "d2_parser.cc"
     break;
 
-  case 85:
-#line 385 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 90: // forward_ddns: "forward-ddns" $@21 ":" "{" ddns_mgr_params "}"
+#line 404 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1122 "d2_parser.cc" // lalr1.cc:919
+#line 1167 "d2_parser.cc"
     break;
 
-  case 86:
-#line 390 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 91: // $@22: %empty
+#line 409 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.REVERSE_DDNS);
 }
-#line 1133 "d2_parser.cc" // lalr1.cc:919
+#line 1178 "d2_parser.cc"
     break;
 
-  case 87:
-#line 395 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 92: // reverse_ddns: "reverse-ddns" $@22 ":" "{" ddns_mgr_params "}"
+#line 414 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1142 "d2_parser.cc" // lalr1.cc:919
+#line 1187 "d2_parser.cc"
     break;
 
-  case 94:
-#line 414 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 99: // $@23: %empty
+#line 433 "d2_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DDNS_DOMAINS);
 }
-#line 1153 "d2_parser.cc" // lalr1.cc:919
+#line 1198 "d2_parser.cc"
     break;
 
-  case 95:
-#line 419 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 100: // ddns_domains: "ddns-domains" $@23 ":" "[" ddns_domain_list "]"
+#line 438 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1162 "d2_parser.cc" // lalr1.cc:919
+#line 1207 "d2_parser.cc"
     break;
 
-  case 96:
-#line 424 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 101: // $@24: %empty
+#line 443 "d2_parser.yy"
+                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1171 "d2_parser.cc" // lalr1.cc:919
+#line 1216 "d2_parser.cc"
     break;
 
-  case 97:
-#line 427 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 102: // sub_ddns_domains: "[" $@24 ddns_domain_list "]"
+#line 446 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1179 "d2_parser.cc" // lalr1.cc:919
+#line 1224 "d2_parser.cc"
     break;
 
-  case 102:
-#line 439 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 107: // $@25: %empty
+#line 458 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1189 "d2_parser.cc" // lalr1.cc:919
+#line 1234 "d2_parser.cc"
     break;
 
-  case 103:
-#line 443 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 108: // ddns_domain: "{" $@25 ddns_domain_params "}"
+#line 462 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1197 "d2_parser.cc" // lalr1.cc:919
+#line 1242 "d2_parser.cc"
     break;
 
-  case 104:
-#line 447 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 109: // $@26: %empty
+#line 466 "d2_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1206 "d2_parser.cc" // lalr1.cc:919
+#line 1251 "d2_parser.cc"
     break;
 
-  case 105:
-#line 450 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 110: // sub_ddns_domain: "{" $@26 ddns_domain_params "}"
+#line 469 "d2_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1214 "d2_parser.cc" // lalr1.cc:919
+#line 1259 "d2_parser.cc"
     break;
 
-  case 114:
-#line 467 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 119: // $@27: %empty
+#line 486 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1222 "d2_parser.cc" // lalr1.cc:919
+#line 1267 "d2_parser.cc"
     break;
 
-  case 115:
-#line 469 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 120: // ddns_domain_name: "name" $@27 ":" "constant string"
+#line 488 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
     }
@@ -1232,111 +1277,111 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1236 "d2_parser.cc" // lalr1.cc:919
+#line 1281 "d2_parser.cc"
     break;
 
-  case 116:
-#line 479 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 121: // $@28: %empty
+#line 498 "d2_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1244 "d2_parser.cc" // lalr1.cc:919
+#line 1289 "d2_parser.cc"
     break;
 
-  case 117:
-#line 481 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 122: // ddns_domain_key_name: "key-name" $@28 ":" "constant string"
+#line 500 "d2_parser.yy"
+               {
     ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("key-name", name);
     ctx.leave();
 }
-#line 1255 "d2_parser.cc" // lalr1.cc:919
+#line 1300 "d2_parser.cc"
     break;
 
-  case 118:
-#line 491 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 123: // $@29: %empty
+#line 510 "d2_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DNS_SERVERS);
 }
-#line 1266 "d2_parser.cc" // lalr1.cc:919
+#line 1311 "d2_parser.cc"
     break;
 
-  case 119:
-#line 496 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 124: // dns_servers: "dns-servers" $@29 ":" "[" dns_server_list "]"
+#line 515 "d2_parser.yy"
+                                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1275 "d2_parser.cc" // lalr1.cc:919
+#line 1320 "d2_parser.cc"
     break;
 
-  case 120:
-#line 501 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 125: // $@30: %empty
+#line 520 "d2_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1284 "d2_parser.cc" // lalr1.cc:919
+#line 1329 "d2_parser.cc"
     break;
 
-  case 121:
-#line 504 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 126: // sub_dns_servers: "[" $@30 dns_server_list "]"
+#line 523 "d2_parser.yy"
+                                  {
     // parsing completed
 }
-#line 1292 "d2_parser.cc" // lalr1.cc:919
+#line 1337 "d2_parser.cc"
     break;
 
-  case 124:
-#line 512 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 129: // $@31: %empty
+#line 531 "d2_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1302 "d2_parser.cc" // lalr1.cc:919
+#line 1347 "d2_parser.cc"
     break;
 
-  case 125:
-#line 516 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 130: // dns_server: "{" $@31 dns_server_params "}"
+#line 535 "d2_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1310 "d2_parser.cc" // lalr1.cc:919
+#line 1355 "d2_parser.cc"
     break;
 
-  case 126:
-#line 520 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 131: // $@32: %empty
+#line 539 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1319 "d2_parser.cc" // lalr1.cc:919
+#line 1364 "d2_parser.cc"
     break;
 
-  case 127:
-#line 523 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 132: // sub_dns_server: "{" $@32 dns_server_params "}"
+#line 542 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1327 "d2_parser.cc" // lalr1.cc:919
+#line 1372 "d2_parser.cc"
     break;
 
-  case 136:
-#line 539 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 141: // $@33: %empty
+#line 558 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1335 "d2_parser.cc" // lalr1.cc:919
+#line 1380 "d2_parser.cc"
     break;
 
-  case 137:
-#line 541 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 142: // dns_server_hostname: "hostname" $@33 ":" "constant string"
+#line 560 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
     }
@@ -1345,123 +1390,123 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("hostname", name);
     ctx.leave();
 }
-#line 1349 "d2_parser.cc" // lalr1.cc:919
+#line 1394 "d2_parser.cc"
     break;
 
-  case 138:
-#line 551 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 143: // $@34: %empty
+#line 570 "d2_parser.yy"
+                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1357 "d2_parser.cc" // lalr1.cc:919
+#line 1402 "d2_parser.cc"
     break;
 
-  case 139:
-#line 553 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 144: // dns_server_ip_address: "ip-address" $@34 ":" "constant string"
+#line 572 "d2_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 1367 "d2_parser.cc" // lalr1.cc:919
+#line 1412 "d2_parser.cc"
     break;
 
-  case 140:
-#line 559 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 145: // dns_server_port: "port" ":" "integer"
+#line 578 "d2_parser.yy"
+                                    {
     if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 1379 "d2_parser.cc" // lalr1.cc:919
+#line 1424 "d2_parser.cc"
     break;
 
-  case 141:
-#line 573 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 146: // $@35: %empty
+#line 592 "d2_parser.yy"
+                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1390 "d2_parser.cc" // lalr1.cc:919
+#line 1435 "d2_parser.cc"
     break;
 
-  case 142:
-#line 578 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 147: // tsig_keys: "tsig-keys" $@35 ":" "[" tsig_keys_list "]"
+#line 597 "d2_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1399 "d2_parser.cc" // lalr1.cc:919
+#line 1444 "d2_parser.cc"
     break;
 
-  case 143:
-#line 583 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 148: // $@36: %empty
+#line 602 "d2_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1408 "d2_parser.cc" // lalr1.cc:919
+#line 1453 "d2_parser.cc"
     break;
 
-  case 144:
-#line 586 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 149: // sub_tsig_keys: "[" $@36 tsig_keys_list "]"
+#line 605 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1416 "d2_parser.cc" // lalr1.cc:919
+#line 1461 "d2_parser.cc"
     break;
 
-  case 149:
-#line 598 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 154: // $@37: %empty
+#line 617 "d2_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1426 "d2_parser.cc" // lalr1.cc:919
+#line 1471 "d2_parser.cc"
     break;
 
-  case 150:
-#line 602 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 155: // tsig_key: "{" $@37 tsig_key_params "}"
+#line 621 "d2_parser.yy"
+                                 {
     ctx.stack_.pop_back();
 }
-#line 1434 "d2_parser.cc" // lalr1.cc:919
+#line 1479 "d2_parser.cc"
     break;
 
-  case 151:
-#line 606 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 156: // $@38: %empty
+#line 625 "d2_parser.yy"
+                             {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1444 "d2_parser.cc" // lalr1.cc:919
+#line 1489 "d2_parser.cc"
     break;
 
-  case 152:
-#line 610 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 157: // sub_tsig_key: "{" $@38 tsig_key_params "}"
+#line 629 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1452 "d2_parser.cc" // lalr1.cc:919
+#line 1497 "d2_parser.cc"
     break;
 
-  case 162:
-#line 628 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 167: // $@39: %empty
+#line 647 "d2_parser.yy"
+                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1460 "d2_parser.cc" // lalr1.cc:919
+#line 1505 "d2_parser.cc"
     break;
 
-  case 163:
-#line 630 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 168: // tsig_key_name: "name" $@39 ":" "constant string"
+#line 649 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
     }
@@ -1470,20 +1515,20 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1474 "d2_parser.cc" // lalr1.cc:919
+#line 1519 "d2_parser.cc"
     break;
 
-  case 164:
-#line 640 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 169: // $@40: %empty
+#line 659 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1482 "d2_parser.cc" // lalr1.cc:919
+#line 1527 "d2_parser.cc"
     break;
 
-  case 165:
-#line 642 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 170: // tsig_key_algorithm: "algorithm" $@40 ":" "constant string"
+#line 661 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
     }
@@ -1491,32 +1536,32 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1495 "d2_parser.cc" // lalr1.cc:919
+#line 1540 "d2_parser.cc"
     break;
 
-  case 166:
-#line 651 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 171: // tsig_key_digest_bits: "digest-bits" ":" "integer"
+#line 670 "d2_parser.yy"
+                                                {
     if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
     }
     ElementPtr elem(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1507 "d2_parser.cc" // lalr1.cc:919
+#line 1552 "d2_parser.cc"
     break;
 
-  case 167:
-#line 659 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 172: // $@41: %empty
+#line 678 "d2_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1515 "d2_parser.cc" // lalr1.cc:919
+#line 1560 "d2_parser.cc"
     break;
 
-  case 168:
-#line 661 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 173: // tsig_key_secret: "secret" $@41 ":" "constant string"
+#line 680 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
     }
@@ -1524,304 +1569,341 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1528 "d2_parser.cc" // lalr1.cc:919
+#line 1573 "d2_parser.cc"
     break;
 
-  case 169:
-#line 675 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 174: // $@42: %empty
+#line 694 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 1539 "d2_parser.cc" // lalr1.cc:919
+#line 1584 "d2_parser.cc"
     break;
 
-  case 170:
-#line 680 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 175: // control_socket: "control-socket" $@42 ":" "{" control_socket_params "}"
+#line 699 "d2_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1548 "d2_parser.cc" // lalr1.cc:919
+#line 1593 "d2_parser.cc"
     break;
 
-  case 178:
-#line 696 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 183: // $@43: %empty
+#line 715 "d2_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1556 "d2_parser.cc" // lalr1.cc:919
+#line 1601 "d2_parser.cc"
     break;
 
-  case 179:
-#line 698 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 184: // control_socket_type: "socket-type" $@43 ":" "constant string"
+#line 717 "d2_parser.yy"
+               {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 1566 "d2_parser.cc" // lalr1.cc:919
+#line 1611 "d2_parser.cc"
     break;
 
-  case 180:
-#line 704 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 185: // $@44: %empty
+#line 723 "d2_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1574 "d2_parser.cc" // lalr1.cc:919
+#line 1619 "d2_parser.cc"
     break;
 
-  case 181:
-#line 706 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 186: // control_socket_name: "socket-name" $@44 ":" "constant string"
+#line 725 "d2_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1584 "d2_parser.cc" // lalr1.cc:919
+#line 1629 "d2_parser.cc"
     break;
 
-  case 182:
-#line 714 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 187: // $@45: %empty
+#line 733 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1592 "d2_parser.cc" // lalr1.cc:919
+#line 1637 "d2_parser.cc"
     break;
 
-  case 183:
-#line 716 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 188: // dhcp6_json_object: "Dhcp6" $@45 ":" value
+#line 735 "d2_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1601 "d2_parser.cc" // lalr1.cc:919
+#line 1646 "d2_parser.cc"
     break;
 
-  case 184:
-#line 721 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 189: // $@46: %empty
+#line 740 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1609 "d2_parser.cc" // lalr1.cc:919
+#line 1654 "d2_parser.cc"
     break;
 
-  case 185:
-#line 723 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 190: // dhcp4_json_object: "Dhcp4" $@46 ":" value
+#line 742 "d2_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1618 "d2_parser.cc" // lalr1.cc:919
+#line 1663 "d2_parser.cc"
     break;
 
-  case 186:
-#line 728 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 191: // $@47: %empty
+#line 747 "d2_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1626 "d2_parser.cc" // lalr1.cc:919
+#line 1671 "d2_parser.cc"
     break;
 
-  case 187:
-#line 730 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 192: // control_agent_json_object: "Control-agent" $@47 ":" value
+#line 749 "d2_parser.yy"
+              {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1635 "d2_parser.cc" // lalr1.cc:919
+#line 1680 "d2_parser.cc"
     break;
 
-  case 188:
-#line 740 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 193: // $@48: %empty
+#line 759 "d2_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1646 "d2_parser.cc" // lalr1.cc:919
+#line 1691 "d2_parser.cc"
     break;
 
-  case 189:
-#line 745 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 194: // logging_object: "Logging" $@48 ":" "{" logging_params "}"
+#line 764 "d2_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1655 "d2_parser.cc" // lalr1.cc:919
+#line 1700 "d2_parser.cc"
     break;
 
-  case 193:
-#line 762 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 198: // $@49: %empty
+#line 781 "d2_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1666 "d2_parser.cc" // lalr1.cc:919
+#line 1711 "d2_parser.cc"
     break;
 
-  case 194:
-#line 767 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 199: // loggers: "loggers" $@49 ":" "[" loggers_entries "]"
+#line 786 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1675 "d2_parser.cc" // lalr1.cc:919
+#line 1720 "d2_parser.cc"
     break;
 
-  case 197:
-#line 779 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 202: // $@50: %empty
+#line 798 "d2_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1685 "d2_parser.cc" // lalr1.cc:919
+#line 1730 "d2_parser.cc"
     break;
 
-  case 198:
-#line 783 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 203: // logger_entry: "{" $@50 logger_params "}"
+#line 802 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1693 "d2_parser.cc" // lalr1.cc:919
+#line 1738 "d2_parser.cc"
     break;
 
-  case 208:
-#line 800 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 213: // $@51: %empty
+#line 819 "d2_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1701 "d2_parser.cc" // lalr1.cc:919
+#line 1746 "d2_parser.cc"
     break;
 
-  case 209:
-#line 802 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 214: // name: "name" $@51 ":" "constant string"
+#line 821 "d2_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1711 "d2_parser.cc" // lalr1.cc:919
+#line 1756 "d2_parser.cc"
     break;
 
-  case 210:
-#line 808 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 215: // debuglevel: "debuglevel" ":" "integer"
+#line 827 "d2_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1720 "d2_parser.cc" // lalr1.cc:919
+#line 1765 "d2_parser.cc"
     break;
 
-  case 211:
-#line 812 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 216: // $@52: %empty
+#line 831 "d2_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1728 "d2_parser.cc" // lalr1.cc:919
+#line 1773 "d2_parser.cc"
     break;
 
-  case 212:
-#line 814 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 217: // severity: "severity" $@52 ":" "constant string"
+#line 833 "d2_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1738 "d2_parser.cc" // lalr1.cc:919
+#line 1783 "d2_parser.cc"
     break;
 
-  case 213:
-#line 820 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 218: // $@53: %empty
+#line 839 "d2_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1749 "d2_parser.cc" // lalr1.cc:919
+#line 1794 "d2_parser.cc"
     break;
 
-  case 214:
-#line 825 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 219: // output_options_list: "output_options" $@53 ":" "[" output_options_list_content "]"
+#line 844 "d2_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1758 "d2_parser.cc" // lalr1.cc:919
+#line 1803 "d2_parser.cc"
     break;
 
-  case 217:
-#line 834 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 222: // $@54: %empty
+#line 853 "d2_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1768 "d2_parser.cc" // lalr1.cc:919
+#line 1813 "d2_parser.cc"
     break;
 
-  case 218:
-#line 838 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 223: // output_entry: "{" $@54 output_params_list "}"
+#line 857 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1776 "d2_parser.cc" // lalr1.cc:919
+#line 1821 "d2_parser.cc"
     break;
 
-  case 225:
-#line 852 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 233: // $@55: %empty
+#line 874 "d2_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1784 "d2_parser.cc" // lalr1.cc:919
+#line 1829 "d2_parser.cc"
     break;
 
-  case 226:
-#line 854 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 234: // output: "output" $@55 ":" "constant string"
+#line 876 "d2_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1794 "d2_parser.cc" // lalr1.cc:919
+#line 1839 "d2_parser.cc"
     break;
 
-  case 227:
-#line 860 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 235: // flush: "flush" ":" "boolean"
+#line 882 "d2_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1803 "d2_parser.cc" // lalr1.cc:919
+#line 1848 "d2_parser.cc"
     break;
 
-  case 228:
-#line 865 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 236: // maxsize: "maxsize" ":" "integer"
+#line 887 "d2_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1812 "d2_parser.cc" // lalr1.cc:919
+#line 1857 "d2_parser.cc"
     break;
 
-  case 229:
-#line 870 "d2_parser.yy" // lalr1.cc:919
-    {
+  case 237: // maxver: "maxver" ":" "integer"
+#line 892 "d2_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1821 "d2_parser.cc" // lalr1.cc:919
+#line 1866 "d2_parser.cc"
     break;
 
+  case 238: // async: "async" ":" "boolean"
+#line 897 "d2_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1875 "d2_parser.cc"
+    break;
+
+  case 239: // queue_size: "queue-size" ":" "integer"
+#line 902 "d2_parser.yy"
+                                     {
+    ElementPtr queue_size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+#line 1884 "d2_parser.cc"
+    break;
+
+  case 240: // $@56: %empty
+#line 907 "d2_parser.yy"
+                          {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1892 "d2_parser.cc"
+    break;
+
+  case 241: // overflow: "overflow" $@56 ":" "constant string"
+#line 909 "d2_parser.yy"
+               {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+#line 1902 "d2_parser.cc"
+    break;
+
+
+#line 1906 "d2_parser.cc"
 
-#line 1825 "d2_parser.cc" // lalr1.cc:919
             default:
               break;
             }
@@ -1837,7 +1919,6 @@ namespace isc { namespace d2 {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -1853,7 +1934,9 @@ namespace isc { namespace d2 {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1864,7 +1947,7 @@ namespace isc { namespace d2 {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1890,6 +1973,7 @@ namespace isc { namespace d2 {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -1898,37 +1982,39 @@ namespace isc { namespace d2 {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -1960,6 +2046,7 @@ namespace isc { namespace d2 {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1993,18 +2080,103 @@ namespace isc { namespace d2 {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  D2Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  D2Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  D2Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
 
+
+
+  // D2Parser::context.
+  D2Parser::context::context (const D2Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  D2Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  D2Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -2023,41 +2195,32 @@ namespace isc { namespace d2 {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  D2Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -2078,11 +2241,11 @@ namespace isc { namespace d2 {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -2091,52 +2254,54 @@ namespace isc { namespace d2 {
   }
 
 
-  const signed char D2Parser::yypact_ninf_ = -92;
+  const signed char D2Parser::yypact_ninf_ = -95;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
   const short
   D2Parser::yypact_[] =
   {
-      50,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-      12,     2,     1,    23,    42,    11,    44,    17,    59,    65,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,     2,    18,
-       8,     9,    15,    87,    40,    99,    13,   100,   -92,   102,
-     122,   129,   118,   131,   -92,   -92,   -92,   -92,   -92,   137,
-     -92,    49,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   139,
-     147,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-      78,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   157,   -92,   -92,   -92,   -92,   -92,
-      79,   -92,   -92,   -92,   -92,   -92,   -92,   164,   132,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,    85,   -92,   -92,   -92,
-     -92,   -92,   167,   150,   -92,   -92,   158,   -92,   -92,   -92,
-     -92,   106,   -92,   -92,   -92,   -92,   -92,    47,   -92,   -92,
-       2,     2,   -92,   107,   170,   171,   172,   173,   174,   -92,
-       8,   -92,   175,   123,   125,   177,   179,   180,   181,   182,
-     183,   184,   185,     9,   -92,   186,   134,   188,   189,    15,
-     -92,    15,   -92,    87,   190,   191,   192,    40,   -92,    40,
-     -92,    99,   193,   141,   195,    13,   -92,    13,   100,   -92,
-     -92,   -92,   196,     2,     2,     2,   194,   201,   -92,   153,
-     -92,   -92,    22,   198,   203,   155,   205,   206,   209,   208,
-     -92,   160,   -92,   161,   168,   -92,   112,   -92,   169,   215,
-     176,   -92,   113,   -92,   178,   -92,   187,   -92,   114,   -92,
-       2,   -92,   -92,   -92,     9,   197,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -12,   -12,    87,    55,   -92,   -92,
-     -92,   -92,   -92,   100,   -92,   -92,   -92,   -92,   -92,   -92,
-     115,   -92,   116,   -92,   -92,   -92,   -92,   124,   -92,   -92,
-     -92,   146,   216,   -92,   -92,   -92,   -92,   -92,   149,   -92,
-     -92,   -92,    89,   -92,   199,   197,   -92,   217,   -12,   -92,
-     -92,   -92,   219,   222,    55,   -92,   -92,   223,   -92,   224,
-     -92,   200,   202,   -92,   220,    99,   -92,   -92,   -92,   165,
-     -92,   225,    33,   220,   -92,   -92,   -92,   -92,   226,   -92,
-     -92,   -92,   -92,   152,   -92,   -92,   -92,   -92,   -92,   -92,
-     229,   232,   204,   233,    33,   -92,   207,   234,   -92,   210,
-     -92,   -92,   231,   -92,   -92,   166,   -92,    39,   231,   -92,
-     -92,   236,   237,   238,   156,   -92,   -92,   -92,   -92,   -92,
-     -92,   240,   211,   212,   218,    39,   -92,   221,   -92,   -92,
-     -92,   -92,   -92
+      33,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+      12,     2,     1,     7,    24,    11,    25,    37,    44,    57,
+     -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,     2,    10,
+       8,     9,    15,    68,    43,    72,    13,   129,   -95,   138,
+     124,   142,   146,   153,   -95,   -95,   -95,   -95,   -95,   154,
+     -95,    49,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   167,
+     168,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,    50,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95,   -95,   -95,   -95,   169,   -95,   -95,   -95,
+     -95,   -95,    51,   -95,   -95,   -95,   -95,   -95,   -95,   170,
+     171,   -95,   -95,   -95,   -95,   -95,   -95,   -95,    91,   -95,
+     -95,   -95,   -95,   -95,   172,   174,   -95,   -95,   175,   -95,
+     -95,   -95,   -95,    95,   -95,   -95,   -95,   -95,   -95,    40,
+     -95,   -95,     2,     2,   -95,   119,   177,   178,   179,   180,
+     181,   -95,     8,   -95,   182,   113,   125,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,     9,   -95,   193,   136,
+     195,   196,    15,   -95,    15,   -95,    68,   197,   198,   199,
+      43,   -95,    43,   -95,    72,   200,   143,   203,    13,   -95,
+      13,   129,   -95,   -95,   -95,   204,     2,     2,     2,   202,
+     208,   -95,   155,   -95,   -95,    82,   115,   156,   211,   158,
+     213,   214,   205,   215,   -95,   162,   -95,   163,   165,   -95,
+     108,   -95,   166,   223,   173,   -95,   110,   -95,   176,   -95,
+     183,   -95,   114,   -95,     2,   -95,   -95,   -95,     9,   201,
+     -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,    -6,    -6,    68,    58,   -95,   -95,   -95,   -95,   -95,
+     129,   -95,   -95,   -95,   -95,   -95,   -95,   117,   -95,   118,
+     -95,   -95,   -95,   -95,   120,   -95,   -95,   -95,   121,   224,
+     -95,   -95,   -95,   -95,   -95,   127,   -95,   -95,   -95,   159,
+     -95,   225,   201,   -95,   227,    -6,   -95,   -95,   -95,   228,
+     229,    58,   -95,   -95,   230,   -95,   231,   -95,   206,   207,
+     -95,   232,    72,   -95,   -95,   -95,   160,   -95,   234,    36,
+     232,   -95,   -95,   -95,   -95,   238,   -95,   -95,   -95,   -95,
+     149,   -95,   -95,   -95,   -95,   -95,   -95,   239,   241,   194,
+     242,    36,   -95,   209,   233,   -95,   210,   -95,   -95,   240,
+     -95,   -95,   161,   -95,    59,   240,   -95,   -95,   244,   245,
+     246,   247,   248,   -95,   152,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95,   -95,   249,   212,   218,   219,   220,   221,
+     250,    59,   -95,   216,   -95,   -95,   -95,   -95,   -95,   226,
+     -95,   -95,   -95
   };
 
   const unsigned char
@@ -2145,229 +2310,239 @@ namespace isc { namespace d2 {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    35,    28,    24,    23,    20,    21,    22,    27,     3,
-      25,    26,    42,     5,    54,     7,   151,     9,   143,    11,
-     104,    13,    96,    15,   126,    17,   120,    19,    37,    31,
-       0,     0,     0,   145,     0,    98,     0,     0,    39,     0,
-      38,     0,     0,    32,   182,   184,   186,    52,   188,     0,
-      51,     0,    44,    49,    46,    48,    50,    47,    70,     0,
-       0,    74,    78,    80,    82,    84,    86,   141,   169,    69,
-       0,    56,    58,    59,    60,    61,    62,    67,    68,    63,
-      64,    65,    66,   164,     0,   167,   162,   161,   159,   160,
-       0,   153,   155,   156,   157,   158,   149,     0,   146,   147,
-     116,   118,   114,   113,   111,   112,     0,   106,   108,   109,
-     110,   102,     0,    99,   100,   138,     0,   136,   135,   133,
-     134,     0,   128,   130,   131,   132,   124,     0,   122,    36,
-       0,     0,    29,     0,     0,     0,     0,     0,     0,    41,
-       0,    43,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    55,     0,     0,     0,     0,     0,
-     152,     0,   144,     0,     0,     0,     0,     0,   105,     0,
-      97,     0,     0,     0,     0,     0,   127,     0,     0,   121,
-      40,    33,     0,     0,     0,     0,     0,     0,    45,     0,
-      72,    73,     0,     0,     0,     0,     0,     0,     0,     0,
-      57,     0,   166,     0,     0,   154,     0,   148,     0,     0,
-       0,   107,     0,   101,     0,   140,     0,   129,     0,   123,
-       0,   183,   185,   187,     0,     0,    71,    76,    77,    75,
-      79,    30,    81,    83,    88,    88,   145,     0,   165,   168,
-     163,   150,   117,     0,   115,   103,   139,   137,   125,    34,
-       0,   193,     0,   190,   192,    94,    93,     0,    89,    90,
-      92,     0,     0,   178,   180,   177,   175,   176,     0,   171,
-     173,   174,     0,    53,     0,     0,   189,     0,     0,    85,
-      87,   142,     0,     0,     0,   170,   119,     0,   191,     0,
-      91,     0,     0,   172,     0,    98,   179,   181,   197,     0,
-     195,     0,     0,     0,   194,    95,   208,   213,     0,   211,
-     207,   205,   206,     0,   199,   201,   203,   204,   202,   196,
-       0,     0,     0,     0,     0,   198,     0,     0,   210,     0,
-     200,   209,     0,   212,   217,     0,   215,     0,     0,   214,
-     225,     0,     0,     0,     0,   219,   221,   222,   223,   224,
-     216,     0,     0,     0,     0,     0,   218,     0,   227,   228,
-     229,   220,   226
+      25,    26,    42,     5,    54,     7,   156,     9,   148,    11,
+     109,    13,   101,    15,   131,    17,   125,    19,    37,    31,
+       0,     0,     0,   150,     0,   103,     0,     0,    39,     0,
+      38,     0,     0,    32,   187,   189,   191,    52,   193,     0,
+      51,     0,    44,    49,    46,    48,    50,    47,    71,     0,
+       0,    75,    79,    83,    85,    87,    89,    91,   146,   174,
+      70,     0,    56,    58,    59,    60,    61,    62,    63,    68,
+      69,    64,    65,    66,    67,   169,     0,   172,   167,   166,
+     164,   165,     0,   158,   160,   161,   162,   163,   154,     0,
+     151,   152,   121,   123,   119,   118,   116,   117,     0,   111,
+     113,   114,   115,   107,     0,   104,   105,   143,     0,   141,
+     140,   138,   139,     0,   133,   135,   136,   137,   129,     0,
+     127,    36,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,    41,     0,    43,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    55,     0,     0,
+       0,     0,     0,   157,     0,   149,     0,     0,     0,     0,
+       0,   110,     0,   102,     0,     0,     0,     0,     0,   132,
+       0,     0,   126,    40,    33,     0,     0,     0,     0,     0,
+       0,    45,     0,    73,    74,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    57,     0,   171,     0,     0,   159,
+       0,   153,     0,     0,     0,   112,     0,   106,     0,   145,
+       0,   134,     0,   128,     0,   188,   190,   192,     0,     0,
+      72,    77,    78,    76,    81,    82,    80,    84,    30,    86,
+      88,    93,    93,   150,     0,   170,   173,   168,   155,   122,
+       0,   120,   108,   144,   142,   130,    34,     0,   198,     0,
+     195,   197,    99,    98,     0,    94,    95,    97,     0,     0,
+     183,   185,   182,   180,   181,     0,   176,   178,   179,     0,
+      53,     0,     0,   194,     0,     0,    90,    92,   147,     0,
+       0,     0,   175,   124,     0,   196,     0,    96,     0,     0,
+     177,     0,   103,   184,   186,   202,     0,   200,     0,     0,
+       0,   199,   100,   213,   218,     0,   216,   212,   210,   211,
+       0,   204,   206,   208,   209,   207,   201,     0,     0,     0,
+       0,     0,   203,     0,     0,   215,     0,   205,   214,     0,
+     217,   222,     0,   220,     0,     0,   219,   233,     0,     0,
+       0,     0,     0,   240,     0,   224,   226,   227,   228,   229,
+     230,   231,   232,   221,     0,     0,     0,     0,     0,     0,
+       0,     0,   223,     0,   235,   236,   237,   238,   239,     0,
+     225,   234,   241
   };
 
   const signed char
   D2Parser::yypgoto_[] =
   {
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -38,   -92,    31,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -50,   -92,   -92,   -92,    86,   -92,   -92,   -92,
-     -92,     3,    76,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -51,   -92,   -39,   -92,   -92,   -92,   -92,   -92,
-      -5,   -92,   -47,   -92,   -92,   -92,   -92,   -63,   -92,    64,
-     -92,   -92,   -92,    68,    72,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,    -3,    66,   -92,   -92,   -92,    70,    67,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,    20,
-     -92,    90,   -92,   -92,   -92,    93,   101,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -36,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -17,   -92,   -92,   -92,   -44,   -92,   -92,   -62,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -77,   -92,   -92,
-     -91,   -92,   -92,   -92,   -92,   -92
+     -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -38,   -95,    39,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -50,   -95,   -95,   -95,    96,   -95,   -95,   -95,
+     -95,    14,    83,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95,   -95,   -95,   -51,   -95,   -39,   -95,   -95,
+     -95,   -95,   -95,     3,   -95,   -42,   -95,   -95,   -95,   -95,
+     -58,   -95,    75,   -95,   -95,   -95,    74,    84,   -95,   -95,
+     -95,   -95,   -95,   -95,   -95,   -95,     5,    81,   -95,   -95,
+     -95,    73,    87,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,    23,   -95,   102,   -95,   -95,   -95,   105,   109,
+     -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -19,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95,   -95,    -9,   -95,   -95,   -95,   -36,   -95,
+     -95,   -56,   -95,   -95,   -95,   -95,   -95,   -95,   -95,   -95,
+     -69,   -95,   -95,   -94,   -95,   -95,   -95,   -95,   -95,   -95,
+     -95,   -95,   -95
   };
 
   const short
   D2Parser::yydefgoto_[] =
   {
-      -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    28,    29,    30,    49,   252,    62,    63,    31,    48,
-      59,    60,    89,    33,    50,    71,    72,    73,   157,    35,
-      51,    90,    91,    92,   162,    93,    94,    95,   165,   249,
-      96,   166,    97,   167,    98,   168,    99,   169,   100,   170,
-     277,   278,   279,   280,   297,    43,    55,   132,   133,   134,
-     189,    41,    54,   126,   127,   128,   186,   129,   184,   130,
-     185,    47,    57,   147,   148,   197,    45,    56,   141,   142,
-     143,   194,   144,   192,   145,   101,   171,    39,    53,   117,
-     118,   119,   181,    37,    52,   110,   111,   112,   178,   113,
-     175,   114,   115,   177,   102,   172,   288,   289,   290,   302,
-     291,   303,    74,   154,    75,   155,    76,   156,    77,   158,
-     272,   273,   274,   294,   319,   320,   322,   333,   334,   335,
-     340,   336,   337,   343,   338,   341,   355,   356,   357,   364,
-     365,   366,   371,   367,   368,   369
+       0,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    28,    29,    30,    49,   259,    62,    63,    31,    48,
+      59,    60,    90,    33,    50,    71,    72,    73,   159,    35,
+      51,    91,    92,    93,   164,    94,    95,    96,   167,   253,
+      97,   168,   256,    98,   169,    99,   170,   100,   171,   101,
+     172,   102,   173,   284,   285,   286,   287,   304,    43,    55,
+     134,   135,   136,   192,    41,    54,   128,   129,   130,   189,
+     131,   187,   132,   188,    47,    57,   149,   150,   200,    45,
+      56,   143,   144,   145,   197,   146,   195,   147,   103,   174,
+      39,    53,   119,   120,   121,   184,    37,    52,   112,   113,
+     114,   181,   115,   178,   116,   117,   180,   104,   175,   295,
+     296,   297,   309,   298,   310,    74,   156,    75,   157,    76,
+     158,    77,   160,   279,   280,   281,   301,   326,   327,   329,
+     340,   341,   342,   347,   343,   344,   350,   345,   348,   362,
+     363,   364,   374,   375,   376,   384,   377,   378,   379,   380,
+     381,   382,   390
   };
 
-  const unsigned short
+  const short
   D2Parser::yytable_[] =
   {
-      70,   108,   107,   124,   123,   139,   138,    21,    32,    22,
-      58,    23,    20,   109,   275,   125,    38,   140,    64,    65,
-      66,    67,    42,    78,    79,    80,    81,   135,   136,    82,
-      34,    83,    84,    85,    86,    83,    84,    83,    84,    87,
-     247,   248,   137,    88,    69,    68,   103,   104,   105,    36,
-     198,    40,   160,   199,   106,    83,    84,   161,    24,    25,
-      26,    27,    83,    84,    69,    69,    44,   120,   121,    69,
-      46,    69,   326,   327,    61,   328,   329,    83,    84,   122,
-     360,   173,   179,   361,   362,   363,   174,   180,   187,    69,
-     283,   284,   198,   188,   116,   306,    69,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,   131,   146,   149,   195,
-      70,    69,   200,   201,   196,   179,   187,   195,   173,   295,
-     261,   265,   268,   293,   296,   150,   152,   298,   108,   107,
-     108,   107,   299,   151,   153,   183,   124,   123,   124,   123,
-     109,   159,   109,   163,   139,   138,   139,   138,   125,   298,
-     125,   164,   304,   191,   300,   344,   140,   305,   140,   375,
-     345,   176,   193,   202,   376,   241,   242,   243,   323,   358,
-     182,   324,   359,   190,   203,   204,   205,   206,   207,   209,
-     210,   212,   211,   213,   214,   215,   216,   217,   218,   219,
-     221,   222,   223,   224,   228,   229,   230,   234,   235,   236,
-     240,   244,   269,   307,   276,   276,   286,   285,   245,   246,
-      22,   253,   254,   255,   256,   257,   258,   259,   287,   250,
-     263,   309,   301,   311,   260,   262,   312,   318,   314,   315,
-     342,   325,   264,   346,   266,   271,   347,   349,   354,   352,
-     372,   373,   374,   267,   377,   251,   208,   270,   276,   220,
-     281,   310,   321,   286,   285,   233,   316,   232,   317,   231,
-     292,   348,   237,   351,   239,   287,   353,   238,   313,   379,
-     378,   331,   330,   227,   226,   380,   282,   382,   308,   339,
-     225,   370,   350,   332,   381,     0,     0,     0,     0,     0,
-       0,     0,     0,   331,   330,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   332
+      70,   110,   109,   126,   125,   141,   140,    21,    32,    22,
+      58,    23,    20,   111,    34,   127,    38,   142,    64,    65,
+      66,    67,   282,    78,    79,    80,    81,   137,   138,    82,
+      83,    36,    40,    84,    85,    86,    87,    84,    85,    84,
+      85,    88,    42,   201,   139,    89,   202,    68,   105,   106,
+     107,    44,   162,   176,   182,    69,   108,   163,   177,   183,
+      84,    85,    46,    24,    25,    26,    27,    84,    85,    69,
+      69,    61,   122,   123,    69,   118,    69,   333,   334,   133,
+     335,   336,    84,    85,   124,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,   190,   290,   291,    69,   198,   191,
+     251,   252,   367,   199,    69,   368,   369,   370,   371,   372,
+     373,   182,    70,   190,   203,   204,   268,   198,   272,    69,
+     176,   302,   275,   305,   305,   300,   303,   152,   306,   307,
+     311,   110,   109,   110,   109,   312,   148,   254,   255,   126,
+     125,   126,   125,   111,   151,   111,   153,   141,   140,   141,
+     140,   127,   351,   127,   154,   391,   155,   352,   161,   142,
+     392,   142,   201,   330,   365,   313,   331,   366,   245,   246,
+     247,   165,   166,   179,   186,   213,   185,   194,   193,   196,
+     205,   206,   207,   208,   209,   210,   212,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   225,   226,   227,
+     228,   232,   233,   234,   238,   239,   276,   240,   244,   248,
+     263,   283,   283,   293,   292,   249,   250,   257,    22,   260,
+     261,   262,   264,   265,   266,   294,   267,   269,   270,   314,
+     308,   316,   318,   319,   271,   321,   322,   273,   359,   325,
+     332,   278,   349,   353,   274,   354,   356,   361,   385,   386,
+     387,   388,   389,   393,   399,   283,   355,   258,   211,   224,
+     293,   292,   277,   317,   328,   288,   236,   323,   324,   237,
+     358,   360,   294,   242,   235,   299,   394,   401,   338,   337,
+     395,   396,   243,   398,   397,   241,   289,   402,   231,   230,
+     339,   229,   320,   315,   346,   357,   383,   400,     0,     0,
+     338,   337,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   339
   };
 
   const short
   D2Parser::yycheck_[] =
   {
       50,    52,    52,    54,    54,    56,    56,     5,     7,     7,
-      48,     9,     0,    52,    26,    54,     5,    56,    10,    11,
-      12,    13,     5,    14,    15,    16,    17,    14,    15,    20,
-       7,    22,    23,    24,    25,    22,    23,    22,    23,    30,
-      18,    19,    29,    34,    56,    37,    31,    32,    33,     7,
-       3,     7,     3,     6,    39,    22,    23,     8,    56,    57,
-      58,    59,    22,    23,    56,    56,     7,    27,    28,    56,
-       5,    56,    39,    40,    56,    42,    43,    22,    23,    39,
-      41,     3,     3,    44,    45,    46,     8,     8,     3,    56,
-      35,    36,     3,     8,     7,     6,    56,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,     7,     7,     6,     3,
-     160,    56,   150,   151,     8,     3,     3,     3,     3,     3,
-       8,     8,     8,     8,     8,     3,     8,     3,   179,   179,
-     181,   181,     8,     4,     3,     3,   187,   187,   189,   189,
-     179,     4,   181,     4,   195,   195,   197,   197,   187,     3,
-     189,     4,     3,     3,     8,     3,   195,     8,   197,     3,
-       8,     4,     4,    56,     8,   203,   204,   205,     3,     3,
-       6,     6,     6,     6,     4,     4,     4,     4,     4,     4,
-      57,     4,    57,     4,     4,     4,     4,     4,     4,     4,
-       4,    57,     4,     4,     4,     4,     4,     4,    57,     4,
-       4,     7,   240,     4,   254,   255,   257,   257,     7,    56,
-       7,    56,     7,     7,     5,     7,    56,    56,   257,    21,
-       5,     4,     6,     4,    56,    56,     4,     7,     5,     5,
-       4,     6,    56,     4,    56,    38,     4,     4,     7,     5,
-       4,     4,     4,    56,     4,   214,   160,   244,   298,   173,
-     255,   298,   315,   304,   304,   191,    56,   189,    56,   187,
-     263,    57,   195,    56,   198,   304,    56,   197,   304,    57,
-      59,   322,   322,   183,   181,    57,   256,    56,   295,   323,
-     179,   358,   344,   322,   375,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   344,   344,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   344
+      48,     9,     0,    52,     7,    54,     5,    56,    10,    11,
+      12,    13,    28,    14,    15,    16,    17,    14,    15,    20,
+      21,     7,     7,    24,    25,    26,    27,    24,    25,    24,
+      25,    32,     5,     3,    31,    36,     6,    39,    33,    34,
+      35,     7,     3,     3,     3,    61,    41,     8,     8,     8,
+      24,    25,     5,    61,    62,    63,    64,    24,    25,    61,
+      61,    61,    29,    30,    61,     7,    61,    41,    42,     7,
+      44,    45,    24,    25,    41,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,     3,    37,    38,    61,     3,     8,
+      18,    19,    43,     8,    61,    46,    47,    48,    49,    50,
+      51,     3,   162,     3,   152,   153,     8,     3,     8,    61,
+       3,     3,     8,     3,     3,     8,     8,     3,     8,     8,
+       3,   182,   182,   184,   184,     8,     7,    22,    23,   190,
+     190,   192,   192,   182,     6,   184,     4,   198,   198,   200,
+     200,   190,     3,   192,     8,     3,     3,     8,     4,   198,
+       8,   200,     3,     3,     3,     6,     6,     6,   206,   207,
+     208,     4,     4,     4,     3,    62,     6,     3,     6,     4,
+      61,     4,     4,     4,     4,     4,     4,    62,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,    62,     4,
+       4,     4,     4,     4,     4,    62,   244,     4,     4,     7,
+       5,   261,   262,   264,   264,     7,    61,    61,     7,    61,
+       7,     7,     7,    61,    61,   264,    61,    61,     5,     4,
+       6,     4,     4,     4,    61,     5,     5,    61,     5,     7,
+       6,    40,     4,     4,    61,     4,     4,     7,     4,     4,
+       4,     4,     4,     4,     4,   305,    62,   218,   162,   176,
+     311,   311,   248,   305,   322,   262,   192,    61,    61,   194,
+      61,    61,   311,   200,   190,   270,    64,    61,   329,   329,
+      62,    62,   201,    62,    64,   198,   263,    61,   186,   184,
+     329,   182,   311,   302,   330,   351,   365,   391,    -1,    -1,
+     351,   351,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   351
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-       0,     5,     7,     9,    56,    57,    58,    59,    71,    72,
-      73,    78,     7,    83,     7,    89,     7,   153,     5,   147,
-       7,   121,     5,   115,     7,   136,     5,   131,    79,    74,
-      84,    90,   154,   148,   122,   116,   137,   132,    71,    80,
-      81,    56,    76,    77,    10,    11,    12,    13,    37,    56,
-      82,    85,    86,    87,   172,   174,   176,   178,    14,    15,
-      16,    17,    20,    22,    23,    24,    25,    30,    34,    82,
-      91,    92,    93,    95,    96,    97,   100,   102,   104,   106,
-     108,   145,   164,    31,    32,    33,    39,    82,   102,   104,
-     155,   156,   157,   159,   161,   162,     7,   149,   150,   151,
-      27,    28,    39,    82,   102,   104,   123,   124,   125,   127,
-     129,     7,   117,   118,   119,    14,    15,    29,    82,   102,
-     104,   138,   139,   140,   142,   144,     7,   133,   134,     6,
-       3,     4,     8,     3,   173,   175,   177,    88,   179,     4,
-       3,     8,    94,     4,     4,    98,   101,   103,   105,   107,
-     109,   146,   165,     3,     8,   160,     4,   163,   158,     3,
-       8,   152,     6,     3,   128,   130,   126,     3,     8,   120,
-       6,     3,   143,     4,   141,     3,     8,   135,     3,     6,
-      71,    71,    56,     4,     4,     4,     4,     4,    86,     4,
-      57,    57,     4,     4,     4,     4,     4,     4,     4,     4,
-      92,     4,    57,     4,     4,   156,   155,   151,     4,     4,
-       4,   124,   123,   119,     4,    57,     4,   139,   138,   134,
-       4,    71,    71,    71,     7,     7,    56,    18,    19,    99,
-      21,    73,    75,    56,     7,     7,     5,     7,    56,    56,
-      56,     8,    56,     5,    56,     8,    56,    56,     8,    71,
-      91,    38,   180,   181,   182,    26,    82,   110,   111,   112,
-     113,   110,   149,    35,    36,    82,   102,   104,   166,   167,
-     168,   170,   133,     8,   183,     3,     8,   114,     3,     8,
-       8,     6,   169,   171,     3,     8,     6,     4,   181,     4,
-     112,     4,     4,   167,     5,     5,    56,    56,     7,   184,
-     185,   117,   186,     3,     6,     6,    39,    40,    42,    43,
-      82,   102,   104,   187,   188,   189,   191,   192,   194,   185,
-     190,   195,     4,   193,     3,     8,     4,     4,    57,     4,
-     188,    56,     5,    56,     7,   196,   197,   198,     3,     6,
-      41,    44,    45,    46,   199,   200,   201,   203,   204,   205,
-     197,   202,     4,     4,     4,     3,     8,     4,    59,    57,
-      57,   200,    56
+       0,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+       0,     5,     7,     9,    61,    62,    63,    64,    76,    77,
+      78,    83,     7,    88,     7,    94,     7,   161,     5,   155,
+       7,   129,     5,   123,     7,   144,     5,   139,    84,    79,
+      89,    95,   162,   156,   130,   124,   145,   140,    76,    85,
+      86,    61,    81,    82,    10,    11,    12,    13,    39,    61,
+      87,    90,    91,    92,   180,   182,   184,   186,    14,    15,
+      16,    17,    20,    21,    24,    25,    26,    27,    32,    36,
+      87,    96,    97,    98,   100,   101,   102,   105,   108,   110,
+     112,   114,   116,   153,   172,    33,    34,    35,    41,    87,
+     110,   112,   163,   164,   165,   167,   169,   170,     7,   157,
+     158,   159,    29,    30,    41,    87,   110,   112,   131,   132,
+     133,   135,   137,     7,   125,   126,   127,    14,    15,    31,
+      87,   110,   112,   146,   147,   148,   150,   152,     7,   141,
+     142,     6,     3,     4,     8,     3,   181,   183,   185,    93,
+     187,     4,     3,     8,    99,     4,     4,   103,   106,   109,
+     111,   113,   115,   117,   154,   173,     3,     8,   168,     4,
+     171,   166,     3,     8,   160,     6,     3,   136,   138,   134,
+       3,     8,   128,     6,     3,   151,     4,   149,     3,     8,
+     143,     3,     6,    76,    76,    61,     4,     4,     4,     4,
+       4,    91,     4,    62,    62,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,    97,     4,    62,     4,     4,   164,
+     163,   159,     4,     4,     4,   132,   131,   127,     4,    62,
+       4,   147,   146,   142,     4,    76,    76,    76,     7,     7,
+      61,    18,    19,   104,    22,    23,   107,    61,    78,    80,
+      61,     7,     7,     5,     7,    61,    61,    61,     8,    61,
+       5,    61,     8,    61,    61,     8,    76,    96,    40,   188,
+     189,   190,    28,    87,   118,   119,   120,   121,   118,   157,
+      37,    38,    87,   110,   112,   174,   175,   176,   178,   141,
+       8,   191,     3,     8,   122,     3,     8,     8,     6,   177,
+     179,     3,     8,     6,     4,   189,     4,   120,     4,     4,
+     175,     5,     5,    61,    61,     7,   192,   193,   125,   194,
+       3,     6,     6,    41,    42,    44,    45,    87,   110,   112,
+     195,   196,   197,   199,   200,   202,   193,   198,   203,     4,
+     201,     3,     8,     4,     4,    62,     4,   196,    61,     5,
+      61,     7,   204,   205,   206,     3,     6,    43,    46,    47,
+      48,    49,    50,    51,   207,   208,   209,   211,   212,   213,
+     214,   215,   216,   205,   210,     4,     4,     4,     4,     4,
+     217,     3,     8,     4,    64,    62,    62,    64,    62,     4,
+     208,    61,    61
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    60,    62,    61,    63,    61,    64,    61,    65,    61,
-      66,    61,    67,    61,    68,    61,    69,    61,    70,    61,
-      71,    71,    71,    71,    71,    71,    71,    72,    74,    73,
-      75,    76,    76,    77,    77,    79,    78,    80,    80,    81,
-      81,    82,    84,    83,    85,    85,    86,    86,    86,    86,
-      86,    86,    88,    87,    90,    89,    91,    91,    92,    92,
-      92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-      94,    93,    95,    96,    98,    97,    99,    99,   101,   100,
-     103,   102,   105,   104,   107,   106,   109,   108,   110,   110,
-     111,   111,   112,   112,   114,   113,   116,   115,   117,   117,
-     118,   118,   120,   119,   122,   121,   123,   123,   124,   124,
-     124,   124,   124,   124,   126,   125,   128,   127,   130,   129,
-     132,   131,   133,   133,   135,   134,   137,   136,   138,   138,
-     139,   139,   139,   139,   139,   139,   141,   140,   143,   142,
-     144,   146,   145,   148,   147,   149,   149,   150,   150,   152,
-     151,   154,   153,   155,   155,   156,   156,   156,   156,   156,
-     156,   156,   158,   157,   160,   159,   161,   163,   162,   165,
-     164,   166,   166,   167,   167,   167,   167,   167,   169,   168,
-     171,   170,   173,   172,   175,   174,   177,   176,   179,   178,
-     180,   180,   181,   183,   182,   184,   184,   186,   185,   187,
-     187,   188,   188,   188,   188,   188,   188,   188,   190,   189,
-     191,   193,   192,   195,   194,   196,   196,   198,   197,   199,
-     199,   200,   200,   200,   200,   202,   201,   203,   204,   205
+       0,    65,    67,    66,    68,    66,    69,    66,    70,    66,
+      71,    66,    72,    66,    73,    66,    74,    66,    75,    66,
+      76,    76,    76,    76,    76,    76,    76,    77,    79,    78,
+      80,    81,    81,    82,    82,    84,    83,    85,    85,    86,
+      86,    87,    89,    88,    90,    90,    91,    91,    91,    91,
+      91,    91,    93,    92,    95,    94,    96,    96,    97,    97,
+      97,    97,    97,    97,    97,    97,    97,    97,    97,    97,
+      97,    99,    98,   100,   101,   103,   102,   104,   104,   106,
+     105,   107,   107,   109,   108,   111,   110,   113,   112,   115,
+     114,   117,   116,   118,   118,   119,   119,   120,   120,   122,
+     121,   124,   123,   125,   125,   126,   126,   128,   127,   130,
+     129,   131,   131,   132,   132,   132,   132,   132,   132,   134,
+     133,   136,   135,   138,   137,   140,   139,   141,   141,   143,
+     142,   145,   144,   146,   146,   147,   147,   147,   147,   147,
+     147,   149,   148,   151,   150,   152,   154,   153,   156,   155,
+     157,   157,   158,   158,   160,   159,   162,   161,   163,   163,
+     164,   164,   164,   164,   164,   164,   164,   166,   165,   168,
+     167,   169,   171,   170,   173,   172,   174,   174,   175,   175,
+     175,   175,   175,   177,   176,   179,   178,   181,   180,   183,
+     182,   185,   184,   187,   186,   188,   188,   189,   191,   190,
+     192,   192,   194,   193,   195,   195,   196,   196,   196,   196,
+     196,   196,   196,   198,   197,   199,   201,   200,   203,   202,
+     204,   204,   206,   205,   207,   207,   208,   208,   208,   208,
+     208,   208,   208,   210,   209,   211,   212,   213,   214,   215,
+     217,   216
   };
 
-  const unsigned char
+  const signed char
   D2Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -2377,127 +2552,132 @@ namespace isc { namespace d2 {
        3,     2,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     1,     0,     6,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     3,     3,     0,     4,     1,     1,     0,     4,
-       0,     4,     0,     4,     0,     6,     0,     6,     0,     1,
-       1,     3,     1,     1,     0,     6,     0,     4,     0,     1,
-       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     6,
-       0,     4,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
-       3,     0,     6,     0,     4,     0,     1,     1,     3,     0,
+       1,     0,     4,     3,     3,     0,     4,     1,     1,     0,
+       4,     1,     1,     0,     4,     0,     4,     0,     4,     0,
+       6,     0,     6,     0,     1,     1,     3,     1,     1,     0,
+       6,     0,     4,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     6,     0,     4,     1,     3,     0,
        4,     0,     4,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     3,     0,     4,     0,
-       6,     1,     3,     1,     1,     1,     1,     1,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     3,     1,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
+       1,     0,     4,     0,     4,     3,     0,     6,     0,     4,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     3,     0,     4,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     6,     1,     3,     1,     0,     6,
+       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     3,     0,     4,     0,     6,
+       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     3,     3,     3,     3,     3,
+       0,     4
   };
 
 
-
+#if D2_PARSER_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const D2Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
   "\"Control-agent\"", "\"DhcpDdns\"", "\"ip-address\"", "\"port\"",
   "\"dns-server-timeout\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
-  "\"ncr-format\"", "\"JSON\"", "\"user-context\"", "\"comment\"",
-  "\"forward-ddns\"", "\"reverse-ddns\"", "\"ddns-domains\"",
-  "\"key-name\"", "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"",
-  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"Logging\"", "\"loggers\"",
-  "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"",
-  "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS", "SUB_TSIG_KEY",
-  "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER",
-  "SUB_DNS_SERVERS", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value", "sub_json",
-  "map2", "$@10", "map_value", "map_content", "not_empty_map",
+  "\"ncr-format\"", "\"spill-file\"", "\"JSON\"", "\"BINARY\"",
+  "\"user-context\"", "\"comment\"", "\"forward-ddns\"",
+  "\"reverse-ddns\"", "\"ddns-domains\"", "\"key-name\"",
+  "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"", "\"algorithm\"",
+  "\"digest-bits\"", "\"secret\"", "\"control-socket\"", "\"socket-type\"",
+  "\"socket-name\"", "\"Logging\"", "\"loggers\"", "\"name\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
+  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"", "\"queue-size\"",
+  "\"overflow\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS",
+  "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS",
+  "SUB_DNS_SERVER", "SUB_DNS_SERVERS", "\"constant string\"",
+  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
+  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value",
+  "sub_json", "map2", "$@10", "map_value", "map_content", "not_empty_map",
   "list_generic", "$@11", "list_content", "not_empty_list",
   "unknown_map_entry", "syntax_map", "$@12", "global_objects",
   "global_object", "dhcpddns_object", "$@13", "sub_dhcpddns", "$@14",
   "dhcpddns_params", "dhcpddns_param", "ip_address", "$@15", "port",
   "dns_server_timeout", "ncr_protocol", "$@16", "ncr_protocol_value",
-  "ncr_format", "$@17", "user_context", "$@18", "comment", "$@19",
-  "forward_ddns", "$@20", "reverse_ddns", "$@21", "ddns_mgr_params",
-  "not_empty_ddns_mgr_params", "ddns_mgr_param", "ddns_domains", "$@22",
-  "sub_ddns_domains", "$@23", "ddns_domain_list",
-  "not_empty_ddns_domain_list", "ddns_domain", "$@24", "sub_ddns_domain",
-  "$@25", "ddns_domain_params", "ddns_domain_param", "ddns_domain_name",
-  "$@26", "ddns_domain_key_name", "$@27", "dns_servers", "$@28",
-  "sub_dns_servers", "$@29", "dns_server_list", "dns_server", "$@30",
-  "sub_dns_server", "$@31", "dns_server_params", "dns_server_param",
-  "dns_server_hostname", "$@32", "dns_server_ip_address", "$@33",
-  "dns_server_port", "tsig_keys", "$@34", "sub_tsig_keys", "$@35",
-  "tsig_keys_list", "not_empty_tsig_keys_list", "tsig_key", "$@36",
-  "sub_tsig_key", "$@37", "tsig_key_params", "tsig_key_param",
-  "tsig_key_name", "$@38", "tsig_key_algorithm", "$@39",
-  "tsig_key_digest_bits", "tsig_key_secret", "$@40", "control_socket",
-  "$@41", "control_socket_params", "control_socket_param",
-  "control_socket_type", "$@42", "control_socket_name", "$@43",
-  "dhcp6_json_object", "$@44", "dhcp4_json_object", "$@45",
-  "control_agent_json_object", "$@46", "logging_object", "$@47",
-  "logging_params", "logging_param", "loggers", "$@48", "loggers_entries",
-  "logger_entry", "$@49", "logger_params", "logger_param", "name", "$@50",
-  "debuglevel", "severity", "$@51", "output_options_list", "$@52",
-  "output_options_list_content", "output_entry", "$@53",
-  "output_params_list", "output_params", "output", "$@54", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "ncr_format", "$@17", "ncr_format_value", "spill_file", "$@18",
+  "user_context", "$@19", "comment", "$@20", "forward_ddns", "$@21",
+  "reverse_ddns", "$@22", "ddns_mgr_params", "not_empty_ddns_mgr_params",
+  "ddns_mgr_param", "ddns_domains", "$@23", "sub_ddns_domains", "$@24",
+  "ddns_domain_list", "not_empty_ddns_domain_list", "ddns_domain", "$@25",
+  "sub_ddns_domain", "$@26", "ddns_domain_params", "ddns_domain_param",
+  "ddns_domain_name", "$@27", "ddns_domain_key_name", "$@28",
+  "dns_servers", "$@29", "sub_dns_servers", "$@30", "dns_server_list",
+  "dns_server", "$@31", "sub_dns_server", "$@32", "dns_server_params",
+  "dns_server_param", "dns_server_hostname", "$@33",
+  "dns_server_ip_address", "$@34", "dns_server_port", "tsig_keys", "$@35",
+  "sub_tsig_keys", "$@36", "tsig_keys_list", "not_empty_tsig_keys_list",
+  "tsig_key", "$@37", "sub_tsig_key", "$@38", "tsig_key_params",
+  "tsig_key_param", "tsig_key_name", "$@39", "tsig_key_algorithm", "$@40",
+  "tsig_key_digest_bits", "tsig_key_secret", "$@41", "control_socket",
+  "$@42", "control_socket_params", "control_socket_param",
+  "control_socket_type", "$@43", "control_socket_name", "$@44",
+  "dhcp6_json_object", "$@45", "dhcp4_json_object", "$@46",
+  "control_agent_json_object", "$@47", "logging_object", "$@48",
+  "logging_params", "logging_param", "loggers", "$@49", "loggers_entries",
+  "logger_entry", "$@50", "logger_params", "logger_param", "name", "$@51",
+  "debuglevel", "severity", "$@52", "output_options_list", "$@53",
+  "output_options_list_content", "output_entry", "$@54",
+  "output_params_list", "output_params", "output", "$@55", "flush",
+  "maxsize", "maxver", "async", "queue_size", "overflow", "$@56", YY_NULLPTR
   };
+#endif
+
 
 #if D2_PARSER_DEBUG
-  const unsigned short
+  const short
   D2Parser::yyrline_[] =
   {
-       0,   124,   124,   124,   125,   125,   126,   126,   127,   127,
-     128,   128,   129,   129,   130,   130,   131,   131,   132,   132,
-     140,   141,   142,   143,   144,   145,   146,   149,   154,   154,
-     165,   168,   169,   172,   176,   183,   183,   190,   191,   194,
-     198,   209,   219,   219,   231,   232,   236,   237,   238,   239,
-     240,   241,   246,   246,   256,   256,   264,   265,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     283,   283,   291,   299,   308,   308,   316,   317,   320,   320,
-     328,   328,   353,   353,   380,   380,   390,   390,   400,   401,
-     404,   405,   408,   409,   414,   414,   424,   424,   431,   432,
-     435,   436,   439,   439,   447,   447,   454,   455,   458,   459,
-     460,   461,   462,   463,   467,   467,   479,   479,   491,   491,
-     501,   501,   508,   509,   512,   512,   520,   520,   527,   528,
-     531,   532,   533,   534,   535,   536,   539,   539,   551,   551,
-     559,   573,   573,   583,   583,   590,   591,   594,   595,   598,
-     598,   606,   606,   615,   616,   619,   620,   621,   622,   623,
-     624,   625,   628,   628,   640,   640,   651,   659,   659,   675,
-     675,   685,   686,   689,   690,   691,   692,   693,   696,   696,
-     704,   704,   714,   714,   721,   721,   728,   728,   740,   740,
-     753,   754,   758,   762,   762,   774,   775,   779,   779,   787,
-     788,   791,   792,   793,   794,   795,   796,   797,   800,   800,
-     808,   812,   812,   820,   820,   830,   831,   834,   834,   842,
-     843,   846,   847,   848,   849,   852,   852,   860,   865,   870
+       0,   130,   130,   130,   131,   131,   132,   132,   133,   133,
+     134,   134,   135,   135,   136,   136,   137,   137,   138,   138,
+     146,   147,   148,   149,   150,   151,   152,   155,   160,   160,
+     171,   174,   175,   178,   182,   189,   189,   196,   197,   200,
+     204,   215,   225,   225,   237,   238,   242,   243,   244,   245,
+     246,   247,   252,   252,   262,   262,   270,   271,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   290,   290,   298,   306,   315,   315,   323,   324,   327,
+     327,   335,   336,   339,   339,   347,   347,   372,   372,   399,
+     399,   409,   409,   419,   420,   423,   424,   427,   428,   433,
+     433,   443,   443,   450,   451,   454,   455,   458,   458,   466,
+     466,   473,   474,   477,   478,   479,   480,   481,   482,   486,
+     486,   498,   498,   510,   510,   520,   520,   527,   528,   531,
+     531,   539,   539,   546,   547,   550,   551,   552,   553,   554,
+     555,   558,   558,   570,   570,   578,   592,   592,   602,   602,
+     609,   610,   613,   614,   617,   617,   625,   625,   634,   635,
+     638,   639,   640,   641,   642,   643,   644,   647,   647,   659,
+     659,   670,   678,   678,   694,   694,   704,   705,   708,   709,
+     710,   711,   712,   715,   715,   723,   723,   733,   733,   740,
+     740,   747,   747,   759,   759,   772,   773,   777,   781,   781,
+     793,   794,   798,   798,   806,   807,   810,   811,   812,   813,
+     814,   815,   816,   819,   819,   827,   831,   831,   839,   839,
+     849,   850,   853,   853,   861,   862,   865,   866,   867,   868,
+     869,   870,   871,   874,   874,   882,   887,   892,   897,   902,
+     907,   907
   };
 
-  // Print the state stack on the debug stream.
   void
-  D2Parser::yystack_print_ ()
+  D2Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  D2Parser::yy_reduce_print_ (int yyrule)
+  D2Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2510,10 +2690,11 @@ namespace isc { namespace d2 {
 #endif // D2_PARSER_DEBUG
 
 
-#line 14 "d2_parser.yy" // lalr1.cc:1242
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2516 "d2_parser.cc" // lalr1.cc:1242
-#line 875 "d2_parser.yy" // lalr1.cc:1243
+#line 2696 "d2_parser.cc"
+
+#line 915 "d2_parser.yy"
 
 
 void
@@ -61,7 +61,9 @@ using namespace std;
   UDP "UDP"
   TCP "TCP"
   NCR_FORMAT "ncr-format"
+  SPILL_FILE "spill-file"
   JSON "JSON"
+  BINARY "BINARY"
   USER_CONTEXT "user-context"
   COMMENT "comment"
   FORWARD_DDNS "forward-ddns"
@@ -89,6 +91,9 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse.
@@ -111,6 +116,7 @@ using namespace std;
 %type <ElementPtr> value
 %type <ElementPtr> map_value
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 
 %printer { yyoutput << $$; } <*>;
 
@@ -271,6 +277,7 @@ dhcpddns_param: ip_address
               | dns_server_timeout
               | ncr_protocol
               | ncr_format
+              | spill_file
               | forward_ddns
               | reverse_ddns
               | tsig_keys
@@ -319,9 +326,21 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
+    ctx.leave();
+};
+
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
+spill_file: SPILL_FILE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr s(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("spill-file", s);
     ctx.leave();
 };
 
@@ -847,6 +866,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow
              ;
 
 output: OUTPUT {
@@ -872,6 +894,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 }
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+}
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr queue_size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+
+overflow: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr overflow(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+
 %%
 
 void
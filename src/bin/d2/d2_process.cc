@@ -87,9 +87,14 @@ D2Process::run() {
                    "Process run method failed: " << ex.what());
     }
 
-    // @todo - if queue isn't empty, we may need to persist its contents
-    // this might be the place to do it, once there is a persistence mgr.
-    // This may also be better in checkQueueStatus.
+    // Save the requests still queued into the spill file, if any, so
+    // they are processed after a restart.
+    try {
+        queue_mgr_->persistQueue();
+    } catch (const std::exception& ex) {
+        LOG_ERROR(d2_logger, DHCP_DDNS_QUEUE_MGR_PERSIST_ERROR)
+            .arg(ex.what());
+    }
 
     controller->deregisterCommands();
 
@@ -351,6 +356,15 @@ D2Process::reconfigureQueueMgr() {
             LOG_WARN(d2_logger, DHCP_DDNS_NOT_ON_LOOPBACK).arg(ip_address);
         }
 
+        // Open or change the spill file. Failing to do so is not fatal:
+        // requests are then dropped when the queue is full.
+        try {
+            queue_mgr_->enableSpillQueue(d2_params->getSpillFile());
+        } catch (const std::exception& ex) {
+            LOG_ERROR(d2_logger, DHCP_DDNS_QUEUE_MGR_SPILL_ERROR)
+                .arg(ex.what());
+        }
+
         // Instantiate the listener.
         if (d2_params->getNcrProtocol() == dhcp_ddns::NCR_UDP) {
             queue_mgr_->initUDPListener(d2_params->getIpAddress(),
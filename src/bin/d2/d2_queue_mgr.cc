@@ -42,7 +42,33 @@ D2QueueMgr::operator()(const dhcp_ddns::NameChangeListener::Result result,
         // state as well as our queue size.
         switch (result) {
         case dhcp_ddns::NameChangeListener::SUCCESS:
-            // Receive was successful, attempt to queue the request.
+            // Receive was successful. If the queue is full or older
+            // requests are waiting in the spill queue, spill the request.
+            if (spill_queue_ && (!spill_queue_->empty() ||
+                                 (getQueueSize() >= getMaxQueueSize()))) {
+                try {
+                    if (spill_queue_->empty()) {
+                        LOG_WARN(dhcp_to_d2_logger,
+                                 DHCP_DDNS_QUEUE_MGR_SPILLING)
+                            .arg(max_queue_size_)
+                            .arg(spill_queue_->getFilename());
+                    }
+
+                    spill_queue_->push(ncr);
+                    LOG_DEBUG(dhcp_to_d2_logger,
+                              isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                              DHCP_DDNS_QUEUE_MGR_QUEUE_SPILLED)
+                              .arg(ncr->getRequestId());
+                    refillFromSpill();
+                    return;
+                } catch (const std::exception& ex) {
+                    // Fall back to the queue.
+                    LOG_ERROR(dhcp_to_d2_logger,
+                              DHCP_DDNS_QUEUE_MGR_SPILL_ERROR).arg(ex.what());
+                }
+            }
+
+            // Attempt to queue the request.
             if (getQueueSize() < getMaxQueueSize()) {
                 // There's room on the queue, add to the end
                 enqueue(ncr);
@@ -222,6 +248,7 @@ D2QueueMgr::dequeueAt(const size_t index) {
 
     RequestQueue::iterator pos = ncr_queue_.begin() + index;
     ncr_queue_.erase(pos);
+    refillFromSpill();
 }
 
 
@@ -233,6 +260,7 @@ D2QueueMgr::dequeue() {
     }
 
     ncr_queue_.pop_front();
+    refillFromSpill();
 }
 
 void
@@ -245,6 +273,87 @@ D2QueueMgr::clearQueue() {
     ncr_queue_.clear();
 }
 
+void
+D2QueueMgr::enableSpillQueue(const std::string& filename) {
+    if (spill_queue_ && (spill_queue_->getFilename() == filename)) {
+        return;
+    }
+
+    D2SpillQueuePtr new_spill_queue;
+    if (!filename.empty()) {
+        try {
+            new_spill_queue.reset(new D2SpillQueue(filename));
+        } catch (const std::exception& ex) {
+            isc_throw(D2QueueMgrError, "D2QueueMgr cannot open spill file: "
+                      << ex.what());
+        }
+
+        LOG_INFO(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_SPILL_OPENED)
+            .arg(filename).arg(new_spill_queue->size());
+    }
+
+    // Move the requests of the previous spill queue, if any.
+    D2SpillQueuePtr old_spill_queue = spill_queue_;
+    spill_queue_ = new_spill_queue;
+    if (old_spill_queue) {
+        try {
+            while (!old_spill_queue->empty()) {
+                dhcp_ddns::NameChangeRequestPtr ncr = old_spill_queue->pop();
+                if (spill_queue_) {
+                    spill_queue_->push(ncr);
+                } else {
+                    enqueue(ncr);
+                }
+            }
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_SPILL_ERROR)
+                .arg(ex.what());
+        }
+    }
+
+    refillFromSpill();
+}
+
+void
+D2QueueMgr::persistQueue() {
+    if (!spill_queue_) {
+        return;
+    }
+
+    size_t count = getQueueSize();
+    try {
+        spill_queue_->compact(ncr_queue_);
+    } catch (const std::exception& ex) {
+        isc_throw(D2QueueMgrError, "D2QueueMgr cannot save queue: "
+                  << ex.what());
+    }
+
+    ncr_queue_.clear();
+    LOG_INFO(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_PERSISTED)
+        .arg(count).arg(spill_queue_->getFilename());
+}
+
+void
+D2QueueMgr::refillFromSpill() {
+    if (!spill_queue_ || spill_queue_->empty()) {
+        return;
+    }
+
+    try {
+        while (!spill_queue_->empty() &&
+               (getQueueSize() < getMaxQueueSize())) {
+            ncr_queue_.push_back(spill_queue_->pop());
+            if (spill_queue_->empty()) {
+                LOG_INFO(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_SPILL_DRAINED)
+                    .arg(spill_queue_->getFilename());
+            }
+        }
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_SPILL_ERROR)
+            .arg(ex.what());
+    }
+}
+
 void
 D2QueueMgr::setMaxQueueSize(const size_t new_queue_max) {
     if (new_queue_max < 1) {
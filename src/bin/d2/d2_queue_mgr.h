@@ -10,6 +10,7 @@
 /// @file d2_queue_mgr.h This file defines the class D2QueueMgr.
 
 #include <asiolink/io_service.h>
+#include <d2/d2_spill_queue.h>
 #include <exceptions/exceptions.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dhcp_ddns/ncr_io.h>
@@ -128,6 +129,15 @@ public:
 /// until they are removed explicitly via the deque() or implicitly by
 /// via the clearQueue() method.
 ///
+/// Optionally D2QueueMgr may be given a spill queue, see enableSpillQueue().
+/// When the queue is full, requests received are appended to the spill
+/// queue rather than the listener being stopped, and as entries are removed
+/// from the queue it is refilled from the spill queue.  While the spill
+/// queue is not empty, requests received are appended to it so they are
+/// processed in the order received.  The queue contents can be saved into
+/// the spill queue at shutdown via persistQueue(), so that no request is
+/// lost across a restart.
+///
 class D2QueueMgr : public dhcp_ddns::NameChangeListener::RequestReceiveHandler,
                    boost::noncopyable {
 public:
@@ -311,8 +321,41 @@ public:
     void enqueue(dhcp_ddns::NameChangeRequestPtr& ncr);
 
     /// @brief Removes all entries from the queue.
+    ///
+    /// Entries in the spill queue, if any, are not removed.
     void clearQueue();
 
+    /// @brief Sets the spill queue file.
+    ///
+    /// Opens the given spill file, the requests it holds being moved into
+    /// the queue as room allows. If a spill queue with a different file is
+    /// already in use, its requests are moved into the new one. An empty
+    /// file name disables the spill queue, its requests being moved into
+    /// the queue regardless of the maximum queue size.
+    ///
+    /// @param filename name of the spill file or an empty string.
+    ///
+    /// @throw D2QueueMgrError if the spill file cannot be opened.
+    void enableSpillQueue(const std::string& filename);
+
+    /// @brief Returns the spill queue, null if there is none.
+    const D2SpillQueuePtr& getSpillQueue() const {
+        return (spill_queue_);
+    }
+
+    /// @brief Returns the number of entries in the spill queue.
+    size_t getSpillQueueSize() const {
+        return (spill_queue_ ? spill_queue_->size() : 0);
+    }
+
+    /// @brief Saves the queue contents into the spill queue.
+    ///
+    /// The queue entries are placed ahead of the spill queue entries and
+    /// the queue is emptied. It does nothing if there is no spill queue.
+    ///
+    /// @throw D2QueueMgrError if the spill file cannot be written.
+    void persistQueue();
+
   private:
     /// @brief Sets the manager state to the target stop state.
     ///
@@ -320,6 +363,12 @@ public:
     /// state and logs that the manager is stopped.
     void updateStopState();
 
+    /// @brief Moves entries from the spill queue into the queue while
+    /// there is room.
+    ///
+    /// Errors are logged and not thrown.
+    void refillFromSpill();
+
     /// @brief IOService that our listener should use for IO management.
     asiolink::IOServicePtr io_service_;
 
@@ -332,6 +381,9 @@ public:
     /// @brief Listener instance from which requests are received.
     boost::shared_ptr<dhcp_ddns::NameChangeListener> listener_;
 
+    /// @brief Disk backed queue for the requests which do not fit.
+    D2SpillQueuePtr spill_queue_;
+
     /// @brief Current state of the manager.
     State mgr_state_;
 
@@ -253,13 +253,19 @@ void D2SimpleParser::parse(const D2CfgContextPtr& ctx,
     }
 
     ncr_format = getFormat(config, "ncr-format");
-    if (ncr_format != dhcp_ddns::FMT_JSON) {
+    if ((ncr_format != dhcp_ddns::FMT_JSON) &&
+        (ncr_format != dhcp_ddns::FMT_BINARY)) {
         isc_throw(D2CfgError, "NCR Format:"
                   << dhcp_ddns::ncrFormatToString(ncr_format)
                   << " is not yet supported"
                   << " (" << config->get("ncr-format")->getPosition() << ")");
     }
 
+    std::string spill_file;
+    if (config->contains("spill-file")) {
+        spill_file = SimpleParser::getString(config, "spill-file");
+    }
+
     ConstElementPtr user = config->get("user-context");
     if (user) {
         ctx->setContext(user);
@@ -277,7 +283,7 @@ void D2SimpleParser::parse(const D2CfgContextPtr& ctx,
     // Attempt to create the new client config. This ought to fly as
     // we already validated everything.
     D2ParamsPtr params(new D2Params(ip_address, port, dns_server_timeout,
-                                    ncr_protocol, ncr_format));
+                                    ncr_protocol, ncr_format, spill_file));
 
     ctx->getD2Params() = params;
 }
@@ -0,0 +1,386 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <d2/d2_log.h>
+#include <d2/d2_spill_queue.h>
+#include <util/buffer.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace isc::dhcp_ddns;
+
+namespace {
+
+/// @brief Type of a record adding a request.
+const uint8_t SPILL_ADD = 1;
+
+/// @brief Type of a record removing a request.
+const uint8_t SPILL_REMOVE = 2;
+
+/// @brief Size of the record header: type and sequence number.
+const size_t SPILL_HEADER_SIZE = 9;
+
+/// @brief Writes a record header to a buffer.
+void
+writeHeader(isc::util::OutputBuffer& buf, const uint8_t type,
+            const uint64_t seq) {
+    buf.writeUint8(type);
+    buf.writeUint32(static_cast<uint32_t>(seq >> 32));
+    buf.writeUint32(static_cast<uint32_t>(seq & 0xffffffff));
+}
+
+/// @brief Reads a big endian 64 bit value.
+uint64_t
+readUint64(const uint8_t* data) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | data[i];
+    }
+    return (value);
+}
+
+}
+
+namespace isc {
+namespace d2 {
+
+// Makes constant visible to Google test macros.
+const size_t D2SpillQueue::COMPACT_THRESHOLD;
+
+D2SpillQueue::D2SpillQueue(const std::string& filename)
+    : filename_(filename), file_(), entries_(), by_key_(), by_seq_(),
+      next_seq_(1), records_(0), superseded_(0) {
+    if (filename_.empty()) {
+        isc_throw(D2SpillQueueError, "spill file name cannot be empty");
+    }
+
+    open();
+}
+
+D2SpillQueue::~D2SpillQueue() {
+    file_.close();
+}
+
+std::string
+D2SpillQueue::makeKey(const NameChangeRequest& ncr) {
+    std::string key = ncr.getFqdn();
+    key += "|";
+    key += ncr.getIpAddress();
+    key += "|";
+    key += ncr.getDhcid().toStr();
+    key += "|";
+    key += (ncr.isForwardChange() ? "F" : "");
+    key += (ncr.isReverseChange() ? "R" : "");
+    return (key);
+}
+
+void
+D2SpillQueue::open() {
+    // Create the file if it does not exist.
+    {
+        std::ofstream create(filename_.c_str(),
+                             std::ios::out | std::ios::app | std::ios::binary);
+        if (!create) {
+            isc_throw(D2SpillQueueError, "unable to create spill file: "
+                      << filename_);
+        }
+    }
+
+    file_.open(filename_.c_str(),
+               std::ios::in | std::ios::out | std::ios::binary);
+    if (!file_.is_open()) {
+        isc_throw(D2SpillQueueError, "unable to open spill file: "
+                  << filename_);
+    }
+
+    // Replay the journal.
+    bool truncated = false;
+    std::streamoff pos = 0;
+    std::vector<uint8_t> data;
+    for (;;) {
+        uint8_t header[SPILL_HEADER_SIZE];
+        file_.read(reinterpret_cast<char*>(header), SPILL_HEADER_SIZE);
+        if (file_.gcount() == 0) {
+            break;
+        }
+
+        if (file_.gcount() < static_cast<std::streamsize>(SPILL_HEADER_SIZE)) {
+            truncated = true;
+            break;
+        }
+
+        uint64_t seq = readUint64(header + 1);
+        if (header[0] == SPILL_ADD) {
+            uint8_t len_bytes[2];
+            file_.read(reinterpret_cast<char*>(len_bytes), sizeof(len_bytes));
+            if (file_.gcount() < static_cast<std::streamsize>(sizeof(len_bytes))) {
+                truncated = true;
+                break;
+            }
+
+            size_t len = (len_bytes[0] << 8) | len_bytes[1];
+            data.resize(len);
+            if (len > 0) {
+                file_.read(reinterpret_cast<char*>(&data[0]), len);
+                if (file_.gcount() < static_cast<std::streamsize>(len)) {
+                    truncated = true;
+                    break;
+                }
+            }
+
+            NameChangeRequestPtr ncr;
+            try {
+                ncr = NameChangeRequest::fromBinary(data.empty() ? NULL
+                                                    : &data[0], data.size());
+            } catch (const std::exception& ex) {
+                isc_throw(D2SpillQueueError, "invalid request in spill file: "
+                          << filename_ << " at offset " << pos << ": "
+                          << ex.what());
+            }
+
+            addEntry(seq, makeKey(*ncr), pos + SPILL_HEADER_SIZE);
+        } else if (header[0] == SPILL_REMOVE) {
+            removeEntry(seq);
+        } else {
+            isc_throw(D2SpillQueueError, "invalid record type "
+                      << static_cast<int>(header[0]) << " in spill file: "
+                      << filename_ << " at offset " << pos);
+        }
+
+        if (seq >= next_seq_) {
+            next_seq_ = seq + 1;
+        }
+
+        ++records_;
+        pos = file_.tellg();
+    }
+
+    file_.clear();
+
+    // Drop the partially written trailing record, if any.
+    if (truncated) {
+        LOG_WARN(dhcp_to_d2_logger, DHCP_DDNS_SPILL_FILE_TRUNCATED)
+            .arg(filename_).arg(pos);
+        compact();
+    }
+}
+
+uint64_t
+D2SpillQueue::addEntry(const uint64_t seq, const std::string& key,
+                       const std::streamoff offset) {
+    uint64_t superseded = 0;
+    std::map<std::string, EntryList::iterator>::iterator k = by_key_.find(key);
+    if (k != by_key_.end()) {
+        superseded = k->second->seq_;
+        by_seq_.erase(superseded);
+        entries_.erase(k->second);
+        by_key_.erase(k);
+    }
+
+    Entry entry;
+    entry.seq_ = seq;
+    entry.key_ = key;
+    entry.offset_ = offset;
+    EntryList::iterator it = entries_.insert(entries_.end(), entry);
+    by_seq_[seq] = it;
+    by_key_[key] = it;
+    return (superseded);
+}
+
+bool
+D2SpillQueue::removeEntry(const uint64_t seq) {
+    std::map<uint64_t, EntryList::iterator>::iterator s = by_seq_.find(seq);
+    if (s == by_seq_.end()) {
+        return (false);
+    }
+
+    EntryList::iterator it = s->second;
+    std::map<std::string, EntryList::iterator>::iterator k =
+        by_key_.find(it->key_);
+    if ((k != by_key_.end()) && (k->second == it)) {
+        by_key_.erase(k);
+    }
+
+    by_seq_.erase(s);
+    entries_.erase(it);
+    return (true);
+}
+
+std::streamoff
+D2SpillQueue::append(const void* data, const size_t length) {
+    file_.clear();
+    file_.seekp(0, std::ios::end);
+    std::streamoff offset = file_.tellp();
+    file_.write(static_cast<const char*>(data), length);
+    file_.flush();
+    if (!file_) {
+        file_.clear();
+        isc_throw(D2SpillQueueError, "unable to write to spill file: "
+                  << filename_);
+    }
+
+    ++records_;
+    return (offset);
+}
+
+void
+D2SpillQueue::appendRemove(const uint64_t seq) {
+    util::OutputBuffer buf(SPILL_HEADER_SIZE);
+    writeHeader(buf, SPILL_REMOVE, seq);
+    append(buf.getData(), buf.getLength());
+}
+
+NameChangeRequestPtr
+D2SpillQueue::readAt(const std::streamoff offset) {
+    file_.clear();
+    file_.seekg(offset);
+    uint8_t len_bytes[2];
+    file_.read(reinterpret_cast<char*>(len_bytes), sizeof(len_bytes));
+    size_t len = (len_bytes[0] << 8) | len_bytes[1];
+    std::vector<uint8_t> data(len);
+    if (file_ && (len > 0)) {
+        file_.read(reinterpret_cast<char*>(&data[0]), len);
+    }
+
+    if (!file_) {
+        file_.clear();
+        isc_throw(D2SpillQueueError, "unable to read from spill file: "
+                  << filename_ << " at offset " << offset);
+    }
+
+    try {
+        return (NameChangeRequest::fromBinary(data.empty() ? NULL : &data[0],
+                                              data.size()));
+    } catch (const std::exception& ex) {
+        isc_throw(D2SpillQueueError, "invalid request in spill file: "
+                  << filename_ << " at offset " << offset << ": "
+                  << ex.what());
+    }
+}
+
+void
+D2SpillQueue::push(const NameChangeRequestPtr& ncr) {
+    if (!ncr) {
+        isc_throw(D2SpillQueueError, "cannot spill a null request");
+    }
+
+    uint64_t seq = next_seq_++;
+    util::OutputBuffer buf(256);
+    writeHeader(buf, SPILL_ADD, seq);
+    ncr->toFormat(FMT_BINARY, buf);
+    std::streamoff offset = append(buf.getData(), buf.getLength());
+
+    uint64_t superseded = addEntry(seq, makeKey(*ncr),
+                                   offset + SPILL_HEADER_SIZE);
+    if (superseded) {
+        appendRemove(superseded);
+        ++superseded_;
+        LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                  DHCP_DDNS_SPILL_SUPERSEDED).arg(ncr->getRequestId());
+    }
+
+    maybeCompact();
+}
+
+NameChangeRequestPtr
+D2SpillQueue::pop() {
+    if (entries_.empty()) {
+        return (NameChangeRequestPtr());
+    }
+
+    const Entry& front = entries_.front();
+    uint64_t seq = front.seq_;
+    NameChangeRequestPtr ncr = readAt(front.offset_);
+    removeEntry(seq);
+    appendRemove(seq);
+    maybeCompact();
+    return (ncr);
+}
+
+void
+D2SpillQueue::maybeCompact() {
+    size_t dead = getDeadRecords();
+    if ((dead > COMPACT_THRESHOLD) && (dead > entries_.size())) {
+        compact();
+    }
+}
+
+void
+D2SpillQueue::compact(const RequestQueue& head) {
+    std::string tmp_name = filename_ + ".tmp";
+    std::ofstream out(tmp_name.c_str(),
+                      std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!out) {
+        isc_throw(D2SpillQueueError, "unable to create spill file: "
+                  << tmp_name);
+    }
+
+    // Write the head requests followed by the live requests, renumbering
+    // them from one.
+    EntryList new_entries;
+    uint64_t seq = 1;
+    std::streamoff offset = 0;
+    util::OutputBuffer buf(256);
+    std::vector<NameChangeRequestPtr> ncrs(head.begin(), head.end());
+    for (EntryList::const_iterator it = entries_.begin();
+         it != entries_.end(); ++it) {
+        ncrs.push_back(readAt(it->offset_));
+    }
+
+    for (std::vector<NameChangeRequestPtr>::const_iterator ncr = ncrs.begin();
+         ncr != ncrs.end(); ++ncr, ++seq) {
+        buf.clear();
+        writeHeader(buf, SPILL_ADD, seq);
+        (*ncr)->toFormat(FMT_BINARY, buf);
+        out.write(static_cast<const char*>(buf.getData()), buf.getLength());
+
+        Entry entry;
+        entry.seq_ = seq;
+        entry.key_ = makeKey(**ncr);
+        entry.offset_ = offset + SPILL_HEADER_SIZE;
+        new_entries.push_back(entry);
+        offset += buf.getLength();
+    }
+
+    out.close();
+    if (!out) {
+        isc_throw(D2SpillQueueError, "unable to write spill file: "
+                  << tmp_name);
+    }
+
+    file_.close();
+    if (std::rename(tmp_name.c_str(), filename_.c_str()) != 0) {
+        isc_throw(D2SpillQueueError, "unable to rename spill file: "
+                  << tmp_name << " to " << filename_);
+    }
+
+    // Rebuild the index. Among head and live requests sharing a key the
+    // last one is the one indexed by key.
+    entries_.swap(new_entries);
+    by_seq_.clear();
+    by_key_.clear();
+    for (EntryList::iterator it = entries_.begin(); it != entries_.end();
+         ++it) {
+        by_seq_[it->seq_] = it;
+        by_key_[it->key_] = it;
+    }
+
+    records_ = entries_.size();
+    next_seq_ = seq;
+
+    file_.clear();
+    file_.open(filename_.c_str(),
+               std::ios::in | std::ios::out | std::ios::binary);
+    if (!file_.is_open()) {
+        isc_throw(D2SpillQueueError, "unable to open spill file: "
+                  << filename_);
+    }
+}
+
+} // namespace isc::d2
+} // namespace isc
@@ -0,0 +1,216 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef D2_SPILL_QUEUE_H
+#define D2_SPILL_QUEUE_H
+
+/// @file d2_spill_queue.h This file defines the class D2SpillQueue.
+
+#include <exceptions/exceptions.h>
+#include <dhcp_ddns/ncr_msg.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <deque>
+#include <fstream>
+#include <list>
+#include <map>
+#include <string>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Thrown if the spill queue encounters an error.
+class D2SpillQueueError : public isc::Exception {
+public:
+    D2SpillQueueError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Disk backed FIFO of NameChangeRequests.
+///
+/// D2SpillQueue holds the requests which do not fit in the D2QueueMgr
+/// in-memory queue, and the in-memory queue contents at shutdown, so that
+/// they survive both backpressure and restarts.
+///
+/// The file is an append-only journal of records. Each record begins with
+/// a one byte type and an eight byte sequence number:
+///
+/// - ADD records carry the request in the binary NameChangeRequest format,
+/// preceded by its two byte length.
+/// - REMOVE records mark the request with the given sequence number as
+/// consumed or superseded.
+///
+/// Only an index of the live requests (sequence number, key and file
+/// offset) is held in memory. Requests are read back from the file
+/// sequentially as they are popped. When opened, the journal is replayed
+/// to rebuild the index.
+///
+/// Adding a request supersedes a pending request with the same key, i.e.
+/// the same FQDN, IP address, DHCID and forward/reverse flags: the newest
+/// request reflects the latest state of the lease so only it needs to be
+/// carried out.
+///
+/// The file is compacted, i.e. rewritten with only the live requests, when
+/// the number of dead records exceeds both COMPACT_THRESHOLD and the number
+/// of live requests.
+class D2SpillQueue : public boost::noncopyable {
+public:
+    /// @brief Defines a queue of requests.
+    typedef std::deque<dhcp_ddns::NameChangeRequestPtr> RequestQueue;
+
+    /// @brief Minimum number of dead records before compacting.
+    static const size_t COMPACT_THRESHOLD = 1024;
+
+    /// @brief Constructor
+    ///
+    /// Opens the given file, creating it if it does not exist, and replays
+    /// its contents. A truncated trailing record, e.g. one being written
+    /// when the server crashed, is discarded.
+    ///
+    /// @param filename name of the spill file.
+    ///
+    /// @throw D2SpillQueueError if the file cannot be opened or holds
+    /// invalid records.
+    explicit D2SpillQueue(const std::string& filename);
+
+    /// @brief Destructor
+    ~D2SpillQueue();
+
+    /// @brief Appends a request to the queue.
+    ///
+    /// A pending request with the same key is superseded.
+    ///
+    /// @param ncr request to append.
+    ///
+    /// @throw D2SpillQueueError if the request cannot be written.
+    void push(const dhcp_ddns::NameChangeRequestPtr& ncr);
+
+    /// @brief Removes and returns the request at the front of the queue.
+    ///
+    /// @return the request or null if the queue is empty.
+    ///
+    /// @throw D2SpillQueueError if the request cannot be read back.
+    dhcp_ddns::NameChangeRequestPtr pop();
+
+    /// @brief Rewrites the file with only the live requests.
+    ///
+    /// @param head requests to place ahead of the live requests, e.g. the
+    /// contents of the in-memory queue at shutdown. They do not supersede
+    /// and are not superseded by live requests.
+    ///
+    /// @throw D2SpillQueueError if the file cannot be rewritten.
+    void compact(const RequestQueue& head = RequestQueue());
+
+    /// @brief Returns the number of requests in the queue.
+    size_t size() const {
+        return (entries_.size());
+    }
+
+    /// @brief Returns true if the queue is empty.
+    bool empty() const {
+        return (entries_.empty());
+    }
+
+    /// @brief Returns the number of records in the file not describing
+    /// a live request.
+    size_t getDeadRecords() const {
+        return (records_ - entries_.size());
+    }
+
+    /// @brief Returns the number of requests superseded since opening.
+    size_t getSuperseded() const {
+        return (superseded_);
+    }
+
+    /// @brief Returns the name of the spill file.
+    const std::string& getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Returns the key used to supersede requests.
+    ///
+    /// @param ncr request to get the key of.
+    static std::string makeKey(const dhcp_ddns::NameChangeRequest& ncr);
+
+private:
+    /// @brief Index entry of a live request.
+    struct Entry {
+        /// @brief Sequence number of the ADD record.
+        uint64_t seq_;
+
+        /// @brief Key of the request.
+        std::string key_;
+
+        /// @brief File offset of the request length.
+        std::streamoff offset_;
+    };
+
+    /// @brief Type of the list of live requests in FIFO order.
+    typedef std::list<Entry> EntryList;
+
+    /// @brief Opens the file and replays it.
+    void open();
+
+    /// @brief Adds an index entry, superseding one with the same key.
+    ///
+    /// @return sequence number of the superseded entry, or 0 if none.
+    uint64_t addEntry(const uint64_t seq, const std::string& key,
+                      const std::streamoff offset);
+
+    /// @brief Removes the index entry with the given sequence number.
+    ///
+    /// @return true if an entry was removed.
+    bool removeEntry(const uint64_t seq);
+
+    /// @brief Appends a record to the file.
+    ///
+    /// @param data record data.
+    /// @param length record length.
+    /// @return the file offset of the record.
+    std::streamoff append(const void* data, const size_t length);
+
+    /// @brief Appends a REMOVE record.
+    void appendRemove(const uint64_t seq);
+
+    /// @brief Reads the request at the given file offset.
+    dhcp_ddns::NameChangeRequestPtr readAt(const std::streamoff offset);
+
+    /// @brief Compacts the file if there are enough dead records.
+    void maybeCompact();
+
+    /// @brief Name of the spill file.
+    std::string filename_;
+
+    /// @brief The spill file.
+    std::fstream file_;
+
+    /// @brief Live requests in FIFO order.
+    EntryList entries_;
+
+    /// @brief Live requests by key.
+    std::map<std::string, EntryList::iterator> by_key_;
+
+    /// @brief Live requests by sequence number.
+    std::map<uint64_t, EntryList::iterator> by_seq_;
+
+    /// @brief Next sequence number.
+    uint64_t next_seq_;
+
+    /// @brief Number of records in the file.
+    size_t records_;
+
+    /// @brief Number of requests superseded since opening.
+    size_t superseded_;
+};
+
+/// @brief Defines a pointer for D2SpillQueue instances.
+typedef boost::shared_ptr<D2SpillQueue> D2SpillQueuePtr;
+
+} // namespace isc::d2
+} // namespace isc
+
+#endif
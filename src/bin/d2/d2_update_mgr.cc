@@ -38,10 +38,13 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
 
     // Use setter to do validation.
     setMaxTransactions(max_transactions);
+
+    channel_.reset(new DNSUpdateChannel(*io_service_));
 }
 
 D2UpdateMgr::~D2UpdateMgr() {
     transaction_list_.clear();
+    channel_->close();
 }
 
 void D2UpdateMgr::sweep() {
@@ -206,6 +209,9 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
                                               cfg_mgr_));
     }
 
+    // Let the transaction share the update channel with the others.
+    trans->setDNSUpdateChannel(channel_);
+
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
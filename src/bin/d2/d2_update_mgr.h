@@ -14,6 +14,7 @@
 #include <d2/d2_log.h>
 #include <d2/d2_queue_mgr.h>
 #include <d2/d2_cfg_mgr.h>
+#include <d2/dns_update_channel.h>
 #include <d2/nc_trans.h>
 
 #include <boost/noncopyable.hpp>
@@ -65,9 +66,11 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 class D2UpdateMgr : public boost::noncopyable {
 public:
     /// @brief Maximum number of concurrent transactions
-    /// NOTE that 32 is an arbitrary choice picked for the initial
-    /// implementation.
-    static const size_t MAX_TRANSACTIONS_DEFAULT = 32;
+    /// The transactions share the sockets of the update channel, so this
+    /// number is not limited by the number of sockets which may be open.
+    /// The number of updates outstanding with a single server is limited
+    /// by the channel.
+    static const size_t MAX_TRANSACTIONS_DEFAULT = 256;
 
     // @todo This structure is not yet used. It is here in anticipation of
     // enabled statistics capture.
@@ -169,6 +172,13 @@ public:
         return (io_service_);
     }
 
+    /// @brief Returns the channel shared by the transactions.
+    ///
+    /// @return returns a reference to the channel pointer
+    const DNSUpdateChannelPtr& getDNSUpdateChannel() const {
+        return (channel_);
+    }
+
     /// @brief Returns the maximum number of concurrent transactions.
     size_t getMaxTransactions() const {
         return (max_transactions_);
@@ -243,6 +253,9 @@ private:
     /// @brief Maximum number of concurrent transactions.
     size_t max_transactions_;
 
+    /// @brief Channel carrying the DNS Update exchanges of all transactions.
+    DNSUpdateChannelPtr channel_;
+
     /// @brief List of transactions.
     TransactionList transaction_list_;
 };
@@ -20,6 +20,14 @@ namespace {
 // DNSClient class.
 const size_t DEFAULT_BUFFER_SIZE = 128;
 
+// The largest DNS message which may be sent over UDP without EDNS0
+// (RFC 1035, section 4.2.1). Larger messages are sent over TCP.
+const size_t MAX_UDP_MESSAGE_SIZE = 512;
+
+// Offset and mask of the TC (truncation) bit in the DNS message header.
+const size_t TC_FLAG_OFFSET = 2;
+const uint8_t TC_FLAG_MASK = 0x02;
+
 }
 
 using namespace isc::util;
@@ -55,11 +63,24 @@ public:
     DNSClient::Protocol proto_;
     // TSIG context used to sign outbound and verify inbound messages.
     dns::TSIGContextPtr tsig_context_;
+    // A shared channel carrying the exchanges or null if each exchange
+    // should use its own IOFetch.
+    DNSUpdateChannelPtr channel_;
+
+    // State of the current exchange, kept in case it must be retried
+    // over TCP when the server truncates its response.
+    asiolink::IOService* io_service_;
+    asiolink::IOAddress ns_addr_;
+    uint16_t ns_port_;
+    util::OutputBufferPtr msg_buf_;
+    int wait_;
+    asiodns::IOFetch::Protocol fetch_proto_;
 
     // Constructor and Destructor
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                   DNSClient::Callback* callback,
-                  const DNSClient::Protocol proto);
+                  const DNSClient::Protocol proto,
+                  const DNSUpdateChannelPtr& channel);
     virtual ~DNSClientImpl();
 
     // This internal callback is called when the DNS update message exchange is
@@ -76,15 +97,21 @@ public:
                   const unsigned int wait,
                   const dns::TSIGKeyPtr& tsig_key);
 
+    // Sends the rendered message of the current exchange.
+    void send(const asiodns::IOFetch::Protocol protocol);
+
     // This function maps the IO error to the DNSClient error.
     DNSClient::Status getStatus(const asiodns::IOFetch::Result);
 };
 
 DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                              DNSClient::Callback* callback,
-                             const DNSClient::Protocol proto)
+                             const DNSClient::Protocol proto,
+                             const DNSUpdateChannelPtr& channel)
     : in_buf_(new OutputBuffer(DEFAULT_BUFFER_SIZE)),
-      response_(response_placeholder), callback_(callback), proto_(proto) {
+      response_(response_placeholder), callback_(callback), proto_(proto),
+      channel_(channel), io_service_(0), ns_addr_(IOAddress::IPV4_ZERO_ADDRESS()),
+      ns_port_(0), msg_buf_(), wait_(0), fetch_proto_(IOFetch::UDP) {
 
     // Response should be an empty pointer. It gets populated by the
     // operator() method.
@@ -92,17 +119,6 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
         isc_throw(isc::BadValue, "Response buffer pointer should be null");
     }
 
-    // @todo Currently we only support UDP. The support for TCP is planned for
-    // the future release.
-    if (proto_ == DNSClient::TCP) {
-        isc_throw(isc::NotImplemented, "TCP is currently not supported as a"
-                  << " Transport protocol for DNS Updates; please use UDP");
-    }
-
-    // Given that we already eliminated the possibility that TCP is used, it
-    // would be sufficient  to check that (proto != DNSClient::UDP). But, once
-    // support TCP is added the check above will disappear and the extra check
-    // will be needed here anyway.
     // Note that cascaded check is used here instead of:
     //   if (proto_ != DNSClient::TCP && proto_ != DNSClient::UDP)..
     // because some versions of GCC compiler complain that check above would
@@ -118,6 +134,10 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    // The channel must not call us back once we're gone.
+    if (channel_) {
+        channel_->cancel(this);
+    }
 }
 
 void
@@ -125,6 +145,21 @@ DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
     // Get the status from IO. If no success, we just call user's callback
     // and pass the status code.
     DNSClient::Status status = getStatus(result);
+
+    // The server couldn't fit its response in a UDP message. Send the
+    // same request again over TCP. The TSIG context is left untouched as
+    // the truncated response hasn't been verified.
+    if ((status == DNSClient::SUCCESS) && (fetch_proto_ == IOFetch::UDP) &&
+        (in_buf_->getLength() > TC_FLAG_OFFSET) &&
+        ((*in_buf_)[TC_FLAG_OFFSET] & TC_FLAG_MASK)) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_UPDATE_RESPONSE_TRUNCATED)
+            .arg(ns_addr_.toText()).arg(ns_port_);
+        in_buf_->clear();
+        send(IOFetch::TCP);
+        return;
+    }
+
     if (status == DNSClient::SUCCESS) {
         // Allocate a new response message. (Note that Message::fromWire
         // may only be run once per message, so we need to start fresh
@@ -213,25 +248,57 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // invalid message object is given.
     update.toWire(renderer, tsig_context_.get());
 
+    // Remember the exchange in case it has to be retried over TCP.
+    // Timeout value is explicitly cast to the int type to avoid warnings about
+    // overflows when doing implicit cast. It should have been checked by the
+    // caller that the unsigned timeout value will fit into int.
+    io_service_ = &io_service;
+    ns_addr_ = ns_addr;
+    ns_port_ = ns_port;
+    msg_buf_ = msg_buf;
+    wait_ = static_cast<int>(wait);
+
+    // Obey the caller's preference unless the message is too large to be
+    // sent over UDP.
+    if ((proto_ == DNSClient::TCP) ||
+        (msg_buf->getLength() > MAX_UDP_MESSAGE_SIZE)) {
+        send(IOFetch::TCP);
+    } else {
+        send(IOFetch::UDP);
+    }
+}
+
+void
+DNSClientImpl::send(const IOFetch::Protocol protocol) {
+    fetch_proto_ = protocol;
+
+    // The shared channel multiplexes this exchange with the exchanges of
+    // other clients over a single socket or a pooled TCP connection. It
+    // calls operator()(Status) when the exchange completes, the same as
+    // IOFetch.
+    if (channel_) {
+        channel_->send(msg_buf_, ns_addr_, ns_port_, in_buf_, this, wait_,
+                       protocol);
+        return;
+    }
+
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
     // this object as a completion callback for the message exchange. As a
     // result operator()(Status) will be called.
-
-    // Timeout value is explicitly cast to the int type to avoid warnings about
-    // overflows when doing implicit cast. It should have been checked by the
-    // caller that the unsigned timeout value will fit into int.
-    IOFetch io_fetch(IOFetch::UDP, io_service, msg_buf, ns_addr, ns_port,
-                     in_buf_, this, static_cast<int>(wait));
+    IOFetch io_fetch(protocol, *io_service_, msg_buf_, ns_addr_, ns_port_,
+                     in_buf_, this, wait_);
 
     // Post the task to the task queue in the IO service. Caller will actually
     // run these tasks by executing IOService::run.
-    io_service.post(io_fetch);
+    io_service_->post(io_fetch);
 }
 
 DNSClient::DNSClient(D2UpdateMessagePtr& response_placeholder,
-                     Callback* callback, const DNSClient::Protocol proto)
-    : impl_(new DNSClientImpl(response_placeholder, callback, proto)) {
+                     Callback* callback, const DNSClient::Protocol proto,
+                     const DNSUpdateChannelPtr& channel)
+    : impl_(new DNSClientImpl(response_placeholder, callback, proto,
+                              channel)) {
 }
 
 DNSClient::~DNSClient() {
@@ -8,6 +8,7 @@
 #define DNS_CLIENT_H
 
 #include <d2/d2_update_message.h>
+#include <d2/dns_update_channel.h>
 
 #include <asiolink/io_service.h>
 #include <util/buffer.h>
@@ -39,13 +40,16 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
-/// @todo Ultimately, this class will support both TCP and UDP Transport.
-/// Currently only UDP is supported and can be specified as a preferred
-/// protocol. @c DNSClient constructor will throw an exception if TCP is
-/// specified. Once both protocols are supported, the @c DNSClient logic will
-/// try to obey caller's preference. However, it may use the other protocol if
-/// on its own discretion, when there is a legitimate reason to do so. For
-/// example, if communication with the server using preferred protocol fails.
+/// By default, each DNS Update exchange is carried out by its own
+/// @c asiodns::IOFetch using its own socket. If a @c DNSUpdateChannel is
+/// supplied to the constructor, the exchanges are carried out through the
+/// channel which shares its sockets and TCP connections among all clients
+/// using it.
+///
+/// Both UDP and TCP Transport are supported. The @c DNSClient obeys the
+/// caller's preference, except that it uses TCP when the update message
+/// is too large to be sent over UDP (more than 512 bytes) and it repeats
+/// the update over TCP when the server's response over UDP is truncated.
 class DNSClient {
 public:
 
@@ -92,8 +96,11 @@ public:
     /// if an error occurs. NULL value disables callback invocation.
     /// @param proto caller's preference regarding Transport layer protocol to
     /// be used by DNS Client to communicate with a server.
+    /// @param channel Pointer to the channel through which the exchanges
+    /// should be carried out. If null, each exchange uses its own socket.
     DNSClient(D2UpdateMessagePtr& response_placeholder, Callback* callback,
-              const Protocol proto = UDP);
+              const Protocol proto = UDP,
+              const DNSUpdateChannelPtr& channel = DNSUpdateChannelPtr());
 
     /// @brief Virtual destructor, does nothing.
     ~DNSClient();
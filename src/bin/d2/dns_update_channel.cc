@@ -0,0 +1,691 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <d2/d2_log.h>
+#include <d2/dns_update_channel.h>
+#include <dns/name.h>
+#include <util/random/qid_gen.h>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/bind.hpp>
+
+namespace isc {
+namespace d2 {
+
+namespace {
+
+/// @brief Size of the DNS message header.
+const size_t DNS_HEADER_SIZE = 12;
+
+/// @brief Size of the receive buffer (maximum UDP payload).
+const size_t RECEIVE_BUFFER_SIZE = 65535;
+
+/// @brief Reads the message ID from the DNS message header.
+uint16_t
+readQid(const uint8_t* data) {
+    return (static_cast<uint16_t>((data[0] << 8) | data[1]));
+}
+
+/// @brief Checks if a response repeats the question section of the request.
+///
+/// The names are compared case insensitively, the types and classes
+/// must be equal.
+///
+/// @param request Rendered request.
+/// @param data Response data.
+/// @param length Response length.
+///
+/// @return true if the question sections match, false otherwise or when
+/// either message is malformed.
+bool
+matchQuestion(const isc::util::OutputBuffer& request, const uint8_t* data,
+              const size_t length) {
+    try {
+        isc::util::InputBuffer request_buf(request.getData(),
+                                           request.getLength());
+        isc::util::InputBuffer response_buf(data, length);
+        request_buf.setPosition(4);
+        response_buf.setPosition(4);
+        const uint16_t count = request_buf.readUint16();
+        if (response_buf.readUint16() != count) {
+            return (false);
+        }
+
+        request_buf.setPosition(DNS_HEADER_SIZE);
+        response_buf.setPosition(DNS_HEADER_SIZE);
+        for (unsigned i = 0; i < count; ++i) {
+            if (isc::dns::Name(request_buf) != isc::dns::Name(response_buf)) {
+                return (false);
+            }
+            // Type and class.
+            if (request_buf.readUint32() != response_buf.readUint32()) {
+                return (false);
+            }
+        }
+
+    } catch (const isc::Exception&) {
+        return (false);
+    }
+    return (true);
+}
+
+}
+
+using namespace isc::asiolink;
+using namespace isc::asiodns;
+using namespace isc::util;
+using namespace isc::util::random;
+using namespace boost::asio::ip;
+
+const size_t DNSUpdateChannel::MAX_IN_FLIGHT_DEFAULT;
+const size_t DNSUpdateChannel::MAX_CONNECTIONS_DEFAULT;
+const long DNSUpdateChannel::IDLE_TIMEOUT_DEFAULT;
+const size_t DNSUpdateChannel::SOCKET_POOL_SIZE;
+const size_t DNSUpdateChannel::MAX_SOCKET_USES_DEFAULT;
+
+DNSUpdateChannel::DNSUpdateChannel(IOService& io_service,
+                                   const size_t max_in_flight)
+    : io_service_(io_service), max_in_flight_(0),
+      max_connections_(MAX_CONNECTIONS_DEFAULT),
+      idle_timeout_(IDLE_TIMEOUT_DEFAULT),
+      max_socket_uses_(MAX_SOCKET_USES_DEFAULT),
+      sockets4_(SOCKET_POOL_SIZE), sockets6_(SOCKET_POOL_SIZE), retired_(),
+      servers_() {
+    setMaxInFlight(max_in_flight);
+}
+
+DNSUpdateChannel::~DNSUpdateChannel() {
+    close();
+}
+
+void
+DNSUpdateChannel::setMaxInFlight(const size_t max_in_flight) {
+    if (max_in_flight == 0) {
+        isc_throw(BadValue, "maximum number of in-flight DNS updates per"
+                  " server must be greater than 0");
+    }
+    max_in_flight_ = max_in_flight;
+}
+
+void
+DNSUpdateChannel::setMaxConnections(const size_t max_connections) {
+    if (max_connections == 0) {
+        isc_throw(BadValue, "maximum number of TCP connections per"
+                  " server must be greater than 0");
+    }
+    max_connections_ = max_connections;
+}
+
+void
+DNSUpdateChannel::setIdleTimeout(const long idle_timeout) {
+    if (idle_timeout <= 0) {
+        isc_throw(BadValue, "TCP connection idle timeout must be greater"
+                  " than 0");
+    }
+    idle_timeout_ = idle_timeout;
+}
+
+void
+DNSUpdateChannel::setMaxSocketUses(const size_t max_socket_uses) {
+    if (max_socket_uses == 0) {
+        isc_throw(BadValue, "number of DNS updates sent over a UDP socket"
+                  " must be greater than 0");
+    }
+    max_socket_uses_ = max_socket_uses;
+}
+
+DNSUpdateChannel::ServerKey
+DNSUpdateChannel::makeKey(const IOAddress& ns_addr, const uint16_t ns_port,
+                          const IOFetch::Protocol protocol) {
+    return (ServerKey(protocol, Endpoint(address::from_string(ns_addr.toText()),
+                                         ns_port)));
+}
+
+void
+DNSUpdateChannel::send(const OutputBufferPtr& msg,
+                       const IOAddress& ns_addr,
+                       const uint16_t ns_port,
+                       const OutputBufferPtr& in_buf,
+                       IOFetch::Callback* callback,
+                       const int timeout,
+                       const IOFetch::Protocol protocol) {
+    if (!msg || (msg->getLength() < DNS_HEADER_SIZE)) {
+        isc_throw(BadValue, "DNS update message is too short");
+    }
+
+    if (!callback) {
+        isc_throw(BadValue, "DNS update callback must not be null");
+    }
+
+    if ((protocol != IOFetch::UDP) && (protocol != IOFetch::TCP)) {
+        isc_throw(BadValue, "invalid transport protocol '" << protocol
+                  << "' specified for DNS update");
+    }
+
+    if ((protocol == IOFetch::TCP) && (msg->getLength() > 0xffff)) {
+        isc_throw(BadValue, "DNS update message is too long");
+    }
+
+    ExchangePtr exchange(new Exchange(io_service_));
+    exchange->msg_ = msg;
+    exchange->in_buf_ = in_buf;
+    exchange->callback_ = callback;
+    exchange->qid_ = readQid(static_cast<const uint8_t*>(msg->getData()));
+    exchange->key_ = makeKey(ns_addr, ns_port, protocol);
+
+    // Make sure the socket can be opened before we take the exchange.
+    if (protocol == IOFetch::UDP) {
+        selectSocket(exchange->key_.second);
+    }
+
+    if (timeout >= 0) {
+        exchange->timer_.expires_from_now(boost::posix_time::milliseconds(timeout));
+        exchange->timer_.async_wait(boost::bind(&DNSUpdateChannel::timeoutHandler,
+                                                shared_from_this(), exchange, _1));
+    }
+
+    servers_[exchange->key_].queue_.push_back(exchange);
+    pump(exchange->key_);
+}
+
+void
+DNSUpdateChannel::cancel(IOFetch::Callback* callback) {
+    std::list<ExchangePtr> cancelled;
+    for (auto server = servers_.begin(); server != servers_.end(); ++server) {
+        for (auto ex = server->second.in_flight_.begin();
+             ex != server->second.in_flight_.end(); ++ex) {
+            if (ex->second->callback_ == callback) {
+                cancelled.push_back(ex->second);
+            }
+        }
+        for (auto ex = server->second.queue_.begin();
+             ex != server->second.queue_.end(); ++ex) {
+            if ((*ex)->callback_ == callback) {
+                cancelled.push_back(*ex);
+            }
+        }
+    }
+
+    for (auto ex = cancelled.begin(); ex != cancelled.end(); ++ex) {
+        (*ex)->done_ = true;
+        boost::system::error_code ignored;
+        (*ex)->timer_.cancel(ignored);
+        remove(*ex);
+    }
+
+    // Cancelled exchanges may have freed room for the queued ones.
+    for (auto ex = cancelled.begin(); ex != cancelled.end(); ++ex) {
+        pump((*ex)->key_);
+    }
+}
+
+void
+DNSUpdateChannel::close() {
+    for (auto server = servers_.begin(); server != servers_.end(); ++server) {
+        for (auto ex = server->second.in_flight_.begin();
+             ex != server->second.in_flight_.end(); ++ex) {
+            ex->second->done_ = true;
+            boost::system::error_code ignored;
+            ex->second->timer_.cancel(ignored);
+            ex->second->conn_.reset();
+            ex->second->socket_.reset();
+        }
+        for (auto ex = server->second.queue_.begin();
+             ex != server->second.queue_.end(); ++ex) {
+            (*ex)->done_ = true;
+            boost::system::error_code ignored;
+            (*ex)->timer_.cancel(ignored);
+        }
+        for (auto conn = server->second.connections_.begin();
+             conn != server->second.connections_.end(); ++conn) {
+            (*conn)->closed_ = true;
+            boost::system::error_code ignored;
+            (*conn)->idle_timer_.cancel(ignored);
+            (*conn)->socket_.close(ignored);
+        }
+    }
+    servers_.clear();
+
+    for (size_t i = 0; i < SOCKET_POOL_SIZE; ++i) {
+        if (sockets4_[i]) {
+            closeSocket(sockets4_[i]);
+            sockets4_[i].reset();
+        }
+        if (sockets6_[i]) {
+            closeSocket(sockets6_[i]);
+            sockets6_[i].reset();
+        }
+    }
+    for (auto socket = retired_.begin(); socket != retired_.end(); ++socket) {
+        closeSocket(*socket);
+    }
+    retired_.clear();
+}
+
+size_t
+DNSUpdateChannel::getInFlight(const IOAddress& ns_addr,
+                              const uint16_t ns_port,
+                              const IOFetch::Protocol protocol) const {
+    auto server = servers_.find(makeKey(ns_addr, ns_port, protocol));
+    return (server == servers_.end() ? 0 : server->second.in_flight_.size());
+}
+
+size_t
+DNSUpdateChannel::getQueued(const IOAddress& ns_addr,
+                            const uint16_t ns_port,
+                            const IOFetch::Protocol protocol) const {
+    auto server = servers_.find(makeKey(ns_addr, ns_port, protocol));
+    return (server == servers_.end() ? 0 : server->second.queue_.size());
+}
+
+size_t
+DNSUpdateChannel::getConnections(const IOAddress& ns_addr,
+                                 const uint16_t ns_port) const {
+    auto server = servers_.find(makeKey(ns_addr, ns_port, IOFetch::TCP));
+    return (server == servers_.end() ? 0 : server->second.connections_.size());
+}
+
+DNSUpdateChannel::UdpSocketPtr
+DNSUpdateChannel::selectSocket(const Endpoint& remote) {
+    std::vector<UdpSocketPtr>& pool = remote.address().is_v4() ? sockets4_ :
+        sockets6_;
+    const size_t slot = QidGenerator::getInstance().generateQid() % pool.size();
+    UdpSocketPtr& socket = pool[slot];
+    if (!socket) {
+        // Binding to port 0 lets the system pick a random ephemeral port.
+        UdpSocketPtr new_socket(new UdpSocket(io_service_));
+        new_socket->socket_.open(remote.protocol());
+        new_socket->socket_.bind(Endpoint(remote.protocol(), 0));
+        new_socket->buffer_.resize(RECEIVE_BUFFER_SIZE);
+        socket = new_socket;
+        doReceive(socket);
+    }
+    return (socket);
+}
+
+void
+DNSUpdateChannel::retireSocket(const UdpSocketPtr& socket) {
+    for (auto s = sockets4_.begin(); s != sockets4_.end(); ++s) {
+        if (*s == socket) {
+            s->reset();
+        }
+    }
+    for (auto s = sockets6_.begin(); s != sockets6_.end(); ++s) {
+        if (*s == socket) {
+            s->reset();
+        }
+    }
+    socket->retired_ = true;
+    retired_.push_back(socket);
+}
+
+void
+DNSUpdateChannel::closeSocket(const UdpSocketPtr& socket) {
+    socket->closed_ = true;
+    boost::system::error_code ignored;
+    socket->socket_.close(ignored);
+}
+
+void
+DNSUpdateChannel::doReceive(const UdpSocketPtr& socket) {
+    socket->socket_.async_receive_from(boost::asio::buffer(&socket->buffer_[0],
+                                                           socket->buffer_.size()),
+                                       socket->sender_,
+                                       boost::bind(&DNSUpdateChannel::receiveHandler,
+                                                   shared_from_this(), socket,
+                                                   _1, _2));
+}
+
+void
+DNSUpdateChannel::receiveHandler(const UdpSocketPtr& socket,
+                                 const boost::system::error_code& ec,
+                                 const size_t length) {
+    if (socket->closed_) {
+        return;
+    }
+
+    if (!ec && (length >= DNS_HEADER_SIZE)) {
+        dispatch(ServerKey(IOFetch::UDP, socket->sender_), ConnectionPtr(),
+                 socket, &socket->buffer_[0], length);
+    }
+
+    // The callback may have closed the channel or the socket.
+    if (!socket->closed_) {
+        doReceive(socket);
+    }
+}
+
+void
+DNSUpdateChannel::dispatch(const ServerKey& key, const ConnectionPtr& conn,
+                           const UdpSocketPtr& socket, const uint8_t* data,
+                           const size_t length) {
+    ExchangePtr exchange;
+    auto server = servers_.find(key);
+    if (server != servers_.end()) {
+        auto ex = server->second.in_flight_.find(readQid(data));
+        // The response must come on the connection or socket the request
+        // was sent on and repeat its question section.
+        if ((ex != server->second.in_flight_.end()) &&
+            (ex->second->conn_ == conn) && (ex->second->socket_ == socket) &&
+            matchQuestion(*ex->second->msg_, data, length)) {
+            exchange = ex->second;
+        }
+    }
+
+    if (exchange) {
+        exchange->in_buf_->clear();
+        exchange->in_buf_->writeData(data, length);
+        complete(exchange, IOFetch::SUCCESS);
+
+    } else {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_UPDATE_CHANNEL_UNEXPECTED_RESPONSE)
+            .arg(key.second.address().to_string())
+            .arg(key.second.port());
+    }
+}
+
+void
+DNSUpdateChannel::pump(const ServerKey& key) {
+    auto server = servers_.find(key);
+    if (server == servers_.end()) {
+        return;
+    }
+
+    std::map<uint16_t, ExchangePtr>& in_flight = server->second.in_flight_;
+    std::list<ExchangePtr>& queue = server->second.queue_;
+    for (auto ex = queue.begin();
+         (ex != queue.end()) && (in_flight.size() < max_in_flight_); ) {
+        // Wait for the outstanding exchange using the same ID to complete.
+        if (in_flight.count((*ex)->qid_) > 0) {
+            ++ex;
+            continue;
+        }
+
+        ExchangePtr exchange = *ex;
+        ex = queue.erase(ex);
+        in_flight[exchange->qid_] = exchange;
+
+        if (key.first == IOFetch::UDP) {
+            UdpSocketPtr socket = selectSocket(key.second);
+            exchange->socket_ = socket;
+            ++socket->in_flight_;
+            socket->socket_.async_send_to(boost::asio::buffer(exchange->msg_->getData(),
+                                                              exchange->msg_->getLength()),
+                                          key.second,
+                                          boost::bind(&DNSUpdateChannel::sendHandler,
+                                                      shared_from_this(), exchange,
+                                                      _1));
+            // Move on to a new port once the socket has been used enough.
+            if (++socket->sent_ >= max_socket_uses_) {
+                retireSocket(socket);
+            }
+            continue;
+        }
+
+        // Over TCP the message is preceded by its length.
+        ConnectionPtr conn = selectConnection(key, server->second);
+        exchange->conn_ = conn;
+        ++conn->in_flight_;
+        boost::system::error_code ignored;
+        conn->idle_timer_.cancel(ignored);
+
+        OutputBufferPtr framed(new OutputBuffer(exchange->msg_->getLength() + 2));
+        framed->writeUint16(static_cast<uint16_t>(exchange->msg_->getLength()));
+        framed->writeData(exchange->msg_->getData(), exchange->msg_->getLength());
+        conn->write_queue_.push_back(framed);
+        if (conn->connected_ && !conn->writing_) {
+            doWrite(conn);
+        }
+    }
+
+    if (in_flight.empty() && queue.empty() &&
+        server->second.connections_.empty()) {
+        servers_.erase(server);
+    }
+}
+
+DNSUpdateChannel::ConnectionPtr
+DNSUpdateChannel::selectConnection(const ServerKey& key, Server& server) {
+    ConnectionPtr conn;
+    for (auto c = server.connections_.begin(); c != server.connections_.end();
+         ++c) {
+        if (!conn || ((*c)->in_flight_ < conn->in_flight_)) {
+            conn = *c;
+        }
+    }
+
+    if (!conn || ((conn->in_flight_ > 0) &&
+                  (server.connections_.size() < max_connections_))) {
+        conn.reset(new Connection(io_service_, key));
+        server.connections_.push_back(conn);
+        conn->socket_.async_connect(tcp::endpoint(key.second.address(),
+                                                  key.second.port()),
+                                    boost::bind(&DNSUpdateChannel::connectHandler,
+                                                shared_from_this(), conn, _1));
+    }
+
+    return (conn);
+}
+
+void
+DNSUpdateChannel::connectHandler(const ConnectionPtr& conn,
+                                 const boost::system::error_code& ec) {
+    if (conn->closed_) {
+        return;
+    }
+
+    if (ec) {
+        closeConnection(conn);
+        return;
+    }
+
+    conn->connected_ = true;
+    if (!conn->write_queue_.empty()) {
+        doWrite(conn);
+    }
+    doRead(conn);
+}
+
+void
+DNSUpdateChannel::doWrite(const ConnectionPtr& conn) {
+    conn->writing_ = true;
+    const OutputBufferPtr& framed = conn->write_queue_.front();
+    boost::asio::async_write(conn->socket_,
+                             boost::asio::buffer(framed->getData(),
+                                                 framed->getLength()),
+                             boost::bind(&DNSUpdateChannel::writeHandler,
+                                         shared_from_this(), conn, _1));
+}
+
+void
+DNSUpdateChannel::writeHandler(const ConnectionPtr& conn,
+                               const boost::system::error_code& ec) {
+    if (conn->closed_) {
+        return;
+    }
+
+    conn->writing_ = false;
+    if (ec) {
+        closeConnection(conn);
+        return;
+    }
+
+    conn->write_queue_.pop_front();
+    if (!conn->write_queue_.empty()) {
+        doWrite(conn);
+    }
+}
+
+void
+DNSUpdateChannel::doRead(const ConnectionPtr& conn) {
+    boost::asio::async_read(conn->socket_,
+                            boost::asio::buffer(conn->length_,
+                                                sizeof(conn->length_)),
+                            boost::bind(&DNSUpdateChannel::readLengthHandler,
+                                        shared_from_this(), conn, _1));
+}
+
+void
+DNSUpdateChannel::readLengthHandler(const ConnectionPtr& conn,
+                                    const boost::system::error_code& ec) {
+    if (conn->closed_) {
+        return;
+    }
+
+    const size_t length = readQid(conn->length_);
+    if (ec || (length < DNS_HEADER_SIZE)) {
+        closeConnection(conn);
+        return;
+    }
+
+    conn->data_.resize(length);
+    boost::asio::async_read(conn->socket_,
+                            boost::asio::buffer(&conn->data_[0], length),
+                            boost::bind(&DNSUpdateChannel::readDataHandler,
+                                        shared_from_this(), conn, _1));
+}
+
+void
+DNSUpdateChannel::readDataHandler(const ConnectionPtr& conn,
+                                  const boost::system::error_code& ec) {
+    if (conn->closed_) {
+        return;
+    }
+
+    if (ec) {
+        closeConnection(conn);
+        return;
+    }
+
+    dispatch(conn->key_, conn, UdpSocketPtr(), &conn->data_[0],
+             conn->data_.size());
+
+    // The callback may have closed the channel.
+    if (!conn->closed_) {
+        doRead(conn);
+    }
+}
+
+void
+DNSUpdateChannel::idleHandler(const ConnectionPtr& conn,
+                              const boost::system::error_code& ec) {
+    if ((ec == boost::asio::error::operation_aborted) || conn->closed_) {
+        return;
+    }
+
+    if (conn->in_flight_ == 0) {
+        closeConnection(conn);
+    }
+}
+
+void
+DNSUpdateChannel::closeConnection(const ConnectionPtr& conn) {
+    if (conn->closed_) {
+        return;
+    }
+
+    conn->closed_ = true;
+    boost::system::error_code ignored;
+    conn->idle_timer_.cancel(ignored);
+    conn->socket_.close(ignored);
+
+    std::list<ExchangePtr> failed;
+    auto server = servers_.find(conn->key_);
+    if (server != servers_.end()) {
+        server->second.connections_.remove(conn);
+        for (auto ex = server->second.in_flight_.begin();
+             ex != server->second.in_flight_.end(); ++ex) {
+            if (ex->second->conn_ == conn) {
+                failed.push_back(ex->second);
+            }
+        }
+    }
+
+    // A callback may cancel other exchanges, so check each one is
+    // still outstanding.
+    for (auto ex = failed.begin(); ex != failed.end(); ++ex) {
+        if (!(*ex)->done_) {
+            complete(*ex, IOFetch::NOTSET);
+        }
+    }
+
+    // Forget the server if this was the last thing it had.
+    pump(conn->key_);
+}
+
+void
+DNSUpdateChannel::sendHandler(const ExchangePtr& exchange,
+                              const boost::system::error_code& ec) {
+    if (ec && !exchange->done_) {
+        complete(exchange, IOFetch::NOTSET);
+    }
+}
+
+void
+DNSUpdateChannel::timeoutHandler(const ExchangePtr& exchange,
+                                 const boost::system::error_code& ec) {
+    if ((ec != boost::asio::error::operation_aborted) && !exchange->done_) {
+        complete(exchange, IOFetch::TIME_OUT);
+    }
+}
+
+void
+DNSUpdateChannel::complete(const ExchangePtr& exchange,
+                           const IOFetch::Result result) {
+    exchange->done_ = true;
+    boost::system::error_code ignored;
+    exchange->timer_.cancel(ignored);
+    remove(exchange);
+
+    // Send the next queued exchange before the callback, which may queue
+    // a new one.
+    pump(exchange->key_);
+
+    (*exchange->callback_)(result);
+}
+
+void
+DNSUpdateChannel::remove(const ExchangePtr& exchange) {
+    // Release the connection and close it later if nothing else uses it.
+    ConnectionPtr conn = exchange->conn_;
+    exchange->conn_.reset();
+    if (conn && (--conn->in_flight_ == 0) && !conn->closed_) {
+        conn->idle_timer_.expires_from_now(boost::posix_time::milliseconds(idle_timeout_));
+        conn->idle_timer_.async_wait(boost::bind(&DNSUpdateChannel::idleHandler,
+                                                 shared_from_this(), conn, _1));
+    }
+
+    // Close the socket taken out of the pool when nothing else uses it.
+    UdpSocketPtr socket = exchange->socket_;
+    exchange->socket_.reset();
+    if (socket && (--socket->in_flight_ == 0) && socket->retired_) {
+        closeSocket(socket);
+        retired_.remove(socket);
+    }
+
+    auto server = servers_.find(exchange->key_);
+    if (server == servers_.end()) {
+        return;
+    }
+
+    auto ex = server->second.in_flight_.find(exchange->qid_);
+    if ((ex != server->second.in_flight_.end()) && (ex->second == exchange)) {
+        server->second.in_flight_.erase(ex);
+
+    } else {
+        server->second.queue_.remove(exchange);
+    }
+
+    if (server->second.in_flight_.empty() && server->second.queue_.empty() &&
+        server->second.connections_.empty()) {
+        servers_.erase(server);
+    }
+}
+
+} // namespace d2
+} // namespace isc
@@ -0,0 +1,523 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DNS_UPDATE_CHANNEL_H
+#define DNS_UPDATE_CHANNEL_H
+
+/// @file dns_update_channel.h This file defines the class DNSUpdateChannel.
+
+#include <asiodns/io_fetch.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <util/buffer.h>
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+class DNSUpdateChannel;
+
+/// @brief Defines a pointer to a DNSUpdateChannel.
+typedef boost::shared_ptr<DNSUpdateChannel> DNSUpdateChannelPtr;
+
+/// @brief Carries DNS Update exchanges with many servers over shared sockets
+/// and persistent connections.
+///
+/// When each DNS Update exchange is carried out by its own @c IOFetch, every
+/// exchange opens and closes a UDP socket. The @c DNSUpdateChannel instead
+/// keeps a small pool of UDP sockets per address family and shares them
+/// between all exchanges with all DNS servers. Each exchange is sent over
+/// a randomly chosen socket of the pool, and a socket is replaced by a new
+/// one, bound to a new ephemeral port, after it has carried a configured
+/// number of exchanges. This keeps the source port of the updates hard to
+/// guess. A response is accepted only if it comes from the server's
+/// endpoint to the socket the request was sent over, carries the message
+/// ID of the request and repeats the request's question (zone) section.
+///
+/// Exchanges over TCP are carried out on persistent connections. Up to
+/// a configured number of connections is opened to each server and the
+/// exchanges are spread over them, several of them outstanding on the same
+/// connection at once. A new connection is opened only when all existing
+/// connections to the server are busy. A connection is closed when it has
+/// been idle for a while, or when the server closes it. The exchanges
+/// outstanding on a connection which fails complete with an error.
+///
+/// The number of exchanges outstanding with a single server is limited.
+/// Exchanges above the limit are queued and sent, in order, as the earlier
+/// exchanges complete. An exchange is also queued if another exchange with
+/// the same message ID is outstanding with the same server, so as the
+/// responses can be told apart.
+///
+/// The channel reports completion of an exchange through the
+/// @c asiodns::IOFetch::Callback interface and stores the response in the
+/// caller's buffer, exactly like @c IOFetch does. This allows the
+/// @c DNSClient to use either of them.
+class DNSUpdateChannel : public boost::enable_shared_from_this<DNSUpdateChannel>,
+                         public boost::noncopyable {
+public:
+
+    /// @brief Default maximum number of exchanges outstanding with a server.
+    static const size_t MAX_IN_FLIGHT_DEFAULT = 64;
+
+    /// @brief Default maximum number of TCP connections to a server.
+    static const size_t MAX_CONNECTIONS_DEFAULT = 4;
+
+    /// @brief Default time (in milliseconds) after which an idle TCP
+    /// connection is closed.
+    static const long IDLE_TIMEOUT_DEFAULT = 30000;
+
+    /// @brief Number of UDP sockets kept open per address family.
+    static const size_t SOCKET_POOL_SIZE = 4;
+
+    /// @brief Default number of exchanges sent over a UDP socket before
+    /// it is replaced.
+    static const size_t MAX_SOCKET_USES_DEFAULT = 256;
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service used to carry out the exchanges.
+    /// @param max_in_flight Maximum number of exchanges outstanding with
+    /// a single server.
+    ///
+    /// @throw BadValue if max_in_flight is 0.
+    DNSUpdateChannel(asiolink::IOService& io_service,
+                     const size_t max_in_flight = MAX_IN_FLIGHT_DEFAULT);
+
+    /// @brief Destructor.
+    ///
+    /// Closes the channel.
+    ~DNSUpdateChannel();
+
+    /// @brief Starts (or queues) a DNS Update exchange.
+    ///
+    /// @param msg Buffer holding the rendered DNS Update message.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param in_buf Buffer into which the response will be stored.
+    /// @param callback Callback invoked when the exchange completes.
+    /// @param timeout Timeout (in milliseconds) for the response. It
+    /// includes the time the exchange spends in the queue.
+    /// @param protocol Transport protocol to use.
+    ///
+    /// @throw BadValue if the message is shorter than the DNS header,
+    /// the callback is null or the protocol is invalid.
+    void send(const util::OutputBufferPtr& msg,
+              const asiolink::IOAddress& ns_addr,
+              const uint16_t ns_port,
+              const util::OutputBufferPtr& in_buf,
+              asiodns::IOFetch::Callback* callback,
+              const int timeout,
+              const asiodns::IOFetch::Protocol protocol = asiodns::IOFetch::UDP);
+
+    /// @brief Cancels all exchanges started with the given callback.
+    ///
+    /// The callback is not invoked for the cancelled exchanges. This
+    /// method must be called before the callback object is destroyed.
+    ///
+    /// @param callback Callback of the exchanges to cancel.
+    void cancel(asiodns::IOFetch::Callback* callback);
+
+    /// @brief Closes the sockets and connections and drops all exchanges.
+    ///
+    /// The callbacks are not invoked for the dropped exchanges.
+    void close();
+
+    /// @brief Returns the maximum number of exchanges outstanding with
+    /// a single server.
+    size_t getMaxInFlight() const {
+        return (max_in_flight_);
+    }
+
+    /// @brief Sets the maximum number of exchanges outstanding with
+    /// a single server.
+    ///
+    /// @param max_in_flight New maximum.
+    ///
+    /// @throw BadValue if max_in_flight is 0.
+    void setMaxInFlight(const size_t max_in_flight);
+
+    /// @brief Returns the maximum number of TCP connections to a server.
+    size_t getMaxConnections() const {
+        return (max_connections_);
+    }
+
+    /// @brief Sets the maximum number of TCP connections to a server.
+    ///
+    /// Existing connections above the new maximum are not closed but
+    /// no new connections are opened until their number drops.
+    ///
+    /// @param max_connections New maximum.
+    ///
+    /// @throw BadValue if max_connections is 0.
+    void setMaxConnections(const size_t max_connections);
+
+    /// @brief Returns the time (in milliseconds) after which an idle TCP
+    /// connection is closed.
+    long getIdleTimeout() const {
+        return (idle_timeout_);
+    }
+
+    /// @brief Sets the time after which an idle TCP connection is closed.
+    ///
+    /// @param idle_timeout New idle timeout in milliseconds.
+    ///
+    /// @throw BadValue if idle_timeout is not positive.
+    void setIdleTimeout(const long idle_timeout);
+
+    /// @brief Returns the number of exchanges sent over a UDP socket
+    /// before it is replaced.
+    size_t getMaxSocketUses() const {
+        return (max_socket_uses_);
+    }
+
+    /// @brief Sets the number of exchanges sent over a UDP socket before
+    /// it is replaced.
+    ///
+    /// A replaced socket is closed when the exchanges outstanding on it
+    /// complete.
+    ///
+    /// @param max_socket_uses New number of uses.
+    ///
+    /// @throw BadValue if max_socket_uses is 0.
+    void setMaxSocketUses(const size_t max_socket_uses);
+
+    /// @brief Returns the number of exchanges outstanding with a server.
+    ///
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param protocol Transport protocol.
+    size_t getInFlight(const asiolink::IOAddress& ns_addr,
+                       const uint16_t ns_port,
+                       const asiodns::IOFetch::Protocol protocol =
+                       asiodns::IOFetch::UDP) const;
+
+    /// @brief Returns the number of exchanges queued for a server.
+    ///
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param protocol Transport protocol.
+    size_t getQueued(const asiolink::IOAddress& ns_addr,
+                     const uint16_t ns_port,
+                     const asiodns::IOFetch::Protocol protocol =
+                     asiodns::IOFetch::UDP) const;
+
+    /// @brief Returns the number of open TCP connections to a server.
+    ///
+    /// It includes the connections which are being established.
+    ///
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    size_t getConnections(const asiolink::IOAddress& ns_addr,
+                          const uint16_t ns_port) const;
+
+private:
+
+    /// @brief Endpoint type.
+    typedef boost::asio::ip::udp::endpoint Endpoint;
+
+    /// @brief Identifies a server: transport protocol and endpoint.
+    typedef std::pair<asiodns::IOFetch::Protocol, Endpoint> ServerKey;
+
+    /// @brief Returns the key of a server.
+    ///
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param protocol Transport protocol.
+    static ServerKey makeKey(const asiolink::IOAddress& ns_addr,
+                             const uint16_t ns_port,
+                             const asiodns::IOFetch::Protocol protocol);
+
+    /// @brief State of a persistent TCP connection.
+    struct Connection {
+        /// @brief Constructor.
+        ///
+        /// @param io_service IO service used by the connection.
+        /// @param key Key of the server the connection is to.
+        Connection(asiolink::IOService& io_service, const ServerKey& key)
+            : key_(key), socket_(io_service.get_io_service()),
+              idle_timer_(io_service.get_io_service()), connected_(false),
+              closed_(false), writing_(false), write_queue_(), in_flight_(0),
+              data_() {
+            length_[0] = length_[1] = 0;
+        }
+
+        /// @brief Key of the server.
+        ServerKey key_;
+
+        /// @brief Connection socket.
+        boost::asio::ip::tcp::socket socket_;
+
+        /// @brief Timer closing the connection when idle.
+        boost::asio::deadline_timer idle_timer_;
+
+        /// @brief Indicates if the connection has been established.
+        bool connected_;
+
+        /// @brief Indicates if the connection has been closed.
+        bool closed_;
+
+        /// @brief Indicates if a write is in progress.
+        bool writing_;
+
+        /// @brief Framed messages waiting to be written.
+        std::list<util::OutputBufferPtr> write_queue_;
+
+        /// @brief Number of exchanges outstanding on the connection.
+        size_t in_flight_;
+
+        /// @brief Length prefix of the message being read.
+        uint8_t length_[2];
+
+        /// @brief Message being read.
+        std::vector<uint8_t> data_;
+    };
+
+    /// @brief Pointer to a connection.
+    typedef boost::shared_ptr<Connection> ConnectionPtr;
+
+    /// @brief State of a UDP socket of the pool.
+    struct UdpSocket {
+        /// @brief Constructor.
+        ///
+        /// @param io_service IO service used by the socket.
+        UdpSocket(asiolink::IOService& io_service)
+            : socket_(io_service.get_io_service()), buffer_(), sender_(),
+              sent_(0), in_flight_(0), retired_(false), closed_(false) {
+        }
+
+        /// @brief The socket.
+        boost::asio::ip::udp::socket socket_;
+
+        /// @brief Receive buffer.
+        std::vector<uint8_t> buffer_;
+
+        /// @brief Sender of the datagram being received.
+        Endpoint sender_;
+
+        /// @brief Number of exchanges sent over the socket.
+        size_t sent_;
+
+        /// @brief Number of exchanges outstanding on the socket.
+        size_t in_flight_;
+
+        /// @brief Indicates if the socket has been taken out of the pool.
+        bool retired_;
+
+        /// @brief Indicates if the socket has been closed.
+        bool closed_;
+    };
+
+    /// @brief Pointer to a UDP socket of the pool.
+    typedef boost::shared_ptr<UdpSocket> UdpSocketPtr;
+
+    /// @brief State of a single exchange.
+    struct Exchange {
+        /// @brief Constructor.
+        ///
+        /// @param io_service IO service used by the exchange timer.
+        Exchange(asiolink::IOService& io_service)
+            : msg_(), in_buf_(), callback_(0), qid_(0), key_(),
+              timer_(io_service.get_io_service()), conn_(), socket_(),
+              done_(false) {
+        }
+
+        /// @brief Rendered request.
+        util::OutputBufferPtr msg_;
+
+        /// @brief Buffer for the response.
+        util::OutputBufferPtr in_buf_;
+
+        /// @brief Completion callback.
+        asiodns::IOFetch::Callback* callback_;
+
+        /// @brief Message ID of the request.
+        uint16_t qid_;
+
+        /// @brief Server key.
+        ServerKey key_;
+
+        /// @brief Response timer.
+        boost::asio::deadline_timer timer_;
+
+        /// @brief TCP connection carrying the exchange, if any.
+        ConnectionPtr conn_;
+
+        /// @brief UDP socket carrying the exchange, if any.
+        UdpSocketPtr socket_;
+
+        /// @brief Indicates if the exchange is over.
+        bool done_;
+    };
+
+    /// @brief Pointer to an exchange.
+    typedef boost::shared_ptr<Exchange> ExchangePtr;
+
+    /// @brief Exchanges with a single server.
+    struct Server {
+        /// @brief Outstanding exchanges by message ID.
+        std::map<uint16_t, ExchangePtr> in_flight_;
+
+        /// @brief Exchanges waiting to be sent.
+        std::list<ExchangePtr> queue_;
+
+        /// @brief TCP connections to the server.
+        std::list<ConnectionPtr> connections_;
+    };
+
+    /// @brief Returns a socket of the pool for the endpoint's address family.
+    ///
+    /// The socket is chosen at random. It is opened and the receive started
+    /// if the pool has no open socket in the chosen slot.
+    ///
+    /// @param remote Server endpoint.
+    UdpSocketPtr selectSocket(const Endpoint& remote);
+
+    /// @brief Takes a socket out of the pool.
+    ///
+    /// The socket still receives the responses to the exchanges outstanding
+    /// on it and is closed when they complete.
+    ///
+    /// @param socket Socket to retire.
+    void retireSocket(const UdpSocketPtr& socket);
+
+    /// @brief Closes a socket.
+    ///
+    /// @param socket Socket to close.
+    void closeSocket(const UdpSocketPtr& socket);
+
+    /// @brief Starts asynchronous receive on a socket.
+    ///
+    /// @param socket Socket to receive on.
+    void doReceive(const UdpSocketPtr& socket);
+
+    /// @brief Handles a received datagram.
+    void receiveHandler(const UdpSocketPtr& socket,
+                        const boost::system::error_code& ec,
+                        const size_t length);
+
+    /// @brief Sends queued exchanges to a server as far as the limit allows.
+    ///
+    /// @param key Server key.
+    void pump(const ServerKey& key);
+
+    /// @brief Selects the TCP connection for the next exchange.
+    ///
+    /// Returns the least busy connection, or opens a new one if all are
+    /// busy and the maximum number of connections hasn't been reached.
+    ///
+    /// @param key Server key.
+    /// @param server Server to select the connection to.
+    ConnectionPtr selectConnection(const ServerKey& key, Server& server);
+
+    /// @brief Handles completion of a TCP connect.
+    void connectHandler(const ConnectionPtr& conn,
+                        const boost::system::error_code& ec);
+
+    /// @brief Writes the first message from the connection's write queue.
+    void doWrite(const ConnectionPtr& conn);
+
+    /// @brief Handles completion of a TCP write.
+    void writeHandler(const ConnectionPtr& conn,
+                      const boost::system::error_code& ec);
+
+    /// @brief Starts reading the next message on a connection.
+    void doRead(const ConnectionPtr& conn);
+
+    /// @brief Handles the length prefix of a message read on a connection.
+    void readLengthHandler(const ConnectionPtr& conn,
+                           const boost::system::error_code& ec);
+
+    /// @brief Handles a message read on a connection.
+    void readDataHandler(const ConnectionPtr& conn,
+                         const boost::system::error_code& ec);
+
+    /// @brief Handles expiration of the connection's idle timer.
+    void idleHandler(const ConnectionPtr& conn,
+                     const boost::system::error_code& ec);
+
+    /// @brief Closes a connection.
+    ///
+    /// The exchanges outstanding on the connection complete with an error.
+    ///
+    /// @param conn Connection to close.
+    void closeConnection(const ConnectionPtr& conn);
+
+    /// @brief Dispatches a response to the matching exchange.
+    ///
+    /// The response must match the message ID and the question section of
+    /// an exchange outstanding with the server, and arrive over the same
+    /// connection or socket as the request was sent over.
+    ///
+    /// @param key Server key.
+    /// @param conn Connection the response was received on or null for UDP.
+    /// @param socket Socket the response was received on or null for TCP.
+    /// @param data Response data.
+    /// @param length Response length.
+    void dispatch(const ServerKey& key, const ConnectionPtr& conn,
+                  const UdpSocketPtr& socket, const uint8_t* data,
+                  const size_t length);
+
+    /// @brief Handles completion of an asynchronous send.
+    void sendHandler(const ExchangePtr& exchange,
+                     const boost::system::error_code& ec);
+
+    /// @brief Handles expiration of the exchange timer.
+    void timeoutHandler(const ExchangePtr& exchange,
+                        const boost::system::error_code& ec);
+
+    /// @brief Completes an exchange and invokes its callback.
+    ///
+    /// @param exchange Exchange to complete.
+    /// @param result Result passed to the callback.
+    void complete(const ExchangePtr& exchange,
+                  const asiodns::IOFetch::Result result);
+
+    /// @brief Removes an exchange from the server's tables.
+    ///
+    /// @param exchange Exchange to remove.
+    void remove(const ExchangePtr& exchange);
+
+    /// @brief IO service used to carry out the exchanges.
+    asiolink::IOService& io_service_;
+
+    /// @brief Maximum number of exchanges outstanding with a server.
+    size_t max_in_flight_;
+
+    /// @brief Maximum number of TCP connections to a server.
+    size_t max_connections_;
+
+    /// @brief Time in milliseconds after which an idle connection is closed.
+    long idle_timeout_;
+
+    /// @brief Number of exchanges sent over a socket before it is replaced.
+    size_t max_socket_uses_;
+
+    /// @brief Sockets used for IPv4 servers.
+    std::vector<UdpSocketPtr> sockets4_;
+
+    /// @brief Sockets used for IPv6 servers.
+    std::vector<UdpSocketPtr> sockets6_;
+
+    /// @brief Sockets taken out of the pools but still in use.
+    std::list<UdpSocketPtr> retired_;
+
+    /// @brief Exchanges by server.
+    std::map<ServerKey, Server> servers_;
+};
+
+} // namespace d2
+} // namespace isc
+
+#endif // DNS_UPDATE_CHANNEL_H
@@ -48,7 +48,8 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
                       DdnsDomainPtr& reverse_domain,
                       D2CfgMgrPtr& cfg_mgr)
     : io_service_(io_service), ncr_(ncr), forward_domain_(forward_domain),
-     reverse_domain_(reverse_domain), dns_client_(), dns_update_request_(),
+     reverse_domain_(reverse_domain), dns_client_(), dns_update_channel_(),
+     dns_update_request_(),
      dns_update_status_(DNSClient::OTHER), dns_update_response_(),
      forward_change_completed_(false), reverse_change_completed_(false),
      current_server_list_(), current_server_(), next_server_pos_(0),
@@ -457,7 +458,7 @@ NameChangeTransaction::selectNextServer() {
         // at global, then domain, then server
         // Once that is supported we need to add it here.
         dns_client_.reset(new DNSClient(dns_update_response_ , this,
-                                        DNSClient::UDP));
+                                        DNSClient::UDP, dns_update_channel_));
         ++next_server_pos_;
         return (true);
     }
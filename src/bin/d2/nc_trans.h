@@ -475,6 +475,16 @@ public:
     /// @return A const pointer reference to the DNSClient
     const DNSClientPtr& getDNSClient() const;
 
+    /// @brief Sets the channel used to carry out DNS packet exchanges.
+    ///
+    /// The channel is used by the DNSClient created for the next server.
+    ///
+    /// @param channel Pointer to the channel shared with other
+    /// transactions or null if the exchanges should use their own sockets.
+    void setDNSUpdateChannel(const DNSUpdateChannelPtr& channel) {
+        dns_update_channel_ = channel;
+    }
+
     /// @brief Fetches the current DNS update request packet.
     ///
     /// @return A const pointer reference to the current D2UpdateMessage
@@ -547,6 +557,9 @@ private:
     /// @brief The DNSClient instance that will carry out DNS packet exchanges.
     DNSClientPtr dns_client_;
 
+    /// @brief The channel shared by the DNSClient instances of transactions.
+    DNSUpdateChannelPtr dns_update_channel_;
+
     /// @brief The DNS current update request packet.
     D2UpdateMessagePtr dns_update_request_;
 
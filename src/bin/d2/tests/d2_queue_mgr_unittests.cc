@@ -192,6 +192,71 @@ TEST(D2QueueMgrBasicTest, basicQueue) {
                  D2QueueMgrInvalidIndex);
 }
 
+/// @brief Tests the spill queue.
+/// This test verifies that:
+/// 1. Requests received when the queue is full are spilled rather than
+/// stopping the listener.
+/// 2. The queue is refilled from the spill queue as entries are removed.
+/// 3. The queue contents are saved into the spill file and restored by a
+/// new manager.
+TEST(D2QueueMgrBasicTest, spillQueue) {
+    asiolink::IOServicePtr io_service(new isc::asiolink::IOService());
+    std::string filename(TEST_DATA_BUILDDIR "/spill-mgr-test.dat");
+    static_cast<void>(remove(filename.c_str()));
+
+    std::vector<NameChangeRequestPtr> ref_msgs;
+    for (int i = 0; i < VALID_MSG_CNT; i++) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[i]));
+        ref_msgs.push_back(ncr);
+    }
+
+    {
+        // Construct the manager with room for one request.
+        D2QueueMgr queue_mgr(io_service, 1);
+        ASSERT_NO_THROW(queue_mgr.enableSpillQueue(filename));
+        ASSERT_TRUE(queue_mgr.getSpillQueue());
+
+        // Feed the requests in through the receive handler.
+        for (int i = 0; i < VALID_MSG_CNT; i++) {
+            NameChangeRequestPtr ncr = ref_msgs[i];
+            queue_mgr(NameChangeListener::SUCCESS, ncr);
+        }
+
+        EXPECT_EQ(1, queue_mgr.getQueueSize());
+        EXPECT_EQ(VALID_MSG_CNT - 1, queue_mgr.getSpillQueueSize());
+        EXPECT_NE(D2QueueMgr::STOPPED_QUEUE_FULL, queue_mgr.getMgrState());
+
+        // Dequeuing refills the queue from the spill queue.
+        EXPECT_TRUE(*ref_msgs[0] == *queue_mgr.peek());
+        ASSERT_NO_THROW(queue_mgr.dequeue());
+        EXPECT_EQ(1, queue_mgr.getQueueSize());
+        EXPECT_EQ(VALID_MSG_CNT - 2, queue_mgr.getSpillQueueSize());
+        EXPECT_TRUE(*ref_msgs[1] == *queue_mgr.peek());
+
+        // Save the queue.
+        ASSERT_NO_THROW(queue_mgr.persistQueue());
+        EXPECT_EQ(0, queue_mgr.getQueueSize());
+        EXPECT_EQ(VALID_MSG_CNT - 1, queue_mgr.getSpillQueueSize());
+    }
+
+    // A new manager gets the saved requests back in order.
+    D2QueueMgr queue_mgr(io_service, VALID_MSG_CNT);
+    ASSERT_NO_THROW(queue_mgr.enableSpillQueue(filename));
+    ASSERT_EQ(VALID_MSG_CNT - 1, queue_mgr.getQueueSize());
+    EXPECT_EQ(0, queue_mgr.getSpillQueueSize());
+    for (int i = 1; i < VALID_MSG_CNT; i++) {
+        EXPECT_TRUE(*ref_msgs[i] == *queue_mgr.peek());
+        ASSERT_NO_THROW(queue_mgr.dequeue());
+    }
+
+    // Disabling the spill queue is allowed.
+    ASSERT_NO_THROW(queue_mgr.enableSpillQueue(""));
+    EXPECT_FALSE(queue_mgr.getSpillQueue());
+
+    static_cast<void>(remove(filename.c_str()));
+}
+
 /// @brief Compares two NameChangeRequests for equality.
 bool checkSendVsReceived(NameChangeRequestPtr sent_ncr,
                          NameChangeRequestPtr received_ncr) {
@@ -0,0 +1,222 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_spill_queue.h>
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace isc;
+using namespace isc::dhcp_ddns;
+using namespace isc::d2;
+
+namespace {
+
+/// @brief Creates a request for a given name.
+///
+/// @param index index used to build the FQDN.
+/// @param change_type type of the change.
+NameChangeRequestPtr
+makeNcr(const int index, const NameChangeType change_type = CHG_ADD) {
+    std::ostringstream s;
+    s << "{"
+      << " \"change-type\" : " << change_type << " , "
+      << " \"forward-change\" : true , "
+      << " \"reverse-change\" : false , "
+      << " \"fqdn\" : \"host" << index << ".example.com\" , "
+      << " \"ip-address\" : \"192.168.2.1\" , "
+      << " \"dhcid\" : \"010203040A7F8E3D\" , "
+      << " \"lease-expires-on\" : \"20130121132405\" , "
+      << " \"lease-length\" : 1300 "
+      << "}";
+    return (NameChangeRequest::fromJSON(s.str()));
+}
+
+/// @brief Test fixture which removes the spill file before and after tests.
+class D2SpillQueueTest : public ::testing::Test {
+public:
+    /// @brief Constructor
+    D2SpillQueueTest()
+        : filename_(TEST_DATA_BUILDDIR "/spill-queue-test.dat") {
+        removeFiles();
+    }
+
+    /// @brief Destructor
+    virtual ~D2SpillQueueTest() {
+        removeFiles();
+    }
+
+    /// @brief Removes the spill file and its temporary file.
+    void removeFiles() {
+        static_cast<void>(remove(filename_.c_str()));
+        static_cast<void>(remove((filename_ + ".tmp").c_str()));
+    }
+
+    /// @brief Appends raw bytes to the spill file.
+    void appendBytes(const std::string& bytes) {
+        std::ofstream out(filename_.c_str(), std::ios::out | std::ios::app |
+                          std::ios::binary);
+        out << bytes;
+    }
+
+    /// @brief Name of the spill file.
+    std::string filename_;
+};
+
+// Verifies that an empty file name is rejected.
+TEST_F(D2SpillQueueTest, construction) {
+    EXPECT_THROW(D2SpillQueue(""), D2SpillQueueError);
+
+    D2SpillQueuePtr queue;
+    ASSERT_NO_THROW(queue.reset(new D2SpillQueue(filename_)));
+    EXPECT_TRUE(queue->empty());
+    EXPECT_EQ(0, queue->size());
+    EXPECT_EQ(filename_, queue->getFilename());
+    EXPECT_FALSE(queue->pop());
+}
+
+// Verifies that requests are popped in the order they were pushed.
+TEST_F(D2SpillQueueTest, fifo) {
+    D2SpillQueue queue(filename_);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_NO_THROW(queue.push(makeNcr(i)));
+    }
+
+    EXPECT_EQ(5, queue.size());
+    for (int i = 0; i < 5; ++i) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = queue.pop());
+        ASSERT_TRUE(ncr);
+        EXPECT_TRUE(*ncr == *makeNcr(i));
+    }
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop());
+}
+
+// Verifies that the queue contents survive reopening the file.
+TEST_F(D2SpillQueueTest, persistence) {
+    {
+        D2SpillQueue queue(filename_);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_NO_THROW(queue.push(makeNcr(i)));
+        }
+
+        ASSERT_TRUE(queue.pop());
+    }
+
+    D2SpillQueue queue(filename_);
+    ASSERT_EQ(4, queue.size());
+    for (int i = 1; i < 5; ++i) {
+        NameChangeRequestPtr ncr = queue.pop();
+        ASSERT_TRUE(ncr);
+        EXPECT_TRUE(*ncr == *makeNcr(i));
+    }
+
+    // Pushing after a replay continues the journal.
+    ASSERT_NO_THROW(queue.push(makeNcr(7)));
+    D2SpillQueue reopened(filename_);
+    ASSERT_EQ(1, reopened.size());
+    EXPECT_TRUE(*reopened.pop() == *makeNcr(7));
+}
+
+// Verifies that a newer request supersedes a pending one with the same key.
+TEST_F(D2SpillQueueTest, supersede) {
+    {
+        D2SpillQueue queue(filename_);
+        ASSERT_NO_THROW(queue.push(makeNcr(1, CHG_ADD)));
+        ASSERT_NO_THROW(queue.push(makeNcr(2, CHG_ADD)));
+        ASSERT_NO_THROW(queue.push(makeNcr(1, CHG_REMOVE)));
+        EXPECT_EQ(2, queue.size());
+        EXPECT_EQ(1, queue.getSuperseded());
+    }
+
+    // The superseded request stays gone after a replay, and the newer
+    // request takes the position it was pushed at.
+    D2SpillQueue queue(filename_);
+    ASSERT_EQ(2, queue.size());
+    EXPECT_TRUE(*queue.pop() == *makeNcr(2, CHG_ADD));
+    EXPECT_TRUE(*queue.pop() == *makeNcr(1, CHG_REMOVE));
+}
+
+// Verifies that compaction keeps the live requests and puts the head
+// requests in front of them.
+TEST_F(D2SpillQueueTest, compact) {
+    D2SpillQueue queue(filename_);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_NO_THROW(queue.push(makeNcr(i)));
+    }
+
+    ASSERT_TRUE(queue.pop());
+    EXPECT_LT(0, queue.getDeadRecords());
+
+    D2SpillQueue::RequestQueue head;
+    head.push_back(makeNcr(10));
+    head.push_back(makeNcr(11));
+    ASSERT_NO_THROW(queue.compact(head));
+    EXPECT_EQ(0, queue.getDeadRecords());
+    EXPECT_EQ(5, queue.size());
+
+    D2SpillQueue reopened(filename_);
+    ASSERT_EQ(5, reopened.size());
+    EXPECT_TRUE(*reopened.pop() == *makeNcr(10));
+    EXPECT_TRUE(*reopened.pop() == *makeNcr(11));
+    for (int i = 1; i < 4; ++i) {
+        EXPECT_TRUE(*reopened.pop() == *makeNcr(i));
+    }
+}
+
+// Verifies that the file is compacted automatically.
+TEST_F(D2SpillQueueTest, autoCompact) {
+    D2SpillQueue queue(filename_);
+    ASSERT_NO_THROW(queue.push(makeNcr(0)));
+    for (int i = 1; i < D2SpillQueue::COMPACT_THRESHOLD + 10; ++i) {
+        ASSERT_NO_THROW(queue.push(makeNcr(i)));
+        ASSERT_TRUE(queue.pop());
+        EXPECT_LE(queue.getDeadRecords(), D2SpillQueue::COMPACT_THRESHOLD);
+    }
+
+    ASSERT_EQ(1, queue.size());
+    EXPECT_TRUE(*queue.pop() ==
+                *makeNcr(D2SpillQueue::COMPACT_THRESHOLD + 9));
+}
+
+// Verifies that a truncated trailing record is discarded.
+TEST_F(D2SpillQueueTest, truncated) {
+    {
+        D2SpillQueue queue(filename_);
+        ASSERT_NO_THROW(queue.push(makeNcr(1)));
+        ASSERT_NO_THROW(queue.push(makeNcr(2)));
+    }
+
+    // A partial ADD record header.
+    appendBytes(std::string("\x01\x00\x00", 3));
+
+    D2SpillQueuePtr queue;
+    ASSERT_NO_THROW(queue.reset(new D2SpillQueue(filename_)));
+    ASSERT_EQ(2, queue->size());
+    ASSERT_NO_THROW(queue->push(makeNcr(3)));
+    queue.reset();
+
+    D2SpillQueue reopened(filename_);
+    ASSERT_EQ(3, reopened.size());
+    for (int i = 1; i < 4; ++i) {
+        EXPECT_TRUE(*reopened.pop() == *makeNcr(i));
+    }
+}
+
+// Verifies that an invalid record is rejected.
+TEST_F(D2SpillQueueTest, invalidRecord) {
+    appendBytes(std::string("\x07\x00\x00\x00\x00\x00\x00\x00\x01", 9));
+    EXPECT_THROW((D2SpillQueue(filename_)), D2SpillQueueError);
+}
+
+} // end of anonymous namespace
@@ -11,7 +11,10 @@
 #include <asiodns/logger.h>
 #include <asiolink/interval_timer.h>
 #include <dns/messagerenderer.h>
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -58,6 +61,8 @@ public:
     uint8_t receive_buffer_[MAX_SIZE];
     DNSClientPtr dns_client_;
     bool corrupt_response_;
+    bool truncate_response_;
+    int tcp_requests_;
     bool expect_response_;
     asiolink::IntervalTimer test_timer_;
     int received_;
@@ -75,6 +80,8 @@ public:
         : service_(),
           status_(DNSClient::SUCCESS),
           corrupt_response_(false),
+          truncate_response_(false),
+          tcp_requests_(0),
           expect_response_(true),
           test_timer_(service_),
           received_(0), expected_(0) {
@@ -173,6 +180,10 @@ public:
             // Write it at message offset 2.
             response_buf.writeUint8At(0xA8, 2);
         }
+        // A truncated response also has the TC bit set: 10101010.
+        if (truncate_response_) {
+            response_buf.writeUint8At(0xAA, 2);
+        }
         // A response message is now ready to send. Send it!
         socket->send_to(boost::asio::buffer(response_buf.getData(),
                                      response_buf.getLength()),
@@ -253,18 +264,65 @@ public:
                         *remote);
     }
 
+    // Accept handler of the TCP "server"
+    //
+    // Starts reading the length of the request.
+    //
+    // @param socket A pointer to the socket of the accepted connection.
+    // @param ec Error code.
+    void tcpAcceptHandler(tcp::socket* socket,
+                          const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        boost::asio::async_read(*socket, boost::asio::buffer(receive_buffer_, 2),
+                                boost::bind(&DNSClientTest::tcpLengthHandler,
+                                            this, socket, _1));
+    }
+
+    // Reads the request of the given length from the TCP connection.
+    //
+    // @param socket A pointer to the socket of the accepted connection.
+    // @param ec Error code.
+    void tcpLengthHandler(tcp::socket* socket,
+                          const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        const size_t length = (receive_buffer_[0] << 8) | receive_buffer_[1];
+        ASSERT_LE(length + 2, sizeof(receive_buffer_));
+        boost::asio::async_read(*socket,
+                                boost::asio::buffer(receive_buffer_ + 2, length),
+                                boost::bind(&DNSClientTest::tcpReceiveHandler,
+                                            this, socket, _1, _2));
+    }
+
+    // Sends a complete response to the request received over TCP.
+    //
+    // @param socket A pointer to the socket of the accepted connection.
+    // @param ec Error code.
+    // @param length A length of the request without the length prefix.
+    void tcpReceiveHandler(tcp::socket* socket,
+                           const boost::system::error_code& ec,
+                           size_t length) {
+        if (ec) {
+            return;
+        }
+        ++tcp_requests_;
+        // Set the QR bit, leave the TC bit clear. The message starts after
+        // the 2 bytes length prefix.
+        receive_buffer_[4] = 0xA8;
+        boost::asio::write(*socket, boost::asio::buffer(receive_buffer_,
+                                                        length + 2));
+    }
+
     // This test verifies that when invalid response placeholder object is
     // passed to a constructor, constructor throws the appropriate exception.
     // It also verifies that the constructor will not throw if the supplied
     // callback object is NULL.
     void runConstructorTest() {
         EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::UDP));
-
-        // The TCP Transport is not supported right now. So, we return exception
-        // if caller specified TCP as a preferred protocol. This test will be
-        // removed once TCP is supported.
-        EXPECT_THROW(DNSClient(response_, NULL, DNSClient::TCP),
-                     isc::NotImplemented);
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP));
     }
 
     // This test verifies that it accepted timeout values belong to the range of
@@ -404,6 +462,60 @@ public:
         service_.get_io_service().reset();
     }
 
+    // This test verifies that the DNSClient repeats the update over TCP when
+    // the server truncates its response over UDP.
+    //
+    // @param channel Channel the client should use, or null if the client
+    // should use IOFetch.
+    void runSendReceiveTruncatedTest(const DNSUpdateChannelPtr& channel) {
+        truncate_response_ = true;
+        if (channel) {
+            dns_client_.reset(new DNSClient(response_, this, DNSClient::UDP,
+                                            channel));
+        }
+
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+
+        // The UDP "server" responds with the TC bit set.
+        udp::socket udp_socket(service_.get_io_service(), boost::asio::ip::udp::v4());
+        udp_socket.set_option(socket_base::reuse_address(true));
+        udp_socket.bind(udp::endpoint(address::from_string(TEST_ADDRESS),
+                                      TEST_PORT));
+        udp::endpoint remote;
+        udp_socket.async_receive_from(boost::asio::buffer(receive_buffer_,
+                                                   sizeof(receive_buffer_)),
+                                      remote,
+                                      boost::bind(&DNSClientTest::udpReceiveHandler,
+                                                  this, &udp_socket, &remote, _2,
+                                                  false));
+
+        // The TCP "server" responds with the complete response.
+        tcp::acceptor acceptor(service_.get_io_service(),
+                               tcp::endpoint(address::from_string(TEST_ADDRESS),
+                                             TEST_PORT));
+        tcp::socket tcp_socket(service_.get_io_service());
+        acceptor.async_accept(tcp_socket,
+                              boost::bind(&DNSClientTest::tcpAcceptHandler,
+                                          this, &tcp_socket, _1));
+
+        expected_++;
+        dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                              message, 500);
+        service_.run();
+
+        EXPECT_EQ(1, tcp_requests_);
+
+        if (channel) {
+            channel->close();
+        }
+        tcp_socket.close();
+        acceptor.close();
+        udp_socket.close();
+        service_.get_io_service().reset();
+    }
+
     // Performs a single request-response exchange with or without TSIG
     //
     // @param client_key TSIG passed to dns_client and also used by the
@@ -529,6 +641,18 @@ TEST_F(DNSClientTest, sendReceiveCorrupted) {
     runSendReceiveTest(true, false);
 }
 
+// Verify that the DNSClient repeats the update over TCP when the response
+// over UDP is truncated.
+TEST_F(DNSClientTest, sendReceiveTruncated) {
+    runSendReceiveTruncatedTest(DNSUpdateChannelPtr());
+}
+
+// Verify that the DNSClient repeats the update over TCP when the response
+// over UDP is truncated and the exchanges are carried out by a channel.
+TEST_F(DNSClientTest, sendReceiveTruncatedChannel) {
+    runSendReceiveTruncatedTest(DNSUpdateChannelPtr(new DNSUpdateChannel(service_)));
+}
+
 // Verify that it is possible to use the same DNSClient instance to
 // perform the following sequence of message exchanges:
 // 1. send
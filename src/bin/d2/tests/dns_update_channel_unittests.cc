@@ -0,0 +1,727 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <d2/dns_update_channel.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+#include <exceptions/exceptions.h>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <set>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::asiodns;
+using namespace isc::d2;
+using namespace isc::util;
+using namespace boost::asio;
+using namespace boost::asio::ip;
+
+namespace {
+
+const char* TEST_ADDRESS = "127.0.0.1";
+const uint16_t TEST_PORT = 5302;
+const size_t MAX_SIZE = 1024;
+const long TEST_TIMEOUT = 10 * 1000;
+
+/// @brief Records the completion of an exchange.
+class TestCallback : public IOFetch::Callback {
+public:
+    /// @brief Constructor.
+    TestCallback() : result_(IOFetch::NOTSET), calls_(0) {
+    }
+
+    /// @brief Records the result.
+    virtual void operator()(IOFetch::Result result) {
+        result_ = result;
+        ++calls_;
+    }
+
+    /// @brief Result of the last exchange.
+    IOFetch::Result result_;
+
+    /// @brief Number of times the callback was invoked.
+    int calls_;
+};
+
+/// @brief A request received by the test server.
+struct Request {
+    std::vector<uint8_t> data_;
+    udp::endpoint remote_;
+};
+
+/// @brief A TCP connection accepted by the test server.
+struct Session {
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service used by the connection.
+    Session(IOService& io_service)
+        : socket_(io_service.get_io_service()), data_() {
+        length_[0] = length_[1] = 0;
+    }
+
+    tcp::socket socket_;
+    uint8_t length_[2];
+    std::vector<uint8_t> data_;
+};
+
+/// @brief Pointer to a TCP connection accepted by the test server.
+typedef boost::shared_ptr<Session> SessionPtr;
+
+/// @brief Test fixture for the DNSUpdateChannel.
+///
+/// It implements a simple DNS server on the loopback interface. Over UDP,
+/// the server either responds to the requests immediately or holds them
+/// until the test tells it to respond. Over TCP, the server responds to
+/// each request or closes the connection upon receiving it.
+class DNSUpdateChannelTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    DNSUpdateChannelTest()
+        : service_(), channel_(new DNSUpdateChannel(service_)),
+          server_socket_(service_.get_io_service(), udp::v4()),
+          remote_(), held_(), received_(0), auto_respond_(true),
+          acceptor_(service_.get_io_service()), sessions_(), accepted_(0),
+          tcp_received_(0), tcp_close_(false),
+          test_timer_(service_), timed_out_(false) {
+        server_socket_.set_option(socket_base::reuse_address(true));
+        server_socket_.bind(udp::endpoint(address::from_string(TEST_ADDRESS),
+                                          TEST_PORT));
+        doReceive();
+
+        tcp::endpoint endpoint(address::from_string(TEST_ADDRESS), TEST_PORT);
+        acceptor_.open(endpoint.protocol());
+        acceptor_.set_option(socket_base::reuse_address(true));
+        acceptor_.bind(endpoint);
+        acceptor_.listen();
+        doAccept();
+
+        test_timer_.setup(boost::bind(&DNSUpdateChannelTest::testTimeoutHandler,
+                                      this),
+                          TEST_TIMEOUT);
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Closes the channel and runs the handlers it has left behind.
+    virtual ~DNSUpdateChannelTest() {
+        channel_->close();
+        boost::system::error_code ignored;
+        server_socket_.close(ignored);
+        acceptor_.close(ignored);
+        for (auto session = sessions_.begin(); session != sessions_.end();
+             ++session) {
+            (*session)->socket_.close(ignored);
+        }
+        test_timer_.cancel();
+        service_.get_io_service().reset();
+        service_.poll();
+    }
+
+    /// @brief Starts receiving a request on the server socket.
+    void doReceive() {
+        server_socket_.async_receive_from(boost::asio::buffer(receive_buffer_,
+                                                              sizeof(receive_buffer_)),
+                                          remote_,
+                                          boost::bind(&DNSUpdateChannelTest::
+                                                      receiveHandler,
+                                                      this, _1, _2));
+    }
+
+    /// @brief Handles a request received by the server.
+    void receiveHandler(const boost::system::error_code& ec, size_t length) {
+        if (ec) {
+            return;
+        }
+        ++received_;
+        Request request;
+        request.data_.assign(receive_buffer_, receive_buffer_ + length);
+        request.remote_ = remote_;
+        if (auto_respond_) {
+            respond(request);
+        } else {
+            held_.push_back(request);
+        }
+        doReceive();
+    }
+
+    /// @brief Sends a response to a request.
+    ///
+    /// The response is a copy of the request with the QR bit set.
+    void respond(Request& request) {
+        request.data_[2] |= 0x80;
+        server_socket_.send_to(boost::asio::buffer(request.data_),
+                               request.remote_);
+    }
+
+    /// @brief Responds to all held requests.
+    void respondAll() {
+        for (auto request = held_.begin(); request != held_.end(); ++request) {
+            respond(*request);
+        }
+        held_.clear();
+    }
+
+    /// @brief Starts accepting a TCP connection.
+    void doAccept() {
+        SessionPtr session(new Session(service_));
+        acceptor_.async_accept(session->socket_,
+                               boost::bind(&DNSUpdateChannelTest::acceptHandler,
+                                           this, session, _1));
+    }
+
+    /// @brief Handles an accepted TCP connection.
+    void acceptHandler(const SessionPtr& session,
+                       const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        ++accepted_;
+        sessions_.push_back(session);
+        doRead(session);
+        doAccept();
+    }
+
+    /// @brief Starts reading a request on a TCP connection.
+    void doRead(const SessionPtr& session) {
+        boost::asio::async_read(session->socket_,
+                                boost::asio::buffer(session->length_, 2),
+                                boost::bind(&DNSUpdateChannelTest::lengthHandler,
+                                            this, session, _1));
+    }
+
+    /// @brief Handles the length of a request received over TCP.
+    void lengthHandler(const SessionPtr& session,
+                       const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        session->data_.resize((session->length_[0] << 8) | session->length_[1]);
+        boost::asio::async_read(session->socket_,
+                                boost::asio::buffer(session->data_),
+                                boost::bind(&DNSUpdateChannelTest::dataHandler,
+                                            this, session, _1));
+    }
+
+    /// @brief Handles a request received over TCP.
+    ///
+    /// Responds with a copy of the request with the QR bit set or closes
+    /// the connection.
+    void dataHandler(const SessionPtr& session,
+                     const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        ++tcp_received_;
+        if (tcp_close_) {
+            session->socket_.close();
+            return;
+        }
+        session->data_[2] |= 0x80;
+        boost::asio::write(session->socket_,
+                           boost::asio::buffer(session->length_, 2));
+        boost::asio::write(session->socket_,
+                           boost::asio::buffer(session->data_));
+        doRead(session);
+    }
+
+    /// @brief Test timeout handler.
+    void testTimeoutHandler() {
+        timed_out_ = true;
+        ADD_FAILURE() << "Test timeout hit.";
+        service_.stop();
+    }
+
+    /// @brief Runs the IO service until the condition is met.
+    ///
+    /// @param cond Condition to wait for.
+    void runUntil(const boost::function<bool()>& cond) {
+        while (!cond() && !timed_out_) {
+            service_.run_one();
+        }
+    }
+
+    /// @brief Creates a minimal DNS Update message.
+    ///
+    /// @param qid Message ID.
+    OutputBufferPtr createMessage(const uint16_t qid) {
+        OutputBufferPtr msg(new OutputBuffer(12));
+        msg->writeUint16(qid);
+        // Opcode UPDATE.
+        msg->writeUint8(0x28);
+        for (int i = 0; i < 9; ++i) {
+            msg->writeUint8(0);
+        }
+        return (msg);
+    }
+
+    /// @brief Creates a DNS Update message with a zone section.
+    ///
+    /// The zone section holds the SOA record of "example.com.".
+    ///
+    /// @param qid Message ID.
+    OutputBufferPtr createZoneMessage(const uint16_t qid) {
+        OutputBufferPtr msg = createMessage(qid);
+        // ZOCOUNT 1.
+        msg->writeUint16At(1, 4);
+        const uint8_t zone[] = { 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+                                 3, 'c', 'o', 'm', 0 };
+        msg->writeData(zone, sizeof(zone));
+        // Type SOA, class IN.
+        msg->writeUint16(6);
+        msg->writeUint16(1);
+        return (msg);
+    }
+
+    /// @brief Sends a message through the channel to the test server.
+    ///
+    /// @param qid Message ID.
+    /// @param in_buf Buffer for the response.
+    /// @param callback Completion callback.
+    /// @param timeout Timeout in milliseconds.
+    /// @param protocol Transport protocol.
+    void send(const uint16_t qid, const OutputBufferPtr& in_buf,
+              TestCallback& callback, const int timeout = 2000,
+              const IOFetch::Protocol protocol = IOFetch::UDP) {
+        ASSERT_NO_THROW(channel_->send(createMessage(qid),
+                                       IOAddress(TEST_ADDRESS), TEST_PORT,
+                                       in_buf, &callback, timeout, protocol));
+    }
+
+    /// @brief Returns the number of exchanges in flight with the server.
+    ///
+    /// @param protocol Transport protocol.
+    size_t inFlight(const IOFetch::Protocol protocol = IOFetch::UDP) const {
+        return (channel_->getInFlight(IOAddress(TEST_ADDRESS), TEST_PORT,
+                                      protocol));
+    }
+
+    /// @brief Returns the number of exchanges queued for the server.
+    size_t queued() const {
+        return (channel_->getQueued(IOAddress(TEST_ADDRESS), TEST_PORT));
+    }
+
+    /// @brief Returns the number of TCP connections to the server.
+    size_t connections() const {
+        return (channel_->getConnections(IOAddress(TEST_ADDRESS), TEST_PORT));
+    }
+
+    /// @brief Checks if there are no TCP connections to the server.
+    bool noConnections() const {
+        return (connections() == 0);
+    }
+
+    /// @brief Returns the message ID of the response.
+    static uint16_t qidOf(const OutputBufferPtr& in_buf) {
+        return (static_cast<uint16_t>(((*in_buf)[0] << 8) | (*in_buf)[1]));
+    }
+
+    /// @brief Checks if the server has received a number of requests.
+    bool receivedAtLeast(const size_t count) const {
+        return (received_ >= count);
+    }
+
+    /// @brief Checks if a callback has been invoked.
+    static bool called(const TestCallback& callback) {
+        return (callback.calls_ > 0);
+    }
+
+    /// @brief Checks if all callbacks have been invoked.
+    static bool allCalled(const std::vector<TestCallback>& callbacks) {
+        for (auto cb = callbacks.begin(); cb != callbacks.end(); ++cb) {
+            if (cb->calls_ == 0) {
+                return (false);
+            }
+        }
+        return (true);
+    }
+
+    IOService service_;
+    DNSUpdateChannelPtr channel_;
+    udp::socket server_socket_;
+    uint8_t receive_buffer_[MAX_SIZE];
+    udp::endpoint remote_;
+    std::vector<Request> held_;
+    size_t received_;
+    bool auto_respond_;
+    tcp::acceptor acceptor_;
+    std::list<SessionPtr> sessions_;
+    size_t accepted_;
+    size_t tcp_received_;
+    bool tcp_close_;
+    IntervalTimer test_timer_;
+    bool timed_out_;
+};
+
+// Verifies that the maximum number of exchanges in flight may be set.
+TEST_F(DNSUpdateChannelTest, maxInFlight) {
+    EXPECT_EQ(DNSUpdateChannel::MAX_IN_FLIGHT_DEFAULT,
+              channel_->getMaxInFlight());
+    EXPECT_THROW(channel_->setMaxInFlight(0), BadValue);
+    ASSERT_NO_THROW(channel_->setMaxInFlight(5));
+    EXPECT_EQ(5, channel_->getMaxInFlight());
+
+    EXPECT_THROW(DNSUpdateChannel(service_, 0), BadValue);
+}
+
+// Verifies that the TCP connection limits may be set.
+TEST_F(DNSUpdateChannelTest, connectionLimits) {
+    EXPECT_EQ(DNSUpdateChannel::MAX_CONNECTIONS_DEFAULT,
+              channel_->getMaxConnections());
+    EXPECT_THROW(channel_->setMaxConnections(0), BadValue);
+    ASSERT_NO_THROW(channel_->setMaxConnections(1));
+    EXPECT_EQ(1, channel_->getMaxConnections());
+
+    EXPECT_EQ(DNSUpdateChannel::IDLE_TIMEOUT_DEFAULT,
+              channel_->getIdleTimeout());
+    EXPECT_THROW(channel_->setIdleTimeout(0), BadValue);
+    EXPECT_THROW(channel_->setIdleTimeout(-1), BadValue);
+    ASSERT_NO_THROW(channel_->setIdleTimeout(100));
+    EXPECT_EQ(100, channel_->getIdleTimeout());
+}
+
+// Verifies that the number of uses of a UDP socket may be set.
+TEST_F(DNSUpdateChannelTest, maxSocketUses) {
+    EXPECT_EQ(DNSUpdateChannel::MAX_SOCKET_USES_DEFAULT,
+              channel_->getMaxSocketUses());
+    EXPECT_THROW(channel_->setMaxSocketUses(0), BadValue);
+    ASSERT_NO_THROW(channel_->setMaxSocketUses(10));
+    EXPECT_EQ(10, channel_->getMaxSocketUses());
+}
+
+// Verifies that invalid arguments are rejected.
+TEST_F(DNSUpdateChannelTest, invalidSend) {
+    TestCallback callback;
+    OutputBufferPtr in_buf(new OutputBuffer(MAX_SIZE));
+
+    // Message shorter than the header.
+    OutputBufferPtr msg(new OutputBuffer(2));
+    msg->writeUint16(1);
+    EXPECT_THROW(channel_->send(msg, IOAddress(TEST_ADDRESS), TEST_PORT,
+                                in_buf, &callback, 100), BadValue);
+
+    // No callback.
+    EXPECT_THROW(channel_->send(createMessage(1), IOAddress(TEST_ADDRESS),
+                                TEST_PORT, in_buf, 0, 100), BadValue);
+}
+
+// Verifies that a single exchange completes successfully.
+TEST_F(DNSUpdateChannelTest, sendReceive) {
+    TestCallback callback;
+    OutputBufferPtr in_buf(new OutputBuffer(MAX_SIZE));
+    send(0x1234, in_buf, callback);
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback)));
+
+    EXPECT_EQ(1, callback.calls_);
+    EXPECT_EQ(IOFetch::SUCCESS, callback.result_);
+    ASSERT_EQ(12, in_buf->getLength());
+    EXPECT_EQ(0x1234, qidOf(in_buf));
+    EXPECT_EQ(0xA8, (*in_buf)[2]);
+    EXPECT_EQ(0, inFlight());
+    EXPECT_EQ(0, queued());
+}
+
+// Verifies that the exchanges above the limit are queued and sent as
+// the earlier exchanges complete.
+TEST_F(DNSUpdateChannelTest, inFlightLimit) {
+    channel_->setMaxInFlight(2);
+    auto_respond_ = false;
+
+    std::vector<TestCallback> callbacks(5);
+    std::vector<OutputBufferPtr> in_bufs;
+    for (int i = 0; i < callbacks.size(); ++i) {
+        in_bufs.push_back(OutputBufferPtr(new OutputBuffer(MAX_SIZE)));
+        send(i + 1, in_bufs[i], callbacks[i]);
+    }
+    EXPECT_EQ(2, inFlight());
+    EXPECT_EQ(3, queued());
+
+    // The server sees only two requests until it responds.
+    runUntil(boost::bind(&DNSUpdateChannelTest::receivedAtLeast, this, 2));
+    service_.poll();
+    EXPECT_EQ(2, received_);
+    EXPECT_EQ(2, inFlight());
+
+    auto_respond_ = true;
+    respondAll();
+    runUntil(boost::bind(&DNSUpdateChannelTest::allCalled,
+                         boost::cref(callbacks)));
+
+    EXPECT_EQ(5, received_);
+    for (int i = 0; i < callbacks.size(); ++i) {
+        EXPECT_EQ(1, callbacks[i].calls_);
+        EXPECT_EQ(IOFetch::SUCCESS, callbacks[i].result_);
+        EXPECT_EQ(i + 1, qidOf(in_bufs[i]));
+    }
+    EXPECT_EQ(0, inFlight());
+    EXPECT_EQ(0, queued());
+}
+
+// Verifies that an exchange waits while another exchange with the same
+// message ID is outstanding with the server.
+TEST_F(DNSUpdateChannelTest, sameQid) {
+    auto_respond_ = false;
+
+    TestCallback callback1;
+    TestCallback callback2;
+    OutputBufferPtr in_buf1(new OutputBuffer(MAX_SIZE));
+    OutputBufferPtr in_buf2(new OutputBuffer(MAX_SIZE));
+    send(7, in_buf1, callback1);
+    send(7, in_buf2, callback2);
+    EXPECT_EQ(1, inFlight());
+    EXPECT_EQ(1, queued());
+
+    runUntil(boost::bind(&DNSUpdateChannelTest::receivedAtLeast, this, 1));
+    auto_respond_ = true;
+    respondAll();
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback2)));
+
+    EXPECT_EQ(1, callback1.calls_);
+    EXPECT_EQ(IOFetch::SUCCESS, callback1.result_);
+    EXPECT_EQ(1, callback2.calls_);
+    EXPECT_EQ(IOFetch::SUCCESS, callback2.result_);
+    EXPECT_EQ(2, received_);
+}
+
+// Verifies that an exchange times out when there is no response.
+TEST_F(DNSUpdateChannelTest, timeout) {
+    auto_respond_ = false;
+
+    TestCallback callback;
+    OutputBufferPtr in_buf(new OutputBuffer(MAX_SIZE));
+    send(1, in_buf, callback, 100);
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback)));
+
+    EXPECT_EQ(1, callback.calls_);
+    EXPECT_EQ(IOFetch::TIME_OUT, callback.result_);
+    EXPECT_EQ(0, inFlight());
+
+    // A late response is dropped.
+    respondAll();
+    service_.get_io_service().reset();
+    service_.poll();
+    EXPECT_EQ(1, callback.calls_);
+}
+
+// Verifies that cancelled exchanges don't invoke their callbacks and
+// make room for the queued exchanges.
+TEST_F(DNSUpdateChannelTest, cancel) {
+    channel_->setMaxInFlight(1);
+    auto_respond_ = false;
+
+    TestCallback callback1;
+    TestCallback callback2;
+    OutputBufferPtr in_buf1(new OutputBuffer(MAX_SIZE));
+    OutputBufferPtr in_buf2(new OutputBuffer(MAX_SIZE));
+    send(1, in_buf1, callback1);
+    send(2, in_buf2, callback2);
+    EXPECT_EQ(1, inFlight());
+    EXPECT_EQ(1, queued());
+
+    channel_->cancel(&callback1);
+    EXPECT_EQ(1, inFlight());
+    EXPECT_EQ(0, queued());
+
+    auto_respond_ = true;
+    respondAll();
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback2)));
+
+    EXPECT_EQ(0, callback1.calls_);
+    EXPECT_EQ(1, callback2.calls_);
+    EXPECT_EQ(IOFetch::SUCCESS, callback2.result_);
+}
+
+// Verifies that the responses which don't repeat the question section
+// of the request are dropped.
+TEST_F(DNSUpdateChannelTest, questionMismatch) {
+    auto_respond_ = false;
+
+    TestCallback callback;
+    OutputBufferPtr in_buf(new OutputBuffer(MAX_SIZE));
+    ASSERT_NO_THROW(channel_->send(createZoneMessage(1), IOAddress(TEST_ADDRESS),
+                                   TEST_PORT, in_buf, &callback, 2000));
+    runUntil(boost::bind(&DNSUpdateChannelTest::receivedAtLeast, this, 1));
+    ASSERT_EQ(1, held_.size());
+
+    // Response for another zone.
+    Request other_zone = held_[0];
+    other_zone.data_[13] = 'x';
+    respond(other_zone);
+
+    // Response without the zone section.
+    Request no_zone = held_[0];
+    no_zone.data_.resize(12);
+    no_zone.data_[5] = 0;
+    respond(no_zone);
+
+    // Response for another type.
+    Request other_type = held_[0];
+    other_type.data_[26] = 2;
+    respond(other_type);
+
+    // The names are compared case insensitively.
+    held_[0].data_[13] = 'E';
+    respondAll();
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback)));
+
+    EXPECT_EQ(1, callback.calls_);
+    EXPECT_EQ(IOFetch::SUCCESS, callback.result_);
+    ASSERT_EQ(29, in_buf->getLength());
+    EXPECT_EQ('E', (*in_buf)[13]);
+    EXPECT_EQ(6, (*in_buf)[26]);
+}
+
+// Verifies that a UDP socket is replaced after carrying the configured
+// number of exchanges, and that the replaced socket still receives the
+// responses to the exchanges outstanding on it.
+TEST_F(DNSUpdateChannelTest, socketRotation) {
+    channel_->setMaxSocketUses(1);
+    auto_respond_ = false;
+
+    std::vector<TestCallback> callbacks(3);
+    std::vector<OutputBufferPtr> in_bufs;
+    for (int i = 0; i < callbacks.size(); ++i) {
+        in_bufs.push_back(OutputBufferPtr(new OutputBuffer(MAX_SIZE)));
+        send(i + 1, in_bufs[i], callbacks[i]);
+    }
+    runUntil(boost::bind(&DNSUpdateChannelTest::receivedAtLeast, this, 3));
+
+    // Each request came from a different port.
+    std::set<uint16_t> ports;
+    for (auto request = held_.begin(); request != held_.end(); ++request) {
+        ports.insert(request->remote_.port());
+    }
+    EXPECT_EQ(3, ports.size());
+
+    respondAll();
+    runUntil(boost::bind(&DNSUpdateChannelTest::allCalled,
+                         boost::cref(callbacks)));
+    for (int i = 0; i < callbacks.size(); ++i) {
+        EXPECT_EQ(IOFetch::SUCCESS, callbacks[i].result_);
+        EXPECT_EQ(i + 1, qidOf(in_bufs[i]));
+    }
+}
+
+// Verifies that a large number of concurrent exchanges share the channel
+// and all complete.
+TEST_F(DNSUpdateChannelTest, manyConcurrent) {
+    const size_t count = 1000;
+    std::vector<TestCallback> callbacks(count);
+    std::vector<OutputBufferPtr> in_bufs;
+    for (int i = 0; i < count; ++i) {
+        in_bufs.push_back(OutputBufferPtr(new OutputBuffer(MAX_SIZE)));
+        send(i, in_bufs[i], callbacks[i], 5000);
+    }
+    EXPECT_EQ(DNSUpdateChannel::MAX_IN_FLIGHT_DEFAULT, inFlight());
+    EXPECT_EQ(count - DNSUpdateChannel::MAX_IN_FLIGHT_DEFAULT, queued());
+
+    runUntil(boost::bind(&DNSUpdateChannelTest::allCalled,
+                         boost::cref(callbacks)));
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(IOFetch::SUCCESS, callbacks[i].result_);
+        EXPECT_EQ(i, qidOf(in_bufs[i]));
+    }
+    EXPECT_EQ(0, inFlight());
+    EXPECT_EQ(0, queued());
+}
+
+// Verifies that an exchange over TCP completes successfully and the
+// connection is kept open and reused.
+TEST_F(DNSUpdateChannelTest, tcpSendReceive) {
+    TestCallback callback1;
+    OutputBufferPtr in_buf1(new OutputBuffer(MAX_SIZE));
+    send(0x1234, in_buf1, callback1, 2000, IOFetch::TCP);
+    EXPECT_EQ(1, connections());
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback1)));
+
+    EXPECT_EQ(IOFetch::SUCCESS, callback1.result_);
+    ASSERT_EQ(12, in_buf1->getLength());
+    EXPECT_EQ(0x1234, qidOf(in_buf1));
+    EXPECT_EQ(0xA8, (*in_buf1)[2]);
+    EXPECT_EQ(0, inFlight(IOFetch::TCP));
+    EXPECT_EQ(0, received_);
+
+    // The connection is still open.
+    EXPECT_EQ(1, connections());
+
+    TestCallback callback2;
+    OutputBufferPtr in_buf2(new OutputBuffer(MAX_SIZE));
+    send(0x1235, in_buf2, callback2, 2000, IOFetch::TCP);
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback2)));
+
+    EXPECT_EQ(IOFetch::SUCCESS, callback2.result_);
+    EXPECT_EQ(0x1235, qidOf(in_buf2));
+    EXPECT_EQ(1, accepted_);
+    EXPECT_EQ(2, tcp_received_);
+}
+
+// Verifies that many exchanges are pipelined over a limited number of
+// TCP connections.
+TEST_F(DNSUpdateChannelTest, tcpPipelining) {
+    channel_->setMaxConnections(2);
+
+    const size_t count = 200;
+    std::vector<TestCallback> callbacks(count);
+    std::vector<OutputBufferPtr> in_bufs;
+    for (int i = 0; i < count; ++i) {
+        in_bufs.push_back(OutputBufferPtr(new OutputBuffer(MAX_SIZE)));
+        send(i, in_bufs[i], callbacks[i], 5000, IOFetch::TCP);
+    }
+    EXPECT_EQ(2, connections());
+
+    runUntil(boost::bind(&DNSUpdateChannelTest::allCalled,
+                         boost::cref(callbacks)));
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(IOFetch::SUCCESS, callbacks[i].result_);
+        EXPECT_EQ(i, qidOf(in_bufs[i]));
+    }
+    EXPECT_EQ(2, accepted_);
+    EXPECT_EQ(count, tcp_received_);
+}
+
+// Verifies that an idle TCP connection is closed.
+TEST_F(DNSUpdateChannelTest, tcpIdleTimeout) {
+    channel_->setIdleTimeout(50);
+
+    TestCallback callback;
+    OutputBufferPtr in_buf(new OutputBuffer(MAX_SIZE));
+    send(1, in_buf, callback, 2000, IOFetch::TCP);
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback)));
+    EXPECT_EQ(IOFetch::SUCCESS, callback.result_);
+    EXPECT_EQ(1, connections());
+
+    runUntil(boost::bind(&DNSUpdateChannelTest::noConnections, this));
+    EXPECT_EQ(0, connections());
+}
+
+// Verifies that the exchanges outstanding on a TCP connection closed by
+// the server complete with an error.
+TEST_F(DNSUpdateChannelTest, tcpConnectionClosed) {
+    tcp_close_ = true;
+
+    TestCallback callback;
+    OutputBufferPtr in_buf(new OutputBuffer(MAX_SIZE));
+    send(1, in_buf, callback, 2000, IOFetch::TCP);
+    runUntil(boost::bind(&DNSUpdateChannelTest::called, boost::cref(callback)));
+
+    EXPECT_EQ(IOFetch::NOTSET, callback.result_);
+    EXPECT_EQ(0, inFlight(IOFetch::TCP));
+    EXPECT_EQ(0, connections());
+}
+
+}
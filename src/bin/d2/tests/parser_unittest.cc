@@ -136,6 +136,20 @@ TEST(ParserTest, keywordDhcpDdns) {
      testParser(txt, D2ParserContext::PARSER_DHCPDDNS);
 }
 
+// Checks that the binary NameChangeRequest format is accepted.
+TEST(ParserTest, ncrFormatBinary) {
+    string txt = "{ \"DhcpDdns\": { \"ncr-protocol\": \"UDP\","
+        " \"ncr-format\": \"BINARY\" } }";
+    testParser(txt, D2ParserContext::PARSER_DHCPDDNS);
+}
+
+// Checks that the spill file of the request queue is accepted.
+TEST(ParserTest, spillFile) {
+    string txt = "{ \"DhcpDdns\": { \"ncr-protocol\": \"UDP\","
+        " \"spill-file\": \"/tmp/kea-ddns-spill.csv\" } }";
+    testParser(txt, D2ParserContext::PARSER_DHCPDDNS);
+}
+
 TEST(ParserTest, keywordDhcp6) {
      string txt = "{ \"Dhcp6\": { \"interfaces-config\": {"
                   " \"interfaces\": [ \"type\", \"htype\" ] },\n"
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 181
-#define YY_END_OF_BUFFER 182
+#define YY_NUM_RULES 187
+#define YY_END_OF_BUFFER 188
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,178 +700,183 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1548] =
+static const flex_int16_t yy_accept[1594] =
     {   0,
-      174,  174,    0,    0,    0,    0,    0,    0,    0,    0,
-      182,  180,   10,   11,  180,    1,  174,  171,  174,  174,
-      180,  173,  172,  180,  180,  180,  180,  180,  167,  168,
-      180,  180,  180,  169,  170,    5,    5,    5,  180,  180,
-      180,   10,   11,    0,    0,  163,    0,    0,    0,    0,
+      180,  180,    0,    0,    0,    0,    0,    0,    0,    0,
+      188,  186,   10,   11,  186,    1,  180,  177,  180,  180,
+      186,  179,  178,  186,  186,  186,  186,  186,  173,  174,
+      186,  186,  186,  175,  176,    5,    5,    5,  186,  186,
+      186,   10,   11,    0,    0,  169,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      174,  174,    0,  173,  174,    3,    2,    6,    0,  174,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        1,  180,  180,    0,  179,    3,    2,    6,    0,  180,
         0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
 
-        0,  164,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  166,    0,    0,    0,
+      170,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  172,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    2,    0,    0,    0,    0,    0,    0,    0,    8,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    8,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,  165,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  171,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   70,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   71,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  179,  177,    0,  176,  175,    0,    0,
+        0,    0,    0,    0,    0,  185,  183,    0,  182,  181,
 
-        0,    0,    0,    0,    0,    0,    0,    0,  143,    0,
-      142,    0,    0,   76,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   35,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  148,    0,  147,    0,    0,   77,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   35,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   73,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   17,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   74,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,   18,    0,    0,    0,    0,  178,  175,
+        0,    0,   17,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      144,    0,    0,  146,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   77,    0,    0,    0,    0,    0,    0,
-        0,   62,    0,    0,    0,    0,    0,   97,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   38,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,   18,    0,
+        0,    0,    0,  184,  181,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  149,    0,    0,  152,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   61,    0,    0,
+       78,    0,    0,    0,    0,    0,    0,    0,   63,    0,
+        0,    0,    0,    0,  101,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   38,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       65,    0,   39,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   62,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   66,    0,
 
+       39,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   94,   31,    0,    0,   36,    0,    0,    0,    0,
-        0,    0,    0,    0,   12,  151,    0,  148,    0,  147,
-        0,    0,    0,  107,    0,    0,    0,    0,    0,    0,
+       98,   31,    0,    0,   36,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   12,  157,    0,  154,    0,  153,
+        0,    0,    0,  111,   91,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   87,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   88,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   33,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,   64,    0,    0,    0,    0,    0,
-        0,    0,    0,  108,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  103,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
-      149,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   33,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   65,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  112,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      107,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        7,    0,    0,  155,  150,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   75,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   89,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   76,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,   85,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   90,    0,    0,
+        0,    0,    0,    0,    0,    0,   86,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   68,    0,
+        0,    0,    0,    0,    0,   69,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   83,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   68,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   82,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   67,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  101,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  113,   83,    0,
-        0,    0,    0,   88,   32,    0,    0,    0,    0,    0,
+      105,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,  117,   84,    0,    0,
+        0,    0,   89,   32,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,   40,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   57,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  152,    0,    0,    0,    0,
+        0,    0,    0,    0,   58,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  158,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   72,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  102,
-        0,    0,    0,    0,    0,   43,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   73,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,   37,    0,    0,    0,   30,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   90,    0,    0,
+        0,  106,    0,    0,    0,    0,    0,   44,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   93,    0,    0,   37,    0,
+        0,    0,    0,   30,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       99,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  126,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   69,    0,    0,
+        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  103,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  131,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,   23,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  131,    0,    0,    0,  129,    0,    0,
+        0,    0,    0,   70,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  156,    0,    0,    0,    0,    0,    0,    0,
-      100,    0,    0,    0,    0,    0,    0,    0,    0,  104,
-       86,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   98,   22,    0,  109,
-        0,    0,    0,    0,    0,    0,    0,    0,  135,    0,
-        0,    0,    0,   59,    0,    0,    0,    0,    0,  112,
-       34,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,   56,    0,    0,
-        0,   80,   81,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   63,    0,    0,    0,    0,    0,    0,
-        0,    0,   44,    0,    0,    0,    0,    0,    0,    0,
-        0,  106,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   23,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      160,    0,   60,   74,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   53,    0,    0,    0,    0,    0,    0,
-        0,  132,    0,    0,  130,    0,  124,  123,    0,   49,
-        0,   21,    0,    0,    0,    0,    0,  145,    0,    0,
-
-        0,   93,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  121,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  110,   15,    0,   41,    0,    0,
-        0,    0,    0,  134,    0,    0,    0,    0,    0,    0,
-       54,    0,    0,  105,    0,    0,    0,    0,   96,    0,
-        0,    0,    0,    0,    0,    0,   66,    0,  154,    0,
-      153,    0,  159,    0,    0,    0,    0,    0,    0,    0,
+        0,  136,    0,    0,    0,  134,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      162,    0,    0,    0,    0,    0,    0,    0,  104,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  108,   87,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  102,   22,    0,  113,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,  140,    0,
+        0,    0,    0,   60,    0,    0,    0,    0,    0,  116,
+       34,    0,   92,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   57,    0,
+        0,    0,   81,   82,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   64,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   45,    0,    0,    0,    0,    0,
+        0,    0,    0,  110,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  166,    0,   61,   75,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,   54,    0,    0,    0,
+        0,    0,    0,    0,  137,    0,    0,  135,    0,  128,
+      127,    0,   50,    0,   21,    0,    0,    0,    0,    0,
+      151,    0,    0,    0,   97,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  125,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  114,   15,
+        0,    0,   41,    0,    0,    0,    0,    0,  139,    0,
+        0,    0,    0,    0,    0,   55,    0,    0,  109,    0,
+        0,    0,    0,  100,    0,    0,    0,    0,    0,    0,
+        0,   67,    0,  160,    0,  159,    0,  165,    0,    0,
 
-        0,    0,    0,    0,    0,   14,    0,    0,    0,   48,
-        0,    0,    0,    0,  162,    0,   91,   27,    0,    0,
-        0,   50,  122,    0,    0,    0,  157,  127,    0,    0,
-        0,    0,    0,    0,    0,    0,   25,    0,    0,   24,
-        0,  133,    0,    0,    0,    0,    0,   84,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   52,    0,    0,    0,    0,    0,   42,    0,
-        0,    0,    0,    0,    0,    0,  111,    0,    0,    0,
-       26,    0,  158,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   47,    0,    0,   20,    0,  161,
-
-       58,    0,  155,  150,    0,   28,    0,    0,    0,   16,
-        0,    0,  139,    0,    0,    0,    0,    0,    0,  119,
-        0,   95,    0,    0,    0,    0,    0,    0,    0,    0,
-       71,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  140,   13,    0,    0,    0,    0,    0,  128,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  125,
-        0,    0,    0,    0,    0,  118,    0,   19,    0,  136,
-        0,    0,    0,    0,   45,    0,   79,    0,    0,    0,
-        0,  117,    0,    0,   51,    0,    0,   46,  138,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   29,    0,    0,    0,    0,    0,  137,    0,   92,
-        0,    0,    0,    0,    0,    0,  115,  120,   55,    0,
-        0,    0,    0,  114,    0,    0,  141,    0,    0,    0,
-        0,    0,   78,    0,    0,  116,    0
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   14,    0,    0,    0,   49,    0,    0,    0,
+        0,  168,    0,   95,   27,    0,    0,    0,    0,   51,
+      126,    0,    0,    0,  163,  132,    0,    0,    0,    0,
+        0,    0,    0,    0,   25,    0,    0,   24,   42,    0,
+      138,    0,    0,    0,    0,    0,   85,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,   53,    0,    0,    0,    0,    0,    0,   43,    0,
+        0,    0,    0,    0,    0,    0,  115,    0,    0,    0,
+       26,    0,  164,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   48,    0,    0,   20,    0,  167,
+       59,    0,  161,  156,    0,   28,    0,    0,    0,    0,
+       16,    0,    0,  144,    0,    0,    0,    0,    0,    0,
+      123,    0,   99,    0,    0,    0,    0,    0,    0,    0,
+        0,   72,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  145,   13,    0,    0,    0,    0,
+        0,  133,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,  130,    0,    0,    0,    0,    0,  122,    0,
+       19,    0,  141,    0,    0,    0,    0,   46,    0,   80,
+        0,    0,    0,    0,    0,  121,    0,    0,   52,    0,
+        0,   47,  143,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  129,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   29,    0,    0,
+        0,    0,    0,  142,    0,   96,    0,    0,    0,    0,
+        0,    0,  119,  124,   56,    0,    0,    0,    0,  118,
+        0,    0,  146,    0,    0,    0,    0,    0,   79,    0,
+        0,  120,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -883,11 +888,11 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   15,   16,
        14,   17,   14,   18,   14,   14,   14,   19,    5,   20,
         5,   21,   22,    5,   23,   24,   25,   26,   27,   28,
-        5,   29,    5,   30,    5,   31,    5,   32,   33,   34,
-        5,   35,   36,   37,   38,   39,   40,    5,   41,    5,
-       42,   43,   44,    5,   45,    5,   46,   47,   48,   49,
+        5,   29,   30,   31,    5,   32,    5,   33,   34,   35,
+        5,   36,   37,   38,   39,   40,   41,    5,   42,    5,
+       43,   44,   45,    5,   46,    5,   47,   48,   49,   50,
 
-       50,   51,   52,   53,   54,   55,   56,   57,   58,   59,
+       51,   52,   53,   54,   55,   31,   56,   57,   58,   59,
        60,   61,   62,   63,   64,   65,   66,   67,   68,   69,
        70,   71,   72,    5,   73,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -908,818 +913,1094 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1560] =
+static const flex_int16_t yy_base[1594] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     1948, 1949,   34, 1944,  145,    0,  207, 1949,  214,  221,
-       13,  228, 1949, 1924,  118,   25,    2,    6, 1949, 1949,
-       73,   11,   17, 1949, 1949, 1949,  104, 1932, 1885,    0,
-     1922,  108, 1939,   24,  262, 1949, 1881,   67, 1880, 1886,
-       84,   75, 1878,   88,  226,   91,   89,  290,  196, 1877,
-      206,  285,  206,  210,  219,   60,  223, 1886,  247,  290,
-      315,  303,  231, 1869,  297,  321,  343,  324, 1888,    0,
-      380,  387,  401,  408,  424, 1949,    0, 1949,  429,  438,
-      216,  249,  220,  315,  335,  266, 1949, 1885, 1926, 1949,
-
-      342, 1949,  421, 1913,  312, 1871, 1881,  400,   10, 1876,
-      361,  323,  370,  387,  359, 1921,    0,  474,  392, 1863,
-     1860, 1864, 1866, 1859, 1867,  412, 1863, 1852, 1853,   78,
-     1869, 1852, 1861, 1861,   95, 1852,  400, 1853, 1851,  405,
-     1899, 1903, 1843, 1896, 1836, 1859, 1856, 1856, 1850,  310,
-     1843, 1836, 1841, 1835,  436, 1846, 1839, 1830, 1829, 1843,
-      186, 1829,  413, 1845, 1822,  470,  286,  400, 1843, 1840,
-     1841, 1839, 1874, 1873,  445, 1819, 1821,  448, 1813, 1830,
-     1822,    0,  447,  447,  458,  471,  462,  483, 1821, 1949,
-        0, 1866,  490, 1811, 1814,  476,  482, 1822,  488, 1867,
-
-      499, 1866,  496, 1865, 1949,  542, 1864,  507, 1823, 1815,
-     1802, 1818, 1817, 1814, 1813, 1804,  486, 1855, 1849, 1813,
-     1792, 1800, 1795, 1809, 1805, 1793, 1805, 1805, 1796, 1780,
-     1784, 1797, 1799, 1796, 1788, 1778, 1796, 1949, 1791, 1794,
-     1775, 1774, 1826, 1773, 1783, 1786,  531, 1782, 1770, 1781,
-     1819, 1764, 1822, 1757, 1772,  533, 1762, 1778, 1759, 1758,
-     1764, 1755, 1754, 1761, 1811, 1767, 1766, 1760,  486, 1767,
-     1762, 1754, 1744, 1759, 1758, 1753, 1757,  322, 1755, 1741,
-     1747, 1754, 1742, 1739, 1738,  541, 1733, 1747, 1790, 1749,
-      366, 1740,  512, 1949, 1949,  521, 1949, 1949, 1727,    0,
-
-      241,  513, 1729,  546,  534, 1785, 1736,  538, 1949, 1783,
-     1949, 1777,  588, 1949,  537, 1717, 1726, 1774, 1718, 1717,
-     1723, 1775, 1730, 1725, 1728, 1723,  533, 1949, 1725, 1769,
-     1722, 1719,  564, 1725, 1765, 1759, 1712, 1707, 1704, 1755,
-     1712, 1701, 1717, 1751, 1697,  611, 1711, 1696, 1709, 1696,
-     1706, 1701, 1708, 1703, 1699,  432, 1697, 1700, 1695, 1691,
-     1741,  525, 1735, 1949, 1734, 1684, 1683, 1682, 1675, 1677,
-     1681, 1670, 1683,  568, 1730, 1683, 1680, 1949, 1683, 1672,
-     1672, 1684,  560, 1659, 1660, 1681,  570, 1663, 1714, 1659,
-     1673, 1676, 1671, 1657, 1669, 1668, 1667, 1666, 1665, 1664,
-
-      526, 1707, 1706, 1949, 1648, 1647,  615, 1660, 1949, 1949,
-     1659,    0, 1648, 1640,  561, 1645, 1698, 1697, 1653, 1695,
-     1949, 1641, 1693, 1949,  595,  662,  564, 1692, 1634, 1645,
-     1638, 1640, 1628, 1949, 1633, 1639, 1642, 1625, 1640, 1627,
-     1626, 1949, 1628, 1625,  569, 1623, 1625, 1949, 1633, 1630,
-     1615, 1628, 1623,  634, 1630, 1618, 1611, 1662, 1949, 1609,
-     1625, 1659, 1620, 1617, 1618, 1620, 1654, 1605, 1600, 1599,
-     1650, 1594, 1609, 1587, 1594, 1599, 1649, 1949, 1594, 1590,
-     1588, 1597, 1591, 1598, 1582, 1582, 1592, 1595, 1584, 1579,
-     1949, 1636, 1949, 1578, 1589, 1574, 1579, 1588, 1582, 1576,
-
-     1585, 1627, 1621, 1583, 1566, 1566, 1561, 1581, 1556, 1562,
-     1567, 1560, 1568, 1572, 1555, 1613, 1553, 1554, 1553, 1565,
-     1554, 1949, 1949, 1554, 1552, 1949, 1563, 1599, 1559,    0,
-     1543, 1560, 1600, 1548, 1949, 1949, 1545, 1949, 1551, 1949,
-      597,  606,  636, 1949, 1548, 1547, 1554, 1534, 1587, 1532,
-     1585, 1530, 1529, 1528, 1535, 1528, 1540, 1539, 1539, 1521,
-     1526, 1567, 1534, 1526, 1571, 1515, 1531, 1530, 1949, 1515,
-     1512, 1570, 1525, 1517, 1523, 1514, 1522, 1507, 1523, 1505,
-     1519,  560, 1501, 1495, 1500, 1515, 1512, 1513, 1510, 1553,
-     1508, 1949, 1494, 1496, 1505, 1503, 1542, 1541, 1492,   16,
-
-     1501, 1484, 1485, 1482, 1949, 1496, 1475, 1494, 1486, 1531,
-     1483, 1490, 1528, 1949, 1473, 1487, 1471, 1485, 1488, 1469,
-     1521, 1520, 1519, 1518, 1463, 1516, 1515, 1949,  593, 1477,
-     1476, 1473, 1473, 1471, 1454, 1459, 1461, 1949, 1467, 1457,
-     1949, 1504, 1450, 1507,  606,  617, 1448, 1446, 1453, 1444,
-     1497,  598, 1501,  600, 1495, 1455, 1493, 1492, 1444, 1434,
-     1489, 1440, 1448, 1449, 1485, 1446, 1440, 1427, 1435, 1480,
-     1484, 1439, 1438, 1949, 1439, 1432, 1421, 1434, 1437, 1432,
-     1433, 1430, 1429, 1425, 1431, 1426, 1469, 1468, 1416, 1406,
-      593, 1465, 1949, 1464, 1411, 1403, 1404, 1455, 1416, 1403,
-
-     1414, 1949, 1402, 1411, 1410, 1410, 1452, 1393, 1402, 1407,
-     1384, 1388, 1441, 1403, 1385,  166,  272,  323,  379,  346,
-      422,  448,  601,  529,  607,  517,  599,  600, 1949,  657,
-      614,  616,  612,  624,  632,  617,  624,  630,  628,  642,
-      647,  688, 1949,  684,  660,  647,  652,  649,  650,  647,
-      645,  654, 1949,  644,  659,  656,  642,  655,  654,  652,
-      671,  668,  658,  656,  655,  666,  662,  719,  676,  666,
-      682,  672, 1949,  682,  682,  675,  686,  684,  729,  671,
-      673,  688,  675,  735,  692,  678,  681, 1949, 1949,  691,
-      696,  701,  689, 1949, 1949,  703,  690,  684,  689,  707,
-
-      694,  744,  695,  747,  696,  754, 1949,  699,  703,  698,
-      758,  711,  701,  702,  698,  711,  722,  706,  724,  719,
-      720,  722,  715,  717,  718,  719,  719,  721,  736,  777,
-      734,  739,  716, 1949,  728,  729,  743,  733,  780,  738,
-      728,  743,  744,  731,  745, 1949,  764,  772,  741,  736,
-      791,  792,  755,  759,  800,  748,  743,  744,  756,  763,
-      752,  753,  749,  758,  753,  811,  768,  769,  760, 1949,
-      762,  774,  759,  776,  770,  817,  783,  767,  768, 1949,
-      784,  787,  770,  829,  772, 1949,  789,  792,  772,  790,
-      830,  788,  784,  779,  797,  796,  797,  783,  798,  790,
-
-      797,  787,  805,  790, 1949,  798,  804,  851, 1949,  800,
-      805,  849,  800,  812,  806,  811,  809,  807,  809,  819,
-      864,  808,  813,  809,  868,  812,  824, 1949,  812,  820,
-      818,  815,  816,  825,  837,  821,  826,  836,  837,  842,
-      883,  840,  856,  862,  843,  841,  837,  832,  892,  835,
-     1949,  835,  855,  854,  845,  834,  851,  858,  901,  902,
-      849, 1949,  899,  846,  849,  848,  868,  865,  870,  871,
-      857,  866,  876,  856,  871,  878,  920, 1949,  921,  922,
-      873,  883,  885,  874,  870,  877,  886,  931,  878,  876,
-      878,  895,  936,  886,  885,  891,  889,  887,  942,  943,
-
-      939, 1949,  901,  894,  885,  904,  892,  902,  899,  904,
-      900,  913,  913, 1949,  897,  899,  899, 1949,  900,  960,
-      899,  918,  919,  964,  965,  919,  904,  925,  924,  908,
-      913,  931, 1949,  921,  954,  945,  977,  917,  939,  936,
-     1949,  923,  925,  942,  937,  941,  986,  934,  938, 1949,
-     1949,  948,  948,  986,  933,  988,  935,  995,  938,  949,
-      942,  948,  944,  962,  963,  965, 1949, 1949,  964, 1949,
-      949,  950,  969,  959,  952,  964, 1008,  972, 1949,  964,
-     1016,  957, 1018, 1949, 1019,  961,  967,  974, 1018, 1949,
-     1949,  966,  968,  982,  987,  970, 1029,  986,  987,  988,
-
-     1028,  980,  985, 1036,  989,  985, 1039, 1949,  986, 1041,
-     1042, 1949, 1949,  982, 1044, 1003, 1046,  988, 1000, 1005,
-      991, 1021, 1052, 1949, 1009, 1002, 1011, 1056, 1003, 1018,
-     1054, 1006, 1949, 1002, 1018, 1023, 1010, 1006, 1066, 1019,
-     1024, 1949, 1025, 1018, 1027, 1028, 1025, 1015, 1018, 1018,
-     1023, 1078, 1080, 1023, 1082, 1078, 1019, 1034, 1028, 1088,
-     1949, 1041, 1949, 1949, 1046, 1038, 1048, 1034, 1035, 1096,
-     1040, 1050, 1099, 1949, 1048, 1048, 1050, 1052, 1105, 1046,
-     1049, 1949, 1050, 1069, 1949, 1053, 1949, 1949, 1067, 1949,
-     1061, 1949, 1113, 1062, 1115, 1116, 1096, 1949, 1118, 1075,
-
-     1116, 1949, 1064, 1072, 1066, 1063, 1066, 1069, 1069, 1070,
-     1077, 1067, 1949, 1089, 1075, 1076, 1091, 1091, 1094, 1094,
-     1091, 1136, 1098, 1090, 1949, 1949, 1100, 1949, 1097, 1102,
-     1103, 1100, 1144, 1949, 1093, 1094, 1094, 1100, 1099, 1110,
-     1949, 1151, 1098, 1949, 1099, 1099, 1101, 1107, 1949, 1109,
-     1163, 1105, 1113, 1116, 1167, 1128, 1949, 1125, 1949, 1122,
-     1949, 1145, 1949, 1172, 1114, 1174, 1175, 1132, 1137, 1119,
-     1179, 1180, 1133, 1123, 1128, 1184, 1185, 1181, 1144, 1140,
-     1184, 1132, 1137, 1135, 1194, 1150, 1196, 1154, 1199, 1160,
-     1149, 1143, 1159, 1159, 1205, 1147, 1164, 1163, 1147, 1205,
-
-     1206, 1153, 1208, 1171, 1172, 1949, 1172, 1173, 1160, 1949,
-     1171, 1220, 1178, 1191, 1949, 1175, 1949, 1949, 1166, 1177,
-     1226, 1949, 1949, 1173, 1171, 1185, 1949, 1949, 1175, 1226,
-     1169, 1174, 1234, 1182, 1192, 1193, 1949, 1238, 1191, 1949,
-     1240, 1949, 1183, 1198, 1186, 1201, 1205, 1949, 1241, 1207,
-     1200, 1209, 1192, 1200, 1254, 1213, 1212, 1257, 1205, 1259,
-     1260, 1209, 1949, 1262, 1263, 1212, 1265, 1207, 1949, 1214,
-     1214, 1269, 1213, 1212, 1272, 1225, 1949, 1269, 1220, 1217,
-     1949, 1231, 1949, 1234, 1279, 1232, 1281, 1240, 1223, 1225,
-     1222, 1238, 1239, 1248, 1949, 1238, 1290, 1949, 1249, 1949,
-
-     1949, 1287, 1949, 1949, 1249, 1949, 1289, 1290, 1245, 1949,
-     1243, 1250, 1949, 1247, 1252, 1250, 1302, 1303, 1246, 1949,
-     1261, 1949, 1262, 1252, 1264, 1309, 1251, 1259, 1260, 1273,
-     1949, 1250, 1273, 1258, 1258, 1263, 1319, 1278, 1269, 1278,
-     1280, 1284, 1949, 1949, 1325, 1268, 1327, 1285, 1329, 1949,
-     1325, 1287, 1288, 1275, 1334, 1271, 1336, 1289, 1294, 1949,
-     1295, 1296, 1341, 1298, 1301, 1949, 1344, 1949, 1305, 1949,
-     1287, 1347, 1348, 1291, 1949, 1308, 1949, 1299, 1295, 1295,
-     1297, 1949, 1302, 1312, 1949, 1298, 1310, 1949, 1949, 1315,
-     1309, 1317, 1314, 1305, 1359, 1306, 1314, 1323, 1316, 1311,
-
-     1326, 1371, 1318, 1325, 1312, 1327, 1332, 1377, 1334, 1379,
-     1322, 1949, 1338, 1329, 1343, 1339, 1332, 1949, 1386, 1949,
-     1387, 1388, 1343, 1342, 1343, 1333, 1949, 1949, 1949, 1393,
-     1335, 1351, 1396, 1949, 1392, 1341, 1949, 1340, 1342, 1353,
-     1402, 1351, 1949, 1360, 1405, 1949, 1949, 1411, 1416, 1421,
-     1426, 1431, 1436, 1441, 1444, 1418, 1423, 1425, 1438
+        1,    0,   75,    0,  149,    0, 1290, 1489, 1240, 1508,
+        0,  892, 1436, 1040,  223,  889, 1204,  966, 1179, 1174,
+     1439, 1250, 1114, 1513, 1283, 1246, 1270, 1285, 1198, 1205,
+     1403, 1382, 1420, 1253, 1282, 1374, 1449, 1542, 1525, 1037,
+     1539, 1455, 1531,  297,  371, 1735, 1737, 1511, 1518, 1738,
+     1737, 1261, 1150, 1739, 1506, 1181, 1524, 1532,  445, 1335,
+     1413, 1300, 1314, 1405, 1422, 1513, 1147, 1195, 1737, 1354,
+     1411, 1364, 1341, 1416, 1737, 1515, 1312, 1307, 1369, 1737,
+        0, 1211,    0, 1324, 1289, 1737,  963, 1738, 1243, 1371,
+     1446, 1460, 1432, 1461, 1465, 1466, 1739, 1549, 1740, 1740,
+
+     1741, 1331, 1745, 1526, 1526, 1743, 1743, 1539, 1535, 1743,
+     1532, 1540, 1537, 1543, 1554, 1111,    0,  519, 1431, 1743,
+     1743, 1743, 1744, 1743, 1744, 1746, 1427, 1748, 1743, 1744,
+     1064, 1744, 1747, 1757, 1760, 1530, 1754, 1531, 1757, 1757,
+     1427, 1744, 1743, 1753, 1745, 1749, 1743, 1745, 1747, 1767,
+     1518, 1763, 1758, 1765, 1761, 1435, 1773, 1769, 1762, 1763,
+     1778, 1525, 1767, 1446, 1555, 1763,  593, 1532, 1448, 1785,
+     1784, 1787, 1787, 1746, 1747, 1557, 1772, 1776, 1558, 1770,
+     1788, 1783, 1482, 1480, 1489, 1490, 1494, 1496, 1580, 1743,
+     1185, 1748, 1577, 1584, 1776, 1781, 1571, 1577, 1790, 1582,
+
+     1754, 1587, 1758, 1580, 1747,  667, 1760, 1593, 1797, 1786,
+     1792, 1782, 1799, 1800, 1799, 1800, 1794, 1358, 1761, 1757,
+     1806, 1788, 1798, 1795, 1810, 1808, 1799, 1812, 1814, 1807,
+     1794, 1800, 1814, 1818, 1817, 1812, 1804, 1823, 1748, 1820,
+     1825, 1809, 1810, 1758, 1812, 1823, 1828, 1489, 1826, 1817,
+     1829, 1759, 1816, 1765, 1812, 1828, 1497, 1821, 1838, 1822,
+     1823, 1831, 1824, 1825, 1834, 1826, 1766, 1843, 1844, 1840,
+     1555, 1849, 1846, 1841, 1833, 1849, 1850, 1847, 1853, 1279,
+     1853, 1842, 1850, 1858, 1849, 1848, 1849, 1611, 1846, 1861,
+     1767, 1866, 1600, 1859, 1501, 1750, 1751, 1514, 1752, 1774,
+
+     1404, 1224, 1565, 1342, 1585, 1852, 1503, 1596, 1775, 1861,
+     1589, 1775, 1776, 1776, 1778,  741, 1777, 1584, 1847, 1869,
+     1859, 1909, 1855, 1856, 1864, 1779, 1873, 1870, 1875, 1872,
+     1580, 1778, 1876, 1780, 1876, 1875, 1617, 1883, 1781, 1921,
+     1876, 1873, 1872, 1925, 1883, 1875, 1892, 1929, 1877, 1370,
+     1892, 1880, 1894, 1884, 1895, 1892, 1901, 1898, 1896, 1579,
+     1896, 1901, 1898, 1897, 1949, 1592, 1945, 1779, 1946, 1898,
+     1899, 1900, 1895, 1593, 1904, 1895, 1909, 1624, 1959, 1913,
+     1912, 1917, 1780, 1969, 1969, 1969, 1969, 1587, 1969, 1969,
+     1970, 1600, 1969, 1969, 1969, 1970, 1971, 1971, 1970, 1972,
+
+     1973, 1974, 1975, 1976, 1979, 1601, 1969, 1970, 1969, 1972,
+     1973, 1653, 1981, 1970, 1971, 1632, 1263, 1979, 1974, 1612,
+     1616, 1981, 1972, 1973, 1992, 1975, 1972, 1984, 1976, 1973,
+     1383,  815, 1625, 1977, 1978, 1981, 1993, 1989, 1992, 1983,
+     1974, 1990, 1997, 2002, 1988, 2004, 1994, 1995, 1977, 1999,
+     1998, 1474, 1998, 2002, 1985, 2011, 2010, 1998, 2012, 2009,
+     1655, 2018, 2009, 2004, 1986, 1986, 2005, 2022, 1987, 2020,
+     2019, 2022, 2026, 1988, 2015, 2012, 2013, 1989, 2011, 2027,
+     2008, 2017, 2024, 1987, 1987, 2022, 2020, 2020, 2030, 2027,
+     2035, 2022, 2024, 2033, 2036, 2041, 2033, 2030, 1988, 1989,
+
+     1989, 2032, 2044, 1990, 2032, 2039, 2049, 2045, 2042, 2052,
+     1990, 1991, 2054, 2040, 2042, 2039, 2060, 2038, 2046, 2053,
+     2048, 2057, 2063, 2049, 1997, 2050, 2053, 2054, 2067, 2059,
+     1990, 1991, 2061, 2061, 1992, 2073, 1994, 1665, 1302, 2058,
+     2076, 1998, 2000, 2068, 1994, 2007, 2067, 2008, 2074, 2009,
+     1633, 1632, 1663, 2010, 2011, 2073, 2074, 2083, 2066, 2121,
+     2068, 2123, 2070, 2071, 2072, 2081, 2076, 2089, 2090, 2092,
+     2077, 2084, 2127, 2095, 2090, 2137, 2083, 2100, 2101, 2012,
+     2089, 2088, 2013, 2103, 2098, 2105, 2099, 2108, 2096, 2113,
+     2098, 2113, 1621, 1661, 2093, 2100, 2116, 2115, 2118, 2117,
+
+     2163, 2119, 2013, 2108, 2112, 2122, 2122, 2164, 2165, 2118,
+     1667, 2118, 2129, 2115, 2118, 2117, 2014, 2132, 2114, 2121,
+     2135, 2130, 2177, 2131, 2139, 2180, 2015, 2192, 2192, 2193,
+     2193, 2192, 2192, 2192, 2193, 2194, 2195, 2194, 2196, 2197,
+     2192, 1673, 2193, 2196, 2195, 2197, 2197, 2194, 2193, 2193,
+     2193, 2198, 2195, 2194, 2195, 2198, 2197, 2196, 1637, 1650,
+     2198, 2198, 2198, 2199, 2199, 1629, 2205, 1375, 2201, 2200,
+     2202, 2203, 2207, 2199, 2204, 2208, 2201, 2219, 2205, 2219,
+     2215, 2205, 2215, 2206, 2212, 2222, 2223, 2196, 2226, 2221,
+     2213, 2227, 2232, 2229, 2232, 2231, 2232, 2230, 2238, 2225,
+
+     2236, 2213, 2214, 2231, 2223, 1623, 2215, 2197, 2216, 2232,
+     2226, 2229, 2212, 2243, 2233, 2245, 2198, 2236, 2229, 2247,
+     2248, 2250, 2218, 2237, 2247, 2248, 2255, 2235, 2241, 2214,
+     2258, 2243, 2254, 2215, 2216, 2217, 2245, 2218, 2262, 1626,
+     2263, 1376, 2243, 2255, 1626, 2199, 2224, 2264, 2265, 2256,
+     2267, 2269, 2255, 2262, 2267, 2260, 2273, 2278, 2225, 2200,
+     2221, 1655, 2275, 2280, 2277, 2278, 2275, 2274, 2282, 2201,
+     2273, 2287, 2284, 2270, 2272, 2279, 2278, 2276, 2294, 2291,
+     2282, 2280, 2279, 2290, 2286, 2234, 2297, 2288, 2303, 2294,
+     2233, 2303, 2303, 2297, 2307, 2305, 1688, 2292, 2294, 2308,
+
+     2296, 2235, 2310, 2297, 2300, 2301, 2234, 2235, 2310, 2315,
+     2320, 2309, 2236, 2237, 2322, 2310, 2304, 2309, 1649, 2313,
+     2363, 2314, 2370, 2366, 2315, 2373, 2238, 2380, 2380, 2380,
+     2380, 2380, 2380, 2381, 2382, 2380, 2380, 2380, 2383, 2381,
+     2381, 2382, 2380, 2380, 2380, 2383, 2384, 2388, 2392, 2380,
+     2381, 2380, 2381, 2383, 2380, 2395, 2396, 2385, 2399, 2381,
+     2402, 2393, 2381, 2407, 2395, 2408, 2381, 1662, 1671, 2403,
+     2398, 2382, 2383, 2414, 2418, 2382, 2407, 2402, 2403, 2404,
+     2415, 2422, 2412, 2413, 2409, 2418, 2413, 2383, 2426, 2427,
+     2419, 2382, 2421, 2431, 2417, 2432, 2427, 2384, 2438, 2423,
+
+     2424, 2383, 2439, 2442, 2426, 1697, 2427, 2384, 2443, 2446,
+     2434, 2428, 2445, 2385, 2442, 2439, 2434, 2451, 2450, 2451,
+     2438, 2452, 2445, 2451, 2442, 2385, 1655, 2444, 2390, 2452,
+     2457, 2460, 2391, 2391, 2454, 2458, 2398, 2453, 2464, 2459,
+     2462, 2461, 2459, 2461, 2470, 2398, 2459, 2464, 2460, 2399,
+     2462, 2473, 2398, 2462, 2470, 2468, 2465, 2466, 2475, 2486,
+     2471, 2476, 2485, 2486, 2491, 2400, 2488, 1669, 1674, 2490,
+     2486, 2483, 2478, 2401, 2480, 2399, 2480, 2499, 2498, 2487,
+     2491, 2480, 2496, 2503, 2402, 2404, 2493, 2400, 2401, 2489,
+     2492, 2491, 2510, 2507, 2512, 2513, 2500, 2507, 2516, 2497,
+
+     2511, 2518, 2405, 2401, 1700, 1702, 2511, 2520, 2520, 2523,
+     2512, 2508, 2515, 2523, 2407, 2515, 2513, 2515, 2531, 2408,
+     2522, 2521, 2526, 2525, 2523, 2409, 2410, 2406, 2412, 2402,
+     2533, 2527, 2518, 2536, 2525, 2534, 2532, 2536, 2533, 2545,
+     2545, 2403, 2530, 2532, 2532, 2419, 2533, 2420, 2531, 2549,
+     2550, 2596, 2597, 2549, 2535, 2555, 2554, 2539, 2544, 2561,
+     2420, 2552, 1683, 1671, 2606, 2546, 2567, 2564, 2421, 2552,
+     2554, 2570, 2565, 2554, 2570, 2616, 2564, 2568, 2422, 2423,
+     2577, 2577, 2616, 2563, 2618, 2565, 2625, 2568, 2578, 2571,
+     2577, 2573, 2590, 2591, 2592, 2424, 2425, 2640, 2640, 2641,
+
+     2642, 2641, 2641, 2641, 2642, 2641, 2641, 2641, 2641, 2642,
+     2642, 2642, 2643, 2642, 2644, 2644, 2643, 2645, 2643, 2643,
+     2644, 2646, 2645, 2648, 2646, 2646, 2648, 2647, 2650, 2651,
+     2653, 1701, 2653, 2658, 2649, 2660, 2657, 2650, 2646, 2657,
+     2651, 2652, 2647, 2651, 2659, 2659, 2669, 2660, 2659, 2664,
+     2669, 2660, 1678, 2661, 2659, 2670, 2664, 2672, 1711, 2667,
+     2681, 2660, 2664, 2670, 2660, 2666, 2681, 2686, 2674, 2670,
+     2662, 2681, 2686, 2661, 2687, 2681, 2689, 2690, 2687, 2678,
+     2681, 2681, 2686, 2663, 2664, 2683, 2684, 2666, 2662, 2678,
+     1663, 2685, 2668, 2662, 2696, 2663, 2664, 2701, 2694, 2703,
+
+     2689, 2690, 2675, 2694, 2703, 2676, 2675, 2700, 2700, 2702,
+     2704, 2677, 2697, 2700, 2676, 2701, 2719, 2677, 2704, 2678,
+     2679, 2717, 2680, 2712, 2684, 2685, 2712, 1718, 2688, 1694,
+     2685, 2689, 2720, 2761, 2686, 2709, 2717, 2711, 2708, 2766,
+     2712, 2715, 2715, 2716, 2723, 2713, 2687, 2784, 2784, 2785,
+     2784, 2784, 2787, 2787, 2784, 2784, 2789, 2784, 2784, 2785,
+     2790, 2786, 2786, 2787, 2793, 2794, 2791, 2787, 2787, 2788,
+     2789, 2789, 2788, 2793, 2803, 2788, 2789, 2791, 2789, 2792,
+     2792, 2794, 2800, 2790, 2802, 2791, 2797, 2805, 2808, 2793,
+     2818, 2791, 2815, 2792, 2812, 2793, 1685, 2794, 2796, 2803,
+
+     2797, 2798, 2818, 2823, 2806, 2807, 2799, 2800, 2818, 2809,
+     2814, 2801, 2802, 2798, 2826, 2822, 2799, 2814, 2819, 1667,
+     1719, 2828, 2805, 2806, 2831, 2807, 2835, 2825, 2819, 2834,
+     2834, 2808, 2822, 2838, 2837, 2822, 2804, 2805, 2826, 2806,
+     2842, 2843, 2796, 2843, 2844, 2832, 2801, 2842, 2818, 2848,
+     1689, 2818, 2844, 2819, 2820, 2836, 2846, 2848, 2821, 2821,
+     2822, 2843, 2841, 2854, 2823, 2825, 2845, 2896, 2839, 2844,
+     2826, 2851, 2860, 2861, 2826, 2907, 2859, 2828, 2829, 2909,
+     2830, 2852, 2866, 2855, 2869, 2873, 2831, 2910, 2875, 2868,
+     2877, 2860, 2867, 2921, 2879, 2878, 2924, 2872, 2926, 2927,
+
+     2876, 2833, 2935, 2936, 2935, 2937, 2935, 2935, 2935, 2936,
+     2936, 2938, 2936, 2936, 2939, 2936, 2936, 2937, 2941, 2938,
+     2937, 2939, 2938, 2939, 2940, 2939, 2941, 2939, 2939, 2939,
+     2939, 2942, 2951, 2939, 2939, 2950, 2943, 2940, 2960, 2950,
+     2951, 2952, 2952, 2953, 2959, 2954, 2955, 2960, 2956, 2955,
+     2955, 2956, 2958, 2956, 2957, 2959, 2960, 2958, 2959, 2957,
+     2957, 2967, 2958, 2968, 2959, 2971, 2962, 2959, 2965, 2967,
+     2979, 2959, 2960, 2978, 2964, 2964, 2984, 2971, 2963, 2984,
+     2976, 2984, 2986, 2990, 2960, 2961, 2964, 2974, 2965, 2989,
+     2966, 2962, 2973, 2989, 2990, 2978, 2973, 2973, 2974, 2989,
+
+     2995, 2995, 2973, 2996, 2997, 2975, 2998, 3001, 2974, 2976,
+     2975, 3004, 2976, 2987, 2977, 2979, 2989, 2977, 3005, 2978,
+     2997, 2992, 2994, 2994, 2996, 2987, 3001, 3010, 2989, 3062,
+     3062, 3062, 3063, 3064, 3064, 3065, 3064, 3064, 3064, 3064,
+     3064, 3064, 3067, 3065, 3066, 3069, 3065, 3064, 3065, 3069,
+     3065, 3071, 3080, 3066, 3081, 3067, 3070, 3065, 3085, 3077,
+     3066, 3085, 3079, 3066, 3068, 3067, 3070, 3071, 3086, 3085,
+     3086, 3077, 3068, 3069, 3078, 3079, 3079, 3092, 3080, 3079,
+     3080, 3082, 3080, 3081, 3083, 3093, 3081, 3091, 3081, 3099,
+     3082, 3082, 3173
     } ;
 
-static const flex_int16_t yy_def[1560] =
+static const flex_int16_t yy_def[1594] =
     {   0,
-     1548, 1548, 1549, 1549, 1548, 1548, 1548, 1548, 1548, 1548,
-     1547, 1547, 1547, 1547, 1547, 1550, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1551,
-     1547, 1547, 1547, 1552,   15, 1547,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1553,   45,   45,
+     1593,    1, 1593,    3, 1593,    5,    5,    5,    5,    5,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,   17,   17,
+     1593,   17, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1550,
-     1547, 1547, 1547, 1547, 1547, 1547, 1554, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1551, 1547,
-
-     1552, 1547, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1555,   45, 1553,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       16,   17,   17, 1593,   17, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,   40, 1593,
+
+     1593, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1593,   45, 1593,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1554, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1556,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 1555, 1547, 1553,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593, 1593,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1557,
+       45,   45,   45,   45, 1593, 1593, 1593, 1593, 1593, 1593,
 
-       45,   45,   45,   45,   45,   45,   45,   45, 1547,   45,
-     1547,   45, 1553, 1547,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
+     1593, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1593,   45, 1593,   45, 1593, 1593,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1593,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1593,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 1547,   45,   45,   45,   45, 1547, 1547,
-     1547, 1558,   45,   45,   45,   45,   45,   45,   45,   45,
-     1547,   45,   45, 1547,   45, 1553,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-       45, 1547,   45,   45,   45,   45,   45, 1547,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1547,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45,   45, 1593, 1593, 1593, 1593,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45, 1593,
+       45, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
+     1593,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45,   45,   45, 1593,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1593,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1547,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
 
+     1593,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1547, 1547,   45,   45, 1547,   45,   45, 1547, 1559,
-       45,   45,   45,   45, 1547, 1547,   45, 1547,   45, 1547,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
+     1593, 1593,   45,   45, 1593,   45,   45, 1593, 1593,   45,
+       45,   45,   45,   45, 1593, 1593,   45, 1593,   45, 1593,
+       45,   45,   45, 1593, 1593,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1547,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1593,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45, 1547,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
-     1547,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1593,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1593,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1593,   45,   45, 1593, 1593,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1593,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1593,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1547,   45,
+       45,   45,   45,   45,   45, 1593,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1593,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1593,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547, 1547,   45,
-       45,   45,   45, 1547, 1547,   45,   45,   45,   45,   45,
+     1593,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45, 1547,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593, 1593,   45,   45,
+       45,   45, 1593, 1593,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1547,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1547,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1547,
-       45,   45,   45,   45,   45, 1547,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45, 1547,   45,   45,   45, 1547,   45,
+       45, 1593,   45,   45,   45,   45,   45, 1593,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
+       45,   45,   45,   45,   45, 1593,   45,   45, 1593,   45,
+       45,   45,   45, 1593,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1593,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1547,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1593,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1593,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45, 1547,   45,   45,
+       45,   45,   45, 1593,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
-     1547,   45,   45,   45,   45,   45,   45,   45,   45, 1547,
-     1547,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1547, 1547,   45, 1547,
-       45,   45,   45,   45,   45,   45,   45,   45, 1547,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45, 1547,
-     1547,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1547,   45,   45,
-       45, 1547, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1593,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1547,   45, 1547, 1547,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-       45, 1547,   45,   45, 1547,   45, 1547, 1547,   45, 1547,
-       45, 1547,   45,   45,   45,   45,   45, 1547,   45,   45,
-
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1547, 1547,   45, 1547,   45,   45,
-       45,   45,   45, 1547,   45,   45,   45,   45,   45,   45,
-     1547,   45,   45, 1547,   45,   45,   45,   45, 1547,   45,
-       45,   45,   45,   45,   45,   45, 1547,   45, 1547,   45,
-     1547,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
+       45, 1593,   45,   45,   45, 1593,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1593,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593, 1593,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1593, 1593,   45, 1593,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45,   45, 1593,   45,   45,   45,   45,   45, 1593,
+     1593,   45, 1593,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45, 1593, 1593,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45,   45,   45,   45,
+       45,   45,   45, 1593,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1593,   45, 1593, 1593,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45, 1593,   45, 1593,
+     1593,   45, 1593,   45, 1593,   45,   45,   45,   45,   45,
+     1593,   45,   45,   45, 1593,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1593, 1593,
+       45,   45, 1593,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45,   45,   45,   45, 1593,   45,   45, 1593,   45,
+       45,   45,   45, 1593,   45,   45,   45,   45,   45,   45,
+       45, 1593,   45, 1593,   45, 1593,   45, 1593,   45,   45,
 
-       45,   45,   45,   45,   45, 1547,   45,   45,   45, 1547,
-       45,   45,   45,   45, 1547,   45, 1547, 1547,   45,   45,
-       45, 1547, 1547,   45,   45,   45, 1547, 1547,   45,   45,
-       45,   45,   45,   45,   45,   45, 1547,   45,   45, 1547,
-       45, 1547,   45,   45,   45,   45,   45, 1547,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547,   45,   45,   45,   45,   45, 1547,   45,
-       45,   45,   45,   45,   45,   45, 1547,   45,   45,   45,
-     1547,   45, 1547,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1547,   45,   45, 1547,   45, 1547,
-
-     1547,   45, 1547, 1547,   45, 1547,   45,   45,   45, 1547,
-       45,   45, 1547,   45,   45,   45,   45,   45,   45, 1547,
-       45, 1547,   45,   45,   45,   45,   45,   45,   45,   45,
-     1547,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1547, 1547,   45,   45,   45,   45,   45, 1547,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1547,
-       45,   45,   45,   45,   45, 1547,   45, 1547,   45, 1547,
-       45,   45,   45,   45, 1547,   45, 1547,   45,   45,   45,
-       45, 1547,   45,   45, 1547,   45,   45, 1547, 1547,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1547,   45,   45,   45,   45,   45, 1547,   45, 1547,
-       45,   45,   45,   45,   45,   45, 1547, 1547, 1547,   45,
-       45,   45,   45, 1547,   45,   45, 1547,   45,   45,   45,
-       45,   45, 1547,   45,   45, 1547,    0, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1593,   45,   45,   45, 1593,   45,   45,   45,
+       45, 1593,   45, 1593, 1593,   45,   45,   45,   45, 1593,
+     1593,   45,   45,   45, 1593, 1593,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45, 1593, 1593,   45,
+     1593,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45, 1593,   45,   45,   45,   45,   45,   45, 1593,   45,
+       45,   45,   45,   45,   45,   45, 1593,   45,   45,   45,
+     1593,   45, 1593,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593,   45,   45, 1593,   45, 1593,
+     1593,   45, 1593, 1593,   45, 1593,   45,   45,   45,   45,
+     1593,   45,   45, 1593,   45,   45,   45,   45,   45,   45,
+     1593,   45, 1593,   45,   45,   45,   45,   45,   45,   45,
+       45, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1593, 1593,   45,   45,   45,   45,
+       45, 1593,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45, 1593,   45,   45,   45,   45,   45, 1593,   45,
+     1593,   45, 1593,   45,   45,   45,   45, 1593,   45, 1593,
+       45,   45,   45,   45,   45, 1593,   45,   45, 1593,   45,
+       45, 1593, 1593,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1593,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1593,   45,   45,
+       45,   45,   45, 1593,   45, 1593,   45,   45,   45,   45,
+       45,   45, 1593, 1593, 1593,   45,   45,   45,   45, 1593,
+       45,   45, 1593,   45,   45,   45,   45,   45, 1593,   45,
+       45, 1593,    0
     } ;
 
-static const flex_int16_t yy_nxt[2023] =
+static const flex_int16_t yy_nxt[3247] =
     {   0,
-     1547,   13,   14,   13, 1547,   15,   16, 1547,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       86,  702,   37,   14,   37,   87,   25,   26,   38,  102,
-     1547,   27,   37,   14,   37,   42,   28,   42,   38,   92,
-       93,   29,  197,   30,   13,   14,   13,   91,   92,   25,
-       31,   93,   13,   14,   13,   13,   14,   13,   32,   40,
-      703,   13,   14,   13,   33,   40,  103,   92,   93,  197,
-       91,   34,   35,   13,   14,   13,   95,   15,   16,   96,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   91,   39,  105,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  108,   42,   28,   42,
-      109,   42,   41,   29,  111,   30,  114,  115,   94,  140,
-       41,   25,   31,  105,  221,  222,   89,  141,   89,  108,
-       32,   90,   90,   90,   90,   90,   33,  111,  109,  114,
-      227,  115,  228,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   45,   45,   45,   45,   48,   45,   49,
-       50,   45,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   60,   61,   62,   63,   64,   65,   66,   67,   52,
-
-       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
-       78,   79,   57,   45,   45,   45,   45,   45,   81,  816,
-       82,   82,   82,   82,   82,   81,  105,   84,   84,   84,
-       84,   84,  108,   83,   85,   85,   85,   85,   85,   81,
-       83,   84,   84,   84,   84,   84,  183,   83,  258,  259,
-      112,  123,  119,  134,   83,  108,   83,  185,  120,  124,
-      113,  121,  125,   83,  135,  126,  137,  127,  138,  128,
-       83,  142,  183,  112,  136,  139,  161,   83,   45,  184,
-      162,  143,  817,  144,   45,  185,   45,   45,  113,   45,
-      163,   45,   45,   45,  413,  117,  146,  147,   45,   45,
-
-      148,   45,   45,  185,  414,  184,  149,   45,   45,   45,
+       11,   12,   13,   14,   13,   12,   15,   16,   12,   17,
+       18,   19,   20,   21,   22,   22,   22,   22,   22,   23,
+       24,   12,   12,   12,   12,   12,   12,   25,   26,   12,
+       12,   12,   12,   27,   12,   12,   12,   12,   28,   12,
+       12,   12,   12,   29,   12,   30,   12,   12,   12,   12,
+       12,   25,   31,   12,   12,   12,   12,   12,   12,   32,
+       12,   12,   12,   12,   12,   33,   12,   12,   12,   12,
+       12,   12,   34,   35,   11,   36,   37,   14,   37,   36,
+       36,   36,   38,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   11,   12,
+       13,   14,   13,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   39,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   11,   44,   44,   44,   45,   45,   46,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
+       45,   45,   45,   45,   45,   48,   49,   50,   51,   45,
+       52,   45,   45,   53,   54,   55,   45,   45,   45,   45,
+       56,   57,   45,   58,   45,   45,   59,   45,   45,   60,
+       61,   62,   63,   64,   65,   66,   67,   68,   69,   70,
+       71,   72,   73,   74,   75,   76,   77,   78,   79,   80,
+       58,   45,   45,   45,   45,   45,   11,   44,   44,   44,
+
+       44,   44,  101,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      102,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       11,   44,   44,   44,   45,   45,   46,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      129,  188,   45,  818,  130,  150,   45,  131,  132,  151,
-       45,  111,  165,  275,  276,  183,  166,  102,   45,  114,
-      133,  193,   45,  156,   45,  118,  200,  173,  174,  152,
-      153,  157,  154,  158,  155,  184,  167,  112,  159,  160,
-      168,  186,  178,  169,  246,  392,  406,  113,  247,  193,
-      170,  171,  179,  200,  103,  203,  172,  180,  393,  819,
-      175,  187,  176,   85,   85,   85,   85,   85,   81,  199,
-
-       82,   82,   82,   82,   82,  113,   83,  201,  203,   89,
-      820,   89,  177,   83,   90,   90,   90,   90,   90,   81,
-      202,   84,   84,   84,   84,   84,  101,  199,  407,   83,
-      196,  193,  821,  101,   83,  201,   83,   85,   85,   85,
-       85,   85,   90,   90,   90,   90,   90,  202,  207,  230,
-       83,   90,   90,   90,   90,   90,  196,   83,  277,  208,
-      215,  234,  278,  101,  235,  231,  279,  101,  236,  216,
-      217,  101,  261,   83,  199,  262,  263,  294,  200,  101,
-      266,  202,  293,  101,  295,  101,  191,  206,  206,  206,
-      206,  206,  294,  472,  473,  822,  206,  206,  206,  206,
-
-      206,  206,  199,  294,  252,  286,  293,  295,  289,  295,
-      293,  305,  302,  306,  308,  267,  268,  269,  297,  206,
-      206,  206,  206,  206,  206,  310,  270,  312,  271,  302,
-      272,  273,  298,  274,  296,  302,  324,  308,  409,  305,
-      306,  356,  382,  367,  325,  383,  309,  409,  310,  326,
-      327,  401,  315,  415,  312,  313,  313,  313,  313,  313,
-      420,  409,  417,  418,  313,  313,  313,  313,  313,  313,
-      410,  419,  423,  491,  445,  479,  825,  415,  439,  368,
-      446,  520,  415,  420,  521,  480,  830,  313,  313,  313,
-      313,  313,  313,  369,  357,  440,  533,  358,  729,  533,
-
-      423,  426,  426,  426,  426,  426,  427,  684,  685,  730,
-      426,  426,  426,  426,  426,  426,  459,  559,  500,  505,
-      526,  460,  501,  506,  533,  527,  541,  543,  542,  645,
-      560,  492,  561,  426,  426,  426,  426,  426,  426,  569,
-      646,  641,  744,  745,  570,  751,  647,  754,  755,  792,
-      756,  752,  793,  541,  823,  542,  645,  831,  832,  826,
-      827,  824,  834,  835,  833,  836,  745,  828,  646,  461,
-      744,  829,  837,  838,  462,   45,   45,   45,   45,   45,
-      839,  840,  841,  842,   45,   45,   45,   45,   45,   45,
-      843,  844,  845,  846,  847,  848,  849,  850,  851,  852,
-
-      853,  854,  855,  856,  857,  858,  859,   45,   45,   45,
-       45,   45,   45,  860,  861,  862,  863,  864,  865,  866,
-      867,  868,  869,  848,  870,  871,  872,  873,  874,  875,
-      876,  877,  878,  879,  880,  882,  883,  884,  885,  881,
-      886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
-      896,  897,  898,  900,  901,  902,  899,  903,  904,  905,
-      906,  907,  908,  909,  910,  911,  912,  913,  914,  915,
-      916,  917,  918,  919,  920,  921,  922,  923,  924,  925,
-      926,  927,  928,  929,  930,  931,  932,  933,  934,  935,
-      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
-
-      946,  947,  948,  949,  950,  951,  952,  953,  954,  955,
-      956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
-      966,  944,  967,  968,  943,  969,  970,  971,  972,  973,
-      974,  975,  976,  977,  978,  980,  981,  982,  983,  984,
-      985,  986,  987,  988,  989,  990,  991,  992,  993,  994,
-      995,  996,  997,  999, 1000, 1001, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008,  998, 1009, 1010, 1011, 1012, 1013, 1014,
-     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024,
-     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1035, 1037,  979, 1036, 1038, 1039, 1040, 1041, 1042, 1043,
-
-     1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
-     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1035, 1062,
-     1036, 1063, 1064, 1065, 1066, 1067, 1068, 1070, 1072, 1073,
-     1074, 1069, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
-     1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102,
-     1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
-     1113, 1071, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
-     1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131,
-     1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
-
-     1142, 1143, 1144, 1122, 1145, 1146, 1147, 1148, 1149, 1123,
-     1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
-     1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
-     1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1180,
-     1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190,
-     1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200,
-     1201, 1202, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
-     1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
-     1222, 1223, 1224, 1225, 1197, 1226, 1227, 1228, 1229, 1230,
-     1231, 1179, 1233, 1234, 1235, 1236, 1237, 1238, 1232, 1239,
-
-     1240, 1241, 1242, 1243, 1244, 1203, 1245, 1246, 1247, 1248,
-     1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
-     1259, 1261, 1262, 1263, 1264, 1260, 1265, 1266, 1267, 1268,
-     1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
-     1279, 1280, 1281, 1282, 1283, 1262, 1284, 1285, 1286, 1287,
-     1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
-     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
-     1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
-     1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
-     1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337,
-
-     1339, 1340, 1341, 1314, 1342, 1343, 1344, 1345, 1346, 1347,
-     1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357,
-     1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367,
-     1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377,
-     1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
-     1388, 1389, 1390, 1391, 1392, 1365, 1393, 1338, 1394, 1395,
-     1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
-     1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415,
-     1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425,
-     1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435,
-
-     1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445,
-     1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
-     1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465,
-     1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475,
-     1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
-     1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
-     1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505,
-     1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
-     1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525,
-     1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
-
-     1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545,
-     1546,   12,   12,   12,   12,   12,   36,   36,   36,   36,
-       36,   80,  300,   80,   80,   80,   99,  412,   99,  530,
-       99,  101,  101,  101,  101,  101,  116,  116,  116,  116,
-      116,  182,  101,  182,  182,  182,  204,  204,  204,  815,
-      814,  813,  812,  811,  810,  809,  808,  807,  806,  805,
-      804,  803,  802,  801,  800,  799,  798,  797,  796,  795,
-      794,  791,  790,  789,  788,  787,  786,  785,  784,  783,
-      782,  781,  780,  779,  778,  777,  776,  775,  774,  773,
-      772,  771,  770,  769,  768,  767,  766,  765,  764,  763,
-
-      762,  761,  760,  759,  758,  757,  753,  750,  749,  748,
-      747,  746,  743,  742,  741,  740,  739,  738,  737,  736,
-      735,  734,  733,  732,  731,  728,  727,  726,  725,  724,
-      723,  722,  721,  720,  719,  718,  717,  716,  715,  714,
-      713,  712,  711,  710,  709,  708,  707,  706,  705,  704,
-      701,  700,  699,  698,  697,  696,  695,  694,  693,  692,
-      691,  690,  689,  688,  687,  686,  683,  682,  681,  680,
-      679,  678,  677,  676,  675,  674,  673,  672,  671,  670,
-      669,  668,  667,  666,  665,  664,  663,  662,  661,  660,
-      659,  658,  657,  656,  655,  654,  653,  652,  651,  650,
-
-      649,  648,  644,  643,  642,  641,  640,  639,  638,  637,
-      636,  635,  634,  633,  632,  631,  630,  629,  628,  627,
-      626,  625,  624,  623,  622,  621,  620,  619,  618,  617,
-      616,  615,  614,  613,  612,  611,  610,  609,  608,  607,
-      606,  605,  604,  603,  602,  601,  600,  599,  598,  597,
-      596,  595,  594,  593,  592,  591,  590,  589,  588,  587,
-      586,  585,  584,  583,  582,  581,  580,  579,  578,  577,
-      576,  575,  574,  573,  572,  571,  568,  567,  566,  565,
-      564,  563,  562,  558,  557,  556,  555,  554,  553,  552,
-      551,  550,  549,  548,  547,  546,  545,  544,  540,  539,
-
-      538,  537,  536,  535,  534,  532,  531,  529,  528,  525,
-      524,  523,  522,  519,  518,  517,  516,  515,  514,  513,
-      512,  511,  510,  509,  508,  507,  504,  503,  502,  499,
-      498,  497,  496,  495,  494,  493,  490,  489,  488,  487,
-      486,  485,  484,  483,  482,  481,  478,  477,  476,  475,
-      474,  471,  470,  469,  468,  467,  466,  465,  464,  463,
-      458,  457,  456,  455,  454,  453,  452,  451,  450,  449,
-      448,  447,  444,  443,  442,  441,  438,  437,  436,  435,
-      434,  433,  432,  431,  430,  429,  428,  425,  424,  422,
-      421,  416,  411,  408,  405,  404,  403,  402,  400,  399,
-
-      398,  397,  396,  395,  394,  391,  390,  389,  388,  387,
-      386,  385,  384,  381,  380,  379,  378,  377,  376,  375,
-      374,  373,  372,  371,  370,  366,  365,  364,  363,  362,
-      361,  360,  359,  355,  354,  353,  352,  351,  350,  349,
-      348,  347,  346,  345,  344,  343,  342,  341,  340,  339,
-      338,  337,  336,  335,  334,  333,  332,  331,  330,  329,
-      328,  323,  322,  321,  320,  319,  318,  317,  316,  314,
-      205,  311,  309,  307,  304,  303,  301,  299,  292,  291,
-      290,  288,  287,  285,  284,  283,  282,  281,  280,  265,
-      264,  260,  257,  256,  255,  254,  253,  251,  250,  249,
-
-      248,  245,  244,  243,  242,  241,  240,  239,  238,  237,
-      233,  232,  229,  226,  225,  224,  223,  220,  219,  218,
-      214,  213,  212,  211,  210,  209,  205,  198,  195,  194,
-      192,  190,  189,  181,  164,  145,  122,  110,  107,  106,
-      104,   43,  100,   98,   97,   88,   43, 1547,   11, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   59,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   11,  116,  116,  116,  116,  116,
+      117,  116,  116,  116,  116,  116,  116,   45,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,   45,  116,
+      116,  116,   45,  116,  116,  116,   45,  116,  116,  116,
+
+      116,  116,  116,   45,  116,  116,  116,   45,  116,   45,
+      118,  116,  116,  116,  116,  116,  116,  116,   11,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  206,  206,  206,  206,  206,  116,  116,  116,
+      116,  206,  206,  206,  206,  206,  206,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  206,  206,  206,  206,  206,
+      206,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,   11,   44,   44,   44,   45,   45,   46,   45,
+
+       45,   45,   45,  268,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   59,   45,   45,  269,
+      270,  271,   45,   45,   45,   45,   45,   45,   45,  272,
+       45,  273,   45,  274,  275,   45,  276,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   11,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      316,  316,  316,  316,  316,  116,  116,  116,  116,  316,
+      316,  316,  316,  316,  316,  116,  116,  116,  116,  116,
+
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  316,  316,  316,  316,  316,  316,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+       11,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  432,  432,  432,  432,  432,  116,
+      116,  116,  116,  432,  432,  432,  432,  432,  432,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  432,  432,  432,
+      432,  432,  432,  116,  116,  116,  116,  116,  116,  116,
+
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,   11,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,   45,   45,
+       45,   45,   45,  116,  116,  116,  116,   45,   45,   45,
+       45,   45,   45,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,   45,   45,   45,   45,   45,   45,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,   11,   81,
+       81,   11,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   11,   87,   87,   11,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   11,   99,   99,   11,
+       99,   99,   43,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       11,  222,  223,   11,  116,  116,  205,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,   11, 1593,  109,   82,   82,   82,
+       82,   82,   85,   85,   85,   85,   85,   11,  302,  302,
+
+      302,  302,  302,   11,   11,  112,  141,  302,  302,  302,
+      302,  302,  302,  109,  142,   82,  113,   83,   83,   83,
+       83,   83, 1593,   11,   82,   82,   82,   82,   82,  112,
+       84,  302,  302,  302,  302,  302,  302,  417,  417,  417,
+      417,  417,   11,  113,  143,   11,  417,  417,  417,  417,
+      417,  417,   11,  144,   84,  145,   90,   90,   90,   90,
+       90,   41,   11,   85,   85,   85,   85,   85,   91,   11,
+      417,  417,  417,  417,  417,  417,  539,  539,  539,  539,
+      539,   11,   11,  108,   11,  539,  539,  539,  539,  539,
+      539,   89,   91,   89,   12,   40,   90,   90,   90,   90,
+
+       90,   11,   85,   85,   85,   85,   85,  108,   92,  539,
+      539,  539,  539,  539,  539,   44,   44,   44,   44,   44,
+       93,  174,  175,   11,   44,   44,   44,   44,   44,   44,
+       11,  112,   89,  397,   89,   92,   44,   90,   90,   90,
+       90,   90,  113,   44,   12,  398,  124,   93,   44,   44,
+       44,   44,   44,   44,  125,  176,  126,  177,  168,  127,
+      130,  128,  169,  129,  131,  170,  104,  132,  133,  113,
+       11,  171,  172,   11,   44,  466,  178,  173,   44,  134,
+      467,   11,   44,  420,   90,   90,   90,   90,   90,   44,
+      111,  119,  157,   44,  114,   44,  191,  120,  121,  158,
+
+      122,  159,   11,   11,  147,  148,  160,  161,  149,  328,
+      154,  420,  155,  150,  156,  551,  329,  552,  179,   11,
+       92,  330,  331,  771,  772,   91,  773,  180,  468,  847,
+      848,   11,  181,  469,  774,   11,  849,   42,   11,   42,
+      850,  551,  105,  552,  108,   11,   86,   95,   11,   94,
+       42,   87,   42,  135,   11,   93,   42,  151,   42,   11,
+       11,  152,  162,  136,   11,   11,  163,  105,  108,  416,
+      185,  193,  123,  137,  200,  164,  216,  183,  138,   11,
+      153,   11,   96,  235,  217,  218,  236,  207,   11,   11,
+      237,  184,  183,   11,   40,   11,  184,  185,  208,  360,
+
+       11,  200,  183,  253,  185,  262,  279,  371,  263,  264,
+      280,  296,   11,   11,  281,  297,  184,  186,  295,  423,
+      424,  187,  297,  570,   11,  296,  295,  414,  425,   41,
+       11,  188,  111,   43,   88,  571,  296,  572,   11,  297,
+      414,   11,  104,   12,  372,  295,  300,  105,   11,  114,
+      299,  414,  361,  298,   97,  362,  111,  373,  194,  100,
+      115,  166,   12,  139,  415,  167,  193,  104,  198,  140,
+      197,  200,  105,  114,  201,  202,  228,  203,  229,   11,
+      204,  231,  247,   98,  194,  115,  248,  259,  260,  277,
+      278,  201,  203,  193,  198,  197,  232,  189,  200,  304,
+
+      201,  265,  202,  203,  204,  266,  305,  308,  311,  309,
+      411,  387,  315,  313,  388,  304,  312,  288,  291,  418,
+      421,  406,  426,  304,  429,  420,  446,  452,  419,  499,
+      305,   11,  311,  453,  308,  309,  301,  313,  315,  318,
+      479,  480,  447,  486,  494,  509,  426,  421,  542,  510,
+      514,  429,  487,  433,  515,  495,  529,  543,  535,  530,
+      580,  542,  412,  536,   11,  581,  659,  660,  654,  698,
+      699,  700,  717,  661,  761,  542,  762,  768,  746,  811,
+      844,  538,  812,  769,  853,  543,  845,  500,  553,  747,
+      854,  869,  659,  902,  660,  921,  968,  969,  903,  922,
+
+      762,  761, 1004, 1024, 1063, 1097, 1064, 1099, 1154, 1153,
+     1098, 1211,  718, 1025, 1230,  651, 1235, 1351,  869, 1266,
+     1297,  969,  968, 1294, 1375,  701, 1404, 1267, 1295, 1373,
+     1374, 1063, 1064, 1153,   11, 1154,   11,   11,   11,   11,
+       11, 1230,   11, 1351, 1297,  190,   11,   11,  239,   11,
+       11,   11, 1100, 1404,  238,  241,  286,  287,  303,  312,
+     1005, 1236,  192,  314, 1212,  317,  332,  333,  356,  366,
+      368,  383,  409,   11,   11,   11,   11,   11,   11,   11,
+      427,  430, 1376,  182,  441,  449,  455,  146,  431,  243,
+      107,  196,  224,  244,  245,  199,  103,  106,  110,  213,
+
+      215,  195,  165,  212,  219,  209,  214,  211,  221,  220,
+      225,  226,  210,  227,  230,  233,  234,  240,  242,  246,
+      249,  250,  251,  252,  254,  255,  256,  257,  258,  261,
+      267,  282,  283,  284,  285,  289,  290,  292,  293,  294,
+      306,  307,  310,  319,  320,  321,  322,  323,  324,  325,
+      326,  327,  334,  335,  336,  337,  338,  339,  340,  341,
+      342,  343,  344,  345,  346,  347,  348,  349,  350,  351,
+      352,  353,  354,  355,  357,  358,  359,  363,  364,  365,
+      367,  369,  370,  374,  375,  376,  377,  378,  379,  380,
+      381,  382,  384,  385,  386,  389,  390,  391,  392,  393,
+
+      394,  395,  396,  399,  400,  401,  402,  403,  404,  405,
+      407,  408,  410,  413,  422,  428,  434,  435,  436,  437,
+      438,  439,  440,  442,  443,  444,  445,  448,  450,  451,
+      454,  456,  457,  458,  459,  460,  461,  462,  463,  464,
+      465,  470,  471,  472,  473,  474,  475,  476,  477,  478,
+      481,  482,  483,  484,  485,  488,  489,  490,  491,  492,
+      493,  496,  497,  498,  501,  502,  503,  504,   11,   11,
+       11,   11,   11,   11,  531,  532,   11,  545,  546,  517,
+      548,  550,  554,  555,   11,   11,   11,   11,   11,   11,
+       11,   11,  603,   11,  617,  627,  585,  588,  593,  597,
+
+      620,  628,  641,  654,  650,  655,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,  508,  513,  520,  688,  505,
+      519,  521,  523,  524,  525,  526,  527,  507,  506,  528,
+      537,  516,  522,  518,  533,  534,  512,  540,  511,  541,
+      544,  547,  549,  556,  557,  558,  559,  560,  561,  562,
+      563,  564,  565,  566,  567,  568,  569,  573,  574,  575,
+      576,  577,  578,  579,  582,  583,  584,  586,  587,  589,
+      590,  591,  592,  594,  595,  596,  598,  599,  600,  601,
+      602,  604,  605,  606,  607,  608,  609,  610,  611,  612,
+      613,  614,  615,  616,  618,  619,  621,  622,  623,  624,
+
+      625,  626,  629,  630,  631,  632,  633,  634,  635,  636,
+      637,  638,  639,  640,  642,  643,  644,  645,  646,  647,
+      648,  649,  652,  653,  656,  657,  658,  662,  663,  664,
+      665,  666,  667,  668,  669,  670,  671,  672,  673,  674,
+      675,  676,  677,  678,  679,  680,  681,  682,  683,  684,
+      685,  686,  687,  689,  690,  691,  692,  693,  694,  695,
+      696,  697,  702,  703,  704,  705,  706,  707,  708,  709,
+      710,  711,  712,  713,  714,  715,  716,  719,  720,  721,
+      722,  723,  724,  725,  726,  727,  728,  729,  730,  731,
+      732,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+
+       11,  760,  739,  740,  741,  742,  744,  745,  758,  767,
+      770,  775,  777,  778,  781,  785,  790,  791,  807,  808,
+      813,  814,  818,  827,  834,  838,  839,  840,  842,  855,
+      867,  868,   11,   11,   11,   11,   11,   11,  737,  892,
+      908,  748,  734,  736,  749,  750,  751,  752,  756,  755,
+      776,  783,  754,  757,  765,  738,  733,  735,  743,  753,
+      759,  763,  764,  766,  779,  780,  782,  784,  786,  787,
+      788,  789,  792,  793,  794,  795,  796,  797,  798,  799,
+      800,  801,  802,  803,  804,  805,  806,  809,  810,  815,
+      816,  817,  819,  820,  821,  822,  823,  824,  825,  826,
+
+      828,  829,  830,  831,  832,  833,  835,  836,  837,  841,
+      843,  846,  851,  852,  856,  857,  858,  859,  860,  861,
+      862,  863,  864,  865,  866,  870,  871,  872,  873,  874,
+      875,  876,  877,  878,  879,  880,  881,  882,  883,  884,
+      885,  886,  887,  888,  889,  890,  891,  893,  894,  895,
+      896,  897,  898,  899,  900,  901,  904,  905,  906,  907,
+      909,  910,  911,  912,  913,  914,  915,  916,  917,  918,
+      919,  920,  923,  924,  925,  926,  927,  928,  929,   11,
+       11,   11,   11,   11,   11,  934,  953,  976,  988,   11,
+       11,  961,  972,  973,  997, 1012, 1030,   11,   11,   11,
+
+       11,   11,   11, 1042, 1046, 1061, 1069, 1079, 1033, 1080,
+     1096, 1082, 1109, 1114, 1120, 1121, 1122, 1123,   11,   11,
+       11,   11,   11,   11,   11, 1139,  952,  955,  940,  942,
+      954,  959,  964,  945,  935,  943,  944,  939,  931,  947,
+      946,  930,  948,  949,  933,  936,  937,  941,  950,  938,
+      932,  951,  956,  957,  958,  960,  962,  963,  965,  966,
+      967,  970,  971,  974,  975,  977,  978,  979,  980,  981,
+      982,  983,  984,  985,  986,  987,  989,  990,  991,  992,
+      993,  994,  995,  996,  998,  999, 1000, 1001, 1002, 1003,
+     1006, 1007, 1008, 1009, 1010, 1011, 1013, 1014, 1015, 1016,
+
+     1017, 1018, 1019, 1020, 1021, 1022, 1023, 1026, 1027, 1028,
+     1029, 1031, 1032, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+     1041, 1043, 1044, 1045, 1047, 1048, 1049, 1050, 1051, 1052,
+     1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1062, 1065,
+     1066, 1067, 1068, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+     1077, 1078, 1081, 1083, 1084, 1085, 1086, 1087, 1088, 1089,
+     1090, 1091, 1092, 1093, 1094, 1095, 1101, 1102, 1103, 1104,
+     1105, 1106, 1107, 1108, 1110, 1111, 1112, 1113, 1115, 1116,
+     1117, 1118, 1119, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+     1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1140, 1141,
+
+     1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+     1152, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
+     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
+     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,   11,
+       11,   11,   11,   11,   11,   11,   11, 1194, 1196, 1197,
+       11, 1191, 1207, 1201, 1215, 1218, 1220, 1221,   11,   11,
+       11,   11,   11,   11, 1223, 1225, 1231, 1247, 1259, 1260,
+     1239, 1263, 1264, 1269,   11,   11,   11,   11,   11,   11,
+     1276, 1279, 1284,   11,   11,   11,   11, 1186, 1183, 1192,
+     1292, 1187, 1205, 1296, 1298, 1190, 1204, 1188, 1193, 1200,
+
+     1208, 1209, 1199, 1210, 1184, 1185, 1189, 1195, 1198, 1202,
+     1203, 1206, 1213, 1214, 1216, 1217, 1219, 1224, 1227, 1228,
+     1232, 1233, 1234, 1226, 1229, 1222, 1237, 1238, 1240, 1241,
+     1242, 1243, 1244, 1245, 1246, 1248, 1249, 1250, 1251, 1252,
+     1253, 1254, 1255, 1256, 1257, 1258, 1261, 1262, 1265, 1268,
+     1270, 1271, 1272, 1273, 1274, 1275, 1277, 1278, 1280, 1281,
+     1282, 1283, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1293,
+     1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308,
+     1309, 1310, 1311,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11, 1320,   11, 1343, 1329, 1347, 1336,
+
+       11, 1352, 1354, 1355, 1360, 1361, 1365, 1366, 1367, 1370,
+     1378, 1379, 1381, 1387, 1392, 1393, 1395,   11,   11,   11,
+       11,   11,   11, 1402,   11,   11, 1409,   11,   11,   11,
+       11, 1417,   11, 1312, 1315, 1316, 1317, 1318, 1319, 1321,
+     1323, 1325, 1322, 1326, 1327, 1328, 1333, 1313, 1314, 1324,
+     1330, 1331, 1332, 1334, 1335, 1337, 1338, 1339, 1340, 1341,
+     1342, 1344, 1345, 1346, 1348, 1349, 1350, 1353, 1356, 1357,
+     1358, 1359, 1362, 1363, 1364, 1368, 1369, 1371, 1372, 1377,
+     1380, 1382, 1383, 1384, 1385, 1386, 1388, 1389, 1390, 1391,
+     1394, 1396, 1397, 1398, 1399, 1400, 1401, 1403, 1405, 1406,
+
+     1407, 1408, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1418,
+     1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428,
+     1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438,
+     1439, 1440, 1441, 1442,   11,   11,   11,   11,   11,   11,
+     1443, 1444, 1446, 1451, 1454, 1461, 1463, 1456, 1472,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11, 1474, 1485, 1486, 1476, 1478, 1492, 1503, 1509,
+     1511, 1513,   11,   11,   11,   11,   11,   11, 1518, 1520,
+     1526, 1529, 1532, 1514, 1533, 1470,   11, 1464,   11, 1460,
+     1455, 1459, 1445, 1462, 1449, 1450, 1468, 1448, 1452, 1447,
+
+     1453, 1457, 1458, 1466, 1465, 1469, 1471, 1467, 1473, 1475,
+     1477, 1479, 1481, 1483, 1482, 1480, 1484, 1488, 1489, 1490,
+     1487, 1491, 1494, 1493, 1495, 1496, 1498, 1499, 1500, 1497,
+     1501, 1502, 1504, 1505, 1506, 1507, 1508, 1510, 1512, 1515,
+     1516, 1517, 1519, 1521, 1522, 1523, 1524, 1525, 1527, 1528,
+     1530, 1531, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541,
+     1542,   11,   11,   11,   11,   11,   11,   11,   11, 1548,
+     1558, 1564, 1566, 1573, 1551, 1574, 1575,   11,   11,   11,
+       11,   11, 1593, 1593, 1580, 1583, 1589, 1592, 1593, 1593,
+     1584, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1570, 1593, 1545, 1547, 1544, 1554, 1549, 1557,
+     1546, 1553, 1555, 1560, 1559, 1562, 1543, 1550, 1552, 1556,
+     1563, 1565, 1561, 1567, 1568, 1569, 1571, 1572, 1576, 1577,
+     1578, 1579, 1582, 1581, 1585, 1586, 1587, 1588, 1590, 1591,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593
     } ;
 
-static const flex_int16_t yy_chk[2023] =
+static const flex_int16_t yy_chk[3247] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  600,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  109,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      600,    8,    8,    8,    1,    8,   44,   27,   28,  109,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   48,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   66,
-       10,    2,    2,   48,  130,  130,   25,   66,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      135,   57,  135,    2,    2,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,  716,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   64,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   91,   20,  161,  161,
-       55,   61,   59,   63,   22,   64,   17,   93,   59,   61,
-       55,   59,   61,   19,   63,   61,   64,   61,   65,   61,
-       20,   67,   91,   55,   63,   65,   73,   22,   45,   92,
-       73,   67,  717,   67,   45,   93,   45,   45,   55,   45,
-       73,   45,   45,   45,  301,   58,   69,   69,   45,   45,
-
-       69,   45,   58,   96,  301,   92,   69,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       62,   96,   58,  718,   62,   70,   58,   62,   62,   70,
-       58,   71,   75,  167,  167,   94,   75,  101,   58,   78,
-       62,  105,   58,   72,   58,   58,  112,   77,   77,   70,
-       71,   72,   71,   72,   71,   95,   76,   77,   72,   72,
-       76,   94,   78,   76,  150,  278,  291,   77,  150,  105,
-       76,   76,   78,  112,  101,  115,   76,   78,  278,  719,
-       77,   95,   77,   81,   81,   81,   81,   81,   82,  111,
-
-       82,   82,   82,   82,   82,   77,   81,  113,  115,   83,
-      720,   83,   77,   82,   83,   83,   83,   83,   83,   84,
-      114,   84,   84,   84,   84,   84,  103,  111,  291,   81,
-      108,  119,  721,  103,   84,  113,   82,   85,   85,   85,
-       85,   85,   89,   89,   89,   89,   89,  114,  119,  137,
-       85,   90,   90,   90,   90,   90,  108,   84,  168,  119,
-      126,  140,  168,  103,  140,  137,  168,  103,  140,  126,
-      126,  103,  163,   85,  155,  163,  163,  184,  175,  103,
-      166,  178,  183,  103,  185,  103,  103,  118,  118,  118,
-      118,  118,  187,  356,  356,  722,  118,  118,  118,  118,
-
-      118,  118,  155,  184,  155,  175,  186,  185,  178,  188,
-      183,  196,  193,  197,  199,  166,  166,  166,  187,  118,
-      118,  118,  118,  118,  118,  201,  166,  203,  166,  208,
-      166,  166,  188,  166,  186,  193,  217,  199,  293,  196,
-      197,  247,  269,  256,  217,  269,  286,  296,  201,  217,
-      217,  286,  208,  302,  203,  206,  206,  206,  206,  206,
-      305,  293,  304,  304,  206,  206,  206,  206,  206,  206,
-      296,  304,  308,  374,  333,  362,  724,  315,  327,  256,
-      333,  401,  302,  305,  401,  362,  726,  206,  206,  206,
-      206,  206,  206,  256,  247,  327,  415,  247,  629,  427,
-
-      308,  313,  313,  313,  313,  313,  315,  582,  582,  629,
-      313,  313,  313,  313,  313,  313,  346,  445,  383,  387,
-      407,  346,  383,  387,  415,  407,  425,  427,  425,  541,
-      445,  374,  445,  313,  313,  313,  313,  313,  313,  454,
-      542,  543,  645,  646,  454,  652,  543,  654,  654,  691,
-      654,  652,  691,  425,  723,  425,  541,  727,  728,  725,
-      725,  723,  730,  731,  728,  732,  646,  725,  542,  346,
-      645,  725,  733,  734,  346,  426,  426,  426,  426,  426,
-      735,  736,  737,  738,  426,  426,  426,  426,  426,  426,
-      739,  740,  741,  742,  744,  745,  746,  747,  748,  749,
-
-      750,  751,  752,  754,  755,  756,  757,  426,  426,  426,
-      426,  426,  426,  758,  759,  760,  761,  762,  763,  764,
-      765,  766,  767,  745,  768,  769,  770,  771,  772,  774,
-      775,  776,  777,  778,  779,  780,  781,  782,  783,  779,
-      784,  785,  786,  787,  790,  791,  792,  793,  796,  797,
-      798,  799,  800,  801,  802,  803,  800,  804,  805,  806,
-      808,  809,  810,  811,  812,  813,  814,  815,  816,  817,
-      818,  819,  820,  821,  822,  823,  824,  825,  826,  827,
-      828,  829,  830,  831,  832,  833,  835,  836,  837,  838,
-      839,  840,  841,  842,  843,  844,  845,  847,  848,  849,
-
-      850,  851,  852,  853,  854,  855,  856,  857,  858,  859,
-      860,  861,  862,  863,  864,  865,  866,  867,  868,  869,
-      871,  848,  872,  873,  847,  874,  875,  876,  877,  878,
-      879,  881,  882,  883,  884,  885,  887,  888,  889,  890,
-      891,  892,  893,  894,  895,  896,  897,  898,  899,  900,
-      901,  902,  903,  904,  906,  907,  908,  910,  911,  912,
-      913,  914,  915,  903,  916,  917,  918,  919,  920,  921,
-      922,  923,  924,  925,  926,  927,  929,  930,  931,  932,
-      933,  934,  935,  936,  937,  938,  939,  940,  941,  942,
-      943,  945,  884,  944,  946,  947,  948,  949,  950,  952,
-
-      953,  954,  955,  956,  957,  958,  959,  960,  961,  963,
-      964,  965,  966,  967,  968,  969,  970,  971,  943,  972,
-      944,  973,  974,  975,  976,  977,  979,  980,  981,  982,
-      983,  979,  984,  985,  986,  987,  988,  989,  990,  991,
-      992,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
-     1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,
-     1013, 1015, 1016, 1017, 1019, 1020, 1021, 1022, 1023, 1024,
-     1025,  980, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1034,
-     1035, 1036, 1037, 1038, 1039, 1040, 1042, 1043, 1044, 1045,
-     1046, 1047, 1048, 1049, 1052, 1053, 1054, 1055, 1056, 1057,
-
-     1058, 1059, 1060, 1035, 1061, 1062, 1063, 1064, 1065, 1036,
-     1066, 1069, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078,
-     1080, 1081, 1082, 1083, 1085, 1086, 1087, 1088, 1089, 1092,
-     1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102,
-     1103, 1104, 1105, 1106, 1107, 1109, 1110, 1111, 1114, 1115,
-     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1125, 1126,
-     1127, 1128, 1129, 1130, 1131, 1132, 1134, 1135, 1136, 1137,
-     1138, 1139, 1140, 1141, 1143, 1144, 1145, 1146, 1147, 1148,
-     1149, 1150, 1151, 1152, 1122, 1153, 1154, 1155, 1156, 1157,
-     1158, 1101, 1159, 1160, 1162, 1165, 1166, 1167, 1158, 1168,
-
-     1169, 1170, 1171, 1172, 1173, 1128, 1175, 1176, 1177, 1178,
-     1179, 1180, 1181, 1183, 1184, 1186, 1189, 1191, 1193, 1194,
-     1195, 1196, 1197, 1199, 1200, 1195, 1201, 1203, 1204, 1205,
-     1206, 1207, 1208, 1209, 1210, 1211, 1212, 1214, 1215, 1216,
-     1217, 1218, 1219, 1220, 1221, 1197, 1222, 1223, 1224, 1227,
-     1229, 1230, 1231, 1232, 1233, 1235, 1236, 1237, 1238, 1239,
-     1240, 1242, 1243, 1245, 1246, 1247, 1248, 1250, 1251, 1252,
-     1253, 1254, 1255, 1256, 1258, 1260, 1262, 1264, 1265, 1266,
-     1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
-     1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1284, 1285,
-
-     1286, 1287, 1288, 1262, 1289, 1290, 1291, 1292, 1293, 1294,
-     1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
-     1305, 1307, 1308, 1309, 1311, 1312, 1313, 1314, 1316, 1319,
-     1320, 1321, 1324, 1325, 1326, 1329, 1330, 1331, 1332, 1333,
-     1334, 1335, 1336, 1338, 1339, 1341, 1343, 1344, 1345, 1346,
-     1347, 1349, 1350, 1351, 1352, 1314, 1353, 1285, 1354, 1355,
-     1356, 1357, 1358, 1359, 1360, 1361, 1362, 1364, 1365, 1366,
-     1367, 1368, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1378,
-     1379, 1380, 1382, 1384, 1385, 1386, 1387, 1388, 1389, 1390,
-     1391, 1392, 1393, 1394, 1396, 1397, 1399, 1402, 1405, 1407,
-
-     1408, 1409, 1411, 1412, 1414, 1415, 1416, 1417, 1418, 1419,
-     1421, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1432,
-     1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442,
-     1445, 1446, 1447, 1448, 1449, 1451, 1452, 1453, 1454, 1455,
-     1456, 1457, 1458, 1459, 1461, 1462, 1463, 1464, 1465, 1467,
-     1469, 1471, 1472, 1473, 1474, 1476, 1478, 1479, 1480, 1481,
-     1483, 1484, 1486, 1487, 1490, 1491, 1492, 1493, 1494, 1495,
-     1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505,
-     1506, 1507, 1508, 1509, 1510, 1511, 1513, 1514, 1515, 1516,
-     1517, 1519, 1521, 1522, 1523, 1524, 1525, 1526, 1530, 1531,
-
-     1532, 1533, 1535, 1536, 1538, 1539, 1540, 1541, 1542, 1544,
-     1545, 1548, 1548, 1548, 1548, 1548, 1549, 1549, 1549, 1549,
-     1549, 1550, 1556, 1550, 1550, 1550, 1551, 1557, 1551, 1558,
-     1551, 1552, 1552, 1552, 1552, 1552, 1553, 1553, 1553, 1553,
-     1553, 1554, 1559, 1554, 1554, 1554, 1555, 1555, 1555,  715,
-      714,  713,  712,  711,  710,  709,  708,  707,  706,  705,
-      704,  703,  701,  700,  699,  698,  697,  696,  695,  694,
-      692,  690,  689,  688,  687,  686,  685,  684,  683,  682,
-      681,  680,  679,  678,  677,  676,  675,  673,  672,  671,
-      670,  669,  668,  667,  666,  665,  664,  663,  662,  661,
-
-      660,  659,  658,  657,  656,  655,  653,  651,  650,  649,
-      648,  647,  644,  643,  642,  640,  639,  637,  636,  635,
-      634,  633,  632,  631,  630,  627,  626,  625,  624,  623,
-      622,  621,  620,  619,  618,  617,  616,  615,  613,  612,
-      611,  610,  609,  608,  607,  606,  604,  603,  602,  601,
-      599,  598,  597,  596,  595,  594,  593,  591,  590,  589,
-      588,  587,  586,  585,  584,  583,  581,  580,  579,  578,
-      577,  576,  575,  574,  573,  572,  571,  570,  568,  567,
-      566,  565,  564,  563,  562,  561,  560,  559,  558,  557,
-      556,  555,  554,  553,  552,  551,  550,  549,  548,  547,
-
-      546,  545,  539,  537,  534,  533,  532,  531,  529,  528,
-      527,  525,  524,  521,  520,  519,  518,  517,  516,  515,
-      514,  513,  512,  511,  510,  509,  508,  507,  506,  505,
-      504,  503,  502,  501,  500,  499,  498,  497,  496,  495,
-      494,  492,  490,  489,  488,  487,  486,  485,  484,  483,
-      482,  481,  480,  479,  477,  476,  475,  474,  473,  472,
-      471,  470,  469,  468,  467,  466,  465,  464,  463,  462,
-      461,  460,  458,  457,  456,  455,  453,  452,  451,  450,
-      449,  447,  446,  444,  443,  441,  440,  439,  438,  437,
-      436,  435,  433,  432,  431,  430,  429,  428,  423,  422,
-
-      420,  419,  418,  417,  416,  414,  413,  411,  408,  406,
-      405,  403,  402,  400,  399,  398,  397,  396,  395,  394,
-      393,  392,  391,  390,  389,  388,  386,  385,  384,  382,
-      381,  380,  379,  377,  376,  375,  373,  372,  371,  370,
-      369,  368,  367,  366,  365,  363,  361,  360,  359,  358,
-      357,  355,  354,  353,  352,  351,  350,  349,  348,  347,
-      345,  344,  343,  342,  341,  340,  339,  338,  337,  336,
-      335,  334,  332,  331,  330,  329,  326,  325,  324,  323,
-      322,  321,  320,  319,  318,  317,  316,  312,  310,  307,
-      306,  303,  299,  292,  290,  289,  288,  287,  285,  284,
-
-      283,  282,  281,  280,  279,  277,  276,  275,  274,  273,
-      272,  271,  270,  268,  267,  266,  265,  264,  263,  262,
-      261,  260,  259,  258,  257,  255,  254,  253,  252,  251,
-      250,  249,  248,  246,  245,  244,  243,  242,  241,  240,
-      239,  237,  236,  235,  234,  233,  232,  231,  230,  229,
-      228,  227,  226,  225,  224,  223,  222,  221,  220,  219,
-      218,  216,  215,  214,  213,  212,  211,  210,  209,  207,
-      204,  202,  200,  198,  195,  194,  192,  189,  181,  180,
-      179,  177,  176,  174,  173,  172,  171,  170,  169,  165,
-      164,  162,  160,  159,  158,  157,  156,  154,  153,  152,
-
-      151,  149,  148,  147,  146,  145,  144,  143,  142,  141,
-      139,  138,  136,  134,  133,  132,  131,  129,  128,  127,
-      125,  124,  123,  122,  121,  120,  116,  110,  107,  106,
-      104,   99,   98,   79,   74,   68,   60,   53,   50,   49,
-       47,   43,   41,   39,   38,   24,   14,   11, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
-     1547, 1547
+       45,   45,   45,   45,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  167,  167,  167,  167,  167,  167,  167,  167,
+
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  432,  432,  432,   16,   16,
+       16,   12,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   87,   87,   87,   18,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   40,   40,   40,   14,
+       40,   40,   14,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      116,  131,  131,   23,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  191,   20,   53,   20,   20,   20,
+       20,   20,   19,   19,   19,   19,   19,   29,  191,  191,
+
+      191,  191,  191,   17,   30,   56,   67,  191,  191,  191,
+      191,  191,  191,   53,   67,   17,   56,   17,   17,   17,
+       17,   17,   82,  302,   82,   82,   82,   82,   82,   56,
+       17,  191,  191,  191,  191,  191,  191,  302,  302,  302,
+      302,  302,   89,   56,   68,   26,  302,  302,  302,  302,
+      302,  302,   34,   68,   17,   68,   89,   89,   89,   89,
+       89,    9,  417,   22,   22,   22,   22,   22,   26,   27,
+      302,  302,  302,  302,  302,  302,  417,  417,  417,  417,
+      417,   35,   25,   52,   28,  417,  417,  417,  417,  417,
+      417,   25,   26,   25,    9,    7,   25,   25,   25,   25,
+
+       25,  539,   85,   85,   85,   85,   85,   52,   27,  417,
+      417,  417,  417,  417,  417,  539,  539,  539,  539,  539,
+       28,   78,   78,   84,  539,  539,  539,  539,  539,  539,
+      102,   78,   84,  280,   84,   27,  102,   84,   84,   84,
+       84,   84,   78,  102,    7,  280,   62,   28,  539,  539,
+      539,  539,  539,  539,   62,   78,   62,   78,   77,   62,
+       63,   62,   77,   62,   63,   77,   60,   63,   63,   78,
+       90,   77,   77,   36,  102,  350,   78,   77,  102,   63,
+      350,   32,  102,  304,   90,   90,   90,   90,   90,  102,
+       72,   60,   73,  102,   79,  102,  102,   60,   60,   73,
+
+       60,   73,   31,  301,   70,   70,   73,   73,   70,  218,
+       72,  304,   72,   70,   72,  431,  218,  431,   79,   33,
+       32,  218,  218,  668,  668,   31,  668,   79,  350,  742,
+      742,   93,   79,  350,  668,   13,  742,   13,   21,   13,
+      742,  431,   61,  431,   65,   91,   21,   32,   37,   31,
+       37,   21,   37,   64,   42,   33,   42,   71,   42,   92,
+       94,   71,   74,   64,   95,   96,   74,   61,   65,  301,
+       93,  119,   61,   64,  156,   74,  127,   91,   65,  184,
+       71,  183,   33,  141,  127,  127,  141,  119,  185,  186,
+      141,   92,   94,  187,    8,  188,   95,   93,  119,  248,
+
+      295,  156,   91,  156,   96,  164,  169,  257,  164,  164,
+      169,  184,   24,  298,  169,  185,   92,   94,  183,  307,
+      307,   95,  188,  452,   39,  187,  186,  295,  307,   10,
+       43,   96,   55,   43,   24,  452,  184,  452,   41,  185,
+      298,   38,   48,    8,  257,  183,  188,   49,   98,   57,
+      187,  295,  248,  186,   38,  248,   55,  257,  105,   41,
+       58,   76,   10,   66,  298,   76,  104,   48,  109,   66,
+      108,  111,   49,   57,  112,  113,  136,  114,  136,  189,
+      115,  138,  151,   39,  105,   58,  151,  162,  162,  168,
+      168,  176,  179,  104,  109,  108,  138,   98,  111,  193,
+
+      112,  165,  113,  114,  115,  165,  194,  197,  200,  198,
+      293,  271,  204,  202,  271,  208,  288,  176,  179,  303,
+      305,  288,  308,  193,  311,  318,  331,  337,  303,  378,
+      194,  416,  200,  337,  197,  198,  189,  202,  204,  208,
+      360,  360,  331,  366,  374,  388,  308,  305,  420,  388,
+      392,  311,  366,  318,  392,  374,  406,  421,  412,  406,
+      461,  433,  293,  412,  538,  461,  551,  552,  553,  593,
+      593,  594,  611,  553,  659,  420,  660,  666,  642,  706,
+      740,  416,  706,  666,  745,  421,  740,  378,  433,  642,
+      745,  762,  551,  797,  552,  819,  868,  869,  797,  819,
+
+      660,  659,  906,  927,  968, 1005,  969, 1006, 1064, 1063,
+     1005, 1132,  611,  927, 1153,  538, 1159, 1297,  762, 1191,
+     1230,  869,  868, 1228, 1321,  594, 1351, 1191, 1228, 1320,
+     1320,  968,  969, 1063,   46, 1064,   86,   88,   97,  100,
+      101, 1153,  190, 1297, 1230,   99,  205,  239,  143,  296,
+      297,  299, 1006, 1351,  142,  145,  174,  175,  192,  201,
+      906, 1159,  103,  203, 1132,  207,  219,  220,  244,  252,
+      254,  267,  291,  300,  312,  314,  317,  332,  368,  383,
+      309,  313, 1321,   80,  326,  334,  339,   69,  315,  147,
+       51,  107,  132,  148,  149,  110,   47,   50,   54,  124,
+
+      126,  106,   75,  123,  128,  120,  125,  122,  130,  129,
+      133,  134,  121,  135,  137,  139,  140,  144,  146,  150,
+      152,  153,  154,  155,  157,  158,  159,  160,  161,  163,
+      166,  170,  171,  172,  173,  177,  178,  180,  181,  182,
+      195,  196,  199,  209,  210,  211,  212,  213,  214,  215,
+      216,  217,  221,  222,  223,  224,  225,  226,  227,  228,
+      229,  230,  231,  232,  233,  234,  235,  236,  237,  238,
+      240,  241,  242,  243,  245,  246,  247,  249,  250,  251,
+      253,  255,  256,  258,  259,  260,  261,  262,  263,  264,
+      265,  266,  268,  269,  270,  272,  273,  274,  275,  276,
+
+      277,  278,  279,  281,  282,  283,  284,  285,  286,  287,
+      289,  290,  292,  294,  306,  310,  319,  320,  321,  322,
+      323,  324,  325,  327,  328,  329,  330,  333,  335,  336,
+      338,  340,  341,  342,  343,  344,  345,  346,  347,  348,
+      349,  351,  352,  353,  354,  355,  356,  357,  358,  359,
+      361,  362,  363,  364,  365,  367,  369,  370,  371,  372,
+      373,  375,  376,  377,  379,  380,  381,  382,  409,  414,
+      415,  427,  430,  441,  407,  408,  449,  423,  424,  394,
+      426,  429,  434,  435,  455,  466,  485,  499,  501,  531,
+      532,  535,  484,  545,  500,  511,  465,  469,  474,  478,
+
+      504,  512,  525,  542,  537,  543,  546,  548,  550,  554,
+      555,  580,  603,  617,  627,  387,  391,  397,  583,  384,
+      396,  398,  400,  401,  402,  403,  404,  386,  385,  405,
+      413,  393,  399,  395,  410,  411,  390,  418,  389,  419,
+      422,  425,  428,  436,  437,  438,  439,  440,  442,  443,
+      444,  445,  446,  447,  448,  450,  451,  453,  454,  456,
+      457,  458,  459,  460,  462,  463,  464,  467,  468,  470,
+      471,  472,  473,  475,  476,  477,  479,  480,  481,  482,
+      483,  486,  487,  488,  489,  490,  491,  492,  493,  494,
+      495,  496,  497,  498,  502,  503,  505,  506,  507,  508,
+
+      509,  510,  513,  514,  515,  516,  517,  518,  519,  520,
+      521,  522,  523,  524,  526,  527,  528,  529,  530,  533,
+      534,  536,  540,  541,  544,  547,  549,  556,  557,  558,
+      559,  560,  561,  562,  563,  564,  565,  566,  567,  568,
+      569,  570,  571,  572,  573,  574,  575,  576,  577,  578,
+      579,  581,  582,  584,  585,  586,  587,  588,  589,  590,
+      591,  592,  595,  596,  597,  598,  599,  600,  601,  602,
+      604,  605,  606,  607,  608,  609,  610,  612,  613,  614,
+      615,  616,  618,  619,  620,  621,  622,  623,  624,  625,
+      626,  641,  651,  654,  655,  688,  708,  717,  746,  760,
+
+      770,  658,  634,  635,  636,  637,  639,  640,  656,  665,
+      667,  669,  671,  672,  675,  679,  684,  685,  702,  703,
+      707,  709,  713,  723,  730,  734,  735,  736,  738,  747,
+      759,  761,  791,  807,  808,  813,  814,  827,  632,  786,
+      802,  643,  629,  631,  644,  645,  646,  647,  652,  650,
+      670,  677,  649,  653,  663,  633,  628,  630,  638,  648,
+      657,  661,  662,  664,  673,  674,  676,  678,  680,  681,
+      682,  683,  686,  687,  689,  690,  691,  692,  693,  694,
+      695,  696,  697,  698,  699,  700,  701,  704,  705,  710,
+      711,  712,  714,  715,  716,  718,  719,  720,  721,  722,
+
+      724,  725,  726,  727,  728,  729,  731,  732,  733,  737,
+      739,  741,  743,  744,  748,  749,  750,  751,  752,  753,
+      754,  755,  756,  757,  758,  763,  764,  765,  766,  767,
+      768,  769,  771,  772,  773,  774,  775,  776,  777,  778,
+      779,  780,  781,  782,  783,  784,  785,  787,  788,  789,
+      790,  792,  793,  794,  795,  796,  798,  799,  800,  801,
+      803,  804,  805,  806,  809,  810,  811,  812,  815,  816,
+      817,  818,  820,  821,  822,  823,  824,  825,  826,  855,
+      867,  892,  902,  908,  926,  832,  851,  876,  888,  929,
+      934,  860,  872,  873,  898,  914,  933,  953,  976,  988,
+
+     1004, 1030, 1042,  946,  950,  966,  974,  985,  937,  986,
+     1003,  989, 1015, 1020, 1026, 1027, 1028, 1029, 1046, 1061,
+     1069, 1079, 1080, 1096, 1097, 1048,  850,  853,  838,  840,
+      852,  858,  863,  843,  833,  841,  842,  837,  829,  845,
+      844,  828,  846,  847,  831,  834,  835,  839,  848,  836,
+      830,  849,  854,  856,  857,  859,  861,  862,  864,  865,
+      866,  870,  871,  874,  875,  877,  878,  879,  880,  881,
+      882,  883,  884,  885,  886,  887,  889,  890,  891,  893,
+      894,  895,  896,  897,  899,  900,  901,  903,  904,  905,
+      907,  909,  910,  911,  912,  913,  915,  916,  917,  918,
+
+      919,  920,  921,  922,  923,  924,  925,  928,  930,  931,
+      932,  935,  936,  938,  939,  940,  941,  942,  943,  944,
+      945,  947,  948,  949,  951,  952,  954,  955,  956,  957,
+      958,  959,  960,  961,  962,  963,  964,  965,  967,  970,
+      971,  972,  973,  975,  977,  978,  979,  980,  981,  982,
+      983,  984,  987,  990,  991,  992,  993,  994,  995,  996,
+      997,  998,  999, 1000, 1001, 1002, 1007, 1008, 1009, 1010,
+     1011, 1012, 1013, 1014, 1016, 1017, 1018, 1019, 1021, 1022,
+     1023, 1024, 1025, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
+     1038, 1039, 1040, 1041, 1043, 1044, 1045, 1047, 1049, 1050,
+
+     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+     1062, 1065, 1066, 1067, 1068, 1070, 1071, 1072, 1073, 1074,
+     1075, 1076, 1077, 1078, 1081, 1082, 1083, 1084, 1085, 1086,
+     1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1099,
+     1109, 1114, 1120, 1121, 1123, 1139, 1143, 1111, 1113, 1115,
+     1144, 1107, 1128, 1119, 1135, 1138, 1141, 1142, 1155, 1165,
+     1174, 1194, 1196, 1197, 1146, 1148, 1154, 1171, 1184, 1185,
+     1162, 1188, 1189, 1193, 1207, 1215, 1218, 1220, 1221, 1223,
+     1203, 1206, 1212, 1225, 1231, 1235, 1247, 1102, 1098, 1108,
+     1226, 1103, 1126, 1229, 1232, 1106, 1125, 1104, 1110, 1118,
+
+     1129, 1130, 1117, 1131, 1100, 1101, 1105, 1112, 1116, 1122,
+     1124, 1127, 1133, 1134, 1136, 1137, 1140, 1147, 1150, 1151,
+     1156, 1157, 1158, 1149, 1152, 1145, 1160, 1161, 1163, 1164,
+     1166, 1167, 1168, 1169, 1170, 1172, 1173, 1175, 1176, 1177,
+     1178, 1179, 1180, 1181, 1182, 1183, 1186, 1187, 1190, 1192,
+     1195, 1198, 1199, 1200, 1201, 1202, 1204, 1205, 1208, 1209,
+     1210, 1211, 1213, 1214, 1216, 1217, 1219, 1222, 1224, 1227,
+     1233, 1234, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
+     1244, 1245, 1246, 1259, 1260, 1263, 1269, 1276, 1279, 1284,
+     1292, 1294, 1296, 1298, 1256, 1343, 1286, 1268, 1290, 1277,
+
+     1347, 1299, 1301, 1302, 1307, 1308, 1312, 1313, 1314, 1317,
+     1323, 1324, 1326, 1332, 1337, 1338, 1340, 1352, 1354, 1355,
+     1360, 1361, 1365, 1349, 1366, 1375, 1359, 1378, 1379, 1381,
+     1387, 1371, 1402, 1248, 1251, 1252, 1253, 1254, 1255, 1257,
+     1261, 1264, 1258, 1265, 1266, 1267, 1273, 1249, 1250, 1262,
+     1270, 1271, 1272, 1274, 1275, 1278, 1280, 1281, 1282, 1283,
+     1285, 1287, 1288, 1289, 1291, 1293, 1295, 1300, 1303, 1304,
+     1305, 1306, 1309, 1310, 1311, 1315, 1316, 1318, 1319, 1322,
+     1325, 1327, 1328, 1329, 1330, 1331, 1333, 1334, 1335, 1336,
+     1339, 1341, 1342, 1344, 1345, 1346, 1348, 1350, 1353, 1356,
+
+     1357, 1358, 1362, 1363, 1364, 1367, 1368, 1369, 1370, 1372,
+     1373, 1374, 1376, 1377, 1380, 1382, 1383, 1384, 1385, 1386,
+     1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+     1398, 1399, 1400, 1401, 1409, 1417, 1421, 1423, 1435, 1438,
+     1403, 1404, 1406, 1412, 1415, 1425, 1427, 1418, 1437, 1440,
+     1441, 1443, 1444, 1446, 1451, 1454, 1461, 1463, 1472, 1485,
+     1486, 1492, 1442, 1458, 1459, 1447, 1449, 1467, 1479, 1487,
+     1489, 1491, 1503, 1509, 1511, 1513, 1518, 1520, 1497, 1499,
+     1506, 1510, 1515, 1493, 1516, 1434, 1526, 1428, 1529, 1424,
+     1416, 1422, 1405, 1426, 1410, 1411, 1432, 1408, 1413, 1407,
+
+     1414, 1419, 1420, 1430, 1429, 1433, 1436, 1431, 1439, 1445,
+     1448, 1450, 1453, 1456, 1455, 1452, 1457, 1462, 1464, 1465,
+     1460, 1466, 1469, 1468, 1470, 1471, 1474, 1475, 1476, 1473,
+     1477, 1478, 1480, 1481, 1482, 1483, 1484, 1488, 1490, 1494,
+     1495, 1496, 1498, 1500, 1501, 1502, 1504, 1505, 1507, 1508,
+     1512, 1514, 1517, 1519, 1521, 1522, 1523, 1524, 1525, 1527,
+     1528, 1532, 1533, 1548, 1558, 1564, 1566, 1573, 1574, 1537,
+     1547, 1554, 1556, 1565, 1540, 1567, 1568, 1575, 1580, 1583,
+     1589, 1592,    0,    0, 1576, 1579, 1587, 1591,    0,    0,
+     1581,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1561,    0, 1534, 1536, 1531, 1543, 1538, 1546,
+     1535, 1542, 1544, 1550, 1549, 1552, 1530, 1539, 1541, 1545,
+     1553, 1555, 1551, 1557, 1559, 1560, 1562, 1563, 1569, 1570,
+     1571, 1572, 1578, 1577, 1582, 1584, 1585, 1586, 1588, 1590,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593,
+     1593, 1593, 1593, 1593, 1593, 1593
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1728,27 +2009,28 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[181] =
+static const flex_int16_t yy_rule_linenum[187] =
     {   0,
       147,  149,  151,  156,  157,  162,  163,  164,  176,  179,
       184,  191,  200,  209,  218,  227,  236,  245,  255,  264,
       273,  282,  291,  300,  309,  318,  327,  336,  345,  354,
       363,  375,  384,  393,  402,  411,  422,  433,  444,  455,
-      465,  475,  486,  497,  508,  519,  530,  541,  552,  563,
-      574,  585,  596,  607,  618,  627,  636,  646,  655,  665,
-      679,  695,  704,  713,  722,  731,  752,  773,  782,  792,
-      801,  812,  821,  830,  839,  848,  857,  867,  876,  887,
-      898,  910,  919,  928,  937,  946,  955,  964,  973,  982,
-      991, 1001, 1012, 1024, 1033, 1042, 1052, 1062, 1072, 1082,
-
-     1092, 1102, 1111, 1121, 1130, 1139, 1148, 1157, 1167, 1177,
-     1186, 1196, 1205, 1214, 1223, 1232, 1241, 1250, 1259, 1268,
-     1277, 1286, 1295, 1304, 1313, 1322, 1331, 1340, 1349, 1358,
-     1367, 1376, 1385, 1394, 1403, 1412, 1421, 1430, 1439, 1448,
-     1457, 1466, 1476, 1486, 1496, 1506, 1516, 1526, 1536, 1546,
-     1556, 1565, 1574, 1583, 1592, 1601, 1610, 1619, 1630, 1641,
-     1654, 1667, 1682, 1781, 1786, 1791, 1796, 1797, 1798, 1799,
-     1800, 1801, 1803, 1821, 1834, 1839, 1843, 1845, 1847, 1849
+      465,  475,  485,  496,  507,  518,  529,  540,  551,  562,
+      573,  584,  595,  606,  617,  628,  637,  646,  656,  665,
+      675,  689,  705,  714,  723,  732,  741,  762,  783,  792,
+      802,  811,  822,  831,  840,  849,  858,  867,  877,  886,
+      897,  908,  920,  929,  938,  947,  956,  965,  974,  983,
+      992, 1001, 1010, 1019, 1028, 1038, 1049, 1061, 1070, 1079,
+
+     1089, 1099, 1109, 1119, 1129, 1139, 1148, 1158, 1167, 1176,
+     1185, 1194, 1204, 1214, 1223, 1233, 1242, 1251, 1260, 1269,
+     1278, 1287, 1296, 1305, 1314, 1323, 1332, 1341, 1350, 1359,
+     1368, 1377, 1386, 1395, 1404, 1413, 1422, 1431, 1440, 1449,
+     1458, 1467, 1476, 1485, 1494, 1503, 1512, 1522, 1532, 1542,
+     1552, 1562, 1572, 1582, 1592, 1602, 1612, 1621, 1630, 1639,
+     1648, 1657, 1666, 1675, 1686, 1697, 1710, 1723, 1738, 1837,
+     1842, 1847, 1852, 1853, 1854, 1855, 1856, 1857, 1859, 1877,
+     1890, 1895, 1899, 1901, 1903, 1905
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1801,7 +2083,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1804 "dhcp4_lexer.cc"
+#line 2086 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1827,8 +2109,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1830 "dhcp4_lexer.cc"
-#line 1831 "dhcp4_lexer.cc"
+#line 2112 "dhcp4_lexer.cc"
+#line 2113 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2158,7 +2440,7 @@ YY_DECL
     }
 
 
-#line 2161 "dhcp4_lexer.cc"
+#line 2443 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2187,13 +2469,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1548 )
+				if ( yy_current_state >= 1594 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1547 );
+		while ( yy_current_state != 1593 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2212,13 +2494,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 181 )
+			else if ( yy_act < 187 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 181 )
+			else if ( yy_act == 187 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 182 )
+			else if ( yy_act == 188 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2699,6 +2981,19 @@ YY_RULE_SETUP
 case 42:
 YY_RULE_SETUP
 #line 475 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_IN_PROCESS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-in-process", driver.loc_);
+    }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 485 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2710,9 +3005,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 486 "dhcp4_lexer.ll"
+#line 496 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2724,9 +3019,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 497 "dhcp4_lexer.ll"
+#line 507 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2738,9 +3033,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 508 "dhcp4_lexer.ll"
+#line 518 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2752,9 +3047,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 519 "dhcp4_lexer.ll"
+#line 529 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2766,9 +3061,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 530 "dhcp4_lexer.ll"
+#line 540 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2780,9 +3075,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 541 "dhcp4_lexer.ll"
+#line 551 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2794,9 +3089,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 552 "dhcp4_lexer.ll"
+#line 562 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2808,9 +3103,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 563 "dhcp4_lexer.ll"
+#line 573 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2822,9 +3117,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 52:
 YY_RULE_SETUP
-#line 574 "dhcp4_lexer.ll"
+#line 584 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2836,9 +3131,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 53:
 YY_RULE_SETUP
-#line 585 "dhcp4_lexer.ll"
+#line 595 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2850,9 +3145,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 54:
 YY_RULE_SETUP
-#line 596 "dhcp4_lexer.ll"
+#line 606 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2864,9 +3159,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 55:
 YY_RULE_SETUP
-#line 607 "dhcp4_lexer.ll"
+#line 617 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2878,9 +3173,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 56:
 YY_RULE_SETUP
-#line 618 "dhcp4_lexer.ll"
+#line 628 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2890,9 +3185,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 627 "dhcp4_lexer.ll"
+#line 637 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2902,9 +3197,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 58:
 YY_RULE_SETUP
-#line 636 "dhcp4_lexer.ll"
+#line 646 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2915,9 +3210,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 59:
 YY_RULE_SETUP
-#line 646 "dhcp4_lexer.ll"
+#line 656 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2927,9 +3222,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 60:
 YY_RULE_SETUP
-#line 655 "dhcp4_lexer.ll"
+#line 665 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2940,9 +3235,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 61:
 YY_RULE_SETUP
-#line 665 "dhcp4_lexer.ll"
+#line 675 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2957,9 +3252,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 62:
 YY_RULE_SETUP
-#line 679 "dhcp4_lexer.ll"
+#line 689 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2976,9 +3271,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 63:
 YY_RULE_SETUP
-#line 695 "dhcp4_lexer.ll"
+#line 705 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2988,9 +3283,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 64:
 YY_RULE_SETUP
-#line 704 "dhcp4_lexer.ll"
+#line 714 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3000,9 +3295,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 65:
 YY_RULE_SETUP
-#line 713 "dhcp4_lexer.ll"
+#line 723 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3012,9 +3307,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 66:
 YY_RULE_SETUP
-#line 722 "dhcp4_lexer.ll"
+#line 732 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -3024,9 +3319,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 67:
 YY_RULE_SETUP
-#line 731 "dhcp4_lexer.ll"
+#line 741 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3048,9 +3343,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 68:
 YY_RULE_SETUP
-#line 752 "dhcp4_lexer.ll"
+#line 762 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3072,9 +3367,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 69:
 YY_RULE_SETUP
-#line 773 "dhcp4_lexer.ll"
+#line 783 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3084,9 +3379,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 70:
 YY_RULE_SETUP
-#line 782 "dhcp4_lexer.ll"
+#line 792 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3097,9 +3392,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 71:
 YY_RULE_SETUP
-#line 792 "dhcp4_lexer.ll"
+#line 802 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3109,9 +3404,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 72:
 YY_RULE_SETUP
-#line 801 "dhcp4_lexer.ll"
+#line 811 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3123,9 +3418,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 73:
 YY_RULE_SETUP
-#line 812 "dhcp4_lexer.ll"
+#line 822 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3135,9 +3430,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 74:
 YY_RULE_SETUP
-#line 821 "dhcp4_lexer.ll"
+#line 831 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3147,9 +3442,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 75:
 YY_RULE_SETUP
-#line 830 "dhcp4_lexer.ll"
+#line 840 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3159,9 +3454,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 76:
 YY_RULE_SETUP
-#line 839 "dhcp4_lexer.ll"
+#line 849 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3171,9 +3466,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 77:
 YY_RULE_SETUP
-#line 848 "dhcp4_lexer.ll"
+#line 858 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3183,9 +3478,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 78:
 YY_RULE_SETUP
-#line 857 "dhcp4_lexer.ll"
+#line 867 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3196,9 +3491,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 79:
 YY_RULE_SETUP
-#line 867 "dhcp4_lexer.ll"
+#line 877 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3208,9 +3503,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 80:
 YY_RULE_SETUP
-#line 876 "dhcp4_lexer.ll"
+#line 886 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3222,9 +3517,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 81:
 YY_RULE_SETUP
-#line 887 "dhcp4_lexer.ll"
+#line 897 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3236,9 +3531,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 82:
 YY_RULE_SETUP
-#line 898 "dhcp4_lexer.ll"
+#line 908 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3250,9 +3545,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 83:
 YY_RULE_SETUP
-#line 910 "dhcp4_lexer.ll"
+#line 920 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3262,9 +3557,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 84:
 YY_RULE_SETUP
-#line 919 "dhcp4_lexer.ll"
+#line 929 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -3274,9 +3569,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 85:
 YY_RULE_SETUP
-#line 928 "dhcp4_lexer.ll"
+#line 938 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3286,9 +3581,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 86:
 YY_RULE_SETUP
-#line 937 "dhcp4_lexer.ll"
+#line 947 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3298,9 +3593,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 87:
 YY_RULE_SETUP
-#line 946 "dhcp4_lexer.ll"
+#line 956 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3310,9 +3605,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 88:
 YY_RULE_SETUP
-#line 955 "dhcp4_lexer.ll"
+#line 965 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3322,9 +3617,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 89:
 YY_RULE_SETUP
-#line 964 "dhcp4_lexer.ll"
+#line 974 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3334,9 +3629,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 90:
 YY_RULE_SETUP
-#line 973 "dhcp4_lexer.ll"
+#line 983 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3346,9 +3641,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 91:
+YY_RULE_SETUP
+#line 992 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 92:
 YY_RULE_SETUP
-#line 982 "dhcp4_lexer.ll"
+#line 1001 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 93:
+YY_RULE_SETUP
+#line 1010 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 94:
+YY_RULE_SETUP
+#line 1019 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3358,9 +3689,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 95:
 YY_RULE_SETUP
-#line 991 "dhcp4_lexer.ll"
+#line 1028 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3371,9 +3702,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 96:
 YY_RULE_SETUP
-#line 1001 "dhcp4_lexer.ll"
+#line 1038 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3385,9 +3716,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 97:
 YY_RULE_SETUP
-#line 1012 "dhcp4_lexer.ll"
+#line 1049 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3400,9 +3731,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 98:
 YY_RULE_SETUP
-#line 1024 "dhcp4_lexer.ll"
+#line 1061 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3412,9 +3743,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 99:
 YY_RULE_SETUP
-#line 1033 "dhcp4_lexer.ll"
+#line 1070 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3424,9 +3755,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 100:
 YY_RULE_SETUP
-#line 1042 "dhcp4_lexer.ll"
+#line 1079 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3437,9 +3768,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 101:
 YY_RULE_SETUP
-#line 1052 "dhcp4_lexer.ll"
+#line 1089 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3450,9 +3781,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 102:
 YY_RULE_SETUP
-#line 1062 "dhcp4_lexer.ll"
+#line 1099 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3463,9 +3794,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 103:
 YY_RULE_SETUP
-#line 1072 "dhcp4_lexer.ll"
+#line 1109 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3476,9 +3807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 104:
 YY_RULE_SETUP
-#line 1082 "dhcp4_lexer.ll"
+#line 1119 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3489,9 +3820,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 105:
 YY_RULE_SETUP
-#line 1092 "dhcp4_lexer.ll"
+#line 1129 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3502,9 +3833,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 106:
 YY_RULE_SETUP
-#line 1102 "dhcp4_lexer.ll"
+#line 1139 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3514,9 +3845,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 107:
 YY_RULE_SETUP
-#line 1111 "dhcp4_lexer.ll"
+#line 1148 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3527,9 +3858,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 108:
 YY_RULE_SETUP
-#line 1121 "dhcp4_lexer.ll"
+#line 1158 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3539,9 +3870,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 109:
 YY_RULE_SETUP
-#line 1130 "dhcp4_lexer.ll"
+#line 1167 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3551,9 +3882,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 110:
 YY_RULE_SETUP
-#line 1139 "dhcp4_lexer.ll"
+#line 1176 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3563,9 +3894,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 111:
 YY_RULE_SETUP
-#line 1148 "dhcp4_lexer.ll"
+#line 1185 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3575,9 +3906,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 112:
 YY_RULE_SETUP
-#line 1157 "dhcp4_lexer.ll"
+#line 1194 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3588,9 +3919,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 113:
 YY_RULE_SETUP
-#line 1167 "dhcp4_lexer.ll"
+#line 1204 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3601,9 +3932,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 114:
 YY_RULE_SETUP
-#line 1177 "dhcp4_lexer.ll"
+#line 1214 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3613,9 +3944,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 115:
 YY_RULE_SETUP
-#line 1186 "dhcp4_lexer.ll"
+#line 1223 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3625,9 +3956,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 116:
 YY_RULE_SETUP
-#line 1196 "dhcp4_lexer.ll"
+#line 1233 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3637,9 +3968,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 117:
 YY_RULE_SETUP
-#line 1205 "dhcp4_lexer.ll"
+#line 1242 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3649,9 +3980,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 118:
 YY_RULE_SETUP
-#line 1214 "dhcp4_lexer.ll"
+#line 1251 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3661,9 +3992,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 119:
 YY_RULE_SETUP
-#line 1223 "dhcp4_lexer.ll"
+#line 1260 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3673,9 +4004,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 120:
 YY_RULE_SETUP
-#line 1232 "dhcp4_lexer.ll"
+#line 1269 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3685,9 +4016,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 121:
 YY_RULE_SETUP
-#line 1241 "dhcp4_lexer.ll"
+#line 1278 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3697,9 +4028,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 122:
 YY_RULE_SETUP
-#line 1250 "dhcp4_lexer.ll"
+#line 1287 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3709,9 +4040,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 123:
 YY_RULE_SETUP
-#line 1259 "dhcp4_lexer.ll"
+#line 1296 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3721,9 +4052,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 124:
 YY_RULE_SETUP
-#line 1268 "dhcp4_lexer.ll"
+#line 1305 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3733,9 +4064,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 125:
 YY_RULE_SETUP
-#line 1277 "dhcp4_lexer.ll"
+#line 1314 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3745,9 +4076,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 126:
 YY_RULE_SETUP
-#line 1286 "dhcp4_lexer.ll"
+#line 1323 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3757,9 +4088,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 127:
 YY_RULE_SETUP
-#line 1295 "dhcp4_lexer.ll"
+#line 1332 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3769,9 +4100,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 128:
 YY_RULE_SETUP
-#line 1304 "dhcp4_lexer.ll"
+#line 1341 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3781,9 +4112,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 129:
+YY_RULE_SETUP
+#line 1350 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::CONTROL_SOCKET:
+        return isc::dhcp::Dhcp4Parser::make_CONFIG_OUTPUT_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("config-output-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 130:
 YY_RULE_SETUP
-#line 1313 "dhcp4_lexer.ll"
+#line 1359 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3793,9 +4136,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 131:
 YY_RULE_SETUP
-#line 1322 "dhcp4_lexer.ll"
+#line 1368 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3805,9 +4148,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 132:
 YY_RULE_SETUP
-#line 1331 "dhcp4_lexer.ll"
+#line 1377 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3817,9 +4160,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 133:
 YY_RULE_SETUP
-#line 1340 "dhcp4_lexer.ll"
+#line 1386 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3829,9 +4172,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 134:
 YY_RULE_SETUP
-#line 1349 "dhcp4_lexer.ll"
+#line 1395 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3841,9 +4184,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 135:
 YY_RULE_SETUP
-#line 1358 "dhcp4_lexer.ll"
+#line 1404 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3853,9 +4196,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 136:
 YY_RULE_SETUP
-#line 1367 "dhcp4_lexer.ll"
+#line 1413 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3865,9 +4208,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 137:
 YY_RULE_SETUP
-#line 1376 "dhcp4_lexer.ll"
+#line 1422 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3877,9 +4220,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 138:
 YY_RULE_SETUP
-#line 1385 "dhcp4_lexer.ll"
+#line 1431 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3889,9 +4232,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 139:
 YY_RULE_SETUP
-#line 1394 "dhcp4_lexer.ll"
+#line 1440 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3901,9 +4244,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 140:
 YY_RULE_SETUP
-#line 1403 "dhcp4_lexer.ll"
+#line 1449 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3913,9 +4256,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 141:
 YY_RULE_SETUP
-#line 1412 "dhcp4_lexer.ll"
+#line 1458 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3925,9 +4268,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 142:
 YY_RULE_SETUP
-#line 1421 "dhcp4_lexer.ll"
+#line 1467 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3937,9 +4280,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 143:
 YY_RULE_SETUP
-#line 1430 "dhcp4_lexer.ll"
+#line 1476 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3949,9 +4292,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 144:
 YY_RULE_SETUP
-#line 1439 "dhcp4_lexer.ll"
+#line 1485 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3961,9 +4304,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 145:
 YY_RULE_SETUP
-#line 1448 "dhcp4_lexer.ll"
+#line 1494 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3973,9 +4316,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 146:
 YY_RULE_SETUP
-#line 1457 "dhcp4_lexer.ll"
+#line 1503 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3985,9 +4328,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 147:
 YY_RULE_SETUP
-#line 1466 "dhcp4_lexer.ll"
+#line 1512 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3998,9 +4341,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 143:
+case 148:
 YY_RULE_SETUP
-#line 1476 "dhcp4_lexer.ll"
+#line 1522 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4011,9 +4354,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 144:
+case 149:
 YY_RULE_SETUP
-#line 1486 "dhcp4_lexer.ll"
+#line 1532 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -4024,9 +4367,22 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 145:
+case 150:
+YY_RULE_SETUP
+#line 1542 "dhcp4_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp4Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 151:
 YY_RULE_SETUP
-#line 1496 "dhcp4_lexer.ll"
+#line 1552 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4037,9 +4393,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 146:
+case 152:
 YY_RULE_SETUP
-#line 1506 "dhcp4_lexer.ll"
+#line 1562 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4050,9 +4406,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 147:
+case 153:
 YY_RULE_SETUP
-#line 1516 "dhcp4_lexer.ll"
+#line 1572 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4063,9 +4419,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 148:
+case 154:
 YY_RULE_SETUP
-#line 1526 "dhcp4_lexer.ll"
+#line 1582 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4076,9 +4432,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 149:
+case 155:
 YY_RULE_SETUP
-#line 1536 "dhcp4_lexer.ll"
+#line 1592 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4089,9 +4445,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 150:
+case 156:
 YY_RULE_SETUP
-#line 1546 "dhcp4_lexer.ll"
+#line 1602 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4102,9 +4458,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 151:
+case 157:
 YY_RULE_SETUP
-#line 1556 "dhcp4_lexer.ll"
+#line 1612 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4114,9 +4470,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 158:
 YY_RULE_SETUP
-#line 1565 "dhcp4_lexer.ll"
+#line 1621 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4126,9 +4482,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 159:
 YY_RULE_SETUP
-#line 1574 "dhcp4_lexer.ll"
+#line 1630 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4138,9 +4494,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 160:
 YY_RULE_SETUP
-#line 1583 "dhcp4_lexer.ll"
+#line 1639 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4150,9 +4506,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 161:
 YY_RULE_SETUP
-#line 1592 "dhcp4_lexer.ll"
+#line 1648 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4162,9 +4518,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 162:
 YY_RULE_SETUP
-#line 1601 "dhcp4_lexer.ll"
+#line 1657 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4174,9 +4530,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 163:
 YY_RULE_SETUP
-#line 1610 "dhcp4_lexer.ll"
+#line 1666 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4186,9 +4542,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 164:
 YY_RULE_SETUP
-#line 1619 "dhcp4_lexer.ll"
+#line 1675 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4200,9 +4556,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 165:
 YY_RULE_SETUP
-#line 1630 "dhcp4_lexer.ll"
+#line 1686 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4214,9 +4570,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 166:
 YY_RULE_SETUP
-#line 1641 "dhcp4_lexer.ll"
+#line 1697 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4230,9 +4586,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 167:
 YY_RULE_SETUP
-#line 1654 "dhcp4_lexer.ll"
+#line 1710 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4246,9 +4602,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 168:
 YY_RULE_SETUP
-#line 1667 "dhcp4_lexer.ll"
+#line 1723 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4262,9 +4618,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 169:
 YY_RULE_SETUP
-#line 1682 "dhcp4_lexer.ll"
+#line 1738 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4364,65 +4720,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 164:
-/* rule 164 can match eol */
+case 170:
+/* rule 170 can match eol */
 YY_RULE_SETUP
-#line 1781 "dhcp4_lexer.ll"
+#line 1837 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 165:
-/* rule 165 can match eol */
+case 171:
+/* rule 171 can match eol */
 YY_RULE_SETUP
-#line 1786 "dhcp4_lexer.ll"
+#line 1842 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 166:
+case 172:
 YY_RULE_SETUP
-#line 1791 "dhcp4_lexer.ll"
+#line 1847 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 167:
+case 173:
 YY_RULE_SETUP
-#line 1796 "dhcp4_lexer.ll"
+#line 1852 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 168:
+case 174:
 YY_RULE_SETUP
-#line 1797 "dhcp4_lexer.ll"
+#line 1853 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 169:
+case 175:
 YY_RULE_SETUP
-#line 1798 "dhcp4_lexer.ll"
+#line 1854 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 170:
+case 176:
 YY_RULE_SETUP
-#line 1799 "dhcp4_lexer.ll"
+#line 1855 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 171:
+case 177:
 YY_RULE_SETUP
-#line 1800 "dhcp4_lexer.ll"
+#line 1856 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 172:
+case 178:
 YY_RULE_SETUP
-#line 1801 "dhcp4_lexer.ll"
+#line 1857 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 173:
+case 179:
 YY_RULE_SETUP
-#line 1803 "dhcp4_lexer.ll"
+#line 1859 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4441,9 +4797,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 174:
+case 180:
 YY_RULE_SETUP
-#line 1821 "dhcp4_lexer.ll"
+#line 1877 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4457,43 +4813,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 175:
+case 181:
 YY_RULE_SETUP
-#line 1834 "dhcp4_lexer.ll"
+#line 1890 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 176:
+case 182:
 YY_RULE_SETUP
-#line 1839 "dhcp4_lexer.ll"
+#line 1895 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 177:
+case 183:
 YY_RULE_SETUP
-#line 1843 "dhcp4_lexer.ll"
+#line 1899 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 178:
+case 184:
 YY_RULE_SETUP
-#line 1845 "dhcp4_lexer.ll"
+#line 1901 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 179:
+case 185:
 YY_RULE_SETUP
-#line 1847 "dhcp4_lexer.ll"
+#line 1903 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 180:
+case 186:
 YY_RULE_SETUP
-#line 1849 "dhcp4_lexer.ll"
+#line 1905 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1851 "dhcp4_lexer.ll"
+#line 1907 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4517,12 +4873,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 181:
+case 187:
 YY_RULE_SETUP
-#line 1874 "dhcp4_lexer.ll"
+#line 1930 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4525 "dhcp4_lexer.cc"
+#line 4881 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4841,7 +5197,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1548 )
+			if ( yy_current_state >= 1594 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4874,11 +5230,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1548 )
+		if ( yy_current_state >= 1594 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1547);
+	yy_is_jam = (yy_current_state == 1593);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5627,8 +5983,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1874 "dhcp4_lexer.ll"
-
+#line 1930 "dhcp4_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -5730,4 +6085,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.3.2.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 34 "dhcp4_parser.yy" // lalr1.cc:435
+#line 34 "dhcp4_parser.yy"
 
 #include <dhcp4/parser_context.h>
 
-#line 51 "dhcp4_parser.cc" // lalr1.cc:435
+#line 52 "dhcp4_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER4_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER4_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,57 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:510
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 146 "dhcp4_parser.cc" // lalr1.cc:510
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp4Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp4_parser.cc"
 
   /// Build a parser object.
   Dhcp4Parser::Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg)
-    :
 #if PARSER4_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -201,9 +160,9 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -233,13 +192,13 @@ namespace isc { namespace dhcp {
     : state (s)
   {}
 
-  Dhcp4Parser::symbol_number_type
-  Dhcp4Parser::by_state::type_get () const YY_NOEXCEPT
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   Dhcp4Parser::stack_symbol_type::stack_symbol_type ()
@@ -248,32 +207,33 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -290,32 +250,33 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -324,40 +285,83 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  Dhcp4Parser::stack_symbol_type&
+  Dhcp4Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   Dhcp4Parser::stack_symbol_type&
   Dhcp4Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -383,99 +387,103 @@ namespace isc { namespace dhcp {
 #if PARSER4_DEBUG
   template <typename Base>
   void
-  Dhcp4Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp4Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 171: // "constant string"
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 407 "dhcp4_parser.cc" // lalr1.cc:676
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 408 "dhcp4_parser.cc"
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 414 "dhcp4_parser.cc"
         break;
 
-      case 172: // "integer"
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 413 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 420 "dhcp4_parser.cc"
         break;
 
-      case 173: // "floating point"
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < double > (); }
-#line 419 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 426 "dhcp4_parser.cc"
         break;
 
-      case 174: // "boolean"
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 425 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_value: // value
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 432 "dhcp4_parser.cc"
         break;
 
-      case 191: // value
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 431 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_map_value: // map_value
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 438 "dhcp4_parser.cc"
         break;
 
-      case 195: // map_value
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 437 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_socket_type: // socket_type
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 444 "dhcp4_parser.cc"
         break;
 
-      case 239: // socket_type
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 443 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 450 "dhcp4_parser.cc"
         break;
 
-      case 242: // outbound_interface_value
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 449 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_db_type: // db_type
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 456 "dhcp4_parser.cc"
         break;
 
-      case 264: // db_type
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 455 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_hr_mode: // hr_mode
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 462 "dhcp4_parser.cc"
         break;
 
-      case 350: // hr_mode
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 461 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 468 "dhcp4_parser.cc"
         break;
 
-      case 499: // ncr_protocol_value
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 467 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 474 "dhcp4_parser.cc"
         break;
 
-      case 506: // replace_client_name_value
-#line 253 "dhcp4_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 473 "dhcp4_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 260 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 480 "dhcp4_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -499,7 +507,7 @@ namespace isc { namespace dhcp {
   }
 
   void
-  Dhcp4Parser::yypop_ (int n)
+  Dhcp4Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -534,21 +542,21 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::state_type
   Dhcp4Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue)
+  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue)
+  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -562,7 +570,6 @@ namespace isc { namespace dhcp {
   int
   Dhcp4Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -598,7 +605,8 @@ namespace isc { namespace dhcp {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -612,14 +620,14 @@ namespace isc { namespace dhcp {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -638,11 +646,23 @@ namespace isc { namespace dhcp {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -659,7 +679,7 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -667,7 +687,7 @@ namespace isc { namespace dhcp {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -686,30 +706,31 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -733,282 +754,282 @@ namespace isc { namespace dhcp {
         {
           switch (yyn)
             {
-  case 2:
-#line 262 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 740 "dhcp4_parser.cc" // lalr1.cc:919
+  case 2: // $@1: %empty
+#line 269 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 761 "dhcp4_parser.cc"
     break;
 
-  case 4:
-#line 263 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 746 "dhcp4_parser.cc" // lalr1.cc:919
+  case 4: // $@2: %empty
+#line 270 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 767 "dhcp4_parser.cc"
     break;
 
-  case 6:
-#line 264 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 752 "dhcp4_parser.cc" // lalr1.cc:919
+  case 6: // $@3: %empty
+#line 271 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP4; }
+#line 773 "dhcp4_parser.cc"
     break;
 
-  case 8:
-#line 265 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 758 "dhcp4_parser.cc" // lalr1.cc:919
+  case 8: // $@4: %empty
+#line 272 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 779 "dhcp4_parser.cc"
     break;
 
-  case 10:
-#line 266 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.SUBNET4; }
-#line 764 "dhcp4_parser.cc" // lalr1.cc:919
+  case 10: // $@5: %empty
+#line 273 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET4; }
+#line 785 "dhcp4_parser.cc"
     break;
 
-  case 12:
-#line 267 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.POOLS; }
-#line 770 "dhcp4_parser.cc" // lalr1.cc:919
+  case 12: // $@6: %empty
+#line 274 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 791 "dhcp4_parser.cc"
     break;
 
-  case 14:
-#line 268 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 776 "dhcp4_parser.cc" // lalr1.cc:919
+  case 14: // $@7: %empty
+#line 275 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 797 "dhcp4_parser.cc"
     break;
 
-  case 16:
-#line 269 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 782 "dhcp4_parser.cc" // lalr1.cc:919
+  case 16: // $@8: %empty
+#line 276 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.DHCP4; }
+#line 803 "dhcp4_parser.cc"
     break;
 
-  case 18:
-#line 270 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 788 "dhcp4_parser.cc" // lalr1.cc:919
+  case 18: // $@9: %empty
+#line 277 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 809 "dhcp4_parser.cc"
     break;
 
-  case 20:
-#line 271 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 794 "dhcp4_parser.cc" // lalr1.cc:919
+  case 20: // $@10: %empty
+#line 278 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 815 "dhcp4_parser.cc"
     break;
 
-  case 22:
-#line 272 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 800 "dhcp4_parser.cc" // lalr1.cc:919
+  case 22: // $@11: %empty
+#line 279 "dhcp4_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 821 "dhcp4_parser.cc"
     break;
 
-  case 24:
-#line 273 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 806 "dhcp4_parser.cc" // lalr1.cc:919
+  case 24: // $@12: %empty
+#line 280 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 827 "dhcp4_parser.cc"
     break;
 
-  case 26:
-#line 274 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.LOGGING; }
-#line 812 "dhcp4_parser.cc" // lalr1.cc:919
+  case 26: // $@13: %empty
+#line 281 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.LOGGING; }
+#line 833 "dhcp4_parser.cc"
     break;
 
-  case 28:
-#line 275 "dhcp4_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.CONFIG_CONTROL; }
-#line 818 "dhcp4_parser.cc" // lalr1.cc:919
+  case 28: // $@14: %empty
+#line 282 "dhcp4_parser.yy"
+                          { ctx.ctx_ = ctx.CONFIG_CONTROL; }
+#line 839 "dhcp4_parser.cc"
     break;
 
-  case 30:
-#line 283 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 824 "dhcp4_parser.cc" // lalr1.cc:919
+  case 30: // value: "integer"
+#line 290 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 845 "dhcp4_parser.cc"
     break;
 
-  case 31:
-#line 284 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 830 "dhcp4_parser.cc" // lalr1.cc:919
+  case 31: // value: "floating point"
+#line 291 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 851 "dhcp4_parser.cc"
     break;
 
-  case 32:
-#line 285 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 836 "dhcp4_parser.cc" // lalr1.cc:919
+  case 32: // value: "boolean"
+#line 292 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 857 "dhcp4_parser.cc"
     break;
 
-  case 33:
-#line 286 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 842 "dhcp4_parser.cc" // lalr1.cc:919
+  case 33: // value: "constant string"
+#line 293 "dhcp4_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 863 "dhcp4_parser.cc"
     break;
 
-  case 34:
-#line 287 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 848 "dhcp4_parser.cc" // lalr1.cc:919
+  case 34: // value: "null"
+#line 294 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 869 "dhcp4_parser.cc"
     break;
 
-  case 35:
-#line 288 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 854 "dhcp4_parser.cc" // lalr1.cc:919
+  case 35: // value: map2
+#line 295 "dhcp4_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 875 "dhcp4_parser.cc"
     break;
 
-  case 36:
-#line 289 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 860 "dhcp4_parser.cc" // lalr1.cc:919
+  case 36: // value: list_generic
+#line 296 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 881 "dhcp4_parser.cc"
     break;
 
-  case 37:
-#line 292 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 37: // sub_json: value
+#line 299 "dhcp4_parser.yy"
+                {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 869 "dhcp4_parser.cc" // lalr1.cc:919
+#line 890 "dhcp4_parser.cc"
     break;
 
-  case 38:
-#line 297 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 38: // $@15: %empty
+#line 304 "dhcp4_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 880 "dhcp4_parser.cc" // lalr1.cc:919
+#line 901 "dhcp4_parser.cc"
     break;
 
-  case 39:
-#line 302 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 39: // map2: "{" $@15 map_content "}"
+#line 309 "dhcp4_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 890 "dhcp4_parser.cc" // lalr1.cc:919
+#line 911 "dhcp4_parser.cc"
     break;
 
-  case 40:
-#line 308 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 896 "dhcp4_parser.cc" // lalr1.cc:919
+  case 40: // map_value: map2
+#line 315 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 917 "dhcp4_parser.cc"
     break;
 
-  case 43:
-#line 315 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 43: // not_empty_map: "constant string" ":" value
+#line 322 "dhcp4_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 905 "dhcp4_parser.cc" // lalr1.cc:919
+#line 926 "dhcp4_parser.cc"
     break;
 
-  case 44:
-#line 319 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 44: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 326 "dhcp4_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 915 "dhcp4_parser.cc" // lalr1.cc:919
+#line 936 "dhcp4_parser.cc"
     break;
 
-  case 45:
-#line 326 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 45: // $@16: %empty
+#line 333 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 924 "dhcp4_parser.cc" // lalr1.cc:919
+#line 945 "dhcp4_parser.cc"
     break;
 
-  case 46:
-#line 329 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 46: // list_generic: "[" $@16 list_content "]"
+#line 336 "dhcp4_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 932 "dhcp4_parser.cc" // lalr1.cc:919
+#line 953 "dhcp4_parser.cc"
     break;
 
-  case 49:
-#line 337 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 49: // not_empty_list: value
+#line 344 "dhcp4_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 941 "dhcp4_parser.cc" // lalr1.cc:919
+#line 962 "dhcp4_parser.cc"
     break;
 
-  case 50:
-#line 341 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 50: // not_empty_list: not_empty_list "," value
+#line 348 "dhcp4_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 950 "dhcp4_parser.cc" // lalr1.cc:919
+#line 971 "dhcp4_parser.cc"
     break;
 
-  case 51:
-#line 348 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 51: // $@17: %empty
+#line 355 "dhcp4_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 958 "dhcp4_parser.cc" // lalr1.cc:919
+#line 979 "dhcp4_parser.cc"
     break;
 
-  case 52:
-#line 350 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 52: // list_strings: "[" $@17 list_strings_content "]"
+#line 357 "dhcp4_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 967 "dhcp4_parser.cc" // lalr1.cc:919
+#line 988 "dhcp4_parser.cc"
     break;
 
-  case 55:
-#line 359 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 55: // not_empty_list_strings: "constant string"
+#line 366 "dhcp4_parser.yy"
+                               {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 976 "dhcp4_parser.cc" // lalr1.cc:919
+#line 997 "dhcp4_parser.cc"
     break;
 
-  case 56:
-#line 363 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 56: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 370 "dhcp4_parser.yy"
+                                                            {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 985 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1006 "dhcp4_parser.cc"
     break;
 
-  case 57:
-#line 374 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 57: // unknown_map_entry: "constant string" ":"
+#line 381 "dhcp4_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 996 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1017 "dhcp4_parser.cc"
     break;
 
-  case 58:
-#line 384 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 58: // $@18: %empty
+#line 391 "dhcp4_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1007 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1028 "dhcp4_parser.cc"
     break;
 
-  case 59:
-#line 389 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 59: // syntax_map: "{" $@18 global_objects "}"
+#line 396 "dhcp4_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
@@ -1016,12 +1037,12 @@ namespace isc { namespace dhcp {
     // Dhcp4 is required
     ctx.require("Dhcp4", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 1020 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1041 "dhcp4_parser.cc"
     break;
 
-  case 68:
-#line 413 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 68: // $@19: %empty
+#line 420 "dhcp4_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1029,330 +1050,330 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP4);
 }
-#line 1033 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1054 "dhcp4_parser.cc"
     break;
 
-  case 69:
-#line 420 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 69: // dhcp4_object: "Dhcp4" $@19 ":" "{" global_params "}"
+#line 427 "dhcp4_parser.yy"
+                                                    {
     // No global parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1043 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1064 "dhcp4_parser.cc"
     break;
 
-  case 70:
-#line 428 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 70: // $@20: %empty
+#line 435 "dhcp4_parser.yy"
+                          {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1053 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1074 "dhcp4_parser.cc"
     break;
 
-  case 71:
-#line 432 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 71: // sub_dhcp4: "{" $@20 global_params "}"
+#line 439 "dhcp4_parser.yy"
+                               {
     // No global parameter is required
     // parsing completed
 }
-#line 1062 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1083 "dhcp4_parser.cc"
     break;
 
-  case 111:
-#line 482 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 111: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 489 "dhcp4_parser.yy"
+                                             {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 1071 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1092 "dhcp4_parser.cc"
     break;
 
-  case 112:
-#line 487 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 112: // renew_timer: "renew-timer" ":" "integer"
+#line 494 "dhcp4_parser.yy"
+                                       {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1080 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1101 "dhcp4_parser.cc"
     break;
 
-  case 113:
-#line 492 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 113: // rebind_timer: "rebind-timer" ":" "integer"
+#line 499 "dhcp4_parser.yy"
+                                         {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1089 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1110 "dhcp4_parser.cc"
     break;
 
-  case 114:
-#line 497 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 114: // calculate_tee_times: "calculate-tee-times" ":" "boolean"
+#line 504 "dhcp4_parser.yy"
+                                                       {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
 }
-#line 1098 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1119 "dhcp4_parser.cc"
     break;
 
-  case 115:
-#line 502 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 115: // t1_percent: "t1-percent" ":" "floating point"
+#line 509 "dhcp4_parser.yy"
+                                   {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
 }
-#line 1107 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1128 "dhcp4_parser.cc"
     break;
 
-  case 116:
-#line 507 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 116: // t2_percent: "t2-percent" ":" "floating point"
+#line 514 "dhcp4_parser.yy"
+                                   {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
 }
-#line 1116 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1137 "dhcp4_parser.cc"
     break;
 
-  case 117:
-#line 512 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 117: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 519 "dhcp4_parser.yy"
+                                                                 {
     ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1125 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1146 "dhcp4_parser.cc"
     break;
 
-  case 118:
-#line 517 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 118: // $@21: %empty
+#line 524 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1133 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1154 "dhcp4_parser.cc"
     break;
 
-  case 119:
-#line 519 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 119: // server_tag: "server-tag" $@21 ":" "constant string"
+#line 526 "dhcp4_parser.yy"
+               {
     ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1143 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1164 "dhcp4_parser.cc"
     break;
 
-  case 120:
-#line 525 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 120: // echo_client_id: "echo-client-id" ":" "boolean"
+#line 532 "dhcp4_parser.yy"
+                                             {
     ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
 }
-#line 1152 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1173 "dhcp4_parser.cc"
     break;
 
-  case 121:
-#line 530 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 121: // match_client_id: "match-client-id" ":" "boolean"
+#line 537 "dhcp4_parser.yy"
+                                               {
     ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
 }
-#line 1161 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1182 "dhcp4_parser.cc"
     break;
 
-  case 122:
-#line 535 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 122: // authoritative: "authoritative" ":" "boolean"
+#line 542 "dhcp4_parser.yy"
+                                           {
     ElementPtr prf(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("authoritative", prf);
 }
-#line 1170 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1191 "dhcp4_parser.cc"
     break;
 
-  case 123:
-#line 541 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 123: // $@22: %empty
+#line 548 "dhcp4_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1181 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1202 "dhcp4_parser.cc"
     break;
 
-  case 124:
-#line 546 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 124: // interfaces_config: "interfaces-config" $@22 ":" "{" interfaces_config_params "}"
+#line 553 "dhcp4_parser.yy"
+                                                               {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1191 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1212 "dhcp4_parser.cc"
     break;
 
-  case 134:
-#line 565 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 134: // $@23: %empty
+#line 572 "dhcp4_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1201 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1222 "dhcp4_parser.cc"
     break;
 
-  case 135:
-#line 569 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 135: // sub_interfaces4: "{" $@23 interfaces_config_params "}"
+#line 576 "dhcp4_parser.yy"
+                                          {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1210 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1231 "dhcp4_parser.cc"
     break;
 
-  case 136:
-#line 574 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 136: // $@24: %empty
+#line 581 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1221 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1242 "dhcp4_parser.cc"
     break;
 
-  case 137:
-#line 579 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 137: // interfaces_list: "interfaces" $@24 ":" list_strings
+#line 586 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1230 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1251 "dhcp4_parser.cc"
     break;
 
-  case 138:
-#line 584 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 138: // $@25: %empty
+#line 591 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1238 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1259 "dhcp4_parser.cc"
     break;
 
-  case 139:
-#line 586 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 139: // dhcp_socket_type: "dhcp-socket-type" $@25 ":" socket_type
+#line 593 "dhcp4_parser.yy"
+                    {
     ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1247 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1268 "dhcp4_parser.cc"
     break;
 
-  case 140:
-#line 591 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1253 "dhcp4_parser.cc" // lalr1.cc:919
+  case 140: // socket_type: "raw"
+#line 598 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
+#line 1274 "dhcp4_parser.cc"
     break;
 
-  case 141:
-#line 592 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1259 "dhcp4_parser.cc" // lalr1.cc:919
+  case 141: // socket_type: "udp"
+#line 599 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
+#line 1280 "dhcp4_parser.cc"
     break;
 
-  case 142:
-#line 595 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 142: // $@26: %empty
+#line 602 "dhcp4_parser.yy"
+                                       {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
-#line 1267 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1288 "dhcp4_parser.cc"
     break;
 
-  case 143:
-#line 597 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 143: // outbound_interface: "outbound-interface" $@26 ":" outbound_interface_value
+#line 604 "dhcp4_parser.yy"
+                                 {
     ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1276 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1297 "dhcp4_parser.cc"
     break;
 
-  case 144:
-#line 602 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 144: // outbound_interface_value: "same-as-inbound"
+#line 609 "dhcp4_parser.yy"
+                                          {
     yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
-#line 1284 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1305 "dhcp4_parser.cc"
     break;
 
-  case 145:
-#line 604 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 145: // outbound_interface_value: "use-routing"
+#line 611 "dhcp4_parser.yy"
+                {
     yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
-#line 1292 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1313 "dhcp4_parser.cc"
     break;
 
-  case 146:
-#line 608 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 146: // re_detect: "re-detect" ":" "boolean"
+#line 615 "dhcp4_parser.yy"
+                                   {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1301 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1322 "dhcp4_parser.cc"
     break;
 
-  case 147:
-#line 614 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 147: // $@27: %empty
+#line 621 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1312 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1333 "dhcp4_parser.cc"
     break;
 
-  case 148:
-#line 619 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 148: // lease_database: "lease-database" $@27 ":" "{" database_map_params "}"
+#line 626 "dhcp4_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1323 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1344 "dhcp4_parser.cc"
     break;
 
-  case 149:
-#line 626 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 149: // $@28: %empty
+#line 633 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1334 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1355 "dhcp4_parser.cc"
     break;
 
-  case 150:
-#line 631 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 150: // sanity_checks: "sanity-checks" $@28 ":" "{" sanity_checks_params "}"
+#line 638 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1343 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1364 "dhcp4_parser.cc"
     break;
 
-  case 154:
-#line 641 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 154: // $@29: %empty
+#line 648 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1351 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1372 "dhcp4_parser.cc"
     break;
 
-  case 155:
-#line 643 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 155: // lease_checks: "lease-checks" $@29 ":" "constant string"
+#line 650 "dhcp4_parser.yy"
+               {
 
     if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
          (string(yystack_[0].value.as < std::string > ()) == "warn") ||
@@ -1367,614 +1388,623 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1371 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1392 "dhcp4_parser.cc"
     break;
 
-  case 156:
-#line 659 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 156: // $@30: %empty
+#line 666 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1382 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1403 "dhcp4_parser.cc"
     break;
 
-  case 157:
-#line 664 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 157: // hosts_database: "hosts-database" $@30 ":" "{" database_map_params "}"
+#line 671 "dhcp4_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1393 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1414 "dhcp4_parser.cc"
     break;
 
-  case 158:
-#line 671 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 158: // $@31: %empty
+#line 678 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1404 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1425 "dhcp4_parser.cc"
     break;
 
-  case 159:
-#line 676 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 159: // hosts_databases: "hosts-databases" $@31 ":" "[" database_list "]"
+#line 683 "dhcp4_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1413 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1434 "dhcp4_parser.cc"
     break;
 
-  case 164:
-#line 689 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 164: // $@32: %empty
+#line 696 "dhcp4_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1423 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1444 "dhcp4_parser.cc"
     break;
 
-  case 165:
-#line 693 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 165: // database: "{" $@32 database_map_params "}"
+#line 700 "dhcp4_parser.yy"
+                                     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1433 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1454 "dhcp4_parser.cc"
     break;
 
-  case 188:
-#line 725 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 189: // $@33: %empty
+#line 733 "dhcp4_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1441 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1462 "dhcp4_parser.cc"
     break;
 
-  case 189:
-#line 727 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 190: // database_type: "type" $@33 ":" db_type
+#line 735 "dhcp4_parser.yy"
+                {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1450 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1471 "dhcp4_parser.cc"
     break;
 
-  case 190:
-#line 732 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1456 "dhcp4_parser.cc" // lalr1.cc:919
+  case 191: // db_type: "memfile"
+#line 740 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1477 "dhcp4_parser.cc"
     break;
 
-  case 191:
-#line 733 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1462 "dhcp4_parser.cc" // lalr1.cc:919
+  case 192: // db_type: "mysql"
+#line 741 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1483 "dhcp4_parser.cc"
     break;
 
-  case 192:
-#line 734 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1468 "dhcp4_parser.cc" // lalr1.cc:919
+  case 193: // db_type: "postgresql"
+#line 742 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1489 "dhcp4_parser.cc"
     break;
 
-  case 193:
-#line 735 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1474 "dhcp4_parser.cc" // lalr1.cc:919
+  case 194: // db_type: "cql"
+#line 743 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1495 "dhcp4_parser.cc"
     break;
 
-  case 194:
-#line 738 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 195: // $@34: %empty
+#line 746 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1482 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1503 "dhcp4_parser.cc"
     break;
 
-  case 195:
-#line 740 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 196: // user: "user" $@34 ":" "constant string"
+#line 748 "dhcp4_parser.yy"
+               {
     ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1492 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1513 "dhcp4_parser.cc"
     break;
 
-  case 196:
-#line 746 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 197: // $@35: %empty
+#line 754 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1500 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1521 "dhcp4_parser.cc"
     break;
 
-  case 197:
-#line 748 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 198: // password: "password" $@35 ":" "constant string"
+#line 756 "dhcp4_parser.yy"
+               {
     ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1510 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1531 "dhcp4_parser.cc"
     break;
 
-  case 198:
-#line 754 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 199: // $@36: %empty
+#line 762 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1518 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1539 "dhcp4_parser.cc"
     break;
 
-  case 199:
-#line 756 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 200: // host: "host" $@36 ":" "constant string"
+#line 764 "dhcp4_parser.yy"
+               {
     ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1528 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1549 "dhcp4_parser.cc"
     break;
 
-  case 200:
-#line 762 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 201: // port: "port" ":" "integer"
+#line 770 "dhcp4_parser.yy"
+                         {
     ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1537 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1558 "dhcp4_parser.cc"
     break;
 
-  case 201:
-#line 767 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 202: // $@37: %empty
+#line 775 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1545 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1566 "dhcp4_parser.cc"
     break;
 
-  case 202:
-#line 769 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 203: // name: "name" $@37 ":" "constant string"
+#line 777 "dhcp4_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1555 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1576 "dhcp4_parser.cc"
     break;
 
-  case 203:
-#line 775 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 204: // persist: "persist" ":" "boolean"
+#line 783 "dhcp4_parser.yy"
+                               {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1564 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1585 "dhcp4_parser.cc"
     break;
 
-  case 204:
-#line 780 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 205: // lfc_interval: "lfc-interval" ":" "integer"
+#line 788 "dhcp4_parser.yy"
+                                         {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1573 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1594 "dhcp4_parser.cc"
     break;
 
-  case 205:
-#line 785 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 206: // lfc_in_process: "lfc-in-process" ":" "boolean"
+#line 793 "dhcp4_parser.yy"
+                                             {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-in-process", n);
+}
+#line 1603 "dhcp4_parser.cc"
+    break;
+
+  case 207: // readonly: "readonly" ":" "boolean"
+#line 798 "dhcp4_parser.yy"
+                                 {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1582 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1612 "dhcp4_parser.cc"
     break;
 
-  case 206:
-#line 790 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 208: // connect_timeout: "connect-timeout" ":" "integer"
+#line 803 "dhcp4_parser.yy"
+                                               {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1591 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1621 "dhcp4_parser.cc"
     break;
 
-  case 207:
-#line 795 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 209: // request_timeout: "request-timeout" ":" "integer"
+#line 808 "dhcp4_parser.yy"
+                                               {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1600 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1630 "dhcp4_parser.cc"
     break;
 
-  case 208:
-#line 800 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 210: // tcp_keepalive: "tcp-keepalive" ":" "integer"
+#line 813 "dhcp4_parser.yy"
+                                           {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1609 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1639 "dhcp4_parser.cc"
     break;
 
-  case 209:
-#line 805 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 211: // tcp_nodelay: "tcp-nodelay" ":" "boolean"
+#line 818 "dhcp4_parser.yy"
+                                       {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1618 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1648 "dhcp4_parser.cc"
     break;
 
-  case 210:
-#line 810 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 212: // $@38: %empty
+#line 823 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1626 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1656 "dhcp4_parser.cc"
     break;
 
-  case 211:
-#line 812 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 213: // contact_points: "contact-points" $@38 ":" "constant string"
+#line 825 "dhcp4_parser.yy"
+               {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1636 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1666 "dhcp4_parser.cc"
     break;
 
-  case 212:
-#line 818 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 214: // $@39: %empty
+#line 831 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1644 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1674 "dhcp4_parser.cc"
     break;
 
-  case 213:
-#line 820 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 215: // keyspace: "keyspace" $@39 ":" "constant string"
+#line 833 "dhcp4_parser.yy"
+               {
     ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1654 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1684 "dhcp4_parser.cc"
     break;
 
-  case 214:
-#line 826 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 216: // $@40: %empty
+#line 839 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1662 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1692 "dhcp4_parser.cc"
     break;
 
-  case 215:
-#line 828 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 217: // consistency: "consistency" $@40 ":" "constant string"
+#line 841 "dhcp4_parser.yy"
+               {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1672 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1702 "dhcp4_parser.cc"
     break;
 
-  case 216:
-#line 834 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 218: // $@41: %empty
+#line 847 "dhcp4_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1680 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1710 "dhcp4_parser.cc"
     break;
 
-  case 217:
-#line 836 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 219: // serial_consistency: "serial-consistency" $@41 ":" "constant string"
+#line 849 "dhcp4_parser.yy"
+               {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1690 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1720 "dhcp4_parser.cc"
     break;
 
-  case 218:
-#line 842 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 220: // max_reconnect_tries: "max-reconnect-tries" ":" "integer"
+#line 855 "dhcp4_parser.yy"
+                                                       {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1699 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1729 "dhcp4_parser.cc"
     break;
 
-  case 219:
-#line 847 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 221: // reconnect_wait_time: "reconnect-wait-time" ":" "integer"
+#line 860 "dhcp4_parser.yy"
+                                                       {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1708 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1738 "dhcp4_parser.cc"
     break;
 
-  case 220:
-#line 852 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 222: // $@42: %empty
+#line 865 "dhcp4_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1719 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1749 "dhcp4_parser.cc"
     break;
 
-  case 221:
-#line 857 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 223: // host_reservation_identifiers: "host-reservation-identifiers" $@42 ":" "[" host_reservation_identifiers_list "]"
+#line 870 "dhcp4_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1728 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1758 "dhcp4_parser.cc"
     break;
 
-  case 229:
-#line 873 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 231: // duid_id: "duid"
+#line 886 "dhcp4_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1737 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1767 "dhcp4_parser.cc"
     break;
 
-  case 230:
-#line 878 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 232: // hw_address_id: "hw-address"
+#line 891 "dhcp4_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1746 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1776 "dhcp4_parser.cc"
     break;
 
-  case 231:
-#line 883 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 233: // circuit_id: "circuit-id"
+#line 896 "dhcp4_parser.yy"
+                        {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1755 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1785 "dhcp4_parser.cc"
     break;
 
-  case 232:
-#line 888 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 234: // client_id: "client-id"
+#line 901 "dhcp4_parser.yy"
+                      {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1764 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1794 "dhcp4_parser.cc"
     break;
 
-  case 233:
-#line 893 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 235: // flex_id: "flex-id"
+#line 906 "dhcp4_parser.yy"
+                 {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1773 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1803 "dhcp4_parser.cc"
     break;
 
-  case 234:
-#line 898 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 236: // $@43: %empty
+#line 911 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1784 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1814 "dhcp4_parser.cc"
     break;
 
-  case 235:
-#line 903 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 237: // hooks_libraries: "hooks-libraries" $@43 ":" "[" hooks_libraries_list "]"
+#line 916 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1793 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1823 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 916 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 242: // $@44: %empty
+#line 929 "dhcp4_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1803 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1833 "dhcp4_parser.cc"
     break;
 
-  case 241:
-#line 920 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 243: // hooks_library: "{" $@44 hooks_params "}"
+#line 933 "dhcp4_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1813 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1843 "dhcp4_parser.cc"
     break;
 
-  case 242:
-#line 926 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 244: // $@45: %empty
+#line 939 "dhcp4_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1823 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1853 "dhcp4_parser.cc"
     break;
 
-  case 243:
-#line 930 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 245: // sub_hooks_library: "{" $@45 hooks_params "}"
+#line 943 "dhcp4_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1833 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1863 "dhcp4_parser.cc"
     break;
 
-  case 249:
-#line 945 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 251: // $@46: %empty
+#line 958 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1841 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1871 "dhcp4_parser.cc"
     break;
 
-  case 250:
-#line 947 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 252: // library: "library" $@46 ":" "constant string"
+#line 960 "dhcp4_parser.yy"
+               {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1851 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1881 "dhcp4_parser.cc"
     break;
 
-  case 251:
-#line 953 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 253: // $@47: %empty
+#line 966 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1859 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1889 "dhcp4_parser.cc"
     break;
 
-  case 252:
-#line 955 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 254: // parameters: "parameters" $@47 ":" value
+#line 968 "dhcp4_parser.yy"
+              {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1868 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1898 "dhcp4_parser.cc"
     break;
 
-  case 253:
-#line 961 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 255: // $@48: %empty
+#line 974 "dhcp4_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1879 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1909 "dhcp4_parser.cc"
     break;
 
-  case 254:
-#line 966 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 256: // expired_leases_processing: "expired-leases-processing" $@48 ":" "{" expired_leases_params "}"
+#line 979 "dhcp4_parser.yy"
+                                                            {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1889 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1919 "dhcp4_parser.cc"
     break;
 
-  case 263:
-#line 984 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 265: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 997 "dhcp4_parser.yy"
+                                                               {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1898 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1928 "dhcp4_parser.cc"
     break;
 
-  case 264:
-#line 989 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 266: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 1002 "dhcp4_parser.yy"
+                                                                               {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1907 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1937 "dhcp4_parser.cc"
     break;
 
-  case 265:
-#line 994 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 267: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 1007 "dhcp4_parser.yy"
+                                                       {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1916 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1946 "dhcp4_parser.cc"
     break;
 
-  case 266:
-#line 999 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 268: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 1012 "dhcp4_parser.yy"
+                                                     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1925 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1955 "dhcp4_parser.cc"
     break;
 
-  case 267:
-#line 1004 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 269: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 1017 "dhcp4_parser.yy"
+                                                 {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1934 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1964 "dhcp4_parser.cc"
     break;
 
-  case 268:
-#line 1009 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 270: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 1022 "dhcp4_parser.yy"
+                                                               {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1943 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1973 "dhcp4_parser.cc"
     break;
 
-  case 269:
-#line 1017 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 271: // $@49: %empty
+#line 1030 "dhcp4_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1954 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1984 "dhcp4_parser.cc"
     break;
 
-  case 270:
-#line 1022 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 272: // subnet4_list: "subnet4" $@49 ":" "[" subnet4_list_content "]"
+#line 1035 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1963 "dhcp4_parser.cc" // lalr1.cc:919
+#line 1993 "dhcp4_parser.cc"
     break;
 
-  case 275:
-#line 1042 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 277: // $@50: %empty
+#line 1055 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1973 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2003 "dhcp4_parser.cc"
     break;
 
-  case 276:
-#line 1046 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 278: // subnet4: "{" $@50 subnet4_params "}"
+#line 1059 "dhcp4_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1995,599 +2025,599 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1999 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2029 "dhcp4_parser.cc"
     break;
 
-  case 277:
-#line 1068 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 279: // $@51: %empty
+#line 1081 "dhcp4_parser.yy"
+                            {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2009 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2039 "dhcp4_parser.cc"
     break;
 
-  case 278:
-#line 1072 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 280: // sub_subnet4: "{" $@51 subnet4_params "}"
+#line 1085 "dhcp4_parser.yy"
+                                {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2019 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2049 "dhcp4_parser.cc"
     break;
 
-  case 308:
-#line 1113 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 310: // $@52: %empty
+#line 1126 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2027 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2057 "dhcp4_parser.cc"
     break;
 
-  case 309:
-#line 1115 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 311: // subnet: "subnet" $@52 ":" "constant string"
+#line 1128 "dhcp4_parser.yy"
+               {
     ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2037 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2067 "dhcp4_parser.cc"
     break;
 
-  case 310:
-#line 1121 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 312: // $@53: %empty
+#line 1134 "dhcp4_parser.yy"
+                                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2045 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2075 "dhcp4_parser.cc"
     break;
 
-  case 311:
-#line 1123 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 313: // subnet_4o6_interface: "4o6-interface" $@53 ":" "constant string"
+#line 1136 "dhcp4_parser.yy"
+               {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 2055 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2085 "dhcp4_parser.cc"
     break;
 
-  case 312:
-#line 1129 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 314: // $@54: %empty
+#line 1142 "dhcp4_parser.yy"
+                                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2063 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2093 "dhcp4_parser.cc"
     break;
 
-  case 313:
-#line 1131 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 315: // subnet_4o6_interface_id: "4o6-interface-id" $@54 ":" "constant string"
+#line 1144 "dhcp4_parser.yy"
+               {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 2073 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2103 "dhcp4_parser.cc"
     break;
 
-  case 314:
-#line 1137 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 316: // $@55: %empty
+#line 1150 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2081 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2111 "dhcp4_parser.cc"
     break;
 
-  case 315:
-#line 1139 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 317: // subnet_4o6_subnet: "4o6-subnet" $@55 ":" "constant string"
+#line 1152 "dhcp4_parser.yy"
+               {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 2091 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2121 "dhcp4_parser.cc"
     break;
 
-  case 316:
-#line 1145 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 318: // $@56: %empty
+#line 1158 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2099 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2129 "dhcp4_parser.cc"
     break;
 
-  case 317:
-#line 1147 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 319: // interface: "interface" $@56 ":" "constant string"
+#line 1160 "dhcp4_parser.yy"
+               {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2109 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2139 "dhcp4_parser.cc"
     break;
 
-  case 318:
-#line 1153 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 320: // $@57: %empty
+#line 1166 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2117 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2147 "dhcp4_parser.cc"
     break;
 
-  case 319:
-#line 1155 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 321: // client_class: "client-class" $@57 ":" "constant string"
+#line 1168 "dhcp4_parser.yy"
+               {
     ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2127 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2157 "dhcp4_parser.cc"
     break;
 
-  case 320:
-#line 1161 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 322: // $@58: %empty
+#line 1174 "dhcp4_parser.yy"
+                                               {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2138 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2168 "dhcp4_parser.cc"
     break;
 
-  case 321:
-#line 1166 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 323: // require_client_classes: "require-client-classes" $@58 ":" list_strings
+#line 1179 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2147 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2177 "dhcp4_parser.cc"
     break;
 
-  case 322:
-#line 1171 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 324: // $@59: %empty
+#line 1184 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2155 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2185 "dhcp4_parser.cc"
     break;
 
-  case 323:
-#line 1173 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 325: // reservation_mode: "reservation-mode" $@59 ":" hr_mode
+#line 1186 "dhcp4_parser.yy"
+                {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2164 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2194 "dhcp4_parser.cc"
     break;
 
-  case 324:
-#line 1178 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2170 "dhcp4_parser.cc" // lalr1.cc:919
+  case 326: // hr_mode: "disabled"
+#line 1191 "dhcp4_parser.yy"
+                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
+#line 2200 "dhcp4_parser.cc"
     break;
 
-  case 325:
-#line 1179 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2176 "dhcp4_parser.cc" // lalr1.cc:919
+  case 327: // hr_mode: "out-of-pool"
+#line 1192 "dhcp4_parser.yy"
+                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
+#line 2206 "dhcp4_parser.cc"
     break;
 
-  case 326:
-#line 1180 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2182 "dhcp4_parser.cc" // lalr1.cc:919
+  case 328: // hr_mode: "global"
+#line 1193 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
+#line 2212 "dhcp4_parser.cc"
     break;
 
-  case 327:
-#line 1181 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2188 "dhcp4_parser.cc" // lalr1.cc:919
+  case 329: // hr_mode: "all"
+#line 1194 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
+#line 2218 "dhcp4_parser.cc"
     break;
 
-  case 328:
-#line 1184 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 330: // id: "id" ":" "integer"
+#line 1197 "dhcp4_parser.yy"
+                     {
     ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2197 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2227 "dhcp4_parser.cc"
     break;
 
-  case 329:
-#line 1191 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 331: // $@60: %empty
+#line 1204 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2208 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2238 "dhcp4_parser.cc"
     break;
 
-  case 330:
-#line 1196 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 332: // shared_networks: "shared-networks" $@60 ":" "[" shared_networks_content "]"
+#line 1209 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2217 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2247 "dhcp4_parser.cc"
     break;
 
-  case 335:
-#line 1211 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 337: // $@61: %empty
+#line 1224 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2227 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2257 "dhcp4_parser.cc"
     break;
 
-  case 336:
-#line 1215 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 338: // shared_network: "{" $@61 shared_network_params "}"
+#line 1228 "dhcp4_parser.yy"
+                                       {
     ctx.stack_.pop_back();
 }
-#line 2235 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2265 "dhcp4_parser.cc"
     break;
 
-  case 361:
-#line 1251 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 363: // $@62: %empty
+#line 1264 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2246 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2276 "dhcp4_parser.cc"
     break;
 
-  case 362:
-#line 1256 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 364: // option_def_list: "option-def" $@62 ":" "[" option_def_list_content "]"
+#line 1269 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2255 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2285 "dhcp4_parser.cc"
     break;
 
-  case 363:
-#line 1264 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 365: // $@63: %empty
+#line 1277 "dhcp4_parser.yy"
+                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2264 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2294 "dhcp4_parser.cc"
     break;
 
-  case 364:
-#line 1267 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 366: // sub_option_def_list: "{" $@63 option_def_list "}"
+#line 1280 "dhcp4_parser.yy"
+                                 {
     // parsing completed
 }
-#line 2272 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2302 "dhcp4_parser.cc"
     break;
 
-  case 369:
-#line 1283 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 371: // $@64: %empty
+#line 1296 "dhcp4_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2282 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2312 "dhcp4_parser.cc"
     break;
 
-  case 370:
-#line 1287 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 372: // option_def_entry: "{" $@64 option_def_params "}"
+#line 1300 "dhcp4_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2294 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2324 "dhcp4_parser.cc"
     break;
 
-  case 371:
-#line 1298 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 373: // $@65: %empty
+#line 1311 "dhcp4_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2304 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2334 "dhcp4_parser.cc"
     break;
 
-  case 372:
-#line 1302 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 374: // sub_option_def: "{" $@65 option_def_params "}"
+#line 1315 "dhcp4_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2316 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2346 "dhcp4_parser.cc"
     break;
 
-  case 388:
-#line 1334 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 390: // code: "code" ":" "integer"
+#line 1347 "dhcp4_parser.yy"
+                         {
     ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2325 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2355 "dhcp4_parser.cc"
     break;
 
-  case 390:
-#line 1341 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 392: // $@66: %empty
+#line 1354 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2333 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2363 "dhcp4_parser.cc"
     break;
 
-  case 391:
-#line 1343 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 393: // option_def_type: "type" $@66 ":" "constant string"
+#line 1356 "dhcp4_parser.yy"
+               {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2343 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2373 "dhcp4_parser.cc"
     break;
 
-  case 392:
-#line 1349 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 394: // $@67: %empty
+#line 1362 "dhcp4_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2351 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2381 "dhcp4_parser.cc"
     break;
 
-  case 393:
-#line 1351 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 395: // option_def_record_types: "record-types" $@67 ":" "constant string"
+#line 1364 "dhcp4_parser.yy"
+               {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2361 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2391 "dhcp4_parser.cc"
     break;
 
-  case 394:
-#line 1357 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 396: // $@68: %empty
+#line 1370 "dhcp4_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2369 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2399 "dhcp4_parser.cc"
     break;
 
-  case 395:
-#line 1359 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 397: // space: "space" $@68 ":" "constant string"
+#line 1372 "dhcp4_parser.yy"
+               {
     ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2379 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2409 "dhcp4_parser.cc"
     break;
 
-  case 397:
-#line 1367 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 399: // $@69: %empty
+#line 1380 "dhcp4_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2387 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2417 "dhcp4_parser.cc"
     break;
 
-  case 398:
-#line 1369 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 400: // option_def_encapsulate: "encapsulate" $@69 ":" "constant string"
+#line 1382 "dhcp4_parser.yy"
+               {
     ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2397 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2427 "dhcp4_parser.cc"
     break;
 
-  case 399:
-#line 1375 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 401: // option_def_array: "array" ":" "boolean"
+#line 1388 "dhcp4_parser.yy"
+                                      {
     ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2406 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2436 "dhcp4_parser.cc"
     break;
 
-  case 400:
-#line 1384 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 402: // $@70: %empty
+#line 1397 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2417 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2447 "dhcp4_parser.cc"
     break;
 
-  case 401:
-#line 1389 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 403: // option_data_list: "option-data" $@70 ":" "[" option_data_list_content "]"
+#line 1402 "dhcp4_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2426 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2456 "dhcp4_parser.cc"
     break;
 
-  case 406:
-#line 1408 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 408: // $@71: %empty
+#line 1421 "dhcp4_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2436 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2466 "dhcp4_parser.cc"
     break;
 
-  case 407:
-#line 1412 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 409: // option_data_entry: "{" $@71 option_data_params "}"
+#line 1425 "dhcp4_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2445 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2475 "dhcp4_parser.cc"
     break;
 
-  case 408:
-#line 1420 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 410: // $@72: %empty
+#line 1433 "dhcp4_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2455 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2485 "dhcp4_parser.cc"
     break;
 
-  case 409:
-#line 1424 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 411: // sub_option_data: "{" $@72 option_data_params "}"
+#line 1437 "dhcp4_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2464 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2494 "dhcp4_parser.cc"
     break;
 
-  case 424:
-#line 1457 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 426: // $@73: %empty
+#line 1470 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2472 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2502 "dhcp4_parser.cc"
     break;
 
-  case 425:
-#line 1459 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 427: // option_data_data: "data" $@73 ":" "constant string"
+#line 1472 "dhcp4_parser.yy"
+               {
     ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2482 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2512 "dhcp4_parser.cc"
     break;
 
-  case 428:
-#line 1469 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 430: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1482 "dhcp4_parser.yy"
+                                                 {
     ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2491 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2521 "dhcp4_parser.cc"
     break;
 
-  case 429:
-#line 1474 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 431: // option_data_always_send: "always-send" ":" "boolean"
+#line 1487 "dhcp4_parser.yy"
+                                                   {
     ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2500 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2530 "dhcp4_parser.cc"
     break;
 
-  case 430:
-#line 1482 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 432: // $@74: %empty
+#line 1495 "dhcp4_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2511 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2541 "dhcp4_parser.cc"
     break;
 
-  case 431:
-#line 1487 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 433: // pools_list: "pools" $@74 ":" "[" pools_list_content "]"
+#line 1500 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2520 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2550 "dhcp4_parser.cc"
     break;
 
-  case 436:
-#line 1502 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 438: // $@75: %empty
+#line 1515 "dhcp4_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2530 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2560 "dhcp4_parser.cc"
     break;
 
-  case 437:
-#line 1506 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 439: // pool_list_entry: "{" $@75 pool_params "}"
+#line 1519 "dhcp4_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2540 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2570 "dhcp4_parser.cc"
     break;
 
-  case 438:
-#line 1512 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 440: // $@76: %empty
+#line 1525 "dhcp4_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2550 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2580 "dhcp4_parser.cc"
     break;
 
-  case 439:
-#line 1516 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 441: // sub_pool4: "{" $@76 pool_params "}"
+#line 1529 "dhcp4_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2560 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2590 "dhcp4_parser.cc"
     break;
 
-  case 449:
-#line 1535 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 451: // $@77: %empty
+#line 1548 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2568 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2598 "dhcp4_parser.cc"
     break;
 
-  case 450:
-#line 1537 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 452: // pool_entry: "pool" $@77 ":" "constant string"
+#line 1550 "dhcp4_parser.yy"
+               {
     ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2578 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2608 "dhcp4_parser.cc"
     break;
 
-  case 451:
-#line 1543 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 453: // $@78: %empty
+#line 1556 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2586 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2616 "dhcp4_parser.cc"
     break;
 
-  case 452:
-#line 1545 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 454: // user_context: "user-context" $@78 ":" map_value
+#line 1558 "dhcp4_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -2609,20 +2639,20 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2613 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2643 "dhcp4_parser.cc"
     break;
 
-  case 453:
-#line 1568 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 455: // $@79: %empty
+#line 1581 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2621 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2651 "dhcp4_parser.cc"
     break;
 
-  case 454:
-#line 1570 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 456: // comment: "comment" $@79 ":" "constant string"
+#line 1583 "dhcp4_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -2646,450 +2676,459 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2650 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2680 "dhcp4_parser.cc"
     break;
 
-  case 455:
-#line 1598 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 457: // $@80: %empty
+#line 1611 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2661 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2691 "dhcp4_parser.cc"
     break;
 
-  case 456:
-#line 1603 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 458: // reservations: "reservations" $@80 ":" "[" reservations_list "]"
+#line 1616 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2670 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2700 "dhcp4_parser.cc"
     break;
 
-  case 461:
-#line 1616 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 463: // $@81: %empty
+#line 1629 "dhcp4_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2680 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2710 "dhcp4_parser.cc"
     break;
 
-  case 462:
-#line 1620 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 464: // reservation: "{" $@81 reservation_params "}"
+#line 1633 "dhcp4_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2689 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2719 "dhcp4_parser.cc"
     break;
 
-  case 463:
-#line 1625 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 465: // $@82: %empty
+#line 1638 "dhcp4_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2699 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2729 "dhcp4_parser.cc"
     break;
 
-  case 464:
-#line 1629 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 466: // sub_reservation: "{" $@82 reservation_params "}"
+#line 1642 "dhcp4_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2708 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2738 "dhcp4_parser.cc"
     break;
 
-  case 484:
-#line 1660 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 486: // $@83: %empty
+#line 1673 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2716 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2746 "dhcp4_parser.cc"
     break;
 
-  case 485:
-#line 1662 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 487: // next_server: "next-server" $@83 ":" "constant string"
+#line 1675 "dhcp4_parser.yy"
+               {
     ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2726 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2756 "dhcp4_parser.cc"
     break;
 
-  case 486:
-#line 1668 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 488: // $@84: %empty
+#line 1681 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2734 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2764 "dhcp4_parser.cc"
     break;
 
-  case 487:
-#line 1670 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 489: // server_hostname: "server-hostname" $@84 ":" "constant string"
+#line 1683 "dhcp4_parser.yy"
+               {
     ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2744 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2774 "dhcp4_parser.cc"
     break;
 
-  case 488:
-#line 1676 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 490: // $@85: %empty
+#line 1689 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2752 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2782 "dhcp4_parser.cc"
     break;
 
-  case 489:
-#line 1678 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 491: // boot_file_name: "boot-file-name" $@85 ":" "constant string"
+#line 1691 "dhcp4_parser.yy"
+               {
     ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2762 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2792 "dhcp4_parser.cc"
     break;
 
-  case 490:
-#line 1684 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 492: // $@86: %empty
+#line 1697 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2770 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2800 "dhcp4_parser.cc"
     break;
 
-  case 491:
-#line 1686 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 493: // ip_address: "ip-address" $@86 ":" "constant string"
+#line 1699 "dhcp4_parser.yy"
+               {
     ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2780 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2810 "dhcp4_parser.cc"
     break;
 
-  case 492:
-#line 1692 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 494: // $@87: %empty
+#line 1705 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2791 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2821 "dhcp4_parser.cc"
     break;
 
-  case 493:
-#line 1697 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 495: // ip_addresses: "ip-addresses" $@87 ":" list_strings
+#line 1710 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2800 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2830 "dhcp4_parser.cc"
     break;
 
-  case 494:
-#line 1702 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 496: // $@88: %empty
+#line 1715 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2808 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2838 "dhcp4_parser.cc"
     break;
 
-  case 495:
-#line 1704 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 497: // duid: "duid" $@88 ":" "constant string"
+#line 1717 "dhcp4_parser.yy"
+               {
     ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2818 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2848 "dhcp4_parser.cc"
     break;
 
-  case 496:
-#line 1710 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 498: // $@89: %empty
+#line 1723 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2826 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2856 "dhcp4_parser.cc"
     break;
 
-  case 497:
-#line 1712 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 499: // hw_address: "hw-address" $@89 ":" "constant string"
+#line 1725 "dhcp4_parser.yy"
+               {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2836 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2866 "dhcp4_parser.cc"
     break;
 
-  case 498:
-#line 1718 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 500: // $@90: %empty
+#line 1731 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2844 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2874 "dhcp4_parser.cc"
     break;
 
-  case 499:
-#line 1720 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 501: // client_id_value: "client-id" $@90 ":" "constant string"
+#line 1733 "dhcp4_parser.yy"
+               {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2854 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2884 "dhcp4_parser.cc"
     break;
 
-  case 500:
-#line 1726 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 502: // $@91: %empty
+#line 1739 "dhcp4_parser.yy"
+                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2862 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2892 "dhcp4_parser.cc"
     break;
 
-  case 501:
-#line 1728 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 503: // circuit_id_value: "circuit-id" $@91 ":" "constant string"
+#line 1741 "dhcp4_parser.yy"
+               {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2872 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2902 "dhcp4_parser.cc"
     break;
 
-  case 502:
-#line 1734 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 504: // $@92: %empty
+#line 1747 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2880 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2910 "dhcp4_parser.cc"
     break;
 
-  case 503:
-#line 1736 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 505: // flex_id_value: "flex-id" $@92 ":" "constant string"
+#line 1749 "dhcp4_parser.yy"
+               {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2890 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2920 "dhcp4_parser.cc"
     break;
 
-  case 504:
-#line 1742 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 506: // $@93: %empty
+#line 1755 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2898 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2928 "dhcp4_parser.cc"
     break;
 
-  case 505:
-#line 1744 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 507: // hostname: "hostname" $@93 ":" "constant string"
+#line 1757 "dhcp4_parser.yy"
+               {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2908 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2938 "dhcp4_parser.cc"
     break;
 
-  case 506:
-#line 1750 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 508: // $@94: %empty
+#line 1763 "dhcp4_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2919 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2949 "dhcp4_parser.cc"
     break;
 
-  case 507:
-#line 1755 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 509: // reservation_client_classes: "client-classes" $@94 ":" list_strings
+#line 1768 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2928 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2958 "dhcp4_parser.cc"
     break;
 
-  case 508:
-#line 1763 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 510: // $@95: %empty
+#line 1776 "dhcp4_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2939 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2969 "dhcp4_parser.cc"
     break;
 
-  case 509:
-#line 1768 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 511: // relay: "relay" $@95 ":" "{" relay_map "}"
+#line 1781 "dhcp4_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2948 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2978 "dhcp4_parser.cc"
     break;
 
-  case 512:
-#line 1780 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 514: // $@96: %empty
+#line 1793 "dhcp4_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2959 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2989 "dhcp4_parser.cc"
     break;
 
-  case 513:
-#line 1785 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 515: // client_classes: "client-classes" $@96 ":" "[" client_classes_list "]"
+#line 1798 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2968 "dhcp4_parser.cc" // lalr1.cc:919
+#line 2998 "dhcp4_parser.cc"
     break;
 
-  case 516:
-#line 1794 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 518: // $@97: %empty
+#line 1807 "dhcp4_parser.yy"
+                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2978 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3008 "dhcp4_parser.cc"
     break;
 
-  case 517:
-#line 1798 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 519: // client_class_entry: "{" $@97 client_class_params "}"
+#line 1811 "dhcp4_parser.yy"
+                                     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2988 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3018 "dhcp4_parser.cc"
     break;
 
-  case 534:
-#line 1827 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 536: // $@98: %empty
+#line 1840 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2996 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3026 "dhcp4_parser.cc"
     break;
 
-  case 535:
-#line 1829 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 537: // client_class_test: "test" $@98 ":" "constant string"
+#line 1842 "dhcp4_parser.yy"
+               {
     ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3006 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3036 "dhcp4_parser.cc"
     break;
 
-  case 536:
-#line 1835 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 538: // only_if_required: "only-if-required" ":" "boolean"
+#line 1848 "dhcp4_parser.yy"
+                                                 {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3015 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3045 "dhcp4_parser.cc"
     break;
 
-  case 537:
-#line 1844 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 539: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1857 "dhcp4_parser.yy"
+                                         {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3024 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3054 "dhcp4_parser.cc"
     break;
 
-  case 538:
-#line 1851 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 540: // $@99: %empty
+#line 1864 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3035 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3065 "dhcp4_parser.cc"
     break;
 
-  case 539:
-#line 1856 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 541: // control_socket: "control-socket" $@99 ":" "{" control_socket_params "}"
+#line 1869 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3044 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3074 "dhcp4_parser.cc"
     break;
 
-  case 547:
-#line 1872 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 550: // $@100: %empty
+#line 1886 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3052 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3082 "dhcp4_parser.cc"
     break;
 
-  case 548:
-#line 1874 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 551: // control_socket_type: "socket-type" $@100 ":" "constant string"
+#line 1888 "dhcp4_parser.yy"
+               {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3062 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3092 "dhcp4_parser.cc"
     break;
 
-  case 549:
-#line 1880 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 552: // $@101: %empty
+#line 1894 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3070 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3100 "dhcp4_parser.cc"
     break;
 
-  case 550:
-#line 1882 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 553: // control_socket_name: "socket-name" $@101 ":" "constant string"
+#line 1896 "dhcp4_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3080 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3110 "dhcp4_parser.cc"
     break;
 
-  case 551:
-#line 1891 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 554: // config_output_threads: "config-output-threads" ":" "integer"
+#line 1902 "dhcp4_parser.yy"
+                                                           {
+    ElementPtr threads(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("config-output-threads", threads);
+}
+#line 3119 "dhcp4_parser.cc"
+    break;
+
+  case 555: // $@102: %empty
+#line 1910 "dhcp4_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3088 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3127 "dhcp4_parser.cc"
     break;
 
-  case 552:
-#line 1893 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 556: // dhcp_queue_control: "dhcp-queue-control" $@102 ":" map_value
+#line 1912 "dhcp4_parser.yy"
+                  {
     ElementPtr qc = yystack_[0].value.as < ElementPtr > ();
     ctx.stack_.back()->set("dhcp-queue-control", qc);
 
@@ -3122,626 +3161,674 @@ namespace isc { namespace dhcp {
 
     ctx.leave();
 }
-#line 3126 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3165 "dhcp4_parser.cc"
     break;
 
-  case 553:
-#line 1929 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 557: // $@103: %empty
+#line 1948 "dhcp4_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3137 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3176 "dhcp4_parser.cc"
     break;
 
-  case 554:
-#line 1934 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 558: // dhcp_ddns: "dhcp-ddns" $@103 ":" "{" dhcp_ddns_params "}"
+#line 1953 "dhcp4_parser.yy"
+                                                       {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3148 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3187 "dhcp4_parser.cc"
     break;
 
-  case 555:
-#line 1941 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 559: // $@104: %empty
+#line 1960 "dhcp4_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3158 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3197 "dhcp4_parser.cc"
     break;
 
-  case 556:
-#line 1945 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 560: // sub_dhcp_ddns: "{" $@104 dhcp_ddns_params "}"
+#line 1964 "dhcp4_parser.yy"
+                                  {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3168 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3207 "dhcp4_parser.cc"
     break;
 
-  case 577:
-#line 1975 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 581: // enable_updates: "enable-updates" ":" "boolean"
+#line 1994 "dhcp4_parser.yy"
+                                             {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3177 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3216 "dhcp4_parser.cc"
     break;
 
-  case 578:
-#line 1980 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 582: // $@105: %empty
+#line 1999 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3185 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3224 "dhcp4_parser.cc"
     break;
 
-  case 579:
-#line 1982 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 583: // qualifying_suffix: "qualifying-suffix" $@105 ":" "constant string"
+#line 2001 "dhcp4_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3195 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3234 "dhcp4_parser.cc"
     break;
 
-  case 580:
-#line 1988 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 584: // $@106: %empty
+#line 2007 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3203 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3242 "dhcp4_parser.cc"
     break;
 
-  case 581:
-#line 1990 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 585: // server_ip: "server-ip" $@106 ":" "constant string"
+#line 2009 "dhcp4_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3213 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3252 "dhcp4_parser.cc"
     break;
 
-  case 582:
-#line 1996 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 586: // server_port: "server-port" ":" "integer"
+#line 2015 "dhcp4_parser.yy"
+                                       {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3222 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3261 "dhcp4_parser.cc"
     break;
 
-  case 583:
-#line 2001 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 587: // $@107: %empty
+#line 2020 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3230 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3269 "dhcp4_parser.cc"
     break;
 
-  case 584:
-#line 2003 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 588: // sender_ip: "sender-ip" $@107 ":" "constant string"
+#line 2022 "dhcp4_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3240 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3279 "dhcp4_parser.cc"
     break;
 
-  case 585:
-#line 2009 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 589: // sender_port: "sender-port" ":" "integer"
+#line 2028 "dhcp4_parser.yy"
+                                       {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3249 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3288 "dhcp4_parser.cc"
     break;
 
-  case 586:
-#line 2014 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 590: // max_queue_size: "max-queue-size" ":" "integer"
+#line 2033 "dhcp4_parser.yy"
+                                             {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3258 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3297 "dhcp4_parser.cc"
     break;
 
-  case 587:
-#line 2019 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 591: // $@108: %empty
+#line 2038 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3266 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3305 "dhcp4_parser.cc"
     break;
 
-  case 588:
-#line 2021 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 592: // ncr_protocol: "ncr-protocol" $@108 ":" ncr_protocol_value
+#line 2040 "dhcp4_parser.yy"
+                           {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3275 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3314 "dhcp4_parser.cc"
     break;
 
-  case 589:
-#line 2027 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3281 "dhcp4_parser.cc" // lalr1.cc:919
+  case 593: // ncr_protocol_value: "udp"
+#line 2046 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 3320 "dhcp4_parser.cc"
     break;
 
-  case 590:
-#line 2028 "dhcp4_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3287 "dhcp4_parser.cc" // lalr1.cc:919
+  case 594: // ncr_protocol_value: "tcp"
+#line 2047 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 3326 "dhcp4_parser.cc"
     break;
 
-  case 591:
-#line 2031 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 595: // $@109: %empty
+#line 2050 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3295 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3334 "dhcp4_parser.cc"
     break;
 
-  case 592:
-#line 2033 "dhcp4_parser.yy" // lalr1.cc:919
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 596: // ncr_format: "ncr-format" $@109 ":" ncr_format_value
+#line 2052 "dhcp4_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3305 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3343 "dhcp4_parser.cc"
     break;
 
-  case 593:
-#line 2039 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 597: // ncr_format_value: "JSON"
+#line 2058 "dhcp4_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 3349 "dhcp4_parser.cc"
+    break;
+
+  case 598: // ncr_format_value: "BINARY"
+#line 2059 "dhcp4_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 3355 "dhcp4_parser.cc"
+    break;
+
+  case 599: // override_no_update: "override-no-update" ":" "boolean"
+#line 2062 "dhcp4_parser.yy"
+                                                     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3314 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3364 "dhcp4_parser.cc"
     break;
 
-  case 594:
-#line 2044 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 600: // override_client_update: "override-client-update" ":" "boolean"
+#line 2067 "dhcp4_parser.yy"
+                                                             {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3323 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3373 "dhcp4_parser.cc"
     break;
 
-  case 595:
-#line 2049 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 601: // $@110: %empty
+#line 2072 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3331 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3381 "dhcp4_parser.cc"
     break;
 
-  case 596:
-#line 2051 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 602: // replace_client_name: "replace-client-name" $@110 ":" replace_client_name_value
+#line 2074 "dhcp4_parser.yy"
+                                  {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3340 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3390 "dhcp4_parser.cc"
     break;
 
-  case 597:
-#line 2057 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 603: // replace_client_name_value: "when-present"
+#line 2080 "dhcp4_parser.yy"
+                 {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3348 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3398 "dhcp4_parser.cc"
     break;
 
-  case 598:
-#line 2060 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 604: // replace_client_name_value: "never"
+#line 2083 "dhcp4_parser.yy"
+          {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3356 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3406 "dhcp4_parser.cc"
     break;
 
-  case 599:
-#line 2063 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 605: // replace_client_name_value: "always"
+#line 2086 "dhcp4_parser.yy"
+           {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3364 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3414 "dhcp4_parser.cc"
     break;
 
-  case 600:
-#line 2066 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 606: // replace_client_name_value: "when-not-present"
+#line 2089 "dhcp4_parser.yy"
+                     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3372 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3422 "dhcp4_parser.cc"
     break;
 
-  case 601:
-#line 2069 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 607: // replace_client_name_value: "boolean"
+#line 2092 "dhcp4_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3381 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3431 "dhcp4_parser.cc"
     break;
 
-  case 602:
-#line 2075 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 608: // $@111: %empty
+#line 2098 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3389 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3439 "dhcp4_parser.cc"
     break;
 
-  case 603:
-#line 2077 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 609: // generated_prefix: "generated-prefix" $@111 ":" "constant string"
+#line 2100 "dhcp4_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3399 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3449 "dhcp4_parser.cc"
     break;
 
-  case 604:
-#line 2083 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 610: // $@112: %empty
+#line 2106 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3407 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3457 "dhcp4_parser.cc"
     break;
 
-  case 605:
-#line 2085 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 611: // hostname_char_set: "hostname-char-set" $@112 ":" "constant string"
+#line 2108 "dhcp4_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3417 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3467 "dhcp4_parser.cc"
     break;
 
-  case 606:
-#line 2091 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 612: // $@113: %empty
+#line 2114 "dhcp4_parser.yy"
+                                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3425 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3475 "dhcp4_parser.cc"
     break;
 
-  case 607:
-#line 2093 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 613: // hostname_char_replacement: "hostname-char-replacement" $@113 ":" "constant string"
+#line 2116 "dhcp4_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3435 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3485 "dhcp4_parser.cc"
     break;
 
-  case 608:
-#line 2102 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 614: // $@114: %empty
+#line 2125 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3443 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3493 "dhcp4_parser.cc"
     break;
 
-  case 609:
-#line 2104 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 615: // dhcp6_json_object: "Dhcp6" $@114 ":" value
+#line 2127 "dhcp4_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3452 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3502 "dhcp4_parser.cc"
     break;
 
-  case 610:
-#line 2109 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 616: // $@115: %empty
+#line 2132 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3460 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3510 "dhcp4_parser.cc"
     break;
 
-  case 611:
-#line 2111 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 617: // dhcpddns_json_object: "DhcpDdns" $@115 ":" value
+#line 2134 "dhcp4_parser.yy"
+              {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3469 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3519 "dhcp4_parser.cc"
     break;
 
-  case 612:
-#line 2116 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 618: // $@116: %empty
+#line 2139 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3477 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3527 "dhcp4_parser.cc"
     break;
 
-  case 613:
-#line 2118 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 619: // control_agent_json_object: "Control-agent" $@116 ":" value
+#line 2141 "dhcp4_parser.yy"
+              {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3486 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3536 "dhcp4_parser.cc"
     break;
 
-  case 614:
-#line 2123 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 620: // $@117: %empty
+#line 2146 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3497 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3547 "dhcp4_parser.cc"
     break;
 
-  case 615:
-#line 2128 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 621: // config_control: "config-control" $@117 ":" "{" config_control_params "}"
+#line 2151 "dhcp4_parser.yy"
+                                                            {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3507 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3557 "dhcp4_parser.cc"
     break;
 
-  case 616:
-#line 2134 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 622: // $@118: %empty
+#line 2157 "dhcp4_parser.yy"
+                                   {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3517 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3567 "dhcp4_parser.cc"
     break;
 
-  case 617:
-#line 2138 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 623: // sub_config_control: "{" $@118 config_control_params "}"
+#line 2161 "dhcp4_parser.yy"
+                                       {
     // No config_control params are required
     // parsing completed
 }
-#line 3526 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3576 "dhcp4_parser.cc"
     break;
 
-  case 622:
-#line 2153 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 628: // $@119: %empty
+#line 2176 "dhcp4_parser.yy"
+                                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3537 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3587 "dhcp4_parser.cc"
     break;
 
-  case 623:
-#line 2158 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 629: // config_databases: "config-databases" $@119 ":" "[" database_list "]"
+#line 2181 "dhcp4_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3546 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3596 "dhcp4_parser.cc"
     break;
 
-  case 624:
-#line 2163 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 630: // config_fetch_wait_time: "config-fetch-wait-time" ":" "integer"
+#line 2186 "dhcp4_parser.yy"
+                                                             {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3555 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3605 "dhcp4_parser.cc"
     break;
 
-  case 625:
-#line 2173 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 631: // $@120: %empty
+#line 2196 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3566 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3616 "dhcp4_parser.cc"
     break;
 
-  case 626:
-#line 2178 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 632: // logging_object: "Logging" $@120 ":" "{" logging_params "}"
+#line 2201 "dhcp4_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3575 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3625 "dhcp4_parser.cc"
     break;
 
-  case 627:
-#line 2183 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 633: // $@121: %empty
+#line 2206 "dhcp4_parser.yy"
+                            {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3585 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3635 "dhcp4_parser.cc"
     break;
 
-  case 628:
-#line 2187 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 634: // sub_logging: "{" $@121 logging_params "}"
+#line 2210 "dhcp4_parser.yy"
+                                {
     // parsing completed
 }
-#line 3593 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3643 "dhcp4_parser.cc"
     break;
 
-  case 632:
-#line 2203 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 638: // $@122: %empty
+#line 2226 "dhcp4_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3604 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3654 "dhcp4_parser.cc"
     break;
 
-  case 633:
-#line 2208 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 639: // loggers: "loggers" $@122 ":" "[" loggers_entries "]"
+#line 2231 "dhcp4_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3613 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3663 "dhcp4_parser.cc"
     break;
 
-  case 636:
-#line 2220 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 642: // $@123: %empty
+#line 2243 "dhcp4_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3623 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3673 "dhcp4_parser.cc"
     break;
 
-  case 637:
-#line 2224 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 643: // logger_entry: "{" $@123 logger_params "}"
+#line 2247 "dhcp4_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3631 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3681 "dhcp4_parser.cc"
     break;
 
-  case 647:
-#line 2241 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 653: // debuglevel: "debuglevel" ":" "integer"
+#line 2264 "dhcp4_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3640 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3690 "dhcp4_parser.cc"
     break;
 
-  case 648:
-#line 2246 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 654: // $@124: %empty
+#line 2269 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3648 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3698 "dhcp4_parser.cc"
     break;
 
-  case 649:
-#line 2248 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 655: // severity: "severity" $@124 ":" "constant string"
+#line 2271 "dhcp4_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3658 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3708 "dhcp4_parser.cc"
     break;
 
-  case 650:
-#line 2254 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 656: // $@125: %empty
+#line 2277 "dhcp4_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3669 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3719 "dhcp4_parser.cc"
     break;
 
-  case 651:
-#line 2259 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 657: // output_options_list: "output_options" $@125 ":" "[" output_options_list_content "]"
+#line 2282 "dhcp4_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3678 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3728 "dhcp4_parser.cc"
     break;
 
-  case 654:
-#line 2268 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 660: // $@126: %empty
+#line 2291 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3688 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3738 "dhcp4_parser.cc"
     break;
 
-  case 655:
-#line 2272 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 661: // output_entry: "{" $@126 output_params_list "}"
+#line 2295 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3696 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3746 "dhcp4_parser.cc"
     break;
 
-  case 662:
-#line 2286 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 671: // $@127: %empty
+#line 2312 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3704 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3754 "dhcp4_parser.cc"
     break;
 
-  case 663:
-#line 2288 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 672: // output: "output" $@127 ":" "constant string"
+#line 2314 "dhcp4_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3714 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3764 "dhcp4_parser.cc"
     break;
 
-  case 664:
-#line 2294 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 673: // flush: "flush" ":" "boolean"
+#line 2320 "dhcp4_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3723 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3773 "dhcp4_parser.cc"
     break;
 
-  case 665:
-#line 2299 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 674: // maxsize: "maxsize" ":" "integer"
+#line 2325 "dhcp4_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3732 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3782 "dhcp4_parser.cc"
     break;
 
-  case 666:
-#line 2304 "dhcp4_parser.yy" // lalr1.cc:919
-    {
+  case 675: // maxver: "maxver" ":" "integer"
+#line 2330 "dhcp4_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3741 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3791 "dhcp4_parser.cc"
+    break;
+
+  case 676: // async: "async" ":" "boolean"
+#line 2335 "dhcp4_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 3800 "dhcp4_parser.cc"
+    break;
+
+  case 677: // queue_size: "queue-size" ":" "integer"
+#line 2340 "dhcp4_parser.yy"
+                                     {
+    ElementPtr queue_size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+#line 3809 "dhcp4_parser.cc"
+    break;
+
+  case 678: // $@128: %empty
+#line 2345 "dhcp4_parser.yy"
+                          {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3817 "dhcp4_parser.cc"
+    break;
+
+  case 679: // overflow: "overflow" $@128 ":" "constant string"
+#line 2347 "dhcp4_parser.yy"
+               {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+#line 3827 "dhcp4_parser.cc"
     break;
 
 
-#line 3745 "dhcp4_parser.cc" // lalr1.cc:919
+#line 3831 "dhcp4_parser.cc"
+
             default:
               break;
             }
@@ -3757,7 +3844,6 @@ namespace isc { namespace dhcp {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -3773,7 +3859,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3784,7 +3872,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3810,6 +3898,7 @@ namespace isc { namespace dhcp {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -3818,37 +3907,39 @@ namespace isc { namespace dhcp {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -3880,6 +3971,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3913,18 +4005,103 @@ namespace isc { namespace dhcp {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp4Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp4Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
 
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp4Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp4Parser::context.
+  Dhcp4Parser::context::context (const Dhcp4Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp4Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp4Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3943,41 +4120,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp4Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3998,11 +4166,11 @@ namespace isc { namespace dhcp {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -4011,730 +4179,739 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp4Parser::yypact_ninf_ = -828;
+  const short Dhcp4Parser::yypact_ninf_ = -834;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp4Parser::yypact_[] =
   {
-     332,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,    32,    35,    38,    52,    56,
-      71,    75,    82,    84,   102,   110,   125,   143,   153,   163,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,    35,  -102,
-      17,   170,    42,   520,    39,    45,   168,   188,   281,   -12,
-     344,    37,   178,  -828,    74,   191,   217,   239,   253,  -828,
-    -828,  -828,  -828,  -828,   269,  -828,    57,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,   279,   294,   296,  -828,
-    -828,  -828,  -828,  -828,  -828,   298,   299,   321,   322,   323,
-     324,   325,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,   328,  -828,  -828,  -828,  -828,
-      59,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   329,  -828,    68,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,   330,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-      76,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,   115,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,   268,   284,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,   334,  -828,  -828,   333,
-    -828,  -828,  -828,   336,  -828,  -828,   335,   341,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   342,   343,  -828,  -828,  -828,  -828,   340,   346,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   123,  -828,  -828,  -828,   357,  -828,  -828,   362,  -828,
-     363,   364,  -828,  -828,   365,   368,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,   126,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   127,  -828,  -828,  -828,   370,   155,  -828,  -828,  -828,
-    -828,    35,    35,  -828,   165,   373,   374,   375,   378,   381,
-    -828,    17,  -828,   383,   385,   389,   164,   176,   221,   392,
-     393,   394,   396,   397,   399,   233,   235,   237,   230,   241,
-     245,   238,   409,   411,   412,   417,   419,   424,   425,   428,
-     429,   436,   437,   439,   440,   273,   443,   444,   447,   170,
-    -828,   451,   452,   453,   288,    42,  -828,   454,   460,   461,
-     462,   463,   477,   310,   479,   480,   481,   520,  -828,   482,
-      39,  -828,   499,   500,   501,   502,   503,   504,   505,   506,
-    -828,    45,  -828,   507,   508,   345,   509,   510,   512,   347,
-    -828,   188,   514,   348,   349,  -828,   281,   515,   516,    95,
-    -828,   350,   522,   523,   356,   525,   358,   360,   529,   530,
-     361,   367,   532,   533,   534,   535,   344,  -828,   538,    37,
-    -828,   539,   379,   178,  -828,  -828,  -828,   541,   545,   546,
-      35,    35,    35,  -828,   547,   548,   549,  -828,  -828,  -828,
-     387,   390,   395,   553,   557,   560,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,   398,   562,   563,   566,   568,   567,   404,
-     206,   577,   578,   579,   586,   585,  -828,   587,   567,   588,
-    -828,   591,   194,   204,  -828,  -828,   422,   426,   427,   594,
-     430,   442,  -828,   591,   445,   608,  -828,   448,  -828,   591,
-     449,   450,   455,   456,   457,   458,   459,  -828,   464,   465,
-    -828,   466,   473,   474,  -828,  -828,   476,  -828,  -828,  -828,
-     478,    35,  -828,  -828,   483,   484,  -828,   485,  -828,  -828,
-      28,   486,  -828,  -828,   -35,   487,   488,   489,  -828,   617,
-    -828,   618,  -828,  -828,    35,   170,    37,  -828,  -828,  -828,
-     178,    42,   607,  -828,  -828,  -828,   265,   265,   625,  -828,
-     626,   627,   641,   643,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,    11,   646,   650,   654,    62,   -34,  -828,   344,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   655,  -828,  -828,  -828,  -828,   108,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-     656,   625,  -828,   158,   177,   179,   215,  -828,   232,  -828,
-    -828,  -828,  -828,  -828,  -828,   662,   664,   666,   667,   668,
-    -828,  -828,  -828,  -828,   669,   670,   671,   673,   674,  -828,
-     234,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   240,  -828,   675,   677,  -828,  -828,   676,   680,  -828,
-    -828,   678,   682,  -828,  -828,   683,   685,  -828,  -828,   684,
-     689,  -828,  -828,  -828,  -828,  -828,  -828,    44,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,   113,  -828,  -828,   687,   691,
-    -828,  -828,   690,   692,  -828,   693,   694,   695,   696,   697,
-     698,   242,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,   243,  -828,  -828,  -828,   251,   536,
-    -828,   699,   700,  -828,  -828,  -828,  -828,   701,  -828,   151,
-    -828,   702,  -828,  -828,  -828,  -828,   706,   607,  -828,   707,
-     708,   709,   710,   543,   542,   550,   544,   551,   713,   715,
-     716,   717,   552,   554,   555,   556,   558,   265,  -828,  -828,
-     265,  -828,   625,   520,  -828,   626,   188,  -828,   627,   281,
-    -828,   641,   582,  -828,   643,    11,  -828,    73,   646,  -828,
-      45,  -828,   650,   -12,  -828,   654,   559,   561,   564,   565,
-     569,   570,    62,  -828,   721,   725,   -34,  -828,  -828,  -828,
-     724,   703,    39,  -828,   655,   730,  -828,    70,   656,  -828,
-    -828,   572,  -828,   286,   573,   574,   575,  -828,  -828,  -828,
-    -828,  -828,   576,   580,   581,   583,  -828,  -828,  -828,  -828,
-    -828,  -828,   264,  -828,   266,  -828,   727,  -828,   731,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,   272,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,   734,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,   732,   745,  -828,
-    -828,  -828,  -828,  -828,   741,  -828,   274,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,   584,   589,  -828,  -828,   590,
-     276,  -828,   591,  -828,   746,  -828,  -828,  -828,  -828,  -828,
-     282,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,   582,  -828,   752,   592,  -828,    73,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,   753,   593,   754,    70,
-    -828,  -828,   596,  -828,  -828,   681,  -828,   597,  -828,  -828,
-     755,  -828,  -828,   161,  -828,   -58,   755,  -828,  -828,   759,
-     760,   765,   283,  -828,  -828,  -828,  -828,  -828,  -828,   766,
-     598,   599,   602,   -58,  -828,   604,  -828,  -828,  -828,  -828,
-    -828
+     292,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,    32,    36,    40,    55,    75,
+      83,    92,   114,   123,   133,   156,   164,   200,   217,   228,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,    36,   -18,
+      14,    84,    35,   172,    -4,   404,   100,    49,   252,   -52,
+     484,    88,    58,  -834,   245,   259,   273,   294,   307,  -834,
+    -834,  -834,  -834,  -834,   311,  -834,    41,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,   318,   327,   329,  -834,
+    -834,  -834,  -834,  -834,  -834,   333,   334,   336,   338,   339,
+     342,   343,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,   344,  -834,  -834,  -834,  -834,
+      52,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,   346,  -834,    53,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,   347,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+      69,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,    85,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,   351,   369,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,   366,  -834,  -834,   372,
+    -834,  -834,  -834,   374,  -834,  -834,   371,   377,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,   378,   379,  -834,  -834,  -834,  -834,   383,   384,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,    98,  -834,  -834,  -834,   391,  -834,  -834,   392,  -834,
+     393,   394,  -834,  -834,   397,   398,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,   121,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,   148,  -834,  -834,  -834,   400,   149,  -834,  -834,  -834,
+    -834,    36,    36,  -834,   230,   405,   406,   407,   408,   410,
+    -834,    14,  -834,   411,   412,   416,   242,   250,   256,   421,
+     433,   440,   441,   448,   465,   295,   297,   298,   299,   229,
+     291,   300,   468,   473,   476,   477,   478,   479,   480,   481,
+     482,   485,   486,   487,   488,   315,   490,   491,   492,    84,
+    -834,   493,   495,   496,   321,    35,  -834,   498,   499,   506,
+     508,   509,   510,   337,   512,   513,   514,   172,  -834,   515,
+      -4,  -834,   516,   517,   518,   519,   520,   522,   523,   525,
+    -834,   404,  -834,   526,   528,   355,   530,   531,   532,   357,
+    -834,    49,   534,   359,   360,  -834,   252,   537,   538,   139,
+    -834,   363,   541,   542,   370,   543,   375,   376,   545,   546,
+     380,   381,   548,   551,   552,   554,   484,  -834,   558,    88,
+    -834,   560,   387,    58,  -834,  -834,  -834,   562,   564,   566,
+      36,    36,    36,  -834,   567,   568,   569,  -834,  -834,  -834,
+     401,   402,   403,   570,   575,   578,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,   409,   579,   580,   583,   585,   616,   449,
+     264,   620,   622,   623,   624,   625,  -834,   626,   616,   627,
+    -834,   630,   248,   269,  -834,  -834,   459,   460,   461,   634,
+     463,   464,  -834,   630,   466,   635,  -834,   467,  -834,   630,
+     469,   470,   471,   472,   474,   475,   483,  -834,   489,   494,
+    -834,   497,   500,   501,  -834,  -834,   502,  -834,  -834,  -834,
+     503,    36,  -834,  -834,   504,   505,  -834,   507,  -834,  -834,
+      11,   140,  -834,  -834,    37,   511,   521,   524,  -834,   640,
+    -834,   645,  -834,  -834,    36,    84,    88,  -834,  -834,  -834,
+      58,    35,   629,  -834,  -834,  -834,   553,   553,   647,  -834,
+     648,   649,   650,   651,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,   118,   652,   655,   656,    71,   -19,  -834,   484,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,   657,  -834,  -834,  -834,  -834,   213,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,   658,   647,  -834,   152,   158,   162,   202,  -834,
+     203,  -834,  -834,  -834,  -834,  -834,  -834,   565,   663,   664,
+     665,   666,   668,  -834,  -834,  -834,  -834,   669,   671,   672,
+     679,   681,  -834,   219,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,   233,  -834,   680,   684,  -834,
+    -834,   683,   687,  -834,  -834,   685,   689,  -834,  -834,   688,
+     690,  -834,  -834,   691,   692,  -834,  -834,  -834,  -834,  -834,
+    -834,    78,  -834,  -834,  -834,  -834,  -834,  -834,  -834,   102,
+    -834,  -834,   693,   697,  -834,  -834,   696,   700,  -834,   701,
+     702,   703,   704,   705,   706,   240,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,   707,  -834,  -834,  -834,   244,
+    -834,  -834,  -834,  -834,   260,   527,  -834,   708,   709,  -834,
+    -834,  -834,  -834,   710,  -834,   189,  -834,   711,  -834,  -834,
+    -834,  -834,   712,   629,  -834,   715,   716,   717,   718,   535,
+     544,   547,   549,   555,   550,   719,   722,   723,   727,   556,
+     559,   561,   563,   571,   553,  -834,  -834,   553,  -834,   647,
+     172,  -834,   648,    49,  -834,   649,   252,  -834,   650,   246,
+    -834,   651,   118,  -834,   216,   652,  -834,   404,  -834,   655,
+     -52,  -834,   656,   572,   574,   576,   577,   581,   582,    71,
+    -834,   728,   729,   584,   -19,  -834,  -834,  -834,   730,   735,
+      -4,  -834,   657,   736,  -834,   211,   658,  -834,  -834,   586,
+    -834,   331,   587,   588,   589,  -834,  -834,  -834,  -834,  -834,
+    -834,   590,   591,   592,   593,  -834,  -834,  -834,  -834,  -834,
+    -834,   261,  -834,   276,  -834,   734,  -834,   737,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,   280,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,   739,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,   738,   741,  -834,  -834,
+    -834,  -834,  -834,   740,  -834,   288,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,   594,   595,  -834,  -834,  -834,   596,
+     289,  -834,   630,  -834,   743,  -834,  -834,  -834,  -834,  -834,
+     290,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,   246,  -834,   745,   573,  -834,   216,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,   752,   597,   753,   211,
+    -834,  -834,   599,  -834,  -834,   756,  -834,   600,  -834,  -834,
+     751,  -834,  -834,   222,  -834,   -20,   751,  -834,  -834,   770,
+     774,   775,   777,   778,  -834,   306,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,   780,   605,   609,   614,   615,
+     628,   794,   -20,  -834,   632,  -834,  -834,  -834,  -834,  -834,
+     636,  -834,  -834,  -834
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,    24,    26,    28,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    45,    38,    34,    33,    30,    31,    32,    37,     3,
-      35,    36,    58,     5,    70,     7,   134,     9,   277,    11,
-     438,    13,   463,    15,   363,    17,   371,    19,   408,    21,
-     242,    23,   555,    25,   627,    27,   616,    29,    47,    41,
-       0,     0,     0,     0,     0,   465,     0,   373,   410,     0,
+      35,    36,    58,     5,    70,     7,   134,     9,   279,    11,
+     440,    13,   465,    15,   365,    17,   373,    19,   410,    21,
+     244,    23,   559,    25,   633,    27,   622,    29,    47,    41,
+       0,     0,     0,     0,     0,   467,     0,   375,   412,     0,
        0,     0,     0,    49,     0,    48,     0,     0,    42,    68,
-     625,   608,   610,   612,     0,    67,     0,    60,    62,    64,
-      65,    66,    63,   614,   123,   149,     0,     0,     0,   484,
-     486,   488,   147,   156,   158,     0,     0,     0,     0,     0,
-       0,     0,   118,   269,   361,   400,   329,   451,   453,   322,
-     220,   512,   455,   234,   253,     0,   538,   551,   553,   110,
+     631,   614,   616,   618,     0,    67,     0,    60,    62,    64,
+      65,    66,    63,   620,   123,   149,     0,     0,     0,   486,
+     488,   490,   147,   156,   158,     0,     0,     0,     0,     0,
+       0,     0,   118,   271,   363,   402,   331,   453,   455,   324,
+     222,   514,   457,   236,   255,     0,   540,   555,   557,   110,
        0,    72,    74,    75,    76,   107,   108,   109,    77,   105,
       94,    95,    96,    80,    81,   102,    82,    83,    84,    88,
       89,    78,   106,    79,    86,    87,   100,   101,   103,    97,
       98,    99,    85,    90,    91,    92,    93,   104,   136,   138,
      142,     0,   133,     0,   125,   127,   128,   129,   130,   131,
-     132,   310,   312,   314,   430,   308,   316,     0,   320,   318,
-     508,   307,   281,   282,   283,   304,   305,   306,   294,   295,
-       0,   279,   286,   299,   300,   301,   287,   289,   290,   292,
-     288,   284,   285,   302,   303,   291,   296,   297,   298,   293,
-     449,   448,   444,   445,   443,     0,   440,   442,   446,   447,
-     506,   494,   496,   500,   498,   504,   502,   490,   483,   477,
-     481,   482,     0,   466,   467,   478,   479,   480,   474,   469,
-     475,   471,   472,   473,   476,   470,     0,   390,   201,     0,
-     394,   392,   397,     0,   386,   387,     0,   374,   375,   377,
-     389,   378,   379,   380,   396,   381,   382,   383,   384,   385,
-     424,     0,     0,   422,   423,   426,   427,     0,   411,   412,
-     414,   415,   416,   417,   418,   419,   420,   421,   249,   251,
-     246,     0,   244,   247,   248,     0,   578,   580,     0,   583,
-       0,     0,   587,   591,     0,     0,   595,   602,   604,   606,
-     576,   574,   575,     0,   557,   559,   560,   561,   562,   563,
-     564,   565,   566,   567,   568,   569,   570,   571,   572,   573,
-     632,     0,   629,   631,   622,     0,     0,   618,   620,   621,
+     132,   312,   314,   316,   432,   310,   318,     0,   322,   320,
+     510,   309,   283,   284,   285,   306,   307,   308,   296,   297,
+       0,   281,   288,   301,   302,   303,   289,   291,   292,   294,
+     290,   286,   287,   304,   305,   293,   298,   299,   300,   295,
+     451,   450,   446,   447,   445,     0,   442,   444,   448,   449,
+     508,   496,   498,   502,   500,   506,   504,   492,   485,   479,
+     483,   484,     0,   468,   469,   480,   481,   482,   476,   471,
+     477,   473,   474,   475,   478,   472,     0,   392,   202,     0,
+     396,   394,   399,     0,   388,   389,     0,   376,   377,   379,
+     391,   380,   381,   382,   398,   383,   384,   385,   386,   387,
+     426,     0,     0,   424,   425,   428,   429,     0,   413,   414,
+     416,   417,   418,   419,   420,   421,   422,   423,   251,   253,
+     248,     0,   246,   249,   250,     0,   582,   584,     0,   587,
+       0,     0,   591,   595,     0,     0,   601,   608,   610,   612,
+     580,   578,   579,     0,   561,   563,   564,   565,   566,   567,
+     568,   569,   570,   571,   572,   573,   574,   575,   576,   577,
+     638,     0,   635,   637,   628,     0,     0,   624,   626,   627,
       46,     0,     0,    39,     0,     0,     0,     0,     0,     0,
       57,     0,    59,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
       71,     0,     0,     0,     0,     0,   135,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   278,     0,
-       0,   439,     0,     0,     0,     0,     0,     0,     0,     0,
-     464,     0,   364,     0,     0,     0,     0,     0,     0,     0,
-     372,     0,     0,     0,     0,   409,     0,     0,     0,     0,
-     243,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   556,     0,     0,
-     628,     0,     0,     0,   617,    50,    43,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   280,     0,
+       0,   441,     0,     0,     0,     0,     0,     0,     0,     0,
+     466,     0,   366,     0,     0,     0,     0,     0,     0,     0,
+     374,     0,     0,     0,     0,   411,     0,     0,     0,     0,
+     245,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   560,     0,     0,
+     634,     0,     0,     0,   623,    50,    43,     0,     0,     0,
        0,     0,     0,    61,     0,     0,     0,   120,   121,   122,
        0,     0,     0,     0,     0,     0,   111,   112,   113,   114,
      115,   116,   117,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   537,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   539,     0,     0,     0,
       73,     0,     0,     0,   146,   126,     0,     0,     0,     0,
-       0,     0,   328,     0,     0,     0,   280,     0,   441,     0,
-       0,     0,     0,     0,     0,     0,     0,   468,     0,     0,
-     388,     0,     0,     0,   399,   376,     0,   428,   429,   413,
-       0,     0,   245,   577,     0,     0,   582,     0,   585,   586,
-       0,     0,   593,   594,     0,     0,     0,     0,   558,     0,
-     630,     0,   624,   619,     0,     0,     0,   609,   611,   613,
-       0,     0,     0,   485,   487,   489,     0,     0,   160,   119,
-     271,   365,   402,   331,    40,   452,   454,   324,   325,   326,
-     327,   323,     0,     0,   457,   236,     0,     0,   552,     0,
-      51,   137,   140,   141,   139,   144,   145,   143,   311,   313,
-     315,   432,   309,   317,   321,   319,     0,   450,   507,   495,
-     497,   501,   499,   505,   503,   491,   391,   202,   395,   393,
-     398,   425,   250,   252,   579,   581,   584,   589,   590,   588,
-     592,   597,   598,   599,   600,   601,   596,   603,   605,   607,
-       0,   160,    44,     0,     0,     0,     0,   154,     0,   151,
-     153,   188,   194,   196,   198,     0,     0,     0,     0,     0,
-     210,   212,   214,   216,     0,     0,     0,     0,     0,   187,
-       0,   166,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   181,   182,   183,   178,   184,   185,   186,   179,
-     180,     0,   164,     0,   161,   162,   275,     0,   272,   273,
-     369,     0,   366,   367,   406,     0,   403,   404,   335,     0,
-     332,   333,   229,   230,   231,   232,   233,     0,   222,   224,
-     225,   226,   227,   228,   516,     0,   514,   461,     0,   458,
-     459,   240,     0,   237,   238,     0,     0,     0,     0,     0,
-       0,     0,   255,   257,   258,   259,   260,   261,   262,   547,
-     549,   546,   544,   545,     0,   540,   542,   543,     0,    53,
-     436,     0,   433,   434,   492,   510,   511,     0,   636,     0,
-     634,     0,    69,   626,   615,   124,     0,     0,   150,     0,
+       0,     0,   330,     0,     0,     0,   282,     0,   443,     0,
+       0,     0,     0,     0,     0,     0,     0,   470,     0,     0,
+     390,     0,     0,     0,   401,   378,     0,   430,   431,   415,
+       0,     0,   247,   581,     0,     0,   586,     0,   589,   590,
+       0,     0,   599,   600,     0,     0,     0,     0,   562,     0,
+     636,     0,   630,   625,     0,     0,     0,   615,   617,   619,
+       0,     0,     0,   487,   489,   491,     0,     0,   160,   119,
+     273,   367,   404,   333,    40,   454,   456,   326,   327,   328,
+     329,   325,     0,     0,   459,   238,     0,     0,   556,     0,
+      51,   137,   140,   141,   139,   144,   145,   143,   313,   315,
+     317,   434,   311,   319,   323,   321,     0,   452,   509,   497,
+     499,   503,   501,   507,   505,   493,   393,   203,   397,   395,
+     400,   427,   252,   254,   583,   585,   588,   593,   594,   592,
+     597,   598,   596,   603,   604,   605,   606,   607,   602,   609,
+     611,   613,     0,   160,    44,     0,     0,     0,     0,   154,
+       0,   151,   153,   189,   195,   197,   199,     0,     0,     0,
+       0,     0,     0,   212,   214,   216,   218,     0,     0,     0,
+       0,     0,   188,     0,   166,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,   182,   183,   184,   179,
+     185,   186,   187,   180,   181,     0,   164,     0,   161,   162,
+     277,     0,   274,   275,   371,     0,   368,   369,   408,     0,
+     405,   406,   337,     0,   334,   335,   231,   232,   233,   234,
+     235,     0,   224,   226,   227,   228,   229,   230,   518,     0,
+     516,   463,     0,   460,   461,   242,     0,   239,   240,     0,
+       0,     0,     0,     0,     0,     0,   257,   259,   260,   261,
+     262,   263,   264,   550,   552,     0,   549,   547,   548,     0,
+     542,   544,   545,   546,     0,    53,   438,     0,   435,   436,
+     494,   512,   513,     0,   642,     0,   640,     0,    69,   632,
+     621,   124,     0,     0,   150,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   148,   157,
-       0,   159,     0,     0,   270,     0,   373,   362,     0,   410,
-     401,     0,     0,   330,     0,     0,   221,   518,     0,   513,
-     465,   456,     0,     0,   235,     0,     0,     0,     0,     0,
-       0,     0,     0,   254,     0,     0,     0,   539,   554,    55,
-       0,    54,     0,   431,     0,     0,   509,     0,     0,   633,
-     623,     0,   152,     0,     0,     0,     0,   200,   203,   204,
-     205,   206,     0,     0,     0,     0,   218,   219,   207,   208,
-     209,   167,     0,   163,     0,   274,     0,   368,     0,   405,
-     360,   354,   342,   343,   357,   358,   359,   345,   346,   339,
-     340,   341,   352,   353,   351,     0,   337,   344,   355,   356,
-     347,   348,   349,   350,   334,   223,   534,     0,   532,   533,
-     525,   526,   530,   531,   527,   528,   529,     0,   519,   520,
-     522,   523,   524,   515,     0,   460,     0,   239,   263,   264,
-     265,   266,   267,   268,   256,     0,     0,   541,    52,     0,
-       0,   435,     0,   650,     0,   648,   646,   640,   644,   645,
-       0,   638,   642,   643,   641,   635,   155,   190,   191,   192,
-     193,   189,   195,   197,   199,   211,   213,   215,   217,   165,
-     276,   370,   407,     0,   336,     0,     0,   517,     0,   462,
-     241,   548,   550,    56,   437,   493,     0,     0,     0,     0,
-     637,   338,     0,   536,   521,     0,   647,     0,   639,   535,
-       0,   649,   654,     0,   652,     0,     0,   651,   662,     0,
-       0,     0,     0,   656,   658,   659,   660,   661,   653,     0,
-       0,     0,     0,     0,   655,     0,   664,   665,   666,   657,
-     663
+       0,     0,     0,     0,     0,   148,   157,     0,   159,     0,
+       0,   272,     0,   375,   364,     0,   412,   403,     0,     0,
+     332,     0,     0,   223,   520,     0,   515,   467,   458,     0,
+       0,   237,     0,     0,     0,     0,     0,     0,     0,     0,
+     256,     0,     0,     0,     0,   541,   558,    55,     0,    54,
+       0,   433,     0,     0,   511,     0,     0,   639,   629,     0,
+     152,     0,     0,     0,     0,   201,   204,   205,   206,   207,
+     208,     0,     0,     0,     0,   220,   221,   209,   210,   211,
+     167,     0,   163,     0,   276,     0,   370,     0,   407,   362,
+     356,   344,   345,   359,   360,   361,   347,   348,   341,   342,
+     343,   354,   355,   353,     0,   339,   346,   357,   358,   349,
+     350,   351,   352,   336,   225,   536,     0,   534,   535,   527,
+     528,   532,   533,   529,   530,   531,     0,   521,   522,   524,
+     525,   526,   517,     0,   462,     0,   241,   265,   266,   267,
+     268,   269,   270,   258,     0,     0,   554,   543,    52,     0,
+       0,   437,     0,   656,     0,   654,   652,   646,   650,   651,
+       0,   644,   648,   649,   647,   641,   155,   191,   192,   193,
+     194,   190,   196,   198,   200,   213,   215,   217,   219,   165,
+     278,   372,   409,     0,   338,     0,     0,   519,     0,   464,
+     243,   551,   553,    56,   439,   495,     0,     0,     0,     0,
+     643,   340,     0,   538,   523,     0,   653,     0,   645,   537,
+       0,   655,   660,     0,   658,     0,     0,   657,   671,     0,
+       0,     0,     0,     0,   678,     0,   662,   664,   665,   666,
+     667,   668,   669,   670,   659,     0,     0,     0,     0,     0,
+       0,     0,     0,   661,     0,   673,   674,   675,   676,   677,
+       0,   663,   672,   679
   };
 
   const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,   -31,  -828,  -475,  -828,
-     231,  -828,  -828,  -828,  -828,  -828,  -828,  -519,  -828,  -828,
-    -828,   -70,  -828,  -828,  -828,   406,  -828,  -828,  -828,  -828,
-     109,   369,   -47,   -44,     4,    12,    15,    19,  -828,  -828,
-    -828,  -828,    23,    26,  -828,  -828,   187,   376,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,   -37,  -828,  -828,  -828,  -828,  -828,
-    -828,   117,  -828,   -41,  -828,  -585,   -28,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,   -26,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,   -53,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,   -54,
-    -828,  -828,  -828,   -48,   380,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,   -56,  -828,  -828,  -828,  -828,  -828,  -828,  -827,
-    -828,  -828,  -828,   -23,  -828,  -828,  -828,   -15,   402,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -824,  -828,   -68,
-    -828,   -55,  -828,    27,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,   -22,  -828,  -828,  -179,   -63,  -828,  -828,  -828,  -828,
-    -828,   -13,  -828,  -828,  -828,    -4,  -828,   401,  -828,   -66,
-    -828,  -828,  -828,  -828,  -828,   -64,  -828,  -828,  -828,  -828,
-    -828,   -19,  -828,  -828,  -828,    -5,  -828,  -828,  -828,    10,
-    -828,   388,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,   -11,  -828,  -828,  -828,   -10,   446,  -828,
-    -828,   -57,  -828,   -39,  -828,   -62,  -828,  -828,  -828,    18,
-    -828,  -828,  -828,    14,  -828,   441,    -7,  -828,    -3,  -828,
-       8,  -828,   244,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -821,  -828,  -828,  -828,  -828,  -828,    25,  -828,  -828,  -828,
-    -141,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,     5,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-     255,   410,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,  -828,   285,   405,
-    -828,  -828,  -828,  -828,  -828,  -828,  -828,   291,   413,  -828,
-    -828,  -828,     1,  -828,  -828,  -138,  -828,  -828,  -828,  -828,
-    -828,  -828,  -153,  -828,  -828,  -169,  -828,  -828,  -828,  -828,
-    -828
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,   -43,  -834,  -480,  -834,
+     168,  -834,  -834,  -834,  -834,  -834,  -834,  -521,  -834,  -834,
+    -834,   -70,  -834,  -834,  -834,   432,  -834,  -834,  -834,  -834,
+     120,   415,   -42,   -27,   -10,    13,    16,    19,  -834,  -834,
+    -834,  -834,    23,    24,  -834,  -834,   210,   422,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,    -7,  -834,  -834,  -834,  -834,  -834,
+    -834,   136,  -834,   -13,  -834,  -593,   -14,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,   -25,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+     -21,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+     -30,  -834,  -834,  -834,   -23,   386,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,   -36,  -834,  -834,  -834,  -834,  -834,  -834,
+    -833,  -834,  -834,  -834,     2,  -834,  -834,  -834,    -2,   428,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -829,  -834,
+     -68,  -834,   -55,  -834,    27,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,    -5,  -834,  -834,  -143,   -63,  -834,  -834,  -834,
+    -834,  -834,    26,  -834,  -834,  -834,    34,  -834,   434,  -834,
+     -66,  -834,  -834,  -834,  -834,  -834,   -51,  -834,  -834,  -834,
+    -834,  -834,    -6,  -834,  -834,  -834,    30,  -834,  -834,  -834,
+      33,  -834,   435,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,     3,  -834,  -834,  -834,     4,   462,
+    -834,  -834,   -57,  -834,   -38,  -834,   -62,  -834,  -834,  -834,
+      21,  -834,  -834,  -834,    29,  -834,   452,     0,  -834,     1,
+    -834,    12,  -834,   251,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -826,  -834,  -834,  -834,  -834,  -834,    38,  -834,  -834,
+    -834,  -130,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+      15,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,   271,   425,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+    -834,   302,   423,  -834,  -834,  -834,  -834,  -834,  -834,  -834,
+     308,   426,  -834,  -834,  -834,    17,  -834,  -834,  -132,  -834,
+    -834,  -834,  -834,  -834,  -834,  -148,  -834,  -834,  -173,  -834,
+    -834,  -834,  -834,  -834,  -834,  -834,  -834,  -834
   };
 
   const short
   Dhcp4Parser::yydefgoto_[] =
   {
-      -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+       0,    15,    16,    17,    18,    19,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    38,    39,    40,    69,
-     615,    87,    88,    41,    68,    84,    85,   631,   799,   880,
-     881,   709,    43,    70,    96,    97,    98,   365,    45,    71,
+     615,    87,    88,    41,    68,    84,    85,   631,   805,   888,
+     889,   712,    43,    70,    96,    97,    98,   365,    45,    71,
      140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
      392,   150,   151,   152,   153,   374,   183,   184,    47,    72,
      185,   411,   186,   412,   634,   187,   413,   637,   188,   154,
-     382,   155,   375,   688,   689,   690,   816,   156,   383,   157,
-     384,   733,   734,   735,   840,   710,   711,   712,   819,  1001,
-     713,   820,   714,   821,   715,   822,   716,   717,   444,   718,
-     719,   720,   721,   722,   723,   724,   725,   828,   726,   829,
-     727,   830,   728,   831,   729,   730,   158,   400,   757,   758,
-     759,   760,   761,   762,   763,   159,   403,   772,   773,   774,
-     863,    61,    79,   311,   312,   313,   457,   314,   458,   160,
-     404,   781,   782,   783,   784,   785,   786,   787,   788,   161,
-     393,   737,   738,   739,   843,    49,    73,   210,   211,   212,
-     421,   213,   417,   214,   418,   215,   419,   216,   422,   217,
-     425,   218,   424,   162,   399,   621,   220,   163,   396,   749,
-     750,   751,   852,   935,   936,   164,   394,    55,    76,   741,
-     742,   743,   846,    57,    77,   276,   277,   278,   279,   280,
-     281,   282,   443,   283,   447,   284,   446,   285,   286,   448,
-     287,   165,   395,   745,   746,   747,   849,    59,    78,   297,
-     298,   299,   300,   301,   452,   302,   303,   304,   305,   222,
-     420,   801,   802,   803,   882,    51,    74,   235,   236,   237,
-     429,   166,   397,   167,   398,   168,   402,   768,   769,   770,
-     860,    53,    75,   252,   253,   254,   169,   379,   170,   380,
-     171,   381,   258,   439,   806,   885,   259,   433,   260,   434,
-     261,   436,   262,   435,   263,   438,   264,   437,   265,   432,
-     229,   426,   807,   172,   401,   765,   766,   857,   957,   958,
-     959,   960,   961,  1015,   962,   173,   174,   406,   794,   795,
-     796,   874,   797,   875,   175,   407,   176,   408,    63,    80,
-     333,   334,   335,   336,   462,   337,   463,   338,   339,   465,
-     340,   341,   342,   468,   669,   343,   469,   344,   345,   346,
-     472,   676,   347,   473,   348,   474,   349,   475,    99,   367,
-     100,   368,   101,   369,   177,   373,    67,    82,   356,   357,
-     358,   481,   359,   102,   366,    65,    81,   351,   352,   353,
-     478,   809,   810,   887,   990,   991,   992,   993,  1028,   994,
-    1026,  1043,  1044,  1045,  1052,  1053,  1054,  1059,  1055,  1056,
-    1057
+     382,   155,   375,   690,   691,   692,   822,   156,   383,   157,
+     384,   737,   738,   739,   847,   713,   714,   715,   825,  1011,
+     716,   826,   717,   827,   718,   828,   719,   720,   444,   721,
+     722,   723,   724,   725,   726,   727,   728,   729,   835,   730,
+     836,   731,   837,   732,   838,   733,   734,   158,   400,   761,
+     762,   763,   764,   765,   766,   767,   159,   403,   776,   777,
+     778,   870,    61,    79,   311,   312,   313,   457,   314,   458,
+     160,   404,   785,   786,   787,   788,   789,   790,   791,   792,
+     161,   393,   741,   742,   743,   850,    49,    73,   210,   211,
+     212,   421,   213,   417,   214,   418,   215,   419,   216,   422,
+     217,   425,   218,   424,   162,   399,   621,   220,   163,   396,
+     753,   754,   755,   859,   944,   945,   164,   394,    55,    76,
+     745,   746,   747,   853,    57,    77,   276,   277,   278,   279,
+     280,   281,   282,   443,   283,   447,   284,   446,   285,   286,
+     448,   287,   165,   395,   749,   750,   751,   856,    59,    78,
+     297,   298,   299,   300,   301,   452,   302,   303,   304,   305,
+     222,   420,   807,   808,   809,   890,    51,    74,   235,   236,
+     237,   429,   166,   397,   167,   398,   168,   402,   772,   773,
+     774,   867,    53,    75,   252,   253,   254,   169,   379,   170,
+     380,   171,   381,   258,   439,   812,   893,   259,   433,   260,
+     434,   261,   436,   262,   435,   263,   438,   264,   437,   265,
+     432,   229,   426,   813,   172,   401,   769,   770,   864,   966,
+     967,   968,   969,   970,  1025,   971,   173,   174,   406,   799,
+     800,   801,   881,   802,   882,   803,   175,   407,   176,   408,
+      63,    80,   333,   334,   335,   336,   462,   337,   463,   338,
+     339,   465,   340,   341,   342,   468,   669,   343,   469,   672,
+     344,   345,   346,   472,   678,   347,   473,   348,   474,   349,
+     475,    99,   367,   100,   368,   101,   369,   177,   373,    67,
+      82,   356,   357,   358,   481,   359,   102,   366,    65,    81,
+     351,   352,   353,   478,   815,   816,   895,  1000,  1001,  1002,
+    1003,  1038,  1004,  1036,  1053,  1054,  1055,  1065,  1066,  1067,
+    1075,  1068,  1069,  1070,  1071,  1072,  1073,  1081
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yytable_[] =
   {
       95,   139,   182,   201,   231,   248,   232,   274,   293,   310,
-     330,   225,   295,   266,   296,   189,   223,   238,   250,   233,
-     288,   306,   731,   331,   644,   930,   202,    89,   931,   203,
-     648,   943,    30,   190,   224,   239,   251,    83,   289,   307,
-      31,   332,    32,   614,    33,    42,   667,   855,   127,   128,
-     856,   275,   294,   614,   221,   234,   249,   178,   179,    44,
-     371,   180,   409,    46,   181,   372,   226,   410,   255,    86,
-     227,   415,   256,   109,   110,   111,   416,   204,    48,   427,
-     360,   228,    50,   257,   428,   205,   789,   790,   206,    52,
-    1048,    54,   207,  1049,  1050,  1051,   208,   308,   309,   209,
-     219,   109,   110,   111,   671,   672,   673,   674,   125,    56,
-     752,   753,   754,   755,   125,   756,   858,    58,   430,   859,
-     230,   127,   128,   431,   127,   128,   459,   127,   128,   476,
-     479,   460,    60,   198,   477,   480,   199,    94,   240,   675,
-     268,   124,   125,   268,   241,   242,   243,   244,   245,   246,
-      62,   247,   127,   128,   888,   127,   128,   889,   483,    94,
-      64,   409,    90,   484,  1046,   668,   812,  1047,   946,   947,
-      66,    91,    92,    93,   775,   776,   777,   778,   779,   780,
-     479,   103,   483,   350,   104,   813,   930,   814,    94,   931,
-     354,   355,   943,   105,   361,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   308,   309,    34,    35,    36,    37,
-      94,   632,   633,    94,   247,   804,    94,   983,   415,   984,
-     985,   362,   267,   815,   635,   636,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   817,   124,   837,   124,   125,
-     818,    94,   838,   837,    94,   872,   876,   363,   839,   126,
-     873,   877,   127,   128,   476,   912,   364,   129,   268,   878,
-     269,   270,   130,   131,   271,   272,   273,   837,   132,   427,
-     127,   128,  1009,   370,  1010,  1013,   440,   459,   133,   430,
-    1014,   134,  1020,   376,  1024,  1029,  1063,   441,   135,   136,
-    1030,  1064,   137,   138,   617,   618,   619,   620,   377,   691,
-     378,    95,   385,   386,   692,   693,   694,   695,   696,   697,
-     698,   699,   700,   701,   702,   703,   704,   705,   706,   707,
-     708,   997,   998,   999,  1000,   387,   388,   389,   390,   391,
-     485,   486,   405,   414,   423,   268,   487,   445,   497,   139,
-     449,    94,   442,   450,   451,   182,   453,   454,   455,   456,
-     498,   268,   290,   269,   270,   291,   292,   201,   189,    94,
-     231,   461,   232,   127,   128,   225,   464,   466,   467,   470,
-     223,   248,   471,   238,   482,   233,   190,   488,   489,   490,
-     202,   274,   491,   203,   250,   492,   293,   494,   224,   495,
-     295,   239,   296,   496,   288,   499,   500,   501,   502,   306,
-     503,   504,   251,   505,   509,   506,   330,   507,   221,   508,
-     512,   234,   289,   513,   510,   514,   515,   307,   511,   331,
-     226,   516,   249,   517,   227,   275,   127,   128,   518,   519,
-     294,   204,   520,   521,   255,   228,    94,   332,   256,   205,
-     522,   523,   206,   524,   525,   526,   207,   527,   528,   257,
-     208,   529,    94,   209,   219,   531,   532,   533,   536,   597,
-     598,   599,   534,  1025,   537,   538,   539,   540,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   541,   542,   543,   544,   545,   547,   328,   329,     1,
-       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,   549,   550,   551,   552,   553,   554,   555,
-     556,   558,   559,   561,   562,    94,   563,   560,   566,   570,
-     571,   564,   567,   568,   573,   139,   574,   575,   576,   577,
-     578,   182,   579,   580,   581,   582,   584,   585,   586,   587,
-     663,   583,   589,   591,   189,   594,   107,   108,   109,   110,
-     111,   592,   595,   596,   600,   601,   602,   791,   603,   330,
-     606,   604,   190,   682,   607,   608,   605,   610,   611,   609,
-     792,   612,   331,   613,    32,   616,   115,   116,   117,   118,
-     119,   120,   622,   623,   624,   191,   192,   193,   793,   125,
-     332,   625,   626,   638,   627,   629,   630,   639,   640,   641,
-     194,   642,   127,   128,   195,   196,   197,   129,   107,   108,
-     109,   110,   111,   643,   198,   646,   645,   199,   132,   647,
-     649,   650,   680,   681,   670,   200,   651,   652,   653,   654,
-     655,   687,   732,   736,   740,   656,   657,   658,   115,   116,
-     117,   118,   119,   120,   659,   660,   123,   661,   744,   662,
-     748,   125,   268,   764,   664,   665,   666,   767,   677,   678,
-     679,   771,   800,   808,   127,   128,   823,   196,   824,   129,
-     825,   826,   827,   832,   833,   834,   198,   835,   836,   199,
-     842,   841,   844,   845,   847,   848,  1040,   200,   851,   850,
-     853,    94,   854,   861,   862,   865,   864,   866,   867,   868,
-     869,   870,   871,   884,   683,   883,   979,   879,   890,   886,
-     891,   893,   894,   895,   896,   897,   898,   902,   900,   903,
-     904,   905,   899,   901,   906,   975,   907,   908,   909,   976,
-     978,   968,   910,   969,   982,  1011,   970,   971,  1016,  1012,
-    1017,   972,   973,   996,  1002,  1003,  1004,  1005,  1018,  1019,
-    1027,  1006,  1007,    94,  1008,  1021,  1032,  1035,  1037,   628,
-    1022,  1023,  1042,  1060,  1061,  1036,  1033,  1039,  1041,  1062,
-    1065,  1067,  1066,   201,  1068,  1070,   274,   493,   530,   293,
-     892,   225,   920,   295,   932,   296,   223,   948,   686,   288,
-     248,   535,   306,   310,   950,   938,   202,   933,   811,   203,
-     952,   913,   945,   250,   224,   921,   791,   289,   922,   911,
-     307,   967,   231,   939,   232,   966,   974,   986,   953,   792,
-     275,   251,   915,   294,   221,   238,   929,   233,   914,   546,
-     988,   949,   944,   937,  1031,   917,   226,   793,   951,   572,
-     227,   249,   916,   239,   569,   940,   919,   204,   989,   941,
-     954,   228,   565,   255,   955,   205,   923,   256,   206,   918,
-     942,   987,   207,   234,   924,   956,   208,   925,   257,   209,
-     219,   926,   980,   981,   964,   927,   548,  1034,   928,   934,
-     965,   977,   557,   963,   798,   685,   588,   684,   593,   995,
-     805,  1038,   590,  1058,  1069,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     330,   225,   295,   266,   735,   189,   223,   238,   250,   233,
+     288,   306,   644,   331,    89,    83,   939,   296,   648,   667,
+     940,   202,    30,   952,   190,   224,   239,   251,   614,   289,
+     307,    31,   332,    32,   371,    33,   203,    42,   614,   372,
+     178,   179,   275,   294,   180,   409,   415,   181,   308,   309,
+     410,   416,    44,   204,   127,   128,   125,   221,   234,   249,
+     354,   355,   427,   226,   227,   255,   256,   428,   230,   127,
+     128,   862,    46,   267,   863,   228,   205,   257,   430,   206,
+      48,   198,   207,   431,   199,   103,   208,   209,   104,    50,
+     219,   459,   793,   794,   795,   865,   460,   105,   866,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   127,   128,
+     268,    52,   269,   270,   476,    94,   271,   272,   273,   477,
+      54,  1058,   127,   128,  1059,  1060,  1061,  1062,  1063,  1064,
+      56,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     668,   479,   483,   124,   125,   409,   480,   484,    94,    86,
+     818,   479,    90,    58,   126,   483,   819,   127,   128,   124,
+     820,    60,   129,    94,    91,    92,    93,   130,   131,   673,
+     674,   675,   676,   132,   779,   780,   781,   782,   783,   784,
+     939,    94,   896,   133,   940,   897,   134,   952,   107,   108,
+     109,   110,   111,   135,   136,   415,   823,    62,   137,   138,
+     821,   824,    94,    34,    35,    36,    37,   677,   756,   757,
+     758,   759,   844,   760,    64,  1056,    94,   845,  1057,   115,
+     116,   117,   118,   119,   120,    66,   844,   350,   191,   192,
+     193,   846,   125,   879,   109,   110,   111,   884,   880,   308,
+     309,   360,   885,   194,   921,   127,   128,   195,   196,   197,
+     129,    94,   361,   476,   844,   632,   633,   198,   886,  1019,
+     199,   132,   107,   108,   109,   110,   111,   362,   200,   427,
+     670,   671,   268,  1023,  1020,   124,   125,   268,  1024,   635,
+     636,   459,   430,  1039,   127,   128,  1030,  1034,  1040,   127,
+     128,    95,   363,   115,   116,   117,   118,   119,   120,  1082,
+     364,   123,   955,   956,  1083,   370,   125,   268,   485,   486,
+     247,   810,   376,   268,   290,   269,   270,   291,   292,   127,
+     128,   377,   196,   378,   129,   127,   128,   385,   386,   139,
+     387,   198,   388,   389,   199,   182,   390,   391,   405,    94,
+     414,   423,   200,   617,   618,   619,   620,   201,   189,   440,
+     231,   993,   232,   994,   995,   225,  1007,  1008,  1009,  1010,
+     223,   248,   441,   238,   442,   233,   445,   190,   449,   450,
+     451,   274,   453,   454,   250,   202,   293,   456,    94,   224,
+     295,   455,   239,    94,   288,   461,   464,   466,   467,   306,
+     203,   470,   471,   251,   482,   296,   330,   487,   510,   488,
+     489,   490,   491,   289,   492,   494,   495,   204,   307,   331,
+     496,   221,   497,    94,   234,   500,   275,   226,   227,    94,
+     498,   294,   109,   110,   111,   249,   499,   501,   332,   228,
+     205,   255,   256,   206,   502,   503,   207,   597,   598,   599,
+     208,   209,   504,   257,   219,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,   505,
+     511,  1035,   513,   506,   125,   507,   508,   514,   512,   509,
+     515,   516,   517,   518,   519,   520,   521,   127,   128,   522,
+     523,   524,   525,   526,   527,   528,   529,   531,   240,   532,
+     533,   534,   536,   537,   241,   242,   243,   244,   245,   246,
+     538,   247,   539,   540,   541,   542,   543,   544,   545,   547,
+     549,   550,   551,   552,   553,   139,   554,   555,   663,   556,
+     558,   182,   559,   560,   561,   562,   563,   564,   566,   567,
+     568,   570,   571,   573,   189,   574,   575,   577,   576,   580,
+     581,   684,   584,   578,   579,   585,   586,   796,   587,   330,
+     582,   583,   589,   190,   591,   592,   594,   127,   128,   829,
+     797,   595,   331,   596,   600,   601,   602,   606,   603,   604,
+     605,    94,   607,   608,   610,   611,   609,   693,   612,   798,
+     613,   332,   694,   695,   696,   697,   698,   699,   700,   701,
+     702,   703,   704,   705,   706,   707,   708,   709,   710,   711,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,    32,   268,   622,   616,   623,   624,   625,
+     328,   329,   626,   627,   629,   630,   638,   639,   640,   641,
+     642,   643,   646,   645,   647,   682,   649,   650,   651,   652,
+     683,   653,   654,   689,   736,   740,   744,   748,   752,   768,
+     655,    94,   771,   775,   806,   814,   656,   830,   831,   832,
+     833,   657,   834,   839,   658,   840,   841,   659,   660,   661,
+     662,   664,   665,   842,   666,   843,   848,   849,   679,   851,
+     852,   854,   855,   858,   857,   861,   628,   860,   680,   868,
+     869,   681,   871,   872,   887,   873,   874,   875,   876,   877,
+     878,   883,   892,   905,   891,   685,   899,   898,   894,   901,
+     902,   903,   904,   911,   906,   907,   912,   913,   910,   908,
+      94,   914,   984,   985,   915,   909,   988,   916,   989,   917,
+     992,   918,  1021,  1026,  1028,  1022,  1027,  1037,  1029,  1042,
+     977,   919,   978,  1043,   979,   980,  1045,  1047,  1052,   981,
+     982,  1050,   986,  1006,  1012,  1013,  1014,  1015,  1016,  1017,
+    1018,  1031,  1032,  1033,  1076,  1046,  1049,  1051,  1077,  1078,
+     201,  1079,  1080,   274,  1084,  1085,   293,  1086,   225,   929,
+     295,   941,  1087,   223,   957,  1088,   288,   248,  1090,   306,
+     310,   959,   947,   493,   942,   296,  1089,   961,   202,  1092,
+     250,   688,   224,  1093,   796,   289,   900,   930,   307,   817,
+     231,   948,   232,   203,   530,   996,   962,   797,   275,   251,
+     920,   294,   931,   238,   938,   233,   922,   535,   998,   958,
+     204,   954,   976,   983,   221,   572,   798,   975,   923,   932,
+     226,   227,   239,   946,   924,   546,   953,   999,   960,   949,
+     950,   249,   228,   205,   963,   964,   206,   255,   256,   207,
+     997,   951,   933,   208,   209,   934,   965,   219,   935,   257,
+    1041,   926,   936,   937,   234,   565,   943,   925,   928,   927,
+     974,   569,   548,   557,   990,   991,   973,   811,  1044,   987,
+     804,   588,   687,   972,   686,   590,   593,  1048,  1074,  1091,
+       0,     0,     0,  1005,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   920,     0,   932,     0,     0,   948,     0,
-       0,     0,     0,     0,     0,   950,   938,     0,   933,   986,
-       0,   952,     0,     0,     0,     0,   921,     0,     0,   922,
-       0,     0,   988,     0,   939,     0,     0,     0,     0,   953,
-       0,     0,     0,     0,     0,     0,     0,   929,     0,     0,
-     989,     0,   949,     0,   937,     0,     0,     0,     0,   951,
-       0,     0,     0,   987,     0,     0,   940,     0,     0,     0,
-     941,   954,     0,     0,     0,   955,     0,   923,     0,     0,
-       0,   942,     0,     0,     0,   924,   956,     0,   925,     0,
-       0,     0,   926,     0,     0,     0,   927,     0,     0,   928,
-     934
+       0,     0,     0,   929,     0,   941,     0,     0,   957,     0,
+       0,     0,     0,     0,     0,   959,   947,     0,   942,   996,
+       0,   961,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   930,   998,     0,     0,   948,     0,     0,     0,     0,
+     962,     0,     0,     0,     0,     0,   931,     0,   938,     0,
+       0,   999,     0,   958,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   932,   997,     0,     0,   946,     0,     0,
+       0,     0,   960,   949,   950,     0,     0,     0,   963,   964,
+       0,     0,     0,     0,     0,   951,   933,     0,     0,   934,
+     965,     0,   935,     0,     0,     0,   936,   937,     0,     0,
+     943
   };
 
   const short
   Dhcp4Parser::yycheck_[] =
   {
       70,    71,    72,    73,    74,    75,    74,    77,    78,    79,
-      80,    73,    78,    76,    78,    72,    73,    74,    75,    74,
-      77,    78,   607,    80,   543,   852,    73,    10,   852,    73,
-     549,   852,     0,    72,    73,    74,    75,    68,    77,    78,
-       5,    80,     7,   518,     9,     7,    18,     3,    82,    83,
-       6,    77,    78,   528,    73,    74,    75,    15,    16,     7,
-       3,    19,     3,     7,    22,     8,    73,     8,    75,   171,
-      73,     3,    75,    28,    29,    30,     8,    73,     7,     3,
-       6,    73,     7,    75,     8,    73,   120,   121,    73,     7,
-     148,     7,    73,   151,   152,   153,    73,   109,   110,    73,
-      73,    28,    29,    30,   139,   140,   141,   142,    69,     7,
-      99,   100,   101,   102,    69,   104,     3,     7,     3,     6,
-      81,    82,    83,     8,    82,    83,     3,    82,    83,     3,
-       3,     8,     7,    94,     8,     8,    97,   171,    93,   174,
-      70,    68,    69,    70,    99,   100,   101,   102,   103,   104,
-       7,   106,    82,    83,     3,    82,    83,     6,     3,   171,
-       7,     3,   145,     8,     3,   137,     8,     6,    95,    96,
-       7,   154,   155,   156,   112,   113,   114,   115,   116,   117,
-       3,    11,     3,   146,    14,     8,  1013,     8,   171,  1013,
-      12,    13,  1013,    23,     3,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,   109,   110,   171,   172,   173,   174,
-     171,    17,    18,   171,   106,   107,   171,   147,     3,   149,
-     150,     4,    34,     8,    20,    21,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,     3,    68,     3,    68,    69,
-       8,   171,     8,     3,   171,     3,     3,     8,     8,    79,
-       8,     8,    82,    83,     3,   840,     3,    87,    70,     8,
-      72,    73,    92,    93,    76,    77,    78,     3,    98,     3,
-      82,    83,     8,     4,     8,     3,     8,     3,   108,     3,
-       8,   111,     8,     4,     8,     3,     3,     3,   118,   119,
-       8,     8,   122,   123,    88,    89,    90,    91,     4,    34,
-       4,   371,     4,     4,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    35,    36,    37,    38,     4,     4,     4,     4,     4,
-     361,   362,     4,     4,     4,    70,   171,     4,   174,   409,
-       4,   171,     8,     8,     3,   415,     4,     4,     8,     3,
-     174,    70,    71,    72,    73,    74,    75,   427,   415,   171,
-     430,     4,   430,    82,    83,   427,     4,     4,     4,     4,
-     427,   441,     4,   430,     4,   430,   415,     4,     4,     4,
-     427,   451,     4,   427,   441,     4,   456,     4,   427,     4,
-     456,   430,   456,     4,   451,   174,     4,     4,     4,   456,
-       4,     4,   441,     4,   174,   172,   476,   172,   427,   172,
-     172,   430,   451,     4,   173,     4,     4,   456,   173,   476,
-     427,     4,   441,     4,   427,   451,    82,    83,     4,     4,
-     456,   427,     4,     4,   441,   427,   171,   476,   441,   427,
-       4,     4,   427,     4,     4,   172,   427,     4,     4,   441,
-     427,     4,   171,   427,   427,     4,     4,     4,     4,   490,
-     491,   492,   174,   982,     4,     4,     4,     4,   124,   125,
+      80,    73,    78,    76,   607,    72,    73,    74,    75,    74,
+      77,    78,   543,    80,    10,    68,   859,    78,   549,    18,
+     859,    73,     0,   859,    72,    73,    74,    75,   518,    77,
+      78,     5,    80,     7,     3,     9,    73,     7,   528,     8,
+      15,    16,    77,    78,    19,     3,     3,    22,   110,   111,
+       8,     8,     7,    73,    83,    84,    70,    73,    74,    75,
+      12,    13,     3,    73,    73,    75,    75,     8,    82,    83,
+      84,     3,     7,    34,     6,    73,    73,    75,     3,    73,
+       7,    95,    73,     8,    98,    11,    73,    73,    14,     7,
+      73,     3,   121,   122,   123,     3,     8,    23,     6,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    83,    84,
+      71,     7,    73,    74,     3,   177,    77,    78,    79,     8,
+       7,   151,    83,    84,   154,   155,   156,   157,   158,   159,
+       7,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+     139,     3,     3,    69,    70,     3,     8,     8,   177,   177,
+       8,     3,   148,     7,    80,     3,     8,    83,    84,    69,
+       8,     7,    88,   177,   160,   161,   162,    93,    94,   142,
+     143,   144,   145,    99,   113,   114,   115,   116,   117,   118,
+    1023,   177,     3,   109,  1023,     6,   112,  1023,    26,    27,
+      28,    29,    30,   119,   120,     3,     3,     7,   124,   125,
+       8,     8,   177,   177,   178,   179,   180,   180,   100,   101,
+     102,   103,     3,   105,     7,     3,   177,     8,     6,    57,
+      58,    59,    60,    61,    62,     7,     3,   149,    66,    67,
+      68,     8,    70,     3,    28,    29,    30,     3,     8,   110,
+     111,     6,     8,    81,   847,    83,    84,    85,    86,    87,
+      88,   177,     3,     3,     3,    17,    18,    95,     8,     8,
+      98,    99,    26,    27,    28,    29,    30,     4,   106,     3,
+     140,   141,    71,     3,     8,    69,    70,    71,     8,    20,
+      21,     3,     3,     3,    83,    84,     8,     8,     8,    83,
+      84,   371,     8,    57,    58,    59,    60,    61,    62,     3,
+       3,    65,    96,    97,     8,     4,    70,    71,   361,   362,
+     107,   108,     4,    71,    72,    73,    74,    75,    76,    83,
+      84,     4,    86,     4,    88,    83,    84,     4,     4,   409,
+       4,    95,     4,     4,    98,   415,     4,     4,     4,   177,
+       4,     4,   106,    89,    90,    91,    92,   427,   415,     8,
+     430,   150,   430,   152,   153,   427,    35,    36,    37,    38,
+     427,   441,     3,   430,     8,   430,     4,   415,     4,     8,
+       3,   451,     4,     4,   441,   427,   456,     3,   177,   427,
+     456,     8,   430,   177,   451,     4,     4,     4,     4,   456,
+     427,     4,     4,   441,     4,   456,   476,   177,   179,     4,
+       4,     4,     4,   451,     4,     4,     4,   427,   456,   476,
+       4,   427,   180,   177,   430,     4,   451,   427,   427,   177,
+     180,   456,    28,    29,    30,   441,   180,     4,   476,   427,
+     427,   441,   441,   427,     4,     4,   427,   490,   491,   492,
+     427,   427,     4,   441,   427,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,     4,
+     179,   992,     4,   178,    70,   178,   178,     4,   178,   180,
+       4,     4,     4,     4,     4,     4,     4,    83,    84,     4,
+       4,     4,     4,   178,     4,     4,     4,     4,    94,     4,
+       4,   180,     4,     4,   100,   101,   102,   103,   104,   105,
+       4,   107,     4,     4,     4,   178,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   595,     4,     4,   571,     4,
+       4,   601,     4,   178,     4,     4,     4,   180,     4,   180,
+     180,     4,     4,   180,   601,     4,     4,     4,   178,     4,
+       4,   594,     4,   178,   178,     4,     4,   627,     4,   629,
+     180,   180,     4,   601,     4,   178,     4,    83,    84,     4,
+     627,     7,   629,     7,     7,     7,     7,     7,   177,   177,
+     177,   177,     7,     5,     5,     5,   177,    34,     5,   627,
+       5,   629,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
      126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     136,     4,   172,     4,     4,     4,     4,   143,   144,   157,
-     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
-     168,   169,   170,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   171,     4,   172,     4,     4,
-       4,   174,   174,   174,   174,   595,     4,     4,   172,     4,
-     172,   601,   172,     4,     4,   174,     4,     4,     4,     4,
-     571,   174,     4,     4,   601,     4,    26,    27,    28,    29,
-      30,   172,     7,     7,     7,     7,     7,   627,   171,   629,
-       7,   171,   601,   594,     7,     5,   171,     5,     5,   171,
-     627,     5,   629,     5,     7,   171,    56,    57,    58,    59,
-      60,    61,     5,     5,     5,    65,    66,    67,   627,    69,
-     629,     5,     7,   171,     7,     7,     5,   171,   171,     5,
-      80,   171,    82,    83,    84,    85,    86,    87,    26,    27,
-      28,    29,    30,   171,    94,     7,   171,    97,    98,   171,
-     171,   171,     5,     5,   138,   105,   171,   171,   171,   171,
-     171,    24,     7,     7,     7,   171,   171,   171,    56,    57,
-      58,    59,    60,    61,   171,   171,    64,   171,     7,   171,
-       7,    69,    70,     7,   171,   171,   171,     7,   171,   171,
-     171,     7,     7,     7,    82,    83,     4,    85,     4,    87,
-       4,     4,     4,     4,     4,     4,    94,     4,     4,    97,
-       3,     6,     6,     3,     6,     3,     5,   105,     3,     6,
-       6,   171,     3,     6,     3,     3,     6,     4,     4,     4,
-       4,     4,     4,     3,   595,     6,     3,   171,     6,     8,
-       4,     4,     4,     4,     4,   172,   174,     4,   174,     4,
-       4,     4,   172,   172,   172,     4,   172,   172,   172,     4,
-       6,   172,   174,   172,     4,     8,   172,   172,     4,     8,
-       8,   172,   172,   171,   171,   171,   171,   171,     3,     8,
-       4,   171,   171,   171,   171,   171,     4,     4,     4,   528,
-     171,   171,     7,     4,     4,   172,   174,   171,   171,     4,
-       4,   172,   174,   843,   172,   171,   846,   371,   409,   849,
-     817,   843,   852,   849,   852,   849,   843,   857,   601,   846,
-     860,   415,   849,   863,   857,   852,   843,   852,   681,   843,
-     857,   842,   855,   860,   843,   852,   876,   846,   852,   837,
-     849,   865,   882,   852,   882,   863,   872,   887,   857,   876,
-     846,   860,   845,   849,   843,   882,   852,   882,   843,   427,
-     887,   857,   854,   852,  1013,   848,   843,   876,   857,   459,
-     843,   860,   846,   882,   456,   852,   851,   843,   887,   852,
-     857,   843,   451,   860,   857,   843,   852,   860,   843,   849,
-     852,   887,   843,   882,   852,   857,   843,   852,   860,   843,
-     843,   852,   882,   884,   860,   852,   430,  1018,   852,   852,
-     862,   876,   441,   858,   629,   600,   476,   596,   483,   888,
-     646,  1029,   479,  1046,  1063,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,   138,     7,    71,     5,   177,     5,     5,     5,
+     146,   147,     7,     7,     7,     5,   177,   177,   177,     5,
+     177,   177,     7,   177,   177,     5,   177,   177,   177,   177,
+       5,   177,   177,    24,     7,     7,     7,     7,     7,     7,
+     177,   177,     7,     7,     7,     7,   177,     4,     4,     4,
+       4,   177,     4,     4,   177,     4,     4,   177,   177,   177,
+     177,   177,   177,     4,   177,     4,     6,     3,   177,     6,
+       3,     6,     3,     3,     6,     3,   528,     6,   177,     6,
+       3,   177,     6,     3,   177,     4,     4,     4,     4,     4,
+       4,     4,     3,   178,     6,   595,     4,     6,     8,     4,
+       4,     4,     4,     4,   180,   178,     4,     4,   178,   180,
+     177,     4,     4,     4,   178,   180,     6,   178,     3,   178,
+       4,   178,     8,     4,     3,     8,     8,     4,     8,     4,
+     178,   180,   178,   180,   178,   178,     4,     4,     7,   178,
+     178,     5,   178,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   177,     4,   178,   177,   177,     4,     4,
+     850,     4,     4,   853,     4,   180,   856,   178,   850,   859,
+     856,   859,   178,   850,   864,   180,   853,   867,     4,   856,
+     870,   864,   859,   371,   859,   856,   178,   864,   850,   177,
+     867,   601,   850,   177,   884,   853,   823,   859,   856,   683,
+     890,   859,   890,   850,   409,   895,   864,   884,   853,   867,
+     844,   856,   859,   890,   859,   890,   849,   415,   895,   864,
+     850,   862,   872,   879,   850,   459,   884,   870,   850,   859,
+     850,   850,   890,   859,   852,   427,   861,   895,   864,   859,
+     859,   867,   850,   850,   864,   864,   850,   867,   867,   850,
+     895,   859,   859,   850,   850,   859,   864,   850,   859,   867,
+    1023,   855,   859,   859,   890,   451,   859,   853,   858,   856,
+     869,   456,   430,   441,   890,   892,   867,   646,  1028,   884,
+     629,   476,   600,   865,   596,   479,   483,  1039,  1056,  1082,
+      -1,    -1,    -1,   896,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,  1013,    -1,  1013,    -1,    -1,  1018,    -1,
-      -1,    -1,    -1,    -1,    -1,  1018,  1013,    -1,  1013,  1029,
-      -1,  1018,    -1,    -1,    -1,    -1,  1013,    -1,    -1,  1013,
-      -1,    -1,  1029,    -1,  1013,    -1,    -1,    -1,    -1,  1018,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1013,    -1,    -1,
-    1029,    -1,  1018,    -1,  1013,    -1,    -1,    -1,    -1,  1018,
-      -1,    -1,    -1,  1029,    -1,    -1,  1013,    -1,    -1,    -1,
-    1013,  1018,    -1,    -1,    -1,  1018,    -1,  1013,    -1,    -1,
-      -1,  1013,    -1,    -1,    -1,  1013,  1018,    -1,  1013,    -1,
-      -1,    -1,  1013,    -1,    -1,    -1,  1013,    -1,    -1,  1013,
-    1013
+      -1,    -1,    -1,  1023,    -1,  1023,    -1,    -1,  1028,    -1,
+      -1,    -1,    -1,    -1,    -1,  1028,  1023,    -1,  1023,  1039,
+      -1,  1028,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,  1023,  1039,    -1,    -1,  1023,    -1,    -1,    -1,    -1,
+    1028,    -1,    -1,    -1,    -1,    -1,  1023,    -1,  1023,    -1,
+      -1,  1039,    -1,  1028,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1023,  1039,    -1,    -1,  1023,    -1,    -1,
+      -1,    -1,  1028,  1023,  1023,    -1,    -1,    -1,  1028,  1028,
+      -1,    -1,    -1,    -1,    -1,  1023,  1023,    -1,    -1,  1023,
+    1028,    -1,  1023,    -1,    -1,    -1,  1023,  1023,    -1,    -1,
+    1023
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yystos_[] =
   {
-       0,   157,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   176,   177,   178,   179,   180,
-     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
-       0,     5,     7,     9,   171,   172,   173,   174,   191,   192,
-     193,   198,     7,   207,     7,   213,     7,   233,     7,   330,
-       7,   410,     7,   426,     7,   362,     7,   368,     7,   392,
-       7,   306,     7,   483,     7,   530,     7,   521,   199,   194,
-     208,   214,   234,   331,   411,   427,   363,   369,   393,   307,
-     484,   531,   522,   191,   200,   201,   171,   196,   197,    10,
-     145,   154,   155,   156,   171,   206,   209,   210,   211,   513,
-     515,   517,   528,    11,    14,    23,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    56,    57,    58,    59,    60,
-      61,    62,    63,    64,    68,    69,    79,    82,    83,    87,
-      92,    93,    98,   108,   111,   118,   119,   122,   123,   206,
-     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     226,   227,   228,   229,   244,   246,   252,   254,   291,   300,
-     314,   324,   348,   352,   360,   386,   416,   418,   420,   431,
-     433,   435,   458,   470,   471,   479,   481,   519,    15,    16,
-      19,    22,   206,   231,   232,   235,   237,   240,   243,   416,
-     418,    65,    66,    67,    80,    84,    85,    86,    94,    97,
-     105,   206,   217,   218,   219,   220,   221,   222,   227,   228,
-     332,   333,   334,   336,   338,   340,   342,   344,   346,   348,
-     351,   386,   404,   416,   418,   420,   431,   433,   435,   455,
-      81,   206,   344,   346,   386,   412,   413,   414,   416,   418,
-      93,    99,   100,   101,   102,   103,   104,   106,   206,   386,
-     416,   418,   428,   429,   430,   431,   433,   435,   437,   441,
-     443,   445,   447,   449,   451,   453,   360,    34,    70,    72,
-      73,    76,    77,    78,   206,   272,   370,   371,   372,   373,
-     374,   375,   376,   378,   380,   382,   383,   385,   416,   418,
-      71,    74,    75,   206,   272,   374,   380,   394,   395,   396,
-     397,   398,   400,   401,   402,   403,   416,   418,   109,   110,
-     206,   308,   309,   310,   312,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   143,   144,
-     206,   416,   418,   485,   486,   487,   488,   490,   492,   493,
-     495,   496,   497,   500,   502,   503,   504,   507,   509,   511,
-     146,   532,   533,   534,    12,    13,   523,   524,   525,   527,
-       6,     3,     4,     8,     3,   212,   529,   514,   516,   518,
-       4,     3,     8,   520,   230,   247,     4,     4,     4,   432,
-     434,   436,   245,   253,   255,     4,     4,     4,     4,     4,
-       4,     4,   225,   325,   361,   387,   353,   417,   419,   349,
-     292,   459,   421,   301,   315,     4,   472,   480,   482,     3,
-       8,   236,   238,   241,     4,     3,     8,   337,   339,   341,
-     405,   335,   343,     4,   347,   345,   456,     3,     8,   415,
-       3,     8,   454,   442,   444,   448,   446,   452,   450,   438,
-       8,     3,     8,   377,   273,     4,   381,   379,   384,     4,
-       8,     3,   399,     4,     4,     8,     3,   311,   313,     3,
-       8,     4,   489,   491,     4,   494,     4,     4,   498,   501,
-       4,     4,   505,   508,   510,   512,     3,     8,   535,     3,
-       8,   526,     4,     3,     8,   191,   191,   171,     4,     4,
-       4,     4,     4,   210,     4,     4,     4,   174,   174,   174,
-       4,     4,     4,     4,     4,     4,   172,   172,   172,   174,
-     173,   173,   172,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,   172,     4,     4,     4,
-     216,     4,     4,     4,   174,   232,     4,     4,     4,     4,
-       4,     4,   172,     4,     4,     4,   333,     4,   413,     4,
-       4,     4,     4,     4,     4,     4,     4,   430,     4,     4,
-     172,     4,     4,     4,   174,   372,     4,   174,   174,   396,
-       4,     4,   309,   174,     4,     4,   172,     4,   172,   172,
-       4,     4,   174,   174,     4,     4,     4,     4,   486,     4,
-     533,     4,   172,   524,     4,     7,     7,   191,   191,   191,
-       7,     7,     7,   171,   171,   171,     7,     7,     5,   171,
-       5,     5,     5,     5,   193,   195,   171,    88,    89,    90,
-      91,   350,     5,     5,     5,     5,     7,     7,   195,     7,
-       5,   202,    17,    18,   239,    20,    21,   242,   171,   171,
-     171,     5,   171,   171,   202,   171,     7,   171,   202,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   191,   171,   171,   171,    18,   137,   499,
-     138,   139,   140,   141,   142,   174,   506,   171,   171,   171,
-       5,     5,   191,   215,   532,   523,   231,    24,   248,   249,
-     250,    34,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,   206,
-     260,   261,   262,   265,   267,   269,   271,   272,   274,   275,
-     276,   277,   278,   279,   280,   281,   283,   285,   287,   289,
-     290,   260,     7,   256,   257,   258,     7,   326,   327,   328,
-       7,   364,   365,   366,     7,   388,   389,   390,     7,   354,
-     355,   356,    99,   100,   101,   102,   104,   293,   294,   295,
-     296,   297,   298,   299,     7,   460,   461,     7,   422,   423,
-     424,     7,   302,   303,   304,   112,   113,   114,   115,   116,
-     117,   316,   317,   318,   319,   320,   321,   322,   323,   120,
-     121,   206,   416,   418,   473,   474,   475,   477,   485,   203,
-       7,   406,   407,   408,   107,   437,   439,   457,     7,   536,
-     537,   256,     8,     8,     8,     8,   251,     3,     8,   263,
-     266,   268,   270,     4,     4,     4,     4,     4,   282,   284,
-     286,   288,     4,     4,     4,     4,     4,     3,     8,     8,
-     259,     6,     3,   329,     6,     3,   367,     6,     3,   391,
-       6,     3,   357,     6,     3,     3,     6,   462,     3,     6,
-     425,     6,     3,   305,     6,     3,     4,     4,     4,     4,
-       4,     4,     3,     8,   476,   478,     3,     8,     8,   171,
-     204,   205,   409,     6,     3,   440,     8,   538,     3,     6,
-       6,     4,   249,     4,     4,     4,     4,   172,   174,   172,
-     174,   172,     4,     4,     4,     4,   172,   172,   172,   172,
-     174,   261,   260,   258,   332,   328,   370,   366,   394,   390,
-     206,   217,   218,   219,   220,   221,   222,   227,   228,   272,
-     324,   342,   344,   346,   348,   358,   359,   386,   416,   418,
-     431,   433,   435,   455,   356,   294,    95,    96,   206,   272,
-     360,   386,   416,   418,   431,   433,   435,   463,   464,   465,
-     466,   467,   469,   461,   428,   424,   308,   304,   172,   172,
-     172,   172,   172,   172,   317,     4,     4,   474,     6,     3,
-     412,   408,     4,   147,   149,   150,   206,   272,   416,   418,
-     539,   540,   541,   542,   544,   537,   171,    35,    36,    37,
-      38,   264,   171,   171,   171,   171,   171,   171,   171,     8,
-       8,     8,     8,     3,     8,   468,     4,     8,     3,     8,
-       8,   171,   171,   171,     8,   202,   545,     4,   543,     3,
-       8,   359,     4,   174,   465,     4,   172,     4,   540,   171,
-       5,   171,     7,   546,   547,   548,     3,     6,   148,   151,
-     152,   153,   549,   550,   551,   553,   554,   555,   547,   552,
-       4,     4,     4,     3,     8,     4,   174,   172,   172,   550,
-     171
+       0,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+       0,     5,     7,     9,   177,   178,   179,   180,   197,   198,
+     199,   204,     7,   213,     7,   219,     7,   239,     7,   337,
+       7,   417,     7,   433,     7,   369,     7,   375,     7,   399,
+       7,   313,     7,   491,     7,   539,     7,   530,   205,   200,
+     214,   220,   240,   338,   418,   434,   370,   376,   400,   314,
+     492,   540,   531,   197,   206,   207,   177,   202,   203,    10,
+     148,   160,   161,   162,   177,   212,   215,   216,   217,   522,
+     524,   526,   537,    11,    14,    23,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    69,    70,    80,    83,    84,    88,
+      93,    94,    99,   109,   112,   119,   120,   124,   125,   212,
+     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
+     232,   233,   234,   235,   250,   252,   258,   260,   298,   307,
+     321,   331,   355,   359,   367,   393,   423,   425,   427,   438,
+     440,   442,   465,   477,   478,   487,   489,   528,    15,    16,
+      19,    22,   212,   237,   238,   241,   243,   246,   249,   423,
+     425,    66,    67,    68,    81,    85,    86,    87,    95,    98,
+     106,   212,   223,   224,   225,   226,   227,   228,   233,   234,
+     339,   340,   341,   343,   345,   347,   349,   351,   353,   355,
+     358,   393,   411,   423,   425,   427,   438,   440,   442,   462,
+      82,   212,   351,   353,   393,   419,   420,   421,   423,   425,
+      94,   100,   101,   102,   103,   104,   105,   107,   212,   393,
+     423,   425,   435,   436,   437,   438,   440,   442,   444,   448,
+     450,   452,   454,   456,   458,   460,   367,    34,    71,    73,
+      74,    77,    78,    79,   212,   278,   377,   378,   379,   380,
+     381,   382,   383,   385,   387,   389,   390,   392,   423,   425,
+      72,    75,    76,   212,   278,   381,   387,   401,   402,   403,
+     404,   405,   407,   408,   409,   410,   423,   425,   110,   111,
+     212,   315,   316,   317,   319,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   146,   147,
+     212,   423,   425,   493,   494,   495,   496,   498,   500,   501,
+     503,   504,   505,   508,   511,   512,   513,   516,   518,   520,
+     149,   541,   542,   543,    12,    13,   532,   533,   534,   536,
+       6,     3,     4,     8,     3,   218,   538,   523,   525,   527,
+       4,     3,     8,   529,   236,   253,     4,     4,     4,   439,
+     441,   443,   251,   259,   261,     4,     4,     4,     4,     4,
+       4,     4,   231,   332,   368,   394,   360,   424,   426,   356,
+     299,   466,   428,   308,   322,     4,   479,   488,   490,     3,
+       8,   242,   244,   247,     4,     3,     8,   344,   346,   348,
+     412,   342,   350,     4,   354,   352,   463,     3,     8,   422,
+       3,     8,   461,   449,   451,   455,   453,   459,   457,   445,
+       8,     3,     8,   384,   279,     4,   388,   386,   391,     4,
+       8,     3,   406,     4,     4,     8,     3,   318,   320,     3,
+       8,     4,   497,   499,     4,   502,     4,     4,   506,   509,
+       4,     4,   514,   517,   519,   521,     3,     8,   544,     3,
+       8,   535,     4,     3,     8,   197,   197,   177,     4,     4,
+       4,     4,     4,   216,     4,     4,     4,   180,   180,   180,
+       4,     4,     4,     4,     4,     4,   178,   178,   178,   180,
+     179,   179,   178,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,   178,     4,     4,     4,
+     222,     4,     4,     4,   180,   238,     4,     4,     4,     4,
+       4,     4,   178,     4,     4,     4,   340,     4,   420,     4,
+       4,     4,     4,     4,     4,     4,     4,   437,     4,     4,
+     178,     4,     4,     4,   180,   379,     4,   180,   180,   403,
+       4,     4,   316,   180,     4,     4,   178,     4,   178,   178,
+       4,     4,   180,   180,     4,     4,     4,     4,   494,     4,
+     542,     4,   178,   533,     4,     7,     7,   197,   197,   197,
+       7,     7,     7,   177,   177,   177,     7,     7,     5,   177,
+       5,     5,     5,     5,   199,   201,   177,    89,    90,    91,
+      92,   357,     5,     5,     5,     5,     7,     7,   201,     7,
+       5,   208,    17,    18,   245,    20,    21,   248,   177,   177,
+     177,     5,   177,   177,   208,   177,     7,   177,   208,   177,
+     177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   197,   177,   177,   177,    18,   139,   507,
+     140,   141,   510,   142,   143,   144,   145,   180,   515,   177,
+     177,   177,     5,     5,   197,   221,   541,   532,   237,    24,
+     254,   255,   256,    34,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,   212,   266,   267,   268,   271,   273,   275,   277,
+     278,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     290,   292,   294,   296,   297,   266,     7,   262,   263,   264,
+       7,   333,   334,   335,     7,   371,   372,   373,     7,   395,
+     396,   397,     7,   361,   362,   363,   100,   101,   102,   103,
+     105,   300,   301,   302,   303,   304,   305,   306,     7,   467,
+     468,     7,   429,   430,   431,     7,   309,   310,   311,   113,
+     114,   115,   116,   117,   118,   323,   324,   325,   326,   327,
+     328,   329,   330,   121,   122,   123,   212,   423,   425,   480,
+     481,   482,   484,   486,   493,   209,     7,   413,   414,   415,
+     108,   444,   446,   464,     7,   545,   546,   262,     8,     8,
+       8,     8,   257,     3,     8,   269,   272,   274,   276,     4,
+       4,     4,     4,     4,     4,   289,   291,   293,   295,     4,
+       4,     4,     4,     4,     3,     8,     8,   265,     6,     3,
+     336,     6,     3,   374,     6,     3,   398,     6,     3,   364,
+       6,     3,     3,     6,   469,     3,     6,   432,     6,     3,
+     312,     6,     3,     4,     4,     4,     4,     4,     4,     3,
+       8,   483,   485,     4,     3,     8,     8,   177,   210,   211,
+     416,     6,     3,   447,     8,   547,     3,     6,     6,     4,
+     255,     4,     4,     4,     4,   178,   180,   178,   180,   180,
+     178,     4,     4,     4,     4,   178,   178,   178,   178,   180,
+     267,   266,   264,   339,   335,   377,   373,   401,   397,   212,
+     223,   224,   225,   226,   227,   228,   233,   234,   278,   331,
+     349,   351,   353,   355,   365,   366,   393,   423,   425,   438,
+     440,   442,   462,   363,   301,    96,    97,   212,   278,   367,
+     393,   423,   425,   438,   440,   442,   470,   471,   472,   473,
+     474,   476,   468,   435,   431,   315,   311,   178,   178,   178,
+     178,   178,   178,   324,     4,     4,   178,   481,     6,     3,
+     419,   415,     4,   150,   152,   153,   212,   278,   423,   425,
+     548,   549,   550,   551,   553,   546,   177,    35,    36,    37,
+      38,   270,   177,   177,   177,   177,   177,   177,   177,     8,
+       8,     8,     8,     3,     8,   475,     4,     8,     3,     8,
+       8,   177,   177,   177,     8,   208,   554,     4,   552,     3,
+       8,   366,     4,   180,   472,     4,   178,     4,   549,   177,
+       5,   177,     7,   555,   556,   557,     3,     6,   151,   154,
+     155,   156,   157,   158,   159,   558,   559,   560,   562,   563,
+     564,   565,   566,   567,   556,   561,     4,     4,     4,     4,
+       4,   568,     3,     8,     4,   180,   178,   178,   180,   178,
+       4,   559,   177,   177
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   175,   177,   176,   178,   176,   179,   176,   180,   176,
-     181,   176,   182,   176,   183,   176,   184,   176,   185,   176,
-     186,   176,   187,   176,   188,   176,   189,   176,   190,   176,
-     191,   191,   191,   191,   191,   191,   191,   192,   194,   193,
-     195,   196,   196,   197,   197,   199,   198,   200,   200,   201,
-     201,   203,   202,   204,   204,   205,   205,   206,   208,   207,
-     209,   209,   210,   210,   210,   210,   210,   210,   212,   211,
-     214,   213,   215,   215,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   217,   218,   219,   220,   221,   222,   223,   225,   224,
-     226,   227,   228,   230,   229,   231,   231,   232,   232,   232,
-     232,   232,   232,   232,   234,   233,   236,   235,   238,   237,
-     239,   239,   241,   240,   242,   242,   243,   245,   244,   247,
-     246,   248,   248,   249,   251,   250,   253,   252,   255,   254,
-     256,   256,   257,   257,   259,   258,   260,   260,   261,   261,
-     261,   261,   261,   261,   261,   261,   261,   261,   261,   261,
-     261,   261,   261,   261,   261,   261,   261,   261,   263,   262,
-     264,   264,   264,   264,   266,   265,   268,   267,   270,   269,
-     271,   273,   272,   274,   275,   276,   277,   278,   279,   280,
-     282,   281,   284,   283,   286,   285,   288,   287,   289,   290,
-     292,   291,   293,   293,   294,   294,   294,   294,   294,   295,
-     296,   297,   298,   299,   301,   300,   302,   302,   303,   303,
-     305,   304,   307,   306,   308,   308,   308,   309,   309,   311,
-     310,   313,   312,   315,   314,   316,   316,   317,   317,   317,
-     317,   317,   317,   318,   319,   320,   321,   322,   323,   325,
-     324,   326,   326,   327,   327,   329,   328,   331,   330,   332,
-     332,   333,   333,   333,   333,   333,   333,   333,   333,   333,
-     333,   333,   333,   333,   333,   333,   333,   333,   333,   333,
-     333,   333,   333,   333,   333,   333,   333,   333,   335,   334,
-     337,   336,   339,   338,   341,   340,   343,   342,   345,   344,
-     347,   346,   349,   348,   350,   350,   350,   350,   351,   353,
-     352,   354,   354,   355,   355,   357,   356,   358,   358,   359,
-     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
-     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
-     359,   361,   360,   363,   362,   364,   364,   365,   365,   367,
-     366,   369,   368,   370,   370,   371,   371,   372,   372,   372,
-     372,   372,   372,   372,   372,   372,   372,   373,   374,   375,
-     377,   376,   379,   378,   381,   380,   382,   384,   383,   385,
-     387,   386,   388,   388,   389,   389,   391,   390,   393,   392,
-     394,   394,   395,   395,   396,   396,   396,   396,   396,   396,
-     396,   396,   396,   397,   399,   398,   400,   401,   402,   403,
-     405,   404,   406,   406,   407,   407,   409,   408,   411,   410,
-     412,   412,   413,   413,   413,   413,   413,   413,   413,   415,
-     414,   417,   416,   419,   418,   421,   420,   422,   422,   423,
-     423,   425,   424,   427,   426,   428,   428,   429,   429,   430,
-     430,   430,   430,   430,   430,   430,   430,   430,   430,   430,
-     430,   430,   430,   430,   432,   431,   434,   433,   436,   435,
-     438,   437,   440,   439,   442,   441,   444,   443,   446,   445,
-     448,   447,   450,   449,   452,   451,   454,   453,   456,   455,
-     457,   457,   459,   458,   460,   460,   462,   461,   463,   463,
-     464,   464,   465,   465,   465,   465,   465,   465,   465,   465,
-     465,   465,   465,   466,   468,   467,   469,   470,   472,   471,
-     473,   473,   474,   474,   474,   474,   474,   476,   475,   478,
-     477,   480,   479,   482,   481,   484,   483,   485,   485,   486,
-     486,   486,   486,   486,   486,   486,   486,   486,   486,   486,
-     486,   486,   486,   486,   486,   486,   486,   487,   489,   488,
-     491,   490,   492,   494,   493,   495,   496,   498,   497,   499,
-     499,   501,   500,   502,   503,   505,   504,   506,   506,   506,
-     506,   506,   508,   507,   510,   509,   512,   511,   514,   513,
-     516,   515,   518,   517,   520,   519,   522,   521,   523,   523,
-     524,   524,   526,   525,   527,   529,   528,   531,   530,   532,
-     532,   533,   535,   534,   536,   536,   538,   537,   539,   539,
-     540,   540,   540,   540,   540,   540,   540,   541,   543,   542,
-     545,   544,   546,   546,   548,   547,   549,   549,   550,   550,
-     550,   550,   552,   551,   553,   554,   555
+       0,   181,   183,   182,   184,   182,   185,   182,   186,   182,
+     187,   182,   188,   182,   189,   182,   190,   182,   191,   182,
+     192,   182,   193,   182,   194,   182,   195,   182,   196,   182,
+     197,   197,   197,   197,   197,   197,   197,   198,   200,   199,
+     201,   202,   202,   203,   203,   205,   204,   206,   206,   207,
+     207,   209,   208,   210,   210,   211,   211,   212,   214,   213,
+     215,   215,   216,   216,   216,   216,   216,   216,   218,   217,
+     220,   219,   221,   221,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   223,   224,   225,   226,   227,   228,   229,   231,   230,
+     232,   233,   234,   236,   235,   237,   237,   238,   238,   238,
+     238,   238,   238,   238,   240,   239,   242,   241,   244,   243,
+     245,   245,   247,   246,   248,   248,   249,   251,   250,   253,
+     252,   254,   254,   255,   257,   256,   259,   258,   261,   260,
+     262,   262,   263,   263,   265,   264,   266,   266,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
+     267,   267,   267,   267,   267,   267,   267,   267,   267,   269,
+     268,   270,   270,   270,   270,   272,   271,   274,   273,   276,
+     275,   277,   279,   278,   280,   281,   282,   283,   284,   285,
+     286,   287,   289,   288,   291,   290,   293,   292,   295,   294,
+     296,   297,   299,   298,   300,   300,   301,   301,   301,   301,
+     301,   302,   303,   304,   305,   306,   308,   307,   309,   309,
+     310,   310,   312,   311,   314,   313,   315,   315,   315,   316,
+     316,   318,   317,   320,   319,   322,   321,   323,   323,   324,
+     324,   324,   324,   324,   324,   325,   326,   327,   328,   329,
+     330,   332,   331,   333,   333,   334,   334,   336,   335,   338,
+     337,   339,   339,   340,   340,   340,   340,   340,   340,   340,
+     340,   340,   340,   340,   340,   340,   340,   340,   340,   340,
+     340,   340,   340,   340,   340,   340,   340,   340,   340,   340,
+     342,   341,   344,   343,   346,   345,   348,   347,   350,   349,
+     352,   351,   354,   353,   356,   355,   357,   357,   357,   357,
+     358,   360,   359,   361,   361,   362,   362,   364,   363,   365,
+     365,   366,   366,   366,   366,   366,   366,   366,   366,   366,
+     366,   366,   366,   366,   366,   366,   366,   366,   366,   366,
+     366,   366,   366,   368,   367,   370,   369,   371,   371,   372,
+     372,   374,   373,   376,   375,   377,   377,   378,   378,   379,
+     379,   379,   379,   379,   379,   379,   379,   379,   379,   380,
+     381,   382,   384,   383,   386,   385,   388,   387,   389,   391,
+     390,   392,   394,   393,   395,   395,   396,   396,   398,   397,
+     400,   399,   401,   401,   402,   402,   403,   403,   403,   403,
+     403,   403,   403,   403,   403,   404,   406,   405,   407,   408,
+     409,   410,   412,   411,   413,   413,   414,   414,   416,   415,
+     418,   417,   419,   419,   420,   420,   420,   420,   420,   420,
+     420,   422,   421,   424,   423,   426,   425,   428,   427,   429,
+     429,   430,   430,   432,   431,   434,   433,   435,   435,   436,
+     436,   437,   437,   437,   437,   437,   437,   437,   437,   437,
+     437,   437,   437,   437,   437,   437,   439,   438,   441,   440,
+     443,   442,   445,   444,   447,   446,   449,   448,   451,   450,
+     453,   452,   455,   454,   457,   456,   459,   458,   461,   460,
+     463,   462,   464,   464,   466,   465,   467,   467,   469,   468,
+     470,   470,   471,   471,   472,   472,   472,   472,   472,   472,
+     472,   472,   472,   472,   472,   473,   475,   474,   476,   477,
+     479,   478,   480,   480,   481,   481,   481,   481,   481,   481,
+     483,   482,   485,   484,   486,   488,   487,   490,   489,   492,
+     491,   493,   493,   494,   494,   494,   494,   494,   494,   494,
+     494,   494,   494,   494,   494,   494,   494,   494,   494,   494,
+     494,   495,   497,   496,   499,   498,   500,   502,   501,   503,
+     504,   506,   505,   507,   507,   509,   508,   510,   510,   511,
+     512,   514,   513,   515,   515,   515,   515,   515,   517,   516,
+     519,   518,   521,   520,   523,   522,   525,   524,   527,   526,
+     529,   528,   531,   530,   532,   532,   533,   533,   535,   534,
+     536,   538,   537,   540,   539,   541,   541,   542,   544,   543,
+     545,   545,   547,   546,   548,   548,   549,   549,   549,   549,
+     549,   549,   549,   550,   552,   551,   554,   553,   555,   555,
+     557,   556,   558,   558,   559,   559,   559,   559,   559,   559,
+     559,   561,   560,   562,   563,   564,   565,   566,   568,   567
   };
 
-  const unsigned char
+  const signed char
   Dhcp4Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -4755,78 +4932,80 @@ namespace isc { namespace dhcp {
        6,     1,     3,     1,     0,     4,     0,     6,     0,     6,
        0,     1,     1,     3,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       3,     0,     4,     3,     3,     3,     3,     3,     3,     3,
-       0,     4,     0,     4,     0,     4,     0,     4,     3,     3,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     1,     3,     1,     1,     1,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     3,     3,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       4,     3,     0,     4,     3,     3,     3,     3,     3,     3,
+       3,     3,     0,     4,     0,     4,     0,     4,     0,     4,
+       3,     3,     0,     6,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     0,     4,     0,     4,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     1,     1,     1,     1,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     1,     1,     1,     1,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     6,     0,     4,     0,     1,     1,     3,     0,
-       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
-       0,     4,     0,     4,     0,     4,     1,     0,     4,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     1,     1,     3,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     6,     0,     1,     1,
+       1,     1,     1,     0,     6,     0,     4,     0,     1,     1,
        3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       3,     1,     0,     4,     0,     4,     0,     4,     1,     0,
+       4,     3,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     0,     1,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
+       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     0,     4,     0,     6,     0,
+       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
        0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     1,     0,     6,     1,     3,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     3,     3,     0,     6,
-       1,     3,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     6,     0,     4,     1,     3,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     6,     1,     1,     0,     6,     1,     3,     0,     4,
+       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     3,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     3,     0,     4,     0,     6,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     0,     4,
-       0,     4,     3,     0,     4,     3,     3,     0,     4,     1,
-       1,     0,     4,     3,     3,     0,     4,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     6,     0,     4,     1,     3,
-       1,     1,     0,     6,     3,     0,     6,     0,     4,     1,
-       3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     3,     0,     4,
-       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
-       1,     1,     0,     4,     3,     3,     3
+       1,     3,     0,     4,     0,     4,     3,     0,     4,     3,
+       3,     0,     4,     1,     1,     0,     4,     1,     1,     3,
+       3,     0,     4,     1,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     6,     0,     4,     1,     3,     1,     1,     0,     6,
+       3,     0,     6,     0,     4,     1,     3,     1,     0,     6,
+       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     3,     0,     4,     0,     6,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     3,     3,     3,     3,     3,     0,     4
   };
 
 
-
+#if PARSER4_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp4Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"", "\"config-control\"",
-  "\"config-databases\"", "\"config-fetch-wait-time\"",
-  "\"interfaces-config\"", "\"interfaces\"", "\"dhcp-socket-type\"",
-  "\"raw\"", "\"udp\"", "\"outbound-interface\"", "\"same-as-inbound\"",
-  "\"use-routing\"", "\"re-detect\"", "\"sanity-checks\"",
-  "\"lease-checks\"", "\"echo-client-id\"", "\"match-client-id\"",
-  "\"authoritative\"", "\"next-server\"", "\"server-hostname\"",
-  "\"boot-file-name\"", "\"lease-database\"", "\"hosts-database\"",
-  "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
-  "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
-  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
-  "\"consistency\"", "\"serial-consistency\"", "\"max-reconnect-tries\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
+  "\"config-control\"", "\"config-databases\"",
+  "\"config-fetch-wait-time\"", "\"interfaces-config\"", "\"interfaces\"",
+  "\"dhcp-socket-type\"", "\"raw\"", "\"udp\"", "\"outbound-interface\"",
+  "\"same-as-inbound\"", "\"use-routing\"", "\"re-detect\"",
+  "\"sanity-checks\"", "\"lease-checks\"", "\"echo-client-id\"",
+  "\"match-client-id\"", "\"authoritative\"", "\"next-server\"",
+  "\"server-hostname\"", "\"boot-file-name\"", "\"lease-database\"",
+  "\"hosts-database\"", "\"hosts-databases\"", "\"type\"", "\"memfile\"",
+  "\"mysql\"", "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"",
+  "\"host\"", "\"port\"", "\"persist\"", "\"lfc-interval\"",
+  "\"lfc-in-process\"", "\"readonly\"", "\"connect-timeout\"",
+  "\"contact-points\"", "\"keyspace\"", "\"consistency\"",
+  "\"serial-consistency\"", "\"max-reconnect-tries\"",
   "\"reconnect-wait-time\"", "\"request-timeout\"", "\"tcp-keepalive\"",
   "\"tcp-nodelay\"", "\"valid-lifetime\"", "\"renew-timer\"",
   "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
@@ -4848,25 +5027,27 @@ namespace isc { namespace dhcp {
   "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
   "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"",
   "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
-  "\"socket-name\"", "\"dhcp-queue-control\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"socket-name\"", "\"config-output-threads\"", "\"dhcp-queue-control\"",
+  "\"dhcp-ddns\"", "\"enable-updates\"", "\"qualifying-suffix\"",
+  "\"server-ip\"", "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
   "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
   "\"override-no-update\"", "\"override-client-update\"",
   "\"replace-client-name\"", "\"generated-prefix\"", "\"tcp\"", "\"JSON\"",
-  "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
-  "\"hostname-char-set\"", "\"hostname-char-replacement\"", "\"Logging\"",
-  "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp6\"",
-  "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP4",
-  "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4", "SUB_POOL4",
-  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
-  "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
-  "SUB_CONFIG_CONTROL", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12",
-  "$@13", "$@14", "value", "sub_json", "map2", "$@15", "map_value",
-  "map_content", "not_empty_map", "list_generic", "$@16", "list_content",
+  "\"BINARY\"", "\"when-present\"", "\"never\"", "\"always\"",
+  "\"when-not-present\"", "\"hostname-char-set\"",
+  "\"hostname-char-replacement\"", "\"Logging\"", "\"loggers\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
+  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"", "\"queue-size\"",
+  "\"overflow\"", "\"Dhcp6\"", "\"DhcpDdns\"", "\"Control-agent\"",
+  "TOPLEVEL_JSON", "TOPLEVEL_DHCP4", "SUB_DHCP4", "SUB_INTERFACES4",
+  "SUB_SUBNET4", "SUB_POOL4", "SUB_RESERVATION", "SUB_OPTION_DEFS",
+  "SUB_OPTION_DEF", "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY",
+  "SUB_DHCP_DDNS", "SUB_LOGGING", "SUB_CONFIG_CONTROL",
+  "\"constant string\"", "\"integer\"", "\"floating point\"",
+  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
+  "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12", "$@13", "$@14",
+  "value", "sub_json", "map2", "$@15", "map_value", "map_content",
+  "not_empty_map", "list_generic", "$@16", "list_content",
   "not_empty_list", "list_strings", "$@17", "list_strings_content",
   "not_empty_list_strings", "unknown_map_entry", "syntax_map", "$@18",
   "global_objects", "global_object", "dhcp4_object", "$@19", "sub_dhcp4",
@@ -4883,10 +5064,10 @@ namespace isc { namespace dhcp {
   "not_empty_database_list", "database", "$@32", "database_map_params",
   "database_map_param", "database_type", "$@33", "db_type", "user", "$@34",
   "password", "$@35", "host", "$@36", "port", "name", "$@37", "persist",
-  "lfc_interval", "readonly", "connect_timeout", "request_timeout",
-  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@38", "keyspace",
-  "$@39", "consistency", "$@40", "serial_consistency", "$@41",
-  "max_reconnect_tries", "reconnect_wait_time",
+  "lfc_interval", "lfc_in_process", "readonly", "connect_timeout",
+  "request_timeout", "tcp_keepalive", "tcp_nodelay", "contact_points",
+  "$@38", "keyspace", "$@39", "consistency", "$@40", "serial_consistency",
+  "$@41", "max_reconnect_tries", "reconnect_wait_time",
   "host_reservation_identifiers", "$@42",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
@@ -4934,118 +5115,120 @@ namespace isc { namespace dhcp {
   "client_class_param", "client_class_name", "client_class_test", "$@98",
   "only_if_required", "dhcp4o6_port", "control_socket", "$@99",
   "control_socket_params", "control_socket_param", "control_socket_type",
-  "$@100", "control_socket_name", "$@101", "dhcp_queue_control", "$@102",
-  "dhcp_ddns", "$@103", "sub_dhcp_ddns", "$@104", "dhcp_ddns_params",
-  "dhcp_ddns_param", "enable_updates", "qualifying_suffix", "$@105",
-  "server_ip", "$@106", "server_port", "sender_ip", "$@107", "sender_port",
-  "max_queue_size", "ncr_protocol", "$@108", "ncr_protocol_value",
-  "ncr_format", "$@109", "override_no_update", "override_client_update",
-  "replace_client_name", "$@110", "replace_client_name_value",
-  "generated_prefix", "$@111", "hostname_char_set", "$@112",
-  "hostname_char_replacement", "$@113", "dhcp6_json_object", "$@114",
-  "dhcpddns_json_object", "$@115", "control_agent_json_object", "$@116",
-  "config_control", "$@117", "sub_config_control", "$@118",
-  "config_control_params", "config_control_param", "config_databases",
-  "$@119", "config_fetch_wait_time", "logging_object", "$@120",
-  "sub_logging", "$@121", "logging_params", "logging_param", "loggers",
-  "$@122", "loggers_entries", "logger_entry", "$@123", "logger_params",
+  "$@100", "control_socket_name", "$@101", "config_output_threads",
+  "dhcp_queue_control", "$@102", "dhcp_ddns", "$@103", "sub_dhcp_ddns",
+  "$@104", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
+  "qualifying_suffix", "$@105", "server_ip", "$@106", "server_port",
+  "sender_ip", "$@107", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@108", "ncr_protocol_value", "ncr_format", "$@109", "ncr_format_value",
+  "override_no_update", "override_client_update", "replace_client_name",
+  "$@110", "replace_client_name_value", "generated_prefix", "$@111",
+  "hostname_char_set", "$@112", "hostname_char_replacement", "$@113",
+  "dhcp6_json_object", "$@114", "dhcpddns_json_object", "$@115",
+  "control_agent_json_object", "$@116", "config_control", "$@117",
+  "sub_config_control", "$@118", "config_control_params",
+  "config_control_param", "config_databases", "$@119",
+  "config_fetch_wait_time", "logging_object", "$@120", "sub_logging",
+  "$@121", "logging_params", "logging_param", "loggers", "$@122",
+  "loggers_entries", "logger_entry", "$@123", "logger_params",
   "logger_param", "debuglevel", "severity", "$@124", "output_options_list",
   "$@125", "output_options_list_content", "output_entry", "$@126",
   "output_params_list", "output_params", "output", "$@127", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "maxsize", "maxver", "async", "queue_size", "overflow", "$@128", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER4_DEBUG
-  const unsigned short
+  const short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   262,   262,   262,   263,   263,   264,   264,   265,   265,
-     266,   266,   267,   267,   268,   268,   269,   269,   270,   270,
-     271,   271,   272,   272,   273,   273,   274,   274,   275,   275,
-     283,   284,   285,   286,   287,   288,   289,   292,   297,   297,
-     308,   311,   312,   315,   319,   326,   326,   333,   334,   337,
-     341,   348,   348,   355,   356,   359,   363,   374,   384,   384,
-     400,   401,   405,   406,   407,   408,   409,   410,   413,   413,
-     428,   428,   437,   438,   443,   444,   445,   446,   447,   448,
-     449,   450,   451,   452,   453,   454,   455,   456,   457,   458,
-     459,   460,   461,   462,   463,   464,   465,   466,   467,   468,
-     469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
-     479,   482,   487,   492,   497,   502,   507,   512,   517,   517,
-     525,   530,   535,   541,   541,   552,   553,   556,   557,   558,
-     559,   560,   561,   562,   565,   565,   574,   574,   584,   584,
-     591,   592,   595,   595,   602,   604,   608,   614,   614,   626,
-     626,   636,   637,   639,   641,   641,   659,   659,   671,   671,
-     681,   682,   685,   686,   689,   689,   699,   700,   703,   704,
-     705,   706,   707,   708,   709,   710,   711,   712,   713,   714,
-     715,   716,   717,   718,   719,   720,   721,   722,   725,   725,
-     732,   733,   734,   735,   738,   738,   746,   746,   754,   754,
-     762,   767,   767,   775,   780,   785,   790,   795,   800,   805,
-     810,   810,   818,   818,   826,   826,   834,   834,   842,   847,
-     852,   852,   862,   863,   866,   867,   868,   869,   870,   873,
-     878,   883,   888,   893,   898,   898,   908,   909,   912,   913,
-     916,   916,   926,   926,   936,   937,   938,   941,   942,   945,
-     945,   953,   953,   961,   961,   972,   973,   976,   977,   978,
-     979,   980,   981,   984,   989,   994,   999,  1004,  1009,  1017,
-    1017,  1030,  1031,  1034,  1035,  1042,  1042,  1068,  1068,  1079,
-    1080,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1091,  1092,
-    1093,  1094,  1095,  1096,  1097,  1098,  1099,  1100,  1101,  1102,
-    1103,  1104,  1105,  1106,  1107,  1108,  1109,  1110,  1113,  1113,
-    1121,  1121,  1129,  1129,  1137,  1137,  1145,  1145,  1153,  1153,
-    1161,  1161,  1171,  1171,  1178,  1179,  1180,  1181,  1184,  1191,
-    1191,  1202,  1203,  1207,  1208,  1211,  1211,  1219,  1220,  1223,
-    1224,  1225,  1226,  1227,  1228,  1229,  1230,  1231,  1232,  1233,
-    1234,  1235,  1236,  1237,  1238,  1239,  1240,  1241,  1242,  1243,
-    1244,  1251,  1251,  1264,  1264,  1273,  1274,  1277,  1278,  1283,
-    1283,  1298,  1298,  1312,  1313,  1316,  1317,  1320,  1321,  1322,
-    1323,  1324,  1325,  1326,  1327,  1328,  1329,  1332,  1334,  1339,
-    1341,  1341,  1349,  1349,  1357,  1357,  1365,  1367,  1367,  1375,
-    1384,  1384,  1396,  1397,  1402,  1403,  1408,  1408,  1420,  1420,
-    1432,  1433,  1438,  1439,  1444,  1445,  1446,  1447,  1448,  1449,
-    1450,  1451,  1452,  1455,  1457,  1457,  1465,  1467,  1469,  1474,
-    1482,  1482,  1494,  1495,  1498,  1499,  1502,  1502,  1512,  1512,
-    1522,  1523,  1526,  1527,  1528,  1529,  1530,  1531,  1532,  1535,
-    1535,  1543,  1543,  1568,  1568,  1598,  1598,  1608,  1609,  1612,
-    1613,  1616,  1616,  1625,  1625,  1634,  1635,  1638,  1639,  1643,
-    1644,  1645,  1646,  1647,  1648,  1649,  1650,  1651,  1652,  1653,
-    1654,  1655,  1656,  1657,  1660,  1660,  1668,  1668,  1676,  1676,
-    1684,  1684,  1692,  1692,  1702,  1702,  1710,  1710,  1718,  1718,
-    1726,  1726,  1734,  1734,  1742,  1742,  1750,  1750,  1763,  1763,
-    1773,  1774,  1780,  1780,  1790,  1791,  1794,  1794,  1804,  1805,
-    1808,  1809,  1812,  1813,  1814,  1815,  1816,  1817,  1818,  1819,
-    1820,  1821,  1822,  1825,  1827,  1827,  1835,  1844,  1851,  1851,
-    1861,  1862,  1865,  1866,  1867,  1868,  1869,  1872,  1872,  1880,
-    1880,  1891,  1891,  1929,  1929,  1941,  1941,  1951,  1952,  1955,
-    1956,  1957,  1958,  1959,  1960,  1961,  1962,  1963,  1964,  1965,
-    1966,  1967,  1968,  1969,  1970,  1971,  1972,  1975,  1980,  1980,
-    1988,  1988,  1996,  2001,  2001,  2009,  2014,  2019,  2019,  2027,
-    2028,  2031,  2031,  2039,  2044,  2049,  2049,  2057,  2060,  2063,
-    2066,  2069,  2075,  2075,  2083,  2083,  2091,  2091,  2102,  2102,
-    2109,  2109,  2116,  2116,  2123,  2123,  2134,  2134,  2144,  2145,
-    2149,  2150,  2153,  2153,  2163,  2173,  2173,  2183,  2183,  2194,
-    2195,  2199,  2203,  2203,  2215,  2216,  2220,  2220,  2228,  2229,
-    2232,  2233,  2234,  2235,  2236,  2237,  2238,  2241,  2246,  2246,
-    2254,  2254,  2264,  2265,  2268,  2268,  2276,  2277,  2280,  2281,
-    2282,  2283,  2286,  2286,  2294,  2299,  2304
+       0,   269,   269,   269,   270,   270,   271,   271,   272,   272,
+     273,   273,   274,   274,   275,   275,   276,   276,   277,   277,
+     278,   278,   279,   279,   280,   280,   281,   281,   282,   282,
+     290,   291,   292,   293,   294,   295,   296,   299,   304,   304,
+     315,   318,   319,   322,   326,   333,   333,   340,   341,   344,
+     348,   355,   355,   362,   363,   366,   370,   381,   391,   391,
+     407,   408,   412,   413,   414,   415,   416,   417,   420,   420,
+     435,   435,   444,   445,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,   467,   468,   469,   470,   471,   472,   473,   474,   475,
+     476,   477,   478,   479,   480,   481,   482,   483,   484,   485,
+     486,   489,   494,   499,   504,   509,   514,   519,   524,   524,
+     532,   537,   542,   548,   548,   559,   560,   563,   564,   565,
+     566,   567,   568,   569,   572,   572,   581,   581,   591,   591,
+     598,   599,   602,   602,   609,   611,   615,   621,   621,   633,
+     633,   643,   644,   646,   648,   648,   666,   666,   678,   678,
+     688,   689,   692,   693,   696,   696,   706,   707,   710,   711,
+     712,   713,   714,   715,   716,   717,   718,   719,   720,   721,
+     722,   723,   724,   725,   726,   727,   728,   729,   730,   733,
+     733,   740,   741,   742,   743,   746,   746,   754,   754,   762,
+     762,   770,   775,   775,   783,   788,   793,   798,   803,   808,
+     813,   818,   823,   823,   831,   831,   839,   839,   847,   847,
+     855,   860,   865,   865,   875,   876,   879,   880,   881,   882,
+     883,   886,   891,   896,   901,   906,   911,   911,   921,   922,
+     925,   926,   929,   929,   939,   939,   949,   950,   951,   954,
+     955,   958,   958,   966,   966,   974,   974,   985,   986,   989,
+     990,   991,   992,   993,   994,   997,  1002,  1007,  1012,  1017,
+    1022,  1030,  1030,  1043,  1044,  1047,  1048,  1055,  1055,  1081,
+    1081,  1092,  1093,  1097,  1098,  1099,  1100,  1101,  1102,  1103,
+    1104,  1105,  1106,  1107,  1108,  1109,  1110,  1111,  1112,  1113,
+    1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,  1123,
+    1126,  1126,  1134,  1134,  1142,  1142,  1150,  1150,  1158,  1158,
+    1166,  1166,  1174,  1174,  1184,  1184,  1191,  1192,  1193,  1194,
+    1197,  1204,  1204,  1215,  1216,  1220,  1221,  1224,  1224,  1232,
+    1233,  1236,  1237,  1238,  1239,  1240,  1241,  1242,  1243,  1244,
+    1245,  1246,  1247,  1248,  1249,  1250,  1251,  1252,  1253,  1254,
+    1255,  1256,  1257,  1264,  1264,  1277,  1277,  1286,  1287,  1290,
+    1291,  1296,  1296,  1311,  1311,  1325,  1326,  1329,  1330,  1333,
+    1334,  1335,  1336,  1337,  1338,  1339,  1340,  1341,  1342,  1345,
+    1347,  1352,  1354,  1354,  1362,  1362,  1370,  1370,  1378,  1380,
+    1380,  1388,  1397,  1397,  1409,  1410,  1415,  1416,  1421,  1421,
+    1433,  1433,  1445,  1446,  1451,  1452,  1457,  1458,  1459,  1460,
+    1461,  1462,  1463,  1464,  1465,  1468,  1470,  1470,  1478,  1480,
+    1482,  1487,  1495,  1495,  1507,  1508,  1511,  1512,  1515,  1515,
+    1525,  1525,  1535,  1536,  1539,  1540,  1541,  1542,  1543,  1544,
+    1545,  1548,  1548,  1556,  1556,  1581,  1581,  1611,  1611,  1621,
+    1622,  1625,  1626,  1629,  1629,  1638,  1638,  1647,  1648,  1651,
+    1652,  1656,  1657,  1658,  1659,  1660,  1661,  1662,  1663,  1664,
+    1665,  1666,  1667,  1668,  1669,  1670,  1673,  1673,  1681,  1681,
+    1689,  1689,  1697,  1697,  1705,  1705,  1715,  1715,  1723,  1723,
+    1731,  1731,  1739,  1739,  1747,  1747,  1755,  1755,  1763,  1763,
+    1776,  1776,  1786,  1787,  1793,  1793,  1803,  1804,  1807,  1807,
+    1817,  1818,  1821,  1822,  1825,  1826,  1827,  1828,  1829,  1830,
+    1831,  1832,  1833,  1834,  1835,  1838,  1840,  1840,  1848,  1857,
+    1864,  1864,  1874,  1875,  1878,  1879,  1880,  1881,  1882,  1883,
+    1886,  1886,  1894,  1894,  1902,  1910,  1910,  1948,  1948,  1960,
+    1960,  1970,  1971,  1974,  1975,  1976,  1977,  1978,  1979,  1980,
+    1981,  1982,  1983,  1984,  1985,  1986,  1987,  1988,  1989,  1990,
+    1991,  1994,  1999,  1999,  2007,  2007,  2015,  2020,  2020,  2028,
+    2033,  2038,  2038,  2046,  2047,  2050,  2050,  2058,  2059,  2062,
+    2067,  2072,  2072,  2080,  2083,  2086,  2089,  2092,  2098,  2098,
+    2106,  2106,  2114,  2114,  2125,  2125,  2132,  2132,  2139,  2139,
+    2146,  2146,  2157,  2157,  2167,  2168,  2172,  2173,  2176,  2176,
+    2186,  2196,  2196,  2206,  2206,  2217,  2218,  2222,  2226,  2226,
+    2238,  2239,  2243,  2243,  2251,  2252,  2255,  2256,  2257,  2258,
+    2259,  2260,  2261,  2264,  2269,  2269,  2277,  2277,  2287,  2288,
+    2291,  2291,  2299,  2300,  2303,  2304,  2305,  2306,  2307,  2308,
+    2309,  2312,  2312,  2320,  2325,  2330,  2335,  2340,  2345,  2345
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp4Parser::yystack_print_ ()
+  Dhcp4Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp4Parser::yy_reduce_print_ (int yyrule)
+  Dhcp4Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -5058,10 +5241,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER4_DEBUG
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:1242
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 5064 "dhcp4_parser.cc" // lalr1.cc:1242
-#line 2309 "dhcp4_parser.yy" // lalr1.cc:1243
+#line 5247 "dhcp4_parser.cc"
+
+#line 2353 "dhcp4_parser.yy"
 
 
 void
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.3.2.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,13 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_PARSER4_DHCP4_PARSER_H_INCLUDED
 # define YY_PARSER4_DHCP4_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "dhcp4_parser.yy" // lalr1.cc:401
+// "%code requires" blocks.
+#line 17 "dhcp4_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -56,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "dhcp4_parser.h" // lalr1.cc:401
+#line 61 "dhcp4_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -103,44 +104,48 @@ using namespace std;
 #endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER4__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER4__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -153,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -178,9 +204,10 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined PARSER4_DEBUG */
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:401
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 184 "dhcp4_parser.h" // lalr1.cc:401
+#line 210 "dhcp4_parser.h"
+
 
 
 
@@ -188,37 +215,49 @@ namespace isc { namespace dhcp {
   class Dhcp4Parser
   {
   public:
-#ifndef PARSER4_STYPE
+#ifdef PARSER4_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER4_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER4_STYPE value_type;
+#else
   /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
   /// via the current parser state.
-  class semantic_type
+  class value_type
   {
   public:
     /// Type of *this.
-    typedef semantic_type self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    semantic_type () YY_NOEXCEPT
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    semantic_type (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~semantic_type () YY_NOEXCEPT
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER4__ASSERT (!yytypeid_);
     }
 
 # if 201103L <= YY_CPLUSPLUS
@@ -227,8 +266,8 @@ namespace isc { namespace dhcp {
     T&
     emplace (U&&... u)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (std::forward <U>(u)...);
     }
@@ -238,8 +277,8 @@ namespace isc { namespace dhcp {
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
@@ -249,8 +288,8 @@ namespace isc { namespace dhcp {
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -279,9 +318,9 @@ namespace isc { namespace dhcp {
     T&
     as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -290,9 +329,9 @@ namespace isc { namespace dhcp {
     const T&
     as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -308,8 +347,8 @@ namespace isc { namespace dhcp {
     void
     swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *that.yytypeid_);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == *that.yytypeid_);
       std::swap (as<T> (), that.as<T> ());
     }
 
@@ -358,16 +397,19 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    semantic_type (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
     yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
@@ -376,7 +418,7 @@ namespace isc { namespace dhcp {
     const T*
     yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
@@ -390,6 +432,7 @@ namespace isc { namespace dhcp {
       // db_type
       // hr_mode
       // ncr_protocol_value
+      // ncr_format_value
       // replace_client_name_value
       char dummy1[sizeof (ElementPtr)];
 
@@ -413,18 +456,19 @@ namespace isc { namespace dhcp {
     union
     {
       /// Strongest alignment constraints.
-      long double yyalign_me;
+      long double yyalign_me_;
       /// A buffer large enough to store any of the semantic values.
-      char yyraw[size];
-    } yybuffer_;
+      char yyraw_[size];
+    };
 
     /// Whether the content is built: if defined, the name of the stored type.
     const std::type_info *yytypeid_;
   };
 
-#else
-    typedef PARSER4_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
@@ -446,203 +490,793 @@ namespace isc { namespace dhcp {
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP4 = 265,
-        TOKEN_CONFIG_CONTROL = 266,
-        TOKEN_CONFIG_DATABASES = 267,
-        TOKEN_CONFIG_FETCH_WAIT_TIME = 268,
-        TOKEN_INTERFACES_CONFIG = 269,
-        TOKEN_INTERFACES = 270,
-        TOKEN_DHCP_SOCKET_TYPE = 271,
-        TOKEN_RAW = 272,
-        TOKEN_UDP = 273,
-        TOKEN_OUTBOUND_INTERFACE = 274,
-        TOKEN_SAME_AS_INBOUND = 275,
-        TOKEN_USE_ROUTING = 276,
-        TOKEN_RE_DETECT = 277,
-        TOKEN_SANITY_CHECKS = 278,
-        TOKEN_LEASE_CHECKS = 279,
-        TOKEN_ECHO_CLIENT_ID = 280,
-        TOKEN_MATCH_CLIENT_ID = 281,
-        TOKEN_AUTHORITATIVE = 282,
-        TOKEN_NEXT_SERVER = 283,
-        TOKEN_SERVER_HOSTNAME = 284,
-        TOKEN_BOOT_FILE_NAME = 285,
-        TOKEN_LEASE_DATABASE = 286,
-        TOKEN_HOSTS_DATABASE = 287,
-        TOKEN_HOSTS_DATABASES = 288,
-        TOKEN_TYPE = 289,
-        TOKEN_MEMFILE = 290,
-        TOKEN_MYSQL = 291,
-        TOKEN_POSTGRESQL = 292,
-        TOKEN_CQL = 293,
-        TOKEN_USER = 294,
-        TOKEN_PASSWORD = 295,
-        TOKEN_HOST = 296,
-        TOKEN_PORT = 297,
-        TOKEN_PERSIST = 298,
-        TOKEN_LFC_INTERVAL = 299,
-        TOKEN_READONLY = 300,
-        TOKEN_CONNECT_TIMEOUT = 301,
-        TOKEN_CONTACT_POINTS = 302,
-        TOKEN_KEYSPACE = 303,
-        TOKEN_CONSISTENCY = 304,
-        TOKEN_SERIAL_CONSISTENCY = 305,
-        TOKEN_MAX_RECONNECT_TRIES = 306,
-        TOKEN_RECONNECT_WAIT_TIME = 307,
-        TOKEN_REQUEST_TIMEOUT = 308,
-        TOKEN_TCP_KEEPALIVE = 309,
-        TOKEN_TCP_NODELAY = 310,
-        TOKEN_VALID_LIFETIME = 311,
-        TOKEN_RENEW_TIMER = 312,
-        TOKEN_REBIND_TIMER = 313,
-        TOKEN_CALCULATE_TEE_TIMES = 314,
-        TOKEN_T1_PERCENT = 315,
-        TOKEN_T2_PERCENT = 316,
-        TOKEN_DECLINE_PROBATION_PERIOD = 317,
-        TOKEN_SERVER_TAG = 318,
-        TOKEN_SUBNET4 = 319,
-        TOKEN_SUBNET_4O6_INTERFACE = 320,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 321,
-        TOKEN_SUBNET_4O6_SUBNET = 322,
-        TOKEN_OPTION_DEF = 323,
-        TOKEN_OPTION_DATA = 324,
-        TOKEN_NAME = 325,
-        TOKEN_DATA = 326,
-        TOKEN_CODE = 327,
-        TOKEN_SPACE = 328,
-        TOKEN_CSV_FORMAT = 329,
-        TOKEN_ALWAYS_SEND = 330,
-        TOKEN_RECORD_TYPES = 331,
-        TOKEN_ENCAPSULATE = 332,
-        TOKEN_ARRAY = 333,
-        TOKEN_SHARED_NETWORKS = 334,
-        TOKEN_POOLS = 335,
-        TOKEN_POOL = 336,
-        TOKEN_USER_CONTEXT = 337,
-        TOKEN_COMMENT = 338,
-        TOKEN_SUBNET = 339,
-        TOKEN_INTERFACE = 340,
-        TOKEN_ID = 341,
-        TOKEN_RESERVATION_MODE = 342,
-        TOKEN_DISABLED = 343,
-        TOKEN_OUT_OF_POOL = 344,
-        TOKEN_GLOBAL = 345,
-        TOKEN_ALL = 346,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 347,
-        TOKEN_CLIENT_CLASSES = 348,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 349,
-        TOKEN_TEST = 350,
-        TOKEN_ONLY_IF_REQUIRED = 351,
-        TOKEN_CLIENT_CLASS = 352,
-        TOKEN_RESERVATIONS = 353,
-        TOKEN_DUID = 354,
-        TOKEN_HW_ADDRESS = 355,
-        TOKEN_CIRCUIT_ID = 356,
-        TOKEN_CLIENT_ID = 357,
-        TOKEN_HOSTNAME = 358,
-        TOKEN_FLEX_ID = 359,
-        TOKEN_RELAY = 360,
-        TOKEN_IP_ADDRESS = 361,
-        TOKEN_IP_ADDRESSES = 362,
-        TOKEN_HOOKS_LIBRARIES = 363,
-        TOKEN_LIBRARY = 364,
-        TOKEN_PARAMETERS = 365,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 366,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 367,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 368,
-        TOKEN_HOLD_RECLAIMED_TIME = 369,
-        TOKEN_MAX_RECLAIM_LEASES = 370,
-        TOKEN_MAX_RECLAIM_TIME = 371,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 372,
-        TOKEN_DHCP4O6_PORT = 373,
-        TOKEN_CONTROL_SOCKET = 374,
-        TOKEN_SOCKET_TYPE = 375,
-        TOKEN_SOCKET_NAME = 376,
-        TOKEN_DHCP_QUEUE_CONTROL = 377,
-        TOKEN_DHCP_DDNS = 378,
-        TOKEN_ENABLE_UPDATES = 379,
-        TOKEN_QUALIFYING_SUFFIX = 380,
-        TOKEN_SERVER_IP = 381,
-        TOKEN_SERVER_PORT = 382,
-        TOKEN_SENDER_IP = 383,
-        TOKEN_SENDER_PORT = 384,
-        TOKEN_MAX_QUEUE_SIZE = 385,
-        TOKEN_NCR_PROTOCOL = 386,
-        TOKEN_NCR_FORMAT = 387,
-        TOKEN_OVERRIDE_NO_UPDATE = 388,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 389,
-        TOKEN_REPLACE_CLIENT_NAME = 390,
-        TOKEN_GENERATED_PREFIX = 391,
-        TOKEN_TCP = 392,
-        TOKEN_JSON = 393,
-        TOKEN_WHEN_PRESENT = 394,
-        TOKEN_NEVER = 395,
-        TOKEN_ALWAYS = 396,
-        TOKEN_WHEN_NOT_PRESENT = 397,
-        TOKEN_HOSTNAME_CHAR_SET = 398,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 399,
-        TOKEN_LOGGING = 400,
-        TOKEN_LOGGERS = 401,
-        TOKEN_OUTPUT_OPTIONS = 402,
-        TOKEN_OUTPUT = 403,
-        TOKEN_DEBUGLEVEL = 404,
-        TOKEN_SEVERITY = 405,
-        TOKEN_FLUSH = 406,
-        TOKEN_MAXSIZE = 407,
-        TOKEN_MAXVER = 408,
-        TOKEN_DHCP6 = 409,
-        TOKEN_DHCPDDNS = 410,
-        TOKEN_CONTROL_AGENT = 411,
-        TOKEN_TOPLEVEL_JSON = 412,
-        TOKEN_TOPLEVEL_DHCP4 = 413,
-        TOKEN_SUB_DHCP4 = 414,
-        TOKEN_SUB_INTERFACES4 = 415,
-        TOKEN_SUB_SUBNET4 = 416,
-        TOKEN_SUB_POOL4 = 417,
-        TOKEN_SUB_RESERVATION = 418,
-        TOKEN_SUB_OPTION_DEFS = 419,
-        TOKEN_SUB_OPTION_DEF = 420,
-        TOKEN_SUB_OPTION_DATA = 421,
-        TOKEN_SUB_HOOKS_LIBRARY = 422,
-        TOKEN_SUB_DHCP_DDNS = 423,
-        TOKEN_SUB_LOGGING = 424,
-        TOKEN_SUB_CONFIG_CONTROL = 425,
-        TOKEN_STRING = 426,
-        TOKEN_INTEGER = 427,
-        TOKEN_FLOAT = 428,
-        TOKEN_BOOLEAN = 429
+      enum token_kind_type
+      {
+        TOKEN_PARSER4_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER4_error = 256,     // error
+    TOKEN_PARSER4_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP4 = 265,             // "Dhcp4"
+    TOKEN_CONFIG_CONTROL = 266,    // "config-control"
+    TOKEN_CONFIG_DATABASES = 267,  // "config-databases"
+    TOKEN_CONFIG_FETCH_WAIT_TIME = 268, // "config-fetch-wait-time"
+    TOKEN_INTERFACES_CONFIG = 269, // "interfaces-config"
+    TOKEN_INTERFACES = 270,        // "interfaces"
+    TOKEN_DHCP_SOCKET_TYPE = 271,  // "dhcp-socket-type"
+    TOKEN_RAW = 272,               // "raw"
+    TOKEN_UDP = 273,               // "udp"
+    TOKEN_OUTBOUND_INTERFACE = 274, // "outbound-interface"
+    TOKEN_SAME_AS_INBOUND = 275,   // "same-as-inbound"
+    TOKEN_USE_ROUTING = 276,       // "use-routing"
+    TOKEN_RE_DETECT = 277,         // "re-detect"
+    TOKEN_SANITY_CHECKS = 278,     // "sanity-checks"
+    TOKEN_LEASE_CHECKS = 279,      // "lease-checks"
+    TOKEN_ECHO_CLIENT_ID = 280,    // "echo-client-id"
+    TOKEN_MATCH_CLIENT_ID = 281,   // "match-client-id"
+    TOKEN_AUTHORITATIVE = 282,     // "authoritative"
+    TOKEN_NEXT_SERVER = 283,       // "next-server"
+    TOKEN_SERVER_HOSTNAME = 284,   // "server-hostname"
+    TOKEN_BOOT_FILE_NAME = 285,    // "boot-file-name"
+    TOKEN_LEASE_DATABASE = 286,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 287,    // "hosts-database"
+    TOKEN_HOSTS_DATABASES = 288,   // "hosts-databases"
+    TOKEN_TYPE = 289,              // "type"
+    TOKEN_MEMFILE = 290,           // "memfile"
+    TOKEN_MYSQL = 291,             // "mysql"
+    TOKEN_POSTGRESQL = 292,        // "postgresql"
+    TOKEN_CQL = 293,               // "cql"
+    TOKEN_USER = 294,              // "user"
+    TOKEN_PASSWORD = 295,          // "password"
+    TOKEN_HOST = 296,              // "host"
+    TOKEN_PORT = 297,              // "port"
+    TOKEN_PERSIST = 298,           // "persist"
+    TOKEN_LFC_INTERVAL = 299,      // "lfc-interval"
+    TOKEN_LFC_IN_PROCESS = 300,    // "lfc-in-process"
+    TOKEN_READONLY = 301,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 302,   // "connect-timeout"
+    TOKEN_CONTACT_POINTS = 303,    // "contact-points"
+    TOKEN_KEYSPACE = 304,          // "keyspace"
+    TOKEN_CONSISTENCY = 305,       // "consistency"
+    TOKEN_SERIAL_CONSISTENCY = 306, // "serial-consistency"
+    TOKEN_MAX_RECONNECT_TRIES = 307, // "max-reconnect-tries"
+    TOKEN_RECONNECT_WAIT_TIME = 308, // "reconnect-wait-time"
+    TOKEN_REQUEST_TIMEOUT = 309,   // "request-timeout"
+    TOKEN_TCP_KEEPALIVE = 310,     // "tcp-keepalive"
+    TOKEN_TCP_NODELAY = 311,       // "tcp-nodelay"
+    TOKEN_VALID_LIFETIME = 312,    // "valid-lifetime"
+    TOKEN_RENEW_TIMER = 313,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 314,      // "rebind-timer"
+    TOKEN_CALCULATE_TEE_TIMES = 315, // "calculate-tee-times"
+    TOKEN_T1_PERCENT = 316,        // "t1-percent"
+    TOKEN_T2_PERCENT = 317,        // "t2-percent"
+    TOKEN_DECLINE_PROBATION_PERIOD = 318, // "decline-probation-period"
+    TOKEN_SERVER_TAG = 319,        // "server-tag"
+    TOKEN_SUBNET4 = 320,           // "subnet4"
+    TOKEN_SUBNET_4O6_INTERFACE = 321, // "4o6-interface"
+    TOKEN_SUBNET_4O6_INTERFACE_ID = 322, // "4o6-interface-id"
+    TOKEN_SUBNET_4O6_SUBNET = 323, // "4o6-subnet"
+    TOKEN_OPTION_DEF = 324,        // "option-def"
+    TOKEN_OPTION_DATA = 325,       // "option-data"
+    TOKEN_NAME = 326,              // "name"
+    TOKEN_DATA = 327,              // "data"
+    TOKEN_CODE = 328,              // "code"
+    TOKEN_SPACE = 329,             // "space"
+    TOKEN_CSV_FORMAT = 330,        // "csv-format"
+    TOKEN_ALWAYS_SEND = 331,       // "always-send"
+    TOKEN_RECORD_TYPES = 332,      // "record-types"
+    TOKEN_ENCAPSULATE = 333,       // "encapsulate"
+    TOKEN_ARRAY = 334,             // "array"
+    TOKEN_SHARED_NETWORKS = 335,   // "shared-networks"
+    TOKEN_POOLS = 336,             // "pools"
+    TOKEN_POOL = 337,              // "pool"
+    TOKEN_USER_CONTEXT = 338,      // "user-context"
+    TOKEN_COMMENT = 339,           // "comment"
+    TOKEN_SUBNET = 340,            // "subnet"
+    TOKEN_INTERFACE = 341,         // "interface"
+    TOKEN_ID = 342,                // "id"
+    TOKEN_RESERVATION_MODE = 343,  // "reservation-mode"
+    TOKEN_DISABLED = 344,          // "disabled"
+    TOKEN_OUT_OF_POOL = 345,       // "out-of-pool"
+    TOKEN_GLOBAL = 346,            // "global"
+    TOKEN_ALL = 347,               // "all"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 348, // "host-reservation-identifiers"
+    TOKEN_CLIENT_CLASSES = 349,    // "client-classes"
+    TOKEN_REQUIRE_CLIENT_CLASSES = 350, // "require-client-classes"
+    TOKEN_TEST = 351,              // "test"
+    TOKEN_ONLY_IF_REQUIRED = 352,  // "only-if-required"
+    TOKEN_CLIENT_CLASS = 353,      // "client-class"
+    TOKEN_RESERVATIONS = 354,      // "reservations"
+    TOKEN_DUID = 355,              // "duid"
+    TOKEN_HW_ADDRESS = 356,        // "hw-address"
+    TOKEN_CIRCUIT_ID = 357,        // "circuit-id"
+    TOKEN_CLIENT_ID = 358,         // "client-id"
+    TOKEN_HOSTNAME = 359,          // "hostname"
+    TOKEN_FLEX_ID = 360,           // "flex-id"
+    TOKEN_RELAY = 361,             // "relay"
+    TOKEN_IP_ADDRESS = 362,        // "ip-address"
+    TOKEN_IP_ADDRESSES = 363,      // "ip-addresses"
+    TOKEN_HOOKS_LIBRARIES = 364,   // "hooks-libraries"
+    TOKEN_LIBRARY = 365,           // "library"
+    TOKEN_PARAMETERS = 366,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 367, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 368, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 369, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 370, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 371, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 372,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 373, // "unwarned-reclaim-cycles"
+    TOKEN_DHCP4O6_PORT = 374,      // "dhcp4o6-port"
+    TOKEN_CONTROL_SOCKET = 375,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 376,       // "socket-type"
+    TOKEN_SOCKET_NAME = 377,       // "socket-name"
+    TOKEN_CONFIG_OUTPUT_THREADS = 378, // "config-output-threads"
+    TOKEN_DHCP_QUEUE_CONTROL = 379, // "dhcp-queue-control"
+    TOKEN_DHCP_DDNS = 380,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 381,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 382, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 383,         // "server-ip"
+    TOKEN_SERVER_PORT = 384,       // "server-port"
+    TOKEN_SENDER_IP = 385,         // "sender-ip"
+    TOKEN_SENDER_PORT = 386,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 387,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 388,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 389,        // "ncr-format"
+    TOKEN_OVERRIDE_NO_UPDATE = 390, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 391, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 392, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 393,  // "generated-prefix"
+    TOKEN_TCP = 394,               // "tcp"
+    TOKEN_JSON = 395,              // "JSON"
+    TOKEN_BINARY = 396,            // "BINARY"
+    TOKEN_WHEN_PRESENT = 397,      // "when-present"
+    TOKEN_NEVER = 398,             // "never"
+    TOKEN_ALWAYS = 399,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 400,  // "when-not-present"
+    TOKEN_HOSTNAME_CHAR_SET = 401, // "hostname-char-set"
+    TOKEN_HOSTNAME_CHAR_REPLACEMENT = 402, // "hostname-char-replacement"
+    TOKEN_LOGGING = 403,           // "Logging"
+    TOKEN_LOGGERS = 404,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 405,    // "output_options"
+    TOKEN_OUTPUT = 406,            // "output"
+    TOKEN_DEBUGLEVEL = 407,        // "debuglevel"
+    TOKEN_SEVERITY = 408,          // "severity"
+    TOKEN_FLUSH = 409,             // "flush"
+    TOKEN_MAXSIZE = 410,           // "maxsize"
+    TOKEN_MAXVER = 411,            // "maxver"
+    TOKEN_ASYNC = 412,             // "async"
+    TOKEN_QUEUE_SIZE = 413,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 414,   // "overflow"
+    TOKEN_DHCP6 = 415,             // "Dhcp6"
+    TOKEN_DHCPDDNS = 416,          // "DhcpDdns"
+    TOKEN_CONTROL_AGENT = 417,     // "Control-agent"
+    TOKEN_TOPLEVEL_JSON = 418,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP4 = 419,    // TOPLEVEL_DHCP4
+    TOKEN_SUB_DHCP4 = 420,         // SUB_DHCP4
+    TOKEN_SUB_INTERFACES4 = 421,   // SUB_INTERFACES4
+    TOKEN_SUB_SUBNET4 = 422,       // SUB_SUBNET4
+    TOKEN_SUB_POOL4 = 423,         // SUB_POOL4
+    TOKEN_SUB_RESERVATION = 424,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEFS = 425,   // SUB_OPTION_DEFS
+    TOKEN_SUB_OPTION_DEF = 426,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 427,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 428, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 429,     // SUB_DHCP_DDNS
+    TOKEN_SUB_LOGGING = 430,       // SUB_LOGGING
+    TOKEN_SUB_CONFIG_CONTROL = 431, // SUB_CONFIG_CONTROL
+    TOKEN_STRING = 432,            // "constant string"
+    TOKEN_INTEGER = 433,           // "integer"
+    TOKEN_FLOAT = 434,             // "floating point"
+    TOKEN_BOOLEAN = 435            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 181, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP4 = 10,                            // "Dhcp4"
+        S_CONFIG_CONTROL = 11,                   // "config-control"
+        S_CONFIG_DATABASES = 12,                 // "config-databases"
+        S_CONFIG_FETCH_WAIT_TIME = 13,           // "config-fetch-wait-time"
+        S_INTERFACES_CONFIG = 14,                // "interfaces-config"
+        S_INTERFACES = 15,                       // "interfaces"
+        S_DHCP_SOCKET_TYPE = 16,                 // "dhcp-socket-type"
+        S_RAW = 17,                              // "raw"
+        S_UDP = 18,                              // "udp"
+        S_OUTBOUND_INTERFACE = 19,               // "outbound-interface"
+        S_SAME_AS_INBOUND = 20,                  // "same-as-inbound"
+        S_USE_ROUTING = 21,                      // "use-routing"
+        S_RE_DETECT = 22,                        // "re-detect"
+        S_SANITY_CHECKS = 23,                    // "sanity-checks"
+        S_LEASE_CHECKS = 24,                     // "lease-checks"
+        S_ECHO_CLIENT_ID = 25,                   // "echo-client-id"
+        S_MATCH_CLIENT_ID = 26,                  // "match-client-id"
+        S_AUTHORITATIVE = 27,                    // "authoritative"
+        S_NEXT_SERVER = 28,                      // "next-server"
+        S_SERVER_HOSTNAME = 29,                  // "server-hostname"
+        S_BOOT_FILE_NAME = 30,                   // "boot-file-name"
+        S_LEASE_DATABASE = 31,                   // "lease-database"
+        S_HOSTS_DATABASE = 32,                   // "hosts-database"
+        S_HOSTS_DATABASES = 33,                  // "hosts-databases"
+        S_TYPE = 34,                             // "type"
+        S_MEMFILE = 35,                          // "memfile"
+        S_MYSQL = 36,                            // "mysql"
+        S_POSTGRESQL = 37,                       // "postgresql"
+        S_CQL = 38,                              // "cql"
+        S_USER = 39,                             // "user"
+        S_PASSWORD = 40,                         // "password"
+        S_HOST = 41,                             // "host"
+        S_PORT = 42,                             // "port"
+        S_PERSIST = 43,                          // "persist"
+        S_LFC_INTERVAL = 44,                     // "lfc-interval"
+        S_LFC_IN_PROCESS = 45,                   // "lfc-in-process"
+        S_READONLY = 46,                         // "readonly"
+        S_CONNECT_TIMEOUT = 47,                  // "connect-timeout"
+        S_CONTACT_POINTS = 48,                   // "contact-points"
+        S_KEYSPACE = 49,                         // "keyspace"
+        S_CONSISTENCY = 50,                      // "consistency"
+        S_SERIAL_CONSISTENCY = 51,               // "serial-consistency"
+        S_MAX_RECONNECT_TRIES = 52,              // "max-reconnect-tries"
+        S_RECONNECT_WAIT_TIME = 53,              // "reconnect-wait-time"
+        S_REQUEST_TIMEOUT = 54,                  // "request-timeout"
+        S_TCP_KEEPALIVE = 55,                    // "tcp-keepalive"
+        S_TCP_NODELAY = 56,                      // "tcp-nodelay"
+        S_VALID_LIFETIME = 57,                   // "valid-lifetime"
+        S_RENEW_TIMER = 58,                      // "renew-timer"
+        S_REBIND_TIMER = 59,                     // "rebind-timer"
+        S_CALCULATE_TEE_TIMES = 60,              // "calculate-tee-times"
+        S_T1_PERCENT = 61,                       // "t1-percent"
+        S_T2_PERCENT = 62,                       // "t2-percent"
+        S_DECLINE_PROBATION_PERIOD = 63,         // "decline-probation-period"
+        S_SERVER_TAG = 64,                       // "server-tag"
+        S_SUBNET4 = 65,                          // "subnet4"
+        S_SUBNET_4O6_INTERFACE = 66,             // "4o6-interface"
+        S_SUBNET_4O6_INTERFACE_ID = 67,          // "4o6-interface-id"
+        S_SUBNET_4O6_SUBNET = 68,                // "4o6-subnet"
+        S_OPTION_DEF = 69,                       // "option-def"
+        S_OPTION_DATA = 70,                      // "option-data"
+        S_NAME = 71,                             // "name"
+        S_DATA = 72,                             // "data"
+        S_CODE = 73,                             // "code"
+        S_SPACE = 74,                            // "space"
+        S_CSV_FORMAT = 75,                       // "csv-format"
+        S_ALWAYS_SEND = 76,                      // "always-send"
+        S_RECORD_TYPES = 77,                     // "record-types"
+        S_ENCAPSULATE = 78,                      // "encapsulate"
+        S_ARRAY = 79,                            // "array"
+        S_SHARED_NETWORKS = 80,                  // "shared-networks"
+        S_POOLS = 81,                            // "pools"
+        S_POOL = 82,                             // "pool"
+        S_USER_CONTEXT = 83,                     // "user-context"
+        S_COMMENT = 84,                          // "comment"
+        S_SUBNET = 85,                           // "subnet"
+        S_INTERFACE = 86,                        // "interface"
+        S_ID = 87,                               // "id"
+        S_RESERVATION_MODE = 88,                 // "reservation-mode"
+        S_DISABLED = 89,                         // "disabled"
+        S_OUT_OF_POOL = 90,                      // "out-of-pool"
+        S_GLOBAL = 91,                           // "global"
+        S_ALL = 92,                              // "all"
+        S_HOST_RESERVATION_IDENTIFIERS = 93,     // "host-reservation-identifiers"
+        S_CLIENT_CLASSES = 94,                   // "client-classes"
+        S_REQUIRE_CLIENT_CLASSES = 95,           // "require-client-classes"
+        S_TEST = 96,                             // "test"
+        S_ONLY_IF_REQUIRED = 97,                 // "only-if-required"
+        S_CLIENT_CLASS = 98,                     // "client-class"
+        S_RESERVATIONS = 99,                     // "reservations"
+        S_DUID = 100,                            // "duid"
+        S_HW_ADDRESS = 101,                      // "hw-address"
+        S_CIRCUIT_ID = 102,                      // "circuit-id"
+        S_CLIENT_ID = 103,                       // "client-id"
+        S_HOSTNAME = 104,                        // "hostname"
+        S_FLEX_ID = 105,                         // "flex-id"
+        S_RELAY = 106,                           // "relay"
+        S_IP_ADDRESS = 107,                      // "ip-address"
+        S_IP_ADDRESSES = 108,                    // "ip-addresses"
+        S_HOOKS_LIBRARIES = 109,                 // "hooks-libraries"
+        S_LIBRARY = 110,                         // "library"
+        S_PARAMETERS = 111,                      // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 112,       // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 113,         // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 114, // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 115,             // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 116,              // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 117,                // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 118,         // "unwarned-reclaim-cycles"
+        S_DHCP4O6_PORT = 119,                    // "dhcp4o6-port"
+        S_CONTROL_SOCKET = 120,                  // "control-socket"
+        S_SOCKET_TYPE = 121,                     // "socket-type"
+        S_SOCKET_NAME = 122,                     // "socket-name"
+        S_CONFIG_OUTPUT_THREADS = 123,           // "config-output-threads"
+        S_DHCP_QUEUE_CONTROL = 124,              // "dhcp-queue-control"
+        S_DHCP_DDNS = 125,                       // "dhcp-ddns"
+        S_ENABLE_UPDATES = 126,                  // "enable-updates"
+        S_QUALIFYING_SUFFIX = 127,               // "qualifying-suffix"
+        S_SERVER_IP = 128,                       // "server-ip"
+        S_SERVER_PORT = 129,                     // "server-port"
+        S_SENDER_IP = 130,                       // "sender-ip"
+        S_SENDER_PORT = 131,                     // "sender-port"
+        S_MAX_QUEUE_SIZE = 132,                  // "max-queue-size"
+        S_NCR_PROTOCOL = 133,                    // "ncr-protocol"
+        S_NCR_FORMAT = 134,                      // "ncr-format"
+        S_OVERRIDE_NO_UPDATE = 135,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 136,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 137,             // "replace-client-name"
+        S_GENERATED_PREFIX = 138,                // "generated-prefix"
+        S_TCP = 139,                             // "tcp"
+        S_JSON = 140,                            // "JSON"
+        S_BINARY = 141,                          // "BINARY"
+        S_WHEN_PRESENT = 142,                    // "when-present"
+        S_NEVER = 143,                           // "never"
+        S_ALWAYS = 144,                          // "always"
+        S_WHEN_NOT_PRESENT = 145,                // "when-not-present"
+        S_HOSTNAME_CHAR_SET = 146,               // "hostname-char-set"
+        S_HOSTNAME_CHAR_REPLACEMENT = 147,       // "hostname-char-replacement"
+        S_LOGGING = 148,                         // "Logging"
+        S_LOGGERS = 149,                         // "loggers"
+        S_OUTPUT_OPTIONS = 150,                  // "output_options"
+        S_OUTPUT = 151,                          // "output"
+        S_DEBUGLEVEL = 152,                      // "debuglevel"
+        S_SEVERITY = 153,                        // "severity"
+        S_FLUSH = 154,                           // "flush"
+        S_MAXSIZE = 155,                         // "maxsize"
+        S_MAXVER = 156,                          // "maxver"
+        S_ASYNC = 157,                           // "async"
+        S_QUEUE_SIZE = 158,                      // "queue-size"
+        S_OVERFLOW_POLICY = 159,                 // "overflow"
+        S_DHCP6 = 160,                           // "Dhcp6"
+        S_DHCPDDNS = 161,                        // "DhcpDdns"
+        S_CONTROL_AGENT = 162,                   // "Control-agent"
+        S_TOPLEVEL_JSON = 163,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP4 = 164,                  // TOPLEVEL_DHCP4
+        S_SUB_DHCP4 = 165,                       // SUB_DHCP4
+        S_SUB_INTERFACES4 = 166,                 // SUB_INTERFACES4
+        S_SUB_SUBNET4 = 167,                     // SUB_SUBNET4
+        S_SUB_POOL4 = 168,                       // SUB_POOL4
+        S_SUB_RESERVATION = 169,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEFS = 170,                 // SUB_OPTION_DEFS
+        S_SUB_OPTION_DEF = 171,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 172,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 173,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 174,                   // SUB_DHCP_DDNS
+        S_SUB_LOGGING = 175,                     // SUB_LOGGING
+        S_SUB_CONFIG_CONTROL = 176,              // SUB_CONFIG_CONTROL
+        S_STRING = 177,                          // "constant string"
+        S_INTEGER = 178,                         // "integer"
+        S_FLOAT = 179,                           // "floating point"
+        S_BOOLEAN = 180,                         // "boolean"
+        S_YYACCEPT = 181,                        // $accept
+        S_start = 182,                           // start
+        S_183_1 = 183,                           // $@1
+        S_184_2 = 184,                           // $@2
+        S_185_3 = 185,                           // $@3
+        S_186_4 = 186,                           // $@4
+        S_187_5 = 187,                           // $@5
+        S_188_6 = 188,                           // $@6
+        S_189_7 = 189,                           // $@7
+        S_190_8 = 190,                           // $@8
+        S_191_9 = 191,                           // $@9
+        S_192_10 = 192,                          // $@10
+        S_193_11 = 193,                          // $@11
+        S_194_12 = 194,                          // $@12
+        S_195_13 = 195,                          // $@13
+        S_196_14 = 196,                          // $@14
+        S_value = 197,                           // value
+        S_sub_json = 198,                        // sub_json
+        S_map2 = 199,                            // map2
+        S_200_15 = 200,                          // $@15
+        S_map_value = 201,                       // map_value
+        S_map_content = 202,                     // map_content
+        S_not_empty_map = 203,                   // not_empty_map
+        S_list_generic = 204,                    // list_generic
+        S_205_16 = 205,                          // $@16
+        S_list_content = 206,                    // list_content
+        S_not_empty_list = 207,                  // not_empty_list
+        S_list_strings = 208,                    // list_strings
+        S_209_17 = 209,                          // $@17
+        S_list_strings_content = 210,            // list_strings_content
+        S_not_empty_list_strings = 211,          // not_empty_list_strings
+        S_unknown_map_entry = 212,               // unknown_map_entry
+        S_syntax_map = 213,                      // syntax_map
+        S_214_18 = 214,                          // $@18
+        S_global_objects = 215,                  // global_objects
+        S_global_object = 216,                   // global_object
+        S_dhcp4_object = 217,                    // dhcp4_object
+        S_218_19 = 218,                          // $@19
+        S_sub_dhcp4 = 219,                       // sub_dhcp4
+        S_220_20 = 220,                          // $@20
+        S_global_params = 221,                   // global_params
+        S_global_param = 222,                    // global_param
+        S_valid_lifetime = 223,                  // valid_lifetime
+        S_renew_timer = 224,                     // renew_timer
+        S_rebind_timer = 225,                    // rebind_timer
+        S_calculate_tee_times = 226,             // calculate_tee_times
+        S_t1_percent = 227,                      // t1_percent
+        S_t2_percent = 228,                      // t2_percent
+        S_decline_probation_period = 229,        // decline_probation_period
+        S_server_tag = 230,                      // server_tag
+        S_231_21 = 231,                          // $@21
+        S_echo_client_id = 232,                  // echo_client_id
+        S_match_client_id = 233,                 // match_client_id
+        S_authoritative = 234,                   // authoritative
+        S_interfaces_config = 235,               // interfaces_config
+        S_236_22 = 236,                          // $@22
+        S_interfaces_config_params = 237,        // interfaces_config_params
+        S_interfaces_config_param = 238,         // interfaces_config_param
+        S_sub_interfaces4 = 239,                 // sub_interfaces4
+        S_240_23 = 240,                          // $@23
+        S_interfaces_list = 241,                 // interfaces_list
+        S_242_24 = 242,                          // $@24
+        S_dhcp_socket_type = 243,                // dhcp_socket_type
+        S_244_25 = 244,                          // $@25
+        S_socket_type = 245,                     // socket_type
+        S_outbound_interface = 246,              // outbound_interface
+        S_247_26 = 247,                          // $@26
+        S_outbound_interface_value = 248,        // outbound_interface_value
+        S_re_detect = 249,                       // re_detect
+        S_lease_database = 250,                  // lease_database
+        S_251_27 = 251,                          // $@27
+        S_sanity_checks = 252,                   // sanity_checks
+        S_253_28 = 253,                          // $@28
+        S_sanity_checks_params = 254,            // sanity_checks_params
+        S_sanity_checks_param = 255,             // sanity_checks_param
+        S_lease_checks = 256,                    // lease_checks
+        S_257_29 = 257,                          // $@29
+        S_hosts_database = 258,                  // hosts_database
+        S_259_30 = 259,                          // $@30
+        S_hosts_databases = 260,                 // hosts_databases
+        S_261_31 = 261,                          // $@31
+        S_database_list = 262,                   // database_list
+        S_not_empty_database_list = 263,         // not_empty_database_list
+        S_database = 264,                        // database
+        S_265_32 = 265,                          // $@32
+        S_database_map_params = 266,             // database_map_params
+        S_database_map_param = 267,              // database_map_param
+        S_database_type = 268,                   // database_type
+        S_269_33 = 269,                          // $@33
+        S_db_type = 270,                         // db_type
+        S_user = 271,                            // user
+        S_272_34 = 272,                          // $@34
+        S_password = 273,                        // password
+        S_274_35 = 274,                          // $@35
+        S_host = 275,                            // host
+        S_276_36 = 276,                          // $@36
+        S_port = 277,                            // port
+        S_name = 278,                            // name
+        S_279_37 = 279,                          // $@37
+        S_persist = 280,                         // persist
+        S_lfc_interval = 281,                    // lfc_interval
+        S_lfc_in_process = 282,                  // lfc_in_process
+        S_readonly = 283,                        // readonly
+        S_connect_timeout = 284,                 // connect_timeout
+        S_request_timeout = 285,                 // request_timeout
+        S_tcp_keepalive = 286,                   // tcp_keepalive
+        S_tcp_nodelay = 287,                     // tcp_nodelay
+        S_contact_points = 288,                  // contact_points
+        S_289_38 = 289,                          // $@38
+        S_keyspace = 290,                        // keyspace
+        S_291_39 = 291,                          // $@39
+        S_consistency = 292,                     // consistency
+        S_293_40 = 293,                          // $@40
+        S_serial_consistency = 294,              // serial_consistency
+        S_295_41 = 295,                          // $@41
+        S_max_reconnect_tries = 296,             // max_reconnect_tries
+        S_reconnect_wait_time = 297,             // reconnect_wait_time
+        S_host_reservation_identifiers = 298,    // host_reservation_identifiers
+        S_299_42 = 299,                          // $@42
+        S_host_reservation_identifiers_list = 300, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 301,     // host_reservation_identifier
+        S_duid_id = 302,                         // duid_id
+        S_hw_address_id = 303,                   // hw_address_id
+        S_circuit_id = 304,                      // circuit_id
+        S_client_id = 305,                       // client_id
+        S_flex_id = 306,                         // flex_id
+        S_hooks_libraries = 307,                 // hooks_libraries
+        S_308_43 = 308,                          // $@43
+        S_hooks_libraries_list = 309,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 310,  // not_empty_hooks_libraries_list
+        S_hooks_library = 311,                   // hooks_library
+        S_312_44 = 312,                          // $@44
+        S_sub_hooks_library = 313,               // sub_hooks_library
+        S_314_45 = 314,                          // $@45
+        S_hooks_params = 315,                    // hooks_params
+        S_hooks_param = 316,                     // hooks_param
+        S_library = 317,                         // library
+        S_318_46 = 318,                          // $@46
+        S_parameters = 319,                      // parameters
+        S_320_47 = 320,                          // $@47
+        S_expired_leases_processing = 321,       // expired_leases_processing
+        S_322_48 = 322,                          // $@48
+        S_expired_leases_params = 323,           // expired_leases_params
+        S_expired_leases_param = 324,            // expired_leases_param
+        S_reclaim_timer_wait_time = 325,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 326, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 327,             // hold_reclaimed_time
+        S_max_reclaim_leases = 328,              // max_reclaim_leases
+        S_max_reclaim_time = 329,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 330,         // unwarned_reclaim_cycles
+        S_subnet4_list = 331,                    // subnet4_list
+        S_332_49 = 332,                          // $@49
+        S_subnet4_list_content = 333,            // subnet4_list_content
+        S_not_empty_subnet4_list = 334,          // not_empty_subnet4_list
+        S_subnet4 = 335,                         // subnet4
+        S_336_50 = 336,                          // $@50
+        S_sub_subnet4 = 337,                     // sub_subnet4
+        S_338_51 = 338,                          // $@51
+        S_subnet4_params = 339,                  // subnet4_params
+        S_subnet4_param = 340,                   // subnet4_param
+        S_subnet = 341,                          // subnet
+        S_342_52 = 342,                          // $@52
+        S_subnet_4o6_interface = 343,            // subnet_4o6_interface
+        S_344_53 = 344,                          // $@53
+        S_subnet_4o6_interface_id = 345,         // subnet_4o6_interface_id
+        S_346_54 = 346,                          // $@54
+        S_subnet_4o6_subnet = 347,               // subnet_4o6_subnet
+        S_348_55 = 348,                          // $@55
+        S_interface = 349,                       // interface
+        S_350_56 = 350,                          // $@56
+        S_client_class = 351,                    // client_class
+        S_352_57 = 352,                          // $@57
+        S_require_client_classes = 353,          // require_client_classes
+        S_354_58 = 354,                          // $@58
+        S_reservation_mode = 355,                // reservation_mode
+        S_356_59 = 356,                          // $@59
+        S_hr_mode = 357,                         // hr_mode
+        S_id = 358,                              // id
+        S_shared_networks = 359,                 // shared_networks
+        S_360_60 = 360,                          // $@60
+        S_shared_networks_content = 361,         // shared_networks_content
+        S_shared_networks_list = 362,            // shared_networks_list
+        S_shared_network = 363,                  // shared_network
+        S_364_61 = 364,                          // $@61
+        S_shared_network_params = 365,           // shared_network_params
+        S_shared_network_param = 366,            // shared_network_param
+        S_option_def_list = 367,                 // option_def_list
+        S_368_62 = 368,                          // $@62
+        S_sub_option_def_list = 369,             // sub_option_def_list
+        S_370_63 = 370,                          // $@63
+        S_option_def_list_content = 371,         // option_def_list_content
+        S_not_empty_option_def_list = 372,       // not_empty_option_def_list
+        S_option_def_entry = 373,                // option_def_entry
+        S_374_64 = 374,                          // $@64
+        S_sub_option_def = 375,                  // sub_option_def
+        S_376_65 = 376,                          // $@65
+        S_option_def_params = 377,               // option_def_params
+        S_not_empty_option_def_params = 378,     // not_empty_option_def_params
+        S_option_def_param = 379,                // option_def_param
+        S_option_def_name = 380,                 // option_def_name
+        S_code = 381,                            // code
+        S_option_def_code = 382,                 // option_def_code
+        S_option_def_type = 383,                 // option_def_type
+        S_384_66 = 384,                          // $@66
+        S_option_def_record_types = 385,         // option_def_record_types
+        S_386_67 = 386,                          // $@67
+        S_space = 387,                           // space
+        S_388_68 = 388,                          // $@68
+        S_option_def_space = 389,                // option_def_space
+        S_option_def_encapsulate = 390,          // option_def_encapsulate
+        S_391_69 = 391,                          // $@69
+        S_option_def_array = 392,                // option_def_array
+        S_option_data_list = 393,                // option_data_list
+        S_394_70 = 394,                          // $@70
+        S_option_data_list_content = 395,        // option_data_list_content
+        S_not_empty_option_data_list = 396,      // not_empty_option_data_list
+        S_option_data_entry = 397,               // option_data_entry
+        S_398_71 = 398,                          // $@71
+        S_sub_option_data = 399,                 // sub_option_data
+        S_400_72 = 400,                          // $@72
+        S_option_data_params = 401,              // option_data_params
+        S_not_empty_option_data_params = 402,    // not_empty_option_data_params
+        S_option_data_param = 403,               // option_data_param
+        S_option_data_name = 404,                // option_data_name
+        S_option_data_data = 405,                // option_data_data
+        S_406_73 = 406,                          // $@73
+        S_option_data_code = 407,                // option_data_code
+        S_option_data_space = 408,               // option_data_space
+        S_option_data_csv_format = 409,          // option_data_csv_format
+        S_option_data_always_send = 410,         // option_data_always_send
+        S_pools_list = 411,                      // pools_list
+        S_412_74 = 412,                          // $@74
+        S_pools_list_content = 413,              // pools_list_content
+        S_not_empty_pools_list = 414,            // not_empty_pools_list
+        S_pool_list_entry = 415,                 // pool_list_entry
+        S_416_75 = 416,                          // $@75
+        S_sub_pool4 = 417,                       // sub_pool4
+        S_418_76 = 418,                          // $@76
+        S_pool_params = 419,                     // pool_params
+        S_pool_param = 420,                      // pool_param
+        S_pool_entry = 421,                      // pool_entry
+        S_422_77 = 422,                          // $@77
+        S_user_context = 423,                    // user_context
+        S_424_78 = 424,                          // $@78
+        S_comment = 425,                         // comment
+        S_426_79 = 426,                          // $@79
+        S_reservations = 427,                    // reservations
+        S_428_80 = 428,                          // $@80
+        S_reservations_list = 429,               // reservations_list
+        S_not_empty_reservations_list = 430,     // not_empty_reservations_list
+        S_reservation = 431,                     // reservation
+        S_432_81 = 432,                          // $@81
+        S_sub_reservation = 433,                 // sub_reservation
+        S_434_82 = 434,                          // $@82
+        S_reservation_params = 435,              // reservation_params
+        S_not_empty_reservation_params = 436,    // not_empty_reservation_params
+        S_reservation_param = 437,               // reservation_param
+        S_next_server = 438,                     // next_server
+        S_439_83 = 439,                          // $@83
+        S_server_hostname = 440,                 // server_hostname
+        S_441_84 = 441,                          // $@84
+        S_boot_file_name = 442,                  // boot_file_name
+        S_443_85 = 443,                          // $@85
+        S_ip_address = 444,                      // ip_address
+        S_445_86 = 445,                          // $@86
+        S_ip_addresses = 446,                    // ip_addresses
+        S_447_87 = 447,                          // $@87
+        S_duid = 448,                            // duid
+        S_449_88 = 449,                          // $@88
+        S_hw_address = 450,                      // hw_address
+        S_451_89 = 451,                          // $@89
+        S_client_id_value = 452,                 // client_id_value
+        S_453_90 = 453,                          // $@90
+        S_circuit_id_value = 454,                // circuit_id_value
+        S_455_91 = 455,                          // $@91
+        S_flex_id_value = 456,                   // flex_id_value
+        S_457_92 = 457,                          // $@92
+        S_hostname = 458,                        // hostname
+        S_459_93 = 459,                          // $@93
+        S_reservation_client_classes = 460,      // reservation_client_classes
+        S_461_94 = 461,                          // $@94
+        S_relay = 462,                           // relay
+        S_463_95 = 463,                          // $@95
+        S_relay_map = 464,                       // relay_map
+        S_client_classes = 465,                  // client_classes
+        S_466_96 = 466,                          // $@96
+        S_client_classes_list = 467,             // client_classes_list
+        S_client_class_entry = 468,              // client_class_entry
+        S_469_97 = 469,                          // $@97
+        S_client_class_params = 470,             // client_class_params
+        S_not_empty_client_class_params = 471,   // not_empty_client_class_params
+        S_client_class_param = 472,              // client_class_param
+        S_client_class_name = 473,               // client_class_name
+        S_client_class_test = 474,               // client_class_test
+        S_475_98 = 475,                          // $@98
+        S_only_if_required = 476,                // only_if_required
+        S_dhcp4o6_port = 477,                    // dhcp4o6_port
+        S_control_socket = 478,                  // control_socket
+        S_479_99 = 479,                          // $@99
+        S_control_socket_params = 480,           // control_socket_params
+        S_control_socket_param = 481,            // control_socket_param
+        S_control_socket_type = 482,             // control_socket_type
+        S_483_100 = 483,                         // $@100
+        S_control_socket_name = 484,             // control_socket_name
+        S_485_101 = 485,                         // $@101
+        S_config_output_threads = 486,           // config_output_threads
+        S_dhcp_queue_control = 487,              // dhcp_queue_control
+        S_488_102 = 488,                         // $@102
+        S_dhcp_ddns = 489,                       // dhcp_ddns
+        S_490_103 = 490,                         // $@103
+        S_sub_dhcp_ddns = 491,                   // sub_dhcp_ddns
+        S_492_104 = 492,                         // $@104
+        S_dhcp_ddns_params = 493,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 494,                 // dhcp_ddns_param
+        S_enable_updates = 495,                  // enable_updates
+        S_qualifying_suffix = 496,               // qualifying_suffix
+        S_497_105 = 497,                         // $@105
+        S_server_ip = 498,                       // server_ip
+        S_499_106 = 499,                         // $@106
+        S_server_port = 500,                     // server_port
+        S_sender_ip = 501,                       // sender_ip
+        S_502_107 = 502,                         // $@107
+        S_sender_port = 503,                     // sender_port
+        S_max_queue_size = 504,                  // max_queue_size
+        S_ncr_protocol = 505,                    // ncr_protocol
+        S_506_108 = 506,                         // $@108
+        S_ncr_protocol_value = 507,              // ncr_protocol_value
+        S_ncr_format = 508,                      // ncr_format
+        S_509_109 = 509,                         // $@109
+        S_ncr_format_value = 510,                // ncr_format_value
+        S_override_no_update = 511,              // override_no_update
+        S_override_client_update = 512,          // override_client_update
+        S_replace_client_name = 513,             // replace_client_name
+        S_514_110 = 514,                         // $@110
+        S_replace_client_name_value = 515,       // replace_client_name_value
+        S_generated_prefix = 516,                // generated_prefix
+        S_517_111 = 517,                         // $@111
+        S_hostname_char_set = 518,               // hostname_char_set
+        S_519_112 = 519,                         // $@112
+        S_hostname_char_replacement = 520,       // hostname_char_replacement
+        S_521_113 = 521,                         // $@113
+        S_dhcp6_json_object = 522,               // dhcp6_json_object
+        S_523_114 = 523,                         // $@114
+        S_dhcpddns_json_object = 524,            // dhcpddns_json_object
+        S_525_115 = 525,                         // $@115
+        S_control_agent_json_object = 526,       // control_agent_json_object
+        S_527_116 = 527,                         // $@116
+        S_config_control = 528,                  // config_control
+        S_529_117 = 529,                         // $@117
+        S_sub_config_control = 530,              // sub_config_control
+        S_531_118 = 531,                         // $@118
+        S_config_control_params = 532,           // config_control_params
+        S_config_control_param = 533,            // config_control_param
+        S_config_databases = 534,                // config_databases
+        S_535_119 = 535,                         // $@119
+        S_config_fetch_wait_time = 536,          // config_fetch_wait_time
+        S_logging_object = 537,                  // logging_object
+        S_538_120 = 538,                         // $@120
+        S_sub_logging = 539,                     // sub_logging
+        S_540_121 = 540,                         // $@121
+        S_logging_params = 541,                  // logging_params
+        S_logging_param = 542,                   // logging_param
+        S_loggers = 543,                         // loggers
+        S_544_122 = 544,                         // $@122
+        S_loggers_entries = 545,                 // loggers_entries
+        S_logger_entry = 546,                    // logger_entry
+        S_547_123 = 547,                         // $@123
+        S_logger_params = 548,                   // logger_params
+        S_logger_param = 549,                    // logger_param
+        S_debuglevel = 550,                      // debuglevel
+        S_severity = 551,                        // severity
+        S_552_124 = 552,                         // $@124
+        S_output_options_list = 553,             // output_options_list
+        S_554_125 = 554,                         // $@125
+        S_output_options_list_content = 555,     // output_options_list_content
+        S_output_entry = 556,                    // output_entry
+        S_557_126 = 557,                         // $@126
+        S_output_params_list = 558,              // output_params_list
+        S_output_params = 559,                   // output_params
+        S_output = 560,                          // output
+        S_561_127 = 561,                         // $@127
+        S_flush = 562,                           // flush
+        S_maxsize = 563,                         // maxsize
+        S_maxver = 564,                          // maxver
+        S_async = 565,                           // async
+        S_queue_size = 566,                      // queue_size
+        S_overflow = 567,                        // overflow
+        S_568_128 = 568                          // $@128
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -652,20 +1286,59 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ()
+      basic_symbol () YY_NOEXCEPT
         : value ()
         , location ()
       {}
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      basic_symbol (basic_symbol&& that);
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
 
       /// Copy constructor.
       basic_symbol (const basic_symbol& that);
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      /// Constructors for typed symbols.
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, location_type&& l)
         : Base (t)
@@ -677,6 +1350,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
         : Base (t)
@@ -690,6 +1364,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
         : Base (t)
@@ -703,6 +1378,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
         : Base (t)
@@ -716,6 +1392,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
         : Base (t)
@@ -729,6 +1406,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
         : Base (t)
@@ -749,46 +1427,49 @@ namespace isc { namespace dhcp {
         clear ();
       }
 
+
+
       /// Destroy contents, and record that is empty.
-      void clear ()
+      void clear () YY_NOEXCEPT
       {
         // User destructor.
-        symbol_number_type yytype = this->type_get ();
+        symbol_kind_type yykind = this->kind ();
         basic_symbol<Base>& yysym = *this;
         (void) yysym;
-        switch (yytype)
+        switch (yykind)
         {
        default:
           break;
         }
 
-        // Type destructor.
-switch (yytype)
+        // Value type destructor.
+switch (yykind)
     {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -799,6 +1480,15 @@ switch (yytype)
         Base::clear ();
       }
 
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp4Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
       /// Whether empty.
       bool empty () const YY_NOEXCEPT;
 
@@ -806,7 +1496,7 @@ switch (yytype)
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -819,125 +1509,132 @@ switch (yytype)
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      by_type (by_type&& that);
+      by_kind (by_kind&& that) YY_NOEXCEPT;
 #endif
 
       /// Copy constructor.
-      by_type (const by_type& that);
-
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const YY_NOEXCEPT;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    struct symbol_type : basic_symbol<by_type>
+    struct symbol_type : basic_symbol<by_kind>
     {
       /// Superclass.
-      typedef basic_symbol<by_type> super_type;
+      typedef basic_symbol<by_kind> super_type;
 
       /// Empty symbol.
-      symbol_type () {}
+      symbol_type () YY_NOEXCEPT {}
 
       /// Constructor for valueless symbols, and symbols from each type.
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, location_type l)
-        : super_type(token_type (tok), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
-      }
+        : super_type (token_kind_type (tok), std::move (l))
 #else
       symbol_type (int tok, const location_type& l)
-        : super_type(token_type (tok), l)
+        : super_type (token_kind_type (tok), l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER4_error <= tok && tok <= token::TOKEN_SUB_CONFIG_CONTROL));
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, bool v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const bool& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_BOOLEAN);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, double v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const double& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_FLOAT);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, int64_t v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const int64_t& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_INTEGER);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, std::string v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const std::string& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_STRING);
 #endif
+      }
     };
 
     /// Build a parser object.
     Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg);
     virtual ~Dhcp4Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp4Parser (const Dhcp4Parser&) = delete;
+    /// Non copyable.
+    Dhcp4Parser& operator= (const Dhcp4Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -968,7 +1665,11 @@ switch (yytype)
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Implementation of make_symbol for each symbol type.
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -984,6 +1685,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_END, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1614,6 +2345,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_LFC_INTERVAL, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_IN_PROCESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_IN_PROCESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_IN_PROCESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_IN_PROCESS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -2769,6 +3515,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_SOCKET_NAME, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_OUTPUT_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_OUTPUT_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_OUTPUT_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_OUTPUT_THREADS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3024,6 +3785,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_JSON, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3249,6 +4025,51 @@ switch (yytype)
         return symbol_type (token::TOKEN_MAXVER, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3566,93 +4387,119 @@ switch (yytype)
 #endif
 
 
+    class context
+    {
+    public:
+      context (const Dhcp4Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const Dhcp4Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     Dhcp4Parser (const Dhcp4Parser&);
+    /// Non copyable.
     Dhcp4Parser& operator= (const Dhcp4Parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const short yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short yydefact_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  static const short yycheck_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short yystos_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short yyr1_[];
+    static const short yycheck_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if PARSER4_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -3673,7 +4520,7 @@ switch (yytype)
       /// Default constructor.
       by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
@@ -3685,15 +4532,16 @@ switch (yytype)
       /// Record that this symbol is empty.
       void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -3715,6 +4563,10 @@ switch (yytype)
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
 #endif
     };
 
@@ -3724,48 +4576,38 @@ switch (yytype)
     {
     public:
       // Hide our reversed order.
-      typedef typename S::reverse_iterator iterator;
-      typedef typename S::const_reverse_iterator const_iterator;
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
       typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
 
-      stack (size_type n = 200)
+      stack (size_type n = 200) YY_NOEXCEPT
         : seq_ (n)
       {}
 
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (size_type i)
-      {
-        return seq_[size () - 1 - i];
-      }
-
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (int i)
-      {
-        return operator[] (size_type (i));
-      }
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
       const T&
-      operator[] (size_type i) const
+      operator[] (index_type i) const
       {
-        return seq_[size () - 1 - i];
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
-      const T&
-      operator[] (int i) const
+      T&
+      operator[] (index_type i)
       {
-        return operator[] (size_type (i));
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Steal the contents of \a t.
@@ -3780,7 +4622,7 @@ switch (yytype)
 
       /// Pop elements from the stack.
       void
-      pop (int n = 1) YY_NOEXCEPT
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
       {
         for (; 0 < n; --n)
           seq_.pop_back ();
@@ -3794,49 +4636,53 @@ switch (yytype)
       }
 
       /// Number of elements on the stack.
-      size_type
+      index_type
       size () const YY_NOEXCEPT
       {
-        return seq_.size ();
+        return index_type (seq_.size ());
       }
 
       /// Iterator on top of the stack (going downwards).
       const_iterator
       begin () const YY_NOEXCEPT
       {
-        return seq_.rbegin ();
+        return seq_.begin ();
       }
 
       /// Bottom of the stack.
       const_iterator
       end () const YY_NOEXCEPT
       {
-        return seq_.rend ();
+        return seq_.end ();
       }
 
       /// Present a slice of the top of a stack.
       class slice
       {
       public:
-        slice (const stack& stack, int range)
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
           : stack_ (stack)
           , range_ (range)
         {}
 
         const T&
-        operator[] (int i) const
+        operator[] (index_type i) const
         {
           return stack_[range_ - i];
         }
 
       private:
         const stack& stack_;
-        int range_;
+        index_type range_;
       };
 
     private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
       stack (const stack&);
+      /// Non copyable.
       stack& operator= (const stack&);
+#endif
       /// The wrapped container.
       S seq_;
     };
@@ -3864,33 +4710,30 @@ switch (yytype)
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 1040,     ///< Last index in yytable_.
-      yynnts_ = 381,  ///< Number of nonterminal symbols.
-      yyfinal_ = 30, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 175  ///< Number of tokens.
+      yylast_ = 1050,     ///< Last index in yytable_.
+      yynnts_ = 388,  ///< Number of nonterminal symbols.
+      yyfinal_ = 30 ///< Termination state number.
     };
 
 
     // User arguments.
     isc::dhcp::Parser4Context& ctx;
+
   };
 
   inline
-  Dhcp4Parser::token_number_type
-  Dhcp4Parser::yytranslate_ (token_type t)
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
     // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
     // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const unsigned char
     translate_table[] =
     {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -3935,95 +4778,54 @@ switch (yytype)
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   167,   168,   169,   170,   171,   172,   173,   174
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180
     };
-    const unsigned user_token_number_max_ = 429;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 435;
 
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
   // basic_symbol.
-#if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (basic_symbol&& that)
-    : Base (std::move (that))
-    , value ()
-    , location (std::move (that.location))
-  {
-    switch (this->type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
-        value.move< ElementPtr > (std::move (that.value));
-        break;
-
-      case 174: // "boolean"
-        value.move< bool > (std::move (that.value));
-        break;
-
-      case 173: // "floating point"
-        value.move< double > (std::move (that.value));
-        break;
-
-      case 172: // "integer"
-        value.move< int64_t > (std::move (that.value));
-        break;
-
-      case 171: // "constant string"
-        value.move< std::string > (std::move (that.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-#endif
-
   template <typename Base>
   Dhcp4Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
     : Base (that)
     , value ()
     , location (that.location)
   {
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4035,11 +4837,20 @@ switch (yytype)
 
 
 
+
+  template <typename Base>
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
   bool
   Dhcp4Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -4047,32 +4858,33 @@ switch (yytype)
   Dhcp4Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 191: // value
-      case 195: // map_value
-      case 239: // socket_type
-      case 242: // outbound_interface_value
-      case 264: // db_type
-      case 350: // hr_mode
-      case 499: // ncr_protocol_value
-      case 506: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 174: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 173: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 172: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 171: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4083,88 +4895,67 @@ switch (yytype)
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  Dhcp4Parser::by_type::by_type ()
-    : type (empty_symbol)
+  Dhcp4Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
 #if 201103L <= YY_CPLUSPLUS
   inline
-  Dhcp4Parser::by_type::by_type (by_type&& that)
-    : type (that.type)
+  Dhcp4Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
     that.clear ();
   }
 #endif
 
   inline
-  Dhcp4Parser::by_type::by_type (const by_type& that)
-    : type (that.type)
+  Dhcp4Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  Dhcp4Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  Dhcp4Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  Dhcp4Parser::by_type::clear ()
+  Dhcp4Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  Dhcp4Parser::by_type::move (by_type& that)
+  Dhcp4Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  Dhcp4Parser::by_type::type_get () const YY_NOEXCEPT
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return type;
+    return kind_;
   }
 
+
   inline
-  Dhcp4Parser::token_type
-  Dhcp4Parser::by_type::token () const YY_NOEXCEPT
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429
-    };
-    return token_type (yytoken_number_[type]);
+    return this->kind ();
   }
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:401
+
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4168 "dhcp4_parser.h" // lalr1.cc:401
+#line 4959 "dhcp4_parser.h"
 
 
 
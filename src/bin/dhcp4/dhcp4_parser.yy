@@ -89,6 +89,7 @@ using namespace std;
   PORT "port"
   PERSIST "persist"
   LFC_INTERVAL "lfc-interval"
+  LFC_IN_PROCESS "lfc-in-process"
   READONLY "readonly"
   CONNECT_TIMEOUT "connect-timeout"
   CONTACT_POINTS "contact-points"
@@ -178,6 +179,7 @@ using namespace std;
   CONTROL_SOCKET "control-socket"
   SOCKET_TYPE "socket-type"
   SOCKET_NAME "socket-name"
+  CONFIG_OUTPUT_THREADS "config-output-threads"
 
   DHCP_QUEUE_CONTROL "dhcp-queue-control"
 
@@ -197,6 +199,7 @@ using namespace std;
   GENERATED_PREFIX "generated-prefix"
   TCP "tcp"
   JSON "JSON"
+  BINARY "BINARY"
   WHEN_PRESENT "when-present"
   NEVER "never"
   ALWAYS "always"
@@ -213,6 +216,9 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow"
 
   DHCP6 "Dhcp6"
   DHCPDDNS "DhcpDdns"
@@ -248,6 +254,7 @@ using namespace std;
 %type <ElementPtr> db_type
 %type <ElementPtr> hr_mode
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 %type <ElementPtr> replace_client_name_value
 
 %printer { yyoutput << $$; } <*>;
@@ -708,6 +715,7 @@ database_map_param: database_type
                   | name
                   | persist
                   | lfc_interval
+                  | lfc_in_process
                   | readonly
                   | connect_timeout
                   | contact_points
@@ -782,6 +790,11 @@ lfc_interval: LFC_INTERVAL COLON INTEGER {
     ctx.stack_.back()->set("lfc-interval", n);
 };
 
+lfc_in_process: LFC_IN_PROCESS COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-in-process", n);
+};
+
 readonly: READONLY COLON BOOLEAN {
     ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("readonly", n);
@@ -1864,6 +1877,7 @@ control_socket_params: control_socket_param
 
 control_socket_param: control_socket_type
                     | control_socket_name
+                    | config_output_threads
                     | user_context
                     | comment
                     | unknown_map_entry
@@ -1885,6 +1899,11 @@ control_socket_name: SOCKET_NAME {
     ctx.leave();
 };
 
+config_output_threads: CONFIG_OUTPUT_THREADS COLON INTEGER {
+    ElementPtr threads(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("config-output-threads", threads);
+};
+
 
 // --- dhcp-queue-control ---------------------------------------------
 
@@ -2030,12 +2049,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 override_no_update: OVERRIDE_NO_UPDATE COLON BOOLEAN {
     ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("override-no-update", b);
@@ -2281,6 +2304,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow
              ;
 
 output: OUTPUT {
@@ -2306,6 +2332,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr queue_size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+};
+
+overflow: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr overflow(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+};
+
 %%
 
 void
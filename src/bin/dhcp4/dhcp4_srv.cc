@@ -48,6 +48,7 @@
 #include <util/strutil.h>
 #include <stats/stats_mgr.h>
 #include <log/logger.h>
+#include <log/logger_manager.h>
 #include <cryptolink/cryptolink.h>
 #include <cfgrpt/config_report.h>
 
@@ -108,6 +109,24 @@ struct Dhcp4Hooks {
     }
 };
 
+/// @brief Returns the flattened view of the options configured for a client.
+///
+/// The options of the client's host reservation, if any, head the list.
+/// They are specific to the client, so they are laid over the cached view
+/// of the rest of the list rather than cached.
+///
+/// @param ex DHCPv4 exchange holding the configured option list.
+/// @return the flattened view.
+ConstCfgOptionFlatPtr
+getCfgOptionFlat(Dhcpv4Exchange& ex) {
+    const CfgOptionList& co_list = ex.getCfgOptionList();
+    const ConstHostPtr& host = ex.getContext()->currentHost();
+    const size_t uncached = (host && !co_list.empty() &&
+                             (co_list.front() == host->getCfgOption4())) ? 1 : 0;
+    return (CfgMgr::instance().getCurrentCfg()->getCfgOptionFlatCache()->
+            get(DHCP4_OPTION_SPACE, co_list, uncached));
+}
+
 } // end of anonymous namespace
 
 // Declare a Hooks object. As this is outside any function or method, it
@@ -734,10 +753,21 @@ Dhcpv4Srv::sendPacket(const Pkt4Ptr& packet) {
 
 bool
 Dhcpv4Srv::run() {
+    // Number of log messages dropped by the asynchronous loggers which
+    // has been reported in the statistics.
+    uint64_t dropped_logs = 0;
     while (!shutdown_) {
         try {
             run_one();
             getIOService()->poll();
+
+            // Account for the log messages dropped since the last iteration.
+            const uint64_t dropped = LoggerManager::getDroppedMessagesNum();
+            if (dropped != dropped_logs) {
+                isc::stats::StatsMgr::instance().addValue("log-messages-dropped",
+                    static_cast<int64_t>(dropped - dropped_logs));
+                dropped_logs = dropped;
+            }
         } catch (const std::exception& e) {
             // General catch-all exception that are not caught by more specific
             // catches. This one is for exceptions derived from std::exception.
@@ -1413,24 +1443,15 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
     if (option_prl) {
         requested_opts = option_prl->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
-            }
-        }
+
+    // Get the flattened view of the configured option list.
+    ConstCfgOptionFlatPtr flat = getCfgOptionFlat(ex);
+
+    // Add persistent options
+    const std::vector<uint16_t>& persistent = flat->getPersistent();
+    for (std::vector<uint16_t>::const_iterator code = persistent.begin();
+         code != persistent.end(); ++code) {
+        requested_opts.push_back(static_cast<uint8_t>(*code));
     }
 
     // For each requested option code get the instance of the option
@@ -1439,15 +1460,9 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
          opt != requested_opts.end(); ++opt) {
         // Add nothing when it is already there
         if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            OptionPtr option = flat->get(*opt);
+            if (option) {
+                resp->addOption(option);
             }
         }
     }
@@ -1597,20 +1612,18 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
 
     Pkt4Ptr resp = ex.getResponse();
 
+    // Get the flattened view of the configured option list.
+    ConstCfgOptionFlatPtr flat = getCfgOptionFlat(ex);
+
     // Try to find all 'required' options in the outgoing
     // message. Those that are not present will be added.
     for (int i = 0; i < required_options_size; ++i) {
         OptionPtr opt = resp->getOption(required_options[i]);
         if (!opt) {
             // Check whether option has been configured.
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE,
-                                                      required_options[i]);
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            opt = flat->get(required_options[i]);
+            if (opt) {
+                resp->addOption(opt);
             }
         }
     }
@@ -1413,6 +1413,129 @@ TEST_F(CtrlChannelDhcpv4SrvTest, longResponse) {
     EXPECT_EQ(reference_response, response.str());
 }
 
+// This test verifies that the connection is kept open after the response
+// when the client asks for it and that the server closes it silently
+// when no other command arrives.
+TEST_F(CtrlChannelDhcpv4SrvTest, keepAlive) {
+    createUnixChannelServer();
+
+    // Set connection timeout to 2s to prevent long waiting time for the
+    // timeout during this test.
+    const unsigned short timeout = 2000;
+    CommandMgr::instance().setConnectionTimeout(timeout);
+
+    // Server's responses will be assigned to these variables.
+    std::string response1;
+    std::string response2;
+    std::string response3;
+
+    // It is useful to create a thread and run the server and the client
+    // at the same time and independently.
+    std::thread th([this, &response1, &response2, &response3]() {
+
+        // IO service will be stopped automatically when this object goes
+        // out of scope and is destroyed. This is useful because we use
+        // asserts which may break the thread in various exit points.
+        IOServiceWork work(getIOService());
+
+        // Create the client and connect it to the server.
+        boost::scoped_ptr<UnixControlClient> client(new UnixControlClient());
+        ASSERT_TRUE(client);
+        ASSERT_TRUE(client->connectToServer(socket_path_));
+
+        // Send two commands over the same connection.
+        std::string command = "{ \"command\": \"list-commands\", "
+            "\"keep-alive\": true }";
+        const unsigned int timeout = 15;
+        ASSERT_TRUE(client->sendCommand(command));
+        ASSERT_TRUE(client->getResponse(response1, timeout));
+        ASSERT_TRUE(client->sendCommand(command));
+        ASSERT_TRUE(client->getResponse(response2, timeout));
+
+        // The server should close the connection when the timeout elapses
+        // without sending anything.
+        ASSERT_TRUE(client->getResponse(response3, timeout));
+
+        // Explicitly close the client's connection.
+        client->disconnectFromServer();
+    });
+
+    // Run the server until stopped.
+    getIOService()->run();
+
+    // Wait for the thread to return.
+    th.join();
+
+    // Both commands have been processed, the keep-alive parameter is not
+    // seen by the command handlers.
+    checkListCommands(isc::data::Element::fromJSON(response1), "list-commands");
+    EXPECT_EQ(response1, response2);
+    EXPECT_TRUE(response3.empty());
+}
+
+// This test verifies that the responses to config-get and config-write are
+// sent when they are produced by the command threads.
+TEST_F(CtrlChannelDhcpv4SrvTest, configOutputThreads) {
+    createUnixChannelServer();
+
+    // Reopen the control socket with two config output threads.
+    CommandMgr::instance().closeCommandSocket();
+    ConstElementPtr socket_info =
+        Element::fromJSON("{ \"socket-type\": \"unix\", \"socket-name\": \"" +
+                          socket_path_ + "\", \"config-output-threads\": 2 }");
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+
+    // Server's responses will be assigned to these variables.
+    std::string response1;
+    std::string response2;
+
+    // The server must keep running its IO service to send the responses
+    // produced by the command threads, so the client runs in a thread.
+    std::thread th([this, &response1, &response2]() {
+
+        // IO service will be stopped automatically when this object goes
+        // out of scope and is destroyed. This is useful because we use
+        // asserts which may break the thread in various exit points.
+        IOServiceWork work(getIOService());
+
+        // Create the client and connect it to the server.
+        boost::scoped_ptr<UnixControlClient> client(new UnixControlClient());
+        ASSERT_TRUE(client);
+        ASSERT_TRUE(client->connectToServer(socket_path_));
+
+        // Send both commands over the same connection.
+        const unsigned int timeout = 15;
+        ASSERT_TRUE(client->sendCommand("{ \"command\": \"config-get\", "
+                                        "\"keep-alive\": true }"));
+        ASSERT_TRUE(client->getResponse(response1, timeout));
+        ASSERT_TRUE(client->sendCommand("{ \"command\": \"config-write\", "
+                                        "\"arguments\": { \"filename\": "
+                                        "\"test3.json\" } }"));
+        ASSERT_TRUE(client->getResponse(response2, timeout));
+
+        // Explicitly close the client's connection.
+        client->disconnectFromServer();
+    });
+
+    // Run the server until stopped.
+    getIOService()->run();
+
+    // Wait for the thread to return.
+    th.join();
+
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response1));
+    int status;
+    ConstElementPtr cfg = parseAnswer(status, rsp);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status);
+    ASSERT_TRUE(cfg);
+    ASSERT_EQ(Element::map, cfg->getType());
+    EXPECT_TRUE(cfg->get("Dhcp4"));
+
+    checkConfigWrite(response2, CONTROL_RESULT_SUCCESS, "test3.json");
+    ::remove("test3.json");
+}
+
 // This test verifies that the server signals timeout if the transmission
 // takes too long, after receiving a partial command.
 TEST_F(CtrlChannelDhcpv4SrvTest, connectionTimeoutPartialCommand) {
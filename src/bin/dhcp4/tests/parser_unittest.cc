@@ -318,6 +318,31 @@ TEST(ParserTest, outboundIface) {
     EXPECT_EQ("use-routing", tmp->stringValue());
 }
 
+// Checks that the in-process lease file cleanup can be enabled.
+TEST(ParserTest, lfcInProcess) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"lfc-interval\": 3600,"
+        " \"lfc-in-process\": true } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the number of config output threads can be specified.
+TEST(ParserTest, configOutputThreads) {
+    string txt = "{ \"Dhcp4\": { \"control-socket\": {"
+        " \"socket-type\": \"unix\", \"socket-name\": \"/tmp/kea4-ctrl\","
+        " \"config-output-threads\": 2 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser4Context::PARSER_DHCP4));
+    ConstElementPtr threads = json->get("Dhcp4")->get("control-socket")->
+        get("config-output-threads");
+    ASSERT_TRUE(threads);
+    ASSERT_EQ(Element::integer, threads->getType());
+    EXPECT_EQ(2, threads->intValue());
+}
+
 /// @brief Tests error conditions in Dhcp4Parser
 ///
 /// @param txt text to be parsed
@@ -341,6 +366,15 @@ void testError(const std::string& txt,
     }
 }
 
+// Checks that the number of config output threads must be an integer.
+TEST(ParserTest, configOutputThreadsErrors) {
+    testError("{ \"Dhcp4\": { \"control-socket\": {\n"
+              "  \"config-output-threads\": \"2\" } } }\n",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:2.28-30: syntax error, unexpected constant string, "
+              "expecting integer");
+}
+
 // Verify that error conditions are handled correctly.
 TEST(ParserTest, errors) {
     // no input
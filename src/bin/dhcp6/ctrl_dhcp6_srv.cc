@@ -19,6 +19,7 @@
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
 #include <cfgrpt/config_report.h>
+#include <util/threads/sync.h>
 #include <signal.h>
 #include <sstream>
 
@@ -49,6 +50,10 @@ struct CtrlDhcp6Hooks {
 // module is called.
 CtrlDhcp6Hooks Hooks;
 
+/// @brief Serializes the writes of the configuration files by the command
+/// threads.
+isc::util::thread::Mutex config_write_mutex;
+
 // Name of the file holding server identifier.
 static const char* SERVER_DUID_FILE = "kea-dhcp6-serverid";
 
@@ -243,7 +248,11 @@ ControlledDhcpv6Srv::commandConfigGetHandler(const string&,
                                              ConstElementPtr /*args*/) {
     ConstElementPtr config = CfgMgr::instance().getCurrentCfg()->toElement();
 
-    return (createAnswer(0, config));
+    // Converting a large configuration to text takes time, so it is done
+    // by a command thread, if any.
+    return (CommandMgr::instance().deferResponse([config]() {
+        return (createAnswer(0, config));
+    }));
 }
 
 ConstElementPtr
@@ -275,27 +284,40 @@ ControlledDhcpv6Srv::commandConfigWriteHandler(const string&, ConstElementPtr ar
                              "Please specify filename explicitly."));
     }
 
-    // Ok, it's time to write the file.
-    size_t size = 0;
+    // The configuration is converted to elements here, so as it is
+    // consistent, and written to the file by a command thread, if any.
+    ConstElementPtr cfg;
     try {
-        ConstElementPtr cfg = CfgMgr::instance().getCurrentCfg()->toElement();
-        size = writeConfigFile(filename, cfg);
+        cfg = CfgMgr::instance().getCurrentCfg()->toElement();
     } catch (const isc::Exception& ex) {
         return (createAnswer(CONTROL_RESULT_ERROR, string("Error during write-config:")
                              + ex.what()));
     }
-    if (size == 0) {
-        return (createAnswer(CONTROL_RESULT_ERROR, "Error writing configuration to "
-                             + filename));
-    }
 
-    // Ok, it's time to return the successful response.
-    ElementPtr params = Element::createMap();
-    params->set("size", Element::create(static_cast<long long>(size)));
-    params->set("filename", Element::create(filename));
+    return (CommandMgr::instance().deferResponse([this, filename, cfg]()
+                                                 -> ConstElementPtr {
+        // Ok, it's time to write the file.
+        size_t size = 0;
+        try {
+            isc::util::thread::Mutex::Locker lock(config_write_mutex);
+            size = writeConfigFile(filename, cfg);
+        } catch (const isc::Exception& ex) {
+            return (createAnswer(CONTROL_RESULT_ERROR, string("Error during write-config:")
+                                 + ex.what()));
+        }
+        if (size == 0) {
+            return (createAnswer(CONTROL_RESULT_ERROR, "Error writing configuration to "
+                                 + filename));
+        }
+
+        // Ok, it's time to return the successful response.
+        ElementPtr params = Element::createMap();
+        params->set("size", Element::create(static_cast<long long>(size)));
+        params->set("filename", Element::create(filename));
 
-    return (createAnswer(CONTROL_RESULT_SUCCESS, "Configuration written to "
-                         + filename + " successful", params));
+        return (createAnswer(CONTROL_RESULT_SUCCESS, "Configuration written to "
+                             + filename + " successful", params));
+    }));
 }
 
 ConstElementPtr
@@ -1,6 +1,6 @@
-#line 2 "dhcp6_lexer.cc"
+#line 1 "dhcp6_lexer.cc"
 
-#line 4 "dhcp6_lexer.cc"
+#line 3 "dhcp6_lexer.cc"
 
 #define  YY_INT_ALIGNED short int
 
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 183
-#define YY_END_OF_BUFFER 184
+#define YY_NUM_RULES 189
+#define YY_END_OF_BUFFER 190
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,174 +700,178 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1505] =
+static const flex_int16_t yy_accept[1551] =
     {   0,
-      176,  176,    0,    0,    0,    0,    0,    0,    0,    0,
-      184,  182,   10,   11,  182,    1,  176,  173,  176,  176,
-      182,  175,  174,  182,  182,  182,  182,  182,  169,  170,
-      182,  182,  182,  171,  172,    5,    5,    5,  182,  182,
-      182,   10,   11,    0,    0,  165,    0,    0,    0,    0,
+      182,  182,    0,    0,    0,    0,    0,    0,    0,    0,
+      190,  188,   10,   11,  188,    1,  182,  179,  182,  182,
+      188,  181,  180,  188,  188,  188,  188,  188,  175,  176,
+      188,  188,  188,  177,  178,    5,    5,    5,  188,  188,
+      188,   10,   11,    0,    0,  171,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  176,
-      176,    0,  175,  176,    3,    2,    6,    0,  176,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
+      182,  182,    0,  181,    3,    2,    6,    0,  182,    0,
+        0,    0,    0,    0,    0,    4,    0,    0,    9,  172,
 
-      166,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  168,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  174,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
         0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
-      143,    0,    0,  144,    0,    0,    0,    0,    0,    0,
+        0,  148,    0,    0,  149,    0,    0,    0,    0,    0,
 
-        0,    0,  167,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  173,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   98,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  100,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      181,  179,    0,  178,  177,    0,    0,    0,    0,    0,
+        0,    0,  187,  185,    0,  184,  183,    0,    0,    0,
 
-        0,    0,  142,    0,    0,   28,    0,   27,    0,    0,
-      105,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       55,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  147,    0,    0,   28,    0,
+       27,    0,    0,  107,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   56,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      102,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  104,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,  180,  177,    0,    0,    0,    0,    0,    0,
-        0,    0,   29,    0,    0,   31,    0,    0,    0,    0,
-        0,  106,    0,    0,    0,    0,    0,    0,    0,   83,
-        0,    0,    0,    0,    0,    0,    0,  127,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   58,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  186,  183,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   29,    0,
+        0,   32,    0,    0,    0,    0,    0,    0,  108,    0,
+        0,    0,    0,    0,    0,    0,   85,    0,    0,    0,
+        0,    0,    0,    0,  132,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   59,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       82,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   92,    0,   59,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   84,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   94,    0,   60,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  122,  147,   51,    0,   56,    0,
-        0,    0,    0,    0,    0,  162,   37,    0,   34,    0,
-       33,    0,    0,    0,  135,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  114,    0,    0,
-        0,    0,    0,    0,    0,    0,  146,    0,    0,    0,
+        0,    0,    0,  127,  152,   52,    0,   57,    0,    0,
+        0,    0,    0,    0,    0,  168,   38,    0,   35,    0,
+       34,    0,    0,    0,  140,  119,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   53,    0,    0,   32,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   85,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,  136,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  116,    0,
+        0,    0,    0,    0,    0,    0,    0,  151,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  131,    0,    0,    0,    0,    0,    0,    7,   35,
+        0,    0,    0,   54,    0,    0,   33,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   87,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      141,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  136,    0,    0,    0,    0,    0,
+        0,    7,   36,   30,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      104,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  106,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      116,    0,    0,    0,    0,    0,    0,  113,    0,    0,
-        0,    0,    0,    0,    0,    0,   87,    0,    0,    0,
+        0,    0,    0,    0,    0,  118,    0,    0,    0,    0,
 
+        0,    0,  115,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   89,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   97,    0,    0,
+        0,    0,    0,    0,    0,    0,  112,    0,    0,    0,
+        0,   96,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       95,    0,    0,    0,    0,    0,    0,    0,    0,  110,
-        0,    0,    0,    0,   94,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  135,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  130,    0,    0,    0,
+        0,  145,  113,    0,    0,    0,    0,  117,   53,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  140,  111,    0,    0,    0,    0,  115,   52,
+       61,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   80,    0,    0,    0,    0,    0,    0,  169,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       78,    0,    0,    0,    0,    0,    0,  163,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  103,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  101,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  129,    0,
-        0,    0,    0,    0,    0,   63,    0,    0,    0,    0,
+      134,    0,    0,    0,    0,    0,    0,   65,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   57,   86,    0,    0,    0,  126,    0,    0,
-        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,  121,    0,    0,   58,   88,    0,    0,
+        0,  131,    0,    0,    0,    0,   51,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      118,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  123,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  161,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   96,    0,    0,    0,    0,    0,    0,
+        0,    0,  167,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   98,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   16,    0,    0,  141,   14,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,   42,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   16,
+        0,    0,  146,   14,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  132,    0,
-      117,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  128,  145,    0,
-       40,    0,  137,    0,    0,    0,    0,    0,    0,    0,
-        0,   20,    0,    0,    0,   80,    0,    0,    0,    0,
-      139,   54,    0,   88,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  137,    0,  122,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       77,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   84,    0,    0,    0,    0,    0,   64,    0,
+        0,    0,    0,    0,    0,    0,  133,  150,    0,   41,
+        0,  142,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   20,    0,    0,    0,   82,    0,    0,    0,    0,
+      144,   55,    0,   90,    0,  120,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,  134,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  107,    0,    0,    0,    0,    0,
-       81,  103,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   74,    0,    0,    0,    0,    0,    0,
-       17,    0,   15,    0,  159,  158,    0,   69,    0,    0,
-        0,    0,    0,   30,  121,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  156,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   97,    0,
-      125,   43,    0,   61,    0,    0,    0,    0,   19,    0,
-
-        0,    0,    0,    0,    0,   99,   75,    0,    0,  133,
-        0,    0,    0,    0,    0,  124,    0,    0,    0,    0,
-        0,   93,    0,  164,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   91,    0,    0,  148,    0,    0,
+        0,   79,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   86,    0,    0,    0,    0,    0,    0,
+       66,    0,    0,    0,    0,    0,    0,    0,    0,  139,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  109,    0,    0,
+        0,    0,    0,   83,  105,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   76,    0,    0,    0,
+        0,    0,    0,   17,    0,   15,    0,  164,  163,    0,
+       71,    0,    0,    0,    0,    0,   31,  126,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      161,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   99,    0,  130,   44,    0,    0,   62,    0,
+        0,    0,    0,   19,    0,    0,    0,    0,    0,    0,
+      101,   77,    0,    0,  138,    0,    0,    0,    0,    0,
+      129,    0,    0,    0,    0,    0,   95,    0,  170,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   42,    0,    0,   68,
-        0,    0,    0,  119,   47,    0,    0,    0,   70,  157,
-       38,    0,    0,   12,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   45,    0,    0,   44,   18,    0,    0,
-
-        0,    0,  112,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   73,    0,    0,
-        0,   62,    0,    0,   89,    0,    0,    0,    0,    0,
-      138,    0,    0,    0,   46,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   67,    0,
-        0,    0,   79,    0,   36,   48,    0,    0,    0,    0,
-        0,    0,   24,    0,    0,    0,    0,    0,    0,  154,
-        0,  123,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  100,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   25,   39,    0,    0,    0,    0,    0,
-
-       13,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      160,    0,    0,    0,    0,    0,    0,  153,    0,    0,
-       21,   72,    0,    0,    0,    0,    0,   65,    0,    0,
-        0,   90,    0,    0,  152,    0,    0,   71,    0,    0,
-       66,    0,   23,    0,    0,    0,    0,    0,    0,    0,
+       93,    0,    0,  153,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,   43,    0,    0,   70,    0,    0,    0,
+      124,   48,    0,    0,    0,    0,   72,  162,   39,    0,
+        0,   12,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   46,    0,    0,   45,   63,   18,    0,    0,    0,
+        0,  114,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   75,    0,    0,    0,
+        0,   64,    0,    0,   91,    0,    0,    0,    0,    0,
+      143,    0,    0,    0,   47,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   69,    0,
+        0,    0,   81,    0,   37,   49,    0,    0,    0,    0,
+
+        0,    0,    0,   24,    0,    0,    0,    0,    0,    0,
+      159,    0,  128,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  102,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   25,   40,    0,    0,    0,
+        0,    0,   13,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  166,    0,    0,    0,    0,    0,    0,
+      158,    0,    0,   21,   74,    0,    0,    0,    0,    0,
+       67,    0,    0,    0,    0,   92,    0,    0,  157,    0,
+        0,   73,    0,    0,   68,    0,   23,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   49,    0,    0,
-        0,    0,    0,   22,    0,  108,  120,    0,    0,    0,
-        0,    0,    0,  150,  155,   76,    0,    0,    0,    0,
-      149,    0,    0,   26,    0,    0,    0,    0,    0,  109,
 
-        0,    0,  151,    0
+        0,    0,  165,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   50,    0,    0,    0,    0,    0,   22,
+        0,  110,  125,    0,    0,    0,    0,    0,    0,  155,
+      160,   78,    0,    0,    0,    0,  154,    0,    0,   26,
+        0,    0,    0,    0,    0,  111,    0,    0,  156,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -879,11 +883,11 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,   27,    5,   28,    5,   29,    5,   30,   31,   32,
-        5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
-       40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
+        5,   27,   28,   29,    5,   30,    5,   31,   32,   33,
+        5,   34,   35,   36,   37,   38,   39,    5,   40,    5,
+       41,   42,   43,    5,   44,    5,   45,   46,   47,   48,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
+       49,   50,   51,   52,   53,   29,   54,   55,   56,   57,
        58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
        68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -904,790 +908,1064 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[72] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1
     } ;
 
-static const flex_int16_t yy_base[1517] =
+static const flex_int16_t yy_base[1551] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1868, 1869,   32, 1864,  141,    0,  201, 1869,  206,   88,
-       11,  213, 1869, 1846,  114,   25,    2,    6, 1869, 1869,
-       73,   11,   17, 1869, 1869, 1869,  104, 1852, 1807,    0,
-     1844,  107, 1859,  217,  241, 1869,  185, 1803, 1809, 1829,
-       93,   58,  190,   91,  211,  200,   14,  267,  213,  175,
-      269,   64,  231,  184,  187,   75, 1810,  274,  215,  290,
-      278,  297, 1793,  207,  302,  316,  316, 1812,    0,  355,
-      360,  372,  377,  380, 1869,    0, 1869,  295,  383,  227,
-      296,  283,  327,  361,  293, 1869, 1809, 1848, 1869,  237,
-
-     1869,  394,  363, 1796, 1806, 1845,  375,  321,  403, 1800,
-      369,  378,  376,  382,  388, 1843,    0,  445,  407, 1787,
-     1795,  364, 1791, 1780, 1781,  372, 1797, 1780, 1789,  387,
-      308,  378, 1783, 1781,  391, 1770, 1826,  416, 1773, 1824,
-     1766, 1789, 1786, 1786, 1780,  214, 1773, 1766, 1771, 1765,
-      382, 1776, 1769, 1760, 1759, 1773,  362, 1809, 1758,  414,
-     1770, 1773, 1757,  441, 1758,  417, 1770, 1767, 1768, 1766,
-      422, 1748, 1753, 1749, 1741, 1758, 1750,    0,  422,  450,
-      440,  446,  454,  470, 1749, 1869,    0,  476, 1740, 1743,
-     1869,  465,  447, 1869, 1795, 1750,  477, 1793,  481, 1792,
-
-      477, 1791, 1869,  521, 1790,  489, 1751, 1746, 1745, 1736,
-      491, 1785, 1779, 1745, 1724, 1732, 1738, 1726, 1740, 1736,
-     1737, 1737, 1732, 1724, 1726, 1710, 1714, 1727, 1729, 1726,
-     1718, 1708, 1711, 1725, 1869, 1711, 1719, 1722, 1703, 1702,
-     1752, 1701, 1711, 1749,  452, 1710, 1698, 1709, 1745,  490,
-     1749, 1686, 1701,    9, 1691, 1707, 1688, 1690, 1686, 1692,
-     1683, 1682, 1695, 1688, 1690, 1694, 1693, 1687,   80, 1694,
-     1689, 1681, 1671, 1686, 1681, 1685,  459, 1683, 1669, 1675,
-     1682, 1670,  230, 1663, 1677, 1676, 1679, 1661, 1669,  491,
-     1869, 1869,  501, 1869, 1869, 1656,    0,  376, 1658,  497,
-
-      503, 1712, 1869, 1665,  489, 1869, 1710, 1869, 1704,  557,
-     1869,  484, 1646, 1656, 1706, 1663, 1658, 1661, 1656,  304,
-     1869, 1658,  549, 1656, 1653, 1654,  303, 1658, 1696, 1646,
-     1641, 1638, 1634, 1636, 1685, 1644, 1633, 1649, 1681, 1629,
-      550, 1642, 1642, 1625, 1626, 1639, 1626, 1636, 1631, 1638,
-     1633, 1618,  470, 1627, 1630, 1625, 1621, 1669,  515,  524,
-     1869, 1663, 1615, 1614, 1607, 1609, 1613, 1602, 1609, 1614,
-      513, 1659, 1614,  510, 1611, 1615, 1613, 1602, 1602, 1614,
-      502, 1589, 1590, 1611,  536, 1593, 1590, 1604, 1607, 1602,
-     1588, 1600, 1599, 1598, 1597,  532, 1638, 1637, 1636, 1580,
-
-      581, 1593, 1869, 1869, 1592,    0,  556, 1580, 1631, 1630,
-     1588, 1628, 1869, 1576, 1626, 1869,  563,  609,  557, 1625,
-     1567, 1869, 1572, 1578, 1581, 1564, 1579, 1566, 1565, 1869,
-     1575, 1566, 1563, 1575,  549, 1560, 1562, 1869, 1568, 1553,
-     1555, 1566, 1564, 1559,  588, 1566, 1554, 1547, 1596, 1869,
-     1545, 1561, 1593, 1597, 1555, 1549, 1551, 1552, 1554, 1586,
-     1539, 1534, 1533, 1535, 1528, 1543, 1521, 1528, 1533, 1581,
-     1869, 1528, 1524, 1578, 1531, 1525, 1532, 1517, 1527, 1530,
-     1519, 1518, 1513, 1869, 1568, 1869, 1512, 1511, 1504, 1521,
-     1558, 1505, 1510, 1519, 1513, 1507, 1516,  602, 1551, 1515,
-
-     1498, 1498, 1493, 1489, 1495, 1500, 1493, 1501, 1505, 1488,
-     1544, 1486, 1500, 1489, 1869, 1869, 1869, 1489, 1869, 1499,
-     1533, 1495,    0, 1536, 1486, 1869, 1869, 1483, 1869, 1489,
-     1869,  569,  565,  604, 1869, 1527, 1474, 1525, 1472, 1471,
-     1470, 1477, 1470, 1478, 1481, 1480, 1464, 1479, 1461, 1508,
-     1475, 1511, 1457, 1459, 1471, 1471, 1470, 1869, 1455, 1452,
-     1508, 1465, 1457, 1463, 1454, 1462, 1869, 1447, 1458, 1462,
-     1444, 1458,  530, 1440, 1434, 1439, 1436, 1451, 1452, 1449,
-     1490, 1447, 1869, 1433, 1435, 1869, 1443, 1480, 1479,  605,
-     1442, 1425, 1426, 1431, 1422, 1869, 1436, 1422,  630, 1414,
-
-     1435, 1432, 1424, 1467, 1421, 1428, 1464, 1869, 1412, 1410,
-     1424, 1408, 1422, 1425, 1457, 1456, 1455, 1454, 1401, 1452,
-     1451, 1869,  622, 1413, 1413, 1411, 1400, 1402, 1869, 1869,
-     1445, 1393, 1448,  579,  591, 1391, 1406, 1445,  597, 1439,
-     1401, 1437, 1436, 1390, 1384, 1379, 1432, 1394, 1384, 1392,
-     1428, 1391, 1373, 1381, 1383, 1387, 1422, 1426, 1383, 1382,
-     1869, 1383, 1376, 1365, 1378, 1381, 1376, 1371, 1376, 1373,
-     1372, 1368, 1374, 1369, 1410, 1409, 1353, 1349,  582, 1406,
-     1869, 1405, 1354, 1346, 1397, 1360, 1347, 1869, 1347, 1356,
-     1355, 1355, 1339, 1394, 1337, 1350, 1869, 1342, 1334, 1343,
-
-     1336, 1347, 1324, 1328, 1379, 1343, 1325, 1323, 1334, 1374,
-     1373, 1372, 1319, 1335,  593, 1334,  607, 1311, 1321,  604,
-     1869, 1371, 1317, 1327, 1327, 1316, 1320, 1327, 1364, 1869,
-       17,  587,   11,   69, 1869,   68,  202,  236,  296,  375,
-      389,  470,  497,  549,  569,  570,  600,  588,  587,  601,
-      656,  604,  620,  603,  657,  614, 1869,  625,  625,  618,
-      629,  627,  670,  614,  617,  632,  634,  621,  678,  637,
-      623,  626, 1869, 1869,  642,  641,  646,  634, 1869, 1869,
-      648,  635,  633,  651,  638,  638,  687,  639,  695,  696,
-     1869,  643,  657,  657,  700,  650,  652,  646,  704,  659,
-
-      649,  650,  646,  656,  660,  671,  655,  673,  668,  670,
-      663,  665,  666,  678,  668,  683,  722,  681,  686,  663,
-     1869,  688,  678,  723,  672,  687,  688, 1869,  707,  715,
-      684,  698,  686,  681,  682,  694,  701,  690,  691,  687,
-      705,  697,  692,  743,  749,  708,  699, 1869,  711,  696,
-      712,  702,  714,  709,  754,  723,  707,  708, 1869,  724,
-      727,  710,  712,  768,  713, 1869,  730,  733,  713,  732,
-      770,  730,  726,  721,  739,  738,  724,  739,  731,  727,
-      745,  730, 1869, 1869,  738,  783,  738, 1869,  746,  741,
-      792, 1869,  743,  748,  790,  744,  745,  757,  751,  755,
-
-      753,  751,  762,  805,  751,  756,  808,  809,  755,  767,
-     1869,  755,  763,  761,  766,  778,  762,  776,  777,  778,
-      794,  799,  781,  769,  769,  789,  788,  779,  768,  785,
-      792,  833,  777,  835,  784,  788, 1869,  833,  784,  802,
-      799,  837,  788,  806,  807,  793,  801,  810,  792,  807,
-      814,  854,  855, 1869,  810,  857,  858,  811,  821,  823,
-      807,  808,  815,  824,  867,  816,  815,  832,  871,  823,
-      827,  825,  823,  876,  877,  829,  879,  875,  835, 1869,
-      840,  833,  824,  843,  837,  832,  842,  839,  844,  840,
-      852, 1869,  836,  838, 1869, 1869,  838,  896,  837,  856,
-
-      857,  855,  840,  861,  843,  848,  855,  888,  879,  909,
-      854,  856,  873,  868,  872,  915,  865,  869, 1869,  866,
-     1869,  880,  878,  881,  865,  866,  924,  879,  884,  871,
-      882,  874,  881,  877,  895,  896,  897, 1869, 1869,  896,
-     1869,  898, 1869,  883,  884,  903,  893,  943,  898,  940,
-      906, 1869,  898,  890,  949, 1869,  950,  899,  906,  948,
-     1869, 1869,  908, 1869,  899,  899,  902,  916,  921,  904,
-      915,  962,  921,  922,  923,  961,  919,  968,  923,  970,
-     1869,  919,  972,  973,  915,  975,  936,  920,  932,  922,
-      952,  981, 1869,  982,  931,  946,  980,  934, 1869,  930,
-
-      946,  934,  952,  940,  940,  993,  952, 1869,  954,  953,
-      955,  948,  957,  958,  955,  945,  948,  948, 1005,  954,
-     1007, 1009,  954, 1011, 1869,  949,  964,  957, 1015,  970,
-     1869, 1869,  967,  977,  962,  979,  965, 1025, 1026,  972,
-      982, 1029,  988, 1869,  980,  980,  982,  984, 1035,  980,
-     1869,  981, 1869,  983, 1869, 1869,  997, 1869,  991, 1041,
-      992, 1043, 1025, 1869, 1869,  989,  997,  991,  988,  991,
-      994,  994,  990,  996, 1054, 1004, 1869, 1000, 1057, 1012,
-     1003, 1018, 1018, 1021, 1021, 1018, 1060, 1024, 1869, 1017,
-     1869, 1869, 1027, 1869, 1028, 1029, 1026, 1068, 1869, 1019,
-
-     1019, 1025, 1024, 1036, 1036, 1869, 1869, 1075, 1024, 1869,
-     1041, 1026, 1026, 1028, 1034, 1869, 1087, 1031, 1041, 1090,
-     1053, 1869, 1050, 1869, 1069, 1094, 1095, 1054, 1059, 1041,
-     1099, 1100, 1101, 1056, 1869, 1046, 1104, 1869, 1044, 1101,
-     1066, 1062, 1104, 1054, 1059, 1057, 1114, 1072, 1116, 1117,
-     1080, 1069, 1064, 1080, 1123, 1067, 1084, 1069, 1084, 1068,
-     1124, 1125, 1126, 1075, 1128, 1093, 1869, 1093, 1080, 1869,
-     1091, 1138, 1110, 1869, 1869, 1084, 1095, 1142, 1869, 1869,
-     1869, 1091, 1089, 1869, 1145, 1093, 1142, 1087, 1092, 1151,
-     1101, 1111, 1112, 1869, 1155, 1110, 1869, 1869, 1101, 1116,
-
-     1104, 1119, 1869, 1156, 1124, 1117, 1118, 1127, 1109, 1116,
-     1118, 1171, 1132, 1131, 1123, 1175, 1126, 1869, 1177, 1178,
-     1122, 1869, 1129, 1129, 1869, 1133, 1128, 1127, 1185, 1140,
-     1869, 1182, 1135, 1132, 1869, 1146, 1149, 1192, 1147, 1194,
-     1137, 1139, 1147, 1137, 1153, 1154, 1148, 1164, 1869, 1154,
-     1204, 1165, 1869, 1201, 1869, 1869, 1202, 1203, 1160, 1168,
-     1159, 1166, 1869, 1163, 1168, 1166, 1216, 1217, 1162, 1869,
-     1177, 1869, 1167, 1179, 1180, 1223, 1167, 1175, 1169, 1177,
-     1190, 1869, 1167, 1190, 1174, 1179, 1233, 1183, 1195, 1186,
-     1195, 1197, 1201, 1869, 1869, 1240, 1185, 1201, 1243, 1244,
-
-     1869, 1240, 1204, 1201, 1206, 1193, 1250, 1189, 1206, 1211,
-     1869, 1254, 1213, 1214, 1257, 1216, 1219, 1869, 1260, 1223,
-     1869, 1869, 1205, 1263, 1212, 1265, 1210, 1869, 1227, 1218,
-     1214, 1869, 1214, 1216, 1869, 1221, 1231, 1869, 1217, 1229,
-     1869, 1225, 1869, 1235, 1229, 1237, 1234, 1225, 1277, 1226,
-     1234, 1243, 1236, 1231, 1232, 1247, 1290, 1239, 1246, 1233,
-     1248, 1253, 1296, 1255, 1298, 1299, 1244, 1869, 1260, 1251,
-     1265, 1261, 1254, 1869, 1306, 1869, 1869, 1307, 1308, 1265,
-     1264, 1265, 1255, 1869, 1869, 1869, 1313, 1257, 1273, 1316,
-     1869, 1312, 1263, 1869, 1262, 1264, 1275, 1322, 1273, 1869,
-
-     1282, 1325, 1869, 1869, 1331, 1336, 1341, 1346, 1351, 1356,
-     1361, 1364, 1338, 1343, 1345, 1358
+        1,    0,   73,    0,  145,    0, 1432, 1477, 1152, 1279,
+        0,  868, 1155, 1012,  217,  865, 1244,  940, 1271, 1292,
+     1395, 1288, 1084, 1164, 1331, 1277, 1210, 1353, 1236, 1699,
+     1375, 1290, 1370, 1701, 1702, 1703, 1405, 1491, 1486, 1009,
+     1492, 1411, 1275,  289,  361, 1706, 1130, 1469, 1707, 1707,
+     1707, 1480, 1467, 1468, 1482, 1160, 1484, 1483,  433, 1218,
+     1319, 1109, 1449, 1372, 1310, 1363, 1371, 1707, 1333, 1387,
+     1331, 1106, 1148, 1707, 1468, 1303, 1223, 1340, 1707,    0,
+     1335, 1309, 1357, 1314, 1707,  937, 1708, 1208, 1385, 1281,
+     1410, 1369, 1412, 1422, 1398, 1709, 1505, 1711, 1711, 1714,
+
+     1255, 1473, 1483, 1715, 1715, 1715, 1490, 1489, 1517, 1715,
+     1490, 1500, 1497, 1503, 1516, 1081,    0,  505, 1384, 1715,
+     1715, 1715, 1389, 1715, 1715, 1715, 1401, 1716, 1715, 1716,
+     1396, 1490, 1493, 1716, 1716, 1396, 1716, 1715, 1538, 1716,
+     1716, 1717, 1715, 1717, 1715, 1716, 1499, 1719, 1719, 1726,
+     1725, 1510, 1737, 1733, 1726, 1727, 1742, 1021, 1717, 1731,
+     1399, 1744, 1505, 1735,  577, 1738, 1407, 1751, 1750, 1753,
+     1753, 1518, 1738, 1745, 1743, 1737, 1755, 1750, 1434, 1444,
+     1424, 1453, 1463, 1470, 1556, 1715, 1153, 1537, 1539, 1743,
+     1748, 1718, 1528, 1536, 1720, 1724, 1757, 1539, 1725, 1543,
+
+     1726, 1538, 1722,  649, 1727, 1549, 1764, 1753, 1762, 1763,
+     1757, 1232, 1728, 1725, 1769, 1751, 1761, 1768, 1759, 1774,
+     1772, 1775, 1777, 1774, 1769, 1772, 1759, 1765, 1779, 1783,
+     1782, 1777, 1769, 1774, 1789, 1723, 1778, 1787, 1792, 1776,
+     1777, 1726, 1779, 1790, 1728, 1414, 1792, 1783, 1795, 1729,
+     1547, 1735, 1777, 1793, 1560, 1786, 1803, 1787, 1791, 1789,
+     1797, 1790, 1791, 1805, 1801, 1793, 1805, 1811, 1812, 1808,
+     1518, 1817, 1814, 1809, 1801, 1817, 1814, 1820, 1521, 1820,
+     1809, 1817, 1825, 1816, 1304, 1811, 1826, 1827, 1832, 1817,
+     1826, 1475, 1724, 1742, 1478, 1743, 1744, 1578, 1166, 1539,
+
+     1547, 1819, 1465, 1555, 1745, 1745, 1828, 1549, 1746, 1748,
+     1747, 1871,  721, 1748, 1545, 1815, 1837, 1828, 1749, 1837,
+     1834, 1839, 1836, 1544, 1749, 1840, 1591, 1840, 1839, 1842,
+     1588, 1848, 1751, 1840, 1837, 1836, 1834, 1838, 1889, 1849,
+     1841, 1858, 1893, 1843, 1332, 1857, 1859, 1845, 1848, 1862,
+     1852, 1863, 1860, 1869, 1866, 1854, 1540, 1864, 1869, 1866,
+     1865, 1752, 1136, 1557, 1750, 1921, 1921, 1922, 1921, 1283,
+     1921, 1921, 1923, 1921, 1592, 1921, 1921, 1563, 1922, 1921,
+     1921, 1922, 1924, 1921, 1921, 1560, 1921, 1922, 1922, 1571,
+     1922, 1921, 1924, 1923, 1927, 1925, 1941, 1942, 1943, 1944,
+
+     1552, 1922, 1923, 1924, 1933, 1616, 1947, 1921, 1922, 1614,
+     1204, 1588, 1575, 1938, 1925, 1927, 1949, 1928, 1923, 1941,
+     1929, 1924, 1359,  793, 1590, 1930, 1931, 1936, 1925, 1943,
+     1950, 1955, 1941, 1957, 1947, 1948, 1926, 1959, 1953, 1952,
+     1965, 1578, 1953, 1957, 1938, 1964, 1952, 1956, 1968, 1968,
+     1965, 1622, 1974, 1965, 1960, 1939, 1939, 1961, 1978, 1940,
+     1940, 1976, 1972, 1976, 1979, 1983, 1941, 1972, 1969, 1970,
+     1974, 1969, 1985, 1966, 1975, 1982, 1941, 1940, 1980, 1978,
+     1942, 1987, 1984, 1992, 1980, 1989, 1992, 1997, 1989, 1990,
+     1987, 1941, 1943, 1942, 1989, 1990, 1985, 2003, 1943, 1944,
+
+     1991, 1998, 2008, 2004, 2001, 2011, 1623, 1945, 2013, 1999,
+     2001, 1998, 1996, 2004, 2011, 2006, 2015, 2021, 2007, 1947,
+     2008, 2023, 2015, 1943, 1944, 1945, 2017, 1957, 2028, 2065,
+     1630, 1217, 1958, 1959, 2022, 1958, 1959, 2021, 1960, 2028,
+     1961, 1599, 1598, 1629, 1962, 1963, 2080, 2080, 2081, 2081,
+     2082, 2083, 2080, 2080, 2080, 2080, 2081, 2084, 2080, 2084,
+     2080, 2082, 2082, 2085, 2081, 2083, 2086, 2088, 2080, 2089,
+     2088, 2081, 2088, 2083, 2090, 2084, 2104, 2081, 2092, 2104,
+     2082, 2094, 2109, 1589, 1628, 2089, 2096, 2095, 2111, 2114,
+     2113, 2082, 2114, 2082, 2103, 2107, 2083, 2116, 2084, 2086,
+
+     1638, 2109, 2120, 2106, 2109, 2116, 2109, 2084, 2124, 2113,
+     1460, 2107, 2114, 2130, 2129, 2124, 2087, 2124, 2132, 2088,
+     2085, 2120, 2120, 2135, 2122, 2137, 2142, 2089, 2090, 2091,
+     2092, 2125, 2093, 2094, 2086, 1635, 2140, 2142, 2142, 2134,
+     2138, 2089, 2090, 2094, 2106, 2132, 2106, 1609, 1621, 2133,
+     2149, 2107, 1187, 2107, 2148, 2108, 2109, 2142, 2138, 2135,
+     2110, 2152, 2145, 2154, 2111, 2156, 2141, 2151, 2154, 2160,
+     2112, 2108, 2160, 2161, 2106, 2164, 2159, 2151, 2165, 2170,
+     2167, 2164, 2171, 2170, 2171, 2169, 2177, 2164, 2175, 2109,
+     2110, 2164, 2162, 1598, 2118, 2107, 2119, 2171, 2165, 2115,
+
+     2181, 2171, 2108, 2173, 2166, 2184, 2185, 2187, 2174, 2231,
+     2176, 2190, 2109, 2185, 2179, 2189, 2190, 2186, 2198, 2178,
+     2184, 2237, 2202, 2187, 2187, 2199, 2242, 2243, 2244, 2193,
+     2210, 1596, 2211, 1431, 2191, 2203, 1601, 2110, 2255, 2203,
+     2214, 2216, 2208, 2213, 2222, 2262, 2111, 2269, 1612, 2269,
+     2269, 2269, 2270, 2270, 2270, 2270, 2270, 2270, 2270, 2270,
+     2271, 2271, 2272, 2271, 2274, 2273, 2272, 2272, 2270, 2278,
+     2272, 2276, 2270, 2270, 2270, 2276, 2278, 2284, 2294, 2292,
+     1654, 2279, 2281, 2295, 2296, 2284, 2271, 2298, 2285, 2288,
+     2289, 2271, 2272, 2304, 2303, 2308, 2297, 2273, 2274, 2310,
+
+     2298, 2296, 1618, 2300, 2300, 2276, 2275, 2299, 2277, 2278,
+     2275, 2301, 2314, 2314, 2279, 2307, 2296, 2310, 2304, 2281,
+     2315, 2306, 2307, 2303, 2313, 2317, 2327, 2312, 2329, 2324,
+     2326, 2320, 2322, 2323, 1618, 2324, 2338, 2282, 2335, 2340,
+     2318, 2278, 2342, 2333, 2279, 2326, 2340, 2340, 2279, 1628,
+     1643, 2335, 2348, 2337, 2332, 2333, 2334, 2345, 2352, 2342,
+     2343, 2339, 2356, 2349, 2344, 2289, 2289, 2357, 2349, 2289,
+     2360, 2346, 2361, 2352, 2363, 2358, 2291, 2369, 2354, 2355,
+     2291, 2370, 2373, 2357, 2359, 1476, 2359, 2292, 2375, 2378,
+     2366, 2360, 2377, 2293, 2374, 2371, 2366, 2383, 2382, 2369,
+
+     2383, 2376, 2372, 2293, 1624, 2374, 2294, 2296, 2382, 2297,
+     2381, 2297, 2388, 2391, 2385, 2299, 2298, 2386, 2390, 2299,
+     2385, 2386, 2397, 2392, 2395, 2394, 2392, 2402, 2300, 2391,
+     2396, 2301, 2303, 2393, 2404, 2299, 2393, 2401, 2399, 2404,
+     2415, 2400, 2413, 2414, 2415, 1614, 1638, 2417, 2404, 2404,
+     2423, 2422, 2411, 2415, 2404, 2420, 2427, 2305, 2412, 2306,
+     2418, 2422, 2301, 2303, 2417, 2434, 2431, 2470, 2421, 2438,
+     2439, 2426, 2433, 2442, 2423, 2437, 2444, 2307, 2485, 2303,
+     2492, 1667, 1670, 2492, 2492, 2492, 2492, 2492, 2493, 2492,
+     2492, 2492, 2492, 2492, 2495, 2493, 2492, 2496, 2496, 2495,
+
+     2494, 2495, 2501, 2496, 2492, 2498, 2504, 2492, 2493, 2502,
+     2493, 2494, 2505, 2500, 2509, 2507, 2511, 2508, 2497, 2493,
+     2503, 2505, 2494, 2495, 2505, 2499, 2503, 2521, 2522, 2519,
+     2505, 2525, 2508, 2513, 2520, 1655, 1647, 2500, 2516, 2518,
+     2534, 2529, 2518, 2534, 2501, 2527, 2531, 2496, 2528, 2497,
+     2541, 2539, 2542, 2527, 2528, 2508, 2539, 2544, 2532, 2542,
+     2535, 2541, 2537, 2554, 2555, 2556, 2508, 2509, 2554, 2510,
+     2556, 2511, 2542, 2543, 2561, 2558, 2553, 2512, 2556, 2512,
+     2563, 2512, 2556, 2548, 2513, 2513, 2515, 2555, 2561, 2515,
+     2515, 2516, 2562, 2517, 2554, 2520, 2554, 2557, 2570, 2575,
+
+     2559, 2569, 2522, 2574, 2575, 2576, 1673, 2572, 2523, 2574,
+     2524, 2522, 2570, 2525, 2526, 2564, 2527, 2583, 2568, 2579,
+     2570, 1650, 2528, 2524, 1680, 2576, 2590, 2525, 2573, 2579,
+     2525, 2575, 2590, 2579, 2596, 2585, 2585, 2529, 2595, 2527,
+     2645, 2645, 2645, 2645, 2647, 2648, 2645, 2645, 2645, 2645,
+     2645, 2645, 2646, 2647, 2647, 2648, 2648, 2645, 2646, 1633,
+     2648, 2649, 2646, 2646, 2647, 2648, 2651, 2648, 2652, 2649,
+     2650, 2651, 2653, 2651, 2652, 2667, 2648, 2660, 2660, 2662,
+     2664, 2653, 2659, 2649, 2660, 2650, 2662, 2660, 2661, 2675,
+     2662, 2670, 2663, 2670, 2664, 1664, 2663, 2664, 2665, 2673,
+
+     2667, 2665, 2665, 2666, 2670, 2670, 2666, 2672, 2665, 2679,
+     2665, 2675, 2666, 2685, 2677, 2691, 2691, 2694, 2694, 2691,
+     2666, 2696, 2666, 2689, 2667, 2668, 2698, 2686, 2673, 2700,
+     2701, 2698, 2674, 2674, 2691, 2691, 2697, 2696, 2707, 2707,
+     2675, 2678, 2679, 2695, 2679, 2711, 2697, 2697, 2699, 2705,
+     2680, 2681, 2701, 2711, 2682, 2721, 2681, 2718, 2682, 1659,
+     2683, 2685, 2719, 2724, 2707, 2708, 2686, 2766, 2767, 2721,
+     2683, 2712, 2770, 2684, 2710, 2767, 2731, 2727, 2770, 2720,
+     2725, 1632, 1691, 2734, 2779, 2780, 2781, 2743, 2733, 2727,
+     2742, 2786, 2730, 2746, 2732, 2746, 2731, 2787, 2788, 2789,
+
+     2738, 2791, 2755, 2686, 2804, 2804, 2804, 2805, 2805, 1662,
+     2805, 2806, 2807, 2807, 2807, 2807, 2807, 2808, 2809, 2810,
+     2810, 2810, 1694, 2813, 2812, 2812, 2812, 2812, 2813, 2812,
+     2813, 2812, 2814, 2814, 2814, 2815, 2816, 2818, 2824, 2817,
+     2817, 2817, 2819, 2819, 2821, 2823, 2832, 2819, 2823, 2826,
+     2819, 2837, 2836, 2829, 2820, 2831, 2819, 2821, 2822, 2825,
+     2828, 2821, 2833, 2833, 2822, 2837, 2832, 2831, 2825, 2842,
+     2824, 2829, 2837, 2834, 2829, 2847, 2850, 2832, 2847, 2833,
+     2837, 2839, 2847, 2837, 2852, 2853, 2848, 2863, 2832, 2854,
+     2835, 2863, 2833, 2834, 2834, 2835, 2836, 2862, 2837, 2857,
+
+     2864, 2856, 2862, 2836, 2860, 2864, 2863, 2837, 2838, 2857,
+     2837, 2871, 2842, 2862, 2873, 2874, 2846, 2861, 2869, 2863,
+     2871, 2883, 2846, 2861, 2883, 2868, 2887, 2874, 2849, 2877,
+     2888, 2880, 2888, 2890, 2894, 2849, 2850, 2851, 2878, 2893,
+     2857, 2936, 2851, 2932, 2895, 2892, 2897, 2885, 2942, 2881,
+     2897, 2903, 2903, 2854, 2947, 2905, 2906, 2950, 2908, 2911,
+     2856, 2959, 2959, 2959, 2960, 2961, 2961, 2961, 2962, 2961,
+     2961, 2962, 2962, 2963, 2965, 2962, 2965, 2967, 2963, 2964,
+     2964, 2964, 2966, 2967, 2966, 2973, 2969, 2973, 2976, 2983,
+     2970, 2980, 2972, 2970, 2972, 2980, 2988, 2982, 2977, 2978,
+
+     2992, 2971, 2970, 2984, 2990, 2978, 2992, 2997, 2972, 2998,
+     2973, 2974, 2986, 2971, 3001, 2993, 2972, 3001, 2995, 2972,
+     2976, 2973, 2974, 2977, 2978, 3002, 3001, 3002, 2993, 2975,
+     2985, 2986, 2987, 2994, 3009, 2988, 2987, 2988, 2998, 2988,
+     2997, 2999, 3009, 2989, 3007, 2989, 3015, 2990, 2990, 3087
     } ;
 
-static const flex_int16_t yy_def[1517] =
+static const flex_int16_t yy_def[1551] =
     {   0,
-     1505, 1505, 1506, 1506, 1505, 1505, 1505, 1505, 1505, 1505,
-     1504, 1504, 1504, 1504, 1504, 1507, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1508,
-     1504, 1504, 1504, 1509,   15, 1504,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1510,   45,   45,
+     1550,    1, 1550,    3, 1550,    5,    5,    5,    5,    5,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1550,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1507, 1504,
-     1504, 1504, 1504, 1504, 1504, 1511, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1508, 1504, 1509,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   16,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550,   40, 1550, 1550,
 
-     1504, 1504,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1512,   45, 1510,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1550,   45, 1550,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1511, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1513,   45,   45,   45,
-     1504,   45,   45, 1504,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550,   45,   45,   45,
+       45, 1550,   45,   45, 1550,   45,   45,   45,   45,   45,
 
-       45, 1512, 1504, 1510,   45,   45,   45,   45,   45,   45,
+       45,   45, 1550, 1550,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1504,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1550,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1514,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,   45,
 
-       45,   45, 1504,   45,   45, 1504,   45, 1504,   45, 1510,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1550,   45,   45, 1550,   45,
+     1550,   45, 1550, 1550,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45, 1504, 1504, 1504, 1515,   45,   45,   45,   45,
-       45,   45, 1504,   45,   45, 1504,   45, 1510,   45,   45,
-       45, 1504,   45,   45,   45,   45,   45,   45,   45, 1504,
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1504,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1550, 1550, 1550,
+     1550,   45,   45,   45,   45,   45,   45,   45, 1550,   45,
+       45, 1550,   45, 1550,   45,   45,   45,   45, 1550,   45,
+       45,   45,   45,   45,   45,   45, 1550,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1550,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1504,   45, 1504,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1550,   45, 1550,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1504, 1504, 1504,   45, 1504,   45,
-       45, 1504, 1516,   45,   45, 1504, 1504,   45, 1504,   45,
-     1504,   45,   45,   45, 1504,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45,   45,   45,   45,   45,   45, 1504,   45,   45,   45,
+       45,   45,   45, 1550, 1550, 1550,   45, 1550,   45,   45,
+     1550, 1550,   45,   45,   45, 1550, 1550,   45, 1550,   45,
+     1550,   45,   45,   45, 1550, 1550,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1504,   45,   45, 1504,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1504,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1550,   45,
+       45,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1504,   45,   45,   45,   45,   45,   45, 1504, 1504,
+       45,   45,   45, 1550,   45,   45, 1550,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
+       45, 1550, 1550, 1550,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45,   45,   45,   45,   45,   45, 1504,   45,   45,   45,
+       45,   45,   45,   45,   45, 1550,   45,   45,   45,   45,
 
+       45,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
+       45,   45,   45,   45,   45,   45, 1550,   45,   45,   45,
+       45, 1550,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45, 1504,
-       45,   45,   45,   45, 1504,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1504,   45,   45,   45,
+       45, 1550, 1550,   45,   45,   45,   45, 1550, 1550,   45,
+
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1504, 1504,   45,   45,   45,   45, 1504, 1504,
+     1550,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1550,   45,   45,   45,   45,   45,   45, 1550,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1550,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1504,   45,
-       45,   45,   45,   45,   45, 1504,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1504, 1504,   45,   45,   45, 1504,   45,   45,
-       45, 1504,   45,   45,   45,   45,   45,   45,   45,   45,
 
+       45,   45,   45, 1550,   45,   45, 1550, 1550,   45,   45,
+       45, 1550,   45,   45,   45,   45, 1550,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1550,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1504,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1504,   45,   45,   45,   45,   45,   45,
+       45,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1550,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1504,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1504,   45,   45, 1504, 1504,   45,   45,   45,   45,
 
+       45,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1550,
+       45,   45, 1550, 1550,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1504,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1504, 1504,   45,
-     1504,   45, 1504,   45,   45,   45,   45,   45,   45,   45,
-       45, 1504,   45,   45,   45, 1504,   45,   45,   45,   45,
-     1504, 1504,   45, 1504,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1550,   45, 1550,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1504,   45,   45,   45,   45,   45, 1504,   45,
+       45,   45,   45,   45,   45,   45, 1550, 1550,   45, 1550,
+       45, 1550,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1550,   45,   45,   45, 1550,   45,   45,   45,   45,
+     1550, 1550,   45, 1550,   45, 1550,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1504,   45,   45,   45,   45,   45,
-     1504, 1504,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1504,   45,   45,   45,   45,   45,   45,
-     1504,   45, 1504,   45, 1504, 1504,   45, 1504,   45,   45,
-       45,   45,   45, 1504, 1504,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1504,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1504,   45,
-     1504, 1504,   45, 1504,   45,   45,   45,   45, 1504,   45,
-
-       45,   45,   45,   45,   45, 1504, 1504,   45,   45, 1504,
-       45,   45,   45,   45,   45, 1504,   45,   45,   45,   45,
-       45, 1504,   45, 1504,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1504,   45,   45, 1504,   45,   45,
+       45, 1550,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1550,   45,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45,   45,   45,   45,   45, 1550,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1550,   45,   45,
+       45,   45,   45, 1550, 1550,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1550,   45,   45,   45,
+       45,   45,   45, 1550,   45, 1550,   45, 1550, 1550,   45,
+     1550,   45,   45,   45,   45,   45, 1550, 1550,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1550,   45, 1550, 1550,   45,   45, 1550,   45,
+       45,   45,   45, 1550,   45,   45,   45,   45,   45,   45,
+     1550, 1550,   45,   45, 1550,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45,   45, 1550,   45, 1550,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1550,   45,   45, 1550,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1504,   45,   45, 1504,
-       45,   45,   45, 1504, 1504,   45,   45,   45, 1504, 1504,
-     1504,   45,   45, 1504,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1504,   45,   45, 1504, 1504,   45,   45,
-
-       45,   45, 1504,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45, 1504,   45,   45, 1504,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45, 1504,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1504,   45,
-       45,   45, 1504,   45, 1504, 1504,   45,   45,   45,   45,
-       45,   45, 1504,   45,   45,   45,   45,   45,   45, 1504,
-       45, 1504,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1504,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1504, 1504,   45,   45,   45,   45,   45,
-
-     1504,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1504,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-     1504, 1504,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45, 1504,   45,   45, 1504,   45,   45, 1504,   45,   45,
-     1504,   45, 1504,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45, 1550,   45,   45, 1550,   45,   45,   45,
+     1550, 1550,   45,   45,   45,   45, 1550, 1550, 1550,   45,
+       45, 1550,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1550,   45,   45, 1550, 1550, 1550,   45,   45,   45,
+       45, 1550,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1550,   45,   45,   45,
+       45, 1550,   45,   45, 1550,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45, 1550,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1550,   45,
+       45,   45, 1550,   45, 1550, 1550,   45,   45,   45,   45,
+
+       45,   45,   45, 1550,   45,   45,   45,   45,   45,   45,
+     1550,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1550, 1550,   45,   45,   45,
+       45,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1550,   45,   45,   45,   45,   45,   45,
+     1550,   45,   45, 1550, 1550,   45,   45,   45,   45,   45,
+     1550,   45,   45,   45,   45, 1550,   45,   45, 1550,   45,
+       45, 1550,   45,   45, 1550,   45, 1550,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1504,   45,   45,
-       45,   45,   45, 1504,   45, 1504, 1504,   45,   45,   45,
-       45,   45,   45, 1504, 1504, 1504,   45,   45,   45,   45,
-     1504,   45,   45, 1504,   45,   45,   45,   45,   45, 1504,
 
-       45,   45, 1504,    0, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504
+       45,   45, 1550,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1550,   45,   45,   45,   45,   45, 1550,
+       45, 1550, 1550,   45,   45,   45,   45,   45,   45, 1550,
+     1550, 1550,   45,   45,   45,   45, 1550,   45,   45, 1550,
+       45,   45,   45,   45,   45, 1550,   45,   45, 1550,    0
     } ;
 
-static const flex_int16_t yy_nxt[1941] =
+static const flex_int16_t yy_nxt[3159] =
     {   0,
-     1504,   13,   14,   13, 1504,   15,   16, 1504,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   85,  364,
-       37,   14,   37,   86,   25,   26,   38,  829, 1504,   27,
-       37,   14,   37,   42,   28,   42,   38,   91,   92,   29,
-      115,   30,   13,   14,   13,   90,   91,   25,   31,   92,
-       13,   14,   13,   13,   14,   13,   32,   40,  831,   13,
-       14,   13,   33,   40,  115,   91,   92,  365,   90,   34,
-       35,   13,   14,   13,   94,   15,   16,   95,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  108,   39,   90,   25,   26,   13,   14,   13,   27,
-
-       39,   84,   84,   84,   28,   42,   41,   42,   42,   29,
-       42,   30,   82,  107,   41,  111,   93,   25,   31,  108,
-      130,  138,   88,  832,   88,  833,   32,   89,   89,   89,
-      131,  139,   33,  140,  380,   82,  107,  381,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
+       11,   12,   13,   14,   13,   12,   15,   16,   12,   17,
+       18,   19,   20,   21,   22,   22,   22,   23,   24,   12,
+       12,   12,   12,   12,   12,   25,   26,   12,   12,   12,
+       12,   27,   12,   12,   12,   12,   28,   12,   12,   12,
+       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
+       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
+       12,   12,   12,   33,   12,   12,   12,   12,   12,   12,
+       34,   35,   11,   36,   37,   14,   37,   36,   36,   36,
+       38,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   11,   12,   13,   14,   13,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   39,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   11,   44,   44,   44,
+       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   47,   48,   49,
+       50,   51,   52,   45,   45,   53,   54,   55,   45,   45,
+       45,   45,   56,   57,   45,   58,   45,   45,   59,   45,
+       45,   60,   48,   61,   62,   63,   64,   65,   66,   67,
+       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
+       78,   79,   58,   45,   45,   45,   45,   45,   11,   44,
+       44,   44,   44,   44,  100,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      101,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       11,   44,   44,   44,   45,   45,   46,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   48,   49,   50,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   45,   60,   61,   62,   63,
-       64,   65,   66,   52,   67,   68,   69,   70,   71,   72,
-
-       73,   74,   75,   76,   77,   78,   57,   45,   45,   45,
-       45,   45,   80,  103,   81,   81,   81,   80,  109,   83,
-       83,   83,  101,  114,   80,   82,   83,   83,   83,  121,
-       82,  133,  122,  112,  123,  306,  124,   82,  134,  103,
-      396,  103,  101,  113,  135,  834,  114,  110,   82,  136,
-      163,  107,  137,   82,  164,  179,  112,  102,  146,  244,
-       82,   45,  147,   45,   45,   45,   45,  119,   45,   45,
-       45,  113,  117,  120,  107,   45,   45,  102,   45,   45,
-      245,  179,  148,  835,   45,  132,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   89,   89,
-       89,   45,  125,  435,  111,   45,  126,  436,  181,  127,
-      128,  142,  143,   45,  180,  144,  152,   45,  181,   45,
-      118,  145,  129,  149,  153,  150,  154,  151,  112,  114,
-      157,  155,  156,  158,  159,  165,  181,  427,  113,  166,
-      180,  193,  167,  224,  160,  179,  184,  161,  836,  168,
-      169,  171,  114,  172,  428,  170,  225,  173,   84,   84,
-       84,   80,  175,   81,   81,   81,  113,  176,  193,   82,
-       88,  182,   88,  174,   82,   89,   89,   89,   80,  180,
-       83,   83,   83,   84,   84,   84,   89,   89,   89,  100,
-
-      188,   82,   82,  192,   82,  197,  100,   82,  194,  198,
-      209,  199,  201,  200,  407,  183,  215,  216,  197,  210,
-      211,  235,  256,  257,   82,  226,  217,   82,  188,  192,
-      221,  837,  222,  197,  100,  201,  198,  195,  100,  199,
-      200,  227,  100,  407,  188,  230,  250,  838,  231,  223,
-      100,  266,  232,  198,  100,  290,  100,  187,  204,  204,
-      204,  205,  353,  236,  292,  204,  204,  204,  204,  204,
-      204,  260,  206,  276,  261,  262,  302,  277,  291,  290,
-      283,  278,  291,  290,  267,  268,  269,  292,  204,  204,
-      204,  204,  204,  204,  292,  270,  298,  271,  301,  272,
-
-      273,  305,  274,  302,  291,  307,  309,  293,  294,  298,
-      389,  409,  410,  354,  305,  403,  355,  295,  484,  298,
-      411,  415,  407,  390,  305,  403,  301,  412,  307,  465,
-      466,  839,  312,  309,  310,  310,  310,  360,  403,  317,
-      840,  310,  310,  310,  310,  310,  310,  318,  404,  415,
-      412,  419,  319,  320,  430,  450,  415,  488,  496,  431,
-      451,  489,  497,  472,  310,  310,  310,  310,  310,  310,
-      418,  418,  418,  473,  485,  672,  673,  418,  418,  418,
-      418,  418,  418,  501,  474,  513,  519,  502,  514,  524,
-      524,  520,  532,  558,  533,  548,  841,  635,  559,  634,
-
-      418,  418,  418,  418,  418,  418,  452,  608,  549,  630,
-      688,  453,  609,  731,  636,  732,  842,  524,  534,  532,
-      830,  533,   45,   45,   45,  635,  634,  721,  843,   45,
-       45,   45,   45,   45,   45,  697,  777,  722,  732,  778,
-      698,  731,  736,  737,  811,  738,  844,  689,  830,  845,
-      846,  812,   45,   45,   45,   45,   45,   45,  814,  847,
-      819,  848,  849,  850,  851,  815,  820,  852,  853,  816,
-      854,  855,  856,  857,  858,  859,  861,  699,  862,  863,
-      860,  864,  865,  866,  867,  868,  869,  870,  871,  872,
-      873,  874,  875,  876,  877,  879,  880,  881,  878,  882,
-
-      883,  884,  885,  886,  887,  888,  889,  890,  891,  892,
-      893,  894,  895,  896,  897,  898,  899,  900,  901,  902,
-      903,  904,  905,  906,  907,  909,  910,  911,  912,  913,
-      914,  915,  916,  917,  918,  919,  908,  920,  921,  922,
-      923,  924,  925,  926,  927,  928,  929,  930,  931,  932,
-      933,  934,  935,  936,  937,  938,  939,  940,  941,  942,
-      943,  944,  922,  945,  946,  921,  947,  948,  949,  950,
-      951,  952,  953,  954,  957,  958,  959,  960,  955,  961,
-      962,  963,  964,  965,  966,  967,  968,  969,  970,  971,
-      972,  974,  975,  976,  977,  978,  979,  980,  981,  982,
-
-      983,  973,  984,  985,  986,  987,  988,  989,  990,  991,
-      992,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
-     1002, 1003, 1004, 1005, 1006, 1007, 1008, 1010, 1009,  956,
-     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020,
-     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
-     1031, 1032, 1033, 1034, 1008, 1009, 1035, 1036, 1037, 1038,
-     1039, 1040, 1041, 1043, 1045, 1046, 1047, 1042, 1048, 1049,
-     1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
-     1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
-     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
-
-     1080, 1081, 1082, 1083, 1084, 1044, 1085, 1086, 1087, 1088,
-     1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098,
-     1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
-     1109, 1110, 1111, 1112, 1113, 1091, 1114, 1115, 1116, 1117,
-     1118, 1092, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
-     1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136,
-     1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146,
-     1147, 1148, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157,
-     1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1167, 1168,
-     1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178,
-
-     1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
-     1189, 1190, 1191, 1163, 1192, 1193, 1194, 1195, 1196, 1198,
-     1199, 1200, 1149, 1201, 1202, 1203, 1197, 1204, 1205, 1166,
-     1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
-     1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
-     1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235,
-     1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
-     1246, 1247, 1225, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
-     1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264,
-     1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
-
-     1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
-     1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
-     1296, 1297, 1298, 1299, 1300, 1273, 1301, 1302, 1303, 1304,
-     1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314,
-     1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324,
-     1325, 1327, 1328, 1329, 1330, 1326, 1331, 1332, 1333, 1334,
-     1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344,
-     1345, 1346, 1319, 1347, 1348, 1295, 1349, 1350, 1351, 1352,
-     1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
-     1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372,
-
-     1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382,
-     1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
-     1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402,
-     1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
-     1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422,
-     1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432,
-     1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442,
-     1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452,
-     1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462,
-     1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
-
-     1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
-     1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492,
-     1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502,
-     1503,   12,   12,   12,   12,   12,   36,   36,   36,   36,
-       36,   79,  297,   79,   79,   79,   98,  406,   98,  523,
-       98,  100,  100,  100,  100,  100,  116,  116,  116,  116,
-      116,  178,  100,  178,  178,  178,  202,  202,  202,  828,
-      827,  826,  825,  824,  823,  822,  821,  818,  817,  813,
-      810,  809,  808,  807,  806,  805,  804,  803,  802,  801,
-      800,  799,  798,  797,  796,  795,  794,  793,  792,  791,
-
-      790,  789,  788,  787,  786,  785,  784,  783,  782,  781,
-      780,  779,  776,  775,  774,  773,  772,  771,  770,  769,
-      768,  767,  766,  765,  764,  763,  762,  761,  760,  759,
-      758,  757,  756,  755,  754,  753,  752,  751,  750,  749,
-      748,  747,  746,  745,  744,  743,  742,  741,  740,  739,
-      735,  734,  733,  730,  729,  728,  727,  726,  725,  724,
-      723,  720,  719,  718,  717,  716,  715,  714,  713,  712,
-      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
-      701,  700,  696,  695,  694,  693,  692,  691,  690,  687,
-      686,  685,  684,  683,  682,  681,  680,  679,  678,  677,
-
-      676,  675,  674,  671,  670,  669,  668,  667,  666,  665,
-      664,  663,  662,  661,  660,  659,  658,  657,  656,  655,
-      654,  653,  652,  651,  650,  649,  648,  647,  646,  645,
-      644,  643,  642,  641,  640,  639,  638,  637,  633,  632,
-      631,  630,  629,  628,  627,  626,  625,  624,  623,  622,
-      621,  620,  619,  618,  617,  616,  615,  614,  613,  612,
-      611,  610,  607,  606,  605,  604,  603,  602,  601,  600,
-      599,  598,  597,  596,  595,  594,  593,  592,  591,  590,
-      589,  588,  587,  586,  585,  584,  583,  582,  581,  580,
-      579,  578,  577,  576,  575,  574,  573,  572,  571,  570,
-
-      569,  568,  567,  566,  565,  564,  563,  562,  561,  560,
-      557,  556,  555,  554,  553,  552,  551,  550,  547,  546,
-      545,  544,  543,  542,  541,  540,  539,  538,  537,  536,
-      535,  531,  530,  529,  528,  527,  526,  525,  522,  521,
-      518,  517,  516,  515,  512,  511,  510,  509,  508,  507,
-      506,  505,  504,  503,  500,  499,  498,  495,  494,  493,
-      492,  491,  490,  487,  486,  483,  482,  481,  480,  479,
-      478,  477,  476,  475,  471,  470,  469,  468,  467,  464,
-      463,  462,  461,  460,  459,  458,  457,  456,  455,  454,
-      449,  448,  447,  446,  445,  444,  443,  442,  441,  440,
-
-      439,  438,  437,  434,  433,  432,  429,  426,  425,  424,
-      423,  422,  421,  420,  417,  416,  414,  413,  408,  405,
-      402,  401,  400,  399,  398,  397,  395,  394,  393,  392,
-      391,  388,  387,  386,  385,  384,  383,  382,  379,  378,
-      377,  376,  375,  374,  373,  372,  371,  370,  369,  368,
-      367,  366,  363,  362,  361,  359,  358,  357,  356,  352,
-      351,  350,  349,  348,  347,  346,  345,  344,  343,  342,
-      341,  340,  339,  338,  337,  336,  335,  334,  333,  332,
-      331,  330,  329,  328,  327,  326,  325,  324,  323,  322,
-      321,  316,  315,  314,  313,  311,  203,  308,  306,  304,
-
-      303,  300,  299,  296,  289,  288,  287,  286,  285,  284,
-      282,  281,  280,  279,  275,  265,  264,  263,  259,  258,
-      255,  254,  253,  252,  251,  249,  248,  247,  246,  243,
-      242,  241,  240,  239,  238,  237,  234,  233,  229,  228,
-      220,  219,  218,  214,  213,  212,  208,  207,  203,  196,
-      191,  190,  189,  186,  185,  177,  162,  141,  106,  105,
-      104,   43,   99,   97,   96,   87,   43, 1504,   11, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504
+       45,   45,   59,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   11,  116,  116,  116,  116,  116,  117,  116,
+      116,  116,  116,  116,  116,   45,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,   45,  116,  116,  116,   45,  116,
+      116,  116,   45,  116,  116,  116,  116,  116,  116,   45,
+      116,  116,  116,   45,  116,   45,  118,  116,  116,  116,
+
+      116,  116,  116,  116,   11,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  204,  204,
+      204,  116,  116,  116,  116,  204,  204,  204,  204,  204,
+      204,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  204,
+      204,  204,  204,  204,  204,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,   11,   44,   44,   44,
+       45,   45,   46,   45,   45,   45,   45,  268,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   59,   45,
+       45,  269,  270,  271,   45,   45,   45,   45,   45,   45,
+       45,  272,   45,  273,   45,  274,  275,   45,  276,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   11,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  313,  313,  313,  116,  116,  116,  116,  313,
+      313,  313,  313,  313,  313,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  313,  313,  313,  313,  313,  313,  116,
+
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+       11,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  424,  424,  424,  116,  116,  116,
+      116,  424,  424,  424,  424,  424,  424,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  424,  424,  424,  424,  424,
+      424,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,   11,  116,  116,  116,  116,  116,  116,  116,
+
+      116,  116,  116,  116,  116,  116,   45,   45,   45,  116,
+      116,  116,  116,   45,   45,   45,   45,   45,   45,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,   45,   45,   45,
+       45,   45,   45,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,   11,   80,   80,   11,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   11,   86,   86,   11,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   11,   98,
+       98,   11,   98,   98,   43,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       11,  257,  258,   11,  116,  116,  203,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,   11,  126,   11,  153,   42,  127,   42,  102,
+      128,  129,  154,   11,  155,   11,  299,  299,  299,  156,
+      157,   41,  130,  299,  299,  299,  299,  299,  299,  411,
+      411,  411,  112,   87,  102,  479,  411,  411,  411,  411,
+      411,  411,  158,  113,  480,  159,  160,  299,  299,  299,
+
+      299,  299,  299,   11,   12,  161,  112,   11,  162,   11,
+      411,  411,  411,  411,  411,  411,   11,  532,  532,  532,
+      113,   89,   89,   89,  532,  532,  532,  532,  532,  532,
+       44,   44,   44,  753,  754,   11,  755,   44,   44,   44,
+       44,   44,   44,   11,  756,  112,   91,  102,  532,  532,
+      532,  532,  532,  532,   11,   81,  113,   82,   82,   82,
+       44,   44,   44,   44,   44,   44,   44,   44,   83,  172,
+       11,  173,  119,   91,   11,  174,   11,   43,  120,  121,
+       11,  321,   81,  113,   84,   84,   84,   11,  322,   11,
+      175,   11,   83,  323,  324,   83,   44,   90,   41,   81,
+
+       44,   84,   84,   84,   44,   81,   81,   81,   11,  309,
+      179,   44,   83,   11,  401,   44,   83,   44,  187,   83,
+       81,   90,   82,   82,   82,   81,   91,   84,   84,   84,
+       11,   12,  486,   83,   11,  179,   83,  457,   83,   88,
+       83,   88,  458,  487,   89,   89,   89,  166,   81,   81,
+       81,  167,   11,   94,  168,  111,   11,   83,  134,   83,
+      169,  170,   83,  114,  135,   88,  171,   88,   11,   11,
+       89,   89,   89,  122,   11,  150,  123,  151,  124,  152,
+      125,  143,  144,   83,   11,  145,   92,  114,  459,  542,
+      146,  543,  107,  460,   11,   90,  176,   11,   89,   89,
+
+       89,  177,   85,   92,   11,  181,   42,   86,   42,   11,
+       11,   11,   42,   92,   42,  542,  107,  543,  139,   93,
+      136,   11,  188,   11,  357,  137,  133,  140,  138,  141,
+       95,  147,  181,   11,  181,  148,  210,   40,  205,  180,
+      222,  179,  223,   11,  211,  212,  216,  217,  294,  206,
+      231,  180,   11,  232,  149,  218,  261,  233,  224,  262,
+      263,  184,   11,  278,  180,  713,  182,  279,  292,   11,
+      714,  280,  294,  293,   11,  358,  183,   11,  359,  415,
+      416,  980,   40,  835,   12,   11,  981,  292,  417,  836,
+       11,   11,  293,  837,  294,  292,  103,  109,  293,  408,
+
+      107,  108,  408,   96,   11,  131,  111,  114,  715,  115,
+       99,  188,  164,  189,  295,  132,  165,  296,  297,  193,
+      194,  103,  195,  408,  107,  110,  409,  198,  108,   12,
+      111,  114,  199,  200,  115,  201,  225,  982,  188,  189,
+      202,  227,   97,  236,  193,  245,  194,  198,  226,  265,
+      199,  185,  196,  266,  198,   11,  228,  300,  199,  301,
+      200,  201,  304,  308,  202,  246,  305,  310,  312,  300,
+      368,  308,  385,  394,  251,  386,  285,   11,  412,  418,
+      413,  300,  421,  301,  412,  395,  237,  308,  434,  304,
+      421,  310,  305,  315,  312,  364,  437,  492,  442,  472,
+
+      473,  438,  443,  418,  435,  522,  412,  413,  523,  421,
+      298,  496,  425,   11,  534,  497,  505,  481,  369,  510,
+      506,  528,  533,  511,  533,  559,  529,  569,  621,   11,
+      648,  649,  570,  622,  643,  686,  687,  560,  688,  650,
+      738,  410,  534,  703,  748,  749,  851, 1036,  832,  533,
+      739,  544,  796,  493,  833,  797,  648,  840,  649,  881,
+      946,  531,  900,  841,  882,  932,  901,  947, 1037,  749,
+      999,  748, 1070,  851, 1036, 1072,  933, 1071,  642, 1122,
+     1000,  704, 1123, 1181, 1196, 1198,  946, 1231, 1260, 1310,
+      689,  947, 1330, 1331, 1037, 1232, 1332, 1358,   11, 1365,
+
+       11,   11,   11, 1122, 1366,   11,   11,   11,   11, 1123,
+       11, 1196, 1260,   11,   11, 1310,  186,   11, 1073,   11,
+      192,   11,   11,   11, 1358,  235,  239,  259, 1199,  306,
+      309,  311,  314,  325, 1182,  326,  353,  106,  356,  363,
+      365,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      419,  178, 1333,  422,  429,  142,  445,  478,  105,  241,
+      243,  191,  219,  242,  104,  197,  244,  209,  221,  213,
+      163,  190,  229,  230,  247,  207,  220,  215,  238,  214,
+      248,  249,  208,  234,  240,  250,  252,  253,  254,  255,
+      256,  260,  264,  267,  277,  281,  282,  283,  284,  286,
+
+      287,  288,  289,  290,  291,  302,  303,  307,  316,  317,
+      318,  319,  320,  327,  328,  329,  330,  331,  332,  333,
+      334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+      344,  345,  346,  347,  348,  349,  350,  351,  352,  354,
+      355,  360,  361,  362,  366,  367,  370,  371,  372,  373,
+      374,  375,  376,  377,  378,  379,  380,  381,  382,  383,
+      384,  387,  388,  389,  390,  391,  392,  393,  396,  397,
+      398,  399,  400,  402,  403,  404,  405,  406,  407,  414,
+      420,  423,  426,  427,  428,  430,  431,  432,  433,  436,
+      439,  440,  441,  444,  446,  447,  448,  449,  450,  451,
+
+      452,  453,  454,  455,  456,  461,  462,  463,  464,  465,
+      466,  467,  468,  469,  470,  471,  474,  475,  476,  477,
+       11,   11,   11,   11,   11,   11,  494,  524,  525,  526,
+      536,  482,  537,  539,  541,  545,  546,   11,   11,   11,
+       11,   11,   11,   11,   11,  578,  594,  597,  608,  574,
+      577,  584,  635,  613,  614,  623,   11,   11,   11,   11,
+       11,   11,   11,  643,  644,  504,  509,  515,  500,  499,
+      501,  495,  514,  491,  498,  516,  488,  503,  483,  484,
+      490,  502,  512,  513,  485,  517,  489,  508,  507,  518,
+      519,  520,  521,  527,  530,  535,  538,  540,  547,  548,
+
+      549,  550,  551,  552,  553,  554,  555,  556,  557,  558,
+      561,  562,  563,  564,  565,  566,  567,  568,  571,  572,
+      573,  575,  576,  579,  580,  581,  582,  583,  585,  586,
+      587,  588,  589,  590,  591,  592,  593,  595,  596,  598,
+      599,  600,  601,  602,  603,  604,  605,  606,  607,  609,
+      610,  611,  612,  615,  616,  617,  618,  619,  620,  624,
+      625,  626,  627,  628,  629,  630,  631,  632,  633,  634,
+      636,  637,  638,  639,  640,  641,  645,  646,  647,   11,
+       11,   11,   11,   11,   11,   11,  675,  696,   11,   11,
+      651,  653,  667,   11,  701,  665,  702,  721,  724,  731,
+
+      732,  733,  734,  736,  737,   11,   11,   11,   11,   11,
+       11,  747,  752,  775,  792,  793,  745,  757,  759,  760,
+      764,  768,  774,  798,  799,  802,  683,  663,  660,  661,
+      666,  670,  659,  671,  657,  672,  676,  677,  678,  679,
+      658,  669,  652,  654,  655,  656,  662,  664,  668,  673,
+      674,  680,  681,  682,  684,  685,  690,  691,  692,  693,
+      694,  695,  697,  698,  699,  700,  705,  706,  707,  708,
+      709,  710,  711,  712,  716,  717,  718,  719,  720,  722,
+      723,  725,  726,  727,  728,  729,  730,  735,  740,  741,
+      742,  743,  744,  746,  750,  751,  758,  761,  762,  763,
+
+      765,  766,  767,  769,  770,  771,  772,  773,  776,  777,
+      778,  779,  780,  781,  782,  783,  784,  785,  786,  787,
+      788,  789,  790,  791,  794,  795,  800,  801,  803,  804,
+      805,  806,  807,  808,  809,  810,  811,  812,  813,  814,
+      815,  816,  817,  818,  819,  820,  821,  822,  823,  824,
+      825,  826,  827,  828,  829,  830,  831,  834,  838,  839,
+      842,  843,  844,  845,  846,  847,  848,  849,   11,   11,
+       11,   11,   11,   11,   11,  870,  888,   11,   11,  850,
+      874,  904,  907,  908,  912,  905,  917,  936,   11,  942,
+       11,   11,   11,   11,  963,   11,   11,   11,   11,  962,
+
+       11,  972,   11,  989, 1008, 1020, 1023, 1003, 1024, 1011,
+     1048, 1050, 1067, 1053,  855,  862,  872,  852,  856,  863,
+      864,  866,  876,  853,  875,  877,  859,  854,  860,  865,
+      869,  861,  858,  857,  867,  868,  871,  873,  878,  879,
+      880,  883,  884,  885,  886,  887,  889,  890,  891,  892,
+      893,  894,  895,  896,  897,  898,  899,  902,  903,  906,
+      909,  910,  911,  913,  914,  915,  916,  918,  919,  920,
+      921,  922,  923,  924,  925,  926,  927,  928,  929,  930,
+      931,  934,  935,  937,  938,  939,  940,  941,  943,  944,
+      945,  948,  949,  950,  951,  952,  953,  954,  955,  956,
+
+      957,  958,  959,  960,  961,  964,  965,  966,  967,  968,
+      969,  970,  971,  973,  974,  975,  976,  977,  978,  979,
+      983,  984,  985,  986,  987,  988,  990,  991,  992,  993,
+      994,  995,  996,  997,  998, 1001, 1002, 1004, 1005, 1006,
+     1007, 1009, 1010, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+     1019, 1021, 1022, 1025, 1026, 1027, 1028, 1029, 1030, 1031,
+     1032, 1033, 1034, 1035, 1038, 1039, 1040, 1041, 1042, 1043,
+     1044, 1045, 1046, 1047, 1049, 1051, 1052, 1054, 1055, 1056,
+     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
+     1068,   11,   11,   11,   11,   11,   11, 1082, 1086, 1091,
+
+     1092, 1094, 1095, 1096, 1112, 1124, 1131,   11,   11,   11,
+       11,   11,   11, 1140,   11,   11,   11, 1158, 1164,   11,
+     1165,   11, 1160,   11,   11, 1168,   11, 1177, 1184, 1186,
+     1188, 1189, 1191, 1197, 1211, 1202, 1077, 1075, 1076, 1085,
+     1081, 1098, 1101, 1108, 1069, 1074, 1087, 1080, 1088, 1083,
+     1089, 1084, 1090, 1078, 1079, 1093, 1097, 1099, 1100, 1102,
+     1103, 1104, 1105, 1106, 1107, 1109, 1110, 1111, 1113, 1114,
+     1115, 1116, 1117, 1118, 1119, 1120, 1121, 1125, 1126, 1127,
+     1128, 1129, 1130, 1132, 1133, 1134, 1135, 1136, 1137, 1138,
+     1139, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+
+     1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1159, 1161,
+     1162, 1163, 1166, 1167, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1176, 1178, 1179, 1180, 1183, 1185, 1187, 1190, 1192,
+     1193, 1194, 1195, 1200, 1201, 1203, 1204, 1205, 1206, 1207,
+     1208, 1209, 1210, 1212,   11,   11,   11,   11,   11,   11,
+     1223, 1225, 1226, 1229, 1234, 1241, 1242, 1245, 1251,   11,
+       11,   11,   11,   11,   11,   11,   11,   11, 1257, 1259,
+     1271, 1274,   11,   11,   11, 1265, 1282,   11,   11,   11,
+       11,   11,   11,   11, 1290,   11, 1304, 1307, 1311, 1297,
+     1312, 1317, 1213, 1215, 1214, 1217, 1218, 1219, 1235, 1237,
+
+     1216, 1239, 1224, 1244, 1236, 1221, 1222, 1220, 1227, 1228,
+     1233, 1238, 1240, 1243, 1230, 1246, 1247, 1248, 1249, 1250,
+     1252, 1253, 1254, 1255, 1256, 1258, 1261, 1262, 1263, 1266,
+     1264, 1267, 1268, 1269, 1270, 1272, 1273, 1275, 1276, 1277,
+     1278, 1279, 1280, 1281, 1283, 1284, 1285, 1286, 1287, 1288,
+     1289, 1291, 1292, 1293, 1294, 1295, 1296, 1298, 1299, 1300,
+     1301, 1302, 1303, 1305, 1306, 1308, 1309, 1313, 1314, 1315,
+     1316, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+     1327, 1328, 1329, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+     1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
+
+     1351, 1352, 1353,   11,   11,   11,   11,   11,   11,   11,
+     1357,   11, 1362,   11,   11,   11,   11, 1371,   11, 1375,
+       11,   11, 1368,   11, 1389, 1393, 1395, 1396,   11, 1381,
+     1404,   11,   11,   11,   11,   11,   11, 1411, 1413, 1406,
+     1423,   11, 1436, 1437, 1425,   11, 1426, 1428,   11,   11,
+       11, 1443, 1354,   11, 1454,   11, 1461, 1356, 1361, 1360,
+     1373, 1374, 1464, 1382, 1380, 1355, 1376, 1363, 1359, 1372,
+     1364, 1367, 1378, 1383, 1370, 1384, 1385, 1379, 1369, 1377,
+     1387, 1386, 1388, 1390, 1391, 1392, 1394, 1397, 1398, 1399,
+     1400, 1401, 1402, 1403, 1405, 1407, 1408, 1409, 1410, 1412,
+
+     1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1424,
+     1427, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1438, 1439,
+     1440, 1441, 1442, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+     1451, 1452, 1453, 1455, 1456, 1457, 1458, 1459, 1460, 1462,
+     1463, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473,
+     1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481,   11,   11,
+       11,   11,   11,   11, 1482,   11, 1485, 1487,   11,   11,
+       11,   11,   11,   11,   11, 1503, 1514, 1520, 1522, 1523,
+     1506, 1530, 1531, 1532,   11,   11,   11,   11,   11,   11,
+     1550, 1550, 1537, 1540, 1546, 1549, 1550, 1550, 1541, 1550,
+
+     1550, 1550, 1550, 1483, 1550, 1550, 1550, 1550, 1489, 1550,
+     1550, 1550, 1496, 1550, 1550, 1550, 1527, 1490, 1486, 1498,
+     1495, 1500, 1488, 1484, 1491, 1492, 1493, 1494, 1497, 1499,
+     1501, 1502, 1504, 1505, 1507, 1508, 1509, 1510, 1511, 1512,
+     1513, 1515, 1516, 1517, 1518, 1519, 1521, 1524, 1525, 1526,
+     1528, 1529, 1533, 1534, 1535, 1536, 1538, 1539, 1542, 1543,
+     1544, 1545, 1547, 1548, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550
     } ;
 
-static const flex_int16_t yy_chk[1941] =
+static const flex_int16_t yy_chk[3159] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  254,
-        3,    3,    3,   21,    1,    1,    3,  731,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  733,    8,
-        8,    8,    1,    8,   57,   27,   28,  254,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-       62,   66,   25,  734,   25,  736,    2,   25,   25,   25,
-       62,   66,    2,   66,  269,   20,   51,  269,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   47,   17,   17,   17,   19,   53,   19,
-       19,   19,   44,   56,   22,   17,   22,   22,   22,   60,
-       19,   64,   60,   55,   60,  283,   60,   22,   64,   47,
-      283,   59,  100,   55,   65,  737,   56,   53,   17,   65,
-       74,   63,   65,   19,   74,   90,   55,   44,   69,  146,
-       22,   45,   69,   45,   45,   45,   45,   59,   45,   45,
-       45,   55,   58,   59,   63,   45,   45,  100,   45,   58,
-      146,   90,   69,  738,   45,   63,   45,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   58,   88,   88,
-       88,   58,   61,  327,   70,   58,   61,  327,   92,   61,
-       61,   68,   68,   58,   91,   68,   71,   58,   95,   58,
-       58,   68,   61,   70,   71,   70,   71,   70,   76,   77,
-       72,   71,   71,   72,   72,   75,   92,  320,   76,   75,
-       91,  108,   75,  131,   72,   93,   95,   72,  739,   75,
-       75,   76,   77,   76,  320,   75,  131,   76,   80,   80,
-       80,   81,   77,   81,   81,   81,   76,   77,  108,   80,
-       82,   93,   82,   76,   81,   82,   82,   82,   83,   94,
-       83,   83,   83,   84,   84,   84,   89,   89,   89,  102,
-
-      103,   83,   80,  107,   84,  111,  102,   81,  109,  112,
-      122,  113,  115,  114,  298,   94,  126,  126,  151,  122,
-      122,  138,  157,  157,   83,  132,  126,   84,  103,  107,
-      130,  740,  130,  111,  102,  115,  112,  109,  102,  113,
-      114,  132,  102,  298,  119,  135,  151,  741,  135,  130,
-      102,  164,  135,  171,  102,  179,  102,  102,  118,  118,
-      118,  119,  245,  138,  181,  118,  118,  118,  118,  118,
-      118,  160,  119,  166,  160,  160,  193,  166,  180,  182,
-      171,  166,  183,  179,  164,  164,  164,  181,  118,  118,
-      118,  118,  118,  118,  184,  164,  188,  164,  192,  164,
-
-      164,  197,  164,  193,  180,  199,  201,  182,  183,  206,
-      277,  300,  300,  245,  250,  290,  245,  184,  371,  188,
-      300,  305,  312,  277,  197,  293,  192,  301,  199,  353,
-      353,  742,  206,  201,  204,  204,  204,  250,  290,  211,
-      743,  204,  204,  204,  204,  204,  204,  211,  293,  305,
-      301,  312,  211,  211,  323,  341,  360,  374,  381,  323,
-      341,  374,  381,  359,  204,  204,  204,  204,  204,  204,
-      310,  310,  310,  359,  371,  573,  573,  310,  310,  310,
-      310,  310,  310,  385,  360,  396,  401,  385,  396,  407,
-      419,  401,  417,  445,  417,  435,  744,  533,  445,  532,
-
-      310,  310,  310,  310,  310,  310,  341,  498,  435,  534,
-      590,  341,  498,  634,  534,  635,  745,  407,  419,  417,
-      732,  417,  418,  418,  418,  533,  532,  623,  746,  418,
-      418,  418,  418,  418,  418,  599,  679,  623,  635,  679,
-      599,  634,  639,  639,  715,  639,  747,  590,  732,  748,
-      749,  715,  418,  418,  418,  418,  418,  418,  717,  750,
-      720,  751,  752,  753,  754,  717,  720,  755,  756,  717,
-      758,  759,  760,  761,  762,  763,  764,  599,  765,  766,
-      763,  767,  768,  769,  770,  771,  772,  775,  776,  777,
-      778,  781,  782,  783,  784,  785,  786,  787,  784,  788,
-
-      789,  790,  792,  793,  794,  795,  796,  797,  798,  799,
-      800,  801,  802,  803,  804,  805,  806,  807,  808,  809,
-      810,  811,  812,  813,  814,  815,  816,  817,  818,  819,
-      820,  822,  823,  824,  825,  826,  814,  827,  829,  830,
-      831,  832,  833,  834,  835,  836,  837,  838,  839,  840,
-      841,  842,  843,  844,  845,  846,  847,  849,  850,  851,
-      852,  853,  830,  854,  855,  829,  856,  857,  858,  860,
-      861,  862,  863,  864,  865,  867,  868,  869,  864,  870,
-      871,  872,  873,  874,  875,  876,  877,  878,  879,  880,
-      881,  882,  885,  886,  887,  889,  890,  891,  893,  894,
-
-      895,  881,  896,  897,  898,  899,  900,  901,  902,  903,
-      904,  905,  906,  907,  908,  909,  910,  912,  913,  914,
-      915,  916,  917,  918,  919,  920,  921,  923,  922,  864,
-      924,  925,  926,  927,  928,  929,  930,  931,  932,  933,
-      934,  935,  936,  938,  939,  940,  941,  942,  943,  944,
-      945,  946,  947,  948,  921,  922,  949,  950,  951,  952,
-      953,  955,  956,  957,  958,  959,  960,  956,  961,  962,
-      963,  964,  965,  966,  967,  968,  969,  970,  971,  972,
-      973,  974,  975,  976,  977,  978,  979,  981,  982,  983,
-      984,  985,  986,  987,  988,  989,  990,  991,  993,  994,
-
-      997,  998,  999, 1000, 1001,  957, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
-     1016, 1017, 1018, 1020, 1022, 1023, 1024, 1025, 1026, 1027,
-     1028, 1029, 1030, 1031, 1032, 1008, 1033, 1034, 1035, 1036,
-     1037, 1009, 1040, 1042, 1044, 1045, 1046, 1047, 1048, 1049,
-     1050, 1051, 1053, 1054, 1055, 1057, 1058, 1059, 1060, 1063,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-     1075, 1076, 1077, 1078, 1079, 1080, 1082, 1083, 1084, 1085,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1094, 1095, 1096,
-     1097, 1098, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
-
-     1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
-     1119, 1120, 1121, 1091, 1122, 1123, 1124, 1126, 1127, 1128,
-     1129, 1130, 1076, 1133, 1134, 1135, 1127, 1136, 1137, 1094,
-     1138, 1139, 1140, 1141, 1142, 1143, 1145, 1146, 1147, 1148,
-     1149, 1150, 1152, 1154, 1157, 1159, 1160, 1161, 1162, 1163,
-     1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
-     1176, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
-     1187, 1188, 1163, 1190, 1193, 1195, 1196, 1197, 1198, 1200,
-     1201, 1202, 1203, 1204, 1205, 1208, 1209, 1211, 1212, 1213,
-     1214, 1215, 1217, 1218, 1219, 1220, 1221, 1223, 1225, 1226,
-
-     1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1236, 1237,
-     1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1246, 1247,
-     1248, 1249, 1250, 1251, 1252, 1225, 1253, 1254, 1255, 1256,
-     1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266,
-     1268, 1269, 1271, 1272, 1273, 1276, 1277, 1278, 1282, 1283,
-     1285, 1286, 1287, 1288, 1289, 1285, 1290, 1291, 1292, 1293,
-     1295, 1296, 1299, 1300, 1301, 1302, 1304, 1305, 1306, 1307,
-     1308, 1309, 1273, 1310, 1311, 1247, 1312, 1313, 1314, 1315,
-     1316, 1317, 1319, 1320, 1321, 1323, 1324, 1326, 1327, 1328,
-     1329, 1330, 1332, 1333, 1334, 1336, 1337, 1338, 1339, 1340,
-
-     1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1350, 1351,
-     1352, 1354, 1357, 1358, 1359, 1360, 1361, 1362, 1364, 1365,
-     1366, 1367, 1368, 1369, 1371, 1373, 1374, 1375, 1376, 1377,
-     1378, 1379, 1380, 1381, 1383, 1384, 1385, 1386, 1387, 1388,
-     1389, 1390, 1391, 1392, 1393, 1396, 1397, 1398, 1399, 1400,
-     1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1412,
-     1413, 1414, 1415, 1416, 1417, 1419, 1420, 1423, 1424, 1425,
-     1426, 1427, 1429, 1430, 1431, 1433, 1434, 1436, 1437, 1439,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+
+       59,   59,   59,   59,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  424,  424,  424,  424,  424,  424,  424,  424,
+
+      424,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,  424,  424,   16,   16,   16,   12,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   86,   86,   86,   18,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   40,   40,
+       40,   14,   40,   40,   14,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+      116,  158,  158,   23,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  187,   62,   13,   72,   13,   62,   13,   47,
+       62,   62,   72,   24,   72,  299,  187,  187,  187,   72,
+       72,    9,   62,  187,  187,  187,  187,  187,  187,  299,
+      299,  299,   56,   24,   47,  363,  299,  299,  299,  299,
+      299,  299,   73,   56,  363,   73,   73,  187,  187,  187,
+
+      187,  187,  187,  411,    9,   73,   56,   88,   73,   27,
+      299,  299,  299,  299,  299,  299,  532,  411,  411,  411,
+       56,   88,   88,   88,  411,  411,  411,  411,  411,  411,
+      532,  532,  532,  653,  653,   29,  653,  532,  532,  532,
+      532,  532,  532,   17,  653,   77,   27,   60,  411,  411,
+      411,  411,  411,  411,  101,   17,   77,   17,   17,   17,
+      101,  532,  532,  532,  532,  532,  532,  101,   17,   77,
+       19,   77,   60,   27,   43,   77,   26,   43,   60,   60,
+       90,  212,   19,   77,   19,   19,   19,   22,  212,   32,
+       77,   20,   17,  212,  212,   19,  101,   26,   10,   22,
+
+      101,   22,   22,   22,  101,   20,   20,   20,   82,  285,
+       90,  101,   22,   84,  285,  101,   20,  101,  101,   19,
+       82,   26,   82,   82,   82,   84,   32,   84,   84,   84,
+       25,   10,  370,   82,   81,   90,   22,  345,   84,   25,
+       20,   25,  345,  370,   25,   25,   25,   76,   81,   81,
+       81,   76,   28,   32,   76,   71,   83,   82,   65,   81,
+       76,   76,   84,   78,   65,   83,   76,   83,   92,   33,
+       83,   83,   83,   61,   31,   71,   61,   71,   61,   71,
+       61,   69,   69,   81,   89,   69,   28,   78,  345,  423,
+       69,  423,   64,  345,   21,   31,   78,   95,   89,   89,
+
+       89,   78,   21,   33,   37,   92,   37,   21,   37,   91,
+       42,   93,   42,   28,   42,  423,   64,  423,   67,   31,
+       66,   94,  119,  181,  246,   66,   64,   67,   66,   67,
+       33,   70,   92,  179,   95,   70,  123,    7,  119,   91,
+      131,   93,  131,  180,  123,  123,  127,  127,  181,  119,
+      136,   94,  182,  136,   70,  127,  161,  136,  131,  161,
+      161,   95,  183,  167,   91,  611,   93,  167,  179,  184,
+      611,  167,  181,  180,  292,  246,   94,  295,  246,  303,
+      303,  886,    8,  734,    7,   39,  886,  182,  303,  734,
+       38,   41,  183,  734,  184,  179,   48,   54,  180,  292,
+
+       52,   53,  295,   38,   97,   63,   55,   57,  611,   58,
+       41,  102,   75,  103,  182,   63,   75,  183,  184,  107,
+      108,   48,  109,  292,   52,   54,  295,  111,   53,    8,
+       55,   57,  112,  113,   58,  114,  132,  886,  102,  103,
+      115,  133,   39,  139,  107,  147,  108,  152,  132,  163,
+      172,   97,  109,  163,  111,  185,  133,  188,  112,  189,
+      113,  114,  193,  198,  115,  147,  194,  200,  202,  206,
+      255,  251,  271,  279,  152,  271,  172,  298,  300,  304,
+      301,  188,  308,  189,  315,  279,  139,  198,  324,  193,
+      364,  200,  194,  206,  202,  251,  327,  375,  331,  357,
+
+      357,  327,  331,  304,  324,  401,  300,  301,  401,  308,
+      185,  378,  315,  410,  413,  378,  386,  364,  255,  390,
+      386,  406,  412,  390,  425,  442,  406,  452,  507,  531,
+      542,  543,  452,  507,  544,  584,  584,  442,  585,  544,
+      636,  298,  413,  601,  648,  649,  749,  946,  732,  412,
+      636,  425,  694,  375,  732,  694,  542,  737,  543,  781,
+      850,  410,  803,  737,  781,  835,  803,  851,  947,  649,
+      905,  648,  982,  749,  946,  983,  835,  982,  531, 1036,
+      905,  601, 1037, 1107, 1122, 1125,  850, 1160, 1196, 1260,
+      585,  851, 1282, 1282,  947, 1160, 1283, 1310,   30, 1323,
+
+       34,   35,   36, 1036, 1323,   46,   85,   87,   96, 1037,
+       99, 1122, 1196,  100,  186, 1260,   98,  192,  983,  195,
+      106,  203,  236,  293, 1310,  138,  141,  159, 1125,  196,
+      199,  201,  205,  213, 1107,  214,  242,   51,  245,  250,
+      252,  294,  296,  297,  306,  309,  311,  314,  325,  365,
+      305,   79, 1283,  310,  319,   68,  333,  362,   50,  143,
+      145,  105,  128,  144,   49,  110,  146,  122,  130,  124,
+       74,  104,  134,  135,  148,  120,  129,  126,  140,  125,
+      149,  150,  121,  137,  142,  151,  153,  154,  155,  156,
+      157,  160,  162,  164,  166,  168,  169,  170,  171,  173,
+
+      174,  175,  176,  177,  178,  190,  191,  197,  207,  208,
+      209,  210,  211,  215,  216,  217,  218,  219,  220,  221,
+      222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+      232,  233,  234,  235,  237,  238,  239,  240,  241,  243,
+      244,  247,  248,  249,  253,  254,  256,  257,  258,  259,
+      260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+      270,  272,  273,  274,  275,  276,  277,  278,  280,  281,
+      282,  283,  284,  286,  287,  288,  289,  290,  291,  302,
+      307,  312,  316,  317,  318,  320,  321,  322,  323,  326,
+      328,  329,  330,  332,  334,  335,  336,  337,  338,  339,
+
+      340,  341,  342,  343,  344,  346,  347,  348,  349,  350,
+      351,  352,  353,  354,  355,  356,  358,  359,  360,  361,
+      408,  409,  419,  422,  429,  437,  376,  402,  403,  404,
+      415,  366,  416,  418,  421,  426,  427,  445,  457,  478,
+      492,  494,  524,  525,  526,  461,  477,  481,  493,  456,
+      460,  467,  520,  499,  500,  508,  528,  536,  537,  539,
+      541,  545,  546,  533,  534,  385,  389,  394,  381,  380,
+      382,  377,  393,  374,  379,  395,  371,  384,  367,  368,
+      373,  383,  391,  392,  369,  396,  372,  388,  387,  397,
+      398,  399,  400,  405,  407,  414,  417,  420,  428,  430,
+
+      431,  432,  433,  434,  435,  436,  438,  439,  440,  441,
+      443,  444,  446,  447,  448,  449,  450,  451,  453,  454,
+      455,  458,  459,  462,  463,  464,  465,  466,  468,  469,
+      470,  471,  472,  473,  474,  475,  476,  479,  480,  482,
+      483,  484,  485,  486,  487,  488,  489,  490,  491,  495,
+      496,  497,  498,  501,  502,  503,  504,  505,  506,  509,
+      510,  511,  512,  513,  514,  515,  516,  517,  518,  519,
+      521,  522,  523,  527,  529,  530,  535,  538,  540,  569,
+      578,  594,  597,  608,  621,  635,  572,  592,  642,  643,
+      547,  549,  563,  644,  599,  561,  600,  617,  620,  628,
+
+      629,  630,  631,  633,  634,  675,  696,  703,  713,  738,
+      747,  647,  652,  672,  690,  691,  645,  654,  656,  657,
+      661,  665,  671,  695,  697,  700,  581,  559,  556,  557,
+      562,  566,  555,  567,  553,  568,  573,  574,  575,  576,
+      554,  565,  548,  550,  551,  552,  558,  560,  564,  570,
+      571,  577,  579,  580,  582,  583,  586,  587,  588,  589,
+      590,  591,  593,  595,  596,  598,  602,  603,  604,  605,
+      606,  607,  609,  610,  612,  613,  614,  615,  616,  618,
+      619,  622,  623,  624,  625,  626,  627,  632,  637,  638,
+      639,  640,  641,  646,  650,  651,  655,  658,  659,  660,
+
+      662,  663,  664,  666,  667,  668,  669,  670,  673,  674,
+      676,  677,  678,  679,  680,  681,  682,  683,  684,  685,
+      686,  687,  688,  689,  692,  693,  698,  699,  701,  702,
+      704,  705,  706,  707,  708,  709,  710,  711,  712,  714,
+      715,  716,  717,  718,  719,  720,  721,  722,  723,  724,
+      725,  726,  727,  728,  729,  730,  731,  733,  735,  736,
+      739,  740,  741,  742,  743,  744,  745,  746,  752,  775,
+      792,  793,  798,  799,  811,  769,  787,  842,  849,  748,
+      773,  806,  809,  810,  815,  807,  820,  838,  870,  845,
+      881,  888,  904,  907,  867,  908,  912,  917,  936,  866,
+
+      963,  877,  980,  894,  916,  929,  932,  910,  933,  920,
+      958,  960,  978,  964,  754,  761,  771,  750,  755,  762,
+      763,  765,  776,  751,  774,  777,  758,  753,  759,  764,
+      768,  760,  757,  756,  766,  767,  770,  772,  778,  779,
+      780,  782,  783,  784,  785,  786,  788,  789,  790,  791,
+      794,  795,  796,  797,  800,  801,  802,  804,  805,  808,
+      812,  813,  814,  816,  817,  818,  819,  821,  822,  823,
+      824,  825,  826,  827,  828,  829,  830,  831,  832,  833,
+      834,  836,  837,  839,  840,  841,  843,  844,  846,  847,
+      848,  852,  853,  854,  855,  856,  857,  858,  859,  860,
+
+      861,  862,  863,  864,  865,  868,  869,  871,  872,  873,
+      874,  875,  876,  878,  879,  880,  882,  883,  884,  885,
+      887,  889,  890,  891,  892,  893,  895,  896,  897,  898,
+      899,  900,  901,  902,  903,  906,  909,  911,  913,  914,
+      915,  918,  919,  921,  922,  923,  924,  925,  926,  927,
+      928,  930,  931,  934,  935,  937,  938,  939,  940,  941,
+      942,  943,  944,  945,  948,  949,  950,  951,  952,  953,
+      954,  955,  956,  957,  959,  961,  962,  965,  966,  967,
+      968,  969,  970,  971,  972,  973,  974,  975,  976,  977,
+      979, 1008, 1020, 1023, 1024, 1048, 1050,  992,  996, 1001,
+
+     1002, 1004, 1005, 1006, 1026, 1038, 1045, 1067, 1068, 1070,
+     1072, 1082, 1086, 1056, 1091, 1092, 1094, 1078, 1085, 1096,
+     1087, 1112, 1080, 1124, 1131, 1090, 1140, 1103, 1109, 1111,
+     1114, 1115, 1117, 1123, 1138, 1128,  987,  985,  986,  995,
+      991, 1009, 1012, 1019,  981,  984,  997,  990,  998,  993,
+      999,  994, 1000,  988,  989, 1003, 1007, 1010, 1011, 1013,
+     1014, 1015, 1016, 1017, 1018, 1021, 1022, 1025, 1027, 1028,
+     1029, 1030, 1031, 1032, 1033, 1034, 1035, 1039, 1040, 1041,
+     1042, 1043, 1044, 1046, 1047, 1049, 1051, 1052, 1053, 1054,
+     1055, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
+
+     1066, 1069, 1071, 1073, 1074, 1075, 1076, 1077, 1079, 1081,
+     1083, 1084, 1088, 1089, 1093, 1095, 1097, 1098, 1099, 1100,
+     1101, 1102, 1104, 1105, 1106, 1108, 1110, 1113, 1116, 1118,
+     1119, 1120, 1121, 1126, 1127, 1129, 1130, 1132, 1133, 1134,
+     1135, 1136, 1137, 1139, 1158, 1164, 1165, 1177, 1184, 1186,
+     1151, 1153, 1154, 1157, 1162, 1171, 1172, 1175, 1182, 1188,
+     1189, 1191, 1197, 1198, 1211, 1223, 1225, 1226, 1193, 1195,
+     1209, 1213, 1229, 1234, 1241, 1203, 1221, 1242, 1245, 1251,
+     1257, 1259, 1271, 1274, 1233, 1304, 1252, 1255, 1261, 1243,
+     1262, 1267, 1141, 1143, 1142, 1145, 1146, 1147, 1163, 1167,
+
+     1144, 1169, 1152, 1174, 1166, 1149, 1150, 1148, 1155, 1156,
+     1161, 1168, 1170, 1173, 1159, 1176, 1178, 1179, 1180, 1181,
+     1183, 1185, 1187, 1190, 1192, 1194, 1199, 1200, 1201, 1204,
+     1202, 1205, 1206, 1207, 1208, 1210, 1212, 1214, 1215, 1216,
+     1217, 1218, 1219, 1220, 1222, 1224, 1227, 1228, 1230, 1231,
+     1232, 1235, 1236, 1237, 1238, 1239, 1240, 1244, 1246, 1247,
+     1248, 1249, 1250, 1253, 1254, 1256, 1258, 1263, 1264, 1265,
+     1266, 1268, 1269, 1270, 1272, 1273, 1275, 1276, 1277, 1278,
+     1279, 1280, 1281, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
+     1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+
+     1301, 1302, 1303, 1307, 1311, 1312, 1317, 1318, 1319, 1322,
+     1309, 1332, 1316, 1335, 1336, 1337, 1342, 1328, 1357, 1333,
+     1362, 1365, 1325, 1371, 1351, 1355, 1358, 1359, 1375, 1343,
+     1369, 1389, 1393, 1395, 1396, 1404, 1411, 1378, 1380, 1372,
+     1391, 1413, 1408, 1409, 1394, 1423, 1397, 1399, 1436, 1437,
+     1443, 1417, 1305, 1454, 1429, 1461, 1438, 1308, 1315, 1314,
+     1330, 1331, 1441, 1344, 1341, 1306, 1334, 1320, 1313, 1329,
+     1321, 1324, 1339, 1345, 1327, 1346, 1347, 1340, 1326, 1338,
+     1349, 1348, 1350, 1352, 1353, 1354, 1356, 1360, 1361, 1363,
+     1364, 1366, 1367, 1368, 1370, 1373, 1374, 1376, 1377, 1379,
+
+     1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1390, 1392,
+     1398, 1400, 1401, 1402, 1403, 1405, 1406, 1407, 1410, 1412,
+     1414, 1415, 1416, 1418, 1419, 1420, 1421, 1422, 1424, 1425,
+     1426, 1427, 1428, 1430, 1431, 1432, 1433, 1434, 1435, 1439,
      1440, 1442, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451,
-     1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461,
-
-     1462, 1463, 1464, 1465, 1466, 1467, 1469, 1470, 1471, 1472,
-     1473, 1475, 1478, 1479, 1480, 1481, 1482, 1483, 1487, 1488,
-     1489, 1490, 1492, 1493, 1495, 1496, 1497, 1498, 1499, 1501,
-     1502, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506,
-     1506, 1507, 1513, 1507, 1507, 1507, 1508, 1514, 1508, 1515,
-     1508, 1509, 1509, 1509, 1509, 1509, 1510, 1510, 1510, 1510,
-     1510, 1511, 1516, 1511, 1511, 1511, 1512, 1512, 1512,  729,
-      728,  727,  726,  725,  724,  723,  722,  719,  718,  716,
-      714,  713,  712,  711,  710,  709,  708,  707,  706,  705,
-      704,  703,  702,  701,  700,  699,  698,  696,  695,  694,
-
-      693,  692,  691,  690,  689,  687,  686,  685,  684,  683,
-      682,  680,  678,  677,  676,  675,  674,  673,  672,  671,
-      670,  669,  668,  667,  666,  665,  664,  663,  662,  660,
-      659,  658,  657,  656,  655,  654,  653,  652,  651,  650,
-      649,  648,  647,  646,  645,  644,  643,  642,  641,  640,
-      638,  637,  636,  633,  632,  631,  628,  627,  626,  625,
-      624,  621,  620,  619,  618,  617,  616,  615,  614,  613,
-      612,  611,  610,  609,  607,  606,  605,  604,  603,  602,
-      601,  600,  598,  597,  595,  594,  593,  592,  591,  589,
-      588,  587,  585,  584,  582,  581,  580,  579,  578,  577,
-
-      576,  575,  574,  572,  571,  570,  569,  568,  566,  565,
-      564,  563,  562,  561,  560,  559,  557,  556,  555,  554,
-      553,  552,  551,  550,  549,  548,  547,  546,  545,  544,
-      543,  542,  541,  540,  539,  538,  537,  536,  530,  528,
-      525,  524,  522,  521,  520,  518,  514,  513,  512,  511,
-      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
-      500,  499,  497,  496,  495,  494,  493,  492,  491,  490,
-      489,  488,  487,  485,  483,  482,  481,  480,  479,  478,
-      477,  476,  475,  474,  473,  472,  470,  469,  468,  467,
-      466,  465,  464,  463,  462,  461,  460,  459,  458,  457,
-
-      456,  455,  454,  453,  452,  451,  449,  448,  447,  446,
-      444,  443,  442,  441,  440,  439,  437,  436,  434,  433,
-      432,  431,  429,  428,  427,  426,  425,  424,  423,  421,
-      420,  415,  414,  412,  411,  410,  409,  408,  405,  402,
-      400,  399,  398,  397,  395,  394,  393,  392,  391,  390,
-      389,  388,  387,  386,  384,  383,  382,  380,  379,  378,
-      377,  376,  375,  373,  372,  370,  369,  368,  367,  366,
-      365,  364,  363,  362,  358,  357,  356,  355,  354,  352,
-      351,  350,  349,  348,  347,  346,  345,  344,  343,  342,
-      340,  339,  338,  337,  336,  335,  334,  333,  332,  331,
-
-      330,  329,  328,  326,  325,  324,  322,  319,  318,  317,
-      316,  315,  314,  313,  309,  307,  304,  302,  299,  296,
-      289,  288,  287,  286,  285,  284,  282,  281,  280,  279,
-      278,  276,  275,  274,  273,  272,  271,  270,  268,  267,
-      266,  265,  264,  263,  262,  261,  260,  259,  258,  257,
-      256,  255,  253,  252,  251,  249,  248,  247,  246,  244,
-      243,  242,  241,  240,  239,  238,  237,  236,  234,  233,
-      232,  231,  230,  229,  228,  227,  226,  225,  224,  223,
-      222,  221,  220,  219,  218,  217,  216,  215,  214,  213,
-      212,  210,  209,  208,  207,  205,  202,  200,  198,  196,
-
-      195,  190,  189,  185,  177,  176,  175,  174,  173,  172,
-      170,  169,  168,  167,  165,  163,  162,  161,  159,  158,
-      156,  155,  154,  153,  152,  150,  149,  148,  147,  145,
-      144,  143,  142,  141,  140,  139,  137,  136,  134,  133,
-      129,  128,  127,  125,  124,  123,  121,  120,  116,  110,
-      106,  105,  104,   98,   97,   78,   73,   67,   50,   49,
-       48,   43,   41,   39,   38,   24,   14,   11, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-     1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504
+     1452, 1453, 1455, 1456, 1457, 1458, 1459, 1460, 1464, 1465,
+     1471, 1476, 1479, 1482, 1462, 1485, 1467, 1469, 1487, 1503,
+     1514, 1520, 1522, 1523, 1530, 1491, 1502, 1509, 1511, 1512,
+     1494, 1521, 1524, 1525, 1531, 1532, 1537, 1540, 1546, 1549,
+        0,    0, 1533, 1536, 1544, 1548,    0,    0, 1538,    0,
+
+        0,    0,    0, 1463,    0,    0,    0,    0, 1472,    0,
+        0,    0, 1481,    0,    0,    0, 1517, 1473, 1468, 1484,
+     1480, 1488, 1470, 1466, 1474, 1475, 1477, 1478, 1483, 1486,
+     1489, 1490, 1492, 1493, 1495, 1496, 1497, 1498, 1499, 1500,
+     1501, 1504, 1505, 1506, 1507, 1508, 1510, 1513, 1515, 1516,
+     1518, 1519, 1526, 1527, 1528, 1529, 1534, 1535, 1539, 1541,
+     1542, 1543, 1545, 1547,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+     1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1696,28 +1974,28 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[183] =
+static const flex_int16_t yy_rule_linenum[189] =
     {   0,
       149,  151,  153,  158,  159,  164,  165,  166,  178,  181,
       186,  193,  202,  211,  220,  229,  238,  247,  256,  265,
       274,  283,  292,  301,  310,  319,  328,  338,  348,  358,
-      368,  378,  387,  397,  407,  417,  427,  436,  445,  454,
-      463,  472,  481,  490,  499,  508,  517,  526,  535,  544,
-      553,  566,  575,  584,  593,  602,  613,  624,  635,  646,
-      658,  669,  680,  691,  702,  713,  724,  735,  746,  757,
-      768,  779,  790,  801,  812,  823,  832,  841,  851,  860,
-      869,  884,  900,  909,  918,  927,  936,  945,  954,  963,
-      972,  981,  990, 1012, 1034, 1043, 1053, 1063, 1072, 1082,
-
-     1093, 1102, 1111, 1120, 1129, 1138, 1148, 1157, 1166, 1175,
-     1184, 1193, 1202, 1211, 1220, 1229, 1239, 1248, 1257, 1267,
-     1279, 1292, 1301, 1310, 1320, 1330, 1339, 1350, 1360, 1369,
-     1379, 1389, 1398, 1407, 1416, 1425, 1435, 1444, 1454, 1463,
-     1472, 1481, 1490, 1499, 1508, 1517, 1526, 1535, 1544, 1553,
-     1562, 1571, 1580, 1589, 1598, 1607, 1616, 1625, 1634, 1643,
-     1652, 1661, 1670, 1679, 1689, 1788, 1793, 1798, 1803, 1804,
-     1805, 1806, 1807, 1808, 1810, 1828, 1841, 1846, 1850, 1852,
-     1854, 1856
+      368,  378,  388,  397,  407,  417,  427,  437,  446,  455,
+      464,  473,  482,  491,  500,  509,  518,  527,  536,  545,
+      554,  563,  576,  585,  594,  603,  612,  623,  634,  645,
+      656,  668,  679,  690,  701,  712,  723,  734,  745,  756,
+      767,  778,  789,  800,  811,  822,  833,  844,  853,  862,
+      872,  881,  890,  905,  921,  930,  939,  948,  957,  966,
+      975,  984,  993, 1002, 1011, 1033, 1055, 1064, 1074, 1084,
+
+     1093, 1103, 1114, 1123, 1132, 1141, 1150, 1159, 1169, 1178,
+     1187, 1196, 1205, 1214, 1223, 1232, 1241, 1250, 1259, 1268,
+     1277, 1287, 1296, 1305, 1315, 1327, 1340, 1349, 1358, 1368,
+     1378, 1387, 1398, 1408, 1417, 1427, 1437, 1446, 1455, 1464,
+     1473, 1483, 1492, 1502, 1511, 1520, 1529, 1538, 1547, 1556,
+     1565, 1574, 1583, 1592, 1601, 1610, 1619, 1628, 1637, 1646,
+     1655, 1664, 1673, 1682, 1691, 1700, 1709, 1718, 1727, 1736,
+     1746, 1845, 1850, 1855, 1860, 1861, 1862, 1863, 1864, 1865,
+     1867, 1885, 1898, 1903, 1907, 1909, 1911, 1913
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1770,7 +2048,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1774 "dhcp6_lexer.cc"
+#line 2051 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1796,8 +2074,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1800 "dhcp6_lexer.cc"
-#line 1801 "dhcp6_lexer.cc"
+#line 2077 "dhcp6_lexer.cc"
+#line 2078 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2129,7 +2407,7 @@ YY_DECL
     }
 
 
-#line 2133 "dhcp6_lexer.cc"
+#line 2410 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2158,13 +2436,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1505 )
+				if ( yy_current_state >= 1551 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1504 );
+		while ( yy_current_state != 1550 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2183,13 +2461,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 183 )
+			else if ( yy_act < 189 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 183 )
+			else if ( yy_act == 189 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 184 )
+			else if ( yy_act == 190 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2517,8 +2795,8 @@ YY_RULE_SETUP
 #line 358 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
+    if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp6Parser::make_BINARY(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2541,6 +2819,19 @@ YY_RULE_SETUP
 case 32:
 YY_RULE_SETUP
 #line 378 "dhcp6_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
+        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+#line 388 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME:
@@ -2550,9 +2841,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 34:
 YY_RULE_SETUP
-#line 387 "dhcp6_lexer.ll"
+#line 397 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2563,9 +2854,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 34:
+case 35:
 YY_RULE_SETUP
-#line 397 "dhcp6_lexer.ll"
+#line 407 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2576,9 +2867,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 407 "dhcp6_lexer.ll"
+#line 417 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2589,9 +2880,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 417 "dhcp6_lexer.ll"
+#line 427 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2602,9 +2893,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 427 "dhcp6_lexer.ll"
+#line 437 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2614,9 +2905,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 436 "dhcp6_lexer.ll"
+#line 446 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2626,9 +2917,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 445 "dhcp6_lexer.ll"
+#line 455 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2638,9 +2929,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 454 "dhcp6_lexer.ll"
+#line 464 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2650,9 +2941,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 463 "dhcp6_lexer.ll"
+#line 473 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2662,9 +2953,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 472 "dhcp6_lexer.ll"
+#line 482 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2674,9 +2965,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 481 "dhcp6_lexer.ll"
+#line 491 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SANITY_CHECKS:
@@ -2686,9 +2977,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 490 "dhcp6_lexer.ll"
+#line 500 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2698,9 +2989,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 499 "dhcp6_lexer.ll"
+#line 509 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2710,9 +3001,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 508 "dhcp6_lexer.ll"
+#line 518 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2722,9 +3013,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 517 "dhcp6_lexer.ll"
+#line 527 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2734,9 +3025,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 526 "dhcp6_lexer.ll"
+#line 536 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG_CONTROL:
@@ -2746,9 +3037,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 535 "dhcp6_lexer.ll"
+#line 545 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG_CONTROL:
@@ -2758,9 +3049,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 544 "dhcp6_lexer.ll"
+#line 554 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOSTS_DATABASE:
@@ -2770,9 +3061,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 52:
 YY_RULE_SETUP
-#line 553 "dhcp6_lexer.ll"
+#line 563 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2786,9 +3077,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 53:
 YY_RULE_SETUP
-#line 566 "dhcp6_lexer.ll"
+#line 576 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2798,9 +3089,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 54:
 YY_RULE_SETUP
-#line 575 "dhcp6_lexer.ll"
+#line 585 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2810,9 +3101,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 55:
 YY_RULE_SETUP
-#line 584 "dhcp6_lexer.ll"
+#line 594 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2822,9 +3113,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 56:
 YY_RULE_SETUP
-#line 593 "dhcp6_lexer.ll"
+#line 603 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2834,9 +3125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 602 "dhcp6_lexer.ll"
+#line 612 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2848,9 +3139,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 58:
 YY_RULE_SETUP
-#line 613 "dhcp6_lexer.ll"
+#line 623 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2862,9 +3153,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 59:
 YY_RULE_SETUP
-#line 624 "dhcp6_lexer.ll"
+#line 634 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2876,9 +3167,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 60:
 YY_RULE_SETUP
-#line 635 "dhcp6_lexer.ll"
+#line 645 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2890,9 +3181,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 61:
 YY_RULE_SETUP
-#line 646 "dhcp6_lexer.ll"
+#line 656 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2905,9 +3196,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 62:
 YY_RULE_SETUP
-#line 658 "dhcp6_lexer.ll"
+#line 668 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2919,9 +3210,23 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 63:
 YY_RULE_SETUP
-#line 669 "dhcp6_lexer.ll"
+#line 679 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+    case isc::dhcp::Parser6Context::CONFIG_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_IN_PROCESS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-in-process", driver.loc_);
+    }
+}
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+#line 690 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2933,9 +3238,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 65:
 YY_RULE_SETUP
-#line 680 "dhcp6_lexer.ll"
+#line 701 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2947,9 +3252,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 66:
 YY_RULE_SETUP
-#line 691 "dhcp6_lexer.ll"
+#line 712 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2961,9 +3266,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 67:
 YY_RULE_SETUP
-#line 702 "dhcp6_lexer.ll"
+#line 723 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2975,9 +3280,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 68:
 YY_RULE_SETUP
-#line 713 "dhcp6_lexer.ll"
+#line 734 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2989,9 +3294,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 69:
 YY_RULE_SETUP
-#line 724 "dhcp6_lexer.ll"
+#line 745 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3003,9 +3308,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 70:
 YY_RULE_SETUP
-#line 735 "dhcp6_lexer.ll"
+#line 756 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3017,9 +3322,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 71:
 YY_RULE_SETUP
-#line 746 "dhcp6_lexer.ll"
+#line 767 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3031,9 +3336,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 72:
 YY_RULE_SETUP
-#line 757 "dhcp6_lexer.ll"
+#line 778 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3045,9 +3350,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 73:
 YY_RULE_SETUP
-#line 768 "dhcp6_lexer.ll"
+#line 789 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3059,9 +3364,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 74:
 YY_RULE_SETUP
-#line 779 "dhcp6_lexer.ll"
+#line 800 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3073,9 +3378,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 75:
 YY_RULE_SETUP
-#line 790 "dhcp6_lexer.ll"
+#line 811 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3087,9 +3392,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 76:
 YY_RULE_SETUP
-#line 801 "dhcp6_lexer.ll"
+#line 822 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3101,9 +3406,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 77:
 YY_RULE_SETUP
-#line 812 "dhcp6_lexer.ll"
+#line 833 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3115,9 +3420,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 78:
 YY_RULE_SETUP
-#line 823 "dhcp6_lexer.ll"
+#line 844 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3127,9 +3432,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 79:
 YY_RULE_SETUP
-#line 832 "dhcp6_lexer.ll"
+#line 853 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3139,9 +3444,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 80:
 YY_RULE_SETUP
-#line 841 "dhcp6_lexer.ll"
+#line 862 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3152,9 +3457,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 81:
 YY_RULE_SETUP
-#line 851 "dhcp6_lexer.ll"
+#line 872 "dhcp6_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3164,9 +3469,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 82:
 YY_RULE_SETUP
-#line 860 "dhcp6_lexer.ll"
+#line 881 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3176,9 +3481,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 83:
 YY_RULE_SETUP
-#line 869 "dhcp6_lexer.ll"
+#line 890 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3194,9 +3499,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 84:
 YY_RULE_SETUP
-#line 884 "dhcp6_lexer.ll"
+#line 905 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3213,9 +3518,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 85:
 YY_RULE_SETUP
-#line 900 "dhcp6_lexer.ll"
+#line 921 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3225,9 +3530,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 86:
 YY_RULE_SETUP
-#line 909 "dhcp6_lexer.ll"
+#line 930 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3237,9 +3542,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 87:
 YY_RULE_SETUP
-#line 918 "dhcp6_lexer.ll"
+#line 939 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3249,9 +3554,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 88:
 YY_RULE_SETUP
-#line 927 "dhcp6_lexer.ll"
+#line 948 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3261,9 +3566,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 89:
 YY_RULE_SETUP
-#line 936 "dhcp6_lexer.ll"
+#line 957 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3273,9 +3578,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 90:
 YY_RULE_SETUP
-#line 945 "dhcp6_lexer.ll"
+#line 966 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3285,9 +3590,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 91:
 YY_RULE_SETUP
-#line 954 "dhcp6_lexer.ll"
+#line 975 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3297,9 +3602,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 92:
 YY_RULE_SETUP
-#line 963 "dhcp6_lexer.ll"
+#line 984 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3309,9 +3614,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 93:
 YY_RULE_SETUP
-#line 972 "dhcp6_lexer.ll"
+#line 993 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3321,9 +3626,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 94:
 YY_RULE_SETUP
-#line 981 "dhcp6_lexer.ll"
+#line 1002 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -3333,9 +3638,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 95:
 YY_RULE_SETUP
-#line 990 "dhcp6_lexer.ll"
+#line 1011 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3358,9 +3663,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 96:
 YY_RULE_SETUP
-#line 1012 "dhcp6_lexer.ll"
+#line 1033 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3383,9 +3688,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 97:
 YY_RULE_SETUP
-#line 1034 "dhcp6_lexer.ll"
+#line 1055 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3395,9 +3700,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 98:
 YY_RULE_SETUP
-#line 1043 "dhcp6_lexer.ll"
+#line 1064 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3408,9 +3713,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 99:
 YY_RULE_SETUP
-#line 1053 "dhcp6_lexer.ll"
+#line 1074 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3421,9 +3726,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 100:
 YY_RULE_SETUP
-#line 1063 "dhcp6_lexer.ll"
+#line 1084 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3433,9 +3738,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 101:
 YY_RULE_SETUP
-#line 1072 "dhcp6_lexer.ll"
+#line 1093 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3446,9 +3751,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 102:
 YY_RULE_SETUP
-#line 1082 "dhcp6_lexer.ll"
+#line 1103 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3460,9 +3765,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 103:
 YY_RULE_SETUP
-#line 1093 "dhcp6_lexer.ll"
+#line 1114 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3472,9 +3777,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 104:
 YY_RULE_SETUP
-#line 1102 "dhcp6_lexer.ll"
+#line 1123 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3484,9 +3789,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 105:
 YY_RULE_SETUP
-#line 1111 "dhcp6_lexer.ll"
+#line 1132 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3496,9 +3801,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 106:
 YY_RULE_SETUP
-#line 1120 "dhcp6_lexer.ll"
+#line 1141 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3508,9 +3813,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 107:
 YY_RULE_SETUP
-#line 1129 "dhcp6_lexer.ll"
+#line 1150 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3520,9 +3825,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 108:
 YY_RULE_SETUP
-#line 1138 "dhcp6_lexer.ll"
+#line 1159 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3533,9 +3838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 109:
 YY_RULE_SETUP
-#line 1148 "dhcp6_lexer.ll"
+#line 1169 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3545,9 +3850,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 110:
 YY_RULE_SETUP
-#line 1157 "dhcp6_lexer.ll"
+#line 1178 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3557,9 +3862,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 111:
 YY_RULE_SETUP
-#line 1166 "dhcp6_lexer.ll"
+#line 1187 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3569,9 +3874,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 112:
 YY_RULE_SETUP
-#line 1175 "dhcp6_lexer.ll"
+#line 1196 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3581,9 +3886,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 113:
 YY_RULE_SETUP
-#line 1184 "dhcp6_lexer.ll"
+#line 1205 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGING:
@@ -3593,9 +3898,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 114:
 YY_RULE_SETUP
-#line 1193 "dhcp6_lexer.ll"
+#line 1214 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3605,9 +3910,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 115:
 YY_RULE_SETUP
-#line 1202 "dhcp6_lexer.ll"
+#line 1223 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3617,9 +3922,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 116:
 YY_RULE_SETUP
-#line 1211 "dhcp6_lexer.ll"
+#line 1232 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3629,9 +3934,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 117:
 YY_RULE_SETUP
-#line 1220 "dhcp6_lexer.ll"
+#line 1241 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3641,9 +3946,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 118:
 YY_RULE_SETUP
-#line 1229 "dhcp6_lexer.ll"
+#line 1250 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3653,9 +3958,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 119:
 YY_RULE_SETUP
-#line 1239 "dhcp6_lexer.ll"
+#line 1259 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 120:
+YY_RULE_SETUP
+#line 1268 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 121:
+YY_RULE_SETUP
+#line 1277 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 122:
+YY_RULE_SETUP
+#line 1287 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3665,9 +4006,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 123:
 YY_RULE_SETUP
-#line 1248 "dhcp6_lexer.ll"
+#line 1296 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3677,9 +4018,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 124:
 YY_RULE_SETUP
-#line 1257 "dhcp6_lexer.ll"
+#line 1305 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3690,9 +4031,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 125:
 YY_RULE_SETUP
-#line 1267 "dhcp6_lexer.ll"
+#line 1315 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3705,9 +4046,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 126:
 YY_RULE_SETUP
-#line 1279 "dhcp6_lexer.ll"
+#line 1327 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3721,9 +4062,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 127:
 YY_RULE_SETUP
-#line 1292 "dhcp6_lexer.ll"
+#line 1340 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3733,9 +4074,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 128:
 YY_RULE_SETUP
-#line 1301 "dhcp6_lexer.ll"
+#line 1349 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3745,9 +4086,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 129:
 YY_RULE_SETUP
-#line 1310 "dhcp6_lexer.ll"
+#line 1358 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3758,9 +4099,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 130:
 YY_RULE_SETUP
-#line 1320 "dhcp6_lexer.ll"
+#line 1368 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3771,9 +4112,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 131:
 YY_RULE_SETUP
-#line 1330 "dhcp6_lexer.ll"
+#line 1378 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3783,9 +4124,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 132:
 YY_RULE_SETUP
-#line 1339 "dhcp6_lexer.ll"
+#line 1387 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -3797,9 +4138,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 133:
 YY_RULE_SETUP
-#line 1350 "dhcp6_lexer.ll"
+#line 1398 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3810,9 +4151,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 134:
 YY_RULE_SETUP
-#line 1360 "dhcp6_lexer.ll"
+#line 1408 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3822,9 +4163,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 135:
 YY_RULE_SETUP
-#line 1369 "dhcp6_lexer.ll"
+#line 1417 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3835,9 +4176,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 136:
 YY_RULE_SETUP
-#line 1379 "dhcp6_lexer.ll"
+#line 1427 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3848,9 +4189,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 137:
 YY_RULE_SETUP
-#line 1389 "dhcp6_lexer.ll"
+#line 1437 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3860,9 +4201,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 138:
 YY_RULE_SETUP
-#line 1398 "dhcp6_lexer.ll"
+#line 1446 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3872,9 +4213,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 139:
 YY_RULE_SETUP
-#line 1407 "dhcp6_lexer.ll"
+#line 1455 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3884,9 +4225,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 140:
 YY_RULE_SETUP
-#line 1416 "dhcp6_lexer.ll"
+#line 1464 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3896,9 +4237,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 141:
 YY_RULE_SETUP
-#line 1425 "dhcp6_lexer.ll"
+#line 1473 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3909,9 +4250,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 142:
 YY_RULE_SETUP
-#line 1435 "dhcp6_lexer.ll"
+#line 1483 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3921,9 +4262,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 143:
 YY_RULE_SETUP
-#line 1444 "dhcp6_lexer.ll"
+#line 1492 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3933,9 +4274,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 144:
 YY_RULE_SETUP
-#line 1454 "dhcp6_lexer.ll"
+#line 1502 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3945,9 +4286,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 145:
 YY_RULE_SETUP
-#line 1463 "dhcp6_lexer.ll"
+#line 1511 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3957,9 +4298,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 146:
 YY_RULE_SETUP
-#line 1472 "dhcp6_lexer.ll"
+#line 1520 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3969,9 +4310,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 147:
 YY_RULE_SETUP
-#line 1481 "dhcp6_lexer.ll"
+#line 1529 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3981,9 +4322,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 148:
 YY_RULE_SETUP
-#line 1490 "dhcp6_lexer.ll"
+#line 1538 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3993,9 +4334,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 149:
 YY_RULE_SETUP
-#line 1499 "dhcp6_lexer.ll"
+#line 1547 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4005,9 +4346,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 150:
 YY_RULE_SETUP
-#line 1508 "dhcp6_lexer.ll"
+#line 1556 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4017,9 +4358,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 151:
 YY_RULE_SETUP
-#line 1517 "dhcp6_lexer.ll"
+#line 1565 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4029,9 +4370,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 152:
 YY_RULE_SETUP
-#line 1526 "dhcp6_lexer.ll"
+#line 1574 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4041,9 +4382,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 153:
 YY_RULE_SETUP
-#line 1535 "dhcp6_lexer.ll"
+#line 1583 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4053,9 +4394,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 154:
 YY_RULE_SETUP
-#line 1544 "dhcp6_lexer.ll"
+#line 1592 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4065,9 +4406,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 155:
 YY_RULE_SETUP
-#line 1553 "dhcp6_lexer.ll"
+#line 1601 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4077,9 +4418,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 156:
 YY_RULE_SETUP
-#line 1562 "dhcp6_lexer.ll"
+#line 1610 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4089,9 +4430,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 157:
 YY_RULE_SETUP
-#line 1571 "dhcp6_lexer.ll"
+#line 1619 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4101,9 +4442,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 158:
 YY_RULE_SETUP
-#line 1580 "dhcp6_lexer.ll"
+#line 1628 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4113,9 +4454,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 159:
 YY_RULE_SETUP
-#line 1589 "dhcp6_lexer.ll"
+#line 1637 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4125,9 +4466,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 160:
 YY_RULE_SETUP
-#line 1598 "dhcp6_lexer.ll"
+#line 1646 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4137,9 +4478,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 161:
 YY_RULE_SETUP
-#line 1607 "dhcp6_lexer.ll"
+#line 1655 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4149,9 +4490,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 162:
 YY_RULE_SETUP
-#line 1616 "dhcp6_lexer.ll"
+#line 1664 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4161,9 +4502,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 163:
 YY_RULE_SETUP
-#line 1625 "dhcp6_lexer.ll"
+#line 1673 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4173,9 +4514,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 164:
 YY_RULE_SETUP
-#line 1634 "dhcp6_lexer.ll"
+#line 1682 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4185,9 +4526,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 165:
+YY_RULE_SETUP
+#line 1691 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::CONTROL_SOCKET:
+        return isc::dhcp::Dhcp6Parser::make_CONFIG_OUTPUT_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("config-output-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 166:
 YY_RULE_SETUP
-#line 1643 "dhcp6_lexer.ll"
+#line 1700 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4197,9 +4550,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 167:
 YY_RULE_SETUP
-#line 1652 "dhcp6_lexer.ll"
+#line 1709 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4209,9 +4562,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 168:
 YY_RULE_SETUP
-#line 1661 "dhcp6_lexer.ll"
+#line 1718 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4221,9 +4574,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 169:
 YY_RULE_SETUP
-#line 1670 "dhcp6_lexer.ll"
+#line 1727 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4233,9 +4586,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 164:
+case 170:
 YY_RULE_SETUP
-#line 1679 "dhcp6_lexer.ll"
+#line 1736 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4245,9 +4598,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 171:
 YY_RULE_SETUP
-#line 1689 "dhcp6_lexer.ll"
+#line 1746 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4347,65 +4700,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 166:
-/* rule 166 can match eol */
+case 172:
+/* rule 172 can match eol */
 YY_RULE_SETUP
-#line 1788 "dhcp6_lexer.ll"
+#line 1845 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 167:
-/* rule 167 can match eol */
+case 173:
+/* rule 173 can match eol */
 YY_RULE_SETUP
-#line 1793 "dhcp6_lexer.ll"
+#line 1850 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 168:
+case 174:
 YY_RULE_SETUP
-#line 1798 "dhcp6_lexer.ll"
+#line 1855 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 169:
+case 175:
 YY_RULE_SETUP
-#line 1803 "dhcp6_lexer.ll"
+#line 1860 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 170:
+case 176:
 YY_RULE_SETUP
-#line 1804 "dhcp6_lexer.ll"
+#line 1861 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 171:
+case 177:
 YY_RULE_SETUP
-#line 1805 "dhcp6_lexer.ll"
+#line 1862 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 172:
+case 178:
 YY_RULE_SETUP
-#line 1806 "dhcp6_lexer.ll"
+#line 1863 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 173:
+case 179:
 YY_RULE_SETUP
-#line 1807 "dhcp6_lexer.ll"
+#line 1864 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 174:
+case 180:
 YY_RULE_SETUP
-#line 1808 "dhcp6_lexer.ll"
+#line 1865 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 175:
+case 181:
 YY_RULE_SETUP
-#line 1810 "dhcp6_lexer.ll"
+#line 1867 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4424,9 +4777,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 176:
+case 182:
 YY_RULE_SETUP
-#line 1828 "dhcp6_lexer.ll"
+#line 1885 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4440,43 +4793,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 177:
+case 183:
 YY_RULE_SETUP
-#line 1841 "dhcp6_lexer.ll"
+#line 1898 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 178:
+case 184:
 YY_RULE_SETUP
-#line 1846 "dhcp6_lexer.ll"
+#line 1903 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 179:
+case 185:
 YY_RULE_SETUP
-#line 1850 "dhcp6_lexer.ll"
+#line 1907 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 180:
+case 186:
 YY_RULE_SETUP
-#line 1852 "dhcp6_lexer.ll"
+#line 1909 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 181:
+case 187:
 YY_RULE_SETUP
-#line 1854 "dhcp6_lexer.ll"
+#line 1911 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 182:
+case 188:
 YY_RULE_SETUP
-#line 1856 "dhcp6_lexer.ll"
+#line 1913 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1858 "dhcp6_lexer.ll"
+#line 1915 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -4500,12 +4853,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 183:
+case 189:
 YY_RULE_SETUP
-#line 1881 "dhcp6_lexer.ll"
+#line 1938 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4509 "dhcp6_lexer.cc"
+#line 4861 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4824,7 +5177,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1505 )
+			if ( yy_current_state >= 1551 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4857,11 +5210,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1505 )
+		if ( yy_current_state >= 1551 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1504);
+	yy_is_jam = (yy_current_state == 1550);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5610,8 +5963,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1881 "dhcp6_lexer.ll"
-
+#line 1938 "dhcp6_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -5713,4 +6065,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
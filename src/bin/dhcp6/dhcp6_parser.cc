@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 34 "dhcp6_parser.yy" // lalr1.cc:438
+#line 34 "dhcp6_parser.yy"
 
 #include <dhcp6/parser_context.h>
 
-#line 51 "dhcp6_parser.cc" // lalr1.cc:438
+#line 52 "dhcp6_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -88,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER6_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER6_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:513
+#line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 146 "dhcp6_parser.cc" // lalr1.cc:513
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp6Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp6_parser.cc"
 
   /// Build a parser object.
   Dhcp6Parser::Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg)
-    :
 #if PARSER6_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -195,24 +157,26 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::~Dhcp6Parser ()
   {}
 
+  Dhcp6Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  Dhcp6Parser::by_state::by_state ()
+  Dhcp6Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  Dhcp6Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp6Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
   void
-  Dhcp6Parser::by_state::clear ()
+  Dhcp6Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
@@ -224,17 +188,17 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  Dhcp6Parser::by_state::by_state (state_type s)
+  Dhcp6Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  Dhcp6Parser::symbol_number_type
-  Dhcp6Parser::by_state::type_get () const
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   Dhcp6Parser::stack_symbol_type::stack_symbol_type ()
@@ -243,31 +207,32 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 177: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 176: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 175: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 174: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -275,7 +240,7 @@ namespace isc { namespace dhcp {
         break;
     }
 
-#if defined __cplusplus && 201103L <= __cplusplus
+#if 201103L <= YY_CPLUSPLUS
     // that is emptied.
     that.state = empty_state;
 #endif
@@ -284,31 +249,32 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 177: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 176: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 175: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 174: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -317,39 +283,81 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+  Dhcp6Parser::stack_symbol_type&
+  Dhcp6Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
   }
 
-#if !defined __cplusplus || __cplusplus < 201103L
   Dhcp6Parser::stack_symbol_type&
   Dhcp6Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
-    {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 177: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 176: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 175: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 174: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -375,103 +383,97 @@ namespace isc { namespace dhcp {
 #if PARSER6_DEBUG
   template <typename Base>
   void
-  Dhcp6Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp6Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 174: // "constant string"
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 398 "dhcp6_parser.cc" // lalr1.cc:672
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 404 "dhcp6_parser.cc"
         break;
 
-      case 175: // "integer"
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 405 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_INTEGER: // "integer"
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 410 "dhcp6_parser.cc"
         break;
 
-      case 176: // "floating point"
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< double > (); }
-#line 412 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 416 "dhcp6_parser.cc"
         break;
 
-      case 177: // "boolean"
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 419 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 422 "dhcp6_parser.cc"
         break;
 
-      case 195: // value
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 426 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_value: // value
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 428 "dhcp6_parser.cc"
         break;
 
-      case 199: // map_value
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 433 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_map_value: // map_value
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 434 "dhcp6_parser.cc"
         break;
 
-      case 253: // db_type
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 440 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_db_type: // db_type
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 440 "dhcp6_parser.cc"
         break;
 
-      case 346: // hr_mode
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 447 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_hr_mode: // hr_mode
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 446 "dhcp6_parser.cc"
         break;
 
-      case 482: // duid_type
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 454 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_duid_type: // duid_type
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 452 "dhcp6_parser.cc"
         break;
 
-      case 517: // ncr_protocol_value
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 461 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 458 "dhcp6_parser.cc"
         break;
 
-      case 524: // replace_client_name_value
-
-#line 253 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 468 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 464 "dhcp6_parser.cc"
         break;
 
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 260 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 470 "dhcp6_parser.cc"
+        break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -486,7 +488,7 @@ namespace isc { namespace dhcp {
   void
   Dhcp6Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-#if defined __cplusplus && 201103L <= __cplusplus
+#if 201103L <= YY_CPLUSPLUS
     yypush_ (m, stack_symbol_type (s, std::move (sym)));
 #else
     stack_symbol_type ss (s, sym);
@@ -495,7 +497,7 @@ namespace isc { namespace dhcp {
   }
 
   void
-  Dhcp6Parser::yypop_ (int n)
+  Dhcp6Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -530,21 +532,21 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::state_type
   Dhcp6Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue)
+  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue)
+  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -558,7 +560,6 @@ namespace isc { namespace dhcp {
   int
   Dhcp6Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -590,27 +591,33 @@ namespace isc { namespace dhcp {
     yystack_.clear ();
     yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -621,6 +628,7 @@ namespace isc { namespace dhcp {
 #if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
@@ -628,11 +636,23 @@ namespace isc { namespace dhcp {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -649,20 +669,22 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -674,29 +696,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 177: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 176: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 175: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 174: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -707,8 +730,8 @@ namespace isc { namespace dhcp {
 
       // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
         yyerror_range[1].location = yylhs.location;
       }
 
@@ -720,288 +743,288 @@ namespace isc { namespace dhcp {
         {
           switch (yyn)
             {
-  case 2:
-#line 262 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 727 "dhcp6_parser.cc" // lalr1.cc:907
+  case 2: // $@1: %empty
+#line 269 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 750 "dhcp6_parser.cc"
     break;
 
-  case 4:
-#line 263 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 733 "dhcp6_parser.cc" // lalr1.cc:907
+  case 4: // $@2: %empty
+#line 270 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 756 "dhcp6_parser.cc"
     break;
 
-  case 6:
-#line 264 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 739 "dhcp6_parser.cc" // lalr1.cc:907
+  case 6: // $@3: %empty
+#line 271 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP6; }
+#line 762 "dhcp6_parser.cc"
     break;
 
-  case 8:
-#line 265 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 745 "dhcp6_parser.cc" // lalr1.cc:907
+  case 8: // $@4: %empty
+#line 272 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 768 "dhcp6_parser.cc"
     break;
 
-  case 10:
-#line 266 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.SUBNET6; }
-#line 751 "dhcp6_parser.cc" // lalr1.cc:907
+  case 10: // $@5: %empty
+#line 273 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET6; }
+#line 774 "dhcp6_parser.cc"
     break;
 
-  case 12:
-#line 267 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.POOLS; }
-#line 757 "dhcp6_parser.cc" // lalr1.cc:907
+  case 12: // $@6: %empty
+#line 274 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 780 "dhcp6_parser.cc"
     break;
 
-  case 14:
-#line 268 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.PD_POOLS; }
-#line 763 "dhcp6_parser.cc" // lalr1.cc:907
+  case 14: // $@7: %empty
+#line 275 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.PD_POOLS; }
+#line 786 "dhcp6_parser.cc"
     break;
 
-  case 16:
-#line 269 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 769 "dhcp6_parser.cc" // lalr1.cc:907
+  case 16: // $@8: %empty
+#line 276 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 792 "dhcp6_parser.cc"
     break;
 
-  case 18:
-#line 270 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 775 "dhcp6_parser.cc" // lalr1.cc:907
+  case 18: // $@9: %empty
+#line 277 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.DHCP6; }
+#line 798 "dhcp6_parser.cc"
     break;
 
-  case 20:
-#line 271 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 781 "dhcp6_parser.cc" // lalr1.cc:907
+  case 20: // $@10: %empty
+#line 278 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 804 "dhcp6_parser.cc"
     break;
 
-  case 22:
-#line 272 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 787 "dhcp6_parser.cc" // lalr1.cc:907
+  case 22: // $@11: %empty
+#line 279 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 810 "dhcp6_parser.cc"
     break;
 
-  case 24:
-#line 273 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 793 "dhcp6_parser.cc" // lalr1.cc:907
+  case 24: // $@12: %empty
+#line 280 "dhcp6_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 816 "dhcp6_parser.cc"
     break;
 
-  case 26:
-#line 274 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 799 "dhcp6_parser.cc" // lalr1.cc:907
+  case 26: // $@13: %empty
+#line 281 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 822 "dhcp6_parser.cc"
     break;
 
-  case 28:
-#line 275 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.LOGGING; }
-#line 805 "dhcp6_parser.cc" // lalr1.cc:907
+  case 28: // $@14: %empty
+#line 282 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.LOGGING; }
+#line 828 "dhcp6_parser.cc"
     break;
 
-  case 30:
-#line 276 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG_CONTROL; }
-#line 811 "dhcp6_parser.cc" // lalr1.cc:907
+  case 30: // $@15: %empty
+#line 283 "dhcp6_parser.yy"
+                          { ctx.ctx_ = ctx.CONFIG_CONTROL; }
+#line 834 "dhcp6_parser.cc"
     break;
 
-  case 32:
-#line 284 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 817 "dhcp6_parser.cc" // lalr1.cc:907
+  case 32: // value: "integer"
+#line 291 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 840 "dhcp6_parser.cc"
     break;
 
-  case 33:
-#line 285 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 823 "dhcp6_parser.cc" // lalr1.cc:907
+  case 33: // value: "floating point"
+#line 292 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 846 "dhcp6_parser.cc"
     break;
 
-  case 34:
-#line 286 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 829 "dhcp6_parser.cc" // lalr1.cc:907
+  case 34: // value: "boolean"
+#line 293 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 852 "dhcp6_parser.cc"
     break;
 
-  case 35:
-#line 287 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 835 "dhcp6_parser.cc" // lalr1.cc:907
+  case 35: // value: "constant string"
+#line 294 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 858 "dhcp6_parser.cc"
     break;
 
-  case 36:
-#line 288 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 841 "dhcp6_parser.cc" // lalr1.cc:907
+  case 36: // value: "null"
+#line 295 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 864 "dhcp6_parser.cc"
     break;
 
-  case 37:
-#line 289 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 847 "dhcp6_parser.cc" // lalr1.cc:907
+  case 37: // value: map2
+#line 296 "dhcp6_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 870 "dhcp6_parser.cc"
     break;
 
-  case 38:
-#line 290 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 853 "dhcp6_parser.cc" // lalr1.cc:907
+  case 38: // value: list_generic
+#line 297 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 876 "dhcp6_parser.cc"
     break;
 
-  case 39:
-#line 293 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 39: // sub_json: value
+#line 300 "dhcp6_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 862 "dhcp6_parser.cc" // lalr1.cc:907
+#line 885 "dhcp6_parser.cc"
     break;
 
-  case 40:
-#line 298 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 40: // $@16: %empty
+#line 305 "dhcp6_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 873 "dhcp6_parser.cc" // lalr1.cc:907
+#line 896 "dhcp6_parser.cc"
     break;
 
-  case 41:
-#line 303 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 41: // map2: "{" $@16 map_content "}"
+#line 310 "dhcp6_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 883 "dhcp6_parser.cc" // lalr1.cc:907
+#line 906 "dhcp6_parser.cc"
     break;
 
-  case 42:
-#line 309 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 889 "dhcp6_parser.cc" // lalr1.cc:907
+  case 42: // map_value: map2
+#line 316 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 912 "dhcp6_parser.cc"
     break;
 
-  case 45:
-#line 316 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 45: // not_empty_map: "constant string" ":" value
+#line 323 "dhcp6_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 898 "dhcp6_parser.cc" // lalr1.cc:907
+#line 921 "dhcp6_parser.cc"
     break;
 
-  case 46:
-#line 320 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 46: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 327 "dhcp6_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 908 "dhcp6_parser.cc" // lalr1.cc:907
+#line 931 "dhcp6_parser.cc"
     break;
 
-  case 47:
-#line 327 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 47: // $@17: %empty
+#line 334 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 917 "dhcp6_parser.cc" // lalr1.cc:907
+#line 940 "dhcp6_parser.cc"
     break;
 
-  case 48:
-#line 330 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 48: // list_generic: "[" $@17 list_content "]"
+#line 337 "dhcp6_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 925 "dhcp6_parser.cc" // lalr1.cc:907
+#line 948 "dhcp6_parser.cc"
     break;
 
-  case 51:
-#line 338 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 51: // not_empty_list: value
+#line 345 "dhcp6_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 934 "dhcp6_parser.cc" // lalr1.cc:907
+#line 957 "dhcp6_parser.cc"
     break;
 
-  case 52:
-#line 342 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 52: // not_empty_list: not_empty_list "," value
+#line 349 "dhcp6_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 943 "dhcp6_parser.cc" // lalr1.cc:907
+#line 966 "dhcp6_parser.cc"
     break;
 
-  case 53:
-#line 349 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 53: // $@18: %empty
+#line 356 "dhcp6_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 951 "dhcp6_parser.cc" // lalr1.cc:907
+#line 974 "dhcp6_parser.cc"
     break;
 
-  case 54:
-#line 351 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 54: // list_strings: "[" $@18 list_strings_content "]"
+#line 358 "dhcp6_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 960 "dhcp6_parser.cc" // lalr1.cc:907
+#line 983 "dhcp6_parser.cc"
     break;
 
-  case 57:
-#line 360 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 57: // not_empty_list_strings: "constant string"
+#line 367 "dhcp6_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 969 "dhcp6_parser.cc" // lalr1.cc:907
+#line 992 "dhcp6_parser.cc"
     break;
 
-  case 58:
-#line 364 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 58: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 371 "dhcp6_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 978 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1001 "dhcp6_parser.cc"
     break;
 
-  case 59:
-#line 375 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 59: // unknown_map_entry: "constant string" ":"
+#line 382 "dhcp6_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 989 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1012 "dhcp6_parser.cc"
     break;
 
-  case 60:
-#line 385 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 60: // $@19: %empty
+#line 392 "dhcp6_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1000 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1023 "dhcp6_parser.cc"
     break;
 
-  case 61:
-#line 390 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 61: // syntax_map: "{" $@19 global_objects "}"
+#line 397 "dhcp6_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
@@ -1009,12 +1032,12 @@ namespace isc { namespace dhcp {
     // Dhcp6 is required
     ctx.require("Dhcp6", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 1013 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1036 "dhcp6_parser.cc"
     break;
 
-  case 70:
-#line 413 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 70: // $@20: %empty
+#line 420 "dhcp6_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1022,894 +1045,903 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP6);
 }
-#line 1026 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1049 "dhcp6_parser.cc"
     break;
 
-  case 71:
-#line 420 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 71: // dhcp6_object: "Dhcp6" $@20 ":" "{" global_params "}"
+#line 427 "dhcp6_parser.yy"
+                                                    {
     // No global parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1036 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1059 "dhcp6_parser.cc"
     break;
 
-  case 72:
-#line 428 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 72: // $@21: %empty
+#line 435 "dhcp6_parser.yy"
+                          {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1046 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1069 "dhcp6_parser.cc"
     break;
 
-  case 73:
-#line 432 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 73: // sub_dhcp6: "{" $@21 global_params "}"
+#line 439 "dhcp6_parser.yy"
+                               {
     // No global parameter is required
     // parsing completed
 }
-#line 1055 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1078 "dhcp6_parser.cc"
     break;
 
-  case 109:
-#line 478 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 109: // $@22: %empty
+#line 485 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1063 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1086 "dhcp6_parser.cc"
     break;
 
-  case 110:
-#line 480 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr datadir(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 110: // data_directory: "data-directory" $@22 ":" "constant string"
+#line 487 "dhcp6_parser.yy"
+               {
+    ElementPtr datadir(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data-directory", datadir);
     ctx.leave();
 }
-#line 1073 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1096 "dhcp6_parser.cc"
     break;
 
-  case 111:
-#line 486 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 111: // preferred_lifetime: "preferred-lifetime" ":" "integer"
+#line 493 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
 }
-#line 1082 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1105 "dhcp6_parser.cc"
     break;
 
-  case 112:
-#line 491 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 112: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 498 "dhcp6_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 1091 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1114 "dhcp6_parser.cc"
     break;
 
-  case 113:
-#line 496 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 113: // renew_timer: "renew-timer" ":" "integer"
+#line 503 "dhcp6_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1100 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1123 "dhcp6_parser.cc"
     break;
 
-  case 114:
-#line 501 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 114: // rebind_timer: "rebind-timer" ":" "integer"
+#line 508 "dhcp6_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1109 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1132 "dhcp6_parser.cc"
     break;
 
-  case 115:
-#line 506 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 115: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 513 "dhcp6_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1118 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1141 "dhcp6_parser.cc"
     break;
 
-  case 116:
-#line 511 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 116: // $@23: %empty
+#line 518 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1126 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1149 "dhcp6_parser.cc"
     break;
 
-  case 117:
-#line 513 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stag(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 117: // server_tag: "server-tag" $@23 ":" "constant string"
+#line 520 "dhcp6_parser.yy"
+               {
+    ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1136 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1159 "dhcp6_parser.cc"
     break;
 
-  case 118:
-#line 519 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 118: // $@24: %empty
+#line 526 "dhcp6_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1147 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1170 "dhcp6_parser.cc"
     break;
 
-  case 119:
-#line 524 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 119: // interfaces_config: "interfaces-config" $@24 ":" "{" interfaces_config_params "}"
+#line 531 "dhcp6_parser.yy"
+                                                               {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1157 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1180 "dhcp6_parser.cc"
     break;
 
-  case 120:
-#line 530 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 120: // $@25: %empty
+#line 537 "dhcp6_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1167 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1190 "dhcp6_parser.cc"
     break;
 
-  case 121:
-#line 534 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 121: // sub_interfaces6: "{" $@25 interfaces_config_params "}"
+#line 541 "dhcp6_parser.yy"
+                                          {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1176 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1199 "dhcp6_parser.cc"
     break;
 
-  case 129:
-#line 550 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 129: // $@26: %empty
+#line 557 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1187 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1210 "dhcp6_parser.cc"
     break;
 
-  case 130:
-#line 555 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 130: // interfaces_list: "interfaces" $@26 ":" list_strings
+#line 562 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1196 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1219 "dhcp6_parser.cc"
     break;
 
-  case 131:
-#line 560 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 131: // re_detect: "re-detect" ":" "boolean"
+#line 567 "dhcp6_parser.yy"
+                                   {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1205 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1228 "dhcp6_parser.cc"
     break;
 
-  case 132:
-#line 566 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 132: // $@27: %empty
+#line 573 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1216 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1239 "dhcp6_parser.cc"
     break;
 
-  case 133:
-#line 571 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 133: // lease_database: "lease-database" $@27 ":" "{" database_map_params "}"
+#line 578 "dhcp6_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1227 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1250 "dhcp6_parser.cc"
     break;
 
-  case 134:
-#line 578 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 134: // $@28: %empty
+#line 585 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1238 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1261 "dhcp6_parser.cc"
     break;
 
-  case 135:
-#line 583 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 135: // hosts_database: "hosts-database" $@28 ":" "{" database_map_params "}"
+#line 590 "dhcp6_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1249 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1272 "dhcp6_parser.cc"
     break;
 
-  case 136:
-#line 590 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 136: // $@29: %empty
+#line 597 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1260 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1283 "dhcp6_parser.cc"
     break;
 
-  case 137:
-#line 595 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 137: // hosts_databases: "hosts-databases" $@29 ":" "[" database_list "]"
+#line 602 "dhcp6_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1269 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1292 "dhcp6_parser.cc"
     break;
 
-  case 142:
-#line 608 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 142: // $@30: %empty
+#line 615 "dhcp6_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1279 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1302 "dhcp6_parser.cc"
     break;
 
-  case 143:
-#line 612 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 143: // database: "{" $@30 database_map_params "}"
+#line 619 "dhcp6_parser.yy"
+                                     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1289 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1312 "dhcp6_parser.cc"
     break;
 
-  case 166:
-#line 644 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 167: // $@31: %empty
+#line 652 "dhcp6_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1297 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1320 "dhcp6_parser.cc"
     break;
 
-  case 167:
-#line 646 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 168: // database_type: "type" $@31 ":" db_type
+#line 654 "dhcp6_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1306 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1329 "dhcp6_parser.cc"
     break;
 
-  case 168:
-#line 651 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1312 "dhcp6_parser.cc" // lalr1.cc:907
+  case 169: // db_type: "memfile"
+#line 659 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1335 "dhcp6_parser.cc"
     break;
 
-  case 169:
-#line 652 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1318 "dhcp6_parser.cc" // lalr1.cc:907
+  case 170: // db_type: "mysql"
+#line 660 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1341 "dhcp6_parser.cc"
     break;
 
-  case 170:
-#line 653 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1324 "dhcp6_parser.cc" // lalr1.cc:907
+  case 171: // db_type: "postgresql"
+#line 661 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1347 "dhcp6_parser.cc"
     break;
 
-  case 171:
-#line 654 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1330 "dhcp6_parser.cc" // lalr1.cc:907
+  case 172: // db_type: "cql"
+#line 662 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1353 "dhcp6_parser.cc"
     break;
 
-  case 172:
-#line 657 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 173: // $@32: %empty
+#line 665 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1338 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1361 "dhcp6_parser.cc"
     break;
 
-  case 173:
-#line 659 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 174: // user: "user" $@32 ":" "constant string"
+#line 667 "dhcp6_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1348 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1371 "dhcp6_parser.cc"
     break;
 
-  case 174:
-#line 665 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 175: // $@33: %empty
+#line 673 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1356 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1379 "dhcp6_parser.cc"
     break;
 
-  case 175:
-#line 667 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 176: // password: "password" $@33 ":" "constant string"
+#line 675 "dhcp6_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1366 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1389 "dhcp6_parser.cc"
     break;
 
-  case 176:
-#line 673 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 177: // $@34: %empty
+#line 681 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1374 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1397 "dhcp6_parser.cc"
     break;
 
-  case 177:
-#line 675 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 178: // host: "host" $@34 ":" "constant string"
+#line 683 "dhcp6_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1384 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1407 "dhcp6_parser.cc"
     break;
 
-  case 178:
-#line 681 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 179: // port: "port" ":" "integer"
+#line 689 "dhcp6_parser.yy"
+                         {
+    ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1393 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1416 "dhcp6_parser.cc"
     break;
 
-  case 179:
-#line 686 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 180: // $@35: %empty
+#line 694 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1401 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1424 "dhcp6_parser.cc"
     break;
 
-  case 180:
-#line 688 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 181: // name: "name" $@35 ":" "constant string"
+#line 696 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1411 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1434 "dhcp6_parser.cc"
     break;
 
-  case 181:
-#line 694 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 182: // persist: "persist" ":" "boolean"
+#line 702 "dhcp6_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1420 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1443 "dhcp6_parser.cc"
     break;
 
-  case 182:
-#line 699 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 183: // lfc_interval: "lfc-interval" ":" "integer"
+#line 707 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1429 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1452 "dhcp6_parser.cc"
     break;
 
-  case 183:
-#line 704 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 184: // lfc_in_process: "lfc-in-process" ":" "boolean"
+#line 712 "dhcp6_parser.yy"
+                                             {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-in-process", n);
+}
+#line 1461 "dhcp6_parser.cc"
+    break;
+
+  case 185: // readonly: "readonly" ":" "boolean"
+#line 717 "dhcp6_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1438 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1470 "dhcp6_parser.cc"
     break;
 
-  case 184:
-#line 709 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 186: // connect_timeout: "connect-timeout" ":" "integer"
+#line 722 "dhcp6_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1447 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1479 "dhcp6_parser.cc"
     break;
 
-  case 185:
-#line 714 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 187: // reconnect_wait_time: "reconnect-wait-time" ":" "integer"
+#line 727 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1456 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1488 "dhcp6_parser.cc"
     break;
 
-  case 186:
-#line 719 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 188: // request_timeout: "request-timeout" ":" "integer"
+#line 732 "dhcp6_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1465 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1497 "dhcp6_parser.cc"
     break;
 
-  case 187:
-#line 724 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 189: // tcp_keepalive: "tcp-keepalive" ":" "integer"
+#line 737 "dhcp6_parser.yy"
+                                           {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1474 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1506 "dhcp6_parser.cc"
     break;
 
-  case 188:
-#line 729 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 190: // tcp_nodelay: "tcp-nodelay" ":" "boolean"
+#line 742 "dhcp6_parser.yy"
+                                       {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1483 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1515 "dhcp6_parser.cc"
     break;
 
-  case 189:
-#line 734 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 191: // $@36: %empty
+#line 747 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1491 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1523 "dhcp6_parser.cc"
     break;
 
-  case 190:
-#line 736 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 192: // contact_points: "contact-points" $@36 ":" "constant string"
+#line 749 "dhcp6_parser.yy"
+               {
+    ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1501 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1533 "dhcp6_parser.cc"
     break;
 
-  case 191:
-#line 742 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 193: // max_reconnect_tries: "max-reconnect-tries" ":" "integer"
+#line 755 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1510 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1542 "dhcp6_parser.cc"
     break;
 
-  case 192:
-#line 747 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 194: // $@37: %empty
+#line 760 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1518 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1550 "dhcp6_parser.cc"
     break;
 
-  case 193:
-#line 749 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 195: // keyspace: "keyspace" $@37 ":" "constant string"
+#line 762 "dhcp6_parser.yy"
+               {
+    ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1528 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1560 "dhcp6_parser.cc"
     break;
 
-  case 194:
-#line 755 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 196: // $@38: %empty
+#line 768 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1536 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1568 "dhcp6_parser.cc"
     break;
 
-  case 195:
-#line 757 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr c(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 197: // consistency: "consistency" $@38 ":" "constant string"
+#line 770 "dhcp6_parser.yy"
+               {
+    ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1546 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1578 "dhcp6_parser.cc"
     break;
 
-  case 196:
-#line 763 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 198: // $@39: %empty
+#line 776 "dhcp6_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1554 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1586 "dhcp6_parser.cc"
     break;
 
-  case 197:
-#line 765 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr c(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 199: // serial_consistency: "serial-consistency" $@39 ":" "constant string"
+#line 778 "dhcp6_parser.yy"
+               {
+    ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1564 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1596 "dhcp6_parser.cc"
     break;
 
-  case 198:
-#line 771 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 200: // $@40: %empty
+#line 784 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1575 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1607 "dhcp6_parser.cc"
     break;
 
-  case 199:
-#line 776 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 201: // sanity_checks: "sanity-checks" $@40 ":" "{" sanity_checks_params "}"
+#line 789 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1584 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1616 "dhcp6_parser.cc"
     break;
 
-  case 203:
-#line 786 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 205: // $@41: %empty
+#line 799 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1592 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1624 "dhcp6_parser.cc"
     break;
 
-  case 204:
-#line 788 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 206: // lease_checks: "lease-checks" $@41 ":" "constant string"
+#line 801 "dhcp6_parser.yy"
+               {
 
-    if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
-         (string(yystack_[0].value.as< std::string > ()) == "warn") ||
-         (string(yystack_[0].value.as< std::string > ()) == "fix") ||
-         (string(yystack_[0].value.as< std::string > ()) == "fix-del") ||
-         (string(yystack_[0].value.as< std::string > ()) == "del")) {
-        ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
+         (string(yystack_[0].value.as < std::string > ()) == "warn") ||
+         (string(yystack_[0].value.as < std::string > ()) == "fix") ||
+         (string(yystack_[0].value.as < std::string > ()) == "fix-del") ||
+         (string(yystack_[0].value.as < std::string > ()) == "del")) {
+        ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("lease-checks", user);
         ctx.leave();
     } else {
-        error(yystack_[0].location, "Unsupported 'lease-checks value: " + string(yystack_[0].value.as< std::string > ()) +
+        error(yystack_[0].location, "Unsupported 'lease-checks value: " + string(yystack_[0].value.as < std::string > ()) +
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1612 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1644 "dhcp6_parser.cc"
     break;
 
-  case 205:
-#line 804 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 207: // $@42: %empty
+#line 817 "dhcp6_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1623 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1655 "dhcp6_parser.cc"
     break;
 
-  case 206:
-#line 809 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 208: // mac_sources: "mac-sources" $@42 ":" "[" mac_sources_list "]"
+#line 822 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1632 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1664 "dhcp6_parser.cc"
     break;
 
-  case 211:
-#line 822 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 213: // duid_id: "duid"
+#line 835 "dhcp6_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1641 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1673 "dhcp6_parser.cc"
     break;
 
-  case 212:
-#line 827 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 214: // string_id: "constant string"
+#line 840 "dhcp6_parser.yy"
+                   {
+    ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1650 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1682 "dhcp6_parser.cc"
     break;
 
-  case 213:
-#line 832 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 215: // $@43: %empty
+#line 845 "dhcp6_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1661 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1693 "dhcp6_parser.cc"
     break;
 
-  case 214:
-#line 837 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 216: // host_reservation_identifiers: "host-reservation-identifiers" $@43 ":" "[" host_reservation_identifiers_list "]"
+#line 850 "dhcp6_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1670 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1702 "dhcp6_parser.cc"
     break;
 
-  case 220:
-#line 851 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 222: // hw_address_id: "hw-address"
+#line 864 "dhcp6_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1679 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1711 "dhcp6_parser.cc"
     break;
 
-  case 221:
-#line 856 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 223: // flex_id: "flex-id"
+#line 869 "dhcp6_parser.yy"
+                  {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1688 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1720 "dhcp6_parser.cc"
     break;
 
-  case 222:
-#line 863 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 224: // $@44: %empty
+#line 876 "dhcp6_parser.yy"
+                                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1699 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1731 "dhcp6_parser.cc"
     break;
 
-  case 223:
-#line 868 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 225: // relay_supplied_options: "relay-supplied-options" $@44 ":" "[" list_content "]"
+#line 881 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1708 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1740 "dhcp6_parser.cc"
     break;
 
-  case 224:
-#line 873 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 226: // $@45: %empty
+#line 886 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1719 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1751 "dhcp6_parser.cc"
     break;
 
-  case 225:
-#line 878 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 227: // hooks_libraries: "hooks-libraries" $@45 ":" "[" hooks_libraries_list "]"
+#line 891 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1728 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1760 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 891 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 232: // $@46: %empty
+#line 904 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1738 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1770 "dhcp6_parser.cc"
     break;
 
-  case 231:
-#line 895 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 233: // hooks_library: "{" $@46 hooks_params "}"
+#line 908 "dhcp6_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1748 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1780 "dhcp6_parser.cc"
     break;
 
-  case 232:
-#line 901 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 234: // $@47: %empty
+#line 914 "dhcp6_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1758 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1790 "dhcp6_parser.cc"
     break;
 
-  case 233:
-#line 905 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 235: // sub_hooks_library: "{" $@47 hooks_params "}"
+#line 918 "dhcp6_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1768 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1800 "dhcp6_parser.cc"
     break;
 
-  case 239:
-#line 920 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 241: // $@48: %empty
+#line 933 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1776 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1808 "dhcp6_parser.cc"
     break;
 
-  case 240:
-#line 922 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 242: // library: "library" $@48 ":" "constant string"
+#line 935 "dhcp6_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1786 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1818 "dhcp6_parser.cc"
     break;
 
-  case 241:
-#line 928 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 243: // $@49: %empty
+#line 941 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1794 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1826 "dhcp6_parser.cc"
     break;
 
-  case 242:
-#line 930 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 244: // parameters: "parameters" $@49 ":" value
+#line 943 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1803 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1835 "dhcp6_parser.cc"
     break;
 
-  case 243:
-#line 936 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 245: // $@50: %empty
+#line 949 "dhcp6_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1814 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1846 "dhcp6_parser.cc"
     break;
 
-  case 244:
-#line 941 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 246: // expired_leases_processing: "expired-leases-processing" $@50 ":" "{" expired_leases_params "}"
+#line 954 "dhcp6_parser.yy"
+                                                            {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1824 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1856 "dhcp6_parser.cc"
     break;
 
-  case 253:
-#line 959 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 255: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 972 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1833 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1865 "dhcp6_parser.cc"
     break;
 
-  case 254:
-#line 964 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 256: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 977 "dhcp6_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1842 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1874 "dhcp6_parser.cc"
     break;
 
-  case 255:
-#line 969 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 257: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 982 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1851 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1883 "dhcp6_parser.cc"
     break;
 
-  case 256:
-#line 974 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 258: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 987 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1860 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1892 "dhcp6_parser.cc"
     break;
 
-  case 257:
-#line 979 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 259: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 992 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1869 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1901 "dhcp6_parser.cc"
     break;
 
-  case 258:
-#line 984 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 260: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 997 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1878 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1910 "dhcp6_parser.cc"
     break;
 
-  case 259:
-#line 992 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 261: // $@51: %empty
+#line 1005 "dhcp6_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1889 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1921 "dhcp6_parser.cc"
     break;
 
-  case 260:
-#line 997 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 262: // subnet6_list: "subnet6" $@51 ":" "[" subnet6_list_content "]"
+#line 1010 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1898 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1930 "dhcp6_parser.cc"
     break;
 
-  case 265:
-#line 1017 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 267: // $@52: %empty
+#line 1030 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1908 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1940 "dhcp6_parser.cc"
     break;
 
-  case 266:
-#line 1021 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 268: // subnet6: "{" $@52 subnet6_params "}"
+#line 1034 "dhcp6_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1930,573 +1962,573 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1934 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1966 "dhcp6_parser.cc"
     break;
 
-  case 267:
-#line 1043 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 269: // $@53: %empty
+#line 1056 "dhcp6_parser.yy"
+                            {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1944 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1976 "dhcp6_parser.cc"
     break;
 
-  case 268:
-#line 1047 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 270: // sub_subnet6: "{" $@53 subnet6_params "}"
+#line 1060 "dhcp6_parser.yy"
+                                {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1954 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1986 "dhcp6_parser.cc"
     break;
 
-  case 291:
-#line 1081 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 293: // $@54: %empty
+#line 1094 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1962 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1994 "dhcp6_parser.cc"
     break;
 
-  case 292:
-#line 1083 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 294: // subnet: "subnet" $@54 ":" "constant string"
+#line 1096 "dhcp6_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1972 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2004 "dhcp6_parser.cc"
     break;
 
-  case 293:
-#line 1089 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 295: // $@55: %empty
+#line 1102 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1980 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2012 "dhcp6_parser.cc"
     break;
 
-  case 294:
-#line 1091 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 296: // interface: "interface" $@55 ":" "constant string"
+#line 1104 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1990 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2022 "dhcp6_parser.cc"
     break;
 
-  case 295:
-#line 1097 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 297: // $@56: %empty
+#line 1110 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1998 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2030 "dhcp6_parser.cc"
     break;
 
-  case 296:
-#line 1099 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 298: // interface_id: "interface-id" $@56 ":" "constant string"
+#line 1112 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 2008 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2040 "dhcp6_parser.cc"
     break;
 
-  case 297:
-#line 1105 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 299: // $@57: %empty
+#line 1118 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2016 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2048 "dhcp6_parser.cc"
     break;
 
-  case 298:
-#line 1107 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 300: // client_class: "client-class" $@57 ":" "constant string"
+#line 1120 "dhcp6_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2026 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2058 "dhcp6_parser.cc"
     break;
 
-  case 299:
-#line 1113 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 301: // $@58: %empty
+#line 1126 "dhcp6_parser.yy"
+                                               {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2037 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2069 "dhcp6_parser.cc"
     break;
 
-  case 300:
-#line 1118 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 302: // require_client_classes: "require-client-classes" $@58 ":" list_strings
+#line 1131 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2046 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2078 "dhcp6_parser.cc"
     break;
 
-  case 301:
-#line 1123 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 303: // $@59: %empty
+#line 1136 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2054 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2086 "dhcp6_parser.cc"
     break;
 
-  case 302:
-#line 1125 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
+  case 304: // reservation_mode: "reservation-mode" $@59 ":" hr_mode
+#line 1138 "dhcp6_parser.yy"
+                {
+    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2063 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2095 "dhcp6_parser.cc"
     break;
 
-  case 303:
-#line 1130 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2069 "dhcp6_parser.cc" // lalr1.cc:907
+  case 305: // hr_mode: "disabled"
+#line 1143 "dhcp6_parser.yy"
+                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
+#line 2101 "dhcp6_parser.cc"
     break;
 
-  case 304:
-#line 1131 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2075 "dhcp6_parser.cc" // lalr1.cc:907
+  case 306: // hr_mode: "out-of-pool"
+#line 1144 "dhcp6_parser.yy"
+                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
+#line 2107 "dhcp6_parser.cc"
     break;
 
-  case 305:
-#line 1132 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2081 "dhcp6_parser.cc" // lalr1.cc:907
+  case 307: // hr_mode: "global"
+#line 1145 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
+#line 2113 "dhcp6_parser.cc"
     break;
 
-  case 306:
-#line 1133 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2087 "dhcp6_parser.cc" // lalr1.cc:907
+  case 308: // hr_mode: "all"
+#line 1146 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
+#line 2119 "dhcp6_parser.cc"
     break;
 
-  case 307:
-#line 1136 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 309: // id: "id" ":" "integer"
+#line 1149 "dhcp6_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2096 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2128 "dhcp6_parser.cc"
     break;
 
-  case 308:
-#line 1141 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 310: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 1154 "dhcp6_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2105 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2137 "dhcp6_parser.cc"
     break;
 
-  case 309:
-#line 1149 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 311: // $@60: %empty
+#line 1162 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2116 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2148 "dhcp6_parser.cc"
     break;
 
-  case 310:
-#line 1154 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 312: // shared_networks: "shared-networks" $@60 ":" "[" shared_networks_content "]"
+#line 1167 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2125 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2157 "dhcp6_parser.cc"
     break;
 
-  case 315:
-#line 1169 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 317: // $@61: %empty
+#line 1182 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2135 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2167 "dhcp6_parser.cc"
     break;
 
-  case 316:
-#line 1173 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 318: // shared_network: "{" $@61 shared_network_params "}"
+#line 1186 "dhcp6_parser.yy"
+                                       {
     ctx.stack_.pop_back();
 }
-#line 2143 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2175 "dhcp6_parser.cc"
     break;
 
-  case 336:
-#line 1204 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 338: // $@62: %empty
+#line 1217 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2154 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2186 "dhcp6_parser.cc"
     break;
 
-  case 337:
-#line 1209 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 339: // option_def_list: "option-def" $@62 ":" "[" option_def_list_content "]"
+#line 1222 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2163 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2195 "dhcp6_parser.cc"
     break;
 
-  case 338:
-#line 1217 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 340: // $@63: %empty
+#line 1230 "dhcp6_parser.yy"
+                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2172 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2204 "dhcp6_parser.cc"
     break;
 
-  case 339:
-#line 1220 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 341: // sub_option_def_list: "{" $@63 option_def_list "}"
+#line 1233 "dhcp6_parser.yy"
+                                 {
     // parsing completed
 }
-#line 2180 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2212 "dhcp6_parser.cc"
     break;
 
-  case 344:
-#line 1236 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 346: // $@64: %empty
+#line 1249 "dhcp6_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2190 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2222 "dhcp6_parser.cc"
     break;
 
-  case 345:
-#line 1240 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 347: // option_def_entry: "{" $@64 option_def_params "}"
+#line 1253 "dhcp6_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2202 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2234 "dhcp6_parser.cc"
     break;
 
-  case 346:
-#line 1251 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 348: // $@65: %empty
+#line 1264 "dhcp6_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2212 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2244 "dhcp6_parser.cc"
     break;
 
-  case 347:
-#line 1255 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 349: // sub_option_def: "{" $@65 option_def_params "}"
+#line 1268 "dhcp6_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2224 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2256 "dhcp6_parser.cc"
     break;
 
-  case 363:
-#line 1287 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 365: // code: "code" ":" "integer"
+#line 1300 "dhcp6_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2233 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2265 "dhcp6_parser.cc"
     break;
 
-  case 365:
-#line 1294 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 367: // $@66: %empty
+#line 1307 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2241 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2273 "dhcp6_parser.cc"
     break;
 
-  case 366:
-#line 1296 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 368: // option_def_type: "type" $@66 ":" "constant string"
+#line 1309 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2251 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2283 "dhcp6_parser.cc"
     break;
 
-  case 367:
-#line 1302 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 369: // $@67: %empty
+#line 1315 "dhcp6_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2259 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2291 "dhcp6_parser.cc"
     break;
 
-  case 368:
-#line 1304 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 370: // option_def_record_types: "record-types" $@67 ":" "constant string"
+#line 1317 "dhcp6_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2269 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2301 "dhcp6_parser.cc"
     break;
 
-  case 369:
-#line 1310 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 371: // $@68: %empty
+#line 1323 "dhcp6_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2277 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2309 "dhcp6_parser.cc"
     break;
 
-  case 370:
-#line 1312 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 372: // space: "space" $@68 ":" "constant string"
+#line 1325 "dhcp6_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2287 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2319 "dhcp6_parser.cc"
     break;
 
-  case 372:
-#line 1320 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 374: // $@69: %empty
+#line 1333 "dhcp6_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2295 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2327 "dhcp6_parser.cc"
     break;
 
-  case 373:
-#line 1322 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 375: // option_def_encapsulate: "encapsulate" $@69 ":" "constant string"
+#line 1335 "dhcp6_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2305 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2337 "dhcp6_parser.cc"
     break;
 
-  case 374:
-#line 1328 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 376: // option_def_array: "array" ":" "boolean"
+#line 1341 "dhcp6_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2314 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2346 "dhcp6_parser.cc"
     break;
 
-  case 375:
-#line 1337 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 377: // $@70: %empty
+#line 1350 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2325 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2357 "dhcp6_parser.cc"
     break;
 
-  case 376:
-#line 1342 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 378: // option_data_list: "option-data" $@70 ":" "[" option_data_list_content "]"
+#line 1355 "dhcp6_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2334 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2366 "dhcp6_parser.cc"
     break;
 
-  case 381:
-#line 1361 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 383: // $@71: %empty
+#line 1374 "dhcp6_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2344 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2376 "dhcp6_parser.cc"
     break;
 
-  case 382:
-#line 1365 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 384: // option_data_entry: "{" $@71 option_data_params "}"
+#line 1378 "dhcp6_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2353 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2385 "dhcp6_parser.cc"
     break;
 
-  case 383:
-#line 1373 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 385: // $@72: %empty
+#line 1386 "dhcp6_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2363 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2395 "dhcp6_parser.cc"
     break;
 
-  case 384:
-#line 1377 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 386: // sub_option_data: "{" $@72 option_data_params "}"
+#line 1390 "dhcp6_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2372 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2404 "dhcp6_parser.cc"
     break;
 
-  case 399:
-#line 1410 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 401: // $@73: %empty
+#line 1423 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2380 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2412 "dhcp6_parser.cc"
     break;
 
-  case 400:
-#line 1412 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 402: // option_data_data: "data" $@73 ":" "constant string"
+#line 1425 "dhcp6_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2390 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2422 "dhcp6_parser.cc"
     break;
 
-  case 403:
-#line 1422 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 405: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1435 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2399 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2431 "dhcp6_parser.cc"
     break;
 
-  case 404:
-#line 1427 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 406: // option_data_always_send: "always-send" ":" "boolean"
+#line 1440 "dhcp6_parser.yy"
+                                                   {
+    ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2408 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2440 "dhcp6_parser.cc"
     break;
 
-  case 405:
-#line 1435 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 407: // $@74: %empty
+#line 1448 "dhcp6_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2419 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2451 "dhcp6_parser.cc"
     break;
 
-  case 406:
-#line 1440 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 408: // pools_list: "pools" $@74 ":" "[" pools_list_content "]"
+#line 1453 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2428 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2460 "dhcp6_parser.cc"
     break;
 
-  case 411:
-#line 1455 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 413: // $@75: %empty
+#line 1468 "dhcp6_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2438 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2470 "dhcp6_parser.cc"
     break;
 
-  case 412:
-#line 1459 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 414: // pool_list_entry: "{" $@75 pool_params "}"
+#line 1472 "dhcp6_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2448 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2480 "dhcp6_parser.cc"
     break;
 
-  case 413:
-#line 1465 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 415: // $@76: %empty
+#line 1478 "dhcp6_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2458 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2490 "dhcp6_parser.cc"
     break;
 
-  case 414:
-#line 1469 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 416: // sub_pool6: "{" $@76 pool_params "}"
+#line 1482 "dhcp6_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 2467 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2499 "dhcp6_parser.cc"
     break;
 
-  case 424:
-#line 1487 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 426: // $@77: %empty
+#line 1500 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2475 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2507 "dhcp6_parser.cc"
     break;
 
-  case 425:
-#line 1489 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 427: // pool_entry: "pool" $@77 ":" "constant string"
+#line 1502 "dhcp6_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2485 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2517 "dhcp6_parser.cc"
     break;
 
-  case 426:
-#line 1495 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 428: // $@78: %empty
+#line 1508 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2493 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2525 "dhcp6_parser.cc"
     break;
 
-  case 427:
-#line 1497 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 429: // user_context: "user-context" $@78 ":" map_value
+#line 1510 "dhcp6_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
-    ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
+    ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
 
     // Handle already existing user context
@@ -2516,23 +2548,23 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2520 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2552 "dhcp6_parser.cc"
     break;
 
-  case 428:
-#line 1520 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 430: // $@79: %empty
+#line 1533 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2528 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2560 "dhcp6_parser.cc"
     break;
 
-  case 429:
-#line 1522 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 431: // comment: "comment" $@79 ":" "constant string"
+#line 1535 "dhcp6_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
-    ElementPtr comment(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     user_context->set("comment", comment);
 
     // Handle already existing user context
@@ -2553,610 +2585,619 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2557 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2589 "dhcp6_parser.cc"
     break;
 
-  case 430:
-#line 1550 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 432: // $@80: %empty
+#line 1563 "dhcp6_parser.yy"
+                        {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2568 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2600 "dhcp6_parser.cc"
     break;
 
-  case 431:
-#line 1555 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 433: // pd_pools_list: "pd-pools" $@80 ":" "[" pd_pools_list_content "]"
+#line 1568 "dhcp6_parser.yy"
+                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2577 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2609 "dhcp6_parser.cc"
     break;
 
-  case 436:
-#line 1570 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 438: // $@81: %empty
+#line 1583 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2587 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2619 "dhcp6_parser.cc"
     break;
 
-  case 437:
-#line 1574 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 439: // pd_pool_entry: "{" $@81 pd_pool_params "}"
+#line 1587 "dhcp6_parser.yy"
+                                {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("prefix-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2599 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2631 "dhcp6_parser.cc"
     break;
 
-  case 438:
-#line 1582 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 440: // $@82: %empty
+#line 1595 "dhcp6_parser.yy"
+                            {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2609 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2641 "dhcp6_parser.cc"
     break;
 
-  case 439:
-#line 1586 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 441: // sub_pd_pool: "{" $@82 pd_pool_params "}"
+#line 1599 "dhcp6_parser.yy"
+                                {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("prefix-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2621 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2653 "dhcp6_parser.cc"
     break;
 
-  case 453:
-#line 1611 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 455: // $@83: %empty
+#line 1624 "dhcp6_parser.yy"
+                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2629 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2661 "dhcp6_parser.cc"
     break;
 
-  case 454:
-#line 1613 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 456: // pd_prefix: "prefix" $@83 ":" "constant string"
+#line 1626 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2639 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2671 "dhcp6_parser.cc"
     break;
 
-  case 455:
-#line 1619 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 457: // pd_prefix_len: "prefix-len" ":" "integer"
+#line 1632 "dhcp6_parser.yy"
+                                        {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2648 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2680 "dhcp6_parser.cc"
     break;
 
-  case 456:
-#line 1624 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 458: // $@84: %empty
+#line 1637 "dhcp6_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2656 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2688 "dhcp6_parser.cc"
     break;
 
-  case 457:
-#line 1626 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 459: // excluded_prefix: "excluded-prefix" $@84 ":" "constant string"
+#line 1639 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2666 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2698 "dhcp6_parser.cc"
     break;
 
-  case 458:
-#line 1632 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 460: // excluded_prefix_len: "excluded-prefix-len" ":" "integer"
+#line 1645 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2675 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2707 "dhcp6_parser.cc"
     break;
 
-  case 459:
-#line 1637 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 461: // pd_delegated_len: "delegated-len" ":" "integer"
+#line 1650 "dhcp6_parser.yy"
+                                              {
+    ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2684 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2716 "dhcp6_parser.cc"
     break;
 
-  case 460:
-#line 1645 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 462: // $@85: %empty
+#line 1658 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2695 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2727 "dhcp6_parser.cc"
     break;
 
-  case 461:
-#line 1650 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 463: // reservations: "reservations" $@85 ":" "[" reservations_list "]"
+#line 1663 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2704 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2736 "dhcp6_parser.cc"
     break;
 
-  case 466:
-#line 1663 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 468: // $@86: %empty
+#line 1676 "dhcp6_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2714 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2746 "dhcp6_parser.cc"
     break;
 
-  case 467:
-#line 1667 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 469: // reservation: "{" $@86 reservation_params "}"
+#line 1680 "dhcp6_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2723 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2755 "dhcp6_parser.cc"
     break;
 
-  case 468:
-#line 1672 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 470: // $@87: %empty
+#line 1685 "dhcp6_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2733 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2765 "dhcp6_parser.cc"
     break;
 
-  case 469:
-#line 1676 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 471: // sub_reservation: "{" $@87 reservation_params "}"
+#line 1689 "dhcp6_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2742 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2774 "dhcp6_parser.cc"
     break;
 
-  case 485:
-#line 1703 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 487: // $@88: %empty
+#line 1716 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2753 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2785 "dhcp6_parser.cc"
     break;
 
-  case 486:
-#line 1708 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 488: // ip_addresses: "ip-addresses" $@88 ":" list_strings
+#line 1721 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2762 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2794 "dhcp6_parser.cc"
     break;
 
-  case 487:
-#line 1713 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 489: // $@89: %empty
+#line 1726 "dhcp6_parser.yy"
+                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2773 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2805 "dhcp6_parser.cc"
     break;
 
-  case 488:
-#line 1718 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 490: // prefixes: "prefixes" $@89 ":" list_strings
+#line 1731 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2782 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2814 "dhcp6_parser.cc"
     break;
 
-  case 489:
-#line 1723 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 491: // $@90: %empty
+#line 1736 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2790 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2822 "dhcp6_parser.cc"
     break;
 
-  case 490:
-#line 1725 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 492: // duid: "duid" $@90 ":" "constant string"
+#line 1738 "dhcp6_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2800 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2832 "dhcp6_parser.cc"
     break;
 
-  case 491:
-#line 1731 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 493: // $@91: %empty
+#line 1744 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2808 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2840 "dhcp6_parser.cc"
     break;
 
-  case 492:
-#line 1733 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 494: // hw_address: "hw-address" $@91 ":" "constant string"
+#line 1746 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2818 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2850 "dhcp6_parser.cc"
     break;
 
-  case 493:
-#line 1739 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 495: // $@92: %empty
+#line 1752 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2826 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2858 "dhcp6_parser.cc"
     break;
 
-  case 494:
-#line 1741 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 496: // hostname: "hostname" $@92 ":" "constant string"
+#line 1754 "dhcp6_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2836 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2868 "dhcp6_parser.cc"
     break;
 
-  case 495:
-#line 1747 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 497: // $@93: %empty
+#line 1760 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2844 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2876 "dhcp6_parser.cc"
     break;
 
-  case 496:
-#line 1749 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 498: // flex_id_value: "flex-id" $@93 ":" "constant string"
+#line 1762 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2854 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2886 "dhcp6_parser.cc"
     break;
 
-  case 497:
-#line 1755 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 499: // $@94: %empty
+#line 1768 "dhcp6_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2865 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2897 "dhcp6_parser.cc"
     break;
 
-  case 498:
-#line 1760 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 500: // reservation_client_classes: "client-classes" $@94 ":" list_strings
+#line 1773 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2874 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2906 "dhcp6_parser.cc"
     break;
 
-  case 499:
-#line 1768 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 501: // $@95: %empty
+#line 1781 "dhcp6_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2885 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2917 "dhcp6_parser.cc"
     break;
 
-  case 500:
-#line 1773 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 502: // relay: "relay" $@95 ":" "{" relay_map "}"
+#line 1786 "dhcp6_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2894 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2926 "dhcp6_parser.cc"
     break;
 
-  case 503:
-#line 1782 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 505: // $@96: %empty
+#line 1795 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2902 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2934 "dhcp6_parser.cc"
     break;
 
-  case 504:
-#line 1784 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 506: // ip_address: "ip-address" $@96 ":" "constant string"
+#line 1797 "dhcp6_parser.yy"
+               {
+    ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2912 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2944 "dhcp6_parser.cc"
     break;
 
-  case 505:
-#line 1793 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 507: // $@97: %empty
+#line 1806 "dhcp6_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2923 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2955 "dhcp6_parser.cc"
     break;
 
-  case 506:
-#line 1798 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 508: // client_classes: "client-classes" $@97 ":" "[" client_classes_list "]"
+#line 1811 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2932 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2964 "dhcp6_parser.cc"
     break;
 
-  case 509:
-#line 1807 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 511: // $@98: %empty
+#line 1820 "dhcp6_parser.yy"
+                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2942 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2974 "dhcp6_parser.cc"
     break;
 
-  case 510:
-#line 1811 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 512: // client_class_entry: "{" $@98 client_class_params "}"
+#line 1824 "dhcp6_parser.yy"
+                                     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2952 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2984 "dhcp6_parser.cc"
     break;
 
-  case 523:
-#line 1836 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 525: // $@99: %empty
+#line 1849 "dhcp6_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2960 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2992 "dhcp6_parser.cc"
     break;
 
-  case 524:
-#line 1838 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 526: // client_class_test: "test" $@99 ":" "constant string"
+#line 1851 "dhcp6_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2970 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3002 "dhcp6_parser.cc"
     break;
 
-  case 525:
-#line 1844 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 527: // only_if_required: "only-if-required" ":" "boolean"
+#line 1857 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 2979 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3011 "dhcp6_parser.cc"
     break;
 
-  case 526:
-#line 1852 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 528: // $@100: %empty
+#line 1865 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 2990 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3022 "dhcp6_parser.cc"
     break;
 
-  case 527:
-#line 1857 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 529: // server_id: "server-id" $@100 ":" "{" server_id_params "}"
+#line 1870 "dhcp6_parser.yy"
+                                                       {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3001 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3033 "dhcp6_parser.cc"
     break;
 
-  case 539:
-#line 1879 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 541: // $@101: %empty
+#line 1892 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 3009 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3041 "dhcp6_parser.cc"
     break;
 
-  case 540:
-#line 1881 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 542: // server_id_type: "type" $@101 ":" duid_type
+#line 1894 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3018 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3050 "dhcp6_parser.cc"
     break;
 
-  case 541:
-#line 1886 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 3024 "dhcp6_parser.cc" // lalr1.cc:907
+  case 543: // duid_type: "LLT"
+#line 1899 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
+#line 3056 "dhcp6_parser.cc"
     break;
 
-  case 542:
-#line 1887 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 3030 "dhcp6_parser.cc" // lalr1.cc:907
+  case 544: // duid_type: "EN"
+#line 1900 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
+#line 3062 "dhcp6_parser.cc"
     break;
 
-  case 543:
-#line 1888 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 3036 "dhcp6_parser.cc" // lalr1.cc:907
+  case 545: // duid_type: "LL"
+#line 1901 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
+#line 3068 "dhcp6_parser.cc"
     break;
 
-  case 544:
-#line 1891 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 546: // htype: "htype" ":" "integer"
+#line 1904 "dhcp6_parser.yy"
+                           {
+    ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 3045 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3077 "dhcp6_parser.cc"
     break;
 
-  case 545:
-#line 1896 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 547: // $@102: %empty
+#line 1909 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3053 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3085 "dhcp6_parser.cc"
     break;
 
-  case 546:
-#line 1898 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 548: // identifier: "identifier" $@102 ":" "constant string"
+#line 1911 "dhcp6_parser.yy"
+               {
+    ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 3063 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3095 "dhcp6_parser.cc"
     break;
 
-  case 547:
-#line 1904 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 549: // time: "time" ":" "integer"
+#line 1917 "dhcp6_parser.yy"
+                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 3072 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3104 "dhcp6_parser.cc"
     break;
 
-  case 548:
-#line 1909 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 550: // enterprise_id: "enterprise-id" ":" "integer"
+#line 1922 "dhcp6_parser.yy"
+                                           {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 3081 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3113 "dhcp6_parser.cc"
     break;
 
-  case 549:
-#line 1916 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 551: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1929 "dhcp6_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3090 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3122 "dhcp6_parser.cc"
     break;
 
-  case 550:
-#line 1923 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 552: // $@103: %empty
+#line 1936 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3101 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3133 "dhcp6_parser.cc"
     break;
 
-  case 551:
-#line 1928 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 553: // control_socket: "control-socket" $@103 ":" "{" control_socket_params "}"
+#line 1941 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3110 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3142 "dhcp6_parser.cc"
     break;
 
-  case 559:
-#line 1944 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 562: // $@104: %empty
+#line 1958 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3118 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3150 "dhcp6_parser.cc"
     break;
 
-  case 560:
-#line 1946 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 563: // socket_type: "socket-type" $@104 ":" "constant string"
+#line 1960 "dhcp6_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3128 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3160 "dhcp6_parser.cc"
     break;
 
-  case 561:
-#line 1952 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 564: // $@105: %empty
+#line 1966 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3136 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3168 "dhcp6_parser.cc"
     break;
 
-  case 562:
-#line 1954 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 565: // socket_name: "socket-name" $@105 ":" "constant string"
+#line 1968 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3146 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3178 "dhcp6_parser.cc"
     break;
 
-  case 563:
-#line 1962 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 566: // config_output_threads: "config-output-threads" ":" "integer"
+#line 1974 "dhcp6_parser.yy"
+                                                           {
+    ElementPtr threads(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("config-output-threads", threads);
+}
+#line 3187 "dhcp6_parser.cc"
+    break;
+
+  case 567: // $@106: %empty
+#line 1981 "dhcp6_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3154 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3195 "dhcp6_parser.cc"
     break;
 
-  case 564:
-#line 1964 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr qc = yystack_[0].value.as< ElementPtr > ();
+  case 568: // dhcp_queue_control: "dhcp-queue-control" $@106 ":" map_value
+#line 1983 "dhcp6_parser.yy"
+                  {
+    ElementPtr qc = yystack_[0].value.as < ElementPtr > ();
     ctx.stack_.back()->set("dhcp-queue-control", qc);
 
     // Doing this manually, because dhcp-queue-control
@@ -3190,626 +3231,674 @@ namespace isc { namespace dhcp {
 
     ctx.leave();
 }
-#line 3194 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3235 "dhcp6_parser.cc"
     break;
 
-  case 565:
-#line 2002 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 569: // $@107: %empty
+#line 2021 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3205 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3246 "dhcp6_parser.cc"
     break;
 
-  case 566:
-#line 2007 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 570: // dhcp_ddns: "dhcp-ddns" $@107 ":" "{" dhcp_ddns_params "}"
+#line 2026 "dhcp6_parser.yy"
+                                                       {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3216 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3257 "dhcp6_parser.cc"
     break;
 
-  case 567:
-#line 2014 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 571: // $@108: %empty
+#line 2033 "dhcp6_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3226 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3267 "dhcp6_parser.cc"
     break;
 
-  case 568:
-#line 2018 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 572: // sub_dhcp_ddns: "{" $@108 dhcp_ddns_params "}"
+#line 2037 "dhcp6_parser.yy"
+                                  {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3236 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3277 "dhcp6_parser.cc"
     break;
 
-  case 589:
-#line 2048 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 593: // enable_updates: "enable-updates" ":" "boolean"
+#line 2067 "dhcp6_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3245 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3286 "dhcp6_parser.cc"
     break;
 
-  case 590:
-#line 2053 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 594: // $@109: %empty
+#line 2072 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3253 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3294 "dhcp6_parser.cc"
     break;
 
-  case 591:
-#line 2055 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 595: // qualifying_suffix: "qualifying-suffix" $@109 ":" "constant string"
+#line 2074 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3263 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3304 "dhcp6_parser.cc"
     break;
 
-  case 592:
-#line 2061 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 596: // $@110: %empty
+#line 2080 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3271 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3312 "dhcp6_parser.cc"
     break;
 
-  case 593:
-#line 2063 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 597: // server_ip: "server-ip" $@110 ":" "constant string"
+#line 2082 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3281 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3322 "dhcp6_parser.cc"
     break;
 
-  case 594:
-#line 2069 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 598: // server_port: "server-port" ":" "integer"
+#line 2088 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3290 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3331 "dhcp6_parser.cc"
     break;
 
-  case 595:
-#line 2074 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 599: // $@111: %empty
+#line 2093 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3298 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3339 "dhcp6_parser.cc"
     break;
 
-  case 596:
-#line 2076 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 600: // sender_ip: "sender-ip" $@111 ":" "constant string"
+#line 2095 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3308 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3349 "dhcp6_parser.cc"
     break;
 
-  case 597:
-#line 2082 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 601: // sender_port: "sender-port" ":" "integer"
+#line 2101 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3317 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3358 "dhcp6_parser.cc"
     break;
 
-  case 598:
-#line 2087 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 602: // max_queue_size: "max-queue-size" ":" "integer"
+#line 2106 "dhcp6_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3326 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3367 "dhcp6_parser.cc"
     break;
 
-  case 599:
-#line 2092 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 603: // $@112: %empty
+#line 2111 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3334 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3375 "dhcp6_parser.cc"
     break;
 
-  case 600:
-#line 2094 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 604: // ncr_protocol: "ncr-protocol" $@112 ":" ncr_protocol_value
+#line 2113 "dhcp6_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3343 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3384 "dhcp6_parser.cc"
     break;
 
-  case 601:
-#line 2100 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3349 "dhcp6_parser.cc" // lalr1.cc:907
+  case 605: // ncr_protocol_value: "UDP"
+#line 2119 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 3390 "dhcp6_parser.cc"
     break;
 
-  case 602:
-#line 2101 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3355 "dhcp6_parser.cc" // lalr1.cc:907
+  case 606: // ncr_protocol_value: "TCP"
+#line 2120 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 3396 "dhcp6_parser.cc"
     break;
 
-  case 603:
-#line 2104 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 607: // $@113: %empty
+#line 2123 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3363 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3404 "dhcp6_parser.cc"
     break;
 
-  case 604:
-#line 2106 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 608: // ncr_format: "ncr-format" $@113 ":" ncr_format_value
+#line 2125 "dhcp6_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3373 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3413 "dhcp6_parser.cc"
     break;
 
-  case 605:
-#line 2112 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 609: // ncr_format_value: "JSON"
+#line 2131 "dhcp6_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 3419 "dhcp6_parser.cc"
+    break;
+
+  case 610: // ncr_format_value: "BINARY"
+#line 2132 "dhcp6_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 3425 "dhcp6_parser.cc"
+    break;
+
+  case 611: // override_no_update: "override-no-update" ":" "boolean"
+#line 2135 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3382 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3434 "dhcp6_parser.cc"
     break;
 
-  case 606:
-#line 2117 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 612: // override_client_update: "override-client-update" ":" "boolean"
+#line 2140 "dhcp6_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3391 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3443 "dhcp6_parser.cc"
     break;
 
-  case 607:
-#line 2122 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 613: // $@114: %empty
+#line 2145 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3399 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3451 "dhcp6_parser.cc"
     break;
 
-  case 608:
-#line 2124 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 614: // replace_client_name: "replace-client-name" $@114 ":" replace_client_name_value
+#line 2147 "dhcp6_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3408 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3460 "dhcp6_parser.cc"
     break;
 
-  case 609:
-#line 2130 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
+  case 615: // replace_client_name_value: "when-present"
+#line 2153 "dhcp6_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3416 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3468 "dhcp6_parser.cc"
     break;
 
-  case 610:
-#line 2133 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 616: // replace_client_name_value: "never"
+#line 2156 "dhcp6_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3424 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3476 "dhcp6_parser.cc"
     break;
 
-  case 611:
-#line 2136 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 617: // replace_client_name_value: "always"
+#line 2159 "dhcp6_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3432 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3484 "dhcp6_parser.cc"
     break;
 
-  case 612:
-#line 2139 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 618: // replace_client_name_value: "when-not-present"
+#line 2162 "dhcp6_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3440 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3492 "dhcp6_parser.cc"
     break;
 
-  case 613:
-#line 2142 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 619: // replace_client_name_value: "boolean"
+#line 2165 "dhcp6_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3449 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3501 "dhcp6_parser.cc"
     break;
 
-  case 614:
-#line 2148 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 620: // $@115: %empty
+#line 2171 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3457 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3509 "dhcp6_parser.cc"
     break;
 
-  case 615:
-#line 2150 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 621: // generated_prefix: "generated-prefix" $@115 ":" "constant string"
+#line 2173 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3467 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3519 "dhcp6_parser.cc"
     break;
 
-  case 616:
-#line 2156 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 622: // $@116: %empty
+#line 2179 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3475 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3527 "dhcp6_parser.cc"
     break;
 
-  case 617:
-#line 2158 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 623: // hostname_char_set: "hostname-char-set" $@116 ":" "constant string"
+#line 2181 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3485 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3537 "dhcp6_parser.cc"
     break;
 
-  case 618:
-#line 2164 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 624: // $@117: %empty
+#line 2187 "dhcp6_parser.yy"
+                                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3493 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3545 "dhcp6_parser.cc"
     break;
 
-  case 619:
-#line 2166 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 625: // hostname_char_replacement: "hostname-char-replacement" $@117 ":" "constant string"
+#line 2189 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3503 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3555 "dhcp6_parser.cc"
     break;
 
-  case 620:
-#line 2174 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 626: // $@118: %empty
+#line 2197 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3511 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3563 "dhcp6_parser.cc"
     break;
 
-  case 621:
-#line 2176 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 627: // dhcp4_json_object: "Dhcp4" $@118 ":" value
+#line 2199 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3520 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3572 "dhcp6_parser.cc"
     break;
 
-  case 622:
-#line 2181 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 628: // $@119: %empty
+#line 2204 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3528 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3580 "dhcp6_parser.cc"
     break;
 
-  case 623:
-#line 2183 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 629: // dhcpddns_json_object: "DhcpDdns" $@119 ":" value
+#line 2206 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3537 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3589 "dhcp6_parser.cc"
     break;
 
-  case 624:
-#line 2188 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 630: // $@120: %empty
+#line 2211 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3545 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3597 "dhcp6_parser.cc"
     break;
 
-  case 625:
-#line 2190 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
+  case 631: // control_agent_json_object: "Control-agent" $@120 ":" value
+#line 2213 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3554 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3606 "dhcp6_parser.cc"
     break;
 
-  case 626:
-#line 2197 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 632: // $@121: %empty
+#line 2220 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3565 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3617 "dhcp6_parser.cc"
     break;
 
-  case 627:
-#line 2202 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 633: // config_control: "config-control" $@121 ":" "{" config_control_params "}"
+#line 2225 "dhcp6_parser.yy"
+                                                            {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3575 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3627 "dhcp6_parser.cc"
     break;
 
-  case 628:
-#line 2208 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 634: // $@122: %empty
+#line 2231 "dhcp6_parser.yy"
+                                   {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3585 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3637 "dhcp6_parser.cc"
     break;
 
-  case 629:
-#line 2212 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 635: // sub_config_control: "{" $@122 config_control_params "}"
+#line 2235 "dhcp6_parser.yy"
+                                       {
     // No config_control params are required
     // parsing completed
 }
-#line 3594 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3646 "dhcp6_parser.cc"
     break;
 
-  case 634:
-#line 2227 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 640: // $@123: %empty
+#line 2250 "dhcp6_parser.yy"
+                                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3605 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3657 "dhcp6_parser.cc"
     break;
 
-  case 635:
-#line 2232 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 641: // config_databases: "config-databases" $@123 ":" "[" database_list "]"
+#line 2255 "dhcp6_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3614 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3666 "dhcp6_parser.cc"
     break;
 
-  case 636:
-#line 2237 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 642: // config_fetch_wait_time: "config-fetch-wait-time" ":" "integer"
+#line 2260 "dhcp6_parser.yy"
+                                                             {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3623 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3675 "dhcp6_parser.cc"
     break;
 
-  case 637:
-#line 2247 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 643: // $@124: %empty
+#line 2270 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3634 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3686 "dhcp6_parser.cc"
     break;
 
-  case 638:
-#line 2252 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 644: // logging_object: "Logging" $@124 ":" "{" logging_params "}"
+#line 2275 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3643 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3695 "dhcp6_parser.cc"
     break;
 
-  case 639:
-#line 2257 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 645: // $@125: %empty
+#line 2280 "dhcp6_parser.yy"
+                            {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3653 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3705 "dhcp6_parser.cc"
     break;
 
-  case 640:
-#line 2261 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 646: // sub_logging: "{" $@125 logging_params "}"
+#line 2284 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 3661 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3713 "dhcp6_parser.cc"
     break;
 
-  case 644:
-#line 2277 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 650: // $@126: %empty
+#line 2300 "dhcp6_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3672 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3724 "dhcp6_parser.cc"
     break;
 
-  case 645:
-#line 2282 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 651: // loggers: "loggers" $@126 ":" "[" loggers_entries "]"
+#line 2305 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3681 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3733 "dhcp6_parser.cc"
     break;
 
-  case 648:
-#line 2294 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 654: // $@127: %empty
+#line 2317 "dhcp6_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3691 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3743 "dhcp6_parser.cc"
     break;
 
-  case 649:
-#line 2298 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 655: // logger_entry: "{" $@127 logger_params "}"
+#line 2321 "dhcp6_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3699 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3751 "dhcp6_parser.cc"
     break;
 
-  case 659:
-#line 2315 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 665: // debuglevel: "debuglevel" ":" "integer"
+#line 2338 "dhcp6_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3708 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3760 "dhcp6_parser.cc"
     break;
 
-  case 660:
-#line 2320 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 666: // $@128: %empty
+#line 2343 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3716 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3768 "dhcp6_parser.cc"
     break;
 
-  case 661:
-#line 2322 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 667: // severity: "severity" $@128 ":" "constant string"
+#line 2345 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3726 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3778 "dhcp6_parser.cc"
     break;
 
-  case 662:
-#line 2328 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 668: // $@129: %empty
+#line 2351 "dhcp6_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3737 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3789 "dhcp6_parser.cc"
     break;
 
-  case 663:
-#line 2333 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 669: // output_options_list: "output_options" $@129 ":" "[" output_options_list_content "]"
+#line 2356 "dhcp6_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3746 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3798 "dhcp6_parser.cc"
     break;
 
-  case 666:
-#line 2342 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 672: // $@130: %empty
+#line 2365 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3756 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3808 "dhcp6_parser.cc"
     break;
 
-  case 667:
-#line 2346 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 673: // output_entry: "{" $@130 output_params_list "}"
+#line 2369 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3764 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3816 "dhcp6_parser.cc"
     break;
 
-  case 674:
-#line 2360 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 683: // $@131: %empty
+#line 2386 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3772 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3824 "dhcp6_parser.cc"
     break;
 
-  case 675:
-#line 2362 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 684: // output: "output" $@131 ":" "constant string"
+#line 2388 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3782 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3834 "dhcp6_parser.cc"
     break;
 
-  case 676:
-#line 2368 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 685: // flush: "flush" ":" "boolean"
+#line 2394 "dhcp6_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3791 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3843 "dhcp6_parser.cc"
     break;
 
-  case 677:
-#line 2373 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 686: // maxsize: "maxsize" ":" "integer"
+#line 2399 "dhcp6_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3800 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3852 "dhcp6_parser.cc"
     break;
 
-  case 678:
-#line 2378 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 687: // maxver: "maxver" ":" "integer"
+#line 2404 "dhcp6_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3809 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3861 "dhcp6_parser.cc"
+    break;
+
+  case 688: // async: "async" ":" "boolean"
+#line 2409 "dhcp6_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 3870 "dhcp6_parser.cc"
+    break;
+
+  case 689: // queue_size: "queue-size" ":" "integer"
+#line 2414 "dhcp6_parser.yy"
+                                     {
+    ElementPtr queue_size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+#line 3879 "dhcp6_parser.cc"
+    break;
+
+  case 690: // $@132: %empty
+#line 2419 "dhcp6_parser.yy"
+                          {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3887 "dhcp6_parser.cc"
+    break;
+
+  case 691: // overflow: "overflow" $@132 ":" "constant string"
+#line 2421 "dhcp6_parser.yy"
+               {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+#line 3897 "dhcp6_parser.cc"
     break;
 
 
-#line 3813 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3901 "dhcp6_parser.cc"
+
             default:
               break;
             }
@@ -3817,6 +3906,7 @@ namespace isc { namespace dhcp {
 #if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
@@ -3824,13 +3914,13 @@ namespace isc { namespace dhcp {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3839,7 +3929,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3850,7 +3942,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3867,68 +3959,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3936,6 +4041,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3969,18 +4075,103 @@ namespace isc { namespace dhcp {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp6Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp6Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
 
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp6Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp6Parser::context.
+  Dhcp6Parser::context::context (const Dhcp6Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp6Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp6Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3999,41 +4190,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp6Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -4054,11 +4236,11 @@ namespace isc { namespace dhcp {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -4067,127 +4249,129 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp6Parser::yypact_ninf_ = -837;
+  const short Dhcp6Parser::yypact_ninf_ = -846;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp6Parser::yypact_[] =
   {
-     418,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,    57,    65,    64,    66,
-      68,    87,    91,   126,   133,   148,   164,   184,   195,   203,
-     229,   230,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,    65,   -95,    27,    69,    22,   234,    72,    39,
-     196,   188,    41,   262,   -53,   375,    96,   144,  -837,   242,
-     249,   269,   263,   281,  -837,  -837,  -837,  -837,  -837,   307,
-    -837,    94,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,   309,   316,   317,   323,   341,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   347,  -837,  -837,  -837,
-    -837,   123,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   353,  -837,   140,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,   357,
-     367,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,   141,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,   178,  -837,  -837,  -837,  -837,  -837,   369,  -837,   385,
-     410,  -837,  -837,  -837,  -837,  -837,  -837,   187,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,   416,   352,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,   417,  -837,  -837,   423,  -837,
-    -837,  -837,   424,  -837,  -837,   422,   390,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-     433,   435,  -837,  -837,  -837,  -837,   434,   440,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-     191,  -837,  -837,  -837,   442,  -837,  -837,   443,  -837,   444,
-     445,  -837,  -837,   446,   448,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,   260,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-     261,  -837,  -837,  -837,   449,   264,  -837,  -837,  -837,  -837,
-      65,    65,  -837,   280,   451,   452,   453,   456,   459,  -837,
-      27,  -837,   462,   463,   464,   465,   466,   467,   297,   298,
-     299,   300,   301,   474,   475,   477,   478,   479,   480,   481,
-     482,   483,   485,   486,   487,   488,   489,   490,   491,   492,
-     322,   494,   495,   509,    69,  -837,   510,   338,    22,  -837,
-     512,   513,   514,   518,   519,   349,   348,   523,   524,   525,
-     234,  -837,   526,    72,  -837,   527,   362,   531,   363,   364,
-      39,  -837,   532,   536,   537,   539,   540,   541,   542,  -837,
-     196,  -837,   543,   544,   378,   546,   551,   552,   381,  -837,
-      41,   553,   382,   383,  -837,   262,   557,   558,   -17,  -837,
-     388,   560,   562,   394,   567,   400,   419,   568,   569,   415,
-     420,   570,   589,   591,   592,   375,  -837,   594,    96,  -837,
-     595,   425,   144,  -837,  -837,  -837,   599,   598,   600,    65,
-      65,    65,  -837,   432,   601,   602,   603,   604,   608,  -837,
-    -837,  -837,  -837,  -837,   441,   609,   611,   612,   613,   447,
-     221,   614,   617,   618,   619,   620,   621,   623,   624,   625,
-     626,  -837,   627,   613,   629,  -837,   632,  -837,  -837,   633,
-     634,   457,   468,   469,  -837,  -837,   632,   470,   638,  -837,
-     472,  -837,   473,  -837,   476,  -837,  -837,  -837,   632,   632,
-     632,   484,   493,   496,   497,  -837,   498,   499,  -837,   500,
-     501,   502,  -837,  -837,   503,  -837,  -837,  -837,   504,    65,
-    -837,  -837,   505,   506,  -837,   507,  -837,  -837,   -98,   508,
-    -837,  -837,    34,   511,   515,   516,  -837,   635,  -837,   636,
-    -837,  -837,    65,    69,    96,  -837,  -837,  -837,  -837,   144,
-      22,   193,   193,   642,  -837,   644,   645,   646,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   647,   -50,    65,   315,
-     571,   648,   649,   652,   152,   138,   128,  -837,   375,  -837,
-    -837,   653,   654,  -837,  -837,  -837,  -837,  -837,   -49,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,   655,   642,  -837,   267,   278,   279,   320,
-    -837,  -837,  -837,  -837,   659,   660,   661,   662,   664,  -837,
-     665,   678,  -837,  -837,  -837,   679,   680,   682,  -837,   321,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-     332,  -837,   681,   615,  -837,  -837,   685,   622,  -837,  -837,
-     686,   690,  -837,  -837,   688,   692,  -837,  -837,   691,   693,
-    -837,  -837,  -837,   119,  -837,  -837,  -837,   694,  -837,  -837,
-    -837,   166,  -837,  -837,  -837,  -837,   333,  -837,  -837,  -837,
-     176,  -837,  -837,   695,   696,  -837,  -837,   697,   699,  -837,
-     684,   700,   701,   702,   703,   704,   334,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   705,   706,   707,  -837,
-    -837,  -837,  -837,   335,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,   336,  -837,  -837,  -837,   344,
-     538,  -837,   708,   710,  -837,  -837,   709,   713,  -837,  -837,
-    -837,   711,  -837,  -837,   197,  -837,   712,  -837,  -837,  -837,
-    -837,   716,   717,   718,   719,   455,   521,   549,   548,   554,
-     722,   555,   556,   723,   724,   728,   559,   561,   563,   193,
-    -837,  -837,   193,  -837,   642,   234,  -837,   644,    41,  -837,
-     645,   262,  -837,   646,   389,  -837,   647,   -50,  -837,  -837,
-     315,  -837,   729,   571,  -837,    77,   648,  -837,   196,  -837,
-     649,   -53,  -837,   652,   564,   566,   572,   573,   574,   575,
-     152,  -837,   731,   733,   576,   577,   578,   138,  -837,   734,
-     738,   128,  -837,  -837,  -837,   737,   714,    72,  -837,   653,
-      39,  -837,   654,   740,  -837,    13,   655,  -837,  -837,   398,
-     580,   581,   582,  -837,  -837,  -837,  -837,  -837,   583,  -837,
-    -837,   584,   585,   586,  -837,  -837,  -837,  -837,   345,  -837,
-     351,  -837,   753,  -837,   754,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,   360,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,   590,  -837,
-    -837,   741,  -837,  -837,  -837,  -837,  -837,   755,   743,  -837,
-    -837,  -837,  -837,  -837,   757,  -837,   361,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,   104,   593,  -837,  -837,  -837,
-    -837,   596,   597,  -837,  -837,   605,   380,  -837,   387,  -837,
-     606,  -837,   762,  -837,  -837,  -837,  -837,  -837,   397,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-     389,  -837,  -837,   764,   631,  -837,    77,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-     765,   607,   768,    13,  -837,  -837,   637,  -837,  -837,   769,
-    -837,   640,  -837,  -837,   766,  -837,  -837,   412,  -837,   -18,
-     766,  -837,  -837,   771,   772,   773,   399,  -837,  -837,  -837,
-    -837,  -837,  -837,   774,   639,   650,   651,   -18,  -837,   641,
-    -837,  -837,  -837,  -837,  -837
+     326,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,    62,    42,    53,    81,
+      98,   138,   147,   166,   168,   184,   238,   247,   259,   269,
+     273,   302,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,    42,   -41,    32,    64,    27,   213,    88,   367,
+     355,   120,    66,    36,   -36,   341,   156,    60,  -846,   249,
+     307,   325,   303,   332,  -846,  -846,  -846,  -846,  -846,   351,
+    -846,    69,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,   356,   363,   364,   366,   368,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   369,  -846,  -846,  -846,
+    -846,    92,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   370,  -846,    93,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,   373,
+     380,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,   125,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,   135,  -846,  -846,  -846,  -846,  -846,   382,  -846,   383,
+     384,  -846,  -846,  -846,  -846,  -846,  -846,   152,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,   335,   387,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,   389,  -846,  -846,   394,  -846,
+    -846,  -846,   396,  -846,  -846,   395,   414,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     416,   418,  -846,  -846,  -846,  -846,   415,   421,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     153,  -846,  -846,  -846,   423,  -846,  -846,   425,  -846,   427,
+     440,  -846,  -846,   441,   442,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,   160,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     164,  -846,  -846,  -846,   443,   171,  -846,  -846,  -846,  -846,
+      42,    42,  -846,   268,   451,   454,   462,   463,   483,  -846,
+      32,  -846,   484,   502,   503,   504,   505,   506,   334,   337,
+     342,   343,   344,   510,   512,   513,   516,   518,   523,   524,
+     525,   526,   527,   528,   529,   530,   532,   533,   534,   536,
+     360,   538,   539,   540,    64,  -846,   541,   365,    27,  -846,
+     542,   545,   546,   549,   552,   376,   377,   554,   555,   557,
+     213,  -846,   558,    88,  -846,   559,   385,   564,   388,   390,
+     367,  -846,   566,   568,   569,   570,   571,   572,   573,  -846,
+     355,  -846,   574,   575,   401,   580,   581,   582,   404,  -846,
+      66,   584,   406,   407,  -846,    36,   588,   589,   -23,  -846,
+     411,   591,   592,   419,   593,   420,   422,   594,   595,   424,
+     426,   598,   600,   601,   602,   341,  -846,   604,   156,  -846,
+     606,   430,    60,  -846,  -846,  -846,   608,   609,   610,    42,
+      42,    42,  -846,   433,   611,   612,   613,   614,   617,  -846,
+    -846,  -846,  -846,  -846,   435,   618,   619,   620,   621,   446,
+      51,   622,   624,   625,   626,   627,   628,   630,   631,   632,
+     633,  -846,   634,   621,   635,  -846,   638,  -846,  -846,   639,
+     640,   452,   457,   458,  -846,  -846,   638,   466,   641,  -846,
+     467,  -846,   469,  -846,   470,  -846,  -846,  -846,   638,   638,
+     638,   471,   472,   473,   474,  -846,   475,   476,  -846,   477,
+     478,   479,  -846,  -846,   480,  -846,  -846,  -846,   481,    42,
+    -846,  -846,   482,   485,  -846,   486,  -846,  -846,    24,    58,
+    -846,  -846,   170,   487,   488,   489,  -846,   658,  -846,   659,
+    -846,  -846,    42,    64,   156,  -846,  -846,  -846,  -846,    60,
+      27,   200,   200,   663,  -846,   664,   665,   666,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   667,   -38,    42,    21,
+     590,   668,   669,   671,   375,   132,   140,  -846,   341,  -846,
+    -846,   672,   673,  -846,  -846,  -846,  -846,  -846,   -42,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,   674,   663,  -846,   175,   178,
+     189,   190,  -846,  -846,  -846,  -846,   678,   679,   680,   681,
+     682,   683,  -846,   684,   685,  -846,  -846,  -846,   686,   687,
+     688,  -846,   196,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,   206,  -846,   689,   690,  -846,  -846,
+     691,   693,  -846,  -846,   692,   696,  -846,  -846,   694,   698,
+    -846,  -846,   697,   699,  -846,  -846,  -846,    96,  -846,  -846,
+    -846,   700,  -846,  -846,  -846,   264,  -846,  -846,  -846,  -846,
+     244,  -846,  -846,  -846,   339,  -846,  -846,   701,   702,  -846,
+    -846,   703,   705,  -846,   706,   707,   708,   709,   710,   711,
+     253,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     712,   713,   714,  -846,  -846,  -846,  -846,   270,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   715,  -846,  -846,  -846,
+     271,  -846,  -846,  -846,  -846,   296,   514,  -846,   716,   717,
+    -846,  -846,   718,   720,  -846,  -846,  -846,   719,  -846,  -846,
+     348,  -846,   722,  -846,  -846,  -846,  -846,   721,   725,   726,
+     727,   551,   521,   553,   543,   550,   556,   731,   560,   561,
+     732,   734,   735,   562,   563,   565,   200,  -846,  -846,   200,
+    -846,   663,   213,  -846,   664,    66,  -846,   665,    36,  -846,
+     666,   248,  -846,   667,   -38,  -846,  -846,    21,  -846,   736,
+     590,  -846,    33,   668,  -846,   355,  -846,   669,   -36,  -846,
+     671,   576,   577,   578,   579,   583,   585,   375,  -846,   741,
+     742,   586,   587,   596,   132,  -846,   743,   745,   597,   140,
+    -846,  -846,  -846,   744,   748,    88,  -846,   672,   367,  -846,
+     673,   749,  -846,   117,   674,  -846,  -846,   417,   599,   603,
+     605,  -846,  -846,  -846,  -846,  -846,  -846,   607,  -846,  -846,
+     615,   616,   623,  -846,  -846,  -846,  -846,   300,  -846,   320,
+    -846,   746,  -846,   747,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,   323,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,   629,  -846,  -846,
+     752,  -846,  -846,  -846,  -846,  -846,   753,   759,  -846,  -846,
+    -846,  -846,  -846,   755,  -846,   324,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,   104,   636,  -846,  -846,  -846,  -846,
+     645,   647,  -846,  -846,  -846,   649,   330,  -846,   333,  -846,
+     652,  -846,   761,  -846,  -846,  -846,  -846,  -846,   336,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     248,  -846,  -846,   765,   653,  -846,    33,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     766,   637,   767,   117,  -846,  -846,   695,  -846,  -846,   768,
+    -846,   704,  -846,  -846,   769,  -846,  -846,   358,  -846,   304,
+     769,  -846,  -846,   770,   771,   776,   777,   778,  -846,   349,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,   780,
+     656,   723,   724,   728,   729,   782,   304,  -846,   733,  -846,
+    -846,  -846,  -846,  -846,   737,  -846,  -846,  -846
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
@@ -4195,612 +4379,624 @@ namespace isc { namespace dhcp {
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     1,    47,    40,    36,    35,    32,    33,    34,
       39,     3,    37,    38,    60,     5,    72,     7,   120,     9,
-     267,    11,   413,    13,   438,    15,   468,    17,   338,    19,
-     346,    21,   383,    23,   232,    25,   567,    27,   639,    29,
-     628,    31,    49,    43,     0,     0,     0,     0,     0,     0,
-     470,     0,   348,   385,     0,     0,     0,     0,    51,     0,
-      50,     0,     0,    44,    70,   637,   620,   622,   624,     0,
-      69,     0,    62,    64,    66,    67,    68,    65,   109,   626,
+     269,    11,   415,    13,   440,    15,   470,    17,   340,    19,
+     348,    21,   385,    23,   234,    25,   571,    27,   645,    29,
+     634,    31,    49,    43,     0,     0,     0,     0,     0,     0,
+     472,     0,   350,   387,     0,     0,     0,     0,    51,     0,
+      50,     0,     0,    44,    70,   643,   626,   628,   630,     0,
+      69,     0,    62,    64,    66,    67,    68,    65,   109,   632,
      118,   132,   134,   136,     0,     0,     0,     0,     0,   116,
-     259,   336,   375,   426,   428,   301,   309,   205,   222,   213,
-     198,   505,   460,   224,   243,   526,     0,   550,   563,   565,
+     261,   338,   377,   428,   430,   303,   311,   207,   224,   215,
+     200,   507,   462,   226,   245,   528,     0,   552,   567,   569,
      108,     0,    74,    76,    77,    78,    79,    80,    81,   106,
       84,    85,    86,    87,   103,    88,    90,    89,    94,    95,
       82,   107,    83,    92,    93,   101,   102,   104,    91,    96,
       97,    98,    99,   100,   105,   129,     0,   128,     0,   122,
-     124,   125,   126,   127,   405,   430,   291,   293,   295,     0,
-       0,   299,   297,   499,   290,   271,   272,   273,   274,     0,
-     269,   278,   279,   280,   283,   284,   286,   281,   282,   275,
-     276,   288,   289,   277,   285,   287,   424,   423,   419,   420,
-     418,     0,   415,   417,   421,   422,   453,     0,   456,     0,
-       0,   452,   446,   447,   445,   450,   451,     0,   440,   442,
-     443,   448,   449,   444,   497,   485,   487,   489,   491,   493,
-     495,   484,   481,   482,   483,     0,   471,   472,   476,   477,
-     474,   478,   479,   480,   475,     0,   365,   179,     0,   369,
-     367,   372,     0,   361,   362,     0,   349,   350,   352,   364,
-     353,   354,   355,   371,   356,   357,   358,   359,   360,   399,
-       0,     0,   397,   398,   401,   402,     0,   386,   387,   389,
-     390,   391,   392,   393,   394,   395,   396,   239,   241,   236,
-       0,   234,   237,   238,     0,   590,   592,     0,   595,     0,
-       0,   599,   603,     0,     0,   607,   614,   616,   618,   588,
-     586,   587,     0,   569,   571,   572,   573,   574,   575,   576,
-     577,   578,   579,   580,   581,   582,   583,   584,   585,   644,
-       0,   641,   643,   634,     0,     0,   630,   632,   633,    48,
+     124,   125,   126,   127,   407,   432,   293,   295,   297,     0,
+       0,   301,   299,   501,   292,   273,   274,   275,   276,     0,
+     271,   280,   281,   282,   285,   286,   288,   283,   284,   277,
+     278,   290,   291,   279,   287,   289,   426,   425,   421,   422,
+     420,     0,   417,   419,   423,   424,   455,     0,   458,     0,
+       0,   454,   448,   449,   447,   452,   453,     0,   442,   444,
+     445,   450,   451,   446,   499,   487,   489,   491,   493,   495,
+     497,   486,   483,   484,   485,     0,   473,   474,   478,   479,
+     476,   480,   481,   482,   477,     0,   367,   180,     0,   371,
+     369,   374,     0,   363,   364,     0,   351,   352,   354,   366,
+     355,   356,   357,   373,   358,   359,   360,   361,   362,   401,
+       0,     0,   399,   400,   403,   404,     0,   388,   389,   391,
+     392,   393,   394,   395,   396,   397,   398,   241,   243,   238,
+       0,   236,   239,   240,     0,   594,   596,     0,   599,     0,
+       0,   603,   607,     0,     0,   613,   620,   622,   624,   592,
+     590,   591,     0,   573,   575,   576,   577,   578,   579,   580,
+     581,   582,   583,   584,   585,   586,   587,   588,   589,   650,
+       0,   647,   649,   640,     0,     0,   636,   638,   639,    48,
        0,     0,    41,     0,     0,     0,     0,     0,     0,    59,
        0,    61,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,    73,     0,     0,     0,   121,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   268,     0,     0,   414,     0,     0,     0,     0,     0,
-       0,   439,     0,     0,     0,     0,     0,     0,     0,   469,
-       0,   339,     0,     0,     0,     0,     0,     0,     0,   347,
-       0,     0,     0,     0,   384,     0,     0,     0,     0,   233,
+       0,   270,     0,     0,   416,     0,     0,     0,     0,     0,
+       0,   441,     0,     0,     0,     0,     0,     0,     0,   471,
+       0,   341,     0,     0,     0,     0,     0,     0,     0,   349,
+       0,     0,     0,     0,   386,     0,     0,     0,     0,   235,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   568,     0,     0,   640,
-       0,     0,     0,   629,    52,    45,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   572,     0,     0,   646,
+       0,     0,     0,   635,    52,    45,     0,     0,     0,     0,
        0,     0,    63,     0,     0,     0,     0,     0,     0,   111,
      112,   113,   114,   115,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   549,     0,     0,     0,    75,     0,   131,   123,     0,
-       0,     0,     0,     0,   307,   308,     0,     0,     0,   270,
-       0,   416,     0,   455,     0,   458,   459,   441,     0,     0,
-       0,     0,     0,     0,     0,   473,     0,     0,   363,     0,
-       0,     0,   374,   351,     0,   403,   404,   388,     0,     0,
-     235,   589,     0,     0,   594,     0,   597,   598,     0,     0,
-     605,   606,     0,     0,     0,     0,   570,     0,   642,     0,
-     636,   631,     0,     0,     0,   621,   623,   625,   110,     0,
-       0,     0,     0,   138,   117,   261,   340,   377,    42,   427,
-     429,   303,   304,   305,   306,   302,   311,     0,    49,     0,
-       0,     0,   462,   226,     0,     0,     0,   564,     0,    53,
-     130,   407,   432,   292,   294,   296,   300,   298,     0,   425,
-     454,   457,   498,   486,   488,   490,   492,   494,   496,   366,
-     180,   370,   368,   373,   400,   240,   242,   591,   593,   596,
-     601,   602,   600,   604,   609,   610,   611,   612,   613,   608,
-     615,   617,   619,     0,   138,    46,     0,     0,     0,     0,
-     166,   172,   174,   176,     0,     0,     0,     0,     0,   189,
-       0,     0,   192,   194,   196,     0,     0,     0,   165,     0,
-     144,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   158,   159,   160,   161,   156,   157,   162,   163,   164,
-       0,   142,     0,   139,   140,   265,     0,   262,   263,   344,
-       0,   341,   342,   381,     0,   378,   379,   315,     0,   312,
-     313,   211,   212,     0,   207,   209,   210,     0,   220,   221,
-     217,     0,   215,   218,   219,   203,     0,   200,   202,   509,
-       0,   507,   466,     0,   463,   464,   230,     0,   227,   228,
-       0,     0,     0,     0,     0,     0,     0,   245,   247,   248,
-     249,   250,   251,   252,   539,   545,     0,     0,     0,   538,
-     535,   536,   537,     0,   528,   530,   533,   531,   532,   534,
-     559,   561,   558,   556,   557,     0,   552,   554,   555,     0,
-      55,   411,     0,   408,   409,   436,     0,   433,   434,   503,
-     502,     0,   501,   648,     0,   646,     0,    71,   638,   627,
-     119,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   551,     0,     0,     0,    75,     0,   131,   123,     0,
+       0,     0,     0,     0,   309,   310,     0,     0,     0,   272,
+       0,   418,     0,   457,     0,   460,   461,   443,     0,     0,
+       0,     0,     0,     0,     0,   475,     0,     0,   365,     0,
+       0,     0,   376,   353,     0,   405,   406,   390,     0,     0,
+     237,   593,     0,     0,   598,     0,   601,   602,     0,     0,
+     611,   612,     0,     0,     0,     0,   574,     0,   648,     0,
+     642,   637,     0,     0,     0,   627,   629,   631,   110,     0,
+       0,     0,     0,   138,   117,   263,   342,   379,    42,   429,
+     431,   305,   306,   307,   308,   304,   313,     0,    49,     0,
+       0,     0,   464,   228,     0,     0,     0,   568,     0,    53,
+     130,   409,   434,   294,   296,   298,   302,   300,     0,   427,
+     456,   459,   500,   488,   490,   492,   494,   496,   498,   368,
+     181,   372,   370,   375,   402,   242,   244,   595,   597,   600,
+     605,   606,   604,   609,   610,   608,   615,   616,   617,   618,
+     619,   614,   621,   623,   625,     0,   138,    46,     0,     0,
+       0,     0,   167,   173,   175,   177,     0,     0,     0,     0,
+       0,     0,   191,     0,     0,   194,   196,   198,     0,     0,
+       0,   166,     0,   144,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   159,   160,   161,   162,   157,
+     158,   163,   164,   165,     0,   142,     0,   139,   140,   267,
+       0,   264,   265,   346,     0,   343,   344,   383,     0,   380,
+     381,   317,     0,   314,   315,   213,   214,     0,   209,   211,
+     212,     0,   222,   223,   219,     0,   217,   220,   221,   205,
+       0,   202,   204,   511,     0,   509,   468,     0,   465,   466,
+     232,     0,   229,   230,     0,     0,     0,     0,     0,     0,
+       0,   247,   249,   250,   251,   252,   253,   254,   541,   547,
+       0,     0,     0,   540,   537,   538,   539,     0,   530,   532,
+     535,   533,   534,   536,   562,   564,     0,   561,   559,   560,
+       0,   554,   556,   557,   558,     0,    55,   413,     0,   410,
+     411,   438,     0,   435,   436,   505,   504,     0,   503,   654,
+       0,   652,     0,    71,   644,   633,   119,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     133,   135,     0,   137,     0,     0,   260,     0,   348,   337,
-       0,   385,   376,     0,     0,   310,     0,     0,   206,   223,
-       0,   214,     0,     0,   199,   511,     0,   506,   470,   461,
-       0,     0,   225,     0,     0,     0,     0,     0,     0,     0,
-       0,   244,     0,     0,     0,     0,     0,     0,   527,     0,
-       0,     0,   551,   566,    57,     0,    56,     0,   406,     0,
-       0,   431,     0,     0,   500,     0,     0,   645,   635,     0,
-       0,     0,     0,   178,   181,   182,   183,   184,     0,   191,
-     185,     0,     0,     0,   186,   187,   188,   145,     0,   141,
-       0,   264,     0,   343,     0,   380,   335,   330,   332,   323,
-     324,   319,   320,   321,   322,   328,   329,   327,   331,     0,
-     317,   325,   333,   334,   326,   314,   208,   216,     0,   201,
-     523,     0,   521,   522,   518,   519,   520,     0,   512,   513,
-     515,   516,   517,   508,     0,   465,     0,   229,   253,   254,
-     255,   256,   257,   258,   246,     0,     0,   544,   547,   548,
-     529,     0,     0,   553,    54,     0,     0,   410,     0,   435,
-       0,   662,     0,   660,   658,   652,   656,   657,     0,   650,
-     654,   655,   653,   647,   168,   169,   170,   171,   167,   173,
-     175,   177,   190,   193,   195,   197,   143,   266,   345,   382,
-       0,   316,   204,     0,     0,   510,     0,   467,   231,   541,
-     542,   543,   540,   546,   560,   562,    58,   412,   437,   504,
-       0,     0,     0,     0,   649,   318,     0,   525,   514,     0,
-     659,     0,   651,   524,     0,   661,   666,     0,   664,     0,
-       0,   663,   674,     0,     0,     0,     0,   668,   670,   671,
-     672,   673,   665,     0,     0,     0,     0,     0,   667,     0,
-     676,   677,   678,   669,   675
+       0,     0,     0,     0,     0,     0,     0,   133,   135,     0,
+     137,     0,     0,   262,     0,   350,   339,     0,   387,   378,
+       0,     0,   312,     0,     0,   208,   225,     0,   216,     0,
+       0,   201,   513,     0,   508,   472,   463,     0,     0,   227,
+       0,     0,     0,     0,     0,     0,     0,     0,   246,     0,
+       0,     0,     0,     0,     0,   529,     0,     0,     0,     0,
+     553,   570,    57,     0,    56,     0,   408,     0,     0,   433,
+       0,     0,   502,     0,     0,   651,   641,     0,     0,     0,
+       0,   179,   182,   183,   184,   185,   186,     0,   193,   187,
+       0,     0,     0,   188,   189,   190,   145,     0,   141,     0,
+     266,     0,   345,     0,   382,   337,   332,   334,   325,   326,
+     321,   322,   323,   324,   330,   331,   329,   333,     0,   319,
+     327,   335,   336,   328,   316,   210,   218,     0,   203,   525,
+       0,   523,   524,   520,   521,   522,     0,   514,   515,   517,
+     518,   519,   510,     0,   467,     0,   231,   255,   256,   257,
+     258,   259,   260,   248,     0,     0,   546,   549,   550,   531,
+       0,     0,   566,   555,    54,     0,     0,   412,     0,   437,
+       0,   668,     0,   666,   664,   658,   662,   663,     0,   656,
+     660,   661,   659,   653,   169,   170,   171,   172,   168,   174,
+     176,   178,   192,   195,   197,   199,   143,   268,   347,   384,
+       0,   318,   206,     0,     0,   512,     0,   469,   233,   543,
+     544,   545,   542,   548,   563,   565,    58,   414,   439,   506,
+       0,     0,     0,     0,   655,   320,     0,   527,   516,     0,
+     665,     0,   657,   526,     0,   667,   672,     0,   670,     0,
+       0,   669,   683,     0,     0,     0,     0,     0,   690,     0,
+     674,   676,   677,   678,   679,   680,   681,   682,   671,     0,
+       0,     0,     0,     0,     0,     0,     0,   673,     0,   685,
+     686,   687,   688,   689,     0,   675,   684,   691
   };
 
   const short
   Dhcp6Parser::yypgoto_[] =
   {
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,    43,  -837,  -460,
-    -837,   266,  -837,  -837,  -837,  -837,   165,  -837,  -472,  -837,
-    -837,  -837,   -74,  -837,  -837,  -837,   426,  -837,  -837,  -837,
-    -837,   205,   395,  -837,  -837,   -62,   -46,   -45,   -43,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   186,   421,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,   150,  -837,   -19,
-    -837,  -576,    -7,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,   -70,  -837,  -609,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,   -35,  -837,  -837,  -837,  -837,
-    -837,   -37,  -596,  -837,  -837,  -837,  -837,   -23,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   -33,  -837,  -837,  -837,
-     -26,   401,  -837,  -837,  -837,  -837,  -837,  -837,  -837,   -44,
-    -837,  -837,  -837,  -837,  -837,  -837,  -836,  -837,  -837,  -837,
-      -9,  -837,  -837,  -837,     1,   438,  -837,  -837,  -835,  -837,
-    -834,  -837,   -36,  -837,   -32,  -837,   -42,  -837,  -837,  -837,
-    -831,  -837,  -837,  -837,  -837,    -6,  -837,  -837,  -179,   781,
-    -837,  -837,  -837,  -837,  -837,     3,  -837,  -837,  -837,     7,
-    -837,   429,  -837,   -76,  -837,  -837,  -837,  -837,  -837,   -69,
-    -837,  -837,  -837,  -837,  -837,   -11,  -837,  -837,  -837,     5,
-    -837,  -837,  -837,     8,  -837,   411,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,   -39,  -837,  -837,
-    -837,   -31,   458,  -837,  -837,   -58,  -837,   -24,  -837,  -837,
-    -837,  -837,  -837,   -40,  -837,  -837,  -837,   -30,   454,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,   -60,  -837,  -837,  -837,
-       2,  -837,  -837,  -837,     9,  -837,   450,   247,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -828,  -837,  -837,  -837,  -837,  -837,  -837,  -837,    12,
-    -837,  -837,  -837,  -157,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,    -5,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,    -8,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,   270,   427,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,  -837,   295,   413,  -837,  -837,  -837,  -837,  -837,
-    -837,  -837,   303,   428,  -837,  -837,  -837,   -16,  -837,  -837,
-    -162,  -837,  -837,  -837,  -837,  -837,  -837,  -177,  -837,  -837,
-    -193,  -837,  -837,  -837,  -837,  -837
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,    22,  -846,  -458,
+    -846,   198,  -846,  -846,  -846,  -846,   134,  -846,  -479,  -846,
+    -846,  -846,   -74,  -846,  -846,  -846,   402,  -846,  -846,  -846,
+    -846,   197,   398,  -846,  -846,   -49,   -29,   -16,   -11,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   193,   381,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,   122,  -846,   -62,
+    -846,  -577,   -56,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,   -37,  -846,  -613,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   -68,  -846,  -846,  -846,
+    -846,  -846,   -55,  -596,  -846,  -846,  -846,  -846,   -25,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,   -22,  -846,  -846,
+    -846,   -21,   408,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+     -32,  -846,  -846,  -846,  -846,  -846,  -846,  -845,  -846,  -846,
+    -846,     5,  -846,  -846,  -846,     9,   456,  -846,  -846,  -844,
+    -846,  -842,  -846,   -65,  -846,   -15,  -846,     1,  -846,  -846,
+    -846,  -835,  -846,  -846,  -846,  -846,     4,  -846,  -846,  -176,
+     798,  -846,  -846,  -846,  -846,  -846,    13,  -846,  -846,  -846,
+      16,  -846,   432,  -846,   -63,  -846,  -846,  -846,  -846,  -846,
+     -53,  -846,  -846,  -846,  -846,  -846,   -24,  -846,  -846,  -846,
+      15,  -846,  -846,  -846,    19,  -846,   428,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,   -28,  -846,
+    -846,  -846,   -27,   491,  -846,  -846,   -61,  -846,   -45,  -846,
+    -846,  -846,  -846,  -846,   -30,  -846,  -846,  -846,   -26,   465,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,   -70,  -846,  -846,
+    -846,     6,  -846,  -846,  -846,    11,  -846,   459,   260,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -830,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+      14,  -846,  -846,  -846,  -155,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,    -2,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,    -3,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,   279,   434,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,  -846,   309,   436,  -846,  -846,
+    -846,  -846,  -846,  -846,  -846,   318,   437,  -846,  -846,  -846,
+      -8,  -846,  -846,  -154,  -846,  -846,  -846,  -846,  -846,  -846,
+    -170,  -846,  -846,  -195,  -846,  -846,  -846,  -846,  -846,  -846,
+    -846,  -846,  -846
   };
 
   const short
   Dhcp6Parser::yydefgoto_[] =
   {
-      -1,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+       0,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    88,    41,    42,
-      73,   609,    92,    93,    43,    72,    89,    90,   630,   810,
-     905,   906,   698,    45,    74,   101,   102,   103,   364,    47,
+      73,   609,    92,    93,    43,    72,    89,    90,   630,   816,
+     913,   914,   701,    45,    74,   101,   102,   103,   364,    47,
       75,   141,   142,   143,   372,   144,   145,   146,   147,   148,
      149,   383,   150,   374,    49,    76,   178,   179,   180,   406,
-     181,   151,   375,   152,   376,   153,   377,   722,   723,   724,
-     852,   699,   700,   701,   831,  1028,   702,   832,   703,   833,
-     704,   834,   705,   706,   443,   707,   708,   709,   710,   711,
-     712,   713,   714,   715,   840,   716,   717,   843,   718,   844,
-     719,   845,   154,   394,   756,   757,   758,   872,   155,   391,
-     743,   744,   745,   746,   156,   393,   751,   752,   753,   754,
-     157,   392,   158,   397,   767,   768,   769,   881,    65,    84,
-     310,   311,   312,   456,   313,   457,   159,   398,   776,   777,
-     778,   779,   780,   781,   782,   783,   160,   384,   726,   727,
-     728,   855,    51,    77,   199,   200,   201,   412,   202,   413,
-     203,   414,   204,   418,   205,   417,   161,   389,   615,   207,
-     208,   162,   390,   738,   739,   740,   864,   959,   960,   163,
-     385,    59,    81,   730,   731,   732,   858,    61,    82,   275,
-     276,   277,   278,   279,   280,   281,   442,   282,   446,   283,
-     445,   284,   285,   447,   286,   164,   386,   734,   735,   736,
-     861,    63,    83,   296,   297,   298,   299,   300,   451,   301,
-     302,   303,   304,   210,   410,   812,   813,   814,   907,    53,
-      78,   221,   222,   223,   422,   165,   387,   166,   388,   213,
-     411,   816,   817,   818,   910,    55,    79,   237,   238,   239,
-     425,   240,   241,   427,   242,   243,   167,   396,   763,   764,
-     765,   878,    57,    80,   255,   256,   257,   258,   433,   259,
-     434,   260,   435,   261,   436,   262,   437,   263,   438,   264,
-     432,   215,   419,   821,   822,   913,   168,   395,   760,   761,
-     875,   977,   978,   979,   980,   981,  1043,   982,   169,   399,
-     793,   794,   795,   892,  1052,   796,   797,   893,   798,   799,
-     170,   171,   401,   805,   806,   807,   899,   808,   900,   172,
-     402,   173,   403,    67,    85,   332,   333,   334,   335,   461,
-     336,   462,   337,   338,   464,   339,   340,   341,   467,   662,
-     342,   468,   343,   344,   345,   471,   669,   346,   472,   347,
-     473,   348,   474,   104,   366,   105,   367,   106,   368,   174,
-     373,    71,    87,   355,   356,   357,   480,   358,   107,   365,
-      69,    86,   350,   351,   352,   477,   824,   825,   915,  1018,
-    1019,  1020,  1021,  1062,  1022,  1060,  1077,  1078,  1079,  1086,
-    1087,  1088,  1093,  1089,  1090,  1091
+     181,   151,   375,   152,   376,   153,   377,   726,   727,   728,
+     859,   702,   703,   704,   837,  1038,   705,   838,   706,   839,
+     707,   840,   708,   709,   443,   710,   711,   712,   713,   714,
+     715,   716,   717,   718,   719,   847,   720,   721,   850,   722,
+     851,   723,   852,   154,   394,   760,   761,   762,   879,   155,
+     391,   747,   748,   749,   750,   156,   393,   755,   756,   757,
+     758,   157,   392,   158,   397,   771,   772,   773,   888,    65,
+      84,   310,   311,   312,   456,   313,   457,   159,   398,   780,
+     781,   782,   783,   784,   785,   786,   787,   160,   384,   730,
+     731,   732,   862,    51,    77,   199,   200,   201,   412,   202,
+     413,   203,   414,   204,   418,   205,   417,   161,   389,   615,
+     207,   208,   162,   390,   742,   743,   744,   871,   968,   969,
+     163,   385,    59,    81,   734,   735,   736,   865,    61,    82,
+     275,   276,   277,   278,   279,   280,   281,   442,   282,   446,
+     283,   445,   284,   285,   447,   286,   164,   386,   738,   739,
+     740,   868,    63,    83,   296,   297,   298,   299,   300,   451,
+     301,   302,   303,   304,   210,   410,   818,   819,   820,   915,
+      53,    78,   221,   222,   223,   422,   165,   387,   166,   388,
+     213,   411,   822,   823,   824,   918,    55,    79,   237,   238,
+     239,   425,   240,   241,   427,   242,   243,   167,   396,   767,
+     768,   769,   885,    57,    80,   255,   256,   257,   258,   433,
+     259,   434,   260,   435,   261,   436,   262,   437,   263,   438,
+     264,   432,   215,   419,   827,   828,   921,   168,   395,   764,
+     765,   882,   986,   987,   988,   989,   990,  1053,   991,   169,
+     399,   797,   798,   799,   899,  1062,   800,   801,   900,   802,
+     803,   170,   171,   401,   810,   811,   812,   906,   813,   907,
+     814,   172,   402,   173,   403,    67,    85,   332,   333,   334,
+     335,   461,   336,   462,   337,   338,   464,   339,   340,   341,
+     467,   662,   342,   468,   665,   343,   344,   345,   471,   671,
+     346,   472,   347,   473,   348,   474,   104,   366,   105,   367,
+     106,   368,   174,   373,    71,    87,   355,   356,   357,   480,
+     358,   107,   365,    69,    86,   350,   351,   352,   477,   830,
+     831,   923,  1028,  1029,  1030,  1031,  1072,  1032,  1070,  1087,
+    1088,  1089,  1099,  1100,  1101,  1109,  1102,  1103,  1104,  1105,
+    1106,  1107,  1115
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yytable_[] =
   {
-     100,   140,   177,   194,   217,   231,   251,   294,   273,   292,
-     309,   329,   274,   293,   295,   195,   790,   214,   182,   211,
-     224,   235,   253,   750,   287,   305,   720,   330,   952,   953,
-     954,   196,   197,   958,   198,   206,   964,    94,   175,   176,
-     660,   661,   218,   232,   245,   741,   219,   233,   608,   307,
-     308,   819,   183,   212,   225,   236,   254,    32,   288,   306,
-      40,   331,   266,   608,   636,   267,   209,   220,   234,   252,
-      33,    44,    34,    46,    35,    48,   642,   643,   644,    91,
-     108,   109,   123,   124,   110,   307,   308,   111,   112,   113,
-     122,   123,   124,   267,    50,   268,   269,   370,    52,   270,
-     271,   272,   371,   226,   227,   228,   229,   230,   123,   124,
-     123,   124,   114,   115,   116,   117,   118,   119,   120,   121,
-     122,    99,   867,   122,   742,   868,   404,   191,   122,   267,
-     192,   405,  1082,    54,   216,  1083,  1084,  1085,   123,   124,
-      56,   123,   124,   408,   420,   125,   123,   124,   409,   421,
-     126,   127,   128,   129,   130,    58,   131,   353,   354,   784,
-     191,   132,  1011,   192,  1012,  1013,   970,   971,   685,   870,
-     133,    60,   871,   134,    95,   664,   665,   666,   667,   876,
-     135,   423,   877,    96,    97,    98,   424,    99,   136,   137,
-     430,    62,   138,   139,   458,   431,    99,   123,   124,   459,
-     916,    99,    64,   917,   952,   953,   954,   123,   124,   958,
-      66,   668,   964,    99,   680,    99,  1049,  1050,  1051,   681,
-     682,   683,   684,   685,   686,   687,   688,   689,   690,   691,
-     692,   693,   694,   695,   696,   697,    68,    70,   121,    36,
-      37,    38,    39,    99,   349,   267,    99,   122,   359,   800,
-     801,    99,   360,   785,   786,   787,   788,   770,   771,   772,
-     773,   774,   775,   475,   478,   123,   124,   482,   476,   479,
-     404,   362,   483,   361,   750,   827,   938,   114,   115,   116,
-     117,   478,   482,   244,   363,   122,   828,   829,   790,   245,
-     246,   247,   248,   249,   250,   184,   100,   185,   611,   612,
-     613,   614,    99,   123,   124,   186,   187,   188,   189,   190,
-     125,   369,    99,   378,   267,   289,   268,   269,   290,   291,
-     379,   380,   191,   408,   849,   192,   132,   381,   830,   850,
-     140,   123,   124,   193,   177,   849,   873,   890,   897,   901,
-     851,   874,   891,   898,   902,   382,   194,   475,   849,   217,
-     182,   400,   903,  1036,   420,   440,   231,   407,   195,  1037,
-     214,   415,   211,  1040,   458,   224,   251,    99,  1041,  1048,
-      99,   416,   235,   426,   196,   197,   273,   198,   206,   294,
-     274,   292,   253,   423,   183,   293,   295,   218,  1057,   428,
-     430,   219,   287,   450,   232,  1058,   212,   305,   233,   225,
-    1063,   329,  1097,   484,   485,  1064,   236,  1098,    99,   209,
-     741,   748,   220,   749,   429,  1080,   254,   330,  1081,   234,
-    1024,  1025,  1026,  1027,   439,   441,   288,   444,   448,   252,
-     449,   306,   114,   115,   116,   117,    99,   452,   120,   453,
-     122,   267,   454,   455,   123,   124,   460,   463,   465,   466,
-     469,   331,   470,   481,   486,   487,   488,   489,   123,   124,
-     490,   187,   188,   491,   190,   125,   493,   494,   495,   496,
-     497,   498,   499,   500,   501,   502,   503,   191,   504,   505,
-     192,   506,   507,   508,   509,   510,   511,   512,   193,   513,
-     514,   515,   516,   517,   518,   519,   520,   521,   522,   523,
-     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
-     324,   325,   326,   524,   526,   527,   529,   530,   531,   140,
-     327,   328,   532,   533,   534,   535,   177,   536,   537,   538,
-     540,   542,   595,   596,   597,   544,   548,   543,   545,   546,
-     549,   550,   182,   551,   552,   553,   554,   556,   557,    99,
-     559,   789,   802,   558,   329,   560,   561,   564,   562,   565,
-     566,   568,   569,    99,   572,   571,   573,   791,   803,   574,
-     330,   575,   578,   579,   582,   576,   183,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,   580,   583,   577,   584,   585,   581,   587,   589,
-     590,   792,   804,   592,   331,   593,   598,   594,   599,   600,
-     601,   602,   656,   603,   605,   604,   606,   607,   854,   616,
-      34,   610,   617,   618,   619,   857,   621,   620,   622,   623,
-     923,   633,   624,   625,   626,   675,   628,   629,   631,   632,
-     673,   674,   634,   635,   637,   638,   639,   640,   663,   721,
-     641,   725,   729,   733,   737,   759,   762,   755,   645,   766,
-     811,   815,   823,   835,   836,   837,   838,   646,   839,   841,
-     647,   648,   649,   650,   651,   652,   653,   654,   655,   657,
-     658,   659,   842,   846,   847,   670,   848,   853,   884,   671,
-     672,   856,   859,   860,   862,   863,   866,   865,   924,   880,
-     869,   879,   883,   882,   885,   886,   887,   888,   889,   894,
-     895,   896,   904,   909,   908,   911,   912,  1005,   918,   914,
-     919,   920,   921,   922,   925,   926,   928,   931,   932,   927,
-     929,   930,   933,   968,   934,   995,   935,   996,  1001,   988,
-     936,   989,  1002,  1004,  1010,  1044,  1046,   990,   991,   992,
-     993,   997,   998,   999,  1029,  1030,  1031,  1032,  1033,  1034,
-    1035,  1038,  1039,  1045,  1042,  1047,  1061,  1053,  1066,  1069,
-    1054,  1055,  1071,  1076,  1074,  1094,  1095,  1096,  1099,  1056,
-    1059,   194,  1070,   747,   273,   294,   679,   292,   274,   627,
-     946,   293,   295,   195,   951,   214,   492,   211,   676,   525,
-     287,   972,   947,   305,   251,   973,   962,   309,  1067,   196,
-     197,  1073,   198,   206,  1075,  1104,  1100,   975,   948,   949,
-     253,   950,   957,   789,   826,  1101,  1102,   802,   955,   528,
-     966,   212,   956,   217,   288,   939,   231,   306,   969,   791,
-     963,  1014,   937,   803,   209,  1015,   994,   967,   941,   224,
-     987,   976,   235,   961,   254,   986,   940,  1016,   539,   570,
-     965,  1065,   265,   943,   974,   942,   567,   252,   945,   944,
-    1007,   218,  1009,   792,   232,   219,  1006,   804,   233,   563,
-    1008,   541,   985,   225,   547,   820,   236,   984,   983,  1068,
-     555,  1017,  1000,  1003,   678,   591,   220,   677,   809,   234,
-    1023,  1072,   586,  1092,  1103,     0,   588,     0,     0,     0,
+     100,   140,   177,   194,   217,   231,   251,   214,   273,   292,
+     309,   329,   794,   218,   232,   182,   211,   224,   235,   253,
+     294,   287,   305,   754,   330,   724,   961,   962,   195,   963,
+     295,   183,   212,   225,   236,   254,   967,   288,   306,    40,
+     331,   973,    94,   175,   176,   274,   293,    33,   196,    34,
+     608,    35,   245,   209,   220,   234,   252,   636,   745,   825,
+      44,   197,    32,   219,   233,   608,   198,   307,   308,   642,
+     643,   644,   370,   353,   354,   108,   109,   371,   206,   110,
+     307,   308,   111,   112,   113,   122,   267,   266,    46,   267,
+     289,   268,   269,   290,   291,   404,   408,   123,   124,   874,
+     405,   409,   875,   123,   124,    48,   123,   124,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   745,   752,   267,
+     753,   268,   269,   979,   980,   270,   271,   272,   420,   611,
+     612,   613,   614,   421,   123,   124,   123,   124,   423,    91,
+     122,   125,   746,   424,    99,    50,   126,   127,   128,   129,
+     130,   216,   131,   788,    52,   430,   458,   132,   123,   124,
+     431,   459,   687,   475,   660,   661,   133,   478,   476,   134,
+     267,   121,   479,    54,   482,    56,   135,   191,   404,   483,
+     192,   478,    95,   833,   136,   137,   834,   123,   124,   138,
+     139,    58,   482,   408,    96,    97,    98,   835,   836,   856,
+     663,   664,   123,   124,   857,   961,   962,    99,   963,   856,
+     123,   124,    99,    99,   858,   967,    99,  1059,  1060,  1061,
+     973,   682,    36,    37,    38,    39,   683,   684,   685,   686,
+     687,   688,   689,   690,   691,   692,   693,   694,   695,   696,
+     697,   698,   699,   700,    99,    60,    99,   880,   789,   790,
+     791,   792,   881,   267,    62,   359,   897,   114,   115,   116,
+     117,   898,   804,   805,   806,   122,    64,   877,    99,  1021,
+     878,  1022,  1023,   904,   909,   184,    66,   185,   905,   910,
+      68,   754,   947,   123,   124,   186,   187,   188,   189,   190,
+     125,   794,   114,   115,   116,   117,   100,    99,   120,   475,
+     122,   267,   191,   856,   911,   192,   132,   349,  1046,    70,
+     360,   362,    99,   193,   666,   667,   668,   669,   123,   124,
+      99,   187,   188,   420,   190,   125,  1050,   458,  1047,   361,
+     140,  1051,  1058,   423,   177,   363,   430,   191,  1067,  1073,
+     192,  1068,   883,   439,  1074,   884,   194,   182,   193,   217,
+     214,   924,  1116,   670,   925,   369,   231,  1117,   218,   211,
+     378,  1090,   224,   183,  1091,   232,   251,   379,   380,   235,
+     381,   195,   382,   400,   407,   212,   273,   415,   225,   253,
+      99,   292,   484,   485,   416,   236,   426,   428,   429,   287,
+     440,   196,   294,    99,   305,   254,   209,   441,   444,   220,
+     448,   329,   295,   449,   197,   288,   234,   122,   219,   198,
+     306,   123,   124,   274,   330,   233,   252,   450,   293,   122,
+     452,   206,   453,   454,   455,   123,   124,   460,    99,   463,
+     331,   465,   226,   227,   228,   229,   230,   123,   124,  1034,
+    1035,  1036,  1037,   244,   466,   469,   470,   481,   486,   245,
+     246,   247,   248,   249,   250,   487,   191,  1092,   488,   192,
+    1093,  1094,  1095,  1096,  1097,  1098,   489,   490,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   774,   775,   776,   777,   778,   779,   491,   493,   327,
+     328,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,   494,   495,   496,   497,
+     498,   595,   596,   597,   504,   499,   505,   506,   500,   140,
+     507,    99,   508,   501,   502,   503,   177,   509,   510,   511,
+     512,   513,   514,   515,   516,    99,   517,   518,   519,   182,
+     520,   521,   522,   523,   524,   526,   529,    99,   527,   530,
+     531,   793,   807,   532,   329,   183,   533,   534,   536,   537,
+     535,   538,   540,   542,   795,   808,   543,   330,   544,   545,
+     548,   546,   549,   550,   551,   552,   553,   554,   556,   557,
+     796,   809,   558,   331,   559,   560,   561,   562,   564,   565,
+     566,   656,   568,   569,   571,   572,   573,   575,   578,   579,
+     574,   576,   582,   577,   583,   584,   585,   580,   587,   581,
+     589,   590,   592,   598,   677,   604,   593,   594,   599,   600,
+     601,   602,   603,   605,   606,   607,   610,   616,    34,   617,
+     618,   619,   633,   621,   620,   622,   623,   634,   635,   624,
+     625,   626,   628,   629,   631,   632,   637,   639,   638,   640,
+     641,   645,   646,   647,   648,   649,   650,   651,   652,   653,
+     654,   655,   657,   675,   676,   658,   659,   672,   673,   674,
+     725,   729,   733,   737,   741,   763,   766,   759,   770,   817,
+     821,   829,   841,   842,   843,   844,   845,   846,   848,   849,
+     853,   854,   855,   861,   912,   860,   864,   863,   866,   867,
+     869,   870,   873,   872,   932,   887,   876,   886,   890,   889,
+     891,   892,   893,   894,   895,   896,   901,   902,   903,   908,
+     917,   627,   916,   920,   919,   927,   934,   922,   926,   928,
+     929,   930,   931,   935,   933,   937,   940,   936,   941,   942,
+     977,   938,   939,   943,   944,  1004,  1005,  1010,   945,  1011,
+    1014,  1015,   751,  1020,  1048,  1049,  1054,   997,   998,   999,
+    1000,  1055,  1056,  1057,  1001,  1071,  1002,  1006,  1007,  1076,
+    1079,  1081,   492,  1084,  1110,  1111,  1086,  1008,  1012,  1039,
+    1112,  1113,  1114,  1040,  1118,  1041,  1124,  1042,   194,   528,
+     678,   273,   214,   681,   292,  1043,  1044,   955,   832,   948,
+     946,   211,   525,  1045,   287,   294,   964,   305,   981,  1052,
+     971,   251,   978,   195,   309,   295,  1063,   212,  1080,   975,
+     288,   984,   956,   306,   253,  1064,   972,  1065,   274,  1066,
+     793,   293,  1069,   196,   960,   807,  1077,   985,   209,  1119,
+     254,   217,   957,   795,   231,   982,   197,   970,   808,  1024,
+     218,   198,   976,   232,   224,   958,   965,   235,   983,   796,
+     959,   252,  1026,   206,   809,  1003,   570,   995,   996,   950,
+     225,   949,   966,   236,  1075,  1083,   539,   974,  1027,   265,
+     952,   951,   563,   567,  1085,   954,  1025,   953,  1016,  1017,
+    1019,   220,  1018,   994,   234,   547,   993,   992,   826,   555,
+     219,  1078,  1009,   233,  1120,  1121,  1013,   815,   680,   586,
+    1123,  1122,   679,  1126,   541,   588,  1033,  1127,   591,  1082,
+    1108,  1125,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   955,     0,     0,     0,
+       0,     0,   981,     0,     0,   964,     0,     0,     0,   971,
+       0,     0,     0,     0,     0,   984,     0,     0,     0,  1024,
+       0,   956,     0,     0,     0,   972,     0,     0,     0,     0,
+       0,   985,  1026,   960,     0,     0,     0,     0,     0,   982,
+       0,   957,     0,     0,     0,     0,   970,     0,  1027,     0,
+       0,     0,   983,     0,   958,   965,  1025,     0,     0,   959,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   946,     0,     0,     0,
-     951,     0,   972,     0,     0,     0,   973,     0,   947,     0,
-       0,     0,   962,     0,     0,     0,     0,     0,   975,  1014,
-       0,     0,     0,  1015,   948,   949,     0,   950,   957,     0,
-       0,     0,     0,     0,   955,  1016,     0,     0,   956,     0,
-       0,     0,     0,     0,     0,     0,   963,     0,     0,     0,
-       0,     0,   976,     0,     0,     0,     0,     0,     0,   961,
-       0,     0,     0,     0,     0,   974,     0,     0,     0,  1017
+       0,   966
   };
 
   const short
   Dhcp6Parser::yycheck_[] =
   {
-      74,    75,    76,    77,    78,    79,    80,    83,    82,    83,
-      84,    85,    82,    83,    83,    77,   625,    77,    76,    77,
-      78,    79,    80,   619,    82,    83,   602,    85,   864,   864,
-     864,    77,    77,   864,    77,    77,   864,    10,    16,    17,
-     138,   139,    78,    79,    93,    95,    78,    79,   508,   102,
-     103,   100,    76,    77,    78,    79,    80,     0,    82,    83,
-      17,    85,    21,   523,   536,    52,    77,    78,    79,    80,
-       5,     7,     7,     7,     9,     7,   548,   549,   550,   174,
-      11,    12,    69,    70,    15,   102,   103,    18,    19,    20,
-      51,    69,    70,    52,     7,    54,    55,     3,     7,    58,
-      59,    60,     8,    64,    65,    66,    67,    68,    69,    70,
-      69,    70,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,   174,     3,    51,   174,     6,     3,    88,    51,    52,
-      91,     8,   150,     7,    62,   153,   154,   155,    69,    70,
-       7,    69,    70,     3,     3,    76,    69,    70,     8,     8,
-      81,    82,    83,    84,    85,     7,    87,    13,    14,    21,
-      88,    92,   149,    91,   151,   152,    89,    90,    30,     3,
-     101,     7,     6,   104,   147,   141,   142,   143,   144,     3,
-     111,     3,     6,   156,   157,   158,     8,   174,   119,   120,
-       3,     7,   123,   124,     3,     8,   174,    69,    70,     8,
-       3,   174,     7,     6,  1040,  1040,  1040,    69,    70,  1040,
-       7,   177,  1040,   174,    21,   174,   112,   113,   114,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,     7,     7,    50,   174,
-     175,   176,   177,   174,   148,    52,   174,    51,     6,   121,
-     122,   174,     3,   115,   116,   117,   118,   105,   106,   107,
-     108,   109,   110,     3,     3,    69,    70,     3,     8,     8,
-       3,     8,     8,     4,   870,     8,   852,    43,    44,    45,
-      46,     3,     3,    87,     3,    51,     8,     8,   897,    93,
-      94,    95,    96,    97,    98,    61,   370,    63,    77,    78,
-      79,    80,   174,    69,    70,    71,    72,    73,    74,    75,
-      76,     4,   174,     4,    52,    53,    54,    55,    56,    57,
-       4,     4,    88,     3,     3,    91,    92,     4,     8,     8,
-     404,    69,    70,    99,   408,     3,     3,     3,     3,     3,
-       8,     8,     8,     8,     8,     4,   420,     3,     3,   423,
-     408,     4,     8,     8,     3,     3,   430,     4,   420,     8,
-     420,     4,   420,     3,     3,   423,   440,   174,     8,     8,
-     174,     4,   430,     4,   420,   420,   450,   420,   420,   455,
-     450,   455,   440,     3,   408,   455,   455,   423,     8,     4,
-       3,   423,   450,     3,   430,     8,   420,   455,   430,   423,
-       3,   475,     3,   360,   361,     8,   430,     8,   174,   420,
-      95,    96,   423,    98,     4,     3,   440,   475,     6,   430,
-      22,    23,    24,    25,     8,     8,   450,     4,     4,   440,
-       8,   455,    43,    44,    45,    46,   174,     4,    49,     4,
-      51,    52,     8,     3,    69,    70,     4,     4,     4,     4,
-       4,   475,     4,     4,   174,     4,     4,     4,    69,    70,
-       4,    72,    73,     4,    75,    76,     4,     4,     4,     4,
-       4,     4,   175,   175,   175,   175,   175,    88,     4,     4,
-      91,     4,     4,     4,     4,     4,     4,     4,    99,     4,
-       4,     4,     4,     4,     4,     4,     4,   175,     4,     4,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,     4,     4,   177,     4,     4,     4,   593,
-     145,   146,     4,     4,   175,   177,   600,     4,     4,     4,
-       4,     4,   489,   490,   491,     4,     4,   175,   175,   175,
-       4,     4,   600,     4,     4,     4,     4,     4,     4,   174,
-       4,   625,   626,   175,   628,     4,     4,     4,   177,   177,
-     177,     4,     4,   174,     4,   177,     4,   625,   626,   175,
-     628,     4,     4,     4,     4,   175,   600,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
-     172,   173,   177,     4,   175,     4,     4,   177,     4,     4,
-     175,   625,   626,     4,   628,     7,   174,     7,     7,     7,
-       7,     7,   569,     5,     5,   174,     5,     5,     3,     5,
-       7,   174,     5,     5,     5,     3,     5,     7,     5,     5,
-     175,   174,     7,     7,     7,   592,     7,     5,     5,     5,
-       5,     5,   174,   174,   174,     7,   174,   174,   140,     7,
-     174,     7,     7,     7,     7,     7,     7,    86,   174,     7,
-       7,     7,     7,     4,     4,     4,     4,   174,     4,     4,
-     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
-     174,   174,     4,     4,     4,   174,     4,     6,     4,   174,
-     174,     6,     6,     3,     6,     3,     3,     6,   177,     3,
-       6,     6,     3,     6,     4,     4,     4,     4,     4,     4,
-       4,     4,   174,     3,     6,     6,     3,     3,     6,     8,
-       4,     4,     4,     4,   175,   177,     4,     4,     4,   175,
-     175,   175,     4,     4,   175,     4,   175,     4,     4,   175,
-     177,   175,     4,     6,     4,     4,     3,   175,   175,   175,
-     175,   175,   175,   175,   174,   174,   174,   174,   174,   174,
-     174,     8,     8,     8,   174,     8,     4,   174,     4,     4,
-     174,   174,     4,     7,     5,     4,     4,     4,     4,   174,
-     174,   855,   175,   618,   858,   861,   600,   861,   858,   523,
-     864,   861,   861,   855,   864,   855,   370,   855,   593,   404,
-     858,   875,   864,   861,   878,   875,   864,   881,   177,   855,
-     855,   174,   855,   855,   174,   174,   177,   875,   864,   864,
-     878,   864,   864,   897,   674,   175,   175,   901,   864,   408,
-     867,   855,   864,   907,   858,   854,   910,   861,   873,   897,
-     864,   915,   849,   901,   855,   915,   890,   870,   857,   907,
-     883,   875,   910,   864,   878,   881,   855,   915,   420,   458,
-     866,  1040,    81,   860,   875,   858,   455,   878,   863,   861,
-     909,   907,   912,   897,   910,   907,   907,   901,   910,   450,
-     910,   423,   880,   907,   430,   638,   910,   878,   876,  1046,
-     440,   915,   897,   901,   599,   482,   907,   594,   628,   910,
-     916,  1063,   475,  1080,  1097,    -1,   478,    -1,    -1,    -1,
+      74,    75,    76,    77,    78,    79,    80,    77,    82,    83,
+      84,    85,   625,    78,    79,    76,    77,    78,    79,    80,
+      83,    82,    83,   619,    85,   602,   871,   871,    77,   871,
+      83,    76,    77,    78,    79,    80,   871,    82,    83,    17,
+      85,   871,    10,    16,    17,    82,    83,     5,    77,     7,
+     508,     9,    94,    77,    78,    79,    80,   536,    96,   101,
+       7,    77,     0,    78,    79,   523,    77,   103,   104,   548,
+     549,   550,     3,    13,    14,    11,    12,     8,    77,    15,
+     103,   104,    18,    19,    20,    52,    53,    21,     7,    53,
+      54,    55,    56,    57,    58,     3,     3,    70,    71,     3,
+       8,     8,     6,    70,    71,     7,    70,    71,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    96,    97,    53,
+      99,    55,    56,    90,    91,    59,    60,    61,     3,    78,
+      79,    80,    81,     8,    70,    71,    70,    71,     3,   180,
+      52,    77,   180,     8,   180,     7,    82,    83,    84,    85,
+      86,    63,    88,    21,     7,     3,     3,    93,    70,    71,
+       8,     8,    30,     3,   140,   141,   102,     3,     8,   105,
+      53,    51,     8,     7,     3,     7,   112,    89,     3,     8,
+      92,     3,   150,     8,   120,   121,     8,    70,    71,   125,
+     126,     7,     3,     3,   162,   163,   164,     8,     8,     3,
+     142,   143,    70,    71,     8,  1050,  1050,   180,  1050,     3,
+      70,    71,   180,   180,     8,  1050,   180,   113,   114,   115,
+    1050,    21,   180,   181,   182,   183,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,   180,     7,   180,     3,   116,   117,
+     118,   119,     8,    53,     7,     6,     3,    44,    45,    46,
+      47,     8,   122,   123,   124,    52,     7,     3,   180,   152,
+       6,   154,   155,     3,     3,    62,     7,    64,     8,     8,
+       7,   877,   859,    70,    71,    72,    73,    74,    75,    76,
+      77,   904,    44,    45,    46,    47,   370,   180,    50,     3,
+      52,    53,    89,     3,     8,    92,    93,   151,     8,     7,
+       3,     8,   180,   100,   144,   145,   146,   147,    70,    71,
+     180,    73,    74,     3,    76,    77,     3,     3,     8,     4,
+     404,     8,     8,     3,   408,     3,     3,    89,     8,     3,
+      92,     8,     3,     8,     8,     6,   420,   408,   100,   423,
+     420,     3,     3,   183,     6,     4,   430,     8,   423,   420,
+       4,     3,   423,   408,     6,   430,   440,     4,     4,   430,
+       4,   420,     4,     4,     4,   420,   450,     4,   423,   440,
+     180,   455,   360,   361,     4,   430,     4,     4,     4,   450,
+       3,   420,   455,   180,   455,   440,   420,     8,     4,   423,
+       4,   475,   455,     8,   420,   450,   430,    52,   423,   420,
+     455,    70,    71,   450,   475,   430,   440,     3,   455,    52,
+       4,   420,     4,     8,     3,    70,    71,     4,   180,     4,
+     475,     4,    65,    66,    67,    68,    69,    70,    71,    22,
+      23,    24,    25,    88,     4,     4,     4,     4,   180,    94,
+      95,    96,    97,    98,    99,     4,    89,   153,     4,    92,
+     156,   157,   158,   159,   160,   161,     4,     4,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   106,   107,   108,   109,   110,   111,     4,     4,   148,
+     149,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,     4,     4,     4,     4,
+       4,   489,   490,   491,     4,   181,     4,     4,   181,   593,
+       4,   180,     4,   181,   181,   181,   600,     4,     4,     4,
+       4,     4,     4,     4,     4,   180,     4,     4,     4,   600,
+       4,   181,     4,     4,     4,     4,     4,   180,   183,     4,
+       4,   625,   626,     4,   628,   600,     4,   181,     4,     4,
+     183,     4,     4,     4,   625,   626,   181,   628,     4,   181,
+       4,   181,     4,     4,     4,     4,     4,     4,     4,     4,
+     625,   626,   181,   628,     4,     4,     4,   183,     4,   183,
+     183,   569,     4,     4,   183,     4,     4,     4,     4,     4,
+     181,   181,     4,   181,     4,     4,     4,   183,     4,   183,
+       4,   181,     4,   180,   592,   180,     7,     7,     7,     7,
+       7,     7,     5,     5,     5,     5,   180,     5,     7,     5,
+       5,     5,   180,     5,     7,     5,     5,   180,   180,     7,
+       7,     7,     7,     5,     5,     5,   180,   180,     7,   180,
+     180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
+     180,   180,   180,     5,     5,   180,   180,   180,   180,   180,
+       7,     7,     7,     7,     7,     7,     7,    87,     7,     7,
+       7,     7,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     3,   180,     6,     3,     6,     6,     3,
+       6,     3,     3,     6,   183,     3,     6,     6,     3,     6,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       3,   523,     6,     3,     6,     4,   183,     8,     6,     4,
+       4,     4,   181,   183,   181,     4,     4,   181,     4,     4,
+       4,   181,   181,   181,   181,     4,     4,     4,   183,     4,
+       6,     3,   618,     4,     8,     8,     4,   181,   181,   181,
+     181,     8,     3,     8,   181,     4,   181,   181,   181,     4,
+       4,     4,   370,     5,     4,     4,     7,   181,   181,   180,
+       4,     4,     4,   180,     4,   180,     4,   180,   862,   408,
+     593,   865,   862,   600,   868,   180,   180,   871,   676,   861,
+     856,   862,   404,   180,   865,   868,   871,   868,   882,   180,
+     871,   885,   880,   862,   888,   868,   180,   862,   181,   874,
+     865,   882,   871,   868,   885,   180,   871,   180,   865,   180,
+     904,   868,   180,   862,   871,   909,   183,   882,   862,   183,
+     885,   915,   871,   904,   918,   882,   862,   871,   909,   923,
+     915,   862,   877,   918,   915,   871,   871,   918,   882,   904,
+     871,   885,   923,   862,   909,   897,   458,   888,   890,   864,
+     915,   862,   871,   918,  1050,   180,   420,   873,   923,    81,
+     867,   865,   450,   455,   180,   870,   923,   868,   915,   917,
+     920,   915,   918,   887,   918,   430,   885,   883,   638,   440,
+     915,  1056,   904,   918,   181,   181,   909,   628,   599,   475,
+     181,   183,   594,   180,   423,   478,   924,   180,   482,  1073,
+    1090,  1116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1050,    -1,    -1,    -1,
+      -1,    -1,  1056,    -1,    -1,  1050,    -1,    -1,    -1,  1050,
+      -1,    -1,    -1,    -1,    -1,  1056,    -1,    -1,    -1,  1073,
+      -1,  1050,    -1,    -1,    -1,  1050,    -1,    -1,    -1,    -1,
+      -1,  1056,  1073,  1050,    -1,    -1,    -1,    -1,    -1,  1056,
+      -1,  1050,    -1,    -1,    -1,    -1,  1050,    -1,  1073,    -1,
+      -1,    -1,  1056,    -1,  1050,  1050,  1073,    -1,    -1,  1050,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,  1040,    -1,    -1,    -1,
-    1040,    -1,  1046,    -1,    -1,    -1,  1046,    -1,  1040,    -1,
-      -1,    -1,  1040,    -1,    -1,    -1,    -1,    -1,  1046,  1063,
-      -1,    -1,    -1,  1063,  1040,  1040,    -1,  1040,  1040,    -1,
-      -1,    -1,    -1,    -1,  1040,  1063,    -1,    -1,  1040,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,  1040,    -1,    -1,    -1,
-      -1,    -1,  1046,    -1,    -1,    -1,    -1,    -1,    -1,  1040,
-      -1,    -1,    -1,    -1,    -1,  1046,    -1,    -1,    -1,  1063
+      -1,  1050
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yystos_[] =
   {
-       0,   159,   160,   161,   162,   163,   164,   165,   166,   167,
-     168,   169,   170,   171,   172,   173,   179,   180,   181,   182,
-     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
-     193,   194,     0,     5,     7,     9,   174,   175,   176,   177,
-     195,   196,   197,   202,     7,   211,     7,   217,     7,   232,
-       7,   330,     7,   407,     7,   423,     7,   440,     7,   359,
-       7,   365,     7,   389,     7,   306,     7,   501,     7,   548,
-       7,   539,   203,   198,   212,   218,   233,   331,   408,   424,
-     441,   360,   366,   390,   307,   502,   549,   540,   195,   204,
-     205,   174,   200,   201,    10,   147,   156,   157,   158,   174,
-     210,   213,   214,   215,   531,   533,   535,   546,    11,    12,
-      15,    18,    19,    20,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    69,    70,    76,    81,    82,    83,    84,
-      85,    87,    92,   101,   104,   111,   119,   120,   123,   124,
-     210,   219,   220,   221,   223,   224,   225,   226,   227,   228,
-     230,   239,   241,   243,   280,   286,   292,   298,   300,   314,
-     324,   344,   349,   357,   383,   413,   415,   434,   464,   476,
-     488,   489,   497,   499,   537,    16,    17,   210,   234,   235,
-     236,   238,   413,   415,    61,    63,    71,    72,    73,    74,
-      75,    88,    91,    99,   210,   223,   224,   225,   226,   332,
-     333,   334,   336,   338,   340,   342,   344,   347,   348,   383,
-     401,   413,   415,   417,   434,   459,    62,   210,   340,   342,
-     383,   409,   410,   411,   413,   415,    64,    65,    66,    67,
-      68,   210,   340,   342,   383,   413,   415,   425,   426,   427,
-     429,   430,   432,   433,    87,    93,    94,    95,    96,    97,
-      98,   210,   383,   413,   415,   442,   443,   444,   445,   447,
-     449,   451,   453,   455,   457,   357,    21,    52,    54,    55,
-      58,    59,    60,   210,   261,   367,   368,   369,   370,   371,
-     372,   373,   375,   377,   379,   380,   382,   413,   415,    53,
-      56,    57,   210,   261,   371,   377,   391,   392,   393,   394,
-     395,   397,   398,   399,   400,   413,   415,   102,   103,   210,
-     308,   309,   310,   312,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   145,   146,   210,
-     413,   415,   503,   504,   505,   506,   508,   510,   511,   513,
-     514,   515,   518,   520,   521,   522,   525,   527,   529,   148,
-     550,   551,   552,    13,    14,   541,   542,   543,   545,     6,
-       3,     4,     8,     3,   216,   547,   532,   534,   536,     4,
-       3,     8,   222,   538,   231,   240,   242,   244,     4,     4,
-       4,     4,     4,   229,   325,   358,   384,   414,   416,   345,
-     350,   287,   299,   293,   281,   465,   435,   301,   315,   477,
-       4,   490,   498,   500,     3,     8,   237,     4,     3,     8,
-     402,   418,   335,   337,   339,     4,     4,   343,   341,   460,
-       3,     8,   412,     3,     8,   428,     4,   431,     4,     4,
-       3,     8,   458,   446,   448,   450,   452,   454,   456,     8,
-       3,     8,   374,   262,     4,   378,   376,   381,     4,     8,
-       3,   396,     4,     4,     8,     3,   311,   313,     3,     8,
-       4,   507,   509,     4,   512,     4,     4,   516,   519,     4,
-       4,   523,   526,   528,   530,     3,     8,   553,     3,     8,
-     544,     4,     3,     8,   195,   195,   174,     4,     4,     4,
-       4,     4,   214,     4,     4,     4,     4,     4,     4,   175,
-     175,   175,   175,   175,     4,     4,     4,     4,     4,     4,
+       0,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   185,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,     0,     5,     7,     9,   180,   181,   182,   183,
+     201,   202,   203,   208,     7,   217,     7,   223,     7,   238,
+       7,   337,     7,   414,     7,   430,     7,   447,     7,   366,
+       7,   372,     7,   396,     7,   313,     7,   509,     7,   557,
+       7,   548,   209,   204,   218,   224,   239,   338,   415,   431,
+     448,   367,   373,   397,   314,   510,   558,   549,   201,   210,
+     211,   180,   206,   207,    10,   150,   162,   163,   164,   180,
+     216,   219,   220,   221,   540,   542,   544,   555,    11,    12,
+      15,    18,    19,    20,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    70,    71,    77,    82,    83,    84,    85,
+      86,    88,    93,   102,   105,   112,   120,   121,   125,   126,
+     216,   225,   226,   227,   229,   230,   231,   232,   233,   234,
+     236,   245,   247,   249,   287,   293,   299,   305,   307,   321,
+     331,   351,   356,   364,   390,   420,   422,   441,   471,   483,
+     495,   496,   505,   507,   546,    16,    17,   216,   240,   241,
+     242,   244,   420,   422,    62,    64,    72,    73,    74,    75,
+      76,    89,    92,   100,   216,   229,   230,   231,   232,   339,
+     340,   341,   343,   345,   347,   349,   351,   354,   355,   390,
+     408,   420,   422,   424,   441,   466,    63,   216,   347,   349,
+     390,   416,   417,   418,   420,   422,    65,    66,    67,    68,
+      69,   216,   347,   349,   390,   420,   422,   432,   433,   434,
+     436,   437,   439,   440,    88,    94,    95,    96,    97,    98,
+      99,   216,   390,   420,   422,   449,   450,   451,   452,   454,
+     456,   458,   460,   462,   464,   364,    21,    53,    55,    56,
+      59,    60,    61,   216,   267,   374,   375,   376,   377,   378,
+     379,   380,   382,   384,   386,   387,   389,   420,   422,    54,
+      57,    58,   216,   267,   378,   384,   398,   399,   400,   401,
+     402,   404,   405,   406,   407,   420,   422,   103,   104,   216,
+     315,   316,   317,   319,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   148,   149,   216,
+     420,   422,   511,   512,   513,   514,   516,   518,   519,   521,
+     522,   523,   526,   529,   530,   531,   534,   536,   538,   151,
+     559,   560,   561,    13,    14,   550,   551,   552,   554,     6,
+       3,     4,     8,     3,   222,   556,   541,   543,   545,     4,
+       3,     8,   228,   547,   237,   246,   248,   250,     4,     4,
+       4,     4,     4,   235,   332,   365,   391,   421,   423,   352,
+     357,   294,   306,   300,   288,   472,   442,   308,   322,   484,
+       4,   497,   506,   508,     3,     8,   243,     4,     3,     8,
+     409,   425,   342,   344,   346,     4,     4,   350,   348,   467,
+       3,     8,   419,     3,     8,   435,     4,   438,     4,     4,
+       3,     8,   465,   453,   455,   457,   459,   461,   463,     8,
+       3,     8,   381,   268,     4,   385,   383,   388,     4,     8,
+       3,   403,     4,     4,     8,     3,   318,   320,     3,     8,
+       4,   515,   517,     4,   520,     4,     4,   524,   527,     4,
+       4,   532,   535,   537,   539,     3,     8,   562,     3,     8,
+     553,     4,     3,     8,   201,   201,   180,     4,     4,     4,
+       4,     4,   220,     4,     4,     4,     4,     4,     4,   181,
+     181,   181,   181,   181,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   175,     4,     4,     4,   220,     4,   177,   235,     4,
-       4,     4,     4,     4,   175,   177,     4,     4,     4,   333,
-       4,   410,     4,   175,     4,   175,   175,   426,     4,     4,
-       4,     4,     4,     4,     4,   444,     4,     4,   175,     4,
-       4,     4,   177,   369,     4,   177,   177,   393,     4,     4,
-     309,   177,     4,     4,   175,     4,   175,   175,     4,     4,
-     177,   177,     4,     4,     4,     4,   504,     4,   551,     4,
-     175,   542,     4,     7,     7,   195,   195,   195,   174,     7,
-       7,     7,     7,     5,   174,     5,     5,     5,   197,   199,
-     174,    77,    78,    79,    80,   346,     5,     5,     5,     5,
-       7,     5,     5,     5,     7,     7,     7,   199,     7,     5,
-     206,     5,     5,   174,   174,   174,   206,   174,     7,   174,
-     174,   174,   206,   206,   206,   174,   174,   174,   174,   174,
-     174,   174,   174,   174,   174,   174,   195,   174,   174,   174,
-     138,   139,   517,   140,   141,   142,   143,   144,   177,   524,
-     174,   174,   174,     5,     5,   195,   219,   550,   541,   234,
-      21,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,   210,   249,
-     250,   251,   254,   256,   258,   260,   261,   263,   264,   265,
-     266,   267,   268,   269,   270,   271,   273,   274,   276,   278,
-     249,     7,   245,   246,   247,     7,   326,   327,   328,     7,
-     361,   362,   363,     7,   385,   386,   387,     7,   351,   352,
-     353,    95,   174,   288,   289,   290,   291,   204,    96,    98,
-     290,   294,   295,   296,   297,    86,   282,   283,   284,     7,
-     466,   467,     7,   436,   437,   438,     7,   302,   303,   304,
-     105,   106,   107,   108,   109,   110,   316,   317,   318,   319,
-     320,   321,   322,   323,    21,   115,   116,   117,   118,   210,
-     263,   413,   415,   478,   479,   480,   483,   484,   486,   487,
-     121,   122,   210,   413,   415,   491,   492,   493,   495,   503,
-     207,     7,   403,   404,   405,     7,   419,   420,   421,   100,
-     445,   461,   462,     7,   554,   555,   245,     8,     8,     8,
-       8,   252,   255,   257,   259,     4,     4,     4,     4,     4,
-     272,     4,     4,   275,   277,   279,     4,     4,     4,     3,
-       8,     8,   248,     6,     3,   329,     6,     3,   364,     6,
-       3,   388,     6,     3,   354,     6,     3,     3,     6,     6,
-       3,     6,   285,     3,     8,   468,     3,     6,   439,     6,
-       3,   305,     6,     3,     4,     4,     4,     4,     4,     4,
-       3,     8,   481,   485,     4,     4,     4,     3,     8,   494,
-     496,     3,     8,     8,   174,   208,   209,   406,     6,     3,
-     422,     6,     3,   463,     8,   556,     3,     6,     6,     4,
-       4,     4,     4,   175,   177,   175,   177,   175,     4,   175,
-     175,     4,     4,     4,   175,   175,   177,   250,   249,   247,
-     332,   328,   367,   363,   391,   387,   210,   223,   224,   225,
-     226,   261,   324,   336,   338,   340,   342,   344,   348,   355,
-     356,   383,   413,   415,   459,   353,   289,   295,     4,   283,
-      89,    90,   210,   261,   383,   413,   415,   469,   470,   471,
-     472,   473,   475,   467,   442,   438,   308,   304,   175,   175,
-     175,   175,   175,   175,   317,     4,     4,   175,   175,   175,
-     479,     4,     4,   492,     6,     3,   409,   405,   425,   421,
-       4,   149,   151,   152,   210,   261,   413,   415,   557,   558,
-     559,   560,   562,   555,    22,    23,    24,    25,   253,   174,
-     174,   174,   174,   174,   174,   174,     8,     8,     8,     8,
-       3,     8,   174,   474,     4,     8,     3,     8,     8,   112,
-     113,   114,   482,   174,   174,   174,   174,     8,     8,   174,
-     563,     4,   561,     3,     8,   356,     4,   177,   471,     4,
-     175,     4,   558,   174,     5,   174,     7,   564,   565,   566,
-       3,     6,   150,   153,   154,   155,   567,   568,   569,   571,
-     572,   573,   565,   570,     4,     4,     4,     3,     8,     4,
-     177,   175,   175,   568,   174
+       4,   181,     4,     4,     4,   226,     4,   183,   241,     4,
+       4,     4,     4,     4,   181,   183,     4,     4,     4,   340,
+       4,   417,     4,   181,     4,   181,   181,   433,     4,     4,
+       4,     4,     4,     4,     4,   451,     4,     4,   181,     4,
+       4,     4,   183,   376,     4,   183,   183,   400,     4,     4,
+     316,   183,     4,     4,   181,     4,   181,   181,     4,     4,
+     183,   183,     4,     4,     4,     4,   512,     4,   560,     4,
+     181,   551,     4,     7,     7,   201,   201,   201,   180,     7,
+       7,     7,     7,     5,   180,     5,     5,     5,   203,   205,
+     180,    78,    79,    80,    81,   353,     5,     5,     5,     5,
+       7,     5,     5,     5,     7,     7,     7,   205,     7,     5,
+     212,     5,     5,   180,   180,   180,   212,   180,     7,   180,
+     180,   180,   212,   212,   212,   180,   180,   180,   180,   180,
+     180,   180,   180,   180,   180,   180,   201,   180,   180,   180,
+     140,   141,   525,   142,   143,   528,   144,   145,   146,   147,
+     183,   533,   180,   180,   180,     5,     5,   201,   225,   559,
+     550,   240,    21,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,   216,   255,   256,   257,   260,   262,   264,   266,   267,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     280,   281,   283,   285,   255,     7,   251,   252,   253,     7,
+     333,   334,   335,     7,   368,   369,   370,     7,   392,   393,
+     394,     7,   358,   359,   360,    96,   180,   295,   296,   297,
+     298,   210,    97,    99,   297,   301,   302,   303,   304,    87,
+     289,   290,   291,     7,   473,   474,     7,   443,   444,   445,
+       7,   309,   310,   311,   106,   107,   108,   109,   110,   111,
+     323,   324,   325,   326,   327,   328,   329,   330,    21,   116,
+     117,   118,   119,   216,   269,   420,   422,   485,   486,   487,
+     490,   491,   493,   494,   122,   123,   124,   216,   420,   422,
+     498,   499,   500,   502,   504,   511,   213,     7,   410,   411,
+     412,     7,   426,   427,   428,   101,   452,   468,   469,     7,
+     563,   564,   251,     8,     8,     8,     8,   258,   261,   263,
+     265,     4,     4,     4,     4,     4,     4,   279,     4,     4,
+     282,   284,   286,     4,     4,     4,     3,     8,     8,   254,
+       6,     3,   336,     6,     3,   371,     6,     3,   395,     6,
+       3,   361,     6,     3,     3,     6,     6,     3,     6,   292,
+       3,     8,   475,     3,     6,   446,     6,     3,   312,     6,
+       3,     4,     4,     4,     4,     4,     4,     3,     8,   488,
+     492,     4,     4,     4,     3,     8,   501,   503,     4,     3,
+       8,     8,   180,   214,   215,   413,     6,     3,   429,     6,
+       3,   470,     8,   565,     3,     6,     6,     4,     4,     4,
+       4,   181,   183,   181,   183,   183,   181,     4,   181,   181,
+       4,     4,     4,   181,   181,   183,   256,   255,   253,   339,
+     335,   374,   370,   398,   394,   216,   229,   230,   231,   232,
+     267,   331,   343,   345,   347,   349,   351,   355,   362,   363,
+     390,   420,   422,   466,   360,   296,   302,     4,   290,    90,
+      91,   216,   267,   390,   420,   422,   476,   477,   478,   479,
+     480,   482,   474,   449,   445,   315,   311,   181,   181,   181,
+     181,   181,   181,   324,     4,     4,   181,   181,   181,   486,
+       4,     4,   181,   499,     6,     3,   416,   412,   432,   428,
+       4,   152,   154,   155,   216,   267,   420,   422,   566,   567,
+     568,   569,   571,   564,    22,    23,    24,    25,   259,   180,
+     180,   180,   180,   180,   180,   180,     8,     8,     8,     8,
+       3,     8,   180,   481,     4,     8,     3,     8,     8,   113,
+     114,   115,   489,   180,   180,   180,   180,     8,     8,   180,
+     572,     4,   570,     3,     8,   363,     4,   183,   478,     4,
+     181,     4,   567,   180,     5,   180,     7,   573,   574,   575,
+       3,     6,   153,   156,   157,   158,   159,   160,   161,   576,
+     577,   578,   580,   581,   582,   583,   584,   585,   574,   579,
+       4,     4,     4,     4,     4,   586,     3,     8,     4,   183,
+     181,   181,   183,   181,     4,   577,   180,   180
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   178,   180,   179,   181,   179,   182,   179,   183,   179,
-     184,   179,   185,   179,   186,   179,   187,   179,   188,   179,
-     189,   179,   190,   179,   191,   179,   192,   179,   193,   179,
-     194,   179,   195,   195,   195,   195,   195,   195,   195,   196,
-     198,   197,   199,   200,   200,   201,   201,   203,   202,   204,
-     204,   205,   205,   207,   206,   208,   208,   209,   209,   210,
-     212,   211,   213,   213,   214,   214,   214,   214,   214,   214,
-     216,   215,   218,   217,   219,   219,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
-     220,   220,   220,   220,   220,   220,   220,   220,   220,   222,
-     221,   223,   224,   225,   226,   227,   229,   228,   231,   230,
-     233,   232,   234,   234,   235,   235,   235,   235,   235,   237,
-     236,   238,   240,   239,   242,   241,   244,   243,   245,   245,
-     246,   246,   248,   247,   249,   249,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   252,   251,   253,   253,
-     253,   253,   255,   254,   257,   256,   259,   258,   260,   262,
-     261,   263,   264,   265,   266,   267,   268,   269,   270,   272,
-     271,   273,   275,   274,   277,   276,   279,   278,   281,   280,
-     282,   282,   283,   285,   284,   287,   286,   288,   288,   289,
-     289,   290,   291,   293,   292,   294,   294,   295,   295,   295,
-     296,   297,   299,   298,   301,   300,   302,   302,   303,   303,
-     305,   304,   307,   306,   308,   308,   308,   309,   309,   311,
-     310,   313,   312,   315,   314,   316,   316,   317,   317,   317,
-     317,   317,   317,   318,   319,   320,   321,   322,   323,   325,
-     324,   326,   326,   327,   327,   329,   328,   331,   330,   332,
-     332,   333,   333,   333,   333,   333,   333,   333,   333,   333,
-     333,   333,   333,   333,   333,   333,   333,   333,   333,   333,
-     333,   335,   334,   337,   336,   339,   338,   341,   340,   343,
-     342,   345,   344,   346,   346,   346,   346,   347,   348,   350,
-     349,   351,   351,   352,   352,   354,   353,   355,   355,   356,
-     356,   356,   356,   356,   356,   356,   356,   356,   356,   356,
-     356,   356,   356,   356,   356,   356,   358,   357,   360,   359,
-     361,   361,   362,   362,   364,   363,   366,   365,   367,   367,
-     368,   368,   369,   369,   369,   369,   369,   369,   369,   369,
-     369,   369,   370,   371,   372,   374,   373,   376,   375,   378,
-     377,   379,   381,   380,   382,   384,   383,   385,   385,   386,
-     386,   388,   387,   390,   389,   391,   391,   392,   392,   393,
-     393,   393,   393,   393,   393,   393,   393,   393,   394,   396,
-     395,   397,   398,   399,   400,   402,   401,   403,   403,   404,
-     404,   406,   405,   408,   407,   409,   409,   410,   410,   410,
-     410,   410,   410,   410,   412,   411,   414,   413,   416,   415,
-     418,   417,   419,   419,   420,   420,   422,   421,   424,   423,
-     425,   425,   426,   426,   426,   426,   426,   426,   426,   426,
-     426,   426,   426,   428,   427,   429,   431,   430,   432,   433,
-     435,   434,   436,   436,   437,   437,   439,   438,   441,   440,
-     442,   442,   443,   443,   444,   444,   444,   444,   444,   444,
-     444,   444,   444,   444,   444,   446,   445,   448,   447,   450,
-     449,   452,   451,   454,   453,   456,   455,   458,   457,   460,
-     459,   461,   461,   463,   462,   465,   464,   466,   466,   468,
-     467,   469,   469,   470,   470,   471,   471,   471,   471,   471,
-     471,   471,   472,   474,   473,   475,   477,   476,   478,   478,
-     479,   479,   479,   479,   479,   479,   479,   479,   479,   481,
-     480,   482,   482,   482,   483,   485,   484,   486,   487,   488,
-     490,   489,   491,   491,   492,   492,   492,   492,   492,   494,
-     493,   496,   495,   498,   497,   500,   499,   502,   501,   503,
-     503,   504,   504,   504,   504,   504,   504,   504,   504,   504,
-     504,   504,   504,   504,   504,   504,   504,   504,   504,   505,
-     507,   506,   509,   508,   510,   512,   511,   513,   514,   516,
-     515,   517,   517,   519,   518,   520,   521,   523,   522,   524,
-     524,   524,   524,   524,   526,   525,   528,   527,   530,   529,
-     532,   531,   534,   533,   536,   535,   538,   537,   540,   539,
-     541,   541,   542,   542,   544,   543,   545,   547,   546,   549,
-     548,   550,   550,   551,   553,   552,   554,   554,   556,   555,
-     557,   557,   558,   558,   558,   558,   558,   558,   558,   559,
-     561,   560,   563,   562,   564,   564,   566,   565,   567,   567,
-     568,   568,   568,   568,   570,   569,   571,   572,   573
+       0,   184,   186,   185,   187,   185,   188,   185,   189,   185,
+     190,   185,   191,   185,   192,   185,   193,   185,   194,   185,
+     195,   185,   196,   185,   197,   185,   198,   185,   199,   185,
+     200,   185,   201,   201,   201,   201,   201,   201,   201,   202,
+     204,   203,   205,   206,   206,   207,   207,   209,   208,   210,
+     210,   211,   211,   213,   212,   214,   214,   215,   215,   216,
+     218,   217,   219,   219,   220,   220,   220,   220,   220,   220,
+     222,   221,   224,   223,   225,   225,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   228,
+     227,   229,   230,   231,   232,   233,   235,   234,   237,   236,
+     239,   238,   240,   240,   241,   241,   241,   241,   241,   243,
+     242,   244,   246,   245,   248,   247,   250,   249,   251,   251,
+     252,   252,   254,   253,   255,   255,   256,   256,   256,   256,
+     256,   256,   256,   256,   256,   256,   256,   256,   256,   256,
+     256,   256,   256,   256,   256,   256,   256,   258,   257,   259,
+     259,   259,   259,   261,   260,   263,   262,   265,   264,   266,
+     268,   267,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   279,   278,   280,   282,   281,   284,   283,   286,   285,
+     288,   287,   289,   289,   290,   292,   291,   294,   293,   295,
+     295,   296,   296,   297,   298,   300,   299,   301,   301,   302,
+     302,   302,   303,   304,   306,   305,   308,   307,   309,   309,
+     310,   310,   312,   311,   314,   313,   315,   315,   315,   316,
+     316,   318,   317,   320,   319,   322,   321,   323,   323,   324,
+     324,   324,   324,   324,   324,   325,   326,   327,   328,   329,
+     330,   332,   331,   333,   333,   334,   334,   336,   335,   338,
+     337,   339,   339,   340,   340,   340,   340,   340,   340,   340,
+     340,   340,   340,   340,   340,   340,   340,   340,   340,   340,
+     340,   340,   340,   342,   341,   344,   343,   346,   345,   348,
+     347,   350,   349,   352,   351,   353,   353,   353,   353,   354,
+     355,   357,   356,   358,   358,   359,   359,   361,   360,   362,
+     362,   363,   363,   363,   363,   363,   363,   363,   363,   363,
+     363,   363,   363,   363,   363,   363,   363,   363,   365,   364,
+     367,   366,   368,   368,   369,   369,   371,   370,   373,   372,
+     374,   374,   375,   375,   376,   376,   376,   376,   376,   376,
+     376,   376,   376,   376,   377,   378,   379,   381,   380,   383,
+     382,   385,   384,   386,   388,   387,   389,   391,   390,   392,
+     392,   393,   393,   395,   394,   397,   396,   398,   398,   399,
+     399,   400,   400,   400,   400,   400,   400,   400,   400,   400,
+     401,   403,   402,   404,   405,   406,   407,   409,   408,   410,
+     410,   411,   411,   413,   412,   415,   414,   416,   416,   417,
+     417,   417,   417,   417,   417,   417,   419,   418,   421,   420,
+     423,   422,   425,   424,   426,   426,   427,   427,   429,   428,
+     431,   430,   432,   432,   433,   433,   433,   433,   433,   433,
+     433,   433,   433,   433,   433,   435,   434,   436,   438,   437,
+     439,   440,   442,   441,   443,   443,   444,   444,   446,   445,
+     448,   447,   449,   449,   450,   450,   451,   451,   451,   451,
+     451,   451,   451,   451,   451,   451,   451,   453,   452,   455,
+     454,   457,   456,   459,   458,   461,   460,   463,   462,   465,
+     464,   467,   466,   468,   468,   470,   469,   472,   471,   473,
+     473,   475,   474,   476,   476,   477,   477,   478,   478,   478,
+     478,   478,   478,   478,   479,   481,   480,   482,   484,   483,
+     485,   485,   486,   486,   486,   486,   486,   486,   486,   486,
+     486,   488,   487,   489,   489,   489,   490,   492,   491,   493,
+     494,   495,   497,   496,   498,   498,   499,   499,   499,   499,
+     499,   499,   501,   500,   503,   502,   504,   506,   505,   508,
+     507,   510,   509,   511,   511,   512,   512,   512,   512,   512,
+     512,   512,   512,   512,   512,   512,   512,   512,   512,   512,
+     512,   512,   512,   513,   515,   514,   517,   516,   518,   520,
+     519,   521,   522,   524,   523,   525,   525,   527,   526,   528,
+     528,   529,   530,   532,   531,   533,   533,   533,   533,   533,
+     535,   534,   537,   536,   539,   538,   541,   540,   543,   542,
+     545,   544,   547,   546,   549,   548,   550,   550,   551,   551,
+     553,   552,   554,   556,   555,   558,   557,   559,   559,   560,
+     562,   561,   563,   563,   565,   564,   566,   566,   567,   567,
+     567,   567,   567,   567,   567,   568,   570,   569,   572,   571,
+     573,   573,   575,   574,   576,   576,   577,   577,   577,   577,
+     577,   577,   577,   579,   578,   580,   581,   582,   583,   584,
+     586,   585
   };
 
-  const unsigned char
+  const signed char
   Dhcp6Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -4819,89 +5015,92 @@ namespace isc { namespace dhcp {
        4,     3,     0,     6,     0,     6,     0,     6,     0,     1,
        1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     3,     0,
-       4,     3,     3,     3,     3,     3,     3,     3,     3,     0,
-       4,     3,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     3,     1,     0,     4,     0,     6,     1,     3,     1,
-       1,     1,     1,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     0,     6,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     1,     3,     1,     1,     1,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     3,     3,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     3,
+       0,     4,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     0,     4,     3,     0,     4,     0,     4,     0,     4,
+       0,     6,     1,     3,     1,     0,     4,     0,     6,     1,
+       3,     1,     1,     1,     1,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     0,     6,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     0,     4,     0,     4,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     1,     1,     1,     1,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     6,     0,     4,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     1,     0,     4,     0,     4,     0,
-       4,     1,     0,     4,     3,     0,     6,     0,     1,     1,
-       3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     1,     1,     3,     3,     0,     6,     0,     1,     1,
-       3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     3,     0,     4,     3,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     1,     1,     1,     1,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     6,
+       0,     4,     0,     1,     1,     3,     0,     4,     0,     4,
        0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     1,     1,     0,     4,     0,     6,     1,     3,     0,
-       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     3,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     1,     1,     1,     3,     0,     4,     3,     3,     3,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     6,     0,     4,     1,
+       1,     1,     1,     1,     1,     3,     1,     0,     4,     0,
+       4,     0,     4,     1,     0,     4,     3,     0,     6,     0,
+       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
        3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
-       0,     4,     0,     4,     3,     0,     4,     3,     3,     0,
-       4,     1,     1,     0,     4,     3,     3,     0,     4,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     6,     0,     4,
-       1,     3,     1,     1,     0,     6,     3,     0,     6,     0,
-       4,     1,     3,     1,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     3,
-       0,     4,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     3,     3,     3
+       1,     0,     4,     1,     1,     3,     3,     0,     6,     0,
+       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     4,     3,     0,     4,
+       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     0,     1,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     6,     1,     1,     0,     4,     0,     6,     1,
+       3,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     4,     3,     0,     6,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     1,     1,     1,     3,     0,     4,     3,
+       3,     3,     0,     6,     1,     3,     1,     1,     1,     1,
+       1,     1,     0,     4,     0,     4,     3,     0,     4,     0,
+       6,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     0,     4,     0,     4,     3,     0,
+       4,     3,     3,     0,     4,     1,     1,     0,     4,     1,
+       1,     3,     3,     0,     4,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     6,     0,     4,     1,     3,     1,     1,
+       0,     6,     3,     0,     6,     0,     4,     1,     3,     1,
+       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     3,     0,     4,     0,     6,
+       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     3,     3,     3,     3,     3,
+       0,     4
   };
 
 
-
+#if PARSER6_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp6Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"data-directory\"",
-  "\"config-control\"", "\"config-databases\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
+  "\"data-directory\"", "\"config-control\"", "\"config-databases\"",
   "\"config-fetch-wait-time\"", "\"interfaces-config\"", "\"interfaces\"",
   "\"re-detect\"", "\"lease-database\"", "\"hosts-database\"",
   "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
   "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
-  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"max-reconnect-tries\"",
-  "\"reconnect-wait-time\"", "\"keyspace\"", "\"consistency\"",
-  "\"serial-consistency\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"preferred-lifetime\"", "\"valid-lifetime\"",
-  "\"renew-timer\"", "\"rebind-timer\"", "\"decline-probation-period\"",
-  "\"server-tag\"", "\"subnet6\"", "\"option-def\"", "\"option-data\"",
-  "\"name\"", "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"",
-  "\"always-send\"", "\"record-types\"", "\"encapsulate\"", "\"array\"",
-  "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
-  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
-  "\"user-context\"", "\"comment\"", "\"subnet\"", "\"interface\"",
-  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
-  "\"disabled\"", "\"out-of-pool\"", "\"global\"", "\"all\"",
-  "\"shared-networks\"", "\"mac-sources\"", "\"relay-supplied-options\"",
+  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"lfc-in-process\"",
+  "\"readonly\"", "\"connect-timeout\"", "\"contact-points\"",
+  "\"max-reconnect-tries\"", "\"reconnect-wait-time\"", "\"keyspace\"",
+  "\"consistency\"", "\"serial-consistency\"", "\"request-timeout\"",
+  "\"tcp-keepalive\"", "\"tcp-nodelay\"", "\"preferred-lifetime\"",
+  "\"valid-lifetime\"", "\"renew-timer\"", "\"rebind-timer\"",
+  "\"decline-probation-period\"", "\"server-tag\"", "\"subnet6\"",
+  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
+  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
+  "\"encapsulate\"", "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"",
+  "\"prefix\"", "\"prefix-len\"", "\"excluded-prefix\"",
+  "\"excluded-prefix-len\"", "\"delegated-len\"", "\"user-context\"",
+  "\"comment\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
+  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
+  "\"out-of-pool\"", "\"global\"", "\"all\"", "\"shared-networks\"",
+  "\"mac-sources\"", "\"relay-supplied-options\"",
   "\"host-reservation-identifiers\"", "\"sanity-checks\"",
   "\"lease-checks\"", "\"client-classes\"", "\"require-client-classes\"",
   "\"test\"", "\"only-if-required\"", "\"client-class\"",
@@ -4914,21 +5113,22 @@ namespace isc { namespace dhcp {
   "\"unwarned-reclaim-cycles\"", "\"server-id\"", "\"LLT\"", "\"EN\"",
   "\"LL\"", "\"identifier\"", "\"htype\"", "\"time\"", "\"enterprise-id\"",
   "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
-  "\"socket-name\"", "\"dhcp-queue-control\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"socket-name\"", "\"config-output-threads\"", "\"dhcp-queue-control\"",
+  "\"dhcp-ddns\"", "\"enable-updates\"", "\"qualifying-suffix\"",
+  "\"server-ip\"", "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
   "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
   "\"override-no-update\"", "\"override-client-update\"",
   "\"replace-client-name\"", "\"generated-prefix\"", "\"UDP\"", "\"TCP\"",
-  "\"JSON\"", "\"when-present\"", "\"never\"", "\"always\"",
+  "\"JSON\"", "\"BINARY\"", "\"when-present\"", "\"never\"", "\"always\"",
   "\"when-not-present\"", "\"hostname-char-set\"",
   "\"hostname-char-replacement\"", "\"Logging\"", "\"loggers\"",
   "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
-  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"", "\"DhcpDdns\"",
-  "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6",
-  "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL",
-  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
-  "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
+  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"", "\"queue-size\"",
+  "\"overflow\"", "\"Dhcp4\"", "\"DhcpDdns\"", "\"Control-agent\"",
+  "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6", "SUB_INTERFACES6",
+  "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL", "SUB_RESERVATION",
+  "SUB_OPTION_DEFS", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
+  "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
   "SUB_CONFIG_CONTROL", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
   "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12",
@@ -4946,12 +5146,13 @@ namespace isc { namespace dhcp {
   "$@29", "database_list", "not_empty_database_list", "database", "$@30",
   "database_map_params", "database_map_param", "database_type", "$@31",
   "db_type", "user", "$@32", "password", "$@33", "host", "$@34", "port",
-  "name", "$@35", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "reconnect_wait_time", "request_timeout", "tcp_keepalive", "tcp_nodelay",
-  "contact_points", "$@36", "max_reconnect_tries", "keyspace", "$@37",
-  "consistency", "$@38", "serial_consistency", "$@39", "sanity_checks",
-  "$@40", "sanity_checks_params", "sanity_checks_param", "lease_checks",
-  "$@41", "mac_sources", "$@42", "mac_sources_list", "mac_sources_value",
+  "name", "$@35", "persist", "lfc_interval", "lfc_in_process", "readonly",
+  "connect_timeout", "reconnect_wait_time", "request_timeout",
+  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@36",
+  "max_reconnect_tries", "keyspace", "$@37", "consistency", "$@38",
+  "serial_consistency", "$@39", "sanity_checks", "$@40",
+  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@41",
+  "mac_sources", "$@42", "mac_sources_list", "mac_sources_value",
   "duid_id", "string_id", "host_reservation_identifiers", "$@43",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "hw_address_id", "flex_id", "relay_supplied_options", "$@44",
@@ -5004,11 +5205,12 @@ namespace isc { namespace dhcp {
   "server_id_type", "$@101", "duid_type", "htype", "identifier", "$@102",
   "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@103",
   "control_socket_params", "control_socket_param", "socket_type", "$@104",
-  "socket_name", "$@105", "dhcp_queue_control", "$@106", "dhcp_ddns",
-  "$@107", "sub_dhcp_ddns", "$@108", "dhcp_ddns_params", "dhcp_ddns_param",
-  "enable_updates", "qualifying_suffix", "$@109", "server_ip", "$@110",
-  "server_port", "sender_ip", "$@111", "sender_port", "max_queue_size",
-  "ncr_protocol", "$@112", "ncr_protocol_value", "ncr_format", "$@113",
+  "socket_name", "$@105", "config_output_threads", "dhcp_queue_control",
+  "$@106", "dhcp_ddns", "$@107", "sub_dhcp_ddns", "$@108",
+  "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
+  "qualifying_suffix", "$@109", "server_ip", "$@110", "server_port",
+  "sender_ip", "$@111", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@112", "ncr_protocol_value", "ncr_format", "$@113", "ncr_format_value",
   "override_no_update", "override_client_update", "replace_client_name",
   "$@114", "replace_client_name_value", "generated_prefix", "$@115",
   "hostname_char_set", "$@116", "hostname_char_replacement", "$@117",
@@ -5022,101 +5224,103 @@ namespace isc { namespace dhcp {
   "logger_param", "debuglevel", "severity", "$@128", "output_options_list",
   "$@129", "output_options_list_content", "output_entry", "$@130",
   "output_params_list", "output_params", "output", "$@131", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "maxsize", "maxver", "async", "queue_size", "overflow", "$@132", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER6_DEBUG
-  const unsigned short
+  const short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   262,   262,   262,   263,   263,   264,   264,   265,   265,
-     266,   266,   267,   267,   268,   268,   269,   269,   270,   270,
-     271,   271,   272,   272,   273,   273,   274,   274,   275,   275,
-     276,   276,   284,   285,   286,   287,   288,   289,   290,   293,
-     298,   298,   309,   312,   313,   316,   320,   327,   327,   334,
-     335,   338,   342,   349,   349,   356,   357,   360,   364,   375,
-     385,   385,   400,   401,   405,   406,   407,   408,   409,   410,
-     413,   413,   428,   428,   437,   438,   443,   444,   445,   446,
-     447,   448,   449,   450,   451,   452,   453,   454,   455,   456,
-     457,   458,   459,   460,   461,   462,   463,   464,   465,   466,
-     467,   468,   469,   470,   471,   472,   473,   474,   475,   478,
-     478,   486,   491,   496,   501,   506,   511,   511,   519,   519,
-     530,   530,   539,   540,   543,   544,   545,   546,   547,   550,
-     550,   560,   566,   566,   578,   578,   590,   590,   600,   601,
-     604,   605,   608,   608,   618,   619,   622,   623,   624,   625,
-     626,   627,   628,   629,   630,   631,   632,   633,   634,   635,
-     636,   637,   638,   639,   640,   641,   644,   644,   651,   652,
-     653,   654,   657,   657,   665,   665,   673,   673,   681,   686,
-     686,   694,   699,   704,   709,   714,   719,   724,   729,   734,
-     734,   742,   747,   747,   755,   755,   763,   763,   771,   771,
-     781,   782,   784,   786,   786,   804,   804,   814,   815,   818,
-     819,   822,   827,   832,   832,   842,   843,   846,   847,   848,
-     851,   856,   863,   863,   873,   873,   883,   884,   887,   888,
-     891,   891,   901,   901,   911,   912,   913,   916,   917,   920,
-     920,   928,   928,   936,   936,   947,   948,   951,   952,   953,
-     954,   955,   956,   959,   964,   969,   974,   979,   984,   992,
-     992,  1005,  1006,  1009,  1010,  1017,  1017,  1043,  1043,  1054,
-    1055,  1059,  1060,  1061,  1062,  1063,  1064,  1065,  1066,  1067,
-    1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,
-    1078,  1081,  1081,  1089,  1089,  1097,  1097,  1105,  1105,  1113,
-    1113,  1123,  1123,  1130,  1131,  1132,  1133,  1136,  1141,  1149,
-    1149,  1160,  1161,  1165,  1166,  1169,  1169,  1177,  1178,  1181,
-    1182,  1183,  1184,  1185,  1186,  1187,  1188,  1189,  1190,  1191,
-    1192,  1193,  1194,  1195,  1196,  1197,  1204,  1204,  1217,  1217,
-    1226,  1227,  1230,  1231,  1236,  1236,  1251,  1251,  1265,  1266,
-    1269,  1270,  1273,  1274,  1275,  1276,  1277,  1278,  1279,  1280,
-    1281,  1282,  1285,  1287,  1292,  1294,  1294,  1302,  1302,  1310,
-    1310,  1318,  1320,  1320,  1328,  1337,  1337,  1349,  1350,  1355,
-    1356,  1361,  1361,  1373,  1373,  1385,  1386,  1391,  1392,  1397,
-    1398,  1399,  1400,  1401,  1402,  1403,  1404,  1405,  1408,  1410,
-    1410,  1418,  1420,  1422,  1427,  1435,  1435,  1447,  1448,  1451,
-    1452,  1455,  1455,  1465,  1465,  1474,  1475,  1478,  1479,  1480,
-    1481,  1482,  1483,  1484,  1487,  1487,  1495,  1495,  1520,  1520,
-    1550,  1550,  1562,  1563,  1566,  1567,  1570,  1570,  1582,  1582,
-    1594,  1595,  1598,  1599,  1600,  1601,  1602,  1603,  1604,  1605,
-    1606,  1607,  1608,  1611,  1611,  1619,  1624,  1624,  1632,  1637,
-    1645,  1645,  1655,  1656,  1659,  1660,  1663,  1663,  1672,  1672,
-    1681,  1682,  1685,  1686,  1690,  1691,  1692,  1693,  1694,  1695,
-    1696,  1697,  1698,  1699,  1700,  1703,  1703,  1713,  1713,  1723,
-    1723,  1731,  1731,  1739,  1739,  1747,  1747,  1755,  1755,  1768,
-    1768,  1778,  1779,  1782,  1782,  1793,  1793,  1803,  1804,  1807,
-    1807,  1817,  1818,  1821,  1822,  1825,  1826,  1827,  1828,  1829,
-    1830,  1831,  1834,  1836,  1836,  1844,  1852,  1852,  1864,  1865,
-    1868,  1869,  1870,  1871,  1872,  1873,  1874,  1875,  1876,  1879,
-    1879,  1886,  1887,  1888,  1891,  1896,  1896,  1904,  1909,  1916,
-    1923,  1923,  1933,  1934,  1937,  1938,  1939,  1940,  1941,  1944,
-    1944,  1952,  1952,  1962,  1962,  2002,  2002,  2014,  2014,  2024,
-    2025,  2028,  2029,  2030,  2031,  2032,  2033,  2034,  2035,  2036,
-    2037,  2038,  2039,  2040,  2041,  2042,  2043,  2044,  2045,  2048,
-    2053,  2053,  2061,  2061,  2069,  2074,  2074,  2082,  2087,  2092,
-    2092,  2100,  2101,  2104,  2104,  2112,  2117,  2122,  2122,  2130,
-    2133,  2136,  2139,  2142,  2148,  2148,  2156,  2156,  2164,  2164,
-    2174,  2174,  2181,  2181,  2188,  2188,  2197,  2197,  2208,  2208,
-    2218,  2219,  2223,  2224,  2227,  2227,  2237,  2247,  2247,  2257,
-    2257,  2268,  2269,  2273,  2277,  2277,  2289,  2290,  2294,  2294,
-    2302,  2303,  2306,  2307,  2308,  2309,  2310,  2311,  2312,  2315,
-    2320,  2320,  2328,  2328,  2338,  2339,  2342,  2342,  2350,  2351,
-    2354,  2355,  2356,  2357,  2360,  2360,  2368,  2373,  2378
+       0,   269,   269,   269,   270,   270,   271,   271,   272,   272,
+     273,   273,   274,   274,   275,   275,   276,   276,   277,   277,
+     278,   278,   279,   279,   280,   280,   281,   281,   282,   282,
+     283,   283,   291,   292,   293,   294,   295,   296,   297,   300,
+     305,   305,   316,   319,   320,   323,   327,   334,   334,   341,
+     342,   345,   349,   356,   356,   363,   364,   367,   371,   382,
+     392,   392,   407,   408,   412,   413,   414,   415,   416,   417,
+     420,   420,   435,   435,   444,   445,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
+     464,   465,   466,   467,   468,   469,   470,   471,   472,   473,
+     474,   475,   476,   477,   478,   479,   480,   481,   482,   485,
+     485,   493,   498,   503,   508,   513,   518,   518,   526,   526,
+     537,   537,   546,   547,   550,   551,   552,   553,   554,   557,
+     557,   567,   573,   573,   585,   585,   597,   597,   607,   608,
+     611,   612,   615,   615,   625,   626,   629,   630,   631,   632,
+     633,   634,   635,   636,   637,   638,   639,   640,   641,   642,
+     643,   644,   645,   646,   647,   648,   649,   652,   652,   659,
+     660,   661,   662,   665,   665,   673,   673,   681,   681,   689,
+     694,   694,   702,   707,   712,   717,   722,   727,   732,   737,
+     742,   747,   747,   755,   760,   760,   768,   768,   776,   776,
+     784,   784,   794,   795,   797,   799,   799,   817,   817,   827,
+     828,   831,   832,   835,   840,   845,   845,   855,   856,   859,
+     860,   861,   864,   869,   876,   876,   886,   886,   896,   897,
+     900,   901,   904,   904,   914,   914,   924,   925,   926,   929,
+     930,   933,   933,   941,   941,   949,   949,   960,   961,   964,
+     965,   966,   967,   968,   969,   972,   977,   982,   987,   992,
+     997,  1005,  1005,  1018,  1019,  1022,  1023,  1030,  1030,  1056,
+    1056,  1067,  1068,  1072,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+    1089,  1090,  1091,  1094,  1094,  1102,  1102,  1110,  1110,  1118,
+    1118,  1126,  1126,  1136,  1136,  1143,  1144,  1145,  1146,  1149,
+    1154,  1162,  1162,  1173,  1174,  1178,  1179,  1182,  1182,  1190,
+    1191,  1194,  1195,  1196,  1197,  1198,  1199,  1200,  1201,  1202,
+    1203,  1204,  1205,  1206,  1207,  1208,  1209,  1210,  1217,  1217,
+    1230,  1230,  1239,  1240,  1243,  1244,  1249,  1249,  1264,  1264,
+    1278,  1279,  1282,  1283,  1286,  1287,  1288,  1289,  1290,  1291,
+    1292,  1293,  1294,  1295,  1298,  1300,  1305,  1307,  1307,  1315,
+    1315,  1323,  1323,  1331,  1333,  1333,  1341,  1350,  1350,  1362,
+    1363,  1368,  1369,  1374,  1374,  1386,  1386,  1398,  1399,  1404,
+    1405,  1410,  1411,  1412,  1413,  1414,  1415,  1416,  1417,  1418,
+    1421,  1423,  1423,  1431,  1433,  1435,  1440,  1448,  1448,  1460,
+    1461,  1464,  1465,  1468,  1468,  1478,  1478,  1487,  1488,  1491,
+    1492,  1493,  1494,  1495,  1496,  1497,  1500,  1500,  1508,  1508,
+    1533,  1533,  1563,  1563,  1575,  1576,  1579,  1580,  1583,  1583,
+    1595,  1595,  1607,  1608,  1611,  1612,  1613,  1614,  1615,  1616,
+    1617,  1618,  1619,  1620,  1621,  1624,  1624,  1632,  1637,  1637,
+    1645,  1650,  1658,  1658,  1668,  1669,  1672,  1673,  1676,  1676,
+    1685,  1685,  1694,  1695,  1698,  1699,  1703,  1704,  1705,  1706,
+    1707,  1708,  1709,  1710,  1711,  1712,  1713,  1716,  1716,  1726,
+    1726,  1736,  1736,  1744,  1744,  1752,  1752,  1760,  1760,  1768,
+    1768,  1781,  1781,  1791,  1792,  1795,  1795,  1806,  1806,  1816,
+    1817,  1820,  1820,  1830,  1831,  1834,  1835,  1838,  1839,  1840,
+    1841,  1842,  1843,  1844,  1847,  1849,  1849,  1857,  1865,  1865,
+    1877,  1878,  1881,  1882,  1883,  1884,  1885,  1886,  1887,  1888,
+    1889,  1892,  1892,  1899,  1900,  1901,  1904,  1909,  1909,  1917,
+    1922,  1929,  1936,  1936,  1946,  1947,  1950,  1951,  1952,  1953,
+    1954,  1955,  1958,  1958,  1966,  1966,  1974,  1981,  1981,  2021,
+    2021,  2033,  2033,  2043,  2044,  2047,  2048,  2049,  2050,  2051,
+    2052,  2053,  2054,  2055,  2056,  2057,  2058,  2059,  2060,  2061,
+    2062,  2063,  2064,  2067,  2072,  2072,  2080,  2080,  2088,  2093,
+    2093,  2101,  2106,  2111,  2111,  2119,  2120,  2123,  2123,  2131,
+    2132,  2135,  2140,  2145,  2145,  2153,  2156,  2159,  2162,  2165,
+    2171,  2171,  2179,  2179,  2187,  2187,  2197,  2197,  2204,  2204,
+    2211,  2211,  2220,  2220,  2231,  2231,  2241,  2242,  2246,  2247,
+    2250,  2250,  2260,  2270,  2270,  2280,  2280,  2291,  2292,  2296,
+    2300,  2300,  2312,  2313,  2317,  2317,  2325,  2326,  2329,  2330,
+    2331,  2332,  2333,  2334,  2335,  2338,  2343,  2343,  2351,  2351,
+    2361,  2362,  2365,  2365,  2373,  2374,  2377,  2378,  2379,  2380,
+    2381,  2382,  2383,  2386,  2386,  2394,  2399,  2404,  2409,  2414,
+    2419,  2419
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp6Parser::yystack_print_ ()
+  Dhcp6Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp6Parser::yy_reduce_print_ (int yyrule)
+  Dhcp6Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -5129,10 +5333,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER6_DEBUG
 
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:1218
+#line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 5135 "dhcp6_parser.cc" // lalr1.cc:1218
-#line 2383 "dhcp6_parser.yy" // lalr1.cc:1219
+#line 5339 "dhcp6_parser.cc"
+
+#line 2427 "dhcp6_parser.yy"
 
 
 void
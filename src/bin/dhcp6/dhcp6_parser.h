@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,13 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_PARSER6_DHCP6_PARSER_H_INCLUDED
 # define YY_PARSER6_DHCP6_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "dhcp6_parser.yy" // lalr1.cc:404
+// "%code requires" blocks.
+#line 17 "dhcp6_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -56,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "dhcp6_parser.h" // lalr1.cc:404
+#line 61 "dhcp6_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -65,8 +66,14 @@ using namespace std;
 # include <string>
 # include <vector>
 
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
 // Support move semantics when possible.
-#if defined __cplusplus && 201103L <= __cplusplus
+#if 201103L <= YY_CPLUSPLUS
 # define YY_MOVE           std::move
 # define YY_MOVE_OR_COPY   move
 # define YY_MOVE_REF(Type) Type&&
@@ -79,46 +86,66 @@ using namespace std;
 # define YY_RVREF(Type)    const Type&
 # define YY_COPY(Type)     const Type&
 #endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER6__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER6__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -131,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -156,193 +204,92 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined PARSER6_DEBUG */
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:404
+#line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 162 "dhcp6_parser.h" // lalr1.cc:404
-
-  /// A stack with random access from its top.
-  template <typename T, typename S = std::vector<T> >
-  class stack
-  {
-  public:
-    // Hide our reversed order.
-    typedef typename S::reverse_iterator iterator;
-    typedef typename S::const_reverse_iterator const_iterator;
-    typedef typename S::size_type size_type;
-
-    stack (size_type n = 200)
-      : seq_ (n)
-    {}
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (size_type i)
-    {
-      return seq_[size () - 1 - i];
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (int i)
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (size_type i) const
-    {
-      return seq_[size () - 1 - i];
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (int i) const
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Steal the contents of \a t.
-    ///
-    /// Close to move-semantics.
-    void
-    push (YY_MOVE_REF (T) t)
-    {
-      seq_.push_back (T ());
-      operator[](0).move (t);
-    }
-
-    void
-    pop (int n = 1)
-    {
-      for (; 0 < n; --n)
-        seq_.pop_back ();
-    }
-
-    void
-    clear ()
-    {
-      seq_.clear ();
-    }
-
-    size_type
-    size () const
-    {
-      return seq_.size ();
-    }
+#line 210 "dhcp6_parser.h"
 
-    const_iterator
-    begin () const
-    {
-      return seq_.rbegin ();
-    }
 
-    const_iterator
-    end () const
-    {
-      return seq_.rend ();
-    }
 
-  private:
-    stack (const stack&);
-    stack& operator= (const stack&);
-    /// The wrapped container.
-    S seq_;
-  };
 
-  /// Present a slice of the top of a stack.
-  template <typename T, typename S = stack<T> >
-  class slice
+  /// A Bison parser.
+  class Dhcp6Parser
   {
   public:
-    slice (const S& stack, int range)
-      : stack_ (stack)
-      , range_ (range)
-    {}
-
-    const T&
-    operator[] (int i) const
-    {
-      return stack_[range_ - i];
-    }
-
-  private:
-    const S& stack_;
-    int range_;
-  };
-
-
-
-  /// A char[S] buffer to store and retrieve objects.
+#ifdef PARSER6_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER6_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER6_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER6__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
 
-# if defined __cplusplus && 201103L <= __cplusplus
-    /// Instantiate a \a T in here from \a t.
-    template <typename T, typename U>
-    T&
-    emplace (U&& u)
-    {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
-      yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T (std::forward <U>(u));
-    }
-# else
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -369,75 +316,75 @@ namespace isc { namespace dhcp {
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == typeid (T));
+      PARSER6__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == typeid (T));
+      PARSER6__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
     /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type& that)
     {
-# if defined __cplusplus && 201103L <= __cplusplus
-      emplace<T> (std::move (other.as<T> ()));
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
 # else
       emplace<T> ();
-      swap<T> (other);
+      swap<T> (that);
 # endif
-      other.destroy<T> ();
+      that.destroy<T> ();
     }
 
-# if defined __cplusplus && 201103L <= __cplusplus
-    /// Move the content of \a other to this.
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type&& other)
+    move (self_type&& that)
     {
-      emplace<T> (std::move (other.as<T> ()));
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
 #endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      emplace<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -450,46 +397,31 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    variant (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class Dhcp6Parser
-  {
-  public:
-#ifndef PARSER6_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
@@ -499,6 +431,7 @@ namespace isc { namespace dhcp {
       // hr_mode
       // duid_type
       // ncr_protocol_value
+      // ncr_format_value
       // replace_client_name_value
       char dummy1[sizeof (ElementPtr)];
 
@@ -513,223 +446,857 @@ namespace isc { namespace dhcp {
 
       // "constant string"
       char dummy5[sizeof (std::string)];
-};
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof (union_type)> semantic_type;
-#else
-    typedef PARSER6_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP6 = 265,
-        TOKEN_DATA_DIRECTORY = 266,
-        TOKEN_CONFIG_CONTROL = 267,
-        TOKEN_CONFIG_DATABASES = 268,
-        TOKEN_CONFIG_FETCH_WAIT_TIME = 269,
-        TOKEN_INTERFACES_CONFIG = 270,
-        TOKEN_INTERFACES = 271,
-        TOKEN_RE_DETECT = 272,
-        TOKEN_LEASE_DATABASE = 273,
-        TOKEN_HOSTS_DATABASE = 274,
-        TOKEN_HOSTS_DATABASES = 275,
-        TOKEN_TYPE = 276,
-        TOKEN_MEMFILE = 277,
-        TOKEN_MYSQL = 278,
-        TOKEN_POSTGRESQL = 279,
-        TOKEN_CQL = 280,
-        TOKEN_USER = 281,
-        TOKEN_PASSWORD = 282,
-        TOKEN_HOST = 283,
-        TOKEN_PORT = 284,
-        TOKEN_PERSIST = 285,
-        TOKEN_LFC_INTERVAL = 286,
-        TOKEN_READONLY = 287,
-        TOKEN_CONNECT_TIMEOUT = 288,
-        TOKEN_CONTACT_POINTS = 289,
-        TOKEN_MAX_RECONNECT_TRIES = 290,
-        TOKEN_RECONNECT_WAIT_TIME = 291,
-        TOKEN_KEYSPACE = 292,
-        TOKEN_CONSISTENCY = 293,
-        TOKEN_SERIAL_CONSISTENCY = 294,
-        TOKEN_REQUEST_TIMEOUT = 295,
-        TOKEN_TCP_KEEPALIVE = 296,
-        TOKEN_TCP_NODELAY = 297,
-        TOKEN_PREFERRED_LIFETIME = 298,
-        TOKEN_VALID_LIFETIME = 299,
-        TOKEN_RENEW_TIMER = 300,
-        TOKEN_REBIND_TIMER = 301,
-        TOKEN_DECLINE_PROBATION_PERIOD = 302,
-        TOKEN_SERVER_TAG = 303,
-        TOKEN_SUBNET6 = 304,
-        TOKEN_OPTION_DEF = 305,
-        TOKEN_OPTION_DATA = 306,
-        TOKEN_NAME = 307,
-        TOKEN_DATA = 308,
-        TOKEN_CODE = 309,
-        TOKEN_SPACE = 310,
-        TOKEN_CSV_FORMAT = 311,
-        TOKEN_ALWAYS_SEND = 312,
-        TOKEN_RECORD_TYPES = 313,
-        TOKEN_ENCAPSULATE = 314,
-        TOKEN_ARRAY = 315,
-        TOKEN_POOLS = 316,
-        TOKEN_POOL = 317,
-        TOKEN_PD_POOLS = 318,
-        TOKEN_PREFIX = 319,
-        TOKEN_PREFIX_LEN = 320,
-        TOKEN_EXCLUDED_PREFIX = 321,
-        TOKEN_EXCLUDED_PREFIX_LEN = 322,
-        TOKEN_DELEGATED_LEN = 323,
-        TOKEN_USER_CONTEXT = 324,
-        TOKEN_COMMENT = 325,
-        TOKEN_SUBNET = 326,
-        TOKEN_INTERFACE = 327,
-        TOKEN_INTERFACE_ID = 328,
-        TOKEN_ID = 329,
-        TOKEN_RAPID_COMMIT = 330,
-        TOKEN_RESERVATION_MODE = 331,
-        TOKEN_DISABLED = 332,
-        TOKEN_OUT_OF_POOL = 333,
-        TOKEN_GLOBAL = 334,
-        TOKEN_ALL = 335,
-        TOKEN_SHARED_NETWORKS = 336,
-        TOKEN_MAC_SOURCES = 337,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 338,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 339,
-        TOKEN_SANITY_CHECKS = 340,
-        TOKEN_LEASE_CHECKS = 341,
-        TOKEN_CLIENT_CLASSES = 342,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 343,
-        TOKEN_TEST = 344,
-        TOKEN_ONLY_IF_REQUIRED = 345,
-        TOKEN_CLIENT_CLASS = 346,
-        TOKEN_RESERVATIONS = 347,
-        TOKEN_IP_ADDRESSES = 348,
-        TOKEN_PREFIXES = 349,
-        TOKEN_DUID = 350,
-        TOKEN_HW_ADDRESS = 351,
-        TOKEN_HOSTNAME = 352,
-        TOKEN_FLEX_ID = 353,
-        TOKEN_RELAY = 354,
-        TOKEN_IP_ADDRESS = 355,
-        TOKEN_HOOKS_LIBRARIES = 356,
-        TOKEN_LIBRARY = 357,
-        TOKEN_PARAMETERS = 358,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 359,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 360,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 361,
-        TOKEN_HOLD_RECLAIMED_TIME = 362,
-        TOKEN_MAX_RECLAIM_LEASES = 363,
-        TOKEN_MAX_RECLAIM_TIME = 364,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 365,
-        TOKEN_SERVER_ID = 366,
-        TOKEN_LLT = 367,
-        TOKEN_EN = 368,
-        TOKEN_LL = 369,
-        TOKEN_IDENTIFIER = 370,
-        TOKEN_HTYPE = 371,
-        TOKEN_TIME = 372,
-        TOKEN_ENTERPRISE_ID = 373,
-        TOKEN_DHCP4O6_PORT = 374,
-        TOKEN_CONTROL_SOCKET = 375,
-        TOKEN_SOCKET_TYPE = 376,
-        TOKEN_SOCKET_NAME = 377,
-        TOKEN_DHCP_QUEUE_CONTROL = 378,
-        TOKEN_DHCP_DDNS = 379,
-        TOKEN_ENABLE_UPDATES = 380,
-        TOKEN_QUALIFYING_SUFFIX = 381,
-        TOKEN_SERVER_IP = 382,
-        TOKEN_SERVER_PORT = 383,
-        TOKEN_SENDER_IP = 384,
-        TOKEN_SENDER_PORT = 385,
-        TOKEN_MAX_QUEUE_SIZE = 386,
-        TOKEN_NCR_PROTOCOL = 387,
-        TOKEN_NCR_FORMAT = 388,
-        TOKEN_OVERRIDE_NO_UPDATE = 389,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 390,
-        TOKEN_REPLACE_CLIENT_NAME = 391,
-        TOKEN_GENERATED_PREFIX = 392,
-        TOKEN_UDP = 393,
-        TOKEN_TCP = 394,
-        TOKEN_JSON = 395,
-        TOKEN_WHEN_PRESENT = 396,
-        TOKEN_NEVER = 397,
-        TOKEN_ALWAYS = 398,
-        TOKEN_WHEN_NOT_PRESENT = 399,
-        TOKEN_HOSTNAME_CHAR_SET = 400,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 401,
-        TOKEN_LOGGING = 402,
-        TOKEN_LOGGERS = 403,
-        TOKEN_OUTPUT_OPTIONS = 404,
-        TOKEN_OUTPUT = 405,
-        TOKEN_DEBUGLEVEL = 406,
-        TOKEN_SEVERITY = 407,
-        TOKEN_FLUSH = 408,
-        TOKEN_MAXSIZE = 409,
-        TOKEN_MAXVER = 410,
-        TOKEN_DHCP4 = 411,
-        TOKEN_DHCPDDNS = 412,
-        TOKEN_CONTROL_AGENT = 413,
-        TOKEN_TOPLEVEL_JSON = 414,
-        TOKEN_TOPLEVEL_DHCP6 = 415,
-        TOKEN_SUB_DHCP6 = 416,
-        TOKEN_SUB_INTERFACES6 = 417,
-        TOKEN_SUB_SUBNET6 = 418,
-        TOKEN_SUB_POOL6 = 419,
-        TOKEN_SUB_PD_POOL = 420,
-        TOKEN_SUB_RESERVATION = 421,
-        TOKEN_SUB_OPTION_DEFS = 422,
-        TOKEN_SUB_OPTION_DEF = 423,
-        TOKEN_SUB_OPTION_DATA = 424,
-        TOKEN_SUB_HOOKS_LIBRARY = 425,
-        TOKEN_SUB_DHCP_DDNS = 426,
-        TOKEN_SUB_LOGGING = 427,
-        TOKEN_SUB_CONFIG_CONTROL = 428,
-        TOKEN_STRING = 429,
-        TOKEN_INTEGER = 430,
-        TOKEN_FLOAT = 431,
-        TOKEN_BOOLEAN = 432
+      enum token_kind_type
+      {
+        TOKEN_PARSER6_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER6_error = 256,     // error
+    TOKEN_PARSER6_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP6 = 265,             // "Dhcp6"
+    TOKEN_DATA_DIRECTORY = 266,    // "data-directory"
+    TOKEN_CONFIG_CONTROL = 267,    // "config-control"
+    TOKEN_CONFIG_DATABASES = 268,  // "config-databases"
+    TOKEN_CONFIG_FETCH_WAIT_TIME = 269, // "config-fetch-wait-time"
+    TOKEN_INTERFACES_CONFIG = 270, // "interfaces-config"
+    TOKEN_INTERFACES = 271,        // "interfaces"
+    TOKEN_RE_DETECT = 272,         // "re-detect"
+    TOKEN_LEASE_DATABASE = 273,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 274,    // "hosts-database"
+    TOKEN_HOSTS_DATABASES = 275,   // "hosts-databases"
+    TOKEN_TYPE = 276,              // "type"
+    TOKEN_MEMFILE = 277,           // "memfile"
+    TOKEN_MYSQL = 278,             // "mysql"
+    TOKEN_POSTGRESQL = 279,        // "postgresql"
+    TOKEN_CQL = 280,               // "cql"
+    TOKEN_USER = 281,              // "user"
+    TOKEN_PASSWORD = 282,          // "password"
+    TOKEN_HOST = 283,              // "host"
+    TOKEN_PORT = 284,              // "port"
+    TOKEN_PERSIST = 285,           // "persist"
+    TOKEN_LFC_INTERVAL = 286,      // "lfc-interval"
+    TOKEN_LFC_IN_PROCESS = 287,    // "lfc-in-process"
+    TOKEN_READONLY = 288,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 289,   // "connect-timeout"
+    TOKEN_CONTACT_POINTS = 290,    // "contact-points"
+    TOKEN_MAX_RECONNECT_TRIES = 291, // "max-reconnect-tries"
+    TOKEN_RECONNECT_WAIT_TIME = 292, // "reconnect-wait-time"
+    TOKEN_KEYSPACE = 293,          // "keyspace"
+    TOKEN_CONSISTENCY = 294,       // "consistency"
+    TOKEN_SERIAL_CONSISTENCY = 295, // "serial-consistency"
+    TOKEN_REQUEST_TIMEOUT = 296,   // "request-timeout"
+    TOKEN_TCP_KEEPALIVE = 297,     // "tcp-keepalive"
+    TOKEN_TCP_NODELAY = 298,       // "tcp-nodelay"
+    TOKEN_PREFERRED_LIFETIME = 299, // "preferred-lifetime"
+    TOKEN_VALID_LIFETIME = 300,    // "valid-lifetime"
+    TOKEN_RENEW_TIMER = 301,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 302,      // "rebind-timer"
+    TOKEN_DECLINE_PROBATION_PERIOD = 303, // "decline-probation-period"
+    TOKEN_SERVER_TAG = 304,        // "server-tag"
+    TOKEN_SUBNET6 = 305,           // "subnet6"
+    TOKEN_OPTION_DEF = 306,        // "option-def"
+    TOKEN_OPTION_DATA = 307,       // "option-data"
+    TOKEN_NAME = 308,              // "name"
+    TOKEN_DATA = 309,              // "data"
+    TOKEN_CODE = 310,              // "code"
+    TOKEN_SPACE = 311,             // "space"
+    TOKEN_CSV_FORMAT = 312,        // "csv-format"
+    TOKEN_ALWAYS_SEND = 313,       // "always-send"
+    TOKEN_RECORD_TYPES = 314,      // "record-types"
+    TOKEN_ENCAPSULATE = 315,       // "encapsulate"
+    TOKEN_ARRAY = 316,             // "array"
+    TOKEN_POOLS = 317,             // "pools"
+    TOKEN_POOL = 318,              // "pool"
+    TOKEN_PD_POOLS = 319,          // "pd-pools"
+    TOKEN_PREFIX = 320,            // "prefix"
+    TOKEN_PREFIX_LEN = 321,        // "prefix-len"
+    TOKEN_EXCLUDED_PREFIX = 322,   // "excluded-prefix"
+    TOKEN_EXCLUDED_PREFIX_LEN = 323, // "excluded-prefix-len"
+    TOKEN_DELEGATED_LEN = 324,     // "delegated-len"
+    TOKEN_USER_CONTEXT = 325,      // "user-context"
+    TOKEN_COMMENT = 326,           // "comment"
+    TOKEN_SUBNET = 327,            // "subnet"
+    TOKEN_INTERFACE = 328,         // "interface"
+    TOKEN_INTERFACE_ID = 329,      // "interface-id"
+    TOKEN_ID = 330,                // "id"
+    TOKEN_RAPID_COMMIT = 331,      // "rapid-commit"
+    TOKEN_RESERVATION_MODE = 332,  // "reservation-mode"
+    TOKEN_DISABLED = 333,          // "disabled"
+    TOKEN_OUT_OF_POOL = 334,       // "out-of-pool"
+    TOKEN_GLOBAL = 335,            // "global"
+    TOKEN_ALL = 336,               // "all"
+    TOKEN_SHARED_NETWORKS = 337,   // "shared-networks"
+    TOKEN_MAC_SOURCES = 338,       // "mac-sources"
+    TOKEN_RELAY_SUPPLIED_OPTIONS = 339, // "relay-supplied-options"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 340, // "host-reservation-identifiers"
+    TOKEN_SANITY_CHECKS = 341,     // "sanity-checks"
+    TOKEN_LEASE_CHECKS = 342,      // "lease-checks"
+    TOKEN_CLIENT_CLASSES = 343,    // "client-classes"
+    TOKEN_REQUIRE_CLIENT_CLASSES = 344, // "require-client-classes"
+    TOKEN_TEST = 345,              // "test"
+    TOKEN_ONLY_IF_REQUIRED = 346,  // "only-if-required"
+    TOKEN_CLIENT_CLASS = 347,      // "client-class"
+    TOKEN_RESERVATIONS = 348,      // "reservations"
+    TOKEN_IP_ADDRESSES = 349,      // "ip-addresses"
+    TOKEN_PREFIXES = 350,          // "prefixes"
+    TOKEN_DUID = 351,              // "duid"
+    TOKEN_HW_ADDRESS = 352,        // "hw-address"
+    TOKEN_HOSTNAME = 353,          // "hostname"
+    TOKEN_FLEX_ID = 354,           // "flex-id"
+    TOKEN_RELAY = 355,             // "relay"
+    TOKEN_IP_ADDRESS = 356,        // "ip-address"
+    TOKEN_HOOKS_LIBRARIES = 357,   // "hooks-libraries"
+    TOKEN_LIBRARY = 358,           // "library"
+    TOKEN_PARAMETERS = 359,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 360, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 361, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 362, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 363, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 364, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 365,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 366, // "unwarned-reclaim-cycles"
+    TOKEN_SERVER_ID = 367,         // "server-id"
+    TOKEN_LLT = 368,               // "LLT"
+    TOKEN_EN = 369,                // "EN"
+    TOKEN_LL = 370,                // "LL"
+    TOKEN_IDENTIFIER = 371,        // "identifier"
+    TOKEN_HTYPE = 372,             // "htype"
+    TOKEN_TIME = 373,              // "time"
+    TOKEN_ENTERPRISE_ID = 374,     // "enterprise-id"
+    TOKEN_DHCP4O6_PORT = 375,      // "dhcp4o6-port"
+    TOKEN_CONTROL_SOCKET = 376,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 377,       // "socket-type"
+    TOKEN_SOCKET_NAME = 378,       // "socket-name"
+    TOKEN_CONFIG_OUTPUT_THREADS = 379, // "config-output-threads"
+    TOKEN_DHCP_QUEUE_CONTROL = 380, // "dhcp-queue-control"
+    TOKEN_DHCP_DDNS = 381,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 382,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 383, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 384,         // "server-ip"
+    TOKEN_SERVER_PORT = 385,       // "server-port"
+    TOKEN_SENDER_IP = 386,         // "sender-ip"
+    TOKEN_SENDER_PORT = 387,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 388,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 389,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 390,        // "ncr-format"
+    TOKEN_OVERRIDE_NO_UPDATE = 391, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 392, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 393, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 394,  // "generated-prefix"
+    TOKEN_UDP = 395,               // "UDP"
+    TOKEN_TCP = 396,               // "TCP"
+    TOKEN_JSON = 397,              // "JSON"
+    TOKEN_BINARY = 398,            // "BINARY"
+    TOKEN_WHEN_PRESENT = 399,      // "when-present"
+    TOKEN_NEVER = 400,             // "never"
+    TOKEN_ALWAYS = 401,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 402,  // "when-not-present"
+    TOKEN_HOSTNAME_CHAR_SET = 403, // "hostname-char-set"
+    TOKEN_HOSTNAME_CHAR_REPLACEMENT = 404, // "hostname-char-replacement"
+    TOKEN_LOGGING = 405,           // "Logging"
+    TOKEN_LOGGERS = 406,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 407,    // "output_options"
+    TOKEN_OUTPUT = 408,            // "output"
+    TOKEN_DEBUGLEVEL = 409,        // "debuglevel"
+    TOKEN_SEVERITY = 410,          // "severity"
+    TOKEN_FLUSH = 411,             // "flush"
+    TOKEN_MAXSIZE = 412,           // "maxsize"
+    TOKEN_MAXVER = 413,            // "maxver"
+    TOKEN_ASYNC = 414,             // "async"
+    TOKEN_QUEUE_SIZE = 415,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 416,   // "overflow"
+    TOKEN_DHCP4 = 417,             // "Dhcp4"
+    TOKEN_DHCPDDNS = 418,          // "DhcpDdns"
+    TOKEN_CONTROL_AGENT = 419,     // "Control-agent"
+    TOKEN_TOPLEVEL_JSON = 420,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP6 = 421,    // TOPLEVEL_DHCP6
+    TOKEN_SUB_DHCP6 = 422,         // SUB_DHCP6
+    TOKEN_SUB_INTERFACES6 = 423,   // SUB_INTERFACES6
+    TOKEN_SUB_SUBNET6 = 424,       // SUB_SUBNET6
+    TOKEN_SUB_POOL6 = 425,         // SUB_POOL6
+    TOKEN_SUB_PD_POOL = 426,       // SUB_PD_POOL
+    TOKEN_SUB_RESERVATION = 427,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEFS = 428,   // SUB_OPTION_DEFS
+    TOKEN_SUB_OPTION_DEF = 429,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 430,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 431, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 432,     // SUB_DHCP_DDNS
+    TOKEN_SUB_LOGGING = 433,       // SUB_LOGGING
+    TOKEN_SUB_CONFIG_CONTROL = 434, // SUB_CONFIG_CONTROL
+    TOKEN_STRING = 435,            // "constant string"
+    TOKEN_INTEGER = 436,           // "integer"
+    TOKEN_FLOAT = 437,             // "floating point"
+    TOKEN_BOOLEAN = 438            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 184, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP6 = 10,                            // "Dhcp6"
+        S_DATA_DIRECTORY = 11,                   // "data-directory"
+        S_CONFIG_CONTROL = 12,                   // "config-control"
+        S_CONFIG_DATABASES = 13,                 // "config-databases"
+        S_CONFIG_FETCH_WAIT_TIME = 14,           // "config-fetch-wait-time"
+        S_INTERFACES_CONFIG = 15,                // "interfaces-config"
+        S_INTERFACES = 16,                       // "interfaces"
+        S_RE_DETECT = 17,                        // "re-detect"
+        S_LEASE_DATABASE = 18,                   // "lease-database"
+        S_HOSTS_DATABASE = 19,                   // "hosts-database"
+        S_HOSTS_DATABASES = 20,                  // "hosts-databases"
+        S_TYPE = 21,                             // "type"
+        S_MEMFILE = 22,                          // "memfile"
+        S_MYSQL = 23,                            // "mysql"
+        S_POSTGRESQL = 24,                       // "postgresql"
+        S_CQL = 25,                              // "cql"
+        S_USER = 26,                             // "user"
+        S_PASSWORD = 27,                         // "password"
+        S_HOST = 28,                             // "host"
+        S_PORT = 29,                             // "port"
+        S_PERSIST = 30,                          // "persist"
+        S_LFC_INTERVAL = 31,                     // "lfc-interval"
+        S_LFC_IN_PROCESS = 32,                   // "lfc-in-process"
+        S_READONLY = 33,                         // "readonly"
+        S_CONNECT_TIMEOUT = 34,                  // "connect-timeout"
+        S_CONTACT_POINTS = 35,                   // "contact-points"
+        S_MAX_RECONNECT_TRIES = 36,              // "max-reconnect-tries"
+        S_RECONNECT_WAIT_TIME = 37,              // "reconnect-wait-time"
+        S_KEYSPACE = 38,                         // "keyspace"
+        S_CONSISTENCY = 39,                      // "consistency"
+        S_SERIAL_CONSISTENCY = 40,               // "serial-consistency"
+        S_REQUEST_TIMEOUT = 41,                  // "request-timeout"
+        S_TCP_KEEPALIVE = 42,                    // "tcp-keepalive"
+        S_TCP_NODELAY = 43,                      // "tcp-nodelay"
+        S_PREFERRED_LIFETIME = 44,               // "preferred-lifetime"
+        S_VALID_LIFETIME = 45,                   // "valid-lifetime"
+        S_RENEW_TIMER = 46,                      // "renew-timer"
+        S_REBIND_TIMER = 47,                     // "rebind-timer"
+        S_DECLINE_PROBATION_PERIOD = 48,         // "decline-probation-period"
+        S_SERVER_TAG = 49,                       // "server-tag"
+        S_SUBNET6 = 50,                          // "subnet6"
+        S_OPTION_DEF = 51,                       // "option-def"
+        S_OPTION_DATA = 52,                      // "option-data"
+        S_NAME = 53,                             // "name"
+        S_DATA = 54,                             // "data"
+        S_CODE = 55,                             // "code"
+        S_SPACE = 56,                            // "space"
+        S_CSV_FORMAT = 57,                       // "csv-format"
+        S_ALWAYS_SEND = 58,                      // "always-send"
+        S_RECORD_TYPES = 59,                     // "record-types"
+        S_ENCAPSULATE = 60,                      // "encapsulate"
+        S_ARRAY = 61,                            // "array"
+        S_POOLS = 62,                            // "pools"
+        S_POOL = 63,                             // "pool"
+        S_PD_POOLS = 64,                         // "pd-pools"
+        S_PREFIX = 65,                           // "prefix"
+        S_PREFIX_LEN = 66,                       // "prefix-len"
+        S_EXCLUDED_PREFIX = 67,                  // "excluded-prefix"
+        S_EXCLUDED_PREFIX_LEN = 68,              // "excluded-prefix-len"
+        S_DELEGATED_LEN = 69,                    // "delegated-len"
+        S_USER_CONTEXT = 70,                     // "user-context"
+        S_COMMENT = 71,                          // "comment"
+        S_SUBNET = 72,                           // "subnet"
+        S_INTERFACE = 73,                        // "interface"
+        S_INTERFACE_ID = 74,                     // "interface-id"
+        S_ID = 75,                               // "id"
+        S_RAPID_COMMIT = 76,                     // "rapid-commit"
+        S_RESERVATION_MODE = 77,                 // "reservation-mode"
+        S_DISABLED = 78,                         // "disabled"
+        S_OUT_OF_POOL = 79,                      // "out-of-pool"
+        S_GLOBAL = 80,                           // "global"
+        S_ALL = 81,                              // "all"
+        S_SHARED_NETWORKS = 82,                  // "shared-networks"
+        S_MAC_SOURCES = 83,                      // "mac-sources"
+        S_RELAY_SUPPLIED_OPTIONS = 84,           // "relay-supplied-options"
+        S_HOST_RESERVATION_IDENTIFIERS = 85,     // "host-reservation-identifiers"
+        S_SANITY_CHECKS = 86,                    // "sanity-checks"
+        S_LEASE_CHECKS = 87,                     // "lease-checks"
+        S_CLIENT_CLASSES = 88,                   // "client-classes"
+        S_REQUIRE_CLIENT_CLASSES = 89,           // "require-client-classes"
+        S_TEST = 90,                             // "test"
+        S_ONLY_IF_REQUIRED = 91,                 // "only-if-required"
+        S_CLIENT_CLASS = 92,                     // "client-class"
+        S_RESERVATIONS = 93,                     // "reservations"
+        S_IP_ADDRESSES = 94,                     // "ip-addresses"
+        S_PREFIXES = 95,                         // "prefixes"
+        S_DUID = 96,                             // "duid"
+        S_HW_ADDRESS = 97,                       // "hw-address"
+        S_HOSTNAME = 98,                         // "hostname"
+        S_FLEX_ID = 99,                          // "flex-id"
+        S_RELAY = 100,                           // "relay"
+        S_IP_ADDRESS = 101,                      // "ip-address"
+        S_HOOKS_LIBRARIES = 102,                 // "hooks-libraries"
+        S_LIBRARY = 103,                         // "library"
+        S_PARAMETERS = 104,                      // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 105,       // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 106,         // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 107, // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 108,             // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 109,              // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 110,                // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 111,         // "unwarned-reclaim-cycles"
+        S_SERVER_ID = 112,                       // "server-id"
+        S_LLT = 113,                             // "LLT"
+        S_EN = 114,                              // "EN"
+        S_LL = 115,                              // "LL"
+        S_IDENTIFIER = 116,                      // "identifier"
+        S_HTYPE = 117,                           // "htype"
+        S_TIME = 118,                            // "time"
+        S_ENTERPRISE_ID = 119,                   // "enterprise-id"
+        S_DHCP4O6_PORT = 120,                    // "dhcp4o6-port"
+        S_CONTROL_SOCKET = 121,                  // "control-socket"
+        S_SOCKET_TYPE = 122,                     // "socket-type"
+        S_SOCKET_NAME = 123,                     // "socket-name"
+        S_CONFIG_OUTPUT_THREADS = 124,           // "config-output-threads"
+        S_DHCP_QUEUE_CONTROL = 125,              // "dhcp-queue-control"
+        S_DHCP_DDNS = 126,                       // "dhcp-ddns"
+        S_ENABLE_UPDATES = 127,                  // "enable-updates"
+        S_QUALIFYING_SUFFIX = 128,               // "qualifying-suffix"
+        S_SERVER_IP = 129,                       // "server-ip"
+        S_SERVER_PORT = 130,                     // "server-port"
+        S_SENDER_IP = 131,                       // "sender-ip"
+        S_SENDER_PORT = 132,                     // "sender-port"
+        S_MAX_QUEUE_SIZE = 133,                  // "max-queue-size"
+        S_NCR_PROTOCOL = 134,                    // "ncr-protocol"
+        S_NCR_FORMAT = 135,                      // "ncr-format"
+        S_OVERRIDE_NO_UPDATE = 136,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 137,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 138,             // "replace-client-name"
+        S_GENERATED_PREFIX = 139,                // "generated-prefix"
+        S_UDP = 140,                             // "UDP"
+        S_TCP = 141,                             // "TCP"
+        S_JSON = 142,                            // "JSON"
+        S_BINARY = 143,                          // "BINARY"
+        S_WHEN_PRESENT = 144,                    // "when-present"
+        S_NEVER = 145,                           // "never"
+        S_ALWAYS = 146,                          // "always"
+        S_WHEN_NOT_PRESENT = 147,                // "when-not-present"
+        S_HOSTNAME_CHAR_SET = 148,               // "hostname-char-set"
+        S_HOSTNAME_CHAR_REPLACEMENT = 149,       // "hostname-char-replacement"
+        S_LOGGING = 150,                         // "Logging"
+        S_LOGGERS = 151,                         // "loggers"
+        S_OUTPUT_OPTIONS = 152,                  // "output_options"
+        S_OUTPUT = 153,                          // "output"
+        S_DEBUGLEVEL = 154,                      // "debuglevel"
+        S_SEVERITY = 155,                        // "severity"
+        S_FLUSH = 156,                           // "flush"
+        S_MAXSIZE = 157,                         // "maxsize"
+        S_MAXVER = 158,                          // "maxver"
+        S_ASYNC = 159,                           // "async"
+        S_QUEUE_SIZE = 160,                      // "queue-size"
+        S_OVERFLOW_POLICY = 161,                 // "overflow"
+        S_DHCP4 = 162,                           // "Dhcp4"
+        S_DHCPDDNS = 163,                        // "DhcpDdns"
+        S_CONTROL_AGENT = 164,                   // "Control-agent"
+        S_TOPLEVEL_JSON = 165,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP6 = 166,                  // TOPLEVEL_DHCP6
+        S_SUB_DHCP6 = 167,                       // SUB_DHCP6
+        S_SUB_INTERFACES6 = 168,                 // SUB_INTERFACES6
+        S_SUB_SUBNET6 = 169,                     // SUB_SUBNET6
+        S_SUB_POOL6 = 170,                       // SUB_POOL6
+        S_SUB_PD_POOL = 171,                     // SUB_PD_POOL
+        S_SUB_RESERVATION = 172,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEFS = 173,                 // SUB_OPTION_DEFS
+        S_SUB_OPTION_DEF = 174,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 175,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 176,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 177,                   // SUB_DHCP_DDNS
+        S_SUB_LOGGING = 178,                     // SUB_LOGGING
+        S_SUB_CONFIG_CONTROL = 179,              // SUB_CONFIG_CONTROL
+        S_STRING = 180,                          // "constant string"
+        S_INTEGER = 181,                         // "integer"
+        S_FLOAT = 182,                           // "floating point"
+        S_BOOLEAN = 183,                         // "boolean"
+        S_YYACCEPT = 184,                        // $accept
+        S_start = 185,                           // start
+        S_186_1 = 186,                           // $@1
+        S_187_2 = 187,                           // $@2
+        S_188_3 = 188,                           // $@3
+        S_189_4 = 189,                           // $@4
+        S_190_5 = 190,                           // $@5
+        S_191_6 = 191,                           // $@6
+        S_192_7 = 192,                           // $@7
+        S_193_8 = 193,                           // $@8
+        S_194_9 = 194,                           // $@9
+        S_195_10 = 195,                          // $@10
+        S_196_11 = 196,                          // $@11
+        S_197_12 = 197,                          // $@12
+        S_198_13 = 198,                          // $@13
+        S_199_14 = 199,                          // $@14
+        S_200_15 = 200,                          // $@15
+        S_value = 201,                           // value
+        S_sub_json = 202,                        // sub_json
+        S_map2 = 203,                            // map2
+        S_204_16 = 204,                          // $@16
+        S_map_value = 205,                       // map_value
+        S_map_content = 206,                     // map_content
+        S_not_empty_map = 207,                   // not_empty_map
+        S_list_generic = 208,                    // list_generic
+        S_209_17 = 209,                          // $@17
+        S_list_content = 210,                    // list_content
+        S_not_empty_list = 211,                  // not_empty_list
+        S_list_strings = 212,                    // list_strings
+        S_213_18 = 213,                          // $@18
+        S_list_strings_content = 214,            // list_strings_content
+        S_not_empty_list_strings = 215,          // not_empty_list_strings
+        S_unknown_map_entry = 216,               // unknown_map_entry
+        S_syntax_map = 217,                      // syntax_map
+        S_218_19 = 218,                          // $@19
+        S_global_objects = 219,                  // global_objects
+        S_global_object = 220,                   // global_object
+        S_dhcp6_object = 221,                    // dhcp6_object
+        S_222_20 = 222,                          // $@20
+        S_sub_dhcp6 = 223,                       // sub_dhcp6
+        S_224_21 = 224,                          // $@21
+        S_global_params = 225,                   // global_params
+        S_global_param = 226,                    // global_param
+        S_data_directory = 227,                  // data_directory
+        S_228_22 = 228,                          // $@22
+        S_preferred_lifetime = 229,              // preferred_lifetime
+        S_valid_lifetime = 230,                  // valid_lifetime
+        S_renew_timer = 231,                     // renew_timer
+        S_rebind_timer = 232,                    // rebind_timer
+        S_decline_probation_period = 233,        // decline_probation_period
+        S_server_tag = 234,                      // server_tag
+        S_235_23 = 235,                          // $@23
+        S_interfaces_config = 236,               // interfaces_config
+        S_237_24 = 237,                          // $@24
+        S_sub_interfaces6 = 238,                 // sub_interfaces6
+        S_239_25 = 239,                          // $@25
+        S_interfaces_config_params = 240,        // interfaces_config_params
+        S_interfaces_config_param = 241,         // interfaces_config_param
+        S_interfaces_list = 242,                 // interfaces_list
+        S_243_26 = 243,                          // $@26
+        S_re_detect = 244,                       // re_detect
+        S_lease_database = 245,                  // lease_database
+        S_246_27 = 246,                          // $@27
+        S_hosts_database = 247,                  // hosts_database
+        S_248_28 = 248,                          // $@28
+        S_hosts_databases = 249,                 // hosts_databases
+        S_250_29 = 250,                          // $@29
+        S_database_list = 251,                   // database_list
+        S_not_empty_database_list = 252,         // not_empty_database_list
+        S_database = 253,                        // database
+        S_254_30 = 254,                          // $@30
+        S_database_map_params = 255,             // database_map_params
+        S_database_map_param = 256,              // database_map_param
+        S_database_type = 257,                   // database_type
+        S_258_31 = 258,                          // $@31
+        S_db_type = 259,                         // db_type
+        S_user = 260,                            // user
+        S_261_32 = 261,                          // $@32
+        S_password = 262,                        // password
+        S_263_33 = 263,                          // $@33
+        S_host = 264,                            // host
+        S_265_34 = 265,                          // $@34
+        S_port = 266,                            // port
+        S_name = 267,                            // name
+        S_268_35 = 268,                          // $@35
+        S_persist = 269,                         // persist
+        S_lfc_interval = 270,                    // lfc_interval
+        S_lfc_in_process = 271,                  // lfc_in_process
+        S_readonly = 272,                        // readonly
+        S_connect_timeout = 273,                 // connect_timeout
+        S_reconnect_wait_time = 274,             // reconnect_wait_time
+        S_request_timeout = 275,                 // request_timeout
+        S_tcp_keepalive = 276,                   // tcp_keepalive
+        S_tcp_nodelay = 277,                     // tcp_nodelay
+        S_contact_points = 278,                  // contact_points
+        S_279_36 = 279,                          // $@36
+        S_max_reconnect_tries = 280,             // max_reconnect_tries
+        S_keyspace = 281,                        // keyspace
+        S_282_37 = 282,                          // $@37
+        S_consistency = 283,                     // consistency
+        S_284_38 = 284,                          // $@38
+        S_serial_consistency = 285,              // serial_consistency
+        S_286_39 = 286,                          // $@39
+        S_sanity_checks = 287,                   // sanity_checks
+        S_288_40 = 288,                          // $@40
+        S_sanity_checks_params = 289,            // sanity_checks_params
+        S_sanity_checks_param = 290,             // sanity_checks_param
+        S_lease_checks = 291,                    // lease_checks
+        S_292_41 = 292,                          // $@41
+        S_mac_sources = 293,                     // mac_sources
+        S_294_42 = 294,                          // $@42
+        S_mac_sources_list = 295,                // mac_sources_list
+        S_mac_sources_value = 296,               // mac_sources_value
+        S_duid_id = 297,                         // duid_id
+        S_string_id = 298,                       // string_id
+        S_host_reservation_identifiers = 299,    // host_reservation_identifiers
+        S_300_43 = 300,                          // $@43
+        S_host_reservation_identifiers_list = 301, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 302,     // host_reservation_identifier
+        S_hw_address_id = 303,                   // hw_address_id
+        S_flex_id = 304,                         // flex_id
+        S_relay_supplied_options = 305,          // relay_supplied_options
+        S_306_44 = 306,                          // $@44
+        S_hooks_libraries = 307,                 // hooks_libraries
+        S_308_45 = 308,                          // $@45
+        S_hooks_libraries_list = 309,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 310,  // not_empty_hooks_libraries_list
+        S_hooks_library = 311,                   // hooks_library
+        S_312_46 = 312,                          // $@46
+        S_sub_hooks_library = 313,               // sub_hooks_library
+        S_314_47 = 314,                          // $@47
+        S_hooks_params = 315,                    // hooks_params
+        S_hooks_param = 316,                     // hooks_param
+        S_library = 317,                         // library
+        S_318_48 = 318,                          // $@48
+        S_parameters = 319,                      // parameters
+        S_320_49 = 320,                          // $@49
+        S_expired_leases_processing = 321,       // expired_leases_processing
+        S_322_50 = 322,                          // $@50
+        S_expired_leases_params = 323,           // expired_leases_params
+        S_expired_leases_param = 324,            // expired_leases_param
+        S_reclaim_timer_wait_time = 325,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 326, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 327,             // hold_reclaimed_time
+        S_max_reclaim_leases = 328,              // max_reclaim_leases
+        S_max_reclaim_time = 329,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 330,         // unwarned_reclaim_cycles
+        S_subnet6_list = 331,                    // subnet6_list
+        S_332_51 = 332,                          // $@51
+        S_subnet6_list_content = 333,            // subnet6_list_content
+        S_not_empty_subnet6_list = 334,          // not_empty_subnet6_list
+        S_subnet6 = 335,                         // subnet6
+        S_336_52 = 336,                          // $@52
+        S_sub_subnet6 = 337,                     // sub_subnet6
+        S_338_53 = 338,                          // $@53
+        S_subnet6_params = 339,                  // subnet6_params
+        S_subnet6_param = 340,                   // subnet6_param
+        S_subnet = 341,                          // subnet
+        S_342_54 = 342,                          // $@54
+        S_interface = 343,                       // interface
+        S_344_55 = 344,                          // $@55
+        S_interface_id = 345,                    // interface_id
+        S_346_56 = 346,                          // $@56
+        S_client_class = 347,                    // client_class
+        S_348_57 = 348,                          // $@57
+        S_require_client_classes = 349,          // require_client_classes
+        S_350_58 = 350,                          // $@58
+        S_reservation_mode = 351,                // reservation_mode
+        S_352_59 = 352,                          // $@59
+        S_hr_mode = 353,                         // hr_mode
+        S_id = 354,                              // id
+        S_rapid_commit = 355,                    // rapid_commit
+        S_shared_networks = 356,                 // shared_networks
+        S_357_60 = 357,                          // $@60
+        S_shared_networks_content = 358,         // shared_networks_content
+        S_shared_networks_list = 359,            // shared_networks_list
+        S_shared_network = 360,                  // shared_network
+        S_361_61 = 361,                          // $@61
+        S_shared_network_params = 362,           // shared_network_params
+        S_shared_network_param = 363,            // shared_network_param
+        S_option_def_list = 364,                 // option_def_list
+        S_365_62 = 365,                          // $@62
+        S_sub_option_def_list = 366,             // sub_option_def_list
+        S_367_63 = 367,                          // $@63
+        S_option_def_list_content = 368,         // option_def_list_content
+        S_not_empty_option_def_list = 369,       // not_empty_option_def_list
+        S_option_def_entry = 370,                // option_def_entry
+        S_371_64 = 371,                          // $@64
+        S_sub_option_def = 372,                  // sub_option_def
+        S_373_65 = 373,                          // $@65
+        S_option_def_params = 374,               // option_def_params
+        S_not_empty_option_def_params = 375,     // not_empty_option_def_params
+        S_option_def_param = 376,                // option_def_param
+        S_option_def_name = 377,                 // option_def_name
+        S_code = 378,                            // code
+        S_option_def_code = 379,                 // option_def_code
+        S_option_def_type = 380,                 // option_def_type
+        S_381_66 = 381,                          // $@66
+        S_option_def_record_types = 382,         // option_def_record_types
+        S_383_67 = 383,                          // $@67
+        S_space = 384,                           // space
+        S_385_68 = 385,                          // $@68
+        S_option_def_space = 386,                // option_def_space
+        S_option_def_encapsulate = 387,          // option_def_encapsulate
+        S_388_69 = 388,                          // $@69
+        S_option_def_array = 389,                // option_def_array
+        S_option_data_list = 390,                // option_data_list
+        S_391_70 = 391,                          // $@70
+        S_option_data_list_content = 392,        // option_data_list_content
+        S_not_empty_option_data_list = 393,      // not_empty_option_data_list
+        S_option_data_entry = 394,               // option_data_entry
+        S_395_71 = 395,                          // $@71
+        S_sub_option_data = 396,                 // sub_option_data
+        S_397_72 = 397,                          // $@72
+        S_option_data_params = 398,              // option_data_params
+        S_not_empty_option_data_params = 399,    // not_empty_option_data_params
+        S_option_data_param = 400,               // option_data_param
+        S_option_data_name = 401,                // option_data_name
+        S_option_data_data = 402,                // option_data_data
+        S_403_73 = 403,                          // $@73
+        S_option_data_code = 404,                // option_data_code
+        S_option_data_space = 405,               // option_data_space
+        S_option_data_csv_format = 406,          // option_data_csv_format
+        S_option_data_always_send = 407,         // option_data_always_send
+        S_pools_list = 408,                      // pools_list
+        S_409_74 = 409,                          // $@74
+        S_pools_list_content = 410,              // pools_list_content
+        S_not_empty_pools_list = 411,            // not_empty_pools_list
+        S_pool_list_entry = 412,                 // pool_list_entry
+        S_413_75 = 413,                          // $@75
+        S_sub_pool6 = 414,                       // sub_pool6
+        S_415_76 = 415,                          // $@76
+        S_pool_params = 416,                     // pool_params
+        S_pool_param = 417,                      // pool_param
+        S_pool_entry = 418,                      // pool_entry
+        S_419_77 = 419,                          // $@77
+        S_user_context = 420,                    // user_context
+        S_421_78 = 421,                          // $@78
+        S_comment = 422,                         // comment
+        S_423_79 = 423,                          // $@79
+        S_pd_pools_list = 424,                   // pd_pools_list
+        S_425_80 = 425,                          // $@80
+        S_pd_pools_list_content = 426,           // pd_pools_list_content
+        S_not_empty_pd_pools_list = 427,         // not_empty_pd_pools_list
+        S_pd_pool_entry = 428,                   // pd_pool_entry
+        S_429_81 = 429,                          // $@81
+        S_sub_pd_pool = 430,                     // sub_pd_pool
+        S_431_82 = 431,                          // $@82
+        S_pd_pool_params = 432,                  // pd_pool_params
+        S_pd_pool_param = 433,                   // pd_pool_param
+        S_pd_prefix = 434,                       // pd_prefix
+        S_435_83 = 435,                          // $@83
+        S_pd_prefix_len = 436,                   // pd_prefix_len
+        S_excluded_prefix = 437,                 // excluded_prefix
+        S_438_84 = 438,                          // $@84
+        S_excluded_prefix_len = 439,             // excluded_prefix_len
+        S_pd_delegated_len = 440,                // pd_delegated_len
+        S_reservations = 441,                    // reservations
+        S_442_85 = 442,                          // $@85
+        S_reservations_list = 443,               // reservations_list
+        S_not_empty_reservations_list = 444,     // not_empty_reservations_list
+        S_reservation = 445,                     // reservation
+        S_446_86 = 446,                          // $@86
+        S_sub_reservation = 447,                 // sub_reservation
+        S_448_87 = 448,                          // $@87
+        S_reservation_params = 449,              // reservation_params
+        S_not_empty_reservation_params = 450,    // not_empty_reservation_params
+        S_reservation_param = 451,               // reservation_param
+        S_ip_addresses = 452,                    // ip_addresses
+        S_453_88 = 453,                          // $@88
+        S_prefixes = 454,                        // prefixes
+        S_455_89 = 455,                          // $@89
+        S_duid = 456,                            // duid
+        S_457_90 = 457,                          // $@90
+        S_hw_address = 458,                      // hw_address
+        S_459_91 = 459,                          // $@91
+        S_hostname = 460,                        // hostname
+        S_461_92 = 461,                          // $@92
+        S_flex_id_value = 462,                   // flex_id_value
+        S_463_93 = 463,                          // $@93
+        S_reservation_client_classes = 464,      // reservation_client_classes
+        S_465_94 = 465,                          // $@94
+        S_relay = 466,                           // relay
+        S_467_95 = 467,                          // $@95
+        S_relay_map = 468,                       // relay_map
+        S_ip_address = 469,                      // ip_address
+        S_470_96 = 470,                          // $@96
+        S_client_classes = 471,                  // client_classes
+        S_472_97 = 472,                          // $@97
+        S_client_classes_list = 473,             // client_classes_list
+        S_client_class_entry = 474,              // client_class_entry
+        S_475_98 = 475,                          // $@98
+        S_client_class_params = 476,             // client_class_params
+        S_not_empty_client_class_params = 477,   // not_empty_client_class_params
+        S_client_class_param = 478,              // client_class_param
+        S_client_class_name = 479,               // client_class_name
+        S_client_class_test = 480,               // client_class_test
+        S_481_99 = 481,                          // $@99
+        S_only_if_required = 482,                // only_if_required
+        S_server_id = 483,                       // server_id
+        S_484_100 = 484,                         // $@100
+        S_server_id_params = 485,                // server_id_params
+        S_server_id_param = 486,                 // server_id_param
+        S_server_id_type = 487,                  // server_id_type
+        S_488_101 = 488,                         // $@101
+        S_duid_type = 489,                       // duid_type
+        S_htype = 490,                           // htype
+        S_identifier = 491,                      // identifier
+        S_492_102 = 492,                         // $@102
+        S_time = 493,                            // time
+        S_enterprise_id = 494,                   // enterprise_id
+        S_dhcp4o6_port = 495,                    // dhcp4o6_port
+        S_control_socket = 496,                  // control_socket
+        S_497_103 = 497,                         // $@103
+        S_control_socket_params = 498,           // control_socket_params
+        S_control_socket_param = 499,            // control_socket_param
+        S_socket_type = 500,                     // socket_type
+        S_501_104 = 501,                         // $@104
+        S_socket_name = 502,                     // socket_name
+        S_503_105 = 503,                         // $@105
+        S_config_output_threads = 504,           // config_output_threads
+        S_dhcp_queue_control = 505,              // dhcp_queue_control
+        S_506_106 = 506,                         // $@106
+        S_dhcp_ddns = 507,                       // dhcp_ddns
+        S_508_107 = 508,                         // $@107
+        S_sub_dhcp_ddns = 509,                   // sub_dhcp_ddns
+        S_510_108 = 510,                         // $@108
+        S_dhcp_ddns_params = 511,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 512,                 // dhcp_ddns_param
+        S_enable_updates = 513,                  // enable_updates
+        S_qualifying_suffix = 514,               // qualifying_suffix
+        S_515_109 = 515,                         // $@109
+        S_server_ip = 516,                       // server_ip
+        S_517_110 = 517,                         // $@110
+        S_server_port = 518,                     // server_port
+        S_sender_ip = 519,                       // sender_ip
+        S_520_111 = 520,                         // $@111
+        S_sender_port = 521,                     // sender_port
+        S_max_queue_size = 522,                  // max_queue_size
+        S_ncr_protocol = 523,                    // ncr_protocol
+        S_524_112 = 524,                         // $@112
+        S_ncr_protocol_value = 525,              // ncr_protocol_value
+        S_ncr_format = 526,                      // ncr_format
+        S_527_113 = 527,                         // $@113
+        S_ncr_format_value = 528,                // ncr_format_value
+        S_override_no_update = 529,              // override_no_update
+        S_override_client_update = 530,          // override_client_update
+        S_replace_client_name = 531,             // replace_client_name
+        S_532_114 = 532,                         // $@114
+        S_replace_client_name_value = 533,       // replace_client_name_value
+        S_generated_prefix = 534,                // generated_prefix
+        S_535_115 = 535,                         // $@115
+        S_hostname_char_set = 536,               // hostname_char_set
+        S_537_116 = 537,                         // $@116
+        S_hostname_char_replacement = 538,       // hostname_char_replacement
+        S_539_117 = 539,                         // $@117
+        S_dhcp4_json_object = 540,               // dhcp4_json_object
+        S_541_118 = 541,                         // $@118
+        S_dhcpddns_json_object = 542,            // dhcpddns_json_object
+        S_543_119 = 543,                         // $@119
+        S_control_agent_json_object = 544,       // control_agent_json_object
+        S_545_120 = 545,                         // $@120
+        S_config_control = 546,                  // config_control
+        S_547_121 = 547,                         // $@121
+        S_sub_config_control = 548,              // sub_config_control
+        S_549_122 = 549,                         // $@122
+        S_config_control_params = 550,           // config_control_params
+        S_config_control_param = 551,            // config_control_param
+        S_config_databases = 552,                // config_databases
+        S_553_123 = 553,                         // $@123
+        S_config_fetch_wait_time = 554,          // config_fetch_wait_time
+        S_logging_object = 555,                  // logging_object
+        S_556_124 = 556,                         // $@124
+        S_sub_logging = 557,                     // sub_logging
+        S_558_125 = 558,                         // $@125
+        S_logging_params = 559,                  // logging_params
+        S_logging_param = 560,                   // logging_param
+        S_loggers = 561,                         // loggers
+        S_562_126 = 562,                         // $@126
+        S_loggers_entries = 563,                 // loggers_entries
+        S_logger_entry = 564,                    // logger_entry
+        S_565_127 = 565,                         // $@127
+        S_logger_params = 566,                   // logger_params
+        S_logger_param = 567,                    // logger_param
+        S_debuglevel = 568,                      // debuglevel
+        S_severity = 569,                        // severity
+        S_570_128 = 570,                         // $@128
+        S_output_options_list = 571,             // output_options_list
+        S_572_129 = 572,                         // $@129
+        S_output_options_list_content = 573,     // output_options_list_content
+        S_output_entry = 574,                    // output_entry
+        S_575_130 = 575,                         // $@130
+        S_output_params_list = 576,              // output_params_list
+        S_output_params = 577,                   // output_params
+        S_output = 578,                          // output
+        S_579_131 = 579,                         // $@131
+        S_flush = 580,                           // flush
+        S_maxsize = 581,                         // maxsize
+        S_maxver = 582,                          // maxver
+        S_async = 583,                           // async
+        S_queue_size = 584,                      // queue_size
+        S_overflow = 585,                        // overflow
+        S_586_132 = 586                          // $@132
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -739,87 +1306,353 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
 
-      /// Move or copy constructor.
-      basic_symbol (YY_RVREF (basic_symbol) other);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
 
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
-      basic_symbol (typename Base::kind_type t, YY_RVREF (location_type) l);
-      basic_symbol (typename Base::kind_type t, YY_RVREF (ElementPtr) v, YY_RVREF (location_type) l);
-      basic_symbol (typename Base::kind_type t, YY_RVREF (bool) v, YY_RVREF (location_type) l);
-      basic_symbol (typename Base::kind_type t, YY_RVREF (double) v, YY_RVREF (location_type) l);
-      basic_symbol (typename Base::kind_type t, YY_RVREF (int64_t) v, YY_RVREF (location_type) l);
-      basic_symbol (typename Base::kind_type t, YY_RVREF (std::string) v, YY_RVREF (location_type) l);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
+#endif
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp6Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
 
     private:
-#if !defined __cplusplus || __cplusplus < 201103L
+#if YY_CPLUSPLUS < 201103L
       /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
+      basic_symbol& operator= (const basic_symbol& that);
 #endif
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER6_error <= tok && tok <= token::TOKEN_SUB_CONFIG_CONTROL));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
     /// Build a parser object.
     Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg);
     virtual ~Dhcp6Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp6Parser (const Dhcp6Parser&) = delete;
+    /// Non copyable.
+    Dhcp6Parser& operator= (const Dhcp6Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -850,2479 +1683,3340 @@ namespace isc { namespace dhcp {
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Symbol constructors declarations.
-    static
-    symbol_type
-    make_END (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COMMA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COLON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LSQUARE_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RSQUARE_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LCURLY_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RCURLY_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NULL_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DATA_DIRECTORY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONFIG_CONTROL (YY_COPY (location_type) l);
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
 
-    static
-    symbol_type
-    make_CONFIG_DATABASES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONFIG_FETCH_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACES_CONFIG (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RE_DETECT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LEASE_DATABASE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTS_DATABASE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTS_DATABASES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MEMFILE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MYSQL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_POSTGRESQL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CQL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_USER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PASSWORD (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOST (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PERSIST (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LFC_INTERVAL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_READONLY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONNECT_TIMEOUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTACT_POINTS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_RECONNECT_TRIES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RECONNECT_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_KEYSPACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONSISTENCY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERIAL_CONSISTENCY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REQUEST_TIMEOUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TCP_KEEPALIVE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TCP_NODELAY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PREFERRED_LIFETIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_VALID_LIFETIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RENEW_TIMER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REBIND_TIMER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DECLINE_PROBATION_PERIOD (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_TAG (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OPTION_DEF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OPTION_DATA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DATA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CODE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SPACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CSV_FORMAT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ALWAYS_SEND (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RECORD_TYPES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ENCAPSULATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ARRAY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_POOLS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_POOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PD_POOLS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PREFIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PREFIX_LEN (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_EXCLUDED_PREFIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_EXCLUDED_PREFIX_LEN (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DELEGATED_LEN (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_USER_CONTEXT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COMMENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACE_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RAPID_COMMIT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RESERVATION_MODE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DISABLED (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUT_OF_POOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_GLOBAL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ALL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SHARED_NETWORKS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAC_SOURCES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RELAY_SUPPLIED_OPTIONS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOST_RESERVATION_IDENTIFIERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SANITY_CHECKS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LEASE_CHECKS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CLIENT_CLASSES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REQUIRE_CLIENT_CLASSES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TEST (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ONLY_IF_REQUIRED (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CLIENT_CLASS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RESERVATIONS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_IP_ADDRESSES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PREFIXES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DUID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HW_ADDRESS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTNAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLEX_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RELAY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_IP_ADDRESS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOOKS_LIBRARIES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LIBRARY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PARAMETERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_EXPIRED_LEASES_PROCESSING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RECLAIM_TIMER_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOLD_RECLAIMED_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_RECLAIM_LEASES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_RECLAIM_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_UNWARNED_RECLAIM_CYCLES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LLT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_EN (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_IDENTIFIER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HTYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ENTERPRISE_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP4O6_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTROL_SOCKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP_QUEUE_CONTROL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP_DDNS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ENABLE_UPDATES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_QUALIFYING_SUFFIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_IP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SENDER_IP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SENDER_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_QUEUE_SIZE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NCR_PROTOCOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NCR_FORMAT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OVERRIDE_NO_UPDATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OVERRIDE_CLIENT_UPDATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REPLACE_CLIENT_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_GENERATED_PREFIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_UDP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TCP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_JSON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_WHEN_PRESENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NEVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ALWAYS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_WHEN_NOT_PRESENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTNAME_CHAR_SET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTNAME_CHAR_REPLACEMENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LOGGING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LOGGERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTPUT_OPTIONS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTPUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DEBUGLEVEL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SEVERITY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLUSH (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAXSIZE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAXVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCPDDNS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTROL_AGENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TOPLEVEL_JSON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TOPLEVEL_DHCP6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_DHCP6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_INTERFACES6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_SUBNET6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_POOL6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_PD_POOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_RESERVATION (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_OPTION_DEFS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_OPTION_DEF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_OPTION_DATA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_HOOKS_LIBRARY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_DHCP_DDNS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_LOGGING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_CONFIG_CONTROL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_STRING (YY_COPY (std::string) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTEGER (YY_COPY (int64_t) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLOAT (YY_COPY (double) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_BOOLEAN (YY_COPY (bool) v, YY_COPY (location_type) l);
-
-
-
-  private:
-    /// This class is not copyable.
-    Dhcp6Parser (const Dhcp6Parser&);
-    Dhcp6Parser& operator= (const Dhcp6Parser&);
-
-    /// State numbers.
-    typedef int state_type;
-
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
-
-    /// Compute post-reduction state.
-    /// \param yystate   the current state
-    /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
-
-    /// Whether the given \c yypact_ value indicates a defaulted state.
-    /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
-
-    /// Whether the given \c yytable_ value indicates a syntax error.
-    /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
-
-    static const short yypact_ninf_;
-    static const signed char yytable_ninf_;
-
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
-
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
-
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short yydefact_[];
-
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
-
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
-
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
-
-  static const short yycheck_[];
-
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short yystos_[];
-
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short yyr1_[];
-
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
-
-
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
-
-
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
-#if PARSER6_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
-    /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
-    /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
-
-    /// Debugging level.
-    int yydebug_;
-    /// Debug stream.
-    std::ostream* yycdebug_;
-
-    /// \brief Display a symbol type, value and location.
-    /// \param yyo    The output stream.
-    /// \param yysym  The symbol.
-    template <typename Base>
-    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
-#endif
-
-    /// \brief Reclaim the memory associated to a symbol.
-    /// \param yymsg     Why this token is reclaimed.
-    ///                  If null, print nothing.
-    /// \param yysym     The symbol.
-    template <typename Base>
-    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
-
-  private:
-    /// Type access provider for state based symbols.
-    struct by_state
-    {
-      /// Default constructor.
-      by_state ();
-
-      /// The symbol type as needed by the constructor.
-      typedef state_type kind_type;
-
-      /// Constructor.
-      by_state (kind_type s);
-
-      /// Copy constructor.
-      by_state (const by_state& other);
-
-      /// Record that this symbol is empty.
-      void clear ();
-
-      /// Steal the symbol type from \a that.
-      void move (by_state& that);
-
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
-
-      /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
-
-      /// The state.
-      /// \a empty when empty.
-      state_type state;
-    };
-
-    /// "Internal" symbol: element of the stack.
-    struct stack_symbol_type : basic_symbol<by_state>
-    {
-      /// Superclass.
-      typedef basic_symbol<by_state> super_type;
-      /// Construct an empty symbol.
-      stack_symbol_type ();
-      /// Move or copy construction.
-      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
-      /// Steal the contents from \a sym to build this.
-      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
-#if !defined __cplusplus || __cplusplus < 201103L
-      /// Assignment, needed by push_back by some old implementations.
-      /// Moves the contents of that.
-      stack_symbol_type& operator= (stack_symbol_type& that);
-#endif
-    };
-
-    /// Stack type.
-    typedef stack<stack_symbol_type> stack_type;
-
-    /// The stack.
-    stack_type yystack_;
-
-    /// Push a new state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param sym  the symbol
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
-
-    /// Push a new look ahead token on the state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the state
-    /// \param sym  the symbol (for its value and location).
-    /// \warning the contents of \a sym.value is stolen.
-    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
-
-    /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
-
-    /// Constants.
-    enum
-    {
-      yyeof_ = 0,
-      yylast_ = 1039,     ///< Last index in yytable_.
-      yynnts_ = 396,  ///< Number of nonterminal symbols.
-      yyfinal_ = 32, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 178  ///< Number of tokens.
-    };
-
-
-    // User arguments.
-    isc::dhcp::Parser6Context& ctx;
-  };
-
-  // Symbol number corresponding to token number t.
-  inline
-  Dhcp6Parser::token_number_type
-  Dhcp6Parser::yytranslate_ (token_type t)
-  {
-    static
-    const token_number_type
-    translate_table[] =
-    {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   176,   177
-    };
-    const unsigned user_token_number_max_ = 432;
-    const token_number_type undef_token_ = 2;
-
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
-    else
-      return undef_token_;
-  }
-
-  inline
-  Dhcp6Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
-  // basic_symbol.
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-    , location ()
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (YY_RVREF (basic_symbol) other)
-    : Base (YY_MOVE (other))
-    , value ()
-    , location (YY_MOVE (other.location))
-  {
-    switch (other.type_get ())
-    {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
-        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (other.value));
-        break;
-
-      case 177: // "boolean"
-        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (other.value));
-        break;
-
-      case 176: // "floating point"
-        value.YY_MOVE_OR_COPY< double > (YY_MOVE (other.value));
-        break;
-
-      case 175: // "integer"
-        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (other.value));
-        break;
-
-      case 174: // "constant string"
-        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (other.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-
-
-  // Implementation of basic_symbol constructor for each type.
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (location_type) l)
-    : Base (t)
-    , location (YY_MOVE (l))
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (ElementPtr) v, YY_RVREF (location_type) l)
-    : Base (t)
-    , value (YY_MOVE (v))
-    , location (YY_MOVE (l))
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (bool) v, YY_RVREF (location_type) l)
-    : Base (t)
-    , value (YY_MOVE (v))
-    , location (YY_MOVE (l))
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (double) v, YY_RVREF (location_type) l)
-    : Base (t)
-    , value (YY_MOVE (v))
-    , location (YY_MOVE (l))
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (int64_t) v, YY_RVREF (location_type) l)
-    : Base (t)
-    , value (YY_MOVE (v))
-    , location (YY_MOVE (l))
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (std::string) v, YY_RVREF (location_type) l)
-    : Base (t)
-    , value (YY_MOVE (v))
-    , location (YY_MOVE (l))
-  {}
-
-
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::~basic_symbol ()
-  {
-    clear ();
-  }
-
-  template <typename Base>
-  void
-  Dhcp6Parser::basic_symbol<Base>::clear ()
-  {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-  switch (yytype)
-    {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
-        value.template destroy< ElementPtr > ();
-        break;
-
-      case 177: // "boolean"
-        value.template destroy< bool > ();
-        break;
-
-      case 176: // "floating point"
-        value.template destroy< double > ();
-        break;
-
-      case 175: // "integer"
-        value.template destroy< int64_t > ();
-        break;
-
-      case 174: // "constant string"
-        value.template destroy< std::string > ();
-        break;
-
-      default:
-        break;
-    }
-
-    Base::clear ();
-  }
-
-  template <typename Base>
-  bool
-  Dhcp6Parser::basic_symbol<Base>::empty () const
-  {
-    return Base::type_get () == empty_symbol;
-  }
-
-  template <typename Base>
-  void
-  Dhcp6Parser::basic_symbol<Base>::move (basic_symbol& s)
-  {
-    super_type::move (s);
-    switch (this->type_get ())
-    {
-      case 195: // value
-      case 199: // map_value
-      case 253: // db_type
-      case 346: // hr_mode
-      case 482: // duid_type
-      case 517: // ncr_protocol_value
-      case 524: // replace_client_name_value
-        value.move< ElementPtr > (YY_MOVE (s.value));
-        break;
-
-      case 177: // "boolean"
-        value.move< bool > (YY_MOVE (s.value));
-        break;
-
-      case 176: // "floating point"
-        value.move< double > (YY_MOVE (s.value));
-        break;
-
-      case 175: // "integer"
-        value.move< int64_t > (YY_MOVE (s.value));
-        break;
-
-      case 174: // "constant string"
-        value.move< std::string > (YY_MOVE (s.value));
-        break;
-
-      default:
-        break;
-    }
-
-    location = YY_MOVE (s.location);
-  }
-
-  // by_type.
-  inline
-  Dhcp6Parser::by_type::by_type ()
-    : type (empty_symbol)
-  {}
-
-  inline
-  Dhcp6Parser::by_type::by_type (const by_type& other)
-    : type (other.type)
-  {}
-
-  inline
-  Dhcp6Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
-  {}
-
-  inline
-  void
-  Dhcp6Parser::by_type::clear ()
-  {
-    type = empty_symbol;
-  }
-
-  inline
-  void
-  Dhcp6Parser::by_type::move (by_type& that)
-  {
-    type = that.type;
-    that.clear ();
-  }
-
-  inline
-  int
-  Dhcp6Parser::by_type::type_get () const
-  {
-    return type;
-  }
-
-  inline
-  Dhcp6Parser::token_type
-  Dhcp6Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-
-  // Implementation of make_symbol for each symbol type.
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_END (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_END, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_COMMA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COMMA, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_COLON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COLON, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LSQUARE_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RSQUARE_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LCURLY_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RCURLY_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NULL_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DATA_DIRECTORY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DATA_DIRECTORY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONFIG_CONTROL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONFIG_CONTROL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONFIG_DATABASES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONFIG_DATABASES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONFIG_FETCH_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACES_CONFIG (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES_CONFIG, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RE_DETECT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RE_DETECT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LEASE_DATABASE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LEASE_DATABASE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTS_DATABASE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTS_DATABASE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTS_DATABASES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTS_DATABASES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MEMFILE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MEMFILE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MYSQL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MYSQL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_POSTGRESQL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_POSTGRESQL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CQL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CQL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_USER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_USER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PASSWORD (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PASSWORD, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOST (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOST, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PORT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PERSIST (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PERSIST, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LFC_INTERVAL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LFC_INTERVAL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_READONLY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_READONLY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONNECT_TIMEOUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONNECT_TIMEOUT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONTACT_POINTS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONTACT_POINTS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_RECONNECT_TRIES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECONNECT_TRIES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RECONNECT_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_KEYSPACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_KEYSPACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONSISTENCY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONSISTENCY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERIAL_CONSISTENCY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERIAL_CONSISTENCY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_REQUEST_TIMEOUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REQUEST_TIMEOUT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TCP_KEEPALIVE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TCP_KEEPALIVE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TCP_NODELAY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TCP_NODELAY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFERRED_LIFETIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PREFERRED_LIFETIME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_VALID_LIFETIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_VALID_LIFETIME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RENEW_TIMER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RENEW_TIMER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_REBIND_TIMER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REBIND_TIMER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DECLINE_PROBATION_PERIOD (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_TAG (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_TAG, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUBNET6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET6, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OPTION_DEF (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DEF, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OPTION_DATA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DATA, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NAME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DATA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DATA, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CODE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CODE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SPACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SPACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CSV_FORMAT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CSV_FORMAT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ALWAYS_SEND (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS_SEND, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RECORD_TYPES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RECORD_TYPES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ENCAPSULATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ENCAPSULATE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ARRAY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ARRAY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_POOLS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_POOLS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_POOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_POOL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PD_POOLS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PD_POOLS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PREFIX, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFIX_LEN (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PREFIX_LEN, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EXCLUDED_PREFIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_EXCLUDED_PREFIX, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EXCLUDED_PREFIX_LEN (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_EXCLUDED_PREFIX_LEN, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DELEGATED_LEN (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DELEGATED_LEN, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_USER_CONTEXT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_COMMENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COMMENT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUBNET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACE_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE_ID, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ID, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RAPID_COMMIT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RAPID_COMMIT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RESERVATION_MODE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RESERVATION_MODE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DISABLED (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DISABLED, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OUT_OF_POOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUT_OF_POOL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_GLOBAL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_GLOBAL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ALL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ALL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SHARED_NETWORKS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SHARED_NETWORKS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAC_SOURCES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAC_SOURCES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RELAY_SUPPLIED_OPTIONS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RELAY_SUPPLIED_OPTIONS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOST_RESERVATION_IDENTIFIERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, YY_MOVE (l));
-  }
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER6_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER6_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER6_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER6_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_UNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DATA_DIRECTORY (location_type l)
+      {
+        return symbol_type (token::TOKEN_DATA_DIRECTORY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DATA_DIRECTORY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DATA_DIRECTORY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_CONTROL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_CONTROL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_CONTROL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_CONTROL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_DATABASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_DATABASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_DATABASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_DATABASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_FETCH_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_FETCH_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RE_DETECT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RE_DETECT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RE_DETECT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RE_DETECT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTS_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTS_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTS_DATABASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTS_DATABASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MEMFILE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MEMFILE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MYSQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MYSQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POSTGRESQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POSTGRESQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PASSWORD (location_type l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PASSWORD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PERSIST (location_type l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PERSIST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_IN_PROCESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_IN_PROCESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_IN_PROCESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_IN_PROCESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_READONLY (location_type l)
+      {
+        return symbol_type (token::TOKEN_READONLY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_READONLY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_READONLY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTACT_POINTS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTACT_POINTS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTACT_POINTS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTACT_POINTS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECONNECT_TRIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECONNECT_TRIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECONNECT_TRIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECONNECT_TRIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECONNECT_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECONNECT_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYSPACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_KEYSPACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYSPACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_KEYSPACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONSISTENCY (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONSISTENCY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONSISTENCY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONSISTENCY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERIAL_CONSISTENCY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERIAL_CONSISTENCY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERIAL_CONSISTENCY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERIAL_CONSISTENCY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REQUEST_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_REQUEST_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REQUEST_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REQUEST_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP_KEEPALIVE (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP_KEEPALIVE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP_KEEPALIVE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP_KEEPALIVE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP_NODELAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP_NODELAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP_NODELAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP_NODELAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFERRED_LIFETIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFERRED_LIFETIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFERRED_LIFETIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFERRED_LIFETIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VALID_LIFETIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VALID_LIFETIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RENEW_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RENEW_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REBIND_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REBIND_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (location_type l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_TAG (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_TAG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_TAG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_TAG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SPACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SPACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SPACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SPACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CSV_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CSV_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS_SEND (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_SEND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS_SEND (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_SEND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECORD_TYPES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECORD_TYPES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENCAPSULATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENCAPSULATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ARRAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ARRAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOLS (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOLS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOLS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOLS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PD_POOLS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PD_POOLS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PD_POOLS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PD_POOLS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFIX_LEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFIX_LEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFIX_LEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFIX_LEN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX_LEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX_LEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX_LEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX_LEN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DELEGATED_LEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_DELEGATED_LEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DELEGATED_LEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DELEGATED_LEN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER_CONTEXT (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER_CONTEXT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RAPID_COMMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RAPID_COMMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RAPID_COMMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RAPID_COMMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATION_MODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATION_MODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DISABLED (location_type l)
+      {
+        return symbol_type (token::TOKEN_DISABLED, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DISABLED (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DISABLED, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUT_OF_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUT_OF_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUT_OF_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUT_OF_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GLOBAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_GLOBAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GLOBAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GLOBAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALL (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SHARED_NETWORKS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SHARED_NETWORKS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SHARED_NETWORKS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SHARED_NETWORKS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAC_SOURCES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAC_SOURCES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAC_SOURCES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAC_SOURCES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RELAY_SUPPLIED_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RELAY_SUPPLIED_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RELAY_SUPPLIED_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RELAY_SUPPLIED_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SANITY_CHECKS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SANITY_CHECKS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SANITY_CHECKS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SANITY_CHECKS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_CHECKS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_CHECKS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_CHECKS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_CHECKS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REQUIRE_CLIENT_CLASSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_REQUIRE_CLIENT_CLASSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REQUIRE_CLIENT_CLASSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REQUIRE_CLIENT_CLASSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TEST (location_type l)
+      {
+        return symbol_type (token::TOKEN_TEST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TEST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TEST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ONLY_IF_REQUIRED (location_type l)
+      {
+        return symbol_type (token::TOKEN_ONLY_IF_REQUIRED, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ONLY_IF_REQUIRED (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ONLY_IF_REQUIRED, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFIXES (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFIXES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFIXES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFIXES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DUID (location_type l)
+      {
+        return symbol_type (token::TOKEN_DUID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DUID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DUID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HW_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HW_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLEX_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLEX_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLEX_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLEX_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RELAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_RELAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RELAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RELAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARAMETERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARAMETERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (location_type l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LLT (location_type l)
+      {
+        return symbol_type (token::TOKEN_LLT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LLT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LLT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EN (location_type l)
+      {
+        return symbol_type (token::TOKEN_EN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LL (location_type l)
+      {
+        return symbol_type (token::TOKEN_LL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IDENTIFIER (location_type l)
+      {
+        return symbol_type (token::TOKEN_IDENTIFIER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IDENTIFIER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IDENTIFIER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HTYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_HTYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HTYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HTYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENTERPRISE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENTERPRISE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENTERPRISE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENTERPRISE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4O6_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4O6_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_SOCKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_SOCKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_OUTPUT_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_OUTPUT_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_OUTPUT_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_OUTPUT_THREADS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_QUEUE_CONTROL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_QUEUE_CONTROL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_QUEUE_CONTROL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_QUEUE_CONTROL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENABLE_UPDATES (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENABLE_UPDATES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GENERATED_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GENERATED_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UDP (location_type l)
+      {
+        return symbol_type (token::TOKEN_UDP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UDP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UDP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_SET (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_SET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_SET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_SET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_REPLACEMENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_REPLACEMENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_REPLACEMENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_REPLACEMENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAXSIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAXSIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAXVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAXVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_AGENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_AGENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_AGENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_AGENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_INTERFACES6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_INTERFACES6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_SUBNET6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_SUBNET6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_POOL6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_POOL6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_PD_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_PD_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_PD_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_PD_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_RESERVATION (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_RESERVATION (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DEFS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEFS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DEFS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEFS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_CONFIG_CONTROL (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_CONFIG_CONTROL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_CONFIG_CONTROL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_CONFIG_CONTROL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
+#endif
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SANITY_CHECKS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SANITY_CHECKS, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LEASE_CHECKS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LEASE_CHECKS, YY_MOVE (l));
-  }
+    class context
+    {
+    public:
+      context (const Dhcp6Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CLIENT_CLASSES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASSES, YY_MOVE (l));
-  }
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_REQUIRE_CLIENT_CLASSES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REQUIRE_CLIENT_CLASSES, YY_MOVE (l));
-  }
+    private:
+      const Dhcp6Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TEST (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TEST, YY_MOVE (l));
-  }
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    Dhcp6Parser (const Dhcp6Parser&);
+    /// Non copyable.
+    Dhcp6Parser& operator= (const Dhcp6Parser&);
+#endif
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ONLY_IF_REQUIRED (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ONLY_IF_REQUIRED, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CLIENT_CLASS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASS, YY_MOVE (l));
-  }
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RESERVATIONS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RESERVATIONS, YY_MOVE (l));
-  }
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_IP_ADDRESSES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESSES, YY_MOVE (l));
-  }
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFIXES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PREFIXES, YY_MOVE (l));
-  }
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DUID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DUID, YY_MOVE (l));
-  }
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HW_ADDRESS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HW_ADDRESS, YY_MOVE (l));
-  }
+    static const short yypact_ninf_;
+    static const signed char yytable_ninf_;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTNAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, YY_MOVE (l));
-  }
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_FLEX_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLEX_ID, YY_MOVE (l));
-  }
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RELAY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RELAY, YY_MOVE (l));
-  }
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_IP_ADDRESS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOOKS_LIBRARIES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOOKS_LIBRARIES, YY_MOVE (l));
-  }
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LIBRARY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LIBRARY, YY_MOVE (l));
-  }
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PARAMETERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PARAMETERS, YY_MOVE (l));
-  }
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EXPIRED_LEASES_PROCESSING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, YY_MOVE (l));
-  }
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RECLAIM_TIMER_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, YY_MOVE (l));
-  }
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, YY_MOVE (l));
-  }
+    static const short yycheck_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOLD_RECLAIMED_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, YY_MOVE (l));
-  }
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_RECLAIM_LEASES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, YY_MOVE (l));
-  }
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_RECLAIM_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, YY_MOVE (l));
-  }
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_UNWARNED_RECLAIM_CYCLES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_ID, YY_MOVE (l));
-  }
+#if PARSER6_DEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LLT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LLT, YY_MOVE (l));
-  }
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EN (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_EN, YY_MOVE (l));
-  }
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LL, YY_MOVE (l));
-  }
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_IDENTIFIER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_IDENTIFIER, YY_MOVE (l));
-  }
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HTYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HTYPE, YY_MOVE (l));
-  }
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TIME, YY_MOVE (l));
-  }
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ENTERPRISE_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ENTERPRISE_ID, YY_MOVE (l));
-  }
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP4O6_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP4O6_PORT, YY_MOVE (l));
-  }
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONTROL_SOCKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, YY_MOVE (l));
-  }
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SOCKET_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, YY_MOVE (l));
-  }
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SOCKET_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, YY_MOVE (l));
-  }
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP_QUEUE_CONTROL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP_QUEUE_CONTROL, YY_MOVE (l));
-  }
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP_DDNS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP_DDNS, YY_MOVE (l));
-  }
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ENABLE_UPDATES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ENABLE_UPDATES, YY_MOVE (l));
-  }
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_QUALIFYING_SUFFIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, YY_MOVE (l));
-  }
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_IP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_IP, YY_MOVE (l));
-  }
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_PORT, YY_MOVE (l));
-  }
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SENDER_IP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SENDER_IP, YY_MOVE (l));
-  }
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SENDER_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SENDER_PORT, YY_MOVE (l));
-  }
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_QUEUE_SIZE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, YY_MOVE (l));
-  }
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NCR_PROTOCOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, YY_MOVE (l));
-  }
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NCR_FORMAT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, YY_MOVE (l));
-  }
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OVERRIDE_NO_UPDATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, YY_MOVE (l));
-  }
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OVERRIDE_CLIENT_UPDATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_REPLACE_CLIENT_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, YY_MOVE (l));
-  }
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_GENERATED_PREFIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_GENERATED_PREFIX, YY_MOVE (l));
-  }
+    /// The stack.
+    stack_type yystack_;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_UDP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_UDP, YY_MOVE (l));
-  }
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TCP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TCP, YY_MOVE (l));
-  }
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_JSON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_JSON, YY_MOVE (l));
-  }
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_WHEN_PRESENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_WHEN_PRESENT, YY_MOVE (l));
-  }
+    /// Constants.
+    enum
+    {
+      yylast_ = 1051,     ///< Last index in yytable_.
+      yynnts_ = 403,  ///< Number of nonterminal symbols.
+      yyfinal_ = 32 ///< Termination state number.
+    };
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NEVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NEVER, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ALWAYS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS, YY_MOVE (l));
-  }
+    // User arguments.
+    isc::dhcp::Parser6Context& ctx;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_WHEN_NOT_PRESENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, YY_MOVE (l));
-  }
+  };
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTNAME_CHAR_SET (YY_COPY (location_type) l)
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_HOSTNAME_CHAR_SET, YY_MOVE (l));
-  }
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const unsigned char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183
+    };
+    // Last valid token kind.
+    const int code_max = 438;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTNAME_CHAR_REPLACEMENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME_CHAR_REPLACEMENT, YY_MOVE (l));
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
   }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LOGGING (YY_COPY (location_type) l)
+  // basic_symbol.
+  template <typename Base>
+  Dhcp6Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
   {
-    return symbol_type (token::TOKEN_LOGGING, YY_MOVE (l));
-  }
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LOGGERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, YY_MOVE (l));
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OUTPUT_OPTIONS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, YY_MOVE (l));
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OUTPUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, YY_MOVE (l));
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DEBUGLEVEL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, YY_MOVE (l));
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SEVERITY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SEVERITY, YY_MOVE (l));
-  }
+      default:
+        break;
+    }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_FLUSH (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLUSH, YY_MOVE (l));
   }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAXSIZE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAXSIZE, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAXVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAXVER, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP4 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP4, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCPDDNS (YY_COPY (location_type) l)
+  template <typename Base>
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_DHCPDDNS, YY_MOVE (l));
+    return this->kind ();
   }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONTROL_AGENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_AGENT, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TOPLEVEL_JSON (YY_COPY (location_type) l)
+  template <typename Base>
+  bool
+  Dhcp6Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, YY_MOVE (l));
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TOPLEVEL_DHCP6 (YY_COPY (location_type) l)
+  template <typename Base>
+  void
+  Dhcp6Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCP6, YY_MOVE (l));
-  }
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_DHCP6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCP6, YY_MOVE (l));
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_INTERFACES6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_INTERFACES6, YY_MOVE (l));
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_SUBNET6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_SUBNET6, YY_MOVE (l));
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_POOL6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_POOL6, YY_MOVE (l));
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_PD_POOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_PD_POOL, YY_MOVE (l));
-  }
+      default:
+        break;
+    }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_RESERVATION (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_RESERVATION, YY_MOVE (l));
+    location = YY_MOVE (s.location);
   }
 
+  // by_kind.
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_OPTION_DEFS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DEFS, YY_MOVE (l));
-  }
+  Dhcp6Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
 
+#if 201103L <= YY_CPLUSPLUS
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_OPTION_DEF (YY_COPY (location_type) l)
+  Dhcp6Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
-    return symbol_type (token::TOKEN_SUB_OPTION_DEF, YY_MOVE (l));
+    that.clear ();
   }
+#endif
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_OPTION_DATA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DATA, YY_MOVE (l));
-  }
+  Dhcp6Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_HOOKS_LIBRARY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, YY_MOVE (l));
-  }
+  Dhcp6Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_DHCP_DDNS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCP_DDNS, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_LOGGING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_LOGGING, YY_MOVE (l));
-  }
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_CONFIG_CONTROL (YY_COPY (location_type) l)
+  void
+  Dhcp6Parser::by_kind::clear () YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_SUB_CONFIG_CONTROL, YY_MOVE (l));
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_STRING (YY_COPY (std::string) v, YY_COPY (location_type) l)
+  void
+  Dhcp6Parser::by_kind::move (by_kind& that)
   {
-    return symbol_type (token::TOKEN_STRING, YY_MOVE (v), YY_MOVE (l));
+    kind_ = that.kind_;
+    that.clear ();
   }
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTEGER (YY_COPY (int64_t) v, YY_COPY (location_type) l)
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_INTEGER, YY_MOVE (v), YY_MOVE (l));
+    return kind_;
   }
 
-  inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_FLOAT (YY_COPY (double) v, YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, YY_MOVE (v), YY_MOVE (l));
-  }
 
   inline
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_BOOLEAN (YY_COPY (bool) v, YY_COPY (location_type) l)
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_BOOLEAN, YY_MOVE (v), YY_MOVE (l));
+    return this->kind ();
   }
 
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:404
+#line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 3326 "dhcp6_parser.h" // lalr1.cc:404
+#line 5020 "dhcp6_parser.h"
 
 
 
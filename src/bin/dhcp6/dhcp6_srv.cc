@@ -51,6 +51,7 @@
 #include <util/pointer_util.h>
 #include <util/range_utilities.h>
 #include <log/logger.h>
+#include <log/logger_manager.h>
 #include <cryptolink/cryptolink.h>
 #include <cfgrpt/config_report.h>
 
@@ -405,10 +406,21 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
 }
 
 bool Dhcpv6Srv::run() {
+    // Number of log messages dropped by the asynchronous loggers which
+    // has been reported in the statistics.
+    uint64_t dropped_logs = 0;
     while (!shutdown_) {
         try {
             run_one();
             getIOService()->poll();
+
+            // Account for the log messages dropped since the last iteration.
+            const uint64_t dropped = LoggerManager::getDroppedMessagesNum();
+            if (dropped != dropped_logs) {
+                isc::stats::StatsMgr::instance().addValue("log-messages-dropped",
+                    static_cast<int64_t>(dropped - dropped_logs));
+                dropped_logs = dropped;
+            }
         } catch (const std::exception& e) {
             // General catch-all standard exceptions that are not caught by more
             // specific catches.
@@ -1124,6 +1136,7 @@ Dhcpv6Srv::buildCfgOptionList(const Pkt6Ptr& question,
 
 void
 Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
+                                  AllocEngine::ClientContext6& ctx,
                                   const CfgOptionList& co_list) {
 
     // Unlikely short cut
@@ -1143,33 +1156,25 @@ Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
     if (option_oro) {
         requested_opts = option_oro->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP6_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            requested_opts.push_back(desc->option_->getType());
-        }
-    }
+
+    // Get the flattened view of the configured option list. The options
+    // of the host reservation are specific to the client so they are not
+    // cached.
+    const ConstHostPtr& host = ctx.currentHost();
+    const size_t uncached = (host && (co_list.front() == host->getCfgOption6())) ?
+        1 : 0;
+    ConstCfgOptionFlatPtr flat = CfgMgr::instance().getCurrentCfg()->
+        getCfgOptionFlatCache()->get(DHCP6_OPTION_SPACE, co_list, uncached);
+
+    // Add persistent options
+    const std::vector<uint16_t>& persistent = flat->getPersistent();
+    requested_opts.insert(requested_opts.end(), persistent.begin(),
+                          persistent.end());
 
     BOOST_FOREACH(uint16_t opt, requested_opts) {
-        // Iterate on the configured option list
-        for (CfgOptionList::const_iterator copts = co_list.begin();
-             copts != co_list.end(); ++copts) {
-            OptionDescriptor desc = (*copts)->get(DHCP6_OPTION_SPACE, opt);
-            // Got it: add it and jump to the outer loop
-            if (desc.option_) {
-                answer->addOption(desc.option_);
-                break;
-            }
+        OptionPtr option = flat->get(opt);
+        if (option) {
+            answer->addOption(option);
         }
     }
 }
@@ -2795,7 +2800,7 @@ Dhcpv6Srv::processSolicit(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(solicit, ctx, co_list);
     appendDefaultOptions(solicit, response, co_list);
-    appendRequestedOptions(solicit, response, co_list);
+    appendRequestedOptions(solicit, response, ctx, co_list);
     appendRequestedVendorOptions(solicit, response, ctx, co_list);
 
     updateReservedFqdn(ctx, response);
@@ -2825,7 +2830,7 @@ Dhcpv6Srv::processRequest(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(request, ctx, co_list);
     appendDefaultOptions(request, reply, co_list);
-    appendRequestedOptions(request, reply, co_list);
+    appendRequestedOptions(request, reply, ctx, co_list);
     appendRequestedVendorOptions(request, reply, ctx, co_list);
 
     updateReservedFqdn(ctx, reply);
@@ -2851,7 +2856,7 @@ Dhcpv6Srv::processRenew(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(renew, ctx, co_list);
     appendDefaultOptions(renew, reply, co_list);
-    appendRequestedOptions(renew, reply, co_list);
+    appendRequestedOptions(renew, reply, ctx, co_list);
     appendRequestedVendorOptions(renew, reply, ctx, co_list);
 
     updateReservedFqdn(ctx, reply);
@@ -2877,7 +2882,7 @@ Dhcpv6Srv::processRebind(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(rebind, ctx, co_list);
     appendDefaultOptions(rebind, reply, co_list);
-    appendRequestedOptions(rebind, reply, co_list);
+    appendRequestedOptions(rebind, reply, ctx, co_list);
     appendRequestedVendorOptions(rebind, reply, ctx, co_list);
 
     updateReservedFqdn(ctx, reply);
@@ -2908,7 +2913,7 @@ Dhcpv6Srv::processConfirm(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(confirm, ctx, co_list);
     appendDefaultOptions(confirm, reply, co_list);
-    appendRequestedOptions(confirm, reply, co_list);
+    appendRequestedOptions(confirm, reply, ctx, co_list);
     appendRequestedVendorOptions(confirm, reply, ctx, co_list);
     // Indicates if at least one address has been verified. If no addresses
     // are verified it means that the client has sent no IA_NA options
@@ -3316,7 +3321,7 @@ Dhcpv6Srv::processInfRequest(AllocEngine::ClientContext6& ctx) {
     appendDefaultOptions(inf_request, reply, co_list);
 
     // Try to assign options that were requested by the client.
-    appendRequestedOptions(inf_request, reply, co_list);
+    appendRequestedOptions(inf_request, reply, ctx, co_list);
 
     // Try to assign vendor options that were requested by the client.
     appendRequestedVendorOptions(inf_request, reply, ctx, co_list);
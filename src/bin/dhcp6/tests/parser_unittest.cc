@@ -309,6 +309,31 @@ TEST(ParserTest, globalParameters) {
     EXPECT_NO_THROW(parser.checkKeywords(parser.GLOBAL6_PARAMETERS, json));
 }
 
+// Checks that the in-process lease file cleanup can be enabled.
+TEST(ParserTest, lfcInProcess) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"lfc-interval\": 3600,"
+        " \"lfc-in-process\": true } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the number of config output threads can be specified.
+TEST(ParserTest, configOutputThreads) {
+    string txt = "{ \"Dhcp6\": { \"control-socket\": {"
+        " \"socket-type\": \"unix\", \"socket-name\": \"/tmp/kea6-ctrl\","
+        " \"config-output-threads\": 2 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    Parser6Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt, Parser6Context::PARSER_DHCP6));
+    ConstElementPtr threads = json->get("Dhcp6")->get("control-socket")->
+        get("config-output-threads");
+    ASSERT_TRUE(threads);
+    ASSERT_EQ(Element::integer, threads->getType());
+    EXPECT_EQ(2, threads->intValue());
+}
+
 /// @brief Tests error conditions in Dhcp6Parser
 ///
 /// @param txt text to be parsed
@@ -332,6 +357,15 @@ void testError(const std::string& txt,
     }
 }
 
+// Checks that the number of config output threads must be an integer.
+TEST(ParserTest, configOutputThreadsErrors) {
+    testError("{ \"Dhcp6\": { \"control-socket\": {\n"
+              "  \"config-output-threads\": \"2\" } } }\n",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:2.28-30: syntax error, unexpected constant string, "
+              "expecting integer");
+}
+
 // Verify that error conditions are handled correctly.
 TEST(ParserTest, errors) {
     // no input
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 62
-#define YY_END_OF_BUFFER 63
+#define YY_NUM_RULES 65
+#define YY_END_OF_BUFFER 66
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,48 +700,50 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[367] =
+static const flex_int16_t yy_accept[388] =
     {   0,
-       55,   55,    0,    0,    0,    0,    0,    0,    0,    0,
-       63,   61,   10,   11,   61,    1,   55,   52,   55,   55,
-       61,   54,   53,   61,   61,   61,   61,   61,   48,   49,
-       61,   61,   61,   50,   51,    5,    5,    5,   61,   61,
-       61,   10,   11,    0,    0,   44,    0,    0,    0,    0,
+       58,   58,    0,    0,    0,    0,    0,    0,    0,    0,
+       66,   64,   10,   11,   64,    1,   58,   55,   58,   58,
+       64,   57,   56,   64,   64,   64,   64,   64,   51,   52,
+       64,   64,   64,   53,   54,    5,    5,    5,   64,   64,
+       64,   10,   11,    0,    0,   47,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    1,   55,   55,    0,   54,   55,    3,    2,
-        6,    0,   55,    0,    0,    0,    0,    0,    0,    4,
-        0,    0,    9,    0,   45,    0,    0,    0,    0,   47,
+        0,    0,    0,    0,    1,   58,   58,    0,   57,    3,
+        2,    6,    0,   58,    0,    0,    0,    0,    0,    0,
+        4,    0,    0,    9,   48,    0,    0,    0,    0,   50,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,   46,    0,    0,
-       22,    0,    0,   21,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   60,   58,    0,   57,   56,
+        0,    0,    0,    0,    8,    0,    0,    0,   49,    0,
+        0,    0,   22,    0,    0,   21,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   63,
+       61,    0,   60,   59,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   59,
-       56,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   26,    0,    0,    0,    0,    0,
-        0,   36,    0,    0,    0,    0,    0,    0,   25,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   19,
-       20,   39,    0,    0,    0,    0,    0,    0,   23,    0,
-        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
-       38,    0,    0,    0,    0,   27,    0,    0,    0,   34,
-       12,    0,   14,    0,    0,    0,   32,   35,    0,   40,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   43,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   62,   59,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   42,    0,
-        0,    0,   33,    0,    0,   30,    0,    0,    0,   15,
-        0,    0,    0,    0,   29,   28,    0,    0,    0,    0,
-        0,    0,    0,    0,   13,    0,    0,    0,    0,    0,
-        0,    0,   24,    0,    0,   37,    0,    0,   31,   18,
-        0,    0,    0,   17,   16,    0
+        0,    0,   26,    0,    0,    0,    0,    0,    0,   36,
+        0,    0,    0,    0,    0,    0,    0,    0,   25,    0,
+        0,    0,    0,    0,    0,   42,    0,    0,    0,    0,
+       19,   20,   39,    0,    0,    0,    0,    0,    0,   23,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        7,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   41,   38,    0,    0,    0,    0,    0,    0,
+       27,    0,    0,    0,   34,   12,    0,   14,    0,    0,
+        0,   32,   35,    0,   40,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   44,    0,    0,   46,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   45,    0,
+        0,    0,   33,   43,    0,    0,   30,    0,    0,    0,
+       15,    0,    0,    0,    0,   29,   28,    0,    0,    0,
+        0,    0,    0,    0,    0,   13,    0,    0,    0,    0,
+        0,    0,    0,   24,    0,    0,   37,    0,    0,   31,
+       18,    0,    0,    0,   17,   16,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -758,8 +760,8 @@ static const YY_CHAR yy_ec[256] =
        32,   33,   34,    5,   35,    5,   36,   37,   38,   39,
 
        40,   41,   42,   43,   44,    5,   45,   46,   47,   48,
-       49,   50,    5,   51,   52,   53,   54,   55,    5,   56,
-       57,   58,   59,    5,   60,    5,    5,    5,    5,    5,
+       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+       59,   60,   61,    5,   62,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -776,391 +778,295 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[61] =
+static const YY_CHAR yy_meta[63] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    5,    6,    6,    6,    6,    3,    3,    3,
-        3,    6,    6,    6,    6,    3,    3,    3,    3,    3,
-        3,    3,    5,    3,    3,    6,    7,    6,    6,    6,
-        7,    3,    3,    3,    3,    3,    3,    5,    3,    3,
-        5,    3,    5,    5,    3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1
     } ;
 
-static const flex_int16_t yy_base[380] =
+static const flex_int16_t yy_base[388] =
     {   0,
-        0,    0,   59,   62,   65,    0,   63,   67,   47,   64,
-      291, 2481,   84,  286,  125,    0,  105, 2481,  120,  125,
-       85,  169, 2481,  262,  139,   65,   69,   82, 2481, 2481,
-       80,   84,  118, 2481, 2481, 2481,   92,  269,  230,    0,
-      256,  110,  270,   97,  186, 2481,  193,  199,  197,  210,
-      219,  234,  255,  263,  269,  278,  284,  291,  297,  303,
-      320,  338,    0,  345,  363,  375,  381,  385, 2481,    0,
-     2481,  332,  349,  121,  144,  128,  152,  171,  160, 2481,
-      222,  248, 2481,  198, 2481,  169,  405,  411,  209,  417,
-      451,  428,  439,  450,  478,  493,  499,  506,  512,  518,
-
-      532,  540,  546,  552,  574,  586,  594,  602,  608,  614,
-      622,  628,  648,  661,    0,  177,  181,  184,  189,  207,
-      204,  130, 2481,    0,  667,  673,  155, 2481,  698,  695,
-     2481,  683,  723, 2481,  739,  748,  756,  762,  768,  776,
-      782,  810,  819,  827,  833,  839,  847,  853,  862,  875,
-      895,  903,  909,  917,  222, 2481, 2481,  223, 2481, 2481,
-      103,    0,  924,  931,  967,  937,  992, 1008,  943, 1014,
-     1020, 1032, 1042, 1049, 1055, 1065, 1071, 1077, 1088, 1099,
-     1110, 1121, 1127, 1134, 1143, 1149, 1155, 1169, 1183, 2481,
-     2481,  104,    0, 1190, 1197, 1232, 1204, 1211, 1218, 1230,
-
-     1259, 1276, 1282, 1288, 2481, 1294, 1300, 1310, 1316, 1322,
-     1328, 2481, 1334, 1351, 1357, 1363, 1369, 1375, 2481, 1391,
-     1397,   64,    0, 1403, 1409, 1437, 1445, 1451, 1459, 2481,
-     2481, 2481, 1470, 1479, 1487, 1499, 1507, 1516, 2481, 1522,
-     1528, 1540, 1557, 1550, 1563, 1569, 1576, 2481, 1583, 1597,
-     1609, 1618, 1625, 1631, 1637, 1643, 1651, 1660, 1666, 2481,
-     2481, 1672, 1686, 1694, 1700, 2481, 1706, 1712, 1722, 2481,
-     2481, 1728, 2481, 1734, 1767, 1773, 2481, 2481, 1779, 2481,
-     1786, 1792, 1802, 1812, 1820, 1827, 1836, 1848, 1855, 1861,
-     1869, 1883, 1889, 1897, 1903, 1909, 2481, 1918, 1925, 1943,
-
-     1951, 1965, 1971, 1977, 1985, 1991, 2000, 2010, 2019, 2025,
-     2036, 2044, 2053, 2064, 2072, 2079, 2086, 2092, 2481, 2098,
-     2105, 2112, 2481, 2133, 2140, 2481, 2149, 2156, 2162, 2481,
-     2168, 2174, 2182, 2210, 2481, 2481, 2218, 2224, 2230, 2236,
-     2243, 2258, 2264, 2271, 2481, 2278, 2284, 2292, 2299, 2312,
-     2320, 2327, 2481, 2333, 2340, 2481, 2346, 2355, 2481, 2481,
-     2362, 2368, 2375, 2481, 2481, 2481, 2414, 2421, 2428, 2435,
-     2442, 2449, 2456, 2460, 2465, 2467, 2469, 2471, 2473
+        1,    0,   64,    0,  127,    0,  950,  960,  984, 1038,
+        0,  697,  947,  823,  190,  694, 1060,  760, 1094, 1144,
+      959, 1107,  886, 1093,  964, 1029, 1031,  948,  958,  965,
+     1133, 1057, 1021,  993,  995, 1085,  950, 1189, 1048,  820,
+     1097,  953, 1092,  253,  316, 1099, 1181, 1106,  379, 1178,
+     1183, 1163, 1018, 1188, 1156, 1162, 1172, 1199,  829, 1200,
+     1182, 1127, 1170, 1202,    0, 1148, 1113,  992, 1126, 1103,
+      757, 1120, 1020, 1064, 1089, 1090, 1101, 1145, 1149, 1139,
+     1239, 1190, 1240, 1240, 1241, 1050, 1242, 1242,  883,    0,
+      442, 1242, 1242, 1242,  975, 1243, 1242, 1242, 1242, 1243,
+
+     1244, 1244, 1243, 1166, 1243, 1242, 1245, 1243, 1242, 1246,
+     1244, 1249, 1249, 1253, 1249, 1255, 1256, 1151, 1152, 1173,
+     1154, 1174, 1177, 1187, 1242,  946, 1261, 1266, 1243,  505,
+     1257, 1252, 1244, 1260, 1254, 1245, 1254, 1260, 1258, 1267,
+     1263, 1262, 1273, 1280, 1173, 1277, 1278, 1269, 1268, 1285,
+     1267, 1283, 1279, 1276, 1273, 1269, 1276, 1285, 1179, 1247,
+     1250, 1185, 1251, 1252,  977,  974, 1286, 1282,  568, 1294,
+     1253, 1293, 1282, 1293, 1199, 1293, 1284, 1253, 1302, 1299,
+     1298, 1297, 1302, 1297, 1254, 1289, 1304, 1299, 1307, 1296,
+     1309, 1295, 1313, 1255, 1254, 1313, 1253, 1254, 1157, 1002,
+
+     1305, 1306,  631, 1257, 1300, 1308, 1308, 1312, 1260, 1261,
+     1262, 1258, 1255, 1307, 1308, 1321, 1302, 1311, 1264, 1257,
+     1310, 1319, 1326, 1260, 1323, 1314, 1315, 1318, 1258, 1333,
+     1336, 1222, 1030, 1331, 1333, 1272, 1325, 1322, 1331, 1338,
+     1273, 1274, 1275, 1333, 1321, 1328, 1343, 1343, 1378, 1276,
+     1221, 1336, 1332, 1334, 1334, 1378, 1384, 1347, 1343, 1339,
+     1277, 1388, 1389, 1357, 1391, 1387, 1343, 1356, 1395, 1396,
+     1392, 1398, 1278, 1405, 1406, 1406, 1406, 1406, 1406, 1138,
+     1406, 1407, 1408, 1407, 1407, 1408, 1409, 1409, 1411, 1411,
+     1411, 1410, 1411, 1413, 1412, 1417, 1413, 1416, 1413, 1414,
+
+     1413, 1413, 1417, 1413, 1416, 1413, 1417, 1413, 1413, 1422,
+     1414, 1421, 1413, 1423, 1417, 1414, 1430, 1428, 1415, 1415,
+     1418, 1422, 1439, 1442, 1415, 1416, 1429, 1438, 1416, 1417,
+     1443, 1444, 1419, 1447, 1428, 1444, 1421, 1443, 1415, 1437,
+     1434, 1442, 1416, 1417, 1422, 1423, 1418, 1449, 1439, 1458,
+     1430, 1455, 1452, 1457, 1450, 1431, 1432, 1463, 1433, 1452,
+     1447, 1462, 1451, 1451, 1457, 1433, 1464, 1434, 1454, 1455,
+     1435, 1467, 1470, 1434, 1436, 1437, 1435, 1471, 1459, 1436,
+     1437, 1460, 1508, 1509, 1438, 1516, 1579
     } ;
 
-static const flex_int16_t yy_def[380] =
+static const flex_int16_t yy_def[388] =
     {   0,
-      366,    1,  367,  367,    1,    5,    5,    5,    5,    5,
-      366,  366,  366,  366,  368,  369,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  370,
-      366,  366,  366,  371,  368,  366,  368,  368,  372,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  369,  366,  366,  366,  366,  366,  366,  373,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  370,  366,  371,  366,  374,  368,  368,  375,  368,
-      372,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  373,  366,  366,  366,  366,  366,
-      366,  366,  366,  376,  368,  368,  375,  366,  372,  368,
-      366,  368,  368,  366,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  366,  366,  366,  366,  366,  366,
-      366,  377,  368,  368,  372,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  366,
-      366,  366,  378,  368,  368,  372,  368,  368,  368,  368,
-
-      368,  368,  368,  368,  366,  368,  368,  368,  368,  368,
-      368,  366,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  366,  379,  368,  368,  368,  368,  368,  368,  366,
-      366,  366,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  368,  368,  368,  368,  368,  368,  366,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  366,
-      366,  368,  368,  368,  368,  366,  368,  368,  368,  366,
-      366,  368,  366,  368,  368,  368,  366,  366,  368,  366,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  366,  368,  368,  368,
-
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  368,  366,  368,  368,  366,  368,  368,  368,  366,
-      368,  368,  368,  368,  366,  366,  368,  368,  368,  368,
-      368,  368,  368,  368,  366,  368,  368,  368,  368,  368,
-      368,  368,  366,  368,  368,  366,  368,  368,  366,  366,
-      368,  368,  368,  366,  366,    0,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366
+      387,    1,  387,    3,  387,    5,    5,    5,    5,    5,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,   45,   45,  387,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   16,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,   40,  387,  387,  387,   45,   45,  387,   45,
+      387,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,   45,   45,  387,  387,
+       45,   45,  387,   45,   45,  387,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  387,  387,
+      387,  387,  387,  387,  387,  387,   45,   45,  387,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  387,  387,  387,  387,
+
+       45,   45,  387,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  387,   45,   45,   45,   45,   45,   45,  387,
+       45,   45,   45,   45,   45,   45,   45,   45,  387,   45,
+       45,  387,  387,   45,   45,  387,   45,   45,   45,   45,
+      387,  387,  387,   45,   45,   45,   45,   45,   45,  387,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+      387,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  387,  387,   45,   45,   45,   45,   45,   45,
+      387,   45,   45,   45,  387,  387,   45,  387,   45,   45,
+       45,  387,  387,   45,  387,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  387,   45,   45,  387,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  387,   45,
+       45,   45,  387,  387,   45,   45,  387,   45,   45,   45,
+      387,   45,   45,   45,   45,  387,  387,   45,   45,   45,
+       45,   45,   45,   45,   45,  387,   45,   45,   45,   45,
+       45,   45,   45,  387,   45,   45,  387,   45,   45,  387,
+      387,   45,   45,   45,  387,  387,    0
     } ;
 
-static const flex_int16_t yy_nxt[2542] =
+static const flex_int16_t yy_nxt[1642] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   25,   26,   12,   27,   12,   12,   28,
-       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
-       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
-       12,   12,   33,   12,   12,   12,   12,   12,   34,   35,
-       37,   14,   37,   37,   14,   37,   38,   41,   40,   38,
-       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   41,   42,   74,   42,   12,   12,
-       12,   12,   69,   42,   12,   42,   12,   70,   12,   75,
-
-       74,   74,   85,  248,   12,   12,   12,   12,   39,   76,
-       12,   42,   12,   42,   75,   77,   64,   12,   65,   65,
-       65,   65,   75,   12,   12,   44,   44,   44,   66,   86,
-       46,   64,   76,   67,   67,   67,   67,   78,   68,   68,
-       68,   68,  222,   66,   66,   76,  116,   72,   66,   72,
-       47,   48,   73,   73,   73,   73,  192,   49,  118,   66,
-      128,   50,   51,   52,   66,   53,  116,   54,   79,  117,
-       55,   56,   57,   58,   59,  161,   60,  116,   61,   62,
-       64,  118,   67,   67,   67,   67,   44,   44,   44,  117,
-      118,   46,   66,   44,   44,   44,  117,  119,   46,   44,
-
-       44,   44,   90,   85,   46,  155,  156,  157,   66,   45,
-       44,   44,   44,  121,  128,   46,  120,  155,   49,   44,
-       44,   44,  124,  157,   46,   49,  156,  157,  155,   45,
-       86,   49,  156,   45,   44,   44,   44,   45,   88,   46,
-      158,   87,   49,  160,   45,  190,  190,   45,   95,   45,
-       91,   49,  159,  123,   93,   44,   44,   44,   92,  122,
-       46,  190,  191,   44,   44,   44,   49,   94,   46,   44,
-       44,   44,   43,   96,   46,   83,   97,   81,   44,   44,
-       44,   80,   71,   46,   44,   44,   44,   49,   43,   46,
-      366,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-
-       98,   49,   46,   44,   44,   44,  366,  366,   46,  366,
-       49,   99,  101,  103,  366,  100,   49,  102,  366,  105,
-       44,   44,   44,   49,  366,   46,  104,  366,  366,   49,
-      366,  366,  107,  366,  366,   49,  366,  366,   44,   44,
-       44,  366,  108,   46,  106,   73,   73,   73,   73,  366,
-      366,  109,   49,  366,  366,  110,  111,  366,   68,   68,
-       68,   68,   73,   73,   73,   73,  366,  112,   66,  366,
-       49,  113,  366,  114,   64,  366,   65,   65,   65,   65,
-      366,  366,  366,   72,   66,   72,   66,  366,   73,   73,
-       73,   73,   64,  366,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   66,  366,   66,   44,   44,   44,   66,  366,
-       46,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-       66,  366,   46,  366,   66,  366,  366,  366,   44,   44,
-       44,  366,  366,   46,  366,  366,  366,   49,  366,   44,
-       44,   44,  366,   49,  131,  366,  125,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,  366,  366,  366,  366,
-       49,  366,  366,  126,  129,  129,  129,  129,  366,  366,
-      366,   49,  129,  129,  129,  129,  130,  366,   44,   44,
-       44,  366,   49,  134,  366,  366,  129,  129,  129,  129,
-      129,  129,  366,   44,   44,   44,  132,  133,   46,   44,
-
-       44,   44,  366,  366,   46,  366,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,   44,   44,
-       44,  366,  366,   46,  366,   49,  366,  366,  366,  135,
-      366,   49,   44,   44,   44,  366,  136,   46,   49,  366,
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,  366,  137,
-      138,  366,  366,  366,   49,  366,  366,  366,  140,  366,
-      139,  366,   49,  366,   44,   44,   44,  366,   49,   46,
-      366,  141,  366,  366,   49,  366,   44,   44,   44,  366,
-      144,   46,  366,  142,   44,   44,   44,  366,  366,   46,
-
-      366,  143,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,  366,   46,   44,   44,   44,  366,   49,   46,
-      145,  366,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,  366,   46,   49,  366,  366,  366,  146,  366,
-       49,  366,  366,  366,  147,  149,   49,  366,   44,   44,
-       44,  366,  150,   46,   49,  366,  148,  366,  151,  366,
-       49,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-      366,  152,   46,   44,   44,   44,  366,  366,   46,  366,
-       49,  366,  366,   44,   44,   44,  366,  153,   46,  366,
-      366,  366,  366,   49,  366,   44,   44,   44,  366,   49,
-
-       46,  366,  366,  366,  366,   49,  154,  366,  163,  366,
-      164,  165,  165,  165,  165,   49,  366,  366,  366,  165,
-      165,  165,  165,   44,   44,   44,  366,   49,   46,  167,
-      366,  366,  366,  165,  165,  165,  165,  165,  165,   44,
-       44,   44,  366,  366,   46,  366,  366,  166,   44,   44,
-       44,  366,  366,   46,  366,   49,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,   44,   44,
-       44,   49,  366,   46,  366,  168,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  366,  169,  366,   49,  366,  366,  170,  366,  366,
-
-       49,  366,  366,  366,  366,  366,  172,  171,   49,  366,
-       44,   44,   44,  366,   49,   46,  366,  173,  366,   44,
-       44,   44,  366,  175,   46,  366,  174,   44,   44,   44,
-      366,  366,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,   49,  366,   46,  176,  366,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  366,   46,   49,
-      366,  366,   44,   44,   44,   49,  179,   46,  366,  366,
-      177,   49,  180,  178,  366,   44,   44,   44,  366,   49,
-       46,  366,  182,  366,  366,   49,  366,  366,  181,  366,
-      366,  366,  183,  366,   49,   44,   44,   44,  366,  366,
-
-       46,  366,  366,   44,   44,   44,  184,   49,   46,   44,
-       44,   44,  366,  366,   46,  366,  366,   44,   44,   44,
-      366,  366,   46,  185,   44,   44,   44,   49,  366,   46,
-      366,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  186,  197,   46,   49,
-      366,  366,  366,  366,  366,  366,   49,  366,  187,  188,
-      189,  366,  366,   49,  366,  366,  366,  194,  366,   49,
-      366,  366,  366,  366,  366,   49,  366,  366,  366,  195,
-      196,  196,  196,  196,  200,  366,  366,  366,  196,  196,
-      196,  196,   44,   44,   44,  366,  366,   46,  366,  366,
-
-      366,  366,  196,  196,  196,  196,  196,  196,   44,   44,
-       44,  366,  366,   46,   44,   44,   44,  366,  366,   46,
-       44,   44,   44,  366,   49,   46,  366,  366,  366,  201,
-      202,  198,   44,   44,   44,  366,  366,   46,  366,  366,
-       49,  366,   44,   44,   44,  366,   49,  205,  366,   44,
-       44,   44,   49,  366,   46,   44,   44,   44,  199,  366,
-       46,  366,  203,  366,   49,   44,   44,   44,  366,  366,
-       46,   44,   44,   44,   49,  366,   46,   44,   44,   44,
-      366,   49,   46,  204,  206,  366,  366,   49,   44,   44,
-       44,  366,  366,   46,  207,  366,  366,   49,  366,   44,
-
-       44,   44,  366,   49,  212,  366,  208,  366,  366,   49,
-       44,   44,   44,  366,  209,   46,  210,  366,  366,  366,
-       49,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-      366,   49,   46,  211,   44,   44,   44,  366,  366,   46,
-      366,  366,   49,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,   49,   46,   44,   44,   44,  366,   49,
-      219,  366,  366,  213,  366,  366,   49,  214,  366,   44,
-       44,   44,  366,  216,   46,   49,  366,  215,  366,  220,
-      366,   49,  366,   44,   44,   44,  218,   49,   46,  366,
-       44,   44,   44,  366,  366,   46,  217,   44,   44,   44,
-
-      366,   49,   46,  366,   44,   44,   44,  366,  366,   46,
-      366,   44,   44,   44,  366,   49,   46,  366,   44,   44,
-       44,  221,   49,   46,  366,  366,  366,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,   49,  224,  366,  366,
-      366,  366,  366,   49,  225,   45,   45,   45,   45,  366,
-       49,  366,  366,   45,   45,   45,   45,  226,  227,   44,
-       44,   44,   49,  366,  230,  366,  228,   45,   45,   45,
-       45,   45,   45,  366,  366,  229,   44,   44,   44,  366,
-      366,  231,   44,   44,   44,  366,  366,  232,   44,   44,
-       44,   49,  366,   46,   44,   44,   44,  366,  233,   46,
-
-       44,   44,   44,  366,  366,   46,  366,  366,   49,  366,
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,   49,  239,   44,   44,   44,  366,  366,   46,
-      366,  366,   49,  366,  234,  366,  366,  366,   49,  236,
-      235,   44,   44,   44,   49,  366,   46,   44,   44,   44,
-       49,  366,   46,   44,   44,   44,   49,  366,   46,   44,
-       44,   44,  238,  237,   46,   44,   44,   44,  366,  366,
-       46,  366,  366,   49,  366,  366,  240,  366,  366,   49,
-      241,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-
-      242,   49,   46,   44,   44,   44,  366,   49,   46,   44,
-       44,   44,  366,  366,   46,  243,  366,  366,  366,  366,
-      366,  244,  366,   49,  366,  245,  366,  366,  246,   49,
-      366,  366,  247,  366,  366,   49,  366,   44,   44,   44,
-      366,   49,   46,  366,  249,   44,   44,   44,  366,  250,
-       46,   44,   44,   44,  366,  366,   46,  366,  366,   44,
-       44,   44,  366,  366,   46,  366,  366,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,  366,   49,  366,   44,
-       44,   44,  366,   49,   46,  366,  251,   44,   44,   44,
-      366,   49,   46,  366,  366,  366,  253,  252,  254,   44,
-
-       44,   44,   49,  366,   46,  366,  366,   44,   44,   44,
-      366,   49,   46,  366,  366,  255,   44,   44,   44,   49,
-      366,  260,   44,   44,   44,  366,  366,  261,   44,   44,
-       44,   49,  366,   46,  366,  256,  366,  258,  257,   49,
-       44,   44,   44,  366,  366,   46,  259,  366,   49,  366,
-       44,   44,   44,  366,   49,  266,  262,   44,   44,   44,
-       49,  366,   46,   44,   44,   44,  366,  265,   46,   44,
-       44,   44,   49,  366,   46,  366,   44,   44,   44,  366,
-      263,   46,   49,   44,   44,   44,  366,  366,  270,   49,
-      366,  366,  264,  366,  366,   49,  366,   44,   44,   44,
-
-      366,   49,  271,  366,  366,  366,  267,  366,   49,   44,
-       44,   44,  366,  366,   46,   49,  366,  268,   44,   44,
-       44,  366,  366,  273,  366,   44,   44,   44,  269,   49,
-       46,   44,   44,   44,  366,  274,   46,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  272,  277,  366,
-       49,   44,   44,   44,  366,  366,  278,   49,  366,  366,
-       44,   44,   44,   49,  366,   46,   44,   44,   44,   49,
-      279,  280,   44,   44,   44,   49,  366,   46,  366,  366,
-      276,  366,  366,   49,  366,  275,   44,   44,   44,  366,
-      366,   46,   49,  366,   44,   44,   44,  366,   49,   46,
-
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,   49,  366,
-      281,  366,   44,   44,   44,  282,   49,   46,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,   49,   46,
-      366,  366,  287,  366,   49,  366,  366,  284,  366,  366,
-      283,  366,  285,  286,   49,  366,  366,  366,  366,  288,
-       49,  289,  366,  290,  366,  366,   49,   44,   44,   44,
-      366,  366,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,  366,   46,  291,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,  366,   49,
-
-      366,  366,   44,   44,   44,   49,  292,  297,  366,  293,
-      366,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-       44,   44,   44,  366,   49,   46,  366,   44,   44,   44,
-      294,  366,   46,  366,   49,  295,   44,   44,   44,  366,
-      366,   46,  296,  366,   49,  366,  366,  298,   44,   44,
-       44,  366,   49,   46,  366,   44,   44,   44,  366,   49,
-       46,   44,   44,   44,  366,  303,   46,  366,   49,   44,
-       44,   44,  366,  366,   46,  301,  299,  300,  366,  366,
-       49,  366,  366,   44,   44,   44,  366,   49,   46,   44,
-       44,   44,  366,   49,   46,  366,  366,   44,   44,   44,
-
-      302,   49,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,  304,   46,   49,  366,  305,   44,   44,
-       44,   49,  366,   46,  366,   44,   44,   44,  306,   49,
-       46,  366,  366,  366,  366,   49,  308,  366,  366,  307,
-      366,   49,  366,   44,   44,   44,  366,  366,   46,  366,
-       49,   44,   44,   44,  366,  309,   46,   49,  366,  366,
-      310,  314,  366,  366,  311,   44,   44,   44,  366,  366,
-       46,   44,   44,   44,  312,   49,   46,   44,   44,   44,
-      366,  366,   46,   49,  366,   44,   44,   44,  313,  366,
-       46,   44,   44,   44,  366,  366,  319,   49,  366,  366,
-
-       44,   44,   44,   49,  315,   46,  366,  366,  316,   49,
-       44,   44,   44,  366,  366,   46,  317,   49,  366,   44,
-       44,   44,  318,   49,   46,   44,   44,   44,  366,  366,
-      323,  366,   49,  366,  366,  320,   44,   44,   44,  366,
-      366,   46,   49,  366,   44,   44,   44,  366,  366,   46,
-      366,   49,  366,   44,   44,   44,  366,   49,  326,  366,
-      321,  366,  322,  366,   44,   44,   44,  366,   49,   46,
-      366,  366,   44,   44,   44,  324,   49,   46,  366,   44,
-       44,   44,  366,  325,   46,   49,   44,   44,   44,  366,
-      366,  330,   44,   44,   44,  366,   49,   46,   44,   44,
-
-       44,  327,  366,   46,   49,   44,   44,   44,  366,  366,
-       46,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  329,  366,  366,   49,  366,  366,  328,  366,  366,
-       49,  366,  366,   44,   44,   44,  331,   49,  335,  366,
-       44,   44,   44,  366,   49,  336,  366,  366,  332,   44,
-       44,   44,  366,  366,   46,  366,   44,   44,   44,  333,
-      334,   46,   44,   44,   44,   49,  366,   46,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,  366,   46,
-      366,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  337,  366,  366,   49,  366,  366,  339,  366,  366,
-
-       49,  366,  366,  366,  366,  366,   49,  340,  338,  366,
-       44,   44,   44,  366,   49,   46,  366,  341,   44,   44,
-       44,  342,  366,   46,   44,   44,   44,  366,  366,  345,
-       44,   44,   44,  366,  366,   46,   44,   44,   44,  366,
-      366,   46,   49,   44,   44,   44,  366,  366,   46,  366,
-       49,  366,  366,  344,  366,  366,   49,  343,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,   49,   46,
-      366,   44,   44,   44,  366,   49,   46,  346,   44,   44,
-       44,  366,  348,   46,   44,   44,   44,  366,  347,  353,
-       49,  366,   44,   44,   44,  366,   49,   46,  366,   44,
-
-       44,   44,  366,   49,   46,  366,  366,  366,  349,  366,
-       49,  366,   44,   44,   44,  350,   49,  356,  351,  352,
-       44,   44,   44,  366,   49,   46,  366,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  366,  359,  366,
-       44,   44,   44,  354,   49,  360,   44,   44,   44,  366,
-      355,   46,   49,  366,  366,   44,   44,   44,  366,   49,
-       46,  357,   44,   44,   44,   49,  358,   46,   44,   44,
-       44,  366,   49,  364,  366,   44,   44,   44,   49,  366,
-      365,  366,  366,  366,  366,  361,  366,   49,  366,  366,
-      366,  366,  366,  366,   49,  366,  366,  366,  366,  366,
-
-       49,  366,  366,  366,  366,  366,  362,   49,  366,  366,
-      366,  366,  366,  363,   36,   36,   36,   36,   36,   36,
-       36,   45,   45,   45,   45,   45,   45,   45,   63,  366,
-       63,   63,   63,   63,   63,   82,  366,   82,  366,   82,
-       82,   82,   84,   84,   84,   84,   84,   84,   84,   89,
-       89,   89,   89,   89,   89,   89,  115,  366,  115,  115,
-      115,  115,  115,   84,   84,  366,   84,  127,  127,  127,
-      127,  127,  162,  162,  193,  193,  223,  223,   84,   84,
-       11,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+       11,   12,   13,   14,   13,   12,   15,   16,   12,   17,
+       18,   19,   20,   21,   22,   22,   22,   22,   23,   24,
+       12,   12,   12,   12,   25,   26,   12,   27,   12,   12,
+       28,   12,   29,   12,   30,   12,   12,   12,   12,   12,
+       25,   31,   12,   12,   12,   12,   12,   12,   32,   12,
+       12,   12,   12,   12,   33,   12,   12,   12,   12,   12,
+       12,   34,   35,   11,   36,   37,   14,   37,   36,   36,
+       36,   38,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   11,   12,   13,   14,
+       13,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       39,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   11,
+       44,   44,   44,   45,   45,   46,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   47,   48,   45,   45,   45,
+       45,   45,   49,   45,   45,   50,   51,   52,   53,   45,
+       54,   45,   55,   45,   45,   56,   57,   58,   59,   60,
+       61,   45,   62,   45,   63,   64,   45,   45,   45,   45,
+       45,   45,   11,   44,   44,   44,   44,   44,   85,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   86,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   11,   44,   44,   44,   45,
+       45,   46,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   49,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   11,   89,
+       89,   89,   89,   89,   90,   89,   89,   89,   89,   89,
+       89,   45,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   45,   89,   89,   89,   45,   89,   89,   89,   45,
+       89,   89,   89,   89,   89,   89,   45,   89,   89,   89,
+       45,   89,   45,   91,   89,   89,   89,   89,   89,   89,
+       89,   11,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,  130,  130,  130,  130,   89,
+       89,   89,   89,  130,  130,  130,  130,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,  130,  130,  130,
+      130,  130,  130,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   11,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,  169,  169,
+      169,  169,   89,   89,   89,   89,  169,  169,  169,  169,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+      169,  169,  169,  169,  169,  169,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   11,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,  203,  203,  203,  203,   89,   89,   89,   89,  203,
+      203,  203,  203,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,  203,  203,  203,  203,  203,  203,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       11,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   45,   45,   45,   45,   89,   89,
+       89,   89,   45,   45,   45,   45,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   45,   45,   45,   45,
+       45,   45,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   11,   65,   65,   11,   65,   65,   65,
+
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   11,   71,   71,   11,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   11,
+       83,   83,   11,   83,   83,   43,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   11,  107,  108,   11,   89,   89,  129,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   11,   11,   11,   42,   11,
+       42,   42,   11,   42,   42,   40,   42,   11,   11,  166,
+      166,  166,  166,   11,   11,   40,   70,  166,  166,  166,
+      166,   71,   73,   11,   73,   77,   11,   74,   74,   74,
+       74,  166,  166,  166,  166,  166,  166,  200,  200,  200,
+      200,   11,   11,   12,   11,  200,  200,  200,  200,   77,
+
+       73,   11,   73,   12,   41,   74,   74,   74,   74,  200,
+      200,  200,  200,  200,  200,  233,  233,  233,  233,   11,
+       11,  134,  135,  233,  233,  233,  233,   12,   11,   11,
+       11,  199,   96,   74,   74,   74,   74,  233,  233,  233,
+      233,  233,  233,   44,   44,   44,   44,   11,   77,   11,
+       75,   44,   44,   44,   44,   44,   11,   97,   41,   11,
+       98,   76,   44,   11,   75,   44,   44,   44,   44,   44,
+       44,   66,   80,   67,   67,   67,   67,   74,   74,   74,
+       74,   12,   44,   68,   11,   76,   44,   76,   11,   11,
+       44,   11,   11,   11,   43,   82,   11,   44,   11,   68,
+
+       11,   44,   11,   44,  126,   66,   11,   69,   69,   69,
+       69,   79,   11,   72,  118,  119,   84,   68,   66,   11,
+       69,   69,   69,   69,   66,   11,   67,   67,   67,   67,
+       68,  120,   11,   68,  118,  119,   68,   66,   11,   69,
+       69,   69,   69,   11,   11,   88,   68,   11,   11,   68,
+       11,   11,   68,   11,   75,  120,   11,   66,   66,   66,
+       66,   66,   66,   66,   66,   68,  111,   68,   78,  120,
+      118,   68,   11,   11,  119,  112,   11,  160,   11,  159,
+      113,  114,  159,   68,   11,  301,   11,   68,   11,   11,
+      121,  302,  303,  123,  122,  232,  161,  160,   94,  160,
+
+      161,   81,  197,  159,  100,  102,  162,  104,  197,  101,
+      103,   95,  161,  144,  209,  210,  164,  115,  197,  163,
+      105,   11,  116,  145,  198,  182,  274,  124,  183,   87,
+       92,   93,  165,   99,  106,  109,  110,  117,   11,   11,
+       11,   11,   11,   11,   11,  125,   11,  133,  136,   11,
+       11,   11,   11,   11,   11,  275,   11,   11,  213,  220,
+      229,  261,  236,  205,  230,  241,  242,  243,  244,  250,
+      254,   11,   11,   11,   11,   11,   11,   11,  137,  138,
+      142,  146,  149,  127,  143,  151,  153,  154,  147,  155,
+      132,  140,  156,  150,  157,  128,  139,  141,  148,  152,
+
+      131,  158,  167,  168,  170,  171,  172,  173,  174,  175,
+      176,  177,  178,  179,  180,  181,  184,  185,  186,  187,
+      188,  189,  190,  191,  192,  193,  194,  195,  196,  201,
+      202,  204,  206,  207,  208,  211,  212,  214,  215,  216,
+      217,  218,  219,  221,  222,  223,  224,  225,  226,  227,
+      228,  231,  234,  235,  237,  238,  239,  240,  245,  246,
+      247,  248,  249,  251,  252,  253,  255,  256,  257,  258,
+      259,  260,  262,  263,  264,  265,  266,  267,  268,  269,
+      270,  271,  272,  273,  276,  277,  278,  279,  280,  281,
+      282,  283,  284,  285,  286,  287,  288,  289,  290,  291,
+
+      292,  293,  294,  295,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,  313,  316,
+      339,  343,  344,  322,  347,  334,  351,  356,  357,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,  366,  374,
+      377,  380,  381,  304,  307,  298,  306,  310,  317,  299,
+      309,  340,  320,  327,  296,  305,  330,  335,  325,  336,
+      333,  324,  297,  308,  300,  311,  312,  314,  319,  321,
+      323,  318,  315,  326,  328,  329,  331,  332,  337,  338,
+      341,  342,  345,  346,  348,  349,  350,  352,  353,  354,
+      355,  358,  359,  360,  361,  362,  363,  364,  365,  367,
+
+      368,  369,  370,  371,  372,  373,  375,  376,  378,  379,
+      382,  383,  384,  385,  386,   11,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387
     } ;
 
-static const flex_int16_t yy_chk[2542] =
+static const flex_int16_t yy_chk[1642] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1168,280 +1074,181 @@ static const flex_int16_t yy_chk[2542] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    3,    9,    7,    4,
-        5,    5,    8,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,   10,   13,   26,   13,    5,    5,
-        9,    5,   21,   37,    5,   37,    5,   21,    5,   27,
-
-       26,   31,   44,  222,    5,    5,    7,   10,    5,   28,
-        8,   42,    5,   42,   32,   31,   17,    5,   17,   17,
-       17,   17,   27,    5,    5,   15,   15,   15,   17,   44,
-       15,   19,   28,   19,   19,   19,   19,   32,   20,   20,
-       20,   20,  192,   19,   17,   33,   74,   25,   20,   25,
-       15,   15,   25,   25,   25,   25,  161,   15,   76,   19,
-      127,   15,   15,   15,   20,   15,   74,   15,   33,   75,
-       15,   15,   15,   15,   15,  122,   15,   77,   15,   15,
-       22,   76,   22,   22,   22,   22,   45,   45,   45,   75,
-       79,   45,   22,   47,   47,   47,   78,   77,   47,   48,
-
-       48,   48,   49,   84,   48,  116,  117,  118,   22,   49,
-       50,   50,   50,   79,   89,   50,   78,  119,   45,   51,
-       51,   51,   86,  118,   51,   47,  117,  121,  116,   49,
-       84,   48,  120,   49,   52,   52,   52,   49,   48,   52,
-      119,   47,   50,  121,   49,  155,  158,   49,   52,   49,
-       49,   51,  120,   82,   51,   53,   53,   53,   50,   81,
-       53,  155,  158,   54,   54,   54,   52,   51,   54,   55,
-       55,   55,   43,   52,   55,   41,   52,   39,   56,   56,
-       56,   38,   24,   56,   57,   57,   57,   53,   14,   57,
-       11,   58,   58,   58,    0,   54,   58,   59,   59,   59,
-
-       53,   55,   59,   60,   60,   60,    0,    0,   60,    0,
-       56,   54,   55,   56,    0,   54,   57,   55,    0,   57,
-       61,   61,   61,   58,    0,   61,   56,    0,    0,   59,
-        0,    0,   59,    0,    0,   60,    0,    0,   62,   62,
-       62,    0,   60,   62,   58,   72,   72,   72,   72,    0,
-        0,   60,   61,    0,    0,   60,   60,    0,   64,   64,
-       64,   64,   73,   73,   73,   73,    0,   61,   64,    0,
-       62,   61,    0,   62,   65,    0,   65,   65,   65,   65,
-        0,    0,    0,   66,   64,   66,   65,    0,   66,   66,
-       66,   66,   67,    0,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   65,    0,   67,   87,   87,   87,   68,    0,
-       87,   88,   88,   88,    0,    0,   88,   90,   90,   90,
-       67,    0,   90,    0,   68,    0,    0,    0,   92,   92,
-       92,    0,    0,   92,    0,    0,    0,   87,    0,   93,
-       93,   93,    0,   88,   93,    0,   87,    0,    0,   90,
-       94,   94,   94,    0,    0,   94,    0,    0,    0,    0,
-       92,    0,    0,   88,   91,   91,   91,   91,    0,    0,
-        0,   93,   91,   91,   91,   91,   92,    0,   95,   95,
-       95,    0,   94,   95,    0,    0,   91,   91,   91,   91,
-       91,   91,    0,   96,   96,   96,   94,   94,   96,   97,
-
-       97,   97,    0,    0,   97,    0,   98,   98,   98,    0,
-       95,   98,   99,   99,   99,    0,    0,   99,  100,  100,
-      100,    0,    0,  100,    0,   96,    0,    0,    0,   96,
-        0,   97,  101,  101,  101,    0,   97,  101,   98,    0,
-      102,  102,  102,    0,   99,  102,  103,  103,  103,    0,
-      100,  103,  104,  104,  104,    0,    0,  104,    0,   98,
-       99,    0,    0,    0,  101,    0,    0,    0,  101,    0,
-      100,    0,  102,    0,  105,  105,  105,    0,  103,  105,
-        0,  102,    0,    0,  104,    0,  106,  106,  106,    0,
-      104,  106,    0,  103,  107,  107,  107,    0,    0,  107,
-
-        0,  103,  108,  108,  108,    0,  105,  108,  109,  109,
-      109,    0,    0,  109,  110,  110,  110,    0,  106,  110,
-      105,    0,  111,  111,  111,    0,  107,  111,  112,  112,
-      112,    0,    0,  112,  108,    0,    0,    0,  106,    0,
-      109,    0,    0,    0,  107,  109,  110,    0,  113,  113,
-      113,    0,  110,  113,  111,    0,  108,    0,  111,    0,
-      112,  114,  114,  114,    0,    0,  114,  125,  125,  125,
-        0,  112,  125,  126,  126,  126,    0,    0,  126,    0,
-      113,    0,    0,  132,  132,  132,    0,  113,  132,    0,
-        0,    0,    0,  114,    0,  130,  130,  130,    0,  125,
-
-      130,    0,    0,    0,    0,  126,  114,    0,  125,    0,
-      126,  129,  129,  129,  129,  132,    0,    0,    0,  129,
-      129,  129,  129,  133,  133,  133,    0,  130,  133,  132,
-        0,    0,    0,  129,  129,  129,  129,  129,  129,  135,
-      135,  135,    0,    0,  135,    0,    0,  130,  136,  136,
-      136,    0,    0,  136,    0,  133,  137,  137,  137,    0,
-        0,  137,  138,  138,  138,    0,    0,  138,  139,  139,
-      139,  135,    0,  139,    0,  133,  140,  140,  140,    0,
-      136,  140,  141,  141,  141,    0,    0,  141,  137,    0,
-        0,    0,  135,    0,  138,    0,    0,  136,    0,    0,
-
-      139,    0,    0,    0,    0,    0,  138,  137,  140,    0,
-      142,  142,  142,    0,  141,  142,    0,  139,    0,  143,
-      143,  143,    0,  141,  143,    0,  140,  144,  144,  144,
-        0,    0,  144,  145,  145,  145,    0,    0,  145,  146,
-      146,  146,  142,    0,  146,  142,    0,  147,  147,  147,
-        0,  143,  147,  148,  148,  148,    0,    0,  148,  144,
-        0,    0,  149,  149,  149,  145,  144,  149,    0,    0,
-      143,  146,  145,  143,    0,  150,  150,  150,    0,  147,
-      150,    0,  147,    0,    0,  148,    0,    0,  146,    0,
-        0,    0,  148,    0,  149,  151,  151,  151,    0,    0,
-
-      151,    0,    0,  152,  152,  152,  149,  150,  152,  153,
-      153,  153,    0,    0,  153,    0,    0,  154,  154,  154,
-        0,    0,  154,  150,  163,  163,  163,  151,    0,  163,
-        0,  164,  164,  164,    0,  152,  164,  166,  166,  166,
-        0,  153,  166,  169,  169,  169,  151,  166,  169,  154,
-        0,    0,    0,    0,    0,    0,  163,    0,  152,  153,
-      154,    0,    0,  164,    0,    0,    0,  163,    0,  166,
-        0,    0,    0,    0,    0,  169,    0,    0,    0,  164,
-      165,  165,  165,  165,  169,    0,    0,    0,  165,  165,
-      165,  165,  167,  167,  167,    0,    0,  167,    0,    0,
-
-        0,    0,  165,  165,  165,  165,  165,  165,  168,  168,
-      168,    0,    0,  168,  170,  170,  170,    0,    0,  170,
-      171,  171,  171,    0,  167,  171,    0,    0,    0,  170,
-      170,  167,  172,  172,  172,    0,    0,  172,    0,    0,
-      168,    0,  173,  173,  173,    0,  170,  173,    0,  174,
-      174,  174,  171,    0,  174,  175,  175,  175,  168,    0,
-      175,    0,  171,    0,  172,  176,  176,  176,    0,    0,
-      176,  177,  177,  177,  173,    0,  177,  178,  178,  178,
-        0,  174,  178,  172,  174,    0,    0,  175,  179,  179,
-      179,    0,    0,  179,  175,    0,    0,  176,    0,  180,
-
-      180,  180,    0,  177,  180,    0,  176,    0,    0,  178,
-      181,  181,  181,    0,  177,  181,  178,    0,    0,    0,
-      179,  182,  182,  182,    0,    0,  182,  183,  183,  183,
-        0,  180,  183,  179,  184,  184,  184,    0,    0,  184,
-        0,    0,  181,  185,  185,  185,    0,    0,  185,  186,
-      186,  186,    0,  182,  186,  187,  187,  187,    0,  183,
-      187,    0,    0,  181,    0,    0,  184,  182,    0,  188,
-      188,  188,    0,  184,  188,  185,    0,  183,    0,  188,
-        0,  186,    0,  189,  189,  189,  186,  187,  189,    0,
-      194,  194,  194,    0,    0,  194,  185,  195,  195,  195,
-
-        0,  188,  195,    0,  197,  197,  197,    0,    0,  197,
-        0,  198,  198,  198,    0,  189,  198,    0,  199,  199,
-      199,  189,  194,  199,    0,    0,    0,    0,    0,  195,
-      200,  200,  200,    0,    0,  200,  197,  194,    0,    0,
-        0,    0,    0,  198,  195,  196,  196,  196,  196,    0,
-      199,    0,    0,  196,  196,  196,  196,  197,  198,  201,
-      201,  201,  200,    0,  201,    0,  199,  196,  196,  196,
-      196,  196,  196,    0,    0,  200,  202,  202,  202,    0,
-        0,  202,  203,  203,  203,    0,    0,  203,  204,  204,
-      204,  201,    0,  204,  206,  206,  206,    0,  204,  206,
-
-      207,  207,  207,    0,    0,  207,    0,    0,  202,    0,
-      208,  208,  208,    0,  203,  208,  209,  209,  209,    0,
-      204,  209,  210,  210,  210,    0,  206,  210,  211,  211,
-      211,    0,  207,  211,  213,  213,  213,    0,    0,  213,
-        0,    0,  208,    0,  206,    0,    0,    0,  209,  208,
-      207,  214,  214,  214,  210,    0,  214,  215,  215,  215,
-      211,    0,  215,  216,  216,  216,  213,    0,  216,  217,
-      217,  217,  210,  209,  217,  218,  218,  218,    0,    0,
-      218,    0,    0,  214,    0,    0,  213,    0,    0,  215,
-      214,  220,  220,  220,    0,  216,  220,  221,  221,  221,
-
-      215,  217,  221,  224,  224,  224,    0,  218,  224,  225,
-      225,  225,    0,    0,  225,  216,    0,    0,    0,    0,
-        0,  217,    0,  220,    0,  218,    0,    0,  220,  221,
-        0,    0,  221,    0,    0,  224,    0,  226,  226,  226,
-        0,  225,  226,    0,  224,  227,  227,  227,    0,  225,
-      227,  228,  228,  228,    0,    0,  228,    0,    0,  229,
-      229,  229,    0,    0,  229,    0,    0,    0,    0,  226,
-      233,  233,  233,    0,    0,  233,    0,  227,    0,  234,
-      234,  234,    0,  228,  234,    0,  226,  235,  235,  235,
-        0,  229,  235,    0,    0,    0,  228,  227,  229,  236,
-
-      236,  236,  233,    0,  236,    0,    0,  237,  237,  237,
-        0,  234,  237,    0,    0,  233,  238,  238,  238,  235,
-        0,  238,  240,  240,  240,    0,    0,  240,  241,  241,
-      241,  236,    0,  241,    0,  234,    0,  236,  235,  237,
-      242,  242,  242,    0,    0,  242,  237,    0,  238,    0,
-      244,  244,  244,    0,  240,  244,  240,  243,  243,  243,
-      241,    0,  243,  245,  245,  245,    0,  243,  245,  246,
-      246,  246,  242,    0,  246,    0,  247,  247,  247,    0,
-      241,  247,  244,  249,  249,  249,    0,    0,  249,  243,
-        0,    0,  242,    0,    0,  245,    0,  250,  250,  250,
-
-        0,  246,  250,    0,    0,    0,  245,    0,  247,  251,
-      251,  251,    0,    0,  251,  249,    0,  246,  252,  252,
-      252,    0,    0,  252,    0,  253,  253,  253,  247,  250,
-      253,  254,  254,  254,    0,  253,  254,  255,  255,  255,
-        0,  251,  255,  256,  256,  256,    0,  251,  256,    0,
-      252,  257,  257,  257,    0,    0,  257,  253,    0,    0,
-      258,  258,  258,  254,    0,  258,  259,  259,  259,  255,
-      258,  259,  262,  262,  262,  256,    0,  262,    0,    0,
-      255,    0,    0,  257,    0,  254,  263,  263,  263,    0,
-        0,  263,  258,    0,  264,  264,  264,    0,  259,  264,
-
-      265,  265,  265,    0,  262,  265,  267,  267,  267,    0,
-        0,  267,  268,  268,  268,    0,    0,  268,  263,    0,
-      262,    0,  269,  269,  269,  263,  264,  269,  272,  272,
-      272,    0,  265,  272,  274,  274,  274,    0,  267,  274,
-        0,    0,  267,    0,  268,    0,    0,  265,    0,    0,
-      264,    0,  265,  265,  269,    0,    0,    0,    0,  268,
-      272,  269,    0,  272,    0,    0,  274,  275,  275,  275,
-        0,    0,  275,  276,  276,  276,    0,    0,  276,  279,
-      279,  279,    0,    0,  279,  274,  281,  281,  281,    0,
-        0,  281,  282,  282,  282,    0,    0,  282,    0,  275,
-
-        0,    0,  283,  283,  283,  276,  275,  283,    0,  276,
-        0,  279,  284,  284,  284,    0,    0,  284,  281,    0,
-      285,  285,  285,    0,  282,  285,    0,  286,  286,  286,
-      279,    0,  286,    0,  283,  281,  287,  287,  287,    0,
-        0,  287,  282,    0,  284,    0,    0,  284,  288,  288,
-      288,    0,  285,  288,    0,  289,  289,  289,    0,  286,
-      289,  290,  290,  290,    0,  289,  290,    0,  287,  291,
-      291,  291,    0,    0,  291,  287,  285,  286,    0,    0,
-      288,    0,    0,  292,  292,  292,    0,  289,  292,  293,
-      293,  293,    0,  290,  293,    0,    0,  294,  294,  294,
-
-      288,  291,  294,  295,  295,  295,    0,    0,  295,  296,
-      296,  296,    0,  290,  296,  292,    0,  291,  298,  298,
-      298,  293,    0,  298,    0,  299,  299,  299,  292,  294,
-      299,    0,    0,    0,    0,  295,  294,    0,    0,  293,
-        0,  296,    0,  300,  300,  300,    0,    0,  300,    0,
-      298,  301,  301,  301,    0,  295,  301,  299,    0,    0,
-      296,  301,    0,    0,  298,  302,  302,  302,    0,    0,
-      302,  303,  303,  303,  299,  300,  303,  304,  304,  304,
-        0,    0,  304,  301,    0,  305,  305,  305,  300,    0,
-      305,  306,  306,  306,    0,    0,  306,  302,    0,    0,
-
-      307,  307,  307,  303,  302,  307,    0,    0,  303,  304,
-      308,  308,  308,    0,    0,  308,  304,  305,    0,  309,
-      309,  309,  305,  306,  309,  310,  310,  310,    0,    0,
-      310,    0,  307,    0,    0,  307,  311,  311,  311,    0,
-        0,  311,  308,    0,  312,  312,  312,    0,    0,  312,
-        0,  309,    0,  313,  313,  313,    0,  310,  313,    0,
-      308,    0,  309,    0,  314,  314,  314,    0,  311,  314,
-        0,    0,  315,  315,  315,  311,  312,  315,    0,  316,
-      316,  316,    0,  312,  316,  313,  317,  317,  317,    0,
-        0,  317,  318,  318,  318,    0,  314,  318,  320,  320,
-
-      320,  314,    0,  320,  315,  321,  321,  321,    0,    0,
-      321,  316,  322,  322,  322,    0,    0,  322,  317,    0,
-        0,  316,    0,    0,  318,    0,    0,  315,    0,    0,
-      320,    0,    0,  324,  324,  324,  318,  321,  324,    0,
-      325,  325,  325,    0,  322,  325,    0,    0,  320,  327,
-      327,  327,    0,    0,  327,    0,  328,  328,  328,  321,
-      322,  328,  329,  329,  329,  324,    0,  329,  331,  331,
-      331,    0,  325,  331,  332,  332,  332,    0,    0,  332,
-        0,  327,  333,  333,  333,    0,    0,  333,  328,    0,
-        0,  327,    0,    0,  329,    0,    0,  329,    0,    0,
-
-      331,    0,    0,    0,    0,    0,  332,  331,  328,    0,
-      334,  334,  334,    0,  333,  334,    0,  332,  337,  337,
-      337,  333,    0,  337,  338,  338,  338,    0,    0,  338,
-      339,  339,  339,    0,    0,  339,  340,  340,  340,    0,
-        0,  340,  334,  341,  341,  341,    0,    0,  341,    0,
-      337,    0,    0,  337,    0,    0,  338,  334,  342,  342,
-      342,    0,  339,  342,  343,  343,  343,    0,  340,  343,
-        0,  344,  344,  344,    0,  341,  344,  339,  346,  346,
-      346,    0,  341,  346,  347,  347,  347,    0,  340,  347,
-      342,    0,  348,  348,  348,    0,  343,  348,    0,  349,
-
-      349,  349,    0,  344,  349,    0,    0,    0,  342,    0,
-      346,    0,  350,  350,  350,  343,  347,  350,  344,  346,
-      351,  351,  351,    0,  348,  351,    0,  352,  352,  352,
-        0,  349,  352,  354,  354,  354,    0,    0,  354,    0,
-      355,  355,  355,  348,  350,  355,  357,  357,  357,    0,
-      349,  357,  351,    0,    0,  358,  358,  358,    0,  352,
-      358,  351,  361,  361,  361,  354,  352,  361,  362,  362,
-      362,    0,  355,  362,    0,  363,  363,  363,  357,    0,
-      363,    0,    0,    0,    0,  357,    0,  358,    0,    0,
-        0,    0,    0,    0,  361,    0,    0,    0,    0,    0,
-
-      362,    0,    0,    0,    0,    0,  358,  363,    0,    0,
-        0,    0,    0,  361,  367,  367,  367,  367,  367,  367,
-      367,  368,  368,  368,  368,  368,  368,  368,  369,    0,
-      369,  369,  369,  369,  369,  370,    0,  370,    0,  370,
-      370,  370,  371,  371,  371,  371,  371,  371,  371,  372,
-      372,  372,  372,  372,  372,  372,  373,    0,  373,  373,
-      373,  373,  373,  374,  374,    0,  374,  375,  375,  375,
-      375,  375,  376,  376,  377,  377,  378,  378,  379,  379,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+        1,    1,    1,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+
+       91,   91,   91,   91,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  169,  169,  169,
+      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+
+      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+      169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,  203,  203,  203,  203,  203,  203,  203,
+      203,  203,  203,   16,   16,   16,   12,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   71,   71,   71,   18,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   40,
+       40,   40,   14,   40,   40,   14,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   89,   59,   59,   23,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,  126,   13,   28,   13,   37,
+       13,   37,   42,   37,   42,    7,   42,   29,   21,  126,
+      126,  126,  126,   25,   30,    8,   21,  126,  126,  126,
+      126,   21,   25,  166,   25,   28,  165,   25,   25,   25,
+       25,  126,  126,  126,  126,  126,  126,  166,  166,  166,
+      166,   68,   34,    7,   35,  166,  166,  166,  166,   28,
+
+       68,  200,   68,    8,    9,   68,   68,   68,   68,  166,
+      166,  166,  166,  166,  166,  200,  200,  200,  200,   73,
+       33,   95,   95,  200,  200,  200,  200,    9,   26,  233,
+       27,  165,   53,   73,   73,   73,   73,  200,  200,  200,
+      200,  200,  200,  233,  233,  233,  233,   39,   33,   86,
+       26,  233,  233,  233,  233,   86,   32,   53,   10,   17,
+       53,   27,   86,   74,   26,  233,  233,  233,  233,  233,
+      233,   17,   33,   17,   17,   17,   17,   74,   74,   74,
+       74,   10,   86,   17,   36,   27,   86,   32,   75,   76,
+       86,   43,   24,   19,   43,   39,   41,   86,   46,   17,
+
+       77,   86,   70,   86,   86,   19,   22,   19,   19,   19,
+       19,   32,   67,   24,   75,   76,   41,   19,   22,   72,
+       22,   22,   22,   22,   67,   69,   67,   67,   67,   67,
+       22,   77,   31,   19,   75,   76,   67,   69,   80,   69,
+       69,   69,   69,   20,   78,   48,   22,   66,   79,   69,
+      118,  119,   67,  121,   31,   77,  199,   20,   20,   20,
+       20,   66,   66,   66,   66,   69,   62,   20,   31,   80,
+       78,   66,  120,  122,   79,   62,  123,  119,  159,  118,
+       62,   62,  121,   20,  162,  280,  124,   66,   38,   82,
+       78,  280,  280,   80,   79,  199,  120,  119,   52,  122,
+
+      123,   38,  159,  118,   55,   56,  121,   57,  162,   55,
+       56,   52,  120,  104,  175,  175,  123,   63,  159,  122,
+       57,  232,   63,  104,  162,  145,  251,   82,  145,   47,
+       50,   51,  124,   54,   58,   60,   61,   64,   81,   84,
+       85,  125,  129,  133,  136,   83,  160,   94,   96,  161,
+      163,  164,  197,  198,  213,  251,  220,  229,  178,  185,
+      194,  232,  204,  171,  195,  209,  210,  211,  212,  219,
+      224,  236,  241,  242,  243,  250,  261,  273,   97,   98,
+      102,  105,  108,   87,  103,  110,  112,  113,  106,  114,
+       93,  100,  115,  109,  116,   88,   99,  101,  107,  111,
+
+       92,  117,  127,  128,  131,  132,  134,  135,  137,  138,
+      139,  140,  141,  142,  143,  144,  146,  147,  148,  149,
+      150,  151,  152,  153,  154,  155,  156,  157,  158,  167,
+      168,  170,  172,  173,  174,  176,  177,  179,  180,  181,
+      182,  183,  184,  186,  187,  188,  189,  190,  191,  192,
+      193,  196,  201,  202,  205,  206,  207,  208,  214,  215,
+      216,  217,  218,  221,  222,  223,  225,  226,  227,  228,
+      230,  231,  234,  235,  237,  238,  239,  240,  244,  245,
+      246,  247,  248,  249,  252,  253,  254,  255,  256,  257,
+      258,  259,  260,  262,  263,  264,  265,  266,  267,  268,
+
+      269,  270,  271,  272,  274,  281,  285,  286,  288,  292,
+      293,  295,  313,  316,  339,  343,  344,  347,  297,  300,
+      325,  329,  330,  306,  333,  320,  337,  345,  346,  351,
+      356,  357,  366,  374,  377,  380,  381,  385,  359,  368,
+      371,  375,  376,  282,  287,  277,  284,  291,  301,  278,
+      290,  326,  304,  311,  275,  283,  315,  321,  309,  322,
+      319,  308,  276,  289,  279,  294,  296,  298,  303,  305,
+      307,  302,  299,  310,  312,  314,  317,  318,  323,  324,
+      327,  328,  331,  332,  334,  335,  336,  338,  340,  341,
+      342,  348,  349,  350,  352,  353,  354,  355,  358,  360,
+
+      361,  362,  363,  364,  365,  367,  369,  370,  372,  373,
+      378,  379,  382,  383,  384,  386,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1450,15 +1257,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[62] =
+static const flex_int16_t yy_rule_linenum[65] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  198,  210,  220,  230,  240,  249,  258,
       267,  276,  285,  294,  303,  312,  321,  330,  339,  348,
       357,  366,  375,  384,  393,  402,  411,  420,  429,  438,
-      447,  456,  465,  474,  573,  578,  583,  588,  589,  590,
-      591,  592,  593,  595,  613,  626,  631,  635,  637,  639,
-      641
+      447,  456,  465,  474,  483,  492,  501,  600,  605,  610,
+      615,  616,  617,  618,  619,  620,  622,  640,  653,  658,
+      662,  664,  666,  668
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1513,7 +1320,7 @@ using isc::netconf::NetconfParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::netconf::ParserContext::fatal(msg)
-#line 1516 "netconf_lexer.cc"
+#line 1323 "netconf_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1539,8 +1346,8 @@ using isc::netconf::NetconfParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1542 "netconf_lexer.cc"
-#line 1543 "netconf_lexer.cc"
+#line 1349 "netconf_lexer.cc"
+#line 1350 "netconf_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1854,7 +1661,7 @@ YY_DECL
     }
 
 
-#line 1857 "netconf_lexer.cc"
+#line 1664 "netconf_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1883,13 +1690,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 367 )
+				if ( yy_current_state >= 388 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 366 );
+		while ( yy_current_state != 387 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1908,13 +1715,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 62 )
+			else if ( yy_act < 65 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 62 )
+			else if ( yy_act == 65 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 63 )
+			else if ( yy_act == 66 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2390,6 +2197,42 @@ YY_RULE_SETUP
 case 42:
 YY_RULE_SETUP
 #line 456 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 465 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 474 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("overflow", driver.loc_);
+    }
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 483 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2399,9 +2242,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 46:
 YY_RULE_SETUP
-#line 465 "netconf_lexer.ll"
+#line 492 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2411,9 +2254,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 47:
 YY_RULE_SETUP
-#line 474 "netconf_lexer.ll"
+#line 501 "netconf_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2513,65 +2356,65 @@ YY_RULE_SETUP
     return NetconfParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 45:
-/* rule 45 can match eol */
+case 48:
+/* rule 48 can match eol */
 YY_RULE_SETUP
-#line 573 "netconf_lexer.ll"
+#line 600 "netconf_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 46:
-/* rule 46 can match eol */
+case 49:
+/* rule 49 can match eol */
 YY_RULE_SETUP
-#line 578 "netconf_lexer.ll"
+#line 605 "netconf_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 47:
+case 50:
 YY_RULE_SETUP
-#line 583 "netconf_lexer.ll"
+#line 610 "netconf_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 48:
+case 51:
 YY_RULE_SETUP
-#line 588 "netconf_lexer.ll"
+#line 615 "netconf_lexer.ll"
 { return NetconfParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 49:
+case 52:
 YY_RULE_SETUP
-#line 589 "netconf_lexer.ll"
+#line 616 "netconf_lexer.ll"
 { return NetconfParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 50:
+case 53:
 YY_RULE_SETUP
-#line 590 "netconf_lexer.ll"
+#line 617 "netconf_lexer.ll"
 { return NetconfParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 51:
+case 54:
 YY_RULE_SETUP
-#line 591 "netconf_lexer.ll"
+#line 618 "netconf_lexer.ll"
 { return NetconfParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 52:
+case 55:
 YY_RULE_SETUP
-#line 592 "netconf_lexer.ll"
+#line 619 "netconf_lexer.ll"
 { return NetconfParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 53:
+case 56:
 YY_RULE_SETUP
-#line 593 "netconf_lexer.ll"
+#line 620 "netconf_lexer.ll"
 { return NetconfParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 54:
+case 57:
 YY_RULE_SETUP
-#line 595 "netconf_lexer.ll"
+#line 622 "netconf_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2590,9 +2433,9 @@ YY_RULE_SETUP
     return NetconfParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 55:
+case 58:
 YY_RULE_SETUP
-#line 613 "netconf_lexer.ll"
+#line 640 "netconf_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2606,43 +2449,43 @@ YY_RULE_SETUP
     return NetconfParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 56:
+case 59:
 YY_RULE_SETUP
-#line 626 "netconf_lexer.ll"
+#line 653 "netconf_lexer.ll"
 {
     string tmp(yytext);
     return NetconfParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 57:
+case 60:
 YY_RULE_SETUP
-#line 631 "netconf_lexer.ll"
+#line 658 "netconf_lexer.ll"
 {
    return NetconfParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 58:
+case 61:
 YY_RULE_SETUP
-#line 635 "netconf_lexer.ll"
+#line 662 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 59:
+case 62:
 YY_RULE_SETUP
-#line 637 "netconf_lexer.ll"
+#line 664 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 60:
+case 63:
 YY_RULE_SETUP
-#line 639 "netconf_lexer.ll"
+#line 666 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 61:
+case 64:
 YY_RULE_SETUP
-#line 641 "netconf_lexer.ll"
+#line 668 "netconf_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 643 "netconf_lexer.ll"
+#line 670 "netconf_lexer.ll"
 {
     if (driver.states_.empty()) {
         return NetconfParser::make_END(driver.loc_);
@@ -2666,12 +2509,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 62:
+case 65:
 YY_RULE_SETUP
-#line 666 "netconf_lexer.ll"
+#line 693 "netconf_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2674 "netconf_lexer.cc"
+#line 2517 "netconf_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2990,7 +2833,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 367 )
+			if ( yy_current_state >= 388 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3023,11 +2866,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 367 )
+		if ( yy_current_state >= 388 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 366);
+	yy_is_jam = (yy_current_state == 387);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3776,8 +3619,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 666 "netconf_lexer.ll"
-
+#line 693 "netconf_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -3879,4 +3721,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.3.2.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 33 "netconf_parser.yy" // lalr1.cc:435
+#line 33 "netconf_parser.yy"
 
 #include <netconf/parser_context.h>
 
-#line 51 "netconf_parser.cc" // lalr1.cc:435
+#line 52 "netconf_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if NETCONF_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !NETCONF_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,57 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "netconf_parser.yy" // lalr1.cc:510
+#line 14 "netconf_parser.yy"
 namespace isc { namespace netconf {
-#line 146 "netconf_parser.cc" // lalr1.cc:510
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  NetconfParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "netconf_parser.cc"
 
   /// Build a parser object.
   NetconfParser::NetconfParser (isc::netconf::ParserContext& ctx_yyarg)
-    :
 #if NETCONF_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -201,9 +160,9 @@ namespace isc { namespace netconf {
   NetconfParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -233,13 +192,13 @@ namespace isc { namespace netconf {
     : state (s)
   {}
 
-  NetconfParser::symbol_number_type
-  NetconfParser::by_state::type_get () const YY_NOEXCEPT
+  NetconfParser::symbol_kind_type
+  NetconfParser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   NetconfParser::stack_symbol_type::stack_symbol_type ()
@@ -248,27 +207,27 @@ namespace isc { namespace netconf {
   NetconfParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,27 +244,27 @@ namespace isc { namespace netconf {
   NetconfParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -314,35 +273,71 @@ namespace isc { namespace netconf {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  NetconfParser::stack_symbol_type&
+  NetconfParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   NetconfParser::stack_symbol_type&
   NetconfParser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -368,69 +363,67 @@ namespace isc { namespace netconf {
 #if NETCONF_DEBUG
   template <typename Base>
   void
-  NetconfParser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  NetconfParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 45: // "constant string"
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 392 "netconf_parser.cc" // lalr1.cc:676
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "netconf_parser.cc"
         break;
 
-      case 46: // "integer"
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 398 "netconf_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_INTEGER: // "integer"
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "netconf_parser.cc"
         break;
 
-      case 47: // "floating point"
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < double > (); }
-#line 404 "netconf_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "netconf_parser.cc"
         break;
 
-      case 48: // "boolean"
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 410 "netconf_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "netconf_parser.cc"
         break;
 
-      case 57: // value
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 416 "netconf_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_value: // value
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "netconf_parser.cc"
         break;
 
-      case 60: // map_value
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 422 "netconf_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_map_value: // map_value
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "netconf_parser.cc"
         break;
 
-      case 119: // socket_type_value
-#line 107 "netconf_parser.yy" // lalr1.cc:676
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 428 "netconf_parser.cc" // lalr1.cc:676
+      case symbol_kind::S_socket_type_value: // socket_type_value
+#line 110 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "netconf_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -454,7 +447,7 @@ namespace isc { namespace netconf {
   }
 
   void
-  NetconfParser::yypop_ (int n)
+  NetconfParser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -489,21 +482,21 @@ namespace isc { namespace netconf {
   NetconfParser::state_type
   NetconfParser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  NetconfParser::yy_pact_value_is_default_ (int yyvalue)
+  NetconfParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  NetconfParser::yy_table_value_is_error_ (int yyvalue)
+  NetconfParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -517,7 +510,6 @@ namespace isc { namespace netconf {
   int
   NetconfParser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -553,7 +545,8 @@ namespace isc { namespace netconf {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -567,14 +560,14 @@ namespace isc { namespace netconf {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -593,11 +586,23 @@ namespace isc { namespace netconf {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -614,7 +619,7 @@ namespace isc { namespace netconf {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -622,7 +627,7 @@ namespace isc { namespace netconf {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -641,25 +646,25 @@ namespace isc { namespace netconf {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -683,208 +688,208 @@ namespace isc { namespace netconf {
         {
           switch (yyn)
             {
-  case 2:
-#line 118 "netconf_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.NO_KEYWORDS; }
-#line 690 "netconf_parser.cc" // lalr1.cc:919
+  case 2: // $@1: %empty
+#line 121 "netconf_parser.yy"
+                       { ctx.ctx_ = ctx.NO_KEYWORDS; }
+#line 695 "netconf_parser.cc"
     break;
 
-  case 4:
-#line 119 "netconf_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 696 "netconf_parser.cc" // lalr1.cc:919
+  case 4: // $@2: %empty
+#line 122 "netconf_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "netconf_parser.cc"
     break;
 
-  case 6:
-#line 120 "netconf_parser.yy" // lalr1.cc:919
-    { ctx.ctx_ = ctx.NETCONF; }
-#line 702 "netconf_parser.cc" // lalr1.cc:919
+  case 6: // $@3: %empty
+#line 123 "netconf_parser.yy"
+                         { ctx.ctx_ = ctx.NETCONF; }
+#line 707 "netconf_parser.cc"
     break;
 
-  case 8:
-#line 128 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 8: // $@4: %empty
+#line 131 "netconf_parser.yy"
+                            {
     // Parse the Netconf map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 712 "netconf_parser.cc" // lalr1.cc:919
+#line 717 "netconf_parser.cc"
     break;
 
-  case 9:
-#line 132 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 9: // sub_netconf: "{" $@4 global_params "}"
+#line 135 "netconf_parser.yy"
+                               {
     // parsing completed
 }
-#line 720 "netconf_parser.cc" // lalr1.cc:919
+#line 725 "netconf_parser.cc"
     break;
 
-  case 10:
-#line 139 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 10: // json: value
+#line 142 "netconf_parser.yy"
+            {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 729 "netconf_parser.cc" // lalr1.cc:919
+#line 734 "netconf_parser.cc"
     break;
 
-  case 11:
-#line 145 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 735 "netconf_parser.cc" // lalr1.cc:919
+  case 11: // value: "integer"
+#line 148 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 740 "netconf_parser.cc"
     break;
 
-  case 12:
-#line 146 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 741 "netconf_parser.cc" // lalr1.cc:919
+  case 12: // value: "floating point"
+#line 149 "netconf_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 746 "netconf_parser.cc"
     break;
 
-  case 13:
-#line 147 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 747 "netconf_parser.cc" // lalr1.cc:919
+  case 13: // value: "boolean"
+#line 150 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 752 "netconf_parser.cc"
     break;
 
-  case 14:
-#line 148 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 753 "netconf_parser.cc" // lalr1.cc:919
+  case 14: // value: "constant string"
+#line 151 "netconf_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 758 "netconf_parser.cc"
     break;
 
-  case 15:
-#line 149 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 759 "netconf_parser.cc" // lalr1.cc:919
+  case 15: // value: "null"
+#line 152 "netconf_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 764 "netconf_parser.cc"
     break;
 
-  case 16:
-#line 150 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 765 "netconf_parser.cc" // lalr1.cc:919
+  case 16: // value: map
+#line 153 "netconf_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 770 "netconf_parser.cc"
     break;
 
-  case 17:
-#line 151 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 771 "netconf_parser.cc" // lalr1.cc:919
+  case 17: // value: list_generic
+#line 154 "netconf_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 776 "netconf_parser.cc"
     break;
 
-  case 18:
-#line 155 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 18: // $@5: %empty
+#line 158 "netconf_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 782 "netconf_parser.cc" // lalr1.cc:919
+#line 787 "netconf_parser.cc"
     break;
 
-  case 19:
-#line 160 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 19: // map: "{" $@5 map_content "}"
+#line 163 "netconf_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 792 "netconf_parser.cc" // lalr1.cc:919
+#line 797 "netconf_parser.cc"
     break;
 
-  case 20:
-#line 166 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 798 "netconf_parser.cc" // lalr1.cc:919
+  case 20: // map_value: map
+#line 169 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 803 "netconf_parser.cc"
     break;
 
-  case 23:
-#line 180 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 23: // not_empty_map: "constant string" ":" value
+#line 183 "netconf_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 807 "netconf_parser.cc" // lalr1.cc:919
+#line 812 "netconf_parser.cc"
     break;
 
-  case 24:
-#line 184 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 24: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 187 "netconf_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 817 "netconf_parser.cc" // lalr1.cc:919
+#line 822 "netconf_parser.cc"
     break;
 
-  case 25:
-#line 191 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 25: // $@6: %empty
+#line 194 "netconf_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 826 "netconf_parser.cc" // lalr1.cc:919
+#line 831 "netconf_parser.cc"
     break;
 
-  case 26:
-#line 194 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 26: // list_generic: "[" $@6 list_content "]"
+#line 197 "netconf_parser.yy"
+                               {
 }
-#line 833 "netconf_parser.cc" // lalr1.cc:919
+#line 838 "netconf_parser.cc"
     break;
 
-  case 29:
-#line 201 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 29: // not_empty_list: value
+#line 204 "netconf_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 842 "netconf_parser.cc" // lalr1.cc:919
+#line 847 "netconf_parser.cc"
     break;
 
-  case 30:
-#line 205 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 30: // not_empty_list: not_empty_list "," value
+#line 208 "netconf_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 851 "netconf_parser.cc" // lalr1.cc:919
+#line 856 "netconf_parser.cc"
     break;
 
-  case 31:
-#line 218 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 31: // unknown_map_entry: "constant string" ":"
+#line 221 "netconf_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 862 "netconf_parser.cc" // lalr1.cc:919
+#line 867 "netconf_parser.cc"
     break;
 
-  case 32:
-#line 226 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 32: // $@7: %empty
+#line 229 "netconf_parser.yy"
+                                   {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 873 "netconf_parser.cc" // lalr1.cc:919
+#line 878 "netconf_parser.cc"
     break;
 
-  case 33:
-#line 231 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 33: // netconf_syntax_map: "{" $@7 global_objects "}"
+#line 234 "netconf_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 883 "netconf_parser.cc" // lalr1.cc:919
+#line 888 "netconf_parser.cc"
     break;
 
-  case 38:
-#line 248 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 38: // $@8: %empty
+#line 251 "netconf_parser.yy"
+                        {
 
     // Let's create a MapElement that will represent it, add it to the
     // top level map (that's already on the stack) and put the new map
@@ -895,58 +900,58 @@ namespace isc { namespace netconf {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.NETCONF);
 }
-#line 899 "netconf_parser.cc" // lalr1.cc:919
+#line 904 "netconf_parser.cc"
     break;
 
-  case 39:
-#line 258 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 39: // netconf_object: "Netconf" $@8 ":" "{" global_params "}"
+#line 261 "netconf_parser.yy"
+                                                    {
     // Ok, we're done with parsing Netconf. Let's take the map
     // off the stack.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 910 "netconf_parser.cc" // lalr1.cc:919
+#line 915 "netconf_parser.cc"
     break;
 
-  case 52:
-#line 285 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 52: // boot_update: "boot-update" ":" "boolean"
+#line 288 "netconf_parser.yy"
+                                       {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-update", flag);
 }
-#line 919 "netconf_parser.cc" // lalr1.cc:919
+#line 924 "netconf_parser.cc"
     break;
 
-  case 53:
-#line 290 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 53: // subscribe_changes: "subscribe-changes" ":" "boolean"
+#line 293 "netconf_parser.yy"
+                                                   {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subscribe-changes", flag);
 }
-#line 928 "netconf_parser.cc" // lalr1.cc:919
+#line 933 "netconf_parser.cc"
     break;
 
-  case 54:
-#line 295 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 54: // validate_changes: "validate-changes" ":" "boolean"
+#line 298 "netconf_parser.yy"
+                                                 {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("validate-changes", flag);
 }
-#line 937 "netconf_parser.cc" // lalr1.cc:919
+#line 942 "netconf_parser.cc"
     break;
 
-  case 55:
-#line 300 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 55: // $@9: %empty
+#line 303 "netconf_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 945 "netconf_parser.cc" // lalr1.cc:919
+#line 950 "netconf_parser.cc"
     break;
 
-  case 56:
-#line 302 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 56: // user_context: "user-context" $@9 ":" map_value
+#line 305 "netconf_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -968,20 +973,20 @@ namespace isc { namespace netconf {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 972 "netconf_parser.cc" // lalr1.cc:919
+#line 977 "netconf_parser.cc"
     break;
 
-  case 57:
-#line 325 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 57: // $@10: %empty
+#line 328 "netconf_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 980 "netconf_parser.cc" // lalr1.cc:919
+#line 985 "netconf_parser.cc"
     break;
 
-  case 58:
-#line 327 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 58: // comment: "comment" $@10 ":" "constant string"
+#line 330 "netconf_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1005,479 +1010,516 @@ namespace isc { namespace netconf {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1009 "netconf_parser.cc" // lalr1.cc:919
+#line 1014 "netconf_parser.cc"
     break;
 
-  case 59:
-#line 353 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 59: // $@11: %empty
+#line 356 "netconf_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1020 "netconf_parser.cc" // lalr1.cc:919
+#line 1025 "netconf_parser.cc"
     break;
 
-  case 60:
-#line 358 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 60: // hooks_libraries: "hooks-libraries" $@11 ":" "[" hooks_libraries_list "]"
+#line 361 "netconf_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1029 "netconf_parser.cc" // lalr1.cc:919
+#line 1034 "netconf_parser.cc"
     break;
 
-  case 65:
-#line 371 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 65: // $@12: %empty
+#line 374 "netconf_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1039 "netconf_parser.cc" // lalr1.cc:919
+#line 1044 "netconf_parser.cc"
     break;
 
-  case 66:
-#line 375 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 66: // hooks_library: "{" $@12 hooks_params "}"
+#line 378 "netconf_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1047 "netconf_parser.cc" // lalr1.cc:919
+#line 1052 "netconf_parser.cc"
     break;
 
-  case 72:
-#line 388 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 72: // $@13: %empty
+#line 391 "netconf_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1055 "netconf_parser.cc" // lalr1.cc:919
+#line 1060 "netconf_parser.cc"
     break;
 
-  case 73:
-#line 390 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 73: // library: "library" $@13 ":" "constant string"
+#line 393 "netconf_parser.yy"
+               {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1065 "netconf_parser.cc" // lalr1.cc:919
+#line 1070 "netconf_parser.cc"
     break;
 
-  case 74:
-#line 396 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 74: // $@14: %empty
+#line 399 "netconf_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1073 "netconf_parser.cc" // lalr1.cc:919
+#line 1078 "netconf_parser.cc"
     break;
 
-  case 75:
-#line 398 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 75: // parameters: "parameters" $@14 ":" value
+#line 401 "netconf_parser.yy"
+              {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1082 "netconf_parser.cc" // lalr1.cc:919
+#line 1087 "netconf_parser.cc"
     break;
 
-  case 76:
-#line 406 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 76: // $@15: %empty
+#line 409 "netconf_parser.yy"
+                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("managed-servers", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.MANAGED_SERVERS);
 }
-#line 1093 "netconf_parser.cc" // lalr1.cc:919
+#line 1098 "netconf_parser.cc"
     break;
 
-  case 77:
-#line 411 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 77: // managed_servers: "managed-servers" ":" "{" $@15 servers_entries "}"
+#line 414 "netconf_parser.yy"
+                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1102 "netconf_parser.cc" // lalr1.cc:919
+#line 1107 "netconf_parser.cc"
     break;
 
-  case 87:
-#line 435 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 87: // $@16: %empty
+#line 438 "netconf_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1113 "netconf_parser.cc" // lalr1.cc:919
+#line 1118 "netconf_parser.cc"
     break;
 
-  case 88:
-#line 440 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 88: // dhcp4_server: "dhcp4" $@16 ":" "{" managed_server_params "}"
+#line 443 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1122 "netconf_parser.cc" // lalr1.cc:919
+#line 1127 "netconf_parser.cc"
     break;
 
-  case 89:
-#line 446 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 89: // $@17: %empty
+#line 449 "netconf_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1133 "netconf_parser.cc" // lalr1.cc:919
+#line 1138 "netconf_parser.cc"
     break;
 
-  case 90:
-#line 451 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 90: // dhcp6_server: "dhcp6" $@17 ":" "{" managed_server_params "}"
+#line 454 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1142 "netconf_parser.cc" // lalr1.cc:919
+#line 1147 "netconf_parser.cc"
     break;
 
-  case 91:
-#line 457 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 91: // $@18: %empty
+#line 460 "netconf_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1153 "netconf_parser.cc" // lalr1.cc:919
+#line 1158 "netconf_parser.cc"
     break;
 
-  case 92:
-#line 462 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 92: // d2_server: "d2" $@18 ":" "{" managed_server_params "}"
+#line 465 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1162 "netconf_parser.cc" // lalr1.cc:919
+#line 1167 "netconf_parser.cc"
     break;
 
-  case 93:
-#line 468 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 93: // $@19: %empty
+#line 471 "netconf_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ca", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1173 "netconf_parser.cc" // lalr1.cc:919
+#line 1178 "netconf_parser.cc"
     break;
 
-  case 94:
-#line 473 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 94: // ca_server: "ca" $@19 ":" "{" managed_server_params "}"
+#line 476 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1182 "netconf_parser.cc" // lalr1.cc:919
+#line 1187 "netconf_parser.cc"
     break;
 
-  case 105:
-#line 495 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 105: // $@20: %empty
+#line 498 "netconf_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1190 "netconf_parser.cc" // lalr1.cc:919
+#line 1195 "netconf_parser.cc"
     break;
 
-  case 106:
-#line 497 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 106: // model: "model" $@20 ":" "constant string"
+#line 500 "netconf_parser.yy"
+               {
     ElementPtr model(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("model", model);
     ctx.leave();
 }
-#line 1200 "netconf_parser.cc" // lalr1.cc:919
+#line 1205 "netconf_parser.cc"
     break;
 
-  case 107:
-#line 504 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 107: // $@21: %empty
+#line 507 "netconf_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 1211 "netconf_parser.cc" // lalr1.cc:919
+#line 1216 "netconf_parser.cc"
     break;
 
-  case 108:
-#line 509 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 108: // control_socket: "control-socket" $@21 ":" "{" control_socket_params "}"
+#line 512 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1220 "netconf_parser.cc" // lalr1.cc:919
+#line 1225 "netconf_parser.cc"
     break;
 
-  case 117:
-#line 527 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 117: // $@22: %empty
+#line 530 "netconf_parser.yy"
+                         {
     ctx.enter(ctx.SOCKET_TYPE);
 }
-#line 1228 "netconf_parser.cc" // lalr1.cc:919
+#line 1233 "netconf_parser.cc"
     break;
 
-  case 118:
-#line 529 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 118: // socket_type: "socket-type" $@22 ":" socket_type_value
+#line 532 "netconf_parser.yy"
+                          {
     ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1237 "netconf_parser.cc" // lalr1.cc:919
+#line 1242 "netconf_parser.cc"
     break;
 
-  case 119:
-#line 535 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
-#line 1243 "netconf_parser.cc" // lalr1.cc:919
+  case 119: // socket_type_value: "unix"
+#line 538 "netconf_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
+#line 1248 "netconf_parser.cc"
     break;
 
-  case 120:
-#line 536 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
-#line 1249 "netconf_parser.cc" // lalr1.cc:919
+  case 120: // socket_type_value: "http"
+#line 539 "netconf_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
+#line 1254 "netconf_parser.cc"
     break;
 
-  case 121:
-#line 537 "netconf_parser.yy" // lalr1.cc:919
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
-#line 1255 "netconf_parser.cc" // lalr1.cc:919
+  case 121: // socket_type_value: "stdout"
+#line 540 "netconf_parser.yy"
+                           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
+#line 1260 "netconf_parser.cc"
     break;
 
-  case 122:
-#line 540 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 122: // $@23: %empty
+#line 543 "netconf_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1263 "netconf_parser.cc" // lalr1.cc:919
+#line 1268 "netconf_parser.cc"
     break;
 
-  case 123:
-#line 542 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 123: // socket_name: "socket-name" $@23 ":" "constant string"
+#line 545 "netconf_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1273 "netconf_parser.cc" // lalr1.cc:919
+#line 1278 "netconf_parser.cc"
     break;
 
-  case 124:
-#line 549 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 124: // $@24: %empty
+#line 552 "netconf_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1281 "netconf_parser.cc" // lalr1.cc:919
+#line 1286 "netconf_parser.cc"
     break;
 
-  case 125:
-#line 551 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 125: // socket_url: "socket-url" $@24 ":" "constant string"
+#line 554 "netconf_parser.yy"
+               {
     ElementPtr url(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-url", url);
     ctx.leave();
 }
-#line 1291 "netconf_parser.cc" // lalr1.cc:919
+#line 1296 "netconf_parser.cc"
     break;
 
-  case 126:
-#line 564 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 126: // $@25: %empty
+#line 567 "netconf_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1302 "netconf_parser.cc" // lalr1.cc:919
+#line 1307 "netconf_parser.cc"
     break;
 
-  case 127:
-#line 569 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 127: // logging_object: "Logging" $@25 ":" "{" logging_params "}"
+#line 572 "netconf_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1311 "netconf_parser.cc" // lalr1.cc:919
+#line 1316 "netconf_parser.cc"
     break;
 
-  case 131:
-#line 586 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 131: // $@26: %empty
+#line 589 "netconf_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1322 "netconf_parser.cc" // lalr1.cc:919
+#line 1327 "netconf_parser.cc"
     break;
 
-  case 132:
-#line 591 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 132: // loggers: "loggers" $@26 ":" "[" loggers_entries "]"
+#line 594 "netconf_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1331 "netconf_parser.cc" // lalr1.cc:919
+#line 1336 "netconf_parser.cc"
     break;
 
-  case 135:
-#line 603 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 135: // $@27: %empty
+#line 606 "netconf_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1341 "netconf_parser.cc" // lalr1.cc:919
+#line 1346 "netconf_parser.cc"
     break;
 
-  case 136:
-#line 607 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 136: // logger_entry: "{" $@27 logger_params "}"
+#line 610 "netconf_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1349 "netconf_parser.cc" // lalr1.cc:919
+#line 1354 "netconf_parser.cc"
     break;
 
-  case 146:
-#line 624 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 146: // $@28: %empty
+#line 627 "netconf_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1357 "netconf_parser.cc" // lalr1.cc:919
+#line 1362 "netconf_parser.cc"
     break;
 
-  case 147:
-#line 626 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 147: // name: "name" $@28 ":" "constant string"
+#line 629 "netconf_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1367 "netconf_parser.cc" // lalr1.cc:919
+#line 1372 "netconf_parser.cc"
     break;
 
-  case 148:
-#line 632 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 148: // debuglevel: "debuglevel" ":" "integer"
+#line 635 "netconf_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1376 "netconf_parser.cc" // lalr1.cc:919
+#line 1381 "netconf_parser.cc"
     break;
 
-  case 149:
-#line 637 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 149: // $@29: %empty
+#line 640 "netconf_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1384 "netconf_parser.cc" // lalr1.cc:919
+#line 1389 "netconf_parser.cc"
     break;
 
-  case 150:
-#line 639 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 150: // severity: "severity" $@29 ":" "constant string"
+#line 642 "netconf_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1394 "netconf_parser.cc" // lalr1.cc:919
+#line 1399 "netconf_parser.cc"
     break;
 
-  case 151:
-#line 645 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 151: // $@30: %empty
+#line 648 "netconf_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1405 "netconf_parser.cc" // lalr1.cc:919
+#line 1410 "netconf_parser.cc"
     break;
 
-  case 152:
-#line 650 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 152: // output_options_list: "output_options" $@30 ":" "[" output_options_list_content "]"
+#line 653 "netconf_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1414 "netconf_parser.cc" // lalr1.cc:919
+#line 1419 "netconf_parser.cc"
     break;
 
-  case 155:
-#line 659 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 155: // $@31: %empty
+#line 662 "netconf_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1424 "netconf_parser.cc" // lalr1.cc:919
+#line 1429 "netconf_parser.cc"
     break;
 
-  case 156:
-#line 663 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 156: // output_entry: "{" $@31 output_params_list "}"
+#line 666 "netconf_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1432 "netconf_parser.cc" // lalr1.cc:919
+#line 1437 "netconf_parser.cc"
     break;
 
-  case 163:
-#line 677 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 166: // $@32: %empty
+#line 683 "netconf_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1440 "netconf_parser.cc" // lalr1.cc:919
+#line 1445 "netconf_parser.cc"
     break;
 
-  case 164:
-#line 679 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 167: // output: "output" $@32 ":" "constant string"
+#line 685 "netconf_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1450 "netconf_parser.cc" // lalr1.cc:919
+#line 1455 "netconf_parser.cc"
     break;
 
-  case 165:
-#line 685 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 168: // flush: "flush" ":" "boolean"
+#line 691 "netconf_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1459 "netconf_parser.cc" // lalr1.cc:919
+#line 1464 "netconf_parser.cc"
     break;
 
-  case 166:
-#line 690 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 169: // maxsize: "maxsize" ":" "integer"
+#line 696 "netconf_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1468 "netconf_parser.cc" // lalr1.cc:919
+#line 1473 "netconf_parser.cc"
     break;
 
-  case 167:
-#line 695 "netconf_parser.yy" // lalr1.cc:919
-    {
+  case 170: // maxver: "maxver" ":" "integer"
+#line 701 "netconf_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1477 "netconf_parser.cc" // lalr1.cc:919
+#line 1482 "netconf_parser.cc"
     break;
 
+  case 171: // async: "async" ":" "boolean"
+#line 706 "netconf_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1491 "netconf_parser.cc"
+    break;
+
+  case 172: // queue_size: "queue-size" ":" "integer"
+#line 711 "netconf_parser.yy"
+                                     {
+    ElementPtr queue_size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", queue_size);
+}
+#line 1500 "netconf_parser.cc"
+    break;
+
+  case 173: // $@33: %empty
+#line 716 "netconf_parser.yy"
+                          {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1508 "netconf_parser.cc"
+    break;
+
+  case 174: // overflow: "overflow" $@33 ":" "constant string"
+#line 718 "netconf_parser.yy"
+               {
+    ElementPtr overflow(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow", overflow);
+    ctx.leave();
+}
+#line 1518 "netconf_parser.cc"
+    break;
+
+
+#line 1522 "netconf_parser.cc"
 
-#line 1481 "netconf_parser.cc" // lalr1.cc:919
             default:
               break;
             }
@@ -1493,7 +1535,6 @@ namespace isc { namespace netconf {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -1509,7 +1550,9 @@ namespace isc { namespace netconf {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1520,7 +1563,7 @@ namespace isc { namespace netconf {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1546,6 +1589,7 @@ namespace isc { namespace netconf {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -1554,37 +1598,39 @@ namespace isc { namespace netconf {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -1616,6 +1662,7 @@ namespace isc { namespace netconf {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1649,18 +1696,103 @@ namespace isc { namespace netconf {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  NetconfParser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  NetconfParser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  NetconfParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
 
+
+  // NetconfParser::context.
+  NetconfParser::context::context (const NetconfParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  NetconfParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  NetconfParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1679,41 +1811,32 @@ namespace isc { namespace netconf {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  NetconfParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1734,11 +1857,11 @@ namespace isc { namespace netconf {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1747,41 +1870,43 @@ namespace isc { namespace netconf {
   }
 
 
-  const signed char NetconfParser::yypact_ninf_ = -64;
+  const signed char NetconfParser::yypact_ninf_ = -63;
 
   const signed char NetconfParser::yytable_ninf_ = -1;
 
   const short
   NetconfParser::yypact_[] =
   {
-      64,   -64,   -64,   -64,    13,     9,    18,    29,   -64,   -64,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-     -64,   -64,   -64,   -64,     9,   -22,    10,    15,   -64,     1,
-      70,    79,    74,   106,   -64,   -64,     7,   -64,   -64,   -64,
-     -64,   -64,   113,   116,   117,   118,   -64,   119,   -64,   120,
-     121,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-       9,     9,   -64,    80,   122,   123,    10,   -64,   125,   126,
-      83,    84,    85,   127,   131,   -64,   -64,    15,   -64,   -64,
-     132,   130,   133,   -64,   134,    97,   -64,   -64,   -64,   -64,
-     138,   -64,     9,    15,   105,   -64,   -64,   -64,    44,   137,
-     -64,   139,   -64,    16,   -64,   -64,   -64,   -64,   -64,   -64,
-     -64,   140,   136,   -64,   -64,   -64,   -64,   -64,   -64,   143,
-     142,   -64,   -64,   146,   105,   -64,   147,   148,   152,   153,
-     -64,    44,     2,   -64,   137,   141,   -64,   154,   155,   156,
-     157,   -64,   -64,   -64,   -64,    40,   -64,   -64,   -64,   -64,
-     158,    65,    65,    65,    65,   162,   163,    88,   -64,   -64,
-      43,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-      62,   -64,   -64,   -64,    82,    91,    92,   114,     9,   -64,
-       0,   158,   -64,   164,   165,    65,   -64,   -64,   -64,   -64,
-     -64,   -64,   -64,   -64,   166,   -64,   -64,   -64,   -64,    93,
-     -64,   -64,   -64,   -64,   -64,   -64,   115,   167,   -64,   168,
-     169,   129,   172,     0,   -64,   -64,    -6,   135,   173,   -64,
-     149,   -64,   -64,   -64,   -64,   -64,   -64,   -64,    94,   -64,
-     -64,   -64,   -64,   -64,   170,   -64,   175,   177,   178,    -6,
-     -64,   -64,    78,   -64,    87,   150,   151,   -64,    52,   170,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   179,   180,
-     181,    95,   -64,   -64,   -64,   -64,   -64,   -64,   188,   145,
-     159,   160,    52,   -64,   171,   -64,   -64,   -64,   -64,   -64
+      71,   -63,   -63,   -63,     5,     6,     7,    23,   -63,   -63,
+     -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,
+     -63,   -63,   -63,   -63,     6,   -42,     0,    13,   -63,    25,
+      36,    56,    75,    88,   -63,   -63,     4,   -63,   -63,   -63,
+     -63,   -63,    96,   108,   109,   121,   -63,   122,   -63,   119,
+     125,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,
+       6,     6,   -63,    81,   126,   127,     0,   -63,   128,   129,
+      83,    85,    86,   131,   135,   -63,   -63,    13,   -63,   -63,
+     136,   134,   137,   -63,   138,    87,   -63,   -63,   -63,   -63,
+     141,   -63,     6,    13,   110,   -63,   -63,   -63,    -1,   140,
+     -63,   142,   -63,    70,   -63,   -63,   -63,   -63,   -63,   -63,
+     -63,   143,   139,   -63,   -63,   -63,   -63,   -63,   -63,   146,
+     145,   -63,   -63,   152,   110,   -63,   153,   155,   156,   157,
+     -63,    -1,   -10,   -63,   140,   144,   -63,   158,   159,   160,
+     161,   -63,   -63,   -63,   -63,    74,   -63,   -63,   -63,   -63,
+     162,    22,    22,    22,    22,   166,   167,    -8,   -63,   -63,
+      42,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,
+      76,   -63,   -63,   -63,    84,    99,   100,   114,     6,   -63,
+      51,   162,   -63,   168,   169,    22,   -63,   -63,   -63,   -63,
+     -63,   -63,   -63,   -63,   170,   -63,   -63,   -63,   -63,   103,
+     -63,   -63,   -63,   -63,   -63,   -63,   115,   171,   -63,   172,
+     173,   130,   176,    51,   -63,   -63,    53,   116,   177,   -63,
+     133,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   106,   -63,
+     -63,   -63,   -63,   -63,   178,   -63,   179,   180,   188,    53,
+     -63,   -63,    43,   -63,    95,   147,   148,   -63,    54,   178,
+     -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   189,   190,
+     193,   194,   195,   -63,   107,   -63,   -63,   -63,   -63,   -63,
+     -63,   -63,   -63,   -63,   196,   124,   154,   174,   150,   175,
+     198,    54,   -63,   163,   -63,   -63,   -63,   -63,   -63,   181,
+     -63,   -63,   -63
   };
 
   const unsigned char
@@ -1812,31 +1937,33 @@ namespace isc { namespace netconf {
        0,   138,   117,   122,   124,   116,   114,   115,     0,   109,
      111,   112,   113,   147,     0,   150,     0,     0,     0,     0,
      108,   155,     0,   153,     0,     0,     0,   110,     0,     0,
-     152,   119,   120,   121,   118,   123,   125,   163,     0,     0,
-       0,     0,   157,   159,   160,   161,   162,   154,     0,     0,
-       0,     0,     0,   156,     0,   165,   166,   167,   158,   164
+     152,   119,   120,   121,   118,   123,   125,   166,     0,     0,
+       0,     0,     0,   173,     0,   157,   159,   160,   161,   162,
+     163,   164,   165,   154,     0,     0,     0,     0,     0,     0,
+       0,     0,   156,     0,   168,   169,   170,   171,   172,     0,
+     158,   167,   174
   };
 
   const short
   NetconfParser::yypgoto_[] =
   {
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -20,   124,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -27,   -64,
-     -64,   -64,   144,   -64,   -64,   104,   -64,   161,   -24,   -19,
-     -18,   -26,   -64,   -25,   -64,   -64,   -64,   -64,   -64,    37,
-     -64,   -64,    41,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-     -64,    68,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-     -38,    17,   -64,   -64,   -64,   -64,   -64,   -39,   -64,   -64,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,    77,   -64,
-     -64,   -64,    22,   -64,   -64,    -9,   -64,   -64,   -64,   -64,
-     -64,   -64,   -64,   -64,   -42,   -64,   -64,   -63,   -64,   -64,
-     -64,   -64,   -64
+     -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -20,   120,
+     -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -27,   -63,
+     -63,   -63,   149,   -63,   -63,   112,   -63,   132,   -24,   -19,
+     -18,   -26,   -63,   -25,   -63,   -63,   -63,   -63,   -63,    72,
+     -63,   -63,    50,   -63,   -63,   -63,   -63,   -63,   -63,   -63,
+     -63,    77,   -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,
+     -30,    31,   -63,   -63,   -63,   -63,   -63,   -29,   -63,   -63,
+     -63,   -63,   -63,   -63,   -63,   -63,   -63,   -63,    93,   -63,
+     -63,   -63,    37,   -63,   -63,     8,   -63,   -63,   -63,   -63,
+     -63,   -63,   -63,   -63,   -23,   -63,   -63,   -62,   -63,   -63,
+     -63,   -63,   -63,   -63,   -63,   -63,   -63
   };
 
   const short
   NetconfParser::yydefgoto_[] =
   {
-      -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
+       0,     4,     5,     6,     7,    23,    27,    16,    17,    18,
       25,    96,    32,    33,    19,    24,    29,    30,   164,    21,
       26,    36,    37,    38,    64,    49,    50,    51,   165,   166,
      167,   168,    68,   169,    69,    57,    74,   119,   120,   121,
@@ -1845,124 +1972,125 @@ namespace isc { namespace netconf {
      170,   171,   172,   183,   173,   184,   228,   229,   230,   236,
      254,   231,   237,   232,   238,    39,    65,   103,   104,   105,
      123,   160,   161,   180,   199,   200,   201,   209,   202,   203,
-     212,   204,   210,   242,   243,   248,   261,   262,   263,   268,
-     264,   265,   266
+     212,   204,   210,   242,   243,   248,   264,   265,   266,   274,
+     267,   268,   269,   270,   271,   272,   280
   };
 
-  const unsigned short
+  const short
   NetconfParser::yytable_[] =
   {
-      48,    55,    56,    52,    28,    40,    41,    59,    53,    54,
-      66,    40,    41,     8,     9,    67,    10,   222,    11,   124,
-      34,   223,   224,    31,   125,    20,    40,    41,    42,    43,
-      44,    45,   142,   143,   192,   193,    22,   194,   195,    47,
-      78,    79,    35,   157,    46,    47,   181,    47,   158,   182,
+      48,    55,    56,    52,    28,     8,    31,    66,    53,    54,
+      34,     9,    67,    10,    20,    11,   106,   107,   108,   109,
+     142,   143,   142,   143,    40,    41,    42,    43,    44,    45,
+      22,    59,    35,    40,    41,    42,    43,    44,    47,    60,
+      78,    79,    46,   162,   163,   181,   249,    47,   182,   250,
       48,    55,    56,    52,    12,    13,    14,    15,    53,    54,
-      47,   106,   107,   108,   109,   185,    48,    55,    56,    52,
-     186,   110,   100,    60,    53,    54,    40,    41,    42,    43,
-      44,   249,    62,    61,   250,   185,   162,   163,   257,    47,
-     187,   258,   259,   260,   185,   185,   213,   239,   272,   188,
-     189,   214,   240,   273,   110,   144,     1,     2,     3,    63,
-      47,   251,   252,   253,   174,   175,   176,    70,   142,   143,
-      71,    72,    73,    75,    77,    80,    81,    82,    76,    84,
-      85,    86,    87,    88,    89,    90,    92,    93,   102,   131,
-      94,    10,    97,    99,   118,   134,   150,   122,   130,   133,
-     135,   137,   138,   196,   197,   198,   139,   140,   191,   190,
-     215,   151,   152,   153,   154,   159,   177,   178,   206,   207,
-     211,   149,   217,   218,   216,   219,   220,   241,   234,   244,
-     233,   245,   246,   269,   270,   271,   196,   197,   198,   225,
-     226,   227,   274,   275,   235,   255,   256,   101,   179,   141,
-     247,   136,   208,   205,   221,   276,   277,   267,    95,   278,
-      83,     0,   225,   226,   227,     0,   279,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    91
+      61,    47,    40,    41,    40,    41,    48,    55,    56,    52,
+      47,   110,   100,   124,    53,    54,   222,   157,   125,   185,
+     223,   224,   158,    62,   186,   192,   193,   185,   194,   195,
+     257,    63,   187,   258,   259,   260,   261,   262,   263,    47,
+      70,    47,   185,   185,   110,   144,   213,   188,   189,   239,
+     281,   214,    71,    72,   240,   282,     1,     2,     3,   251,
+     252,   253,   174,   175,   176,    73,    75,    76,    77,    80,
+      81,    82,    84,    85,    86,    97,    87,    88,    89,    90,
+      92,    93,   131,   102,    94,    10,    99,   118,   134,   150,
+     122,   130,   133,   196,   197,   198,   135,   137,   191,   138,
+     139,   140,   190,   215,   233,   151,   152,   153,   154,   159,
+     177,   178,   206,   207,   211,   284,   217,   218,   216,   219,
+     220,   235,   234,   244,   245,   241,   196,   197,   198,   225,
+     226,   227,   246,   275,   276,   255,   256,   277,   278,   279,
+     283,   287,   289,   285,    95,   101,   149,   179,   141,    91,
+     247,   291,   225,   226,   227,    83,   208,   136,   205,   290,
+       0,   221,     0,   286,   288,     0,   273,     0,     0,   292
   };
 
   const short
   NetconfParser::yycheck_[] =
   {
-      27,    27,    27,    27,    24,    11,    12,     6,    27,    27,
-       3,    11,    12,     0,     5,     8,     7,    23,     9,     3,
-      10,    27,    28,    45,     8,     7,    11,    12,    13,    14,
-      15,    16,    30,    31,    34,    35,     7,    37,    38,    45,
-      60,    61,    32,     3,    29,    45,     3,    45,     8,     6,
-      77,    77,    77,    77,    45,    46,    47,    48,    77,    77,
-      45,    17,    18,    19,    20,     3,    93,    93,    93,    93,
-       8,    98,    92,     3,    93,    93,    11,    12,    13,    14,
-      15,     3,     8,     4,     6,     3,    21,    22,    36,    45,
-       8,    39,    40,    41,     3,     3,     3,     3,     3,     8,
-       8,     8,     8,     8,   131,   132,    42,    43,    44,     3,
-      45,    24,    25,    26,   152,   153,   154,     4,    30,    31,
-       4,     4,     4,     4,     3,    45,     4,     4,     8,     4,
-       4,    48,    48,    48,     7,     4,     4,     7,    33,     3,
-       7,     7,    45,     5,     7,     3,     5,     8,     8,     6,
-       4,     4,     4,   180,   180,   180,     4,     4,   178,    45,
-      45,     7,     7,     7,     7,     7,     4,     4,     4,     4,
-       4,   134,     4,     4,     7,    46,     4,     7,     5,     4,
-      45,     4,     4,     4,     4,     4,   213,   213,   213,   216,
-     216,   216,     4,    48,    45,    45,    45,    93,   157,   131,
-     239,   124,   185,   181,   213,    46,    46,   249,    84,   272,
-      66,    -1,   239,   239,   239,    -1,    45,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77
+      27,    27,    27,    27,    24,     0,    48,     3,    27,    27,
+      10,     5,     8,     7,     7,     9,    17,    18,    19,    20,
+      30,    31,    30,    31,    11,    12,    13,    14,    15,    16,
+       7,     6,    32,    11,    12,    13,    14,    15,    48,     3,
+      60,    61,    29,    21,    22,     3,     3,    48,     6,     6,
+      77,    77,    77,    77,    48,    49,    50,    51,    77,    77,
+       4,    48,    11,    12,    11,    12,    93,    93,    93,    93,
+      48,    98,    92,     3,    93,    93,    23,     3,     8,     3,
+      27,    28,     8,     8,     8,    34,    35,     3,    37,    38,
+      36,     3,     8,    39,    40,    41,    42,    43,    44,    48,
+       4,    48,     3,     3,   131,   132,     3,     8,     8,     3,
+       3,     8,     4,     4,     8,     8,    45,    46,    47,    24,
+      25,    26,   152,   153,   154,     4,     4,     8,     3,    48,
+       4,     4,     4,     4,    51,    48,    51,    51,     7,     4,
+       4,     7,     3,    33,     7,     7,     5,     7,     3,     5,
+       8,     8,     6,   180,   180,   180,     4,     4,   178,     4,
+       4,     4,    48,    48,    48,     7,     7,     7,     7,     7,
+       4,     4,     4,     4,     4,    51,     4,     4,     7,    49,
+       4,    48,     5,     4,     4,     7,   213,   213,   213,   216,
+     216,   216,     4,     4,     4,    48,    48,     4,     4,     4,
+       4,    51,     4,    49,    84,    93,   134,   157,   131,    77,
+     239,    48,   239,   239,   239,    66,   185,   124,   181,   281,
+      -1,   213,    -1,    49,    49,    -1,   249,    -1,    -1,    48
   };
 
   const unsigned char
   NetconfParser::yystos_[] =
   {
-       0,    42,    43,    44,    50,    51,    52,    53,     0,     5,
-       7,     9,    45,    46,    47,    48,    56,    57,    58,    63,
-       7,    68,     7,    54,    64,    59,    69,    55,    57,    65,
-      66,    45,    61,    62,    10,    32,    70,    71,    72,   124,
-      11,    12,    13,    14,    15,    16,    29,    45,    67,    74,
-      75,    76,    77,    78,    79,    80,    82,    84,    96,     6,
-       3,     4,     8,     3,    73,   125,     3,     8,    81,    83,
-       4,     4,     4,     4,    85,     4,     8,     3,    57,    57,
-      45,     4,     4,    71,     4,     4,    48,    48,    48,     7,
-       4,    76,     4,     7,     7,    58,    60,    45,    97,     5,
-      57,    74,    33,   126,   127,   128,    17,    18,    19,    20,
-      67,    98,    99,   100,   101,   103,   105,   107,     7,    86,
-      87,    88,     8,   129,     3,     8,   102,   104,   106,   108,
-       8,     3,    89,     6,     3,     4,   127,     4,     4,     4,
-       4,   100,    30,    31,    67,    90,    91,    92,    94,    88,
-       5,     7,     7,     7,     7,    93,    95,     3,     8,     7,
-     130,   131,    21,    22,    67,    77,    78,    79,    80,    82,
-     109,   110,   111,   113,   109,   109,   109,     4,     4,    91,
-     132,     3,     6,   112,   114,     3,     8,     8,     8,     8,
-      45,    57,    34,    35,    37,    38,    67,    80,    82,   133,
-     134,   135,   137,   138,   140,   131,     4,     4,   110,   136,
-     141,     4,   139,     3,     8,    45,     7,     4,     4,    46,
-       4,   134,    23,    27,    28,    67,    80,    82,   115,   116,
-     117,   120,   122,    45,     5,    45,   118,   121,   123,     3,
-       8,     7,   142,   143,     4,     4,     4,   116,   144,     3,
-       6,    24,    25,    26,   119,    45,    45,    36,    39,    40,
-      41,   145,   146,   147,   149,   150,   151,   143,   148,     4,
-       4,     4,     3,     8,     4,    48,    46,    46,   146,    45
+       0,    45,    46,    47,    53,    54,    55,    56,     0,     5,
+       7,     9,    48,    49,    50,    51,    59,    60,    61,    66,
+       7,    71,     7,    57,    67,    62,    72,    58,    60,    68,
+      69,    48,    64,    65,    10,    32,    73,    74,    75,   127,
+      11,    12,    13,    14,    15,    16,    29,    48,    70,    77,
+      78,    79,    80,    81,    82,    83,    85,    87,    99,     6,
+       3,     4,     8,     3,    76,   128,     3,     8,    84,    86,
+       4,     4,     4,     4,    88,     4,     8,     3,    60,    60,
+      48,     4,     4,    74,     4,     4,    51,    51,    51,     7,
+       4,    79,     4,     7,     7,    61,    63,    48,   100,     5,
+      60,    77,    33,   129,   130,   131,    17,    18,    19,    20,
+      70,   101,   102,   103,   104,   106,   108,   110,     7,    89,
+      90,    91,     8,   132,     3,     8,   105,   107,   109,   111,
+       8,     3,    92,     6,     3,     4,   130,     4,     4,     4,
+       4,   103,    30,    31,    70,    93,    94,    95,    97,    91,
+       5,     7,     7,     7,     7,    96,    98,     3,     8,     7,
+     133,   134,    21,    22,    70,    80,    81,    82,    83,    85,
+     112,   113,   114,   116,   112,   112,   112,     4,     4,    94,
+     135,     3,     6,   115,   117,     3,     8,     8,     8,     8,
+      48,    60,    34,    35,    37,    38,    70,    83,    85,   136,
+     137,   138,   140,   141,   143,   134,     4,     4,   113,   139,
+     144,     4,   142,     3,     8,    48,     7,     4,     4,    49,
+       4,   137,    23,    27,    28,    70,    83,    85,   118,   119,
+     120,   123,   125,    48,     5,    48,   121,   124,   126,     3,
+       8,     7,   145,   146,     4,     4,     4,   119,   147,     3,
+       6,    24,    25,    26,   122,    48,    48,    36,    39,    40,
+      41,    42,    43,    44,   148,   149,   150,   152,   153,   154,
+     155,   156,   157,   146,   151,     4,     4,     4,     4,     4,
+     158,     3,     8,     4,    51,    49,    49,    51,    49,     4,
+     149,    48,    48
   };
 
   const unsigned char
   NetconfParser::yyr1_[] =
   {
-       0,    49,    51,    50,    52,    50,    53,    50,    55,    54,
-      56,    57,    57,    57,    57,    57,    57,    57,    59,    58,
-      60,    61,    61,    62,    62,    64,    63,    65,    65,    66,
-      66,    67,    69,    68,    70,    70,    71,    71,    73,    72,
-      74,    74,    75,    75,    76,    76,    76,    76,    76,    76,
-      76,    76,    77,    78,    79,    81,    80,    83,    82,    85,
-      84,    86,    86,    87,    87,    89,    88,    90,    90,    90,
-      91,    91,    93,    92,    95,    94,    97,    96,    98,    98,
-      99,    99,   100,   100,   100,   100,   100,   102,   101,   104,
-     103,   106,   105,   108,   107,   109,   109,   110,   110,   110,
-     110,   110,   110,   110,   110,   112,   111,   114,   113,   115,
-     115,   116,   116,   116,   116,   116,   116,   118,   117,   119,
-     119,   119,   121,   120,   123,   122,   125,   124,   126,   126,
-     127,   129,   128,   130,   130,   132,   131,   133,   133,   134,
-     134,   134,   134,   134,   134,   134,   136,   135,   137,   139,
-     138,   141,   140,   142,   142,   144,   143,   145,   145,   146,
-     146,   146,   146,   148,   147,   149,   150,   151
+       0,    52,    54,    53,    55,    53,    56,    53,    58,    57,
+      59,    60,    60,    60,    60,    60,    60,    60,    62,    61,
+      63,    64,    64,    65,    65,    67,    66,    68,    68,    69,
+      69,    70,    72,    71,    73,    73,    74,    74,    76,    75,
+      77,    77,    78,    78,    79,    79,    79,    79,    79,    79,
+      79,    79,    80,    81,    82,    84,    83,    86,    85,    88,
+      87,    89,    89,    90,    90,    92,    91,    93,    93,    93,
+      94,    94,    96,    95,    98,    97,   100,    99,   101,   101,
+     102,   102,   103,   103,   103,   103,   103,   105,   104,   107,
+     106,   109,   108,   111,   110,   112,   112,   113,   113,   113,
+     113,   113,   113,   113,   113,   115,   114,   117,   116,   118,
+     118,   119,   119,   119,   119,   119,   119,   121,   120,   122,
+     122,   122,   124,   123,   126,   125,   128,   127,   129,   129,
+     130,   132,   131,   133,   133,   135,   134,   136,   136,   137,
+     137,   137,   137,   137,   137,   137,   139,   138,   140,   142,
+     141,   144,   143,   145,   145,   147,   146,   148,   148,   149,
+     149,   149,   149,   149,   149,   149,   151,   150,   152,   153,
+     154,   155,   156,   158,   157
   };
 
-  const unsigned char
+  const signed char
   NetconfParser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     4,
@@ -1981,26 +2109,28 @@ namespace isc { namespace netconf {
        1,     0,     6,     1,     3,     0,     4,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     0,     4,     3,     0,
        4,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     3,     3,     3
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     3,
+       3,     3,     3,     0,     4
   };
 
 
-
+#if NETCONF_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const NetconfParser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Netconf\"", "\"user-context\"",
-  "\"comment\"", "\"boot-update\"", "\"subscribe-changes\"",
-  "\"validate-changes\"", "\"managed-servers\"", "\"dhcp4\"", "\"dhcp6\"",
-  "\"d2\"", "\"ca\"", "\"model\"", "\"control-socket\"", "\"socket-type\"",
-  "\"unix\"", "\"http\"", "\"stdout\"", "\"socket-name\"",
-  "\"socket-url\"", "\"hooks-libraries\"", "\"library\"", "\"parameters\"",
-  "\"Logging\"", "\"loggers\"", "\"name\"", "\"output_options\"",
-  "\"output\"", "\"debuglevel\"", "\"severity\"", "\"flush\"",
-  "\"maxsize\"", "\"maxver\"", "START_JSON", "START_NETCONF",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Netconf\"",
+  "\"user-context\"", "\"comment\"", "\"boot-update\"",
+  "\"subscribe-changes\"", "\"validate-changes\"", "\"managed-servers\"",
+  "\"dhcp4\"", "\"dhcp6\"", "\"d2\"", "\"ca\"", "\"model\"",
+  "\"control-socket\"", "\"socket-type\"", "\"unix\"", "\"http\"",
+  "\"stdout\"", "\"socket-name\"", "\"socket-url\"", "\"hooks-libraries\"",
+  "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
+  "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"queue-size\"", "\"overflow\"", "START_JSON", "START_NETCONF",
   "START_SUB_NETCONF", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
   "$@3", "sub_netconf", "$@4", "json", "value", "map", "$@5", "map_value",
@@ -2024,50 +2154,51 @@ namespace isc { namespace netconf {
   "debuglevel", "severity", "$@29", "output_options_list", "$@30",
   "output_options_list_content", "output_entry", "$@31",
   "output_params_list", "output_params", "output", "$@32", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "maxsize", "maxver", "async", "queue_size", "overflow", "$@33", YY_NULLPTR
   };
+#endif
+
 
 #if NETCONF_DEBUG
-  const unsigned short
+  const short
   NetconfParser::yyrline_[] =
   {
-       0,   118,   118,   118,   119,   119,   120,   120,   128,   128,
-     139,   145,   146,   147,   148,   149,   150,   151,   155,   155,
-     166,   171,   172,   180,   184,   191,   191,   197,   198,   201,
-     205,   218,   226,   226,   238,   239,   243,   244,   248,   248,
-     265,   266,   269,   270,   275,   276,   277,   278,   279,   280,
-     281,   282,   285,   290,   295,   300,   300,   325,   325,   353,
-     353,   363,   364,   367,   368,   371,   371,   379,   380,   381,
-     384,   385,   388,   388,   396,   396,   406,   406,   416,   417,
-     420,   421,   427,   428,   429,   430,   431,   435,   435,   446,
-     446,   457,   457,   468,   468,   479,   480,   484,   485,   486,
-     487,   488,   489,   490,   491,   495,   495,   504,   504,   515,
-     516,   519,   520,   521,   522,   523,   524,   527,   527,   535,
-     536,   537,   540,   540,   549,   549,   564,   564,   577,   578,
-     582,   586,   586,   598,   599,   603,   603,   611,   612,   615,
-     616,   617,   618,   619,   620,   621,   624,   624,   632,   637,
-     637,   645,   645,   655,   656,   659,   659,   667,   668,   671,
-     672,   673,   674,   677,   677,   685,   690,   695
+       0,   121,   121,   121,   122,   122,   123,   123,   131,   131,
+     142,   148,   149,   150,   151,   152,   153,   154,   158,   158,
+     169,   174,   175,   183,   187,   194,   194,   200,   201,   204,
+     208,   221,   229,   229,   241,   242,   246,   247,   251,   251,
+     268,   269,   272,   273,   278,   279,   280,   281,   282,   283,
+     284,   285,   288,   293,   298,   303,   303,   328,   328,   356,
+     356,   366,   367,   370,   371,   374,   374,   382,   383,   384,
+     387,   388,   391,   391,   399,   399,   409,   409,   419,   420,
+     423,   424,   430,   431,   432,   433,   434,   438,   438,   449,
+     449,   460,   460,   471,   471,   482,   483,   487,   488,   489,
+     490,   491,   492,   493,   494,   498,   498,   507,   507,   518,
+     519,   522,   523,   524,   525,   526,   527,   530,   530,   538,
+     539,   540,   543,   543,   552,   552,   567,   567,   580,   581,
+     585,   589,   589,   601,   602,   606,   606,   614,   615,   618,
+     619,   620,   621,   622,   623,   624,   627,   627,   635,   640,
+     640,   648,   648,   658,   659,   662,   662,   670,   671,   674,
+     675,   676,   677,   678,   679,   680,   683,   683,   691,   696,
+     701,   706,   711,   716,   716
   };
 
-  // Print the state stack on the debug stream.
   void
-  NetconfParser::yystack_print_ ()
+  NetconfParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  NetconfParser::yy_reduce_print_ (int yyrule)
+  NetconfParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2080,10 +2211,11 @@ namespace isc { namespace netconf {
 #endif // NETCONF_DEBUG
 
 
-#line 14 "netconf_parser.yy" // lalr1.cc:1242
+#line 14 "netconf_parser.yy"
 } } // isc::netconf
-#line 2086 "netconf_parser.cc" // lalr1.cc:1242
-#line 700 "netconf_parser.yy" // lalr1.cc:1243
+#line 2217 "netconf_parser.cc"
+
+#line 724 "netconf_parser.yy"
 
 
 void
@@ -7,6 +7,7 @@
 #include <perfdhcp/basic_scen.h>
 
 
+#include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 using namespace std;
@@ -120,22 +121,11 @@ BasicScen::checkExitConditions() {
     return (false);
 }
 
-int
-BasicScen::run() {
+void
+BasicScen::runLoop() {
     StatsMgr& stats_mgr(tc_.getStatsMgr());
 
-    // Preload server with the number of packets.
-    if (options_.getPreload() > 0) {
-        tc_.sendPackets(options_.getPreload(), true);
-    }
-
-    // Fork and run command specified with -w<wrapped-command>
-    if (!options_.getWrapped().empty()) {
-        tc_.runWrapped();
-    }
-
     tc_.start();
-
     for (;;) {
         // Calculate number of packets to be sent to stay
         // catch up with rate.
@@ -206,6 +196,111 @@ BasicScen::run() {
     }
 
     tc_.stop();
+}
+
+void
+BasicScen::createWorkers() {
+    const unsigned int threads = options_.getThreadsNum();
+    // Split the range of transaction ids and clients among the workers.
+    const uint32_t transid_range =
+        (options_.getIpVersion() == 4 ? 0xFFFFFFFF : 0x00FFFFFF) / threads;
+    const uint32_t clients_num = options_.getClientsNum() == 0 ?
+        1 : options_.getClientsNum();
+    for (unsigned int i = 0; i < threads; ++i) {
+        WorkerPtr worker(new Worker());
+        worker->options_ = options_.getWorkerOptions(i);
+        if (i == 0) {
+            worker->scen_.reset(new BasicScen(*worker->options_,
+                                              tc_.getSocket()));
+        } else {
+            worker->socket_ = createWorkerSocket(*worker->options_, i);
+            worker->scen_.reset(new BasicScen(*worker->options_,
+                                              *worker->socket_));
+        }
+        TestControl& tc = worker->scen_->tc_;
+        tc.setTransidGenerator(TestControl::NumberGeneratorPtr(
+            new TestControl::SequentialGenerator(transid_range,
+                                                 i * transid_range)));
+        const uint32_t first_client =
+            static_cast<uint64_t>(i) * clients_num / threads;
+        const uint32_t last_client =
+            static_cast<uint64_t>(i + 1) * clients_num / threads;
+        tc.setMacAddrGenerator(TestControl::NumberGeneratorPtr(
+            new TestControl::SequentialGenerator(
+                std::max(last_client - first_client, 1U), first_client)));
+        workers_.push_back(worker);
+    }
+}
+
+BasePerfSocketPtr
+BasicScen::createWorkerSocket(CommandOptions& options,
+                              const unsigned int worker) {
+    return (BasePerfSocketPtr(new PerfSocket(options, worker)));
+}
+
+void
+BasicScen::runWorker(const WorkerPtr& worker) {
+    try {
+        worker->scen_->runLoop();
+    } catch (const std::exception& ex) {
+        worker->error_ = ex.what();
+        TestControl::interrupt();
+    }
+}
+
+void
+BasicScen::runWorkers() {
+    std::vector<util::thread::ThreadPtr> threads;
+    for (auto worker : workers_) {
+        threads.push_back(util::thread::ThreadPtr(
+            new util::thread::Thread(boost::bind(&BasicScen::runWorker,
+                                                 worker))));
+    }
+    for (auto thread : threads) {
+        thread->wait();
+    }
+
+    for (unsigned int i = 0; i < workers_.size(); ++i) {
+        if (!workers_[i]->error_.empty()) {
+            isc_throw(Unexpected, "worker " << i << " failed: "
+                      << workers_[i]->error_);
+        }
+        tc_.getStatsMgr().merge(workers_[i]->scen_->tc_.getStatsMgr());
+    }
+}
+
+int
+BasicScen::run() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+
+    if (options_.getThreadsNum() > 1) {
+        createWorkers();
+    }
+
+    // Preload server with the number of packets.
+    if (workers_.empty()) {
+        if (options_.getPreload() > 0) {
+            tc_.sendPackets(options_.getPreload(), true);
+        }
+    } else {
+        for (auto worker : workers_) {
+            if (worker->options_->getPreload() > 0) {
+                worker->scen_->tc_.sendPackets(worker->options_->getPreload(),
+                                               true);
+            }
+        }
+    }
+
+    // Fork and run command specified with -w<wrapped-command>
+    if (!options_.getWrapped().empty()) {
+        tc_.runWrapped();
+    }
+
+    if (workers_.empty()) {
+        runLoop();
+    } else {
+        runWorkers();
+    }
 
     tc_.printStats();
 
@@ -219,9 +314,13 @@ BasicScen::run() {
         stats_mgr.printTimestamps();
     }
 
+    // The server id and the templates are taken from the first worker
+    // if the test has been run by the workers.
+    TestControl& first_tc = workers_.empty() ? tc_ : workers_[0]->scen_->tc_;
+
     // Print server id.
-    if (options_.testDiags('s') && tc_.serverIdReceived()) {
-        std::cout << "Server id: " << tc_.getServerId() << std::endl;
+    if (options_.testDiags('s') && first_tc.serverIdReceived()) {
+        std::cout << "Server id: " << first_tc.getServerId() << std::endl;
     }
 
     // Diagnostics flag 'e' means show exit reason.
@@ -231,7 +330,7 @@ BasicScen::run() {
     // Print packet templates. Even if -T options have not been specified the
     // dynamically build packet will be printed if at least one has been sent.
     if (options_.testDiags('T')) {
-        tc_.printTemplates();
+        first_tc.printTemplates();
     }
 
     int ret_code = 0;
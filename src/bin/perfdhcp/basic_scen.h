@@ -11,6 +11,10 @@
 
 #include <perfdhcp/abstract_scen.h>
 
+#include <util/threads/thread.h>
+
+#include <string>
+#include <vector>
 
 namespace isc {
 namespace perfdhcp {
@@ -64,6 +68,61 @@ protected:
     ///
     /// \return true if any of the exit conditions is fulfilled.
     bool checkExitConditions();
+
+    /// \brief Sends and receives packets until an exit condition is met.
+    void runLoop();
+
+    /// \brief Creates the worker threads' scenarios.
+    ///
+    /// Each worker runs a share of the test using its own socket, range
+    /// of transaction ids, range of clients and statistics. The first
+    /// worker uses the socket of this scenario.
+    void createWorkers();
+
+    /// \brief Runs the workers' loops in parallel threads.
+    ///
+    /// When all workers are done their statistics are merged into the
+    /// statistics of this scenario.
+    ///
+    /// \throw isc::Unexpected if any of the workers failed.
+    void runWorkers();
+
+    /// \brief Creates the socket of a worker other than the first.
+    ///
+    /// \param options options of the worker.
+    /// \param worker index of the worker.
+    /// \return socket bound to the local port incremented by the index.
+    virtual BasePerfSocketPtr createWorkerSocket(CommandOptions& options,
+                                                 const unsigned int worker);
+
+    /// \brief Scenario run by one of the worker threads.
+    struct Worker {
+        /// \brief Options adjusted to the share of the worker.
+        CommandOptionsPtr options_;
+
+        /// \brief Socket of the worker.
+        BasePerfSocketPtr socket_;
+
+        /// \brief Scenario run by the worker.
+        boost::shared_ptr<BasicScen> scen_;
+
+        /// \brief Description of the error which stopped the worker.
+        std::string error_;
+    };
+
+    /// \brief Pointer to the Worker.
+    typedef boost::shared_ptr<Worker> WorkerPtr;
+
+    /// \brief Runs the loop of a worker.
+    ///
+    /// It is the main function of the worker thread. If the worker
+    /// fails, all workers are interrupted.
+    ///
+    /// \param worker worker to be run.
+    static void runWorker(const WorkerPtr& worker);
+
+    /// \brief Workers running the test when --threads is specified.
+    std::vector<WorkerPtr> workers_;
 };
 
 }
@@ -97,6 +97,83 @@ CommandOptions::LeaseType::toText() const {
     }
 }
 
+CommandOptions::Distribution::Distribution(const Type type, const double min,
+                                           const double max)
+    : type_(type), min_(min), max_(max) {
+}
+
+void
+CommandOptions::Distribution::fromCommandLine(const std::string& cmd_line_arg) {
+    if (cmd_line_arg == "never") {
+        type_ = NEVER;
+        min_ = max_ = 0.;
+        return;
+    }
+
+    const size_t colon = cmd_line_arg.find(':');
+    const std::string type = cmd_line_arg.substr(0, colon);
+    const std::string params = (colon == std::string::npos ? "" :
+                                cmd_line_arg.substr(colon + 1));
+    const size_t comma = params.find(',');
+    Type new_type = NEVER;
+    double new_min = 0.;
+    double new_max = 0.;
+    try {
+        if ((type == "fixed") && (comma == std::string::npos)) {
+            new_type = FIXED;
+            new_min = new_max = boost::lexical_cast<double>(params);
+
+        } else if ((type == "uniform") && (comma != std::string::npos)) {
+            new_type = UNIFORM;
+            new_min = boost::lexical_cast<double>(params.substr(0, comma));
+            new_max = boost::lexical_cast<double>(params.substr(comma + 1));
+
+        } else if ((type == "exp") && (comma == std::string::npos)) {
+            new_type = EXPONENTIAL;
+            new_min = new_max = boost::lexical_cast<double>(params);
+
+        } else {
+            isc_throw(InvalidParameter, "unknown distribution");
+        }
+    } catch (const std::exception&) {
+        isc_throw(isc::InvalidParameter, "distribution '" << cmd_line_arg
+                  << "' is wrong - should be 'never', 'fixed:<seconds>',"
+                  " 'uniform:<min>,<max>' or 'exp:<mean>'");
+    }
+    if ((new_min < 0.) || (new_max < new_min)) {
+        isc_throw(isc::InvalidParameter, "distribution '" << cmd_line_arg
+                  << "' is wrong - durations must not be negative and the"
+                  " minimum must not be greater than the maximum");
+    }
+    type_ = new_type;
+    min_ = new_min;
+    max_ = new_max;
+}
+
+std::string
+CommandOptions::Distribution::toText() const {
+    std::ostringstream s;
+    switch (type_) {
+    case NEVER:
+        s << "never";
+        break;
+    case FIXED:
+        s << "fixed:" << min_;
+        break;
+    case UNIFORM:
+        s << "uniform:" << min_ << "," << max_;
+        break;
+    case EXPONENTIAL:
+        s << "exp:" << min_;
+        break;
+    default:
+        isc_throw(Unexpected, "internal error: undefined distribution type"
+                  " code when returning textual representation of the"
+                  " distribution");
+    }
+    return (s.str());
+}
+
 void
 CommandOptions::reset() {
     // Default mac address used in DHCP messages
@@ -157,6 +234,58 @@ CommandOptions::reset() {
         single_thread_mode_ = false;
     }
     scenario_ = Scenario::BASIC;
+    arrival_ = Distribution(Distribution::FIXED);
+    departure_ = Distribution(Distribution::NEVER);
+    release_percent_ = 0;
+    reboot_storm_ = 0;
+    relays_num_ = 0;
+    relay_base_ = "10.0.0.1";
+    report_format_ = ReportFormat::TEXT;
+    threads_num_ = 1;
+    batch_size_ = 1;
+}
+
+namespace {
+
+/// \brief Returns the share of a value of one of the workers.
+///
+/// The remainder of the division is spread over the first workers,
+/// so as the shares of all workers sum up to the value.
+///
+/// \param value value to be divided.
+/// \param workers number of workers.
+/// \param worker index of the worker.
+/// \return share of the worker.
+unsigned int
+workerShare(const unsigned int value, const unsigned int workers,
+            const unsigned int worker) {
+    return (value / workers + (worker < value % workers ? 1 : 0));
+}
+
+}
+
+CommandOptionsPtr
+CommandOptions::getWorkerOptions(const unsigned int worker) const {
+    if (worker >= threads_num_) {
+        isc_throw(isc::BadValue, "invalid worker index " << worker
+                  << ", the number of threads is " << threads_num_);
+    }
+    CommandOptionsPtr options(new CommandOptions(*this));
+    options->rate_ = workerShare(rate_, threads_num_, worker);
+    options->renew_rate_ = workerShare(renew_rate_, threads_num_, worker);
+    options->release_rate_ = workerShare(release_rate_, threads_num_, worker);
+    for (auto& num_request : options->num_request_) {
+        num_request = workerShare(num_request, threads_num_, worker);
+    }
+    // A worker may not exit because the drops of the other workers
+    // have reached the limit, so round its share up.
+    for (auto& max_drop : options->max_drop_) {
+        max_drop = (max_drop + threads_num_ - 1) / threads_num_;
+    }
+    options->preload_ = workerShare(preload_, threads_num_, worker);
+    options->report_delay_ = 0;
+    options->wrapped_.clear();
+    return (options);
 }
 
 bool
@@ -206,6 +335,15 @@ CommandOptions::parse(int argc, char** const argv, bool print_cmd_line) {
 }
 
 const int LONG_OPT_SCENARIO = 300;
+const int LONG_OPT_THREADS = 301;
+const int LONG_OPT_BATCH_SIZE = 302;
+const int LONG_OPT_REPORT_FORMAT = 303;
+const int LONG_OPT_ARRIVAL = 304;
+const int LONG_OPT_DEPARTURE = 305;
+const int LONG_OPT_RELEASE_PERCENT = 306;
+const int LONG_OPT_REBOOT_STORM = 307;
+const int LONG_OPT_RELAYS = 308;
+const int LONG_OPT_RELAY_BASE = 309;
 
 bool
 CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
@@ -224,8 +362,17 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
     int num_mac_list_files = 0;
 
     struct option long_options[] = {
-        {"scenario", required_argument, 0, LONG_OPT_SCENARIO},
-        {0,          0,                 0, 0}
+        {"scenario",   required_argument, 0, LONG_OPT_SCENARIO},
+        {"threads",    required_argument, 0, LONG_OPT_THREADS},
+        {"batch-size", required_argument, 0, LONG_OPT_BATCH_SIZE},
+        {"report-format", required_argument, 0, LONG_OPT_REPORT_FORMAT},
+        {"arrival",    required_argument, 0, LONG_OPT_ARRIVAL},
+        {"departure",  required_argument, 0, LONG_OPT_DEPARTURE},
+        {"release-percent", required_argument, 0, LONG_OPT_RELEASE_PERCENT},
+        {"reboot-storm", required_argument, 0, LONG_OPT_REBOOT_STORM},
+        {"relays",     required_argument, 0, LONG_OPT_RELAYS},
+        {"relay-base", required_argument, 0, LONG_OPT_RELAY_BASE},
+        {0,            0,                 0, 0}
     };
 
     // In this section we collect argument values from command line
@@ -555,11 +702,85 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                 scenario_ = Scenario::BASIC;
             } else if (optarg_text == "avalanche") {
                 scenario_ = Scenario::AVALANCHE;
+            } else if (optarg_text == "population") {
+                scenario_ = Scenario::POPULATION;
+            } else {
+                isc_throw(InvalidParameter, "scenario value '" << optarg << "' is wrong - should be 'basic', 'avalanche' or 'population'");
+            }
+            break;
+        }
+        case LONG_OPT_THREADS:
+            threads_num_ = positiveInteger("value of the number of threads:"
+                                           " --threads <threads> must be a"
+                                           " positive integer");
+            break;
+
+        case LONG_OPT_BATCH_SIZE:
+            batch_size_ = positiveInteger("value of the batch size:"
+                                          " --batch-size <size> must be a"
+                                          " positive integer");
+            break;
+
+        case LONG_OPT_REPORT_FORMAT: {
+            auto optarg_text = std::string(optarg);
+            if (optarg_text == "text") {
+                report_format_ = ReportFormat::TEXT;
+            } else if (optarg_text == "json") {
+                report_format_ = ReportFormat::JSON;
+            } else if (optarg_text == "csv") {
+                report_format_ = ReportFormat::CSV;
             } else {
-                isc_throw(InvalidParameter, "scenario value '" << optarg << "' is wrong - should be 'basic' or 'avalanche'");
+                isc_throw(InvalidParameter, "report format value '" << optarg << "' is wrong - should be 'text', 'json' or 'csv'");
             }
             break;
         }
+
+        case LONG_OPT_ARRIVAL:
+            arrival_.fromCommandLine(optarg);
+            break;
+
+        case LONG_OPT_DEPARTURE:
+            departure_.fromCommandLine(optarg);
+            break;
+
+        case LONG_OPT_RELEASE_PERCENT:
+            release_percent_ = nonNegativeInteger("value of the release"
+                                                  " percentage:"
+                                                  " --release-percent"
+                                                  " <percent> must be a"
+                                                  " non-negative integer");
+            check(release_percent_ > 100, "value of the release percentage:"
+                  " --release-percent <percent> must not be greater"
+                  " than 100");
+            break;
+
+        case LONG_OPT_REBOOT_STORM:
+            reboot_storm_ = positiveInteger("value of the reboot storm time:"
+                                            " --reboot-storm <seconds> must"
+                                            " be a positive integer");
+            break;
+
+        case LONG_OPT_RELAYS:
+            relays_num_ = positiveInteger("value of the number of relays:"
+                                          " --relays <relays> must be a"
+                                          " positive integer");
+            break;
+
+        case LONG_OPT_RELAY_BASE: {
+            relay_base_ = nonEmptyString("link address of the first relay:"
+                                         " --relay-base <address> must not"
+                                         " be empty");
+            bool valid = false;
+            try {
+                valid = isc::asiolink::IOAddress(relay_base_).isV4();
+            } catch (const std::exception&) {
+                // Reported below.
+            }
+            check(!valid, "link address of the first relay:"
+                  " --relay-base <address> must be an IPv4 address");
+            break;
+        }
+
         default:
             isc_throw(isc::InvalidParameter, "wrong command line option");
         }
@@ -614,6 +835,8 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
         std::cout << "Scenario: basic." << std::endl;
     } else if (scenario_ == Scenario::AVALANCHE) {
         std::cout << "Scenario: avalanche." << std::endl;
+    } else if (scenario_ == Scenario::POPULATION) {
+        std::cout << "Scenario: population." << std::endl;
     }
 
     if (!isSingleThreaded()) {
@@ -914,6 +1137,19 @@ CommandOptions::validate() {
           "use -I<ip-offset>");
     check((!getMacListFile().empty() && base_.size() > 0),
           "Can't use -b with -M option");
+    check((getThreadsNum() > 1) && (scenario_ != Scenario::BASIC),
+          "--threads may be used with the basic scenario only");
+    check((getThreadsNum() > 1) && (getIpVersion() == 6) && !isUseRelayedV6(),
+          "-A<encapsulation-level> must be set to use --threads with -6");
+    check((getThreadsNum() > 1) && !getTemplateFiles().empty(),
+          "-T<template-file> is not compatible with --threads");
+    check((getThreadsNum() > 1) && (getReportDelay() != 0),
+          "-t<report> is not compatible with --threads");
+    check((getThreadsNum() > 1) && (getRate() != 0) &&
+          (getRate() < static_cast<int>(getThreadsNum())),
+          "-r<rate> must not be lower than --threads <threads>");
+    check((getReportFormat() != ReportFormat::TEXT) && (getReportDelay() == 0),
+          "-t<report> must be set to use --report-format");
 
     auto nthreads = std::thread::hardware_concurrency();
     if (nthreads == 1 && isSingleThreaded() == false) {
@@ -926,6 +1162,40 @@ CommandOptions::validate() {
                   << "WARNING: To switch use -g multi option." << std::endl;
     }
 
+    const bool population_options =
+        (getArrival().getType() != Distribution::FIXED) ||
+        (getArrival().getMin() != 0.) ||
+        (getDeparture().getType() != Distribution::NEVER) ||
+        (getReleasePercent() != 0) || (getRebootStorm() != 0) ||
+        (getRelaysNum() != 0) || (getRelayBase() != "10.0.0.1");
+    check((scenario_ != Scenario::POPULATION) && population_options,
+          "--arrival, --departure, --release-percent, --reboot-storm,"
+          " --relays and --relay-base may be used with the population"
+          " scenario only");
+    if (scenario_ == Scenario::POPULATION) {
+        check(getIpVersion() != 4,
+              "-6 is not supported by the population scenario, which"
+              " simulates DHCPv4 clients only");
+        check(getArrival().getType() == Distribution::NEVER,
+              "--arrival never would keep all clients out of the network"
+              " in the population scenario");
+        check(getExchangeMode() != DORA_SARR,
+              "-i is not compatible with the population scenario");
+        check(!getTemplateFiles().empty(),
+              "-T<template-file> is not compatible with the population"
+              " scenario");
+        check((getRenewRate() != 0) || (getReleaseRate() != 0),
+              "-f<renew-rate> and -F<release-rate> are not compatible with"
+              " the population scenario, the clients renew and release"
+              " their leases by themselves");
+        check(getClientsNum() > 0x1000000,
+              "number of clients specified with -R must not be greater"
+              " than 16777216 in the population scenario");
+        check(getRelaysNum() > 0x10000,
+              "number of relays specified with --relays must not be greater"
+              " than 65536");
+    }
+
     if (scenario_ == Scenario::AVALANCHE) {
         check(getClientsNum() <= 0,
               "in case of avalanche scenario number\nof clients must be specified"
@@ -1011,6 +1281,25 @@ CommandOptions::printCommandLine() const {
     if (report_delay_ != 0) {
         std::cout << "report[s]=" << report_delay_ << std::endl;
     }
+    if (scenario_ == Scenario::POPULATION) {
+        std::cout << "arrival=" << arrival_.toText() << std::endl;
+        std::cout << "departure=" << departure_.toText() << std::endl;
+        if (release_percent_ != 0) {
+            std::cout << "release-percent=" << release_percent_ << std::endl;
+        }
+        if (reboot_storm_ != 0) {
+            std::cout << "reboot-storm[s]=" << reboot_storm_ << std::endl;
+        }
+        if (relays_num_ != 0) {
+            std::cout << "relays=" << relays_num_ << std::endl;
+            std::cout << "relay-base=" << relay_base_ << std::endl;
+        }
+    }
+    if (report_format_ == ReportFormat::JSON) {
+        std::cout << "report-format=json" << std::endl;
+    } else if (report_format_ == ReportFormat::CSV) {
+        std::cout << "report-format=csv" << std::endl;
+    }
     if (clients_num_ != 0) {
         std::cout << "clients=" << clients_num_ << std::endl;
     }
@@ -1095,6 +1384,12 @@ CommandOptions::printCommandLine() const {
     } else {
         std::cout << "multi-thread-mode" << std::endl;
     }
+    if (threads_num_ > 1) {
+        std::cout << "threads=" << threads_num_ << std::endl;
+    }
+    if (batch_size_ > 1) {
+        std::cout << "batch-size=" << batch_size_ << std::endl;
+    }
 }
 
 void
@@ -1133,11 +1428,19 @@ CommandOptions::usage() const {
         "messages as request in -R option then back off mechanism is used for\n"
         "each simulated client until all requests are answered. At the end\n"
         "time of whole scenario is reported.\n"
+        "The population scenario, selected by --scenario population,\n"
+        "simulates -R clients following their lease lifetimes (DHCPv4 only).\n"
+        "Each client joins the network, gets a lease, renews it at T1,\n"
+        "rebinds at T2 and starts over when it expires. A client leaving the\n"
+        "network either releases its lease or keeps it and returns with an\n"
+        "INIT-REBOOT request. The test runs for -p seconds or until\n"
+        "interrupted.\n"
         "\n"
         "Options:\n"
         "-1: Take the server-ID option from the first received message.\n"
         "-4: DHCPv4 operation (default). This is incompatible with the -6 option.\n"
-        "-6: DHCPv6 operation. This is incompatible with the -4 option.\n"
+        "-6: DHCPv6 operation. This is incompatible with the -4 option and\n"
+        "    with the population scenario.\n"
         "-b<base>: The base mac, duid, IP, etc, used to simulate different\n"
         "    clients.  This can be specified multiple times, each instance is\n"
         "    in the <type>=<value> form, for instance:\n"
@@ -1195,7 +1498,43 @@ CommandOptions::usage() const {
         "-R<range>: Specify how many different clients are used. With 1\n"
         "    (the default), all requests seem to come from the same client.\n"
         "-s<seed>: Specify the seed for randomization, making it repeatable.\n"
-        "--scenario <name>: where name is 'basic' (default) or 'avalanche'.\n"
+        "--scenario <name>: where name is 'basic' (default), 'avalanche' or\n"
+        "    'population'.\n"
+        "--threads <threads>: Run the basic scenario in <threads> worker\n"
+        "    threads. Each worker has its own socket, bound to the local port\n"
+        "    incremented by the worker index, and sends a share of the packets.\n"
+        "    The relay port option (RFC 8357) is added to the packets so as\n"
+        "    the server responds to the worker's port. With -6 it requires -A.\n"
+        "    The statistics of the workers are merged in the final report.\n"
+        "--batch-size <size>: Send and receive up to <size> packets in one\n"
+        "    system call (sendmmsg/recvmmsg on Linux).\n"
+        "--arrival <distribution>: Population scenario: time before a client\n"
+        "    joins the network, at the start and after leaving it. The\n"
+        "    distribution is one of 'fixed:<seconds>' (default fixed:0),\n"
+        "    'uniform:<min>,<max>', 'exp:<mean>' or 'never'.\n"
+        "--departure <distribution>: Population scenario: time a client stays\n"
+        "    in the network. Same format as --arrival, 'never' by default.\n"
+        "--release-percent <percent>: Population scenario: percentage of the\n"
+        "    leaving clients which release their leases (default 0).\n"
+        "--reboot-storm <seconds>: Population scenario: time after the start\n"
+        "    when all clients in the network reboot at once and send\n"
+        "    INIT-REBOOT requests.\n"
+        "--relays <relays>: Population scenario: number of simulated relays.\n"
+        "    The clients are spread among the relays. The relay agent\n"
+        "    information option of each request carries a circuit-id naming\n"
+        "    the relay and the client, the client's MAC as remote-id and the\n"
+        "    link address of the relay in the link-selection sub-option, so\n"
+        "    as the server selects the relay's subnet. The responses are\n"
+        "    still sent to the local address (giaddr).\n"
+        "--relay-base <address>: Population scenario: link address of the\n"
+        "    first relay (default 10.0.0.1). The link address of each next\n"
+        "    relay is incremented by 256, i.e. each relay is in its own /24.\n"
+        "--report-format <format>: where format is 'text' (default), 'json'\n"
+        "    or 'csv'. With 'json' each periodic report (-t) is printed as a\n"
+        "    JSON object on one line, with 'csv' as one line per exchange.\n"
+        "    These reports include the rate of responses and the 50th, 90th,\n"
+        "    99th and 99.9th percentiles of delays (in ms) measured since the\n"
+        "    previous report.\n"
         "-S<srvid-offset>: Offset of the server-ID option in the\n"
         "    (second/request) template.\n"
         "-T<template-file>: The name of a file containing the template to use\n"
@@ -9,7 +9,7 @@
 
 #include <dhcp/option.h>
 
-#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -19,15 +19,29 @@ namespace perfdhcp {
 
 enum class Scenario {
     BASIC,
-    AVALANCHE
+    AVALANCHE,
+    POPULATION
 };
 
+/// \brief Format of the intermediate reports.
+enum class ReportFormat {
+    TEXT,
+    JSON,
+    CSV
+};
+
+class CommandOptions;
+
+/// \brief Pointer to the CommandOptions.
+typedef boost::shared_ptr<CommandOptions> CommandOptionsPtr;
+
 /// \brief Command Options.
 ///
 /// This class is responsible for parsing the command-line and storing the
 /// specified options.
 ///
-class CommandOptions : public boost::noncopyable {
+/// The class can't be copied except by @c getWorkerOptions.
+class CommandOptions {
 public:
 
     /// \brief Default Constructor.
@@ -113,6 +127,64 @@ public:
 
     };
 
+    /// \brief A class encapsulating the random distribution of a duration.
+    ///
+    /// It is used by the population scenario to draw the times when the
+    /// clients join and leave the network. The distribution is specified
+    /// in the command line as:
+    /// - never: the duration is infinite,
+    /// - fixed:<seconds>: the duration is always the same,
+    /// - uniform:<min>,<max>: the duration is uniformly distributed
+    ///   between min and max seconds,
+    /// - exp:<mean>: the duration is exponentially distributed with the
+    ///   mean of the given number of seconds (Poisson process).
+    class Distribution {
+    public:
+
+        /// The distribution type code.
+        enum Type {
+            NEVER,
+            FIXED,
+            UNIFORM,
+            EXPONENTIAL
+        };
+
+        /// \brief Constructor.
+        ///
+        /// \param type A distribution type code.
+        /// \param min fixed duration, minimum duration of the uniform
+        /// distribution or mean of the exponential distribution.
+        /// \param max maximum duration of the uniform distribution.
+        Distribution(const Type type = NEVER, const double min = 0.,
+                     const double max = 0.);
+
+        /// \brief Sets the distribution from the command line argument.
+        ///
+        /// \param cmd_line_arg An argument specified in the command line.
+        ///
+        /// \throw isc::InvalidParameter if the specified argument is invalid.
+        void fromCommandLine(const std::string& cmd_line_arg);
+
+        /// \brief Return textual representation of the distribution.
+        ///
+        /// \return A textual representation in the command line format.
+        std::string toText() const;
+
+        /// \brief Returns the distribution type code.
+        Type getType() const { return (type_); }
+
+        /// \brief Returns the fixed duration, the minimum duration or the mean.
+        double getMin() const { return (min_); }
+
+        /// \brief Returns the maximum duration of the uniform distribution.
+        double getMax() const { return (max_); }
+
+    private:
+        Type type_;  ///< A distribution type code.
+        double min_; ///< Fixed duration, minimum duration or mean.
+        double max_; ///< Maximum duration.
+    };
+
     /// 2-way (cmd line param -i) or 4-way exchanges
     enum ExchangeMode {
         DO_SA,
@@ -360,6 +432,81 @@ public:
     /// \return enum Scenario.
     Scenario getScenario() const { return scenario_; }
 
+    /// \brief Returns the distribution of the times before the clients
+    /// join the network in the population scenario.
+    ///
+    /// \return distribution specified with --arrival, fixed:0 by default.
+    const Distribution& getArrival() const { return arrival_; }
+
+    /// \brief Returns the distribution of the times the clients stay in
+    /// the network in the population scenario.
+    ///
+    /// \return distribution specified with --departure, never by default.
+    const Distribution& getDeparture() const { return departure_; }
+
+    /// \brief Returns the percentage of the leaving clients which release
+    /// their leases in the population scenario.
+    ///
+    /// \return percentage specified with --release-percent, 0 by default.
+    int getReleasePercent() const { return release_percent_; }
+
+    /// \brief Returns the time of the reboot of all clients in the
+    /// population scenario.
+    ///
+    /// \return number of seconds after the start, 0 if no storm occurs.
+    int getRebootStorm() const { return reboot_storm_; }
+
+    /// \brief Returns the number of the simulated relays in the population
+    /// scenario.
+    ///
+    /// \return number of relays, 0 unless --relays is specified.
+    uint32_t getRelaysNum() const { return relays_num_; }
+
+    /// \brief Returns the link address of the first simulated relay.
+    ///
+    /// \return address specified with --relay-base, 10.0.0.1 by default.
+    std::string getRelayBase() const { return relay_base_; }
+
+    /// \brief Returns the format of the intermediate reports.
+    ///
+    /// \return enum ReportFormat, TEXT unless --report-format is specified.
+    ReportFormat getReportFormat() const { return report_format_; }
+
+    /// \brief Returns the number of worker threads running the test.
+    ///
+    /// \return number of worker threads, 1 unless --threads is specified.
+    unsigned int getThreadsNum() const { return threads_num_; }
+
+    /// \brief Returns the maximum number of packets sent or received
+    /// in one system call.
+    ///
+    /// \return batch size, 1 unless --batch-size is specified.
+    unsigned int getBatchSize() const { return batch_size_; }
+
+    /// \brief Checks if the packets are sent and received directly on
+    /// the socket rather than through the interface manager.
+    ///
+    /// This is the case when the test is run by multiple worker threads,
+    /// each having its own socket, or when the packets are sent and
+    /// received in batches.
+    ///
+    /// \return true if the direct socket operations are used.
+    bool isDirectSocket() const {
+        return ((threads_num_ > 1) || (batch_size_ > 1));
+    }
+
+    /// \brief Returns the options of a worker thread.
+    ///
+    /// When the test is run by multiple worker threads, each of them runs
+    /// a share of the test. The rates, the numbers of requests and the
+    /// number of preload packets are divided among the workers, and so
+    /// is the maximum number of drops, rounded up. The worker doesn't
+    /// run the wrapped command.
+    ///
+    /// \param worker index of the worker thread, from 0.
+    /// \return copy of the options adjusted to the share of the worker.
+    CommandOptionsPtr getWorkerOptions(const unsigned int worker) const;
+
     /// \brief Returns server name.
     ///
     /// \return server name.
@@ -391,6 +538,12 @@ public:
     void version() const;
 
 private:
+    /// \brief Copy constructor used by @c getWorkerOptions.
+    CommandOptions(const CommandOptions& other) = default;
+
+    /// \brief Assignment operator is not supported.
+    CommandOptions& operator=(const CommandOptions& other) = delete;
+
     /// \brief Initializes class members based on the command line.
     ///
     /// Reads each command line parameter and sets class member values.
@@ -675,6 +828,34 @@ private:
 
     /// @brief Selected performance scenario. Default is basic.
     Scenario scenario_;
+
+    /// @brief Distribution of the times before the clients join the network.
+    Distribution arrival_;
+
+    /// @brief Distribution of the times the clients stay in the network.
+    Distribution departure_;
+
+    /// @brief Percentage of the leaving clients which release their leases.
+    int release_percent_;
+
+    /// @brief Time of the reboot of all clients, 0 if none.
+    int reboot_storm_;
+
+    /// @brief Number of the simulated relays.
+    uint32_t relays_num_;
+
+    /// @brief Link address of the first simulated relay.
+    std::string relay_base_;
+
+    /// @brief Format of the intermediate reports. Default is text.
+    ReportFormat report_format_;
+
+    /// @brief Number of worker threads running the test.
+    unsigned int threads_num_;
+
+    /// @brief Maximum number of packets sent or received in one
+    /// system call.
+    unsigned int batch_size_;
 };
 
 }  // namespace perfdhcp
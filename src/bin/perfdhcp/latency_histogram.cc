@@ -0,0 +1,94 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <perfdhcp/latency_histogram.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace isc {
+namespace perfdhcp {
+
+const uint64_t LatencyHistogram::SUB_BUCKETS;
+const uint64_t LatencyHistogram::MAX_VALUE;
+
+LatencyHistogram::LatencyHistogram()
+    : buckets_(bucketIndex(MAX_VALUE) + 1, 0),
+      count_(0),
+      max_(0) {
+}
+
+void
+LatencyHistogram::record(const uint64_t value) {
+    const uint64_t clamped = std::min(value, MAX_VALUE);
+    ++buckets_[bucketIndex(clamped)];
+    ++count_;
+    max_ = std::max(max_, clamped);
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    if (count_ == 0) {
+        return (0);
+    }
+    // Number of delays lower or equal to the percentile.
+    double rank = std::ceil(percentile * static_cast<double>(count_) / 100.);
+    uint64_t target = static_cast<uint64_t>(std::max(rank, 1.));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        seen += buckets_[i];
+        if (seen >= target) {
+            return (std::min(bucketHighestValue(i), max_));
+        }
+    }
+    return (max_);
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    max_ = std::max(max_, other.max_);
+}
+
+void
+LatencyHistogram::clear() {
+    std::fill(buckets_.begin(), buckets_.end(), 0);
+    count_ = 0;
+    max_ = 0;
+}
+
+size_t
+LatencyHistogram::bucketIndex(const uint64_t value) {
+    if (value < 2 * SUB_BUCKETS) {
+        return (value);
+    }
+    // Keep the 8 most significant bits of the value: the first one is
+    // always set so the remaining ones select one of the SUB_BUCKETS
+    // buckets of the power of two range.
+    size_t shift = 0;
+    while ((value >> shift) >= 2 * SUB_BUCKETS) {
+        ++shift;
+    }
+    return (shift * SUB_BUCKETS + (value >> shift));
+}
+
+uint64_t
+LatencyHistogram::bucketHighestValue(const size_t index) {
+    if (index < 2 * SUB_BUCKETS) {
+        return (index);
+    }
+    const size_t shift = index / SUB_BUCKETS - 1;
+    const uint64_t mantissa = index - shift * SUB_BUCKETS;
+    return (((mantissa + 1) << shift) - 1);
+}
+
+} // namespace perfdhcp
+} // namespace isc
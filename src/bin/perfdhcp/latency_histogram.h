@@ -0,0 +1,85 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Histogram of the round trip delays.
+///
+/// The histogram records the delays in microseconds in buckets whose
+/// width grows with the delay, in the same way as the HDR histogram.
+/// The delays below 2 * SUB_BUCKETS microseconds are recorded exactly.
+/// Each following power of two range is split into SUB_BUCKETS buckets
+/// of equal width, so the relative error of a percentile is lower than
+/// 1 / SUB_BUCKETS. Recording a delay is a few integer operations
+/// and the memory used doesn't depend on the number of delays.
+class LatencyHistogram {
+public:
+    /// \brief Number of buckets in each power of two range.
+    static const uint64_t SUB_BUCKETS = 128;
+
+    /// \brief Highest delay recorded. Longer delays are clamped to it.
+    static const uint64_t MAX_VALUE = 0xFFFFFFFF;
+
+    /// \brief Constructor.
+    LatencyHistogram();
+
+    /// \brief Records a delay.
+    ///
+    /// \param value delay in microseconds.
+    void record(const uint64_t value);
+
+    /// \brief Returns the delay below which lies a percentage of the
+    /// recorded delays.
+    ///
+    /// \param percentile percentage between 0 and 100.
+    /// \return highest delay of the bucket holding the percentile, in
+    /// microseconds, or 0 if no delay has been recorded.
+    uint64_t getPercentile(const double percentile) const;
+
+    /// \brief Returns the number of recorded delays.
+    uint64_t getCount() const { return (count_); }
+
+    /// \brief Adds the delays recorded by another histogram.
+    ///
+    /// \param other histogram to be added.
+    void merge(const LatencyHistogram& other);
+
+    /// \brief Discards all recorded delays.
+    void clear();
+
+private:
+    /// \brief Returns the index of the bucket of a delay.
+    ///
+    /// \param value delay in microseconds, not greater than MAX_VALUE.
+    static size_t bucketIndex(const uint64_t value);
+
+    /// \brief Returns the highest delay recorded in a bucket.
+    ///
+    /// \param index index of the bucket.
+    static uint64_t bucketHighestValue(const size_t index);
+
+    /// \brief Numbers of the delays recorded in each bucket.
+    std::vector<uint64_t> buckets_;
+
+    /// \brief Number of recorded delays.
+    uint64_t count_;
+
+    /// \brief Highest recorded delay.
+    uint64_t max_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // LATENCY_HISTOGRAM_H
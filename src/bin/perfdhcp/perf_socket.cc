@@ -5,6 +5,8 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 
+#include <config.h>
+
 #include <perfdhcp/perf_socket.h>
 #include <perfdhcp/command_options.h>
 
@@ -13,6 +15,13 @@
 
 #include <boost/foreach.hpp>
 
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+
 
 using namespace isc::dhcp;
 using namespace isc::asiolink;
@@ -20,14 +29,73 @@ using namespace isc::asiolink;
 namespace isc {
 namespace perfdhcp {
 
-PerfSocket::PerfSocket(CommandOptions& options) {
-    sockfd_ = openSocket(options);
+namespace {
+
+/// \brief Converts an address and a port to the socket address structure.
+///
+/// \param addr IPv4 or IPv6 address.
+/// \param port port number.
+/// \param ifindex index of the interface, used as the scope of IPv6
+/// link-local and multicast addresses.
+/// \param [out] sa socket address.
+/// \return length of the socket address.
+socklen_t
+toSockaddr(const IOAddress& addr, const uint16_t port, const uint16_t ifindex,
+           sockaddr_storage& sa) {
+    memset(&sa, 0, sizeof(sa));
+    if (addr.isV4()) {
+        sockaddr_in* sa4 = reinterpret_cast<sockaddr_in*>(&sa);
+        sa4->sin_family = AF_INET;
+        sa4->sin_port = htons(port);
+        sa4->sin_addr.s_addr = htonl(addr.toUint32());
+        return (sizeof(sockaddr_in));
+    }
+    sockaddr_in6* sa6 = reinterpret_cast<sockaddr_in6*>(&sa);
+    sa6->sin6_family = AF_INET6;
+    sa6->sin6_port = htons(port);
+    const std::vector<uint8_t> bytes = addr.toBytes();
+    memcpy(&sa6->sin6_addr, &bytes[0], sizeof(sa6->sin6_addr));
+    if (addr.isV6LinkLocal() || addr.isV6Multicast()) {
+        sa6->sin6_scope_id = ifindex;
+    }
+    return (sizeof(sockaddr_in6));
+}
+
+/// \brief Converts the socket address structure to an address and a port.
+///
+/// \param sa socket address.
+/// \param [out] port port number.
+/// \return IPv4 or IPv6 address.
+IOAddress
+fromSockaddr(const sockaddr_storage& sa, uint16_t& port) {
+    if (sa.ss_family == AF_INET) {
+        const sockaddr_in* sa4 = reinterpret_cast<const sockaddr_in*>(&sa);
+        port = ntohs(sa4->sin_port);
+        return (IOAddress(ntohl(sa4->sin_addr.s_addr)));
+    }
+    const sockaddr_in6* sa6 = reinterpret_cast<const sockaddr_in6*>(&sa);
+    port = ntohs(sa6->sin6_port);
+    return (IOAddress::fromBytes(AF_INET6, sa6->sin6_addr.s6_addr));
+}
+
+}
+
+PerfSocket::PerfSocket(CommandOptions& options, const uint16_t port_offset)
+    : direct_(options.isDirectSocket()),
+      batch_size_(options.getBatchSize()),
+      recv_buffers_(batch_size_, std::vector<uint8_t>(IfaceMgr::RCVBUFSIZE)),
+      recv_lengths_(batch_size_),
+      recv_addrs_(batch_size_),
+      recv_count_(0),
+      recv_next_(0) {
+    sockfd_ = openSocket(options, port_offset);
     initSocketData();
 }
 
 
 int
-PerfSocket::openSocket(CommandOptions& options) const {
+PerfSocket::openSocket(CommandOptions& options,
+                       const uint16_t port_offset) const {
     std::string localname = options.getLocalName();
     std::string servername = options.getServerName();
     uint16_t port = options.getLocalPort();
@@ -56,6 +124,11 @@ PerfSocket::openSocket(CommandOptions& options) const {
             port = 67; /// @todo: find out why port 68 is wrong here.
         }
     }
+    if (port_offset > std::numeric_limits<uint16_t>::max() - port) {
+        isc_throw(BadValue, "local port " << port << " incremented by "
+                  << port_offset << " is out of range");
+    }
+    port += port_offset;
 
     // Local name is specified along with '-l' option.
     // It may point to interface name or local address.
@@ -126,9 +199,8 @@ PerfSocket::openSocket(CommandOptions& options) const {
 }
 
 PerfSocket::~PerfSocket() {
-    IfacePtr iface = IfaceMgr::instance().getIface(ifindex_);
-    if (iface) {
-        iface->delSocket(sockfd_);
+    if (iface_) {
+        iface_->delSocket(sockfd_);
     }
 }
 
@@ -139,6 +211,8 @@ PerfSocket::initSocketData() {
             if (s.sockfd_ == sockfd_) {
                 ifindex_ = iface->getIndex();
                 addr_ = s.addr_;
+                port_ = s.port_;
+                iface_ = iface;
                 return;
             }
         }
@@ -148,6 +222,9 @@ PerfSocket::initSocketData() {
 
 Pkt4Ptr
 PerfSocket::receive4(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (direct_) {
+        return (receiveDirect<Pkt4>(timeout_sec, timeout_usec));
+    }
     Pkt4Ptr pkt = IfaceMgr::instance().receive4(timeout_sec, timeout_usec);
     if (pkt) {
         /// @todo: Add packet exception handling here. Right now any
@@ -159,6 +236,9 @@ PerfSocket::receive4(uint32_t timeout_sec, uint32_t timeout_usec) {
 
 Pkt6Ptr
 PerfSocket::receive6(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (direct_) {
+        return (receiveDirect<Pkt6>(timeout_sec, timeout_usec));
+    }
     Pkt6Ptr pkt = IfaceMgr::instance().receive6(timeout_sec, timeout_usec);
     if (pkt) {
         /// @todo: Add packet exception handling here. Right now any
@@ -170,17 +250,198 @@ PerfSocket::receive6(uint32_t timeout_sec, uint32_t timeout_usec) {
 
 bool
 PerfSocket::send(const Pkt4Ptr& pkt) {
+    if (direct_) {
+        sendDirect(pkt);
+        return (true);
+    }
     return IfaceMgr::instance().send(pkt);
 }
 
 bool
 PerfSocket::send(const Pkt6Ptr& pkt) {
+    if (direct_) {
+        sendDirect(pkt);
+        return (true);
+    }
     return IfaceMgr::instance().send(pkt);
 }
 
 IfacePtr
 PerfSocket::getIface() {
-    return (IfaceMgr::instance().getIface(ifindex_));
+    return (iface_);
+}
+
+template<typename PktType>
+boost::shared_ptr<PktType>
+PerfSocket::receiveDirect(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (recv_next_ == recv_count_) {
+        recv_next_ = 0;
+        recv_count_ = 0;
+        pollfd pfd;
+        pfd.fd = sockfd_;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        int ret = poll(&pfd, 1, timeout_sec * 1000 + timeout_usec / 1000);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                return (boost::shared_ptr<PktType>());
+            }
+            isc_throw(SocketReadError, "failed to wait for packets on socket "
+                      << sockfd_ << ": " << strerror(errno));
+        }
+        if (ret == 0) {
+            return (boost::shared_ptr<PktType>());
+        }
+        recv_count_ = receiveBatch();
+        if (recv_count_ == 0) {
+            return (boost::shared_ptr<PktType>());
+        }
+    }
+
+    const size_t idx = recv_next_++;
+    boost::shared_ptr<PktType> pkt(new PktType(&recv_buffers_[idx][0],
+                                               recv_lengths_[idx]));
+    pkt->updateTimestamp();
+    uint16_t remote_port = 0;
+    pkt->setRemoteAddr(fromSockaddr(recv_addrs_[idx], remote_port));
+    pkt->setRemotePort(remote_port);
+    pkt->setLocalAddr(addr_);
+    pkt->setLocalPort(port_);
+    pkt->setIface(iface_->getName());
+    pkt->setIndex(ifindex_);
+    /// @todo: Add packet exception handling here. Right now any
+    /// malformed packet will cause perfdhcp to abort.
+    pkt->unpack();
+    return (pkt);
+}
+
+size_t
+PerfSocket::receiveBatch() {
+#if defined(OS_LINUX)
+    std::vector<mmsghdr> msgs(batch_size_);
+    std::vector<iovec> iovs(batch_size_);
+    for (size_t i = 0; i < batch_size_; ++i) {
+        iovs[i].iov_base = &recv_buffers_[i][0];
+        iovs[i].iov_len = recv_buffers_[i].size();
+        memset(&msgs[i], 0, sizeof(msgs[i]));
+        msgs[i].msg_hdr.msg_name = &recv_addrs_[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(recv_addrs_[i]);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int ret = recvmmsg(sockfd_, &msgs[0], batch_size_, MSG_DONTWAIT, NULL);
+    if (ret < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+            return (0);
+        }
+        isc_throw(SocketReadError, "failed to receive packets on socket "
+                  << sockfd_ << ": " << strerror(errno));
+    }
+    for (int i = 0; i < ret; ++i) {
+        recv_lengths_[i] = msgs[i].msg_len;
+    }
+    return (static_cast<size_t>(ret));
+#else
+    size_t count = 0;
+    while (count < batch_size_) {
+        socklen_t addr_len = sizeof(recv_addrs_[count]);
+        ssize_t ret = recvfrom(sockfd_, &recv_buffers_[count][0],
+                               recv_buffers_[count].size(), MSG_DONTWAIT,
+                               reinterpret_cast<sockaddr*>(&recv_addrs_[count]),
+                               &addr_len);
+        if (ret < 0) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK) ||
+                (errno == EINTR)) {
+                break;
+            }
+            isc_throw(SocketReadError, "failed to receive packets on socket "
+                      << sockfd_ << ": " << strerror(errno));
+        }
+        recv_lengths_[count++] = ret;
+    }
+    return (count);
+#endif
+}
+
+void
+PerfSocket::sendDirect(const PktPtr& pkt) {
+    send_queue_.push_back(pkt);
+    if (send_queue_.size() >= batch_size_) {
+        flush();
+    }
+}
+
+void
+PerfSocket::flush() {
+    size_t sent = 0;
+    while (sent < send_queue_.size()) {
+        // The round trip time is measured from the actual send.
+        for (size_t i = sent; i < send_queue_.size(); ++i) {
+            send_queue_[i]->updateTimestamp();
+        }
+        int ret = sendBatch(sent);
+        if (ret < 0) {
+            const int error = errno;
+            if (error == EINTR) {
+                continue;
+            }
+            // The packets are already counted as sent, so wait for room
+            // in the socket buffer rather than dropping them.
+            if ((error == EAGAIN) || (error == EWOULDBLOCK)) {
+                pollfd pfd;
+                pfd.fd = sockfd_;
+                pfd.events = POLLOUT;
+                pfd.revents = 0;
+                poll(&pfd, 1, SEND_RETRY_TIMEOUT_MS);
+                continue;
+            }
+            // The socket is writable but the interface queue is full.
+            if (error == ENOBUFS) {
+                poll(NULL, 0, SEND_RETRY_TIMEOUT_MS);
+                continue;
+            }
+            send_queue_.clear();
+            isc_throw(SocketWriteError, "failed to send packets on socket "
+                      << sockfd_ << ": " << strerror(error));
+        }
+        sent += ret;
+    }
+    send_queue_.clear();
+}
+
+int
+PerfSocket::sendBatch(const size_t from) {
+#if defined(OS_LINUX)
+    const size_t count = send_queue_.size() - from;
+    std::vector<sockaddr_storage> addrs(count);
+    std::vector<mmsghdr> msgs(count);
+    std::vector<iovec> iovs(count);
+    for (size_t i = 0; i < count; ++i) {
+        const PktPtr& pkt = send_queue_[from + i];
+        const util::OutputBuffer& buf = pkt->getBuffer();
+        iovs[i].iov_base = const_cast<void*>(buf.getData());
+        iovs[i].iov_len = buf.getLength();
+        memset(&msgs[i], 0, sizeof(msgs[i]));
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = toSockaddr(pkt->getRemoteAddr(),
+                                                 pkt->getRemotePort(),
+                                                 ifindex_, addrs[i]);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    return (sendmmsg(sockfd_, &msgs[0], count, 0));
+#else
+    const PktPtr& pkt = send_queue_[from];
+    const util::OutputBuffer& buf = pkt->getBuffer();
+    sockaddr_storage addr;
+    socklen_t addr_len = toSockaddr(pkt->getRemoteAddr(), pkt->getRemotePort(),
+                                    ifindex_, addr);
+    if (sendto(sockfd_, buf.getData(), buf.getLength(), 0,
+               reinterpret_cast<const sockaddr*>(&addr), addr_len) < 0) {
+        return (-1);
+    }
+    return (1);
+#endif
 }
 
 }
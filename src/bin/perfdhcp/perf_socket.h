@@ -14,6 +14,10 @@
 #include <dhcp/socket_info.h>
 #include <dhcp/iface_mgr.h>
 
+#include <boost/shared_ptr.hpp>
+#include <sys/socket.h>
+#include <vector>
+
 namespace isc {
 namespace perfdhcp {
 
@@ -50,8 +54,17 @@ public:
 
     /// \brief See description of this method in PerfSocket class below.
     virtual dhcp::IfacePtr getIface() = 0;
+
+    /// \brief Sends the packets queued by send.
+    ///
+    /// The default implementation does nothing because the packets are
+    /// sent immediately.
+    virtual void flush() { }
 };
 
+/// \brief Pointer to the BasePerfSocket.
+typedef boost::shared_ptr<BasePerfSocket> BasePerfSocketPtr;
+
 /// \brief Socket wrapper structure.
 ///
 /// This is the wrapper that holds descriptor of the socket
@@ -68,7 +81,11 @@ public:
     /// This constructor uses provided socket descriptor to
     /// find the name of the interface where socket has been
     /// bound to.
-    PerfSocket(CommandOptions& options);
+    ///
+    /// \param options command options.
+    /// \param port_offset value added to the local port, so as each
+    /// worker thread has its own socket.
+    PerfSocket(CommandOptions& options, const uint16_t port_offset = 0);
 
     /// \brief Destructor of the socket wrapper class.
     ///
@@ -91,12 +108,18 @@ public:
 
     /// \brief Send DHCPv4 packet through interface.
     ///
+    /// If the packets are sent in batches the packet is queued and sent
+    /// when the batch is full or when flush is called.
+    ///
     /// \param pkt a packet for sending
     /// \return true if operation succeeded
     virtual bool send(const dhcp::Pkt4Ptr& pkt) override;
 
     /// \brief Send DHCPv6 packet through interface.
     ///
+    /// If the packets are sent in batches the packet is queued and sent
+    /// when the batch is full or when flush is called.
+    ///
     /// \param pkt a packet for sending
     /// \return true if operation succeeded
     virtual bool send(const dhcp::Pkt6Ptr& pkt) override;
@@ -106,6 +129,14 @@ public:
     /// \return shared pointer to Iface.
     virtual dhcp::IfacePtr getIface() override;
 
+    /// \brief Sends the queued packets.
+    ///
+    /// The packets are time stamped when they are sent. When the socket
+    /// buffer is full, it waits until the packets can be sent.
+    ///
+    /// \throw isc::dhcp::SocketWriteError if sending failed.
+    virtual void flush() override;
+
 protected:
     /// \brief Initialize socket data.
     ///
@@ -132,9 +163,75 @@ protected:
     /// \throw isc::InvalidOperation if broadcast option can't be
     /// set for the v4 socket or if multicast option can't be set
     /// for the v6 socket.
+    /// \param options command options.
+    /// \param port_offset value added to the local port.
     /// \throw isc::Unexpected if internal unexpected error occurred.
     /// \return socket descriptor.
-    int openSocket(CommandOptions& options) const;
+    int openSocket(CommandOptions& options, const uint16_t port_offset) const;
+
+private:
+    /// \brief Receives a packet directly from the socket.
+    ///
+    /// The packets are read from the socket in batches and returned one
+    /// by one.
+    ///
+    /// \param timeout_sec number of seconds for waiting for a packet,
+    /// \param timeout_usec number of microseconds for waiting for a packet,
+    /// \tparam PktType type of the packet, Pkt4 or Pkt6.
+    /// \return received packet or nullptr if timed out.
+    template<typename PktType>
+    boost::shared_ptr<PktType> receiveDirect(uint32_t timeout_sec,
+                                             uint32_t timeout_usec);
+
+    /// \brief Reads a batch of packets from the socket.
+    ///
+    /// It doesn't wait for packets.
+    ///
+    /// \return number of received packets.
+    size_t receiveBatch();
+
+    /// \brief Sends queued packets in one system call.
+    ///
+    /// \param from index of the first queued packet to be sent.
+    /// \return number of sent packets or -1 on error, with errno set.
+    int sendBatch(const size_t from);
+
+    /// \brief Queues a packet to be sent directly on the socket.
+    ///
+    /// \param pkt packed packet.
+    void sendDirect(const dhcp::PktPtr& pkt);
+
+    /// \brief Maximum time waited for room in the socket buffer before
+    /// sending again, in milliseconds.
+    static const int SEND_RETRY_TIMEOUT_MS = 1;
+
+    /// \brief Indicates if the packets are sent and received directly
+    /// on the socket rather than through the IfaceMgr.
+    bool direct_;
+
+    /// \brief Maximum number of packets sent or received in one system call.
+    size_t batch_size_;
+
+    /// \brief Interface the socket is bound to.
+    dhcp::IfacePtr iface_;
+
+    /// \brief Buffers holding the packets of the last received batch.
+    std::vector<std::vector<uint8_t> > recv_buffers_;
+
+    /// \brief Lengths of the packets of the last received batch.
+    std::vector<size_t> recv_lengths_;
+
+    /// \brief Source addresses of the packets of the last received batch.
+    std::vector<sockaddr_storage> recv_addrs_;
+
+    /// \brief Number of packets of the last received batch.
+    size_t recv_count_;
+
+    /// \brief Index of the next packet of the last received batch.
+    size_t recv_next_;
+
+    /// \brief Packets waiting to be sent.
+    std::vector<dhcp::PktPtr> send_queue_;
 };
 
 }
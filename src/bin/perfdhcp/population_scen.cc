@@ -0,0 +1,635 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <perfdhcp/population_scen.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <util/io_utilities.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+using namespace boost::posix_time;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+
+namespace isc {
+namespace perfdhcp {
+
+namespace {
+
+/// \brief Reads a 32-bit option value.
+///
+/// \param pkt packet holding the option.
+/// \param code option code.
+/// \param [out] value value of the option.
+/// \return true if the packet holds the option and it is 4 bytes long.
+bool
+getUint32Option(const Pkt4Ptr& pkt, const uint16_t code, uint32_t& value) {
+    OptionPtr opt = pkt->getOption(code);
+    if (!opt) {
+        return (false);
+    }
+    const std::vector<uint8_t> data = opt->toBinary();
+    if (data.size() != sizeof(uint32_t)) {
+        return (false);
+    }
+    value = util::readUint32(&data[0], data.size());
+    return (true);
+}
+
+/// \brief Creates an option holding a 32-bit value.
+///
+/// \param code option code.
+/// \param value value of the option.
+OptionPtr
+createUint32Option(const uint16_t code, const uint32_t value) {
+    OptionBuffer buf(sizeof(uint32_t));
+    util::writeUint32(value, &buf[0], buf.size());
+    return (OptionPtr(new Option(Option::V4, code, buf)));
+}
+
+}
+
+PopulationScen::Client::Client()
+    : state_(OFFLINE), address_(0), server_id_(0), transid_(0),
+      transid_counter_(0), retries_(0), timer_seq_(0),
+      exchange_start_(min_date_time), renew_time_(min_date_time),
+      rebind_time_(min_date_time), expire_time_(min_date_time),
+      leave_time_(not_a_date_time) {
+}
+
+PopulationScen::PopulationScen(CommandOptions& options,
+                               BasePerfSocket& socket)
+    : AbstractScen(options, socket),
+      clients_(options.getClientsNum() == 0 ? 1 : options.getClientsNum()),
+      random_(options.isSeeded() ? options.getSeed() : std::random_device()()),
+      rate_control_(options.getRate()),
+      relay_base_(IOAddress(options.getRelayBase()).toUint32()),
+      discovers_(0), reboots_(0), renews_(0), rebinds_(0), releases_(0),
+      naks_(0), expirations_(0), retransmissions_(0) {
+}
+
+size_t
+PopulationScen::processTimers(const ptime& now, const size_t max_events) {
+    size_t processed = 0;
+    while (!timers_.empty() && (timers_.top().time_ <= now) &&
+           ((max_events == 0) || (processed < max_events))) {
+        const TimerEvent event = timers_.top();
+        timers_.pop();
+        // Skip the events replaced by a later call to schedule.
+        if (event.seq_ != clients_[event.client_].timer_seq_) {
+            continue;
+        }
+        handleTimer(event.client_, now);
+        ++processed;
+    }
+    return (processed);
+}
+
+void
+PopulationScen::processPacket(const Pkt4Ptr& pkt, const ptime& now) {
+    // The client index is held in the lower 24 bits of the transaction id.
+    const uint32_t index = pkt->getTransid() & 0x00FFFFFF;
+    if (index >= clients_.size()) {
+        return;
+    }
+    Client& client = clients_[index];
+    // Responses to the earlier transmissions are late, the client has
+    // moved on.
+    if (pkt->getTransid() != client.transid_) {
+        return;
+    }
+
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+    switch (pkt->getType()) {
+    case DHCPOFFER:
+        if (client.state_ != SELECTING) {
+            return;
+        }
+        stats_mgr.passRcvdPacket(ExchangeType::DO, pkt);
+        client.address_ = pkt->getYiaddr().toUint32();
+        client.server_id_ = 0;
+        getUint32Option(pkt, DHO_DHCP_SERVER_IDENTIFIER, client.server_id_);
+        // The REQUEST continues the exchange started by the DISCOVER.
+        client.state_ = REQUESTING;
+        client.retries_ = 0;
+        sendRequest(index, now);
+        break;
+
+    case DHCPACK:
+        if ((client.state_ == OFFLINE) || (client.state_ == SELECTING) ||
+            (client.state_ == BOUND)) {
+            return;
+        }
+        stats_mgr.passRcvdPacket(exchangeType(client.state_), pkt);
+        bind(index, pkt, now);
+        break;
+
+    case DHCPNAK:
+        if ((client.state_ == OFFLINE) || (client.state_ == SELECTING) ||
+            (client.state_ == BOUND)) {
+            return;
+        }
+        stats_mgr.passRcvdPacket(exchangeType(client.state_), pkt);
+        ++naks_;
+        startExchange(index, SELECTING, now);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void
+PopulationScen::rebootStorm(const ptime& now) {
+    for (uint32_t index = 0; index < clients_.size(); ++index) {
+        Client& client = clients_[index];
+        if (client.state_ == OFFLINE) {
+            continue;
+        }
+        if ((client.address_ != 0) && (now < client.expire_time_)) {
+            startExchange(index, REBOOTING, now);
+        } else {
+            startExchange(index, SELECTING, now);
+        }
+    }
+}
+
+void
+PopulationScen::scheduleArrivals(const ptime& now) {
+    for (uint32_t index = 0; index < clients_.size(); ++index) {
+        const time_duration delay = draw(options_.getArrival());
+        if (!delay.is_not_a_date_time()) {
+            schedule(index, now + delay);
+        }
+    }
+}
+
+size_t
+PopulationScen::getClientsNum(const ClientState state) const {
+    size_t num = 0;
+    for (const auto& client : clients_) {
+        if (client.state_ == state) {
+            ++num;
+        }
+    }
+    return (num);
+}
+
+void
+PopulationScen::handleTimer(const uint32_t index, const ptime& now) {
+    Client& client = clients_[index];
+    if (client.state_ == OFFLINE) {
+        arrive(index, now);
+        return;
+    }
+    if (!client.leave_time_.is_not_a_date_time() &&
+        (now >= client.leave_time_)) {
+        depart(index, now);
+        return;
+    }
+
+    switch (client.state_) {
+    case REQUESTING:
+    case REBOOTING:
+        // The server doesn't confirm the address: start over.
+        if (client.retries_ >= MAX_REQUEST_RETRIES) {
+            startExchange(index, SELECTING, now);
+            return;
+        }
+        break;
+
+    case BOUND:
+        startExchange(index, RENEWING, now);
+        return;
+
+    case RENEWING:
+        if (now >= client.rebind_time_) {
+            startExchange(index, REBINDING, now);
+            return;
+        }
+        break;
+
+    case REBINDING:
+        if (now >= client.expire_time_) {
+            ++expirations_;
+            startExchange(index, SELECTING, now);
+            return;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    // No response: retransmit.
+    ++client.retries_;
+    ++retransmissions_;
+    sendRequest(index, now);
+}
+
+void
+PopulationScen::arrive(const uint32_t index, const ptime& now) {
+    Client& client = clients_[index];
+    const time_duration stay = draw(options_.getDeparture());
+    if (stay.is_not_a_date_time()) {
+        client.leave_time_ = ptime(not_a_date_time);
+    } else {
+        client.leave_time_ = now + stay;
+    }
+    // A client which remembers a valid lease asks to confirm it.
+    if ((client.address_ != 0) && (now < client.expire_time_)) {
+        startExchange(index, REBOOTING, now);
+    } else {
+        startExchange(index, SELECTING, now);
+    }
+}
+
+void
+PopulationScen::depart(const uint32_t index, const ptime& now) {
+    Client& client = clients_[index];
+    const bool bound = ((client.state_ == BOUND) ||
+                        (client.state_ == RENEWING) ||
+                        (client.state_ == REBINDING)) &&
+        (now < client.expire_time_);
+    if (bound && (std::uniform_int_distribution<int>(0, 99)(random_) <
+                  options_.getReleasePercent())) {
+        Pkt4Ptr pkt = createPacket(index, DHCPRELEASE, now);
+        pkt->setCiaddr(IOAddress(client.address_));
+        if (client.server_id_ != 0) {
+            pkt->addOption(createUint32Option(DHO_DHCP_SERVER_IDENTIFIER,
+                                              client.server_id_));
+        }
+        tc_.addExtraOpts(pkt);
+        pkt->pack();
+        tc_.getSocket().send(pkt);
+        ++releases_;
+        client.address_ = 0;
+        client.expire_time_ = now;
+    }
+
+    // The lease, if any, is kept for the INIT-REBOOT at the next arrival.
+    client.state_ = OFFLINE;
+    client.leave_time_ = ptime(not_a_date_time);
+    const time_duration delay = draw(options_.getArrival());
+    if (delay.is_not_a_date_time()) {
+        // Invalidate the pending event.
+        ++client.timer_seq_;
+    } else {
+        schedule(index, now + delay);
+    }
+}
+
+void
+PopulationScen::bind(const uint32_t index, const Pkt4Ptr& ack,
+                     const ptime& now) {
+    Client& client = clients_[index];
+    if (!ack->getYiaddr().isV4Zero()) {
+        client.address_ = ack->getYiaddr().toUint32();
+    }
+    getUint32Option(ack, DHO_DHCP_SERVER_IDENTIFIER, client.server_id_);
+
+    client.state_ = BOUND;
+    uint32_t lease_time = 0xFFFFFFFF;
+    getUint32Option(ack, DHO_DHCP_LEASE_TIME, lease_time);
+    if (lease_time == 0xFFFFFFFF) {
+        // Infinite lease: nothing to renew.
+        client.renew_time_ = ptime(pos_infin);
+        client.rebind_time_ = ptime(pos_infin);
+        client.expire_time_ = ptime(pos_infin);
+        schedule(index, client.renew_time_);
+        return;
+    }
+
+    // Default T1 and T2 (RFC 2131, section 4.4.5).
+    uint32_t renew_time = lease_time / 2;
+    uint32_t rebind_time = static_cast<uint32_t>(lease_time * 0.875);
+    uint32_t value = 0;
+    if (getUint32Option(ack, DHO_DHCP_RENEWAL_TIME, value) &&
+        (value <= lease_time)) {
+        renew_time = value;
+    }
+    if (getUint32Option(ack, DHO_DHCP_REBINDING_TIME, value) &&
+        (value <= lease_time)) {
+        rebind_time = value;
+    }
+    rebind_time = std::max(rebind_time, renew_time);
+
+    client.renew_time_ = now + seconds(renew_time);
+    client.rebind_time_ = now + seconds(rebind_time);
+    client.expire_time_ = now + seconds(lease_time);
+    schedule(index, client.renew_time_);
+}
+
+void
+PopulationScen::startExchange(const uint32_t index, const ClientState state,
+                              const ptime& now) {
+    Client& client = clients_[index];
+    client.state_ = state;
+    client.retries_ = 0;
+    client.exchange_start_ = now;
+    switch (state) {
+    case SELECTING:
+        // The lease is lost.
+        client.address_ = 0;
+        client.expire_time_ = now;
+        ++discovers_;
+        break;
+    case REBOOTING:
+        ++reboots_;
+        break;
+    case RENEWING:
+        ++renews_;
+        break;
+    case REBINDING:
+        ++rebinds_;
+        break;
+    default:
+        break;
+    }
+    sendRequest(index, now);
+}
+
+void
+PopulationScen::sendRequest(const uint32_t index, const ptime& now) {
+    Client& client = clients_[index];
+    Pkt4Ptr pkt;
+    ptime retransmit_time;
+    switch (client.state_) {
+    case SELECTING:
+        pkt = createPacket(index, DHCPDISCOVER, now);
+        break;
+
+    case REQUESTING:
+        pkt = createPacket(index, DHCPREQUEST, now);
+        pkt->addOption(createUint32Option(DHO_DHCP_REQUESTED_ADDRESS,
+                                          client.address_));
+        if (client.server_id_ != 0) {
+            pkt->addOption(createUint32Option(DHO_DHCP_SERVER_IDENTIFIER,
+                                              client.server_id_));
+        }
+        break;
+
+    case REBOOTING:
+        pkt = createPacket(index, DHCPREQUEST, now);
+        pkt->addOption(createUint32Option(DHO_DHCP_REQUESTED_ADDRESS,
+                                          client.address_));
+        break;
+
+    case RENEWING:
+    case REBINDING:
+        pkt = createPacket(index, DHCPREQUEST, now);
+        pkt->setCiaddr(IOAddress(client.address_));
+        break;
+
+    default:
+        isc_throw(Unexpected, "internal error: client " << index
+                  << " has no request to send in state " << client.state_);
+    }
+
+    tc_.addExtraOpts(pkt);
+    pkt->pack();
+    tc_.getSocket().send(pkt);
+    tc_.getStatsMgr().passSentPacket(exchangeType(client.state_), pkt);
+
+    // Schedule the retransmission (RFC 2131, sections 4.1 and 4.4.5).
+    if ((client.state_ == RENEWING) || (client.state_ == REBINDING)) {
+        // Retransmit after half of the remaining time until T2 or
+        // the expiration of the lease.
+        const ptime deadline = (client.state_ == RENEWING ?
+                                client.rebind_time_ : client.expire_time_);
+        ptime next = now + std::max((deadline - now) / 2,
+                                    time_duration(seconds(MIN_RENEW_RETRY_DELAY)));
+        schedule(index, std::min(next, deadline));
+    } else {
+        // Exponential back off: 4, 8, 16, 32 and 64 seconds.
+        const int delay = 4 << std::min(static_cast<int>(client.retries_), 4);
+        schedule(index, now + jitter(delay));
+    }
+}
+
+Pkt4Ptr
+PopulationScen::createPacket(const uint32_t index, const uint8_t msg_type,
+                             const ptime& now) {
+    Client& client = clients_[index];
+    // Each transmission has its own transaction id made of the client
+    // index and a counter, so as the late responses are recognized.
+    client.transid_ = (static_cast<uint32_t>(++client.transid_counter_) << 24) |
+        index;
+    Pkt4Ptr pkt(new Pkt4(msg_type, client.transid_));
+
+    // Set client's and server's ports as well as server's address,
+    // and local (relay) address.
+    tc_.setDefaults4(pkt);
+
+    // The MAC address is the template with the client index in the
+    // last three bytes.
+    std::vector<uint8_t> mac = options_.getMacTemplate();
+    for (size_t i = 0; (i < 3) && (i < mac.size()); ++i) {
+        mac[mac.size() - 1 - i] = static_cast<uint8_t>(index >> (8 * i));
+    }
+    pkt->setHWAddr(HTYPE_ETHER, mac.size(), mac);
+    pkt->addOption(tc_.generateClientId(pkt->getHWAddr()));
+
+    if (msg_type != DHCPRELEASE) {
+        pkt->addOption(Option::factory(Option::V4,
+                                       DHO_DHCP_PARAMETER_REQUEST_LIST));
+        const long elapsed = (now - client.exchange_start_).total_seconds();
+        pkt->setSecs(static_cast<uint16_t>(std::min(std::max(elapsed, 0L),
+                                                    0xFFFFL)));
+    }
+
+    // Relay agent information of the client's relay. The link-selection
+    // sub-option (RFC 3527) selects the relay's subnet while the
+    // responses are still sent to the local address in giaddr.
+    if (options_.getRelaysNum() > 0) {
+        const uint32_t relay = index % options_.getRelaysNum();
+        std::ostringstream circuit_id;
+        circuit_id << "relay" << relay << "/client" << index;
+        const std::string circuit_id_text = circuit_id.str();
+        OptionPtr rai(new Option(Option::V4, DHO_DHCP_AGENT_OPTIONS));
+        rai->addOption(OptionPtr(new Option(Option::V4,
+                                            RAI_OPTION_AGENT_CIRCUIT_ID,
+                                            OptionBuffer(circuit_id_text.begin(),
+                                                         circuit_id_text.end()))));
+        rai->addOption(OptionPtr(new Option(Option::V4, RAI_OPTION_REMOTE_ID,
+                                            mac)));
+        rai->addOption(createUint32Option(RAI_OPTION_LINK_SELECTION,
+                                          relay_base_ + (relay << 8)));
+        pkt->addOption(rai);
+    }
+    return (pkt);
+}
+
+void
+PopulationScen::schedule(const uint32_t index, ptime time) {
+    Client& client = clients_[index];
+    if (!client.leave_time_.is_not_a_date_time() &&
+        (client.leave_time_ < time)) {
+        time = client.leave_time_;
+    }
+    ++client.timer_seq_;
+    if (time.is_pos_infinity()) {
+        return;
+    }
+    TimerEvent event = { time, index, client.timer_seq_ };
+    timers_.push(event);
+}
+
+time_duration
+PopulationScen::draw(const CommandOptions::Distribution& distribution) {
+    double duration = 0.;
+    switch (distribution.getType()) {
+    case CommandOptions::Distribution::NEVER:
+        return (time_duration(not_a_date_time));
+    case CommandOptions::Distribution::FIXED:
+        duration = distribution.getMin();
+        break;
+    case CommandOptions::Distribution::UNIFORM:
+        duration = std::uniform_real_distribution<double>(
+            distribution.getMin(), distribution.getMax())(random_);
+        break;
+    case CommandOptions::Distribution::EXPONENTIAL:
+        if (distribution.getMin() > 0.) {
+            duration = std::exponential_distribution<double>(
+                1. / distribution.getMin())(random_);
+        }
+        break;
+    }
+    return (microseconds(static_cast<int64_t>(duration * 1000000.)));
+}
+
+time_duration
+PopulationScen::jitter(const int seconds) {
+    return (milliseconds(seconds * 1000 +
+                         std::uniform_int_distribution<int>(-1000, 1000)(random_)));
+}
+
+ExchangeType
+PopulationScen::exchangeType(const ClientState state) {
+    switch (state) {
+    case SELECTING:
+        return (ExchangeType::DO);
+    case REQUESTING:
+    case REBOOTING:
+        return (ExchangeType::RA);
+    case RENEWING:
+    case REBINDING:
+        return (ExchangeType::RNA);
+    default:
+        isc_throw(BadValue, "no exchange type for client state " << state);
+    }
+}
+
+int
+PopulationScen::run() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+
+    tc_.start();
+
+    const ptime start = microsec_clock::universal_time();
+    scheduleArrivals(start);
+    bool storm_pending = (options_.getRebootStorm() > 0);
+
+    for (;;) {
+        ptime now = microsec_clock::universal_time();
+
+        if (storm_pending &&
+            ((now - start) >= seconds(options_.getRebootStorm()))) {
+            std::cout << now << ": reboot storm" << std::endl;
+            rebootStorm(now);
+            storm_pending = false;
+        }
+
+        // Send the requests due, within the rate limit if any.
+        size_t events = 0;
+        if (options_.getRate() == 0) {
+            events = processTimers(now);
+        } else {
+            const uint64_t due = rate_control_.getOutboundMessageCount();
+            if (due > 0) {
+                events = processTimers(now, due);
+            }
+        }
+        tc_.getSocket().flush();
+
+        // Pull the responses and send the requests which follow.
+        unsigned int pkt_count = 0;
+        PktPtr pkt;
+        while ((pkt = tc_.getReceivedPacket())) {
+            ++pkt_count;
+            Pkt4Ptr pkt4 = boost::dynamic_pointer_cast<Pkt4>(pkt);
+            if (pkt4) {
+                processPacket(pkt4, microsec_clock::universal_time());
+            }
+        }
+        tc_.getSocket().flush();
+
+        // Report delay means that user requested printing number
+        // of sent/received/dropped packets repeatedly.
+        if (options_.getReportDelay() > 0) {
+            tc_.printIntermediateStats();
+        }
+
+        if (tc_.interrupted()) {
+            break;
+        }
+        if ((options_.getPeriod() != 0) &&
+            ((now - start).total_seconds() >= options_.getPeriod())) {
+            if (options_.testDiags('e')) {
+                std::cout << "reached test-period." << std::endl;
+            }
+            break;
+        }
+
+        if ((events == 0) && (pkt_count == 0)) {
+            usleep(1);
+        }
+    }
+
+    tc_.stop();
+
+    tc_.printStats();
+
+    // Print packet timestamps
+    if (options_.testDiags('t')) {
+        stats_mgr.printTimestamps();
+    }
+
+    // Print server id.
+    if (options_.testDiags('s') && tc_.serverIdReceived()) {
+        std::cout << "Server id: " << tc_.getServerId() << std::endl;
+    }
+
+    std::cout << "***Population***" << std::endl
+              << "clients: " << clients_.size() << std::endl
+              << "offline: " << getClientsNum(OFFLINE) << std::endl
+              << "bound: " << getClientsNum(BOUND) << std::endl
+              << "acquiring: " << (getClientsNum(SELECTING) +
+                                   getClientsNum(REQUESTING) +
+                                   getClientsNum(REBOOTING)) << std::endl
+              << "extending: " << (getClientsNum(RENEWING) +
+                                   getClientsNum(REBINDING)) << std::endl
+              << "discovers: " << discovers_ << std::endl
+              << "init-reboots: " << reboots_ << std::endl
+              << "renews: " << renews_ << std::endl
+              << "rebinds: " << rebinds_ << std::endl
+              << "releases: " << releases_ << std::endl
+              << "naks: " << naks_ << std::endl
+              << "expired leases: " << expirations_ << std::endl
+              << "retransmissions: " << retransmissions_ << std::endl;
+
+    return (stats_mgr.droppedPackets() ? 3 : 0);
+}
+
+} // namespace perfdhcp
+} // namespace isc
@@ -0,0 +1,291 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef POPULATION_SCEN_H
+#define POPULATION_SCEN_H
+
+#include <config.h>
+
+#include <perfdhcp/abstract_scen.h>
+#include <perfdhcp/rate_control.h>
+
+#include <dhcp/pkt4.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Population Scenario class.
+///
+/// This class is used to run the performance test where the DHCPv4
+/// server is loaded by a population of clients following their lease
+/// lifetimes rather than by a fixed rate of new exchanges. Each client
+/// joins the network after a time drawn from the arrival distribution,
+/// gets a lease in a 4-way exchange, renews it at T1, rebinds at T2
+/// and starts over when the lease expires. It leaves the network after
+/// a time drawn from the departure distribution, releasing the lease
+/// or keeping it, in which case it sends an INIT-REBOOT request when it
+/// comes back. The clients can be spread among simulated relays and
+/// may be rebooted all at once to test the server under a reboot storm.
+class PopulationScen : public AbstractScen {
+public:
+    /// \brief Default and the only constructor of PopulationScen.
+    ///
+    /// \param options reference to command options,
+    /// \param socket reference to a socket.
+    PopulationScen(CommandOptions& options, BasePerfSocket& socket);
+
+    /// \brief Run performance test.
+    ///
+    /// Method runs the test until the test period (-p) has elapsed
+    /// or the test has been interrupted.
+    ///
+    /// \return execution status.
+    int run() override;
+
+protected:
+    /// \brief States of a simulated client (RFC 2131, section 4.4).
+    enum ClientState {
+        OFFLINE,    ///< The client is not in the network.
+        SELECTING,  ///< DISCOVER sent, waiting for an OFFER.
+        REQUESTING, ///< REQUEST sent after an OFFER, waiting for an ACK.
+        REBOOTING,  ///< INIT-REBOOT REQUEST sent, waiting for an ACK.
+        BOUND,      ///< The client holds a lease.
+        RENEWING,   ///< REQUEST unicast at T1, waiting for an ACK.
+        REBINDING   ///< REQUEST broadcast at T2, waiting for an ACK.
+    };
+
+    /// \brief Simulated client.
+    struct Client {
+        /// \brief Constructor.
+        Client();
+
+        /// \brief Current state.
+        ClientState state_;
+
+        /// \brief Leased or offered address, 0 if none.
+        uint32_t address_;
+
+        /// \brief Server identifier from the last OFFER or ACK.
+        uint32_t server_id_;
+
+        /// \brief Transaction id of the last request.
+        uint32_t transid_;
+
+        /// \brief Counter making each transaction id of the client unique.
+        uint8_t transid_counter_;
+
+        /// \brief Number of retransmissions of the outstanding request.
+        uint8_t retries_;
+
+        /// \brief Sequence number of the pending timer event.
+        uint32_t timer_seq_;
+
+        /// \brief Time the current exchange started, for the secs field.
+        boost::posix_time::ptime exchange_start_;
+
+        /// \brief Renewal time (T1).
+        boost::posix_time::ptime renew_time_;
+
+        /// \brief Rebinding time (T2).
+        boost::posix_time::ptime rebind_time_;
+
+        /// \brief Expiration time of the lease.
+        boost::posix_time::ptime expire_time_;
+
+        /// \brief Time the client leaves the network, not_a_date_time
+        /// if it never leaves.
+        boost::posix_time::ptime leave_time_;
+    };
+
+    /// \brief Timer event of a client.
+    ///
+    /// Each client has at most one valid event. Rescheduling a client
+    /// increments its timer sequence number so the events queued before
+    /// are ignored when they are due.
+    struct TimerEvent {
+        /// \brief Time the event is due.
+        boost::posix_time::ptime time_;
+
+        /// \brief Index of the client.
+        uint32_t client_;
+
+        /// \brief Timer sequence number of the client when scheduled.
+        uint32_t seq_;
+
+        /// \brief Orders the events from the latest to the earliest, so
+        /// as the earliest is on the top of the priority queue.
+        bool operator<(const TimerEvent& other) const {
+            return (time_ > other.time_);
+        }
+    };
+
+    /// \brief Maximum number of retransmissions of a REQUEST in the
+    /// REQUESTING and REBOOTING states before going back to DISCOVER.
+    static const uint8_t MAX_REQUEST_RETRIES = 4;
+
+    /// \brief Minimum delay between retransmissions of the renewals and
+    /// rebinds (RFC 2131, section 4.4.5), in seconds.
+    static const int MIN_RENEW_RETRY_DELAY = 60;
+
+    /// \brief Processes the timer events due at a given time.
+    ///
+    /// \param now current time.
+    /// \param max_events maximum number of events to process, 0 means
+    /// no limit.
+    /// \return number of processed events.
+    size_t processTimers(const boost::posix_time::ptime& now,
+                         const size_t max_events = 0);
+
+    /// \brief Processes a packet received from the server.
+    ///
+    /// \param pkt received packet.
+    /// \param now current time.
+    void processPacket(const dhcp::Pkt4Ptr& pkt,
+                       const boost::posix_time::ptime& now);
+
+    /// \brief Reboots all clients which are in the network.
+    ///
+    /// \param now current time.
+    void rebootStorm(const boost::posix_time::ptime& now);
+
+    /// \brief Schedules the arrival of all clients.
+    ///
+    /// \param now start time of the test.
+    void scheduleArrivals(const boost::posix_time::ptime& now);
+
+    /// \brief Returns the number of clients in a state.
+    ///
+    /// \param state state of the clients.
+    size_t getClientsNum(const ClientState state) const;
+
+    /// \brief Simulated clients.
+    std::vector<Client> clients_;
+
+    /// \brief Queue of the timer events of the clients.
+    std::priority_queue<TimerEvent> timers_;
+
+    /// \brief Generator of the random durations and decisions.
+    std::mt19937 random_;
+
+    /// \brief Rate control limiting the requests sent on timer events.
+    RateControl rate_control_;
+
+    /// \brief Link address of the first relay.
+    uint32_t relay_base_;
+
+    /// \brief Number of exchanges started with a DISCOVER.
+    uint64_t discovers_;
+
+    /// \brief Number of exchanges started with an INIT-REBOOT REQUEST.
+    uint64_t reboots_;
+
+    /// \brief Number of renewals started at T1.
+    uint64_t renews_;
+
+    /// \brief Number of rebinds started at T2.
+    uint64_t rebinds_;
+
+    /// \brief Number of RELEASEs sent.
+    uint64_t releases_;
+
+    /// \brief Number of NAKs received.
+    uint64_t naks_;
+
+    /// \brief Number of leases expired before they were extended.
+    uint64_t expirations_;
+
+    /// \brief Number of retransmitted requests.
+    uint64_t retransmissions_;
+
+private:
+    /// \brief Handles a timer event of a client.
+    ///
+    /// \param index index of the client.
+    /// \param now current time.
+    void handleTimer(const uint32_t index,
+                     const boost::posix_time::ptime& now);
+
+    /// \brief Brings a client into the network.
+    ///
+    /// \param index index of the client.
+    /// \param now current time.
+    void arrive(const uint32_t index, const boost::posix_time::ptime& now);
+
+    /// \brief Takes a client out of the network.
+    ///
+    /// \param index index of the client.
+    /// \param now current time.
+    void depart(const uint32_t index, const boost::posix_time::ptime& now);
+
+    /// \brief Binds a client to the lease carried by an ACK.
+    ///
+    /// \param index index of the client.
+    /// \param ack received ACK.
+    /// \param now current time.
+    void bind(const uint32_t index, const dhcp::Pkt4Ptr& ack,
+              const boost::posix_time::ptime& now);
+
+    /// \brief Starts a new exchange of a client and sends its request.
+    ///
+    /// \param index index of the client.
+    /// \param state state of the client sending the request.
+    /// \param now current time.
+    void startExchange(const uint32_t index, const ClientState state,
+                       const boost::posix_time::ptime& now);
+
+    /// \brief Sends the request of a client in its current state and
+    /// schedules its retransmission.
+    ///
+    /// \param index index of the client.
+    /// \param now current time.
+    void sendRequest(const uint32_t index,
+                     const boost::posix_time::ptime& now);
+
+    /// \brief Creates a packet of a client.
+    ///
+    /// \param index index of the client.
+    /// \param msg_type DHCP message type.
+    /// \param now current time.
+    /// \return packet with the common fields and options set.
+    dhcp::Pkt4Ptr createPacket(const uint32_t index, const uint8_t msg_type,
+                               const boost::posix_time::ptime& now);
+
+    /// \brief Schedules the timer event of a client.
+    ///
+    /// The event is moved earlier to the leave time of the client.
+    ///
+    /// \param index index of the client.
+    /// \param time time of the event.
+    void schedule(const uint32_t index, boost::posix_time::ptime time);
+
+    /// \brief Returns a duration drawn from a distribution.
+    ///
+    /// \param distribution distribution of the duration.
+    /// \return duration, not_a_date_time for the 'never' distribution.
+    boost::posix_time::time_duration
+    draw(const CommandOptions::Distribution& distribution);
+
+    /// \brief Returns a delay randomized by up to one second.
+    ///
+    /// \param seconds delay in seconds.
+    boost::posix_time::time_duration jitter(const int seconds);
+
+    /// \brief Returns the exchange type of the requests sent in a state.
+    ///
+    /// \param state state of the client.
+    static ExchangeType exchangeType(const ClientState state);
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // POPULATION_SCEN_H
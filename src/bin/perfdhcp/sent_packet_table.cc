@@ -0,0 +1,177 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <perfdhcp/sent_packet_table.h>
+
+#include <exceptions/exceptions.h>
+
+namespace isc {
+namespace perfdhcp {
+
+const size_t SentPacketTable::DEFAULT_CAPACITY;
+const uint64_t SentPacketTable::EMPTY;
+
+SentPacketTable::SentPacketTable(const size_t capacity)
+    : slots_(),
+      size_(0),
+      queue_(),
+      head_seq_(0) {
+    size_t slots_num = 1;
+    while (slots_num < capacity) {
+        slots_num <<= 1;
+    }
+    Slot empty = { EMPTY, 0 };
+    slots_.assign(slots_num, empty);
+}
+
+dhcp::PktPtr
+SentPacketTable::insert(const dhcp::PktPtr& packet) {
+    if (!packet) {
+        isc_throw(BadValue, "Packet is null");
+    }
+    const uint32_t transid = packet->getTransid();
+    const uint64_t seq = head_seq_ + queue_.size();
+    size_t probes = 0;
+    size_t index = find(transid, probes);
+    dhcp::PktPtr replaced;
+    if (slots_[index].seq_ != EMPTY) {
+        // The response to the packet having the same transaction id will
+        // never be matched, so drop it.
+        dhcp::PktPtr& old = queue_[slots_[index].seq_ - head_seq_];
+        replaced.swap(old);
+        slots_[index].seq_ = seq;
+        queue_.push_back(packet);
+        trim();
+        return (replaced);
+    }
+
+    // Keep the table at most half full so the probe sequences are short.
+    if (2 * (size_ + 1) > slots_.size()) {
+        grow();
+        index = find(transid, probes);
+    }
+    slots_[index].seq_ = seq;
+    slots_[index].transid_ = transid;
+    ++size_;
+    queue_.push_back(packet);
+    return (replaced);
+}
+
+dhcp::PktPtr
+SentPacketTable::match(const uint32_t transid, bool& oldest, size_t& probes) {
+    probes = 0;
+    const size_t index = find(transid, probes);
+    if (slots_[index].seq_ == EMPTY) {
+        oldest = false;
+        return (dhcp::PktPtr());
+    }
+    oldest = (slots_[index].seq_ == head_seq_);
+    return (take(index));
+}
+
+dhcp::PktPtr
+SentPacketTable::expire(const boost::posix_time::ptime& deadline) {
+    // The head of the queue is never a hole.
+    if (queue_.empty() || (queue_.front()->getTimestamp() >= deadline)) {
+        return (dhcp::PktPtr());
+    }
+    size_t probes = 0;
+    return (take(find(queue_.front()->getTransid(), probes)));
+}
+
+size_t
+SentPacketTable::home(const uint32_t transid) const {
+    // Fibonacci hashing spreads the transaction ids which differ only
+    // in their high bits, like those of the population scenario.
+    const uint64_t product = static_cast<uint64_t>(transid) *
+        0x9E3779B97F4A7C15ULL;
+    return (static_cast<size_t>(product >> 32) & (slots_.size() - 1));
+}
+
+size_t
+SentPacketTable::find(const uint32_t transid, size_t& probes) const {
+    const size_t mask = slots_.size() - 1;
+    size_t index = home(transid);
+    for (;;) {
+        ++probes;
+        const Slot& slot = slots_[index];
+        if ((slot.seq_ == EMPTY) || (slot.transid_ == transid)) {
+            return (index);
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+void
+SentPacketTable::remove(size_t index) {
+    const size_t mask = slots_.size() - 1;
+    size_t next = (index + 1) & mask;
+    while (slots_[next].seq_ != EMPTY) {
+        // The entry can fill the hole if the hole lies between its home
+        // and its current place, otherwise it would not be found anymore.
+        const size_t next_home = home(slots_[next].transid_);
+        if (((next - next_home) & mask) >= ((next - index) & mask)) {
+            slots_[index] = slots_[next];
+            index = next;
+        }
+        next = (next + 1) & mask;
+    }
+    slots_[index].seq_ = EMPTY;
+}
+
+dhcp::PktPtr
+SentPacketTable::take(const size_t index) {
+    dhcp::PktPtr packet;
+    packet.swap(queue_[slots_[index].seq_ - head_seq_]);
+    remove(index);
+    --size_;
+    trim();
+    return (packet);
+}
+
+void
+SentPacketTable::grow() {
+    std::vector<Slot> old_slots;
+    old_slots.swap(slots_);
+    Slot empty = { EMPTY, 0 };
+    slots_.assign(2 * old_slots.size(), empty);
+    for (const auto& slot : old_slots) {
+        if (slot.seq_ != EMPTY) {
+            size_t probes = 0;
+            slots_[find(slot.transid_, probes)] = slot;
+        }
+    }
+}
+
+void
+SentPacketTable::trim() {
+    while (!queue_.empty() && !queue_.front()) {
+        queue_.pop_front();
+        ++head_seq_;
+    }
+    // Holes stay in the middle of the queue while an older packet is
+    // outstanding, e.g. when the drop detection is disabled. Compacting
+    // the queue costs a lookup per outstanding packet, which is paid
+    // by the holes removed.
+    if (queue_.size() <= 2 * size_ + DEFAULT_CAPACITY) {
+        return;
+    }
+    PacketQueue compacted;
+    for (const auto& packet : queue_) {
+        if (packet) {
+            size_t probes = 0;
+            const size_t index = find(packet->getTransid(), probes);
+            slots_[index].seq_ = head_seq_ + compacted.size();
+            compacted.push_back(packet);
+        }
+    }
+    queue_.swap(compacted);
+}
+
+} // namespace perfdhcp
+} // namespace isc
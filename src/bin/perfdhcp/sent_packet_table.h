@@ -0,0 +1,183 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SENT_PACKET_TABLE_H
+#define SENT_PACKET_TABLE_H
+
+#include <dhcp/pkt.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/iterator/filter_iterator.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Table of the packets sent and waiting for a response.
+///
+/// The packets are indexed by their full transaction id in an open
+/// addressing hash table with linear probing, so a received packet is
+/// matched with the sent one in constant time whatever the number of
+/// outstanding packets and the order of the responses. The table is
+/// preallocated and doubled when it gets half full, and the removals
+/// shift the following entries back instead of leaving tombstones.
+///
+/// The packets are also kept in a queue in the order they were sent,
+/// which is the order of their timestamps. The queue is used as the
+/// timing wheel of the drop detection: the packets sent before a
+/// deadline are all at its head, so collecting them doesn't need any
+/// search. Matched packets leave a hole in the queue which is skipped
+/// when it reaches the head; the queue is compacted when the holes
+/// outnumber the outstanding packets.
+///
+/// A packet with the same transaction id as an outstanding one
+/// replaces it.
+class SentPacketTable {
+public:
+    /// \brief Queue of the sent packets, a null pointer being a hole.
+    typedef std::deque<dhcp::PktPtr> PacketQueue;
+
+    /// \brief Predicate skipping the holes of the queue.
+    struct IsOutstanding {
+        bool operator()(const dhcp::PktPtr& packet) const {
+            return (static_cast<bool>(packet));
+        }
+    };
+
+    /// \brief Iterator over the outstanding packets, from the oldest
+    /// to the latest.
+    typedef boost::filter_iterator<IsOutstanding,
+                                   PacketQueue::iterator> iterator;
+
+    /// \brief Constant iterator over the outstanding packets.
+    typedef boost::filter_iterator<IsOutstanding,
+                                   PacketQueue::const_iterator> const_iterator;
+
+    /// \brief Default number of entries of the hash table.
+    static const size_t DEFAULT_CAPACITY = 1024;
+
+    /// \brief Constructor.
+    ///
+    /// \param capacity initial number of entries of the hash table,
+    /// rounded up to a power of two.
+    explicit SentPacketTable(const size_t capacity = DEFAULT_CAPACITY);
+
+    /// \brief Adds a sent packet.
+    ///
+    /// \param packet packet to be added, not null.
+    /// \return packet with the same transaction id which has been
+    /// replaced or null pointer.
+    dhcp::PktPtr insert(const dhcp::PktPtr& packet);
+
+    /// \brief Finds and removes the packet with a transaction id.
+    ///
+    /// \param transid transaction id of the received packet.
+    /// \param [out] oldest set to true if the packet was the oldest
+    /// outstanding one, i.e. the responses come in order.
+    /// \param [out] probes number of entries of the hash table which
+    /// have been read.
+    /// \return matching packet or null pointer if not found.
+    dhcp::PktPtr match(const uint32_t transid, bool& oldest, size_t& probes);
+
+    /// \brief Removes the oldest packet if it was sent before a deadline.
+    ///
+    /// \param deadline time before which the packets are dropped.
+    /// \return removed packet or null pointer if the oldest packet was
+    /// sent after the deadline or there is no packet.
+    dhcp::PktPtr expire(const boost::posix_time::ptime& deadline);
+
+    /// \brief Returns the number of outstanding packets.
+    size_t size() const { return (size_); }
+
+    /// \brief Returns the number of entries of the hash table.
+    size_t capacity() const { return (slots_.size()); }
+
+    /// \brief Returns an iterator to the oldest outstanding packet.
+    iterator begin() {
+        return (iterator(IsOutstanding(), queue_.begin(), queue_.end()));
+    }
+
+    /// \brief Returns an iterator past the latest outstanding packet.
+    iterator end() {
+        return (iterator(IsOutstanding(), queue_.end(), queue_.end()));
+    }
+
+    /// \brief Returns a constant iterator to the oldest outstanding packet.
+    const_iterator begin() const {
+        return (const_iterator(IsOutstanding(), queue_.begin(),
+                               queue_.end()));
+    }
+
+    /// \brief Returns a constant iterator past the latest outstanding
+    /// packet.
+    const_iterator end() const {
+        return (const_iterator(IsOutstanding(), queue_.end(), queue_.end()));
+    }
+
+private:
+    /// \brief Entry of the hash table.
+    struct Slot {
+        /// \brief Sequence number of the packet in the queue, EMPTY
+        /// if the entry is not used.
+        uint64_t seq_;
+
+        /// \brief Transaction id of the packet.
+        uint32_t transid_;
+    };
+
+    /// \brief Sequence number of the unused entries.
+    static const uint64_t EMPTY = 0xFFFFFFFFFFFFFFFFULL;
+
+    /// \brief Returns the first entry where a transaction id is looked for.
+    ///
+    /// \param transid transaction id.
+    size_t home(const uint32_t transid) const;
+
+    /// \brief Finds the entry of a transaction id.
+    ///
+    /// \param transid transaction id.
+    /// \param [out] probes number of entries read.
+    /// \return index of the entry or of the empty entry ending the search.
+    size_t find(const uint32_t transid, size_t& probes) const;
+
+    /// \brief Frees an entry and moves back the entries following it.
+    ///
+    /// \param index index of the entry.
+    void remove(size_t index);
+
+    /// \brief Returns the packet of an entry and frees the entry.
+    ///
+    /// \param index index of the entry.
+    dhcp::PktPtr take(const size_t index);
+
+    /// \brief Doubles the size of the hash table.
+    void grow();
+
+    /// \brief Skips the holes at the head of the queue and compacts it
+    /// when there are too many holes.
+    void trim();
+
+    /// \brief Entries of the hash table, the size is a power of two.
+    std::vector<Slot> slots_;
+
+    /// \brief Number of outstanding packets.
+    size_t size_;
+
+    /// \brief Sent packets in the order of sending.
+    PacketQueue queue_;
+
+    /// \brief Sequence number of the packet at the head of the queue.
+    uint64_t head_seq_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // SENT_PACKET_TABLE_H
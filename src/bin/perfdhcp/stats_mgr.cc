@@ -6,10 +6,57 @@
 
 #include <perfdhcp/stats_mgr.h>
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
 
 namespace isc {
 namespace perfdhcp {
 
+namespace {
+
+/// \brief Percentiles of delays printed in intermediate reports.
+const struct {
+    double value;
+    const char* name;
+} REPORTED_PERCENTILES[] = {
+    { 50., "p50" },
+    { 90., "p90" },
+    { 99., "p99" },
+    { 99.9, "p99.9" }
+};
+
+/// \brief Returns the short name of an exchange type.
+///
+/// It is used to name the exchanges in the JSON and CSV reports.
+///
+/// \param xchg_type exchange type.
+/// \return short name.
+std::string
+exchangeShortName(const ExchangeType xchg_type) {
+    switch(xchg_type) {
+    case ExchangeType::DO:
+        return("DO");
+    case ExchangeType::RA:
+        return("RA");
+    case ExchangeType::RNA:
+        return("RNA");
+    case ExchangeType::SA:
+        return("SA");
+    case ExchangeType::RR:
+        return("RR");
+    case ExchangeType::RN:
+        return("RN");
+    case ExchangeType::RL:
+        return("RL");
+    default:
+        return("unknown");
+    }
+}
+
+}
+
 std::ostream& operator<<(std::ostream& os, ExchangeType xchg_type)
 {
     switch(xchg_type) {
@@ -47,6 +94,8 @@ ExchangeStats::ExchangeStats(const ExchangeType xchg_type,
       max_delay_(0.),
       sum_delay_(0.),
       sum_delay_squared_(0.),
+      delays_(),
+      interval_delays_(),
       orphans_(0),
       collected_(0),
       unordered_lookup_size_sum_(0),
@@ -56,7 +105,6 @@ ExchangeStats::ExchangeStats(const ExchangeType xchg_type,
       rcvd_packets_num_(0),
       boot_time_(boot_time)
 {
-    next_sent_ = sent_packets_.begin();
 }
 
 
@@ -109,16 +157,22 @@ ExchangeStats::updateDelays(const dhcp::PktPtr& sent_packet,
     // mean delays.
     sum_delay_ += delta;
     sum_delay_squared_ += delta * delta;
+    // Record the delay in microseconds for the percentiles.
+    const uint64_t delta_usec = static_cast<uint64_t>(delta * 1e6 + 0.5);
+    delays_.record(delta_usec);
+    interval_delays_.record(delta_usec);
 }
 
 dhcp::PktPtr
 ExchangeStats::matchPackets(const dhcp::PktPtr& rcvd_packet) {
-    using namespace boost::posix_time;
-
     if (!rcvd_packet) {
         isc_throw(BadValue, "Received packet is null");
     }
 
+    // Packets waiting for longer than the drop time are assumed lost,
+    // even if the received packet is the response to one of them.
+    collectDropped(boost::posix_time::microsec_clock::universal_time());
+
     if (sent_packets_.size() == 0) {
         // List of sent packets is empty so there is no sense
         // to continue looking fo the packet. It also means
@@ -126,122 +180,28 @@ ExchangeStats::matchPackets(const dhcp::PktPtr& rcvd_packet) {
         // sent packet so orphans counter has to be updated.
         ++orphans_;
         return(dhcp::PktPtr());
-    } else if (next_sent_ == sent_packets_.end()) {
-        // Even if there are still many unmatched packets on the
-        // list we might hit the end of it because of unordered
-        // lookups. The next logical step is to reset iterator.
-        next_sent_ = sent_packets_.begin();
     }
 
-    // With this variable we will be signalling success or failure
-    // to find the packet.
-    bool packet_found = false;
-    // Most likely responses are sent from the server in the same
-    // order as client's requests to the server. We are caching
-    // next sent packet and first try to match it with the next
-    // incoming packet. We are successful if there is no
-    // packet drop or out of order packets sent. This is actually
-    // the fastest way to look for packets.
-    if ((*next_sent_)->getTransid() == rcvd_packet->getTransid()) {
+    // The sent packets are indexed by their transaction id so the
+    // lookup takes the same time whatever the order of the responses.
+    // We still keep statistics of ordered lookups, i.e. the responses
+    // to the oldest packet waiting, and of unordered lookups. If number
+    // of unordered lookups is high it may mean that many packets are
+    // lost or sent out of order.
+    bool oldest = false;
+    size_t probes = 0;
+    dhcp::PktPtr sent_packet =
+        sent_packets_.match(rcvd_packet->getTransid(), oldest, probes);
+    if (oldest) {
         ++ordered_lookups_;
-        packet_found = true;
     } else {
-        // If we are here, it means that we were unable to match the
-        // next incoming packet with next sent packet so we need to
-        // take a little more expensive approach to look packets using
-        // alternative index (transaction id & 1023).
-        PktListTransidHashIndex& idx = sent_packets_.template get<1>();
-        // Packets are grouped using transaction id masked with value
-        // of 1023. For instance, packets with transaction id equal to
-        // 1, 1024 ... will belong to the same group (a.k.a. bucket).
-        // When using alternative index we don't find the packet but
-        // bucket of packets and we need to iterate through the bucket
-        // to find the one that has desired transaction id.
-        std::pair<PktListTransidHashIterator,PktListTransidHashIterator> p =
-            idx.equal_range(hashTransid(rcvd_packet));
-        // We want to keep statistics of unordered lookups to make
-        // sure that there is a right balance between number of
-        // unordered lookups and ordered lookups. If number of unordered
-        // lookups is high it may mean that many packets are lost or
-        // sent out of order.
         ++unordered_lookups_;
-        // We also want to keep the mean value of the bucket. The lower
-        // bucket size the better. If bucket sizes appear to big we
-        // might want to increase number of buckets.
-        unordered_lookup_size_sum_ += std::distance(p.first, p.second);
-        bool non_expired_found = false;
-        // Removal can be done only after the loop
-        PktListRemovalQueue to_remove;
-        for (PktListTransidHashIterator it = p.first; it != p.second; ++it) {
-            // If transaction id is matching, we found the original
-            // packet sent to the server. Therefore, we reset the
-            // 'next sent' pointer to point to this location. We
-            // also indicate that the matching packet is found.
-            // Even though the packet has been found, we continue
-            // iterating over the bucket to remove all those packets
-            // that are timed out.
-            if (!packet_found && ((*it)->getTransid() == rcvd_packet->getTransid())) {
-                packet_found = true;
-                next_sent_ = sent_packets_.template project<0>(it);
-            }
-
-            if (!non_expired_found) {
-                // Check if the packet should be removed due to timeout.
-                // This includes the packet matching the received one.
-                ptime now = microsec_clock::universal_time();
-                ptime packet_time = (*it)->getTimestamp();
-                time_period packet_period(packet_time, now);
-                if (!packet_period.is_null()) {
-                    double period_fractional =
-                        packet_period.length().total_seconds() +
-                        (static_cast<double>(packet_period.length().fractional_seconds())
-                         / packet_period.length().ticks_per_second());
-                    if (drop_time_ > 0 && (period_fractional > drop_time_)) {
-                        // Push the iterator on the removal queue.
-                        to_remove.push(it);
-
-                    } else {
-                        // We found first non-expired transaction. All other
-                        // transactions within this bucket are considered
-                        // non-expired because packets are held in the
-                        // order of addition within the bucket.
-                        non_expired_found = true;
-                    }
-                }
-            }
-
-            // If we found the packet and all expired transactions,
-            // there is nothing more to do.
-            if (non_expired_found && packet_found) {
-                break;
-            }
-        }
-
-        // Deal with the removal queue.
-        while (!to_remove.empty()) {
-            PktListTransidHashIterator it = to_remove.front();
-            to_remove.pop();
-            // If timed out packet is not the one matching server response,
-            // we simply remove it and keep the pointer to the 'next sent'
-            // packet as it was. If the timed out packet appears to be the
-            // one that is matching the server response, we still want to
-            // remove it, but we need to update the 'next sent' pointer to
-            // point to a valid location.
-            if (sent_packets_.template project<0>(it) != next_sent_) {
-                eraseSent(sent_packets_.template project<0>(it));
-            } else {
-                next_sent_ = eraseSent(sent_packets_.template project<0>(it));
-                // We removed the matching packet because of the timeout. It
-                // means that there is no match anymore.
-                packet_found = false;
-            }
-            ++collected_;
-        }
+        unordered_lookup_size_sum_ += probes;
     }
 
-    if (!packet_found) {
-        // If we are here, it means that both ordered lookup and
-        // unordered lookup failed. Searched packet is not on the list.
+    if (!sent_packet) {
+        // If we are here, it means that the lookup failed.
+        // Searched packet is not on the list.
         ++orphans_;
         return(dhcp::PktPtr());
     }
@@ -249,14 +209,29 @@ ExchangeStats::matchPackets(const dhcp::PktPtr& rcvd_packet) {
     // Packet is matched so we count it. We don't count unmatched packets
     // as they are counted as orphans with a separate counter.
     ++rcvd_packets_num_;
-    dhcp::PktPtr sent_packet(*next_sent_);
-    // If packet was found, we assume it will be never searched
-    // again. We want to delete this packet from the list to
-    // improve performance of future searches.
-    next_sent_ = eraseSent(next_sent_);
+    archiveSent(sent_packet);
     return(sent_packet);
 }
 
+void
+ExchangeStats::collectDropped(const boost::posix_time::ptime& now) {
+    if (drop_time_ <= 0) {
+        return;
+    }
+    const boost::posix_time::ptime deadline = now -
+        boost::posix_time::microseconds(static_cast<int64_t>(drop_time_ * 1e6));
+    // The packets are removed in the order of sending, so this stops
+    // at the first packet which is not timed out.
+    for (;;) {
+        dhcp::PktPtr packet = sent_packets_.expire(deadline);
+        if (!packet) {
+            break;
+        }
+        archiveSent(packet);
+        ++collected_;
+    }
+}
+
 
 void
 ExchangeStats::printTimestamps() {
@@ -314,9 +289,36 @@ ExchangeStats::printTimestamps() {
     }
 }
 
+void
+ExchangeStats::merge(const ExchangeStats& other) {
+    min_delay_ = std::min(min_delay_, other.min_delay_);
+    max_delay_ = std::max(max_delay_, other.max_delay_);
+    sum_delay_ += other.sum_delay_;
+    sum_delay_squared_ += other.sum_delay_squared_;
+    delays_.merge(other.delays_);
+    interval_delays_.merge(other.interval_delays_);
+    orphans_ += other.orphans_;
+    collected_ += other.collected_;
+    unordered_lookup_size_sum_ += other.unordered_lookup_size_sum_;
+    unordered_lookups_ += other.unordered_lookups_;
+    ordered_lookups_ += other.ordered_lookups_;
+    sent_packets_num_ += other.sent_packets_num_;
+    rcvd_packets_num_ += other.rcvd_packets_num_;
+    for (const auto& packet : other.sent_packets_) {
+        sent_packets_.insert(packet);
+    }
+    rcvd_packets_.insert(rcvd_packets_.end(), other.rcvd_packets_.begin(),
+                         other.rcvd_packets_.end());
+    archived_packets_.insert(archived_packets_.end(),
+                             other.archived_packets_.begin(),
+                             other.archived_packets_.end());
+}
+
 StatsMgr::StatsMgr(CommandOptions& options) :
     exchanges_(),
-    boot_time_(boost::posix_time::microsec_clock::universal_time())
+    boot_time_(boost::posix_time::microsec_clock::universal_time()),
+    last_report_(boot_time_),
+    csv_header_printed_(false)
 {
     // Check if packet archive mode is required. If user
     // requested diagnostics option -x t we have to enable
@@ -328,7 +330,11 @@ StatsMgr::StatsMgr(CommandOptions& options) :
         if (options.getExchangeMode() == CommandOptions::DORA_SARR) {
             addExchangeStats(ExchangeType::RA, options.getDropTime()[1]);
         }
-        if (options.getRenewRate() != 0) {
+        if (options.getScenario() == Scenario::POPULATION) {
+            // The clients of the population scenario renew their leases
+            // and retransmit the requests which are not answered.
+            addExchangeStats(ExchangeType::RNA, options.getDropTime()[1]);
+        } else if (options.getRenewRate() != 0) {
             addExchangeStats(ExchangeType::RNA);
         }
 
@@ -349,6 +355,121 @@ StatsMgr::StatsMgr(CommandOptions& options) :
     }
 }
 
+void
+StatsMgr::merge(const StatsMgr& other) {
+    for (auto it : other.exchanges_) {
+        if (!hasExchangeStats(it.first)) {
+            // The drop time doesn't matter as the packets are not matched.
+            addExchangeStats(it.first);
+        }
+        getExchangeStats(it.first)->merge(*it.second);
+    }
+    for (auto it : other.custom_counters_) {
+        if (custom_counters_.find(it.first) == custom_counters_.end()) {
+            addCustomCounter(it.first, it.second->getName());
+        }
+        incrementCounter(it.first, it.second->getValue());
+    }
+}
+
+void
+StatsMgr::printIntermediateStats(const ReportFormat format) {
+    if (format == ReportFormat::TEXT) {
+        std::ostringstream stream_sent;
+        std::ostringstream stream_rcvd;
+        std::ostringstream stream_drops;
+        std::string sep("");
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+
+            if (it != exchanges_.begin()) {
+                sep = "/";
+            }
+            stream_sent << sep << it->second->getSentPacketsNum();
+            stream_rcvd << sep << it->second->getRcvdPacketsNum();
+            stream_drops << sep << it->second->getDroppedPacketsNum();
+        }
+        std::cout << "sent: " << stream_sent.str()
+                  << "; received: " << stream_rcvd.str()
+                  << "; drops: " << stream_drops.str()
+                  << std::endl;
+        return;
+    }
+
+    // The rate and the percentiles are measured since the previous
+    // report while the packet counters are totals since the start.
+    boost::posix_time::ptime now =
+        boost::posix_time::microsec_clock::universal_time();
+    double time = (now - boot_time_).total_microseconds() / 1e6;
+    double interval = (now - last_report_).total_microseconds() / 1e6;
+    last_report_ = now;
+
+    std::ostringstream s;
+    s << std::fixed << std::setprecision(3);
+    if (format == ReportFormat::CSV) {
+        if (!csv_header_printed_) {
+            s << "time,exchange,sent,received,drops,rate";
+            for (auto percentile : REPORTED_PERCENTILES) {
+                s << "," << percentile.name;
+            }
+            s << std::endl;
+            csv_header_printed_ = true;
+        }
+    } else {
+        s << "{ \"time\": " << time << ", \"exchanges\": {";
+    }
+
+    for (ExchangesMapIterator it = exchanges_.begin();
+         it != exchanges_.end(); ++it) {
+        ExchangeStatsPtr xchg_stats = it->second;
+        const LatencyHistogram& delays = xchg_stats->getIntervalDelays();
+        double rate = (interval > 0. ? delays.getCount() / interval : 0.);
+        std::string name = exchangeShortName(it->first);
+        if (format == ReportFormat::CSV) {
+            s << time << "," << name
+              << "," << xchg_stats->getSentPacketsNum()
+              << "," << xchg_stats->getRcvdPacketsNum()
+              << "," << xchg_stats->getDroppedPacketsNum()
+              << "," << rate;
+        } else {
+            if (it != exchanges_.begin()) {
+                s << ",";
+            }
+            s << " \"" << name << "\": {"
+              << " \"sent\": " << xchg_stats->getSentPacketsNum()
+              << ", \"received\": " << xchg_stats->getRcvdPacketsNum()
+              << ", \"drops\": " << xchg_stats->getDroppedPacketsNum()
+              << ", \"rate\": " << rate;
+        }
+        // Percentiles are in milliseconds. They are left empty when
+        // no response has been received during the interval.
+        for (auto percentile : REPORTED_PERCENTILES) {
+            if (format == ReportFormat::CSV) {
+                s << ",";
+            } else {
+                s << ", \"" << percentile.name << "\": ";
+            }
+            if (delays.getCount() > 0) {
+                s << delays.getPercentile(percentile.value) / 1e3;
+            } else if (format == ReportFormat::JSON) {
+                s << "null";
+            }
+        }
+        if (format == ReportFormat::JSON) {
+            s << " }";
+        } else {
+            s << std::endl;
+        }
+        xchg_stats->resetIntervalDelays();
+    }
+
+    if (format == ReportFormat::JSON) {
+        s << " } }" << std::endl;
+    }
+    std::cout << s.str() << std::flush;
+}
+
+
 
 }
 }
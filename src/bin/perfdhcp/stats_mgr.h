@@ -10,6 +10,8 @@
 #include <dhcp/pkt.h>
 #include <exceptions/exceptions.h>
 #include <perfdhcp/command_options.h>
+#include <perfdhcp/latency_histogram.h>
+#include <perfdhcp/sent_packet_table.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -79,7 +81,7 @@ public:
         return (this_counter);
     }
 
-    const CustomCounter& operator+=(int val) {
+    const CustomCounter& operator+=(uint64_t val) {
         counter_ += val;
         return (*this);
     }
@@ -133,7 +135,7 @@ public:
     /// Function hashes transaction id of the packet. Hashing is
     /// non-unique. Many packets may have the same hash value and thus
     /// they belong to the same packet buckets. Packet buckets are
-    /// used for unordered packets search with multi index container.
+    /// used to search the archived packets with multi index container.
     ///
     /// \param packet packet which transaction id is to be hashed.
     /// \throw isc::BadValue if packet is null.
@@ -145,23 +147,18 @@ public:
         return(packet->getTransid() & 1023);
     }
 
-    /// \brief List of packets (sent or received).
+    /// \brief List of packets (received or archived).
     ///
     /// List of packets based on multi index container allows efficient
     /// search of packets based on their sequence (order in which they
     /// were inserted) as well as based on their hashed transaction id.
     /// The first index (sequenced) provides the way to use container
     /// as a regular list (including iterators, removal of elements from
-    /// the middle of the collection etc.). This index is meant to be used
-    /// more frequently than the latter one and it is based on the
-    /// assumption that responses from the DHCP server are received in
-    /// order. In this case, when next packet is received it can be
-    /// matched with next packet on the list of sent packets. This
-    /// prevents intensive searches on the list of sent packets every
-    /// time new packet arrives. In many cases however packets can be
-    /// dropped by the server or may be sent out of order and we still
-    ///  want to have ability to search packets using transaction id.
-    /// The second index can be used for this purpose. This index is
+    /// the middle of the collection etc.). The packets which are still
+    /// waiting for a response are held in a \ref SentPacketTable
+    /// instead, which matches them in constant time. The list is used
+    /// when packets are archived for diagnostics, to search for the sent
+    /// packet corresponding to a received one. The second index is
     /// hashing transaction ids using custom function \ref hashTransid.
     /// Note that other possibility would be to simply specify index
     /// that uses transaction id directly (instead of hashing with
@@ -201,7 +198,7 @@ public:
     /// Example 3: Access elements through ordered index by hash
     /// \code
     /// // Get the instance of the second search index.
-    /// PktListTransidHashIndex& idx = sent_packets_.template get<1>();
+    /// PktListTransidHashIndex& idx = archived_packets_.template get<1>();
     /// // Get the range (bucket) of packets sharing the same transaction
     /// // id hash.
     /// std::pair<PktListTransidHashIterator,PktListTransidHashIterator> p =
@@ -249,9 +246,8 @@ public:
     /// Packet list iterator to access packets using transaction id hash.
     typedef typename PktListTransidHashIndex::const_iterator
     PktListTransidHashIterator;
-    /// Packet list iterator queue for removal.
-    typedef typename std::queue<PktListTransidHashIterator>
-    PktListRemovalQueue;
+    /// Iterator over the packets waiting for a response.
+    typedef SentPacketTable::iterator SentPacketsIterator;
 
     /// \brief Constructor
     ///
@@ -268,7 +264,9 @@ public:
 
     /// \brief Add new packet to list of sent packets.
     ///
-    /// Method adds new packet to list of sent packets.
+    /// Method adds new packet to list of sent packets. The packets
+    /// sent before the drop time elapsed are collected first, so as
+    /// the list doesn't grow when the server doesn't respond.
     ///
     /// \param packet packet object to be added.
     /// \throw isc::BadValue if packet is null.
@@ -277,7 +275,14 @@ public:
             isc_throw(BadValue, "Packet is null");
         }
         ++sent_packets_num_;
-        sent_packets_.template get<0>().push_back(packet);
+        collectDropped(packet->getTimestamp());
+        dhcp::PktPtr replaced = sent_packets_.insert(packet);
+        if (replaced) {
+            // A packet with the same transaction id can't be matched
+            // anymore.
+            archiveSent(replaced);
+            ++collected_;
+        }
     }
 
     /// \brief Add new packet to list of received packets.
@@ -310,11 +315,10 @@ public:
     /// Method finds packet with specified transaction id on the list
     /// of sent packets. It is used to match received packet with
     /// corresponding sent packet.
-    /// Since packets from the server most often come in the same order
-    /// as they were sent by client, this method will first check if
-    /// next sent packet matches. If it doesn't, function will search
-    /// the packet using indexing by transaction id. This reduces
-    /// packet search time significantly.
+    /// The packets sent before the drop time elapsed are collected
+    /// first. The packet is then searched using a hash table indexed
+    /// by transaction id, which takes constant time whatever the
+    /// number of packets waiting and the order of the responses.
     ///
     /// \param rcvd_packet received packet to be matched with sent packet.
     /// \throw isc::BadValue if received packet is null.
@@ -370,6 +374,33 @@ public:
                     getAvgDelay() * getAvgDelay()));
     }
 
+    /// \brief Return packet delay percentile.
+    ///
+    /// Method returns the delay below which lies the given percentage
+    /// of the packet delays. It is computed from a histogram, so its
+    /// relative error is lower than 1%.
+    ///
+    /// \param percentile percentage between 0 and 100.
+    /// \throw isc::InvalidOperation if no packets for this exchange
+    /// have been received yet.
+    /// \return packet delay percentile.
+    double getDelayPercentile(const double percentile) const {
+        if (delays_.getCount() == 0) {
+            isc_throw(InvalidOperation, "no packets received");
+        }
+        return(delays_.getPercentile(percentile) / 1e6);
+    }
+
+    /// \brief Return delays measured since the last intermediate report.
+    ///
+    /// \return histogram of the delays in microseconds.
+    const LatencyHistogram& getIntervalDelays() const {
+        return(interval_delays_);
+    }
+
+    /// \brief Start a new intermediate report interval.
+    void resetIntervalDelays() { interval_delays_.clear(); }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of received packets that had no matching
@@ -412,7 +443,8 @@ public:
     /// Method returns number of unordered sent packet lookups.
     /// Unordered lookup is used when received packet was sent
     /// out of order by server - transaction id of received
-    /// packet does not match transaction id of next sent packet.
+    /// packet does not match transaction id of the oldest packet
+    /// waiting for a response.
     ///
     /// \return number of unordered lookups.
     uint64_t getUnorderedLookups() const { return(unordered_lookups_); }
@@ -485,8 +517,9 @@ public:
     ///
     /// Method prints round trip time packets statistics. Statistics
     /// includes minimum packet delay, maximum packet delay, average
-    /// packet delay and standard deviation of delays. Packet delay
-    /// is a duration between sending a packet to server and receiving
+    /// packet delay, standard deviation of delays and the 50th, 90th,
+    /// 99th and 99.9th percentiles of delays. Packet delay is a
+    /// duration between sending a packet to server and receiving
     /// response from server.
     void printRTTStats() const {
         using namespace std;
@@ -497,6 +530,14 @@ public:
                  << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                  << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
                  << endl
+                 << "p50 delay: " << getDelayPercentile(50) * 1e3 << " ms"
+                 << endl
+                 << "p90 delay: " << getDelayPercentile(90) * 1e3 << " ms"
+                 << endl
+                 << "p99 delay: " << getDelayPercentile(99) * 1e3 << " ms"
+                 << endl
+                 << "p99.9 delay: " << getDelayPercentile(99.9) * 1e3
+                 << " ms" << endl
                  << "collected packets: " << getCollectedNum() << endl;
         } catch (const Exception&) {
             cout << "Delay summary unavailable! No packets received." << endl;
@@ -515,7 +556,19 @@ public:
     /// if packets archive mode is disabled.
     void printTimestamps();
 
-    std::tuple<PktListIterator, PktListIterator> getSentPackets() {
+    /// \brief Adds the statistics collected by another object.
+    ///
+    /// This is used to combine the statistics of the worker threads
+    /// which run the test in parallel. The packets held by the other
+    /// object are appended to the packets held by this one.
+    ///
+    /// \param other statistics of the same exchange type.
+    void merge(const ExchangeStats& other);
+
+    /// \brief Returns the packets waiting for a response.
+    ///
+    /// \return iterators to the oldest packet and past the latest one.
+    std::tuple<SentPacketsIterator, SentPacketsIterator> getSentPackets() {
         return(std::make_tuple(sent_packets_.begin(), sent_packets_.end()));
     }
 
@@ -529,14 +582,10 @@ private:
     /// class to specify exchange type explicitly.
     ExchangeStats();
 
-    /// \brief Erase packet from the list of sent packets.
+    /// \brief Archive packet removed from the list of sent packets.
     ///
-    /// Method erases packet from the list of sent packets.
-    ///
-    /// \param it iterator pointing to packet to be erased.
-    /// \return iterator pointing to packet following erased
-    /// packet or sent_packets_.end() if packet not found.
-    PktListIterator eraseSent(const PktListIterator it) {
+    /// \param packet packet matched or collected.
+    void archiveSent(const dhcp::PktPtr& packet) {
         if (archive_enabled_) {
             // We don't want to keep list of all sent packets
             // because it will affect packet lookup performance.
@@ -544,20 +593,23 @@ private:
             // move it to list of archived packets. List of
             // archived packets may be used for diagnostics
             // when test is completed.
-            archived_packets_.push_back(*it);
+            archived_packets_.push_back(packet);
         }
-        // get<0>() template returns sequential index to
-        // container.
-        return(sent_packets_.template get<0>().erase(it));
     }
 
+    /// \brief Collects the packets assumed dropped.
+    ///
+    /// Method removes the packets sent before the drop time elapsed
+    /// from the list of sent packets. It does nothing when the drop
+    /// time is not positive.
+    ///
+    /// \param now current time.
+    void collectDropped(const boost::posix_time::ptime& now);
+
     ExchangeType xchg_type_;             ///< Packet exchange type.
-    PktList sent_packets_;               ///< List of sent packets.
 
-    /// Iterator pointing to the packet on sent list which will most
-    /// likely match next received packet. This is based on the
-    /// assumption that server responds in order to incoming packets.
-    PktListIterator next_sent_;
+    /// Packets waiting for a response, indexed by transaction id.
+    SentPacketTable sent_packets_;
 
     PktList rcvd_packets_;         ///< List of received packets.
 
@@ -592,15 +644,18 @@ private:
     double sum_delay_squared_;     ///< Squared sum of delays between
                                    ///< sent and received packets.
 
+    LatencyHistogram delays_;          ///< Histogram of all delays.
+    LatencyHistogram interval_delays_; ///< Histogram of delays since
+                                       ///< the last intermediate report.
+
     uint64_t orphans_;   ///< Number of orphan received packets.
 
     uint64_t collected_; ///< Number of garbage collected packets.
 
-    /// Sum of unordered lookup sets. Needed to calculate mean size of
-    /// lookup set. It is desired that number of unordered lookups is
-    /// minimal for performance reasons. Tracking number of lookups and
-    /// mean size of the lookup set should give idea of packets search
-    /// complexity.
+    /// Sum of the numbers of hash table entries read by unordered
+    /// lookups. Needed to calculate mean size of lookup set. Tracking
+    /// number of lookups and mean size of the lookup set should give
+    /// idea of packets search complexity.
     uint64_t unordered_lookup_size_sum_;
 
     uint64_t unordered_lookups_;   ///< Number of unordered sent packets
@@ -652,6 +707,15 @@ public:
     /// large list of archived packets.
     StatsMgr(CommandOptions& options);
 
+    /// \brief Adds the statistics collected by another object.
+    ///
+    /// This is used to combine the statistics of the worker threads
+    /// which run the test in parallel. The exchange types and the
+    /// custom counters missing in this object are added.
+    ///
+    /// \param other statistics to be added.
+    void merge(const StatsMgr& other);
+
     /// \brief Specify new exchange type.
     ///
     /// This method creates new \ref ExchangeStats object that will
@@ -841,6 +905,21 @@ public:
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return packet delay percentile.
+    ///
+    /// Method returns the delay below which lies the given percentage
+    /// of the packet delays for specified exchange type.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param percentile percentage between 0 and 100.
+    /// \throw isc::BadValue if invalid exchange type specified.
+    /// \return packet delay percentile.
+    double getDelayPercentile(const ExchangeType xchg_type,
+                              const double percentile) const {
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        return(xchg_stats->getDelayPercentile(percentile));
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -873,7 +952,8 @@ public:
     /// Method returns number of unordered sent packet lookups.
     /// Unordered lookup is used when received packet was sent
     /// out of order by server - transaction id of received
-    /// packet does not match transaction id of next sent packet.
+    /// packet does not match transaction id of the oldest packet
+    /// waiting for a response.
     ///
     /// \param xchg_type exchange type.
     /// \throw isc::BadValue if invalid exchange type specified.
@@ -1003,27 +1083,12 @@ public:
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
-    void printIntermediateStats() const {
-        std::ostringstream stream_sent;
-        std::ostringstream stream_rcvd;
-        std::ostringstream stream_drops;
-        std::string sep("");
-        for (ExchangesMapIterator it = exchanges_.begin();
-             it != exchanges_.end(); ++it) {
-
-            if (it != exchanges_.begin()) {
-                sep = "/";
-            }
-            stream_sent << sep << it->second->getSentPacketsNum();
-            stream_rcvd << sep << it->second->getRcvdPacketsNum();
-            stream_drops << sep << it->second->getDroppedPacketsNum();
-        }
-        std::cout << "sent: " << stream_sent.str()
-                  << "; received: " << stream_rcvd.str()
-                  << "; drops: " << stream_drops.str()
-                  << std::endl;
-    }
+    /// counters. The JSON and CSV formats also include the rate of
+    /// responses and the percentiles of delays measured since the
+    /// previous report, so as the reports form a time series.
+    ///
+    /// \param format format of the report.
+    void printIntermediateStats(const ReportFormat format = ReportFormat::TEXT);
 
     /// \brief Print timestamps of all packets.
     ///
@@ -1072,9 +1137,9 @@ public:
         }
     }
 
-    std::tuple<typename ExchangeStats::PktListIterator, typename ExchangeStats::PktListIterator> getSentPackets(const ExchangeType xchg_type) const {
+    std::tuple<typename ExchangeStats::SentPacketsIterator, typename ExchangeStats::SentPacketsIterator> getSentPackets(const ExchangeType xchg_type) const {
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
-        std::tuple<typename ExchangeStats::PktListIterator, typename ExchangeStats::PktListIterator> sent_packets_its = xchg_stats->getSentPackets();
+        std::tuple<typename ExchangeStats::SentPacketsIterator, typename ExchangeStats::SentPacketsIterator> sent_packets_its = xchg_stats->getSentPackets();
         return(sent_packets_its);
     }
 
@@ -1110,6 +1175,12 @@ private:
     bool archive_enabled_;
 
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
+
+    /// Time of the previous intermediate report.
+    boost::posix_time::ptime last_report_;
+
+    /// Indicates that the header of the CSV report has been printed.
+    bool csv_header_printed_;
 };
 
 /// Pointer to Statistics Manager;
@@ -39,12 +39,11 @@ using namespace isc::asiolink;
 namespace isc {
 namespace perfdhcp {
 
-bool TestControl::interrupted_ = false;
+std::atomic<bool> TestControl::interrupted_(false);
 
 
 bool
 TestControl::waitToExit() const {
-    static ptime exit_time = ptime(not_a_date_time);
     uint32_t wait_time = options_.getExitWaitTime();
 
     // If we care and not all packets are in yet
@@ -52,12 +51,12 @@ TestControl::waitToExit() const {
         const ptime now = microsec_clock::universal_time();
 
         // Init the end time if it hasn't started yet
-        if (exit_time.is_not_a_date_time()) {
-            exit_time = now + time_duration(microseconds(wait_time));
+        if (exit_time_.is_not_a_date_time()) {
+            exit_time_ = now + time_duration(microseconds(wait_time));
         }
 
         // If we're not at end time yet, return true
-        return (now < exit_time);
+        return (now < exit_time_);
     }
 
     // No need to wait, return false;
@@ -99,11 +98,8 @@ TestControl::cleanCachedPackets() {
         return;
     }
 
-    static boost::posix_time::ptime last_clean =
-        microsec_clock::universal_time();
-
     // Check how much time has passed since last cleanup.
-    time_period time_since_clean(last_clean,
+    time_period time_since_clean(last_clean_,
                                  microsec_clock::universal_time());
     // Cleanup every 1 second.
     if (time_since_clean.length().total_seconds() >= 1) {
@@ -118,7 +114,7 @@ TestControl::cleanCachedPackets() {
         }
         // Remember when we performed a cleanup for the last time.
         // We want to do the next cleanup not earlier than in one second.
-        last_clean = microsec_clock::universal_time();
+        last_clean_ = microsec_clock::universal_time();
     }
 }
 
@@ -531,27 +527,32 @@ TestControl::sendPackets(const uint64_t packets_num,
             }
         }
     }
+    socket_.flush();
 }
 
 uint64_t
 TestControl::sendMultipleRequests(const uint64_t msg_num) {
-    for (uint64_t i = 0; i < msg_num; ++i) {
+    uint64_t i = 0;
+    for (; i < msg_num; ++i) {
         if (!sendRequestFromAck()) {
-            return (i);
+            break;
         }
     }
-    return (msg_num);
+    socket_.flush();
+    return (i);
 }
 
 uint64_t
 TestControl::sendMultipleMessages6(const uint32_t msg_type,
                                    const uint64_t msg_num) {
-    for (uint64_t i = 0; i < msg_num; ++i) {
+    uint64_t i = 0;
+    for (; i < msg_num; ++i) {
         if (!sendMessageFromReply(msg_type)) {
-            return (i);
+            break;
         }
     }
-    return (msg_num);
+    socket_.flush();
+    return (i);
 }
 
 void
@@ -676,7 +677,7 @@ TestControl::printIntermediateStats() {
     ptime now = microsec_clock::universal_time();
     time_period time_since_report(last_report_, now);
     if (time_since_report.length().total_seconds() >= delay) {
-        stats_mgr_.printIntermediateStats();
+        stats_mgr_.printIntermediateStats(options_.getReportFormat());
         last_report_ = now;
     }
 }
@@ -863,6 +864,8 @@ TestControl::consumeReceivedPackets() {
             processReceivedPacket6(pkt6);
         }
     }
+    // Send the requests queued in response to the received packets.
+    socket_.flush();
     return pkt_count;
 }
 void
@@ -956,6 +959,8 @@ TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
     socket_(socket),
     receiver_(socket, options.isSingleThreaded(), options.getIpVersion()),
     stats_mgr_(options),
+    exit_time_(not_a_date_time),
+    last_clean_(microsec_clock::universal_time()),
     options_(options)
 {
     // Reset singleton state before test starts.
@@ -1625,6 +1630,14 @@ TestControl::setDefaults4(const Pkt4Ptr& pkt) {
     pkt->setGiaddr(IOAddress(socket_.addr_));
     // Pretend that we have one relay (which is us).
     pkt->setHops(1);
+    // Each worker thread has its own local port. Ask the server to send
+    // the responses to this port (RFC 8357) rather than to port 67.
+    if (options_.getThreadsNum() > 1) {
+        OptionPtr rai(new Option(Option::V4, DHO_DHCP_AGENT_OPTIONS));
+        rai->addOption(OptionPtr(new Option(Option::V4, RAI_OPTION_RELAY_PORT,
+                                            OptionBuffer(2, 0))));
+        pkt->addOption(rai);
+    }
 }
 
 void
@@ -1659,6 +1672,14 @@ TestControl::setDefaults6(const Pkt6Ptr& pkt) {
       relay_info.hop_count_ = 1;
       relay_info.linkaddr_ = IOAddress(socket_.addr_);
       relay_info.peeraddr_ = IOAddress(socket_.addr_);
+      // Each worker thread has its own local port. Ask the server to send
+      // the responses to this port (RFC 8357) rather than to port 547.
+      if (options_.getThreadsNum() > 1) {
+          OptionPtr relay_port(new Option(Option::V6, D6O_RELAY_SOURCE_PORT,
+                                          OptionBuffer(2, 0)));
+          relay_info.options_.insert(std::make_pair(D6O_RELAY_SOURCE_PORT,
+                                                    relay_port));
+      }
       pkt->addRelayInfo(relay_info);
     }
 }
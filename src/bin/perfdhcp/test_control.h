@@ -25,6 +25,7 @@
 #include <boost/function.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -169,10 +170,13 @@ public:
         ///
         /// \param range maximum number generated. If 0 is given then
         /// range defaults to maximum uint32_t value.
-        SequentialGenerator(uint32_t range = 0xFFFFFFFF) :
+        /// \param base value added to the generated numbers, so as the
+        /// worker threads generate numbers from distinct ranges.
+        SequentialGenerator(uint32_t range = 0xFFFFFFFF, uint32_t base = 0) :
             NumberGenerator(),
             num_(0),
-            range_(range) {
+            range_(range),
+            base_(base) {
             if (range_ == 0) {
                 range_ = 0xFFFFFFFF;
             }
@@ -184,11 +188,12 @@ public:
         virtual uint32_t generate() {
             uint32_t num = num_;
             num_ = (num_ + 1) % range_;
-            return (num);
+            return (base_ + num);
         }
     private:
         uint32_t num_;   ///< Current number.
         uint32_t range_; ///< Number of unique numbers generated.
+        uint32_t base_;  ///< Value added to the generated numbers.
     };
 
     /// \brief Length of the Ethernet HW address (MAC) in bytes.
@@ -231,8 +236,16 @@ public:
 
     bool interrupted() const { return interrupted_; }
 
+    /// \brief Interrupts the test as if the user did.
+    ///
+    /// This is used to stop all worker threads when one of them fails.
+    static void interrupt() { interrupted_ = true; }
+
     StatsMgr& getStatsMgr() { return stats_mgr_; };
 
+    /// \brief Returns the socket used to send and receive packets.
+    BasePerfSocket& getSocket() { return socket_; }
+
     void start() { receiver_.start(); }
     void stop() { receiver_.stop(); }
 
@@ -292,7 +305,8 @@ public:
     /// \brief Print intermediate statistics.
     ///
     /// Print brief statistics regarding number of sent packets,
-    /// received packets and dropped packets so far.
+    /// received packets and dropped packets so far, in the format
+    /// selected with --report-format.
     void printIntermediateStats();
 
     /// \brief Print performance statistics.
@@ -308,6 +322,47 @@ public:
     /// in packet templates and their contents.
     void printTemplates() const;
 
+    /// \brief Pulls a packet received from the server.
+    ///
+    /// It is used by the scenarios which process the received packets
+    /// themselves rather than with \ref consumeReceivedPackets.
+    ///
+    /// \return received packet or null pointer if there is none.
+    dhcp::PktPtr getReceivedPacket() { return (receiver_.getPkt()); }
+
+    /// \brief Generate DHCPv4 client identifier from HW address.
+    ///
+    /// This method generates DHCPv4 client identifier option from a
+    /// HW address.
+    ///
+    /// \param hwaddr HW address.
+    ///
+    /// \return Pointer to an instance of the generated option.
+    dhcp::OptionPtr generateClientId(const dhcp::HWAddrPtr& hwaddr) const;
+
+    /// \brief Set default DHCPv4 packet parameters.
+    ///
+    /// This method sets default parameters on the DHCPv4 packet:
+    /// - interface name,
+    /// - local port = 68 (DHCP client port),
+    /// - remote port = 67 (DHCP server port),
+    /// - server's address,
+    /// - GIADDR = local address where socket is bound to,
+    /// - hops = 1 (pretending that we are a relay)
+    ///
+    /// \param pkt reference to packet to be configured.
+    void setDefaults4(const dhcp::Pkt4Ptr& pkt);
+
+    /// @brief Inserts extra options specified by user.
+    ///
+    /// Note: addExtraOpts for v4 and v6 could easily be turned into a template.
+    /// However, this would require putting code here that uses CommandOptions,
+    /// and that would create dependency between test_control.h and
+    /// command_options.h.
+    ///
+    /// @param pkt4 options will be added here
+    void addExtraOpts(const dhcp::Pkt4Ptr& pkt4);
+
     // We would really like following methods and members to be private but
     // they have to be accessible for unit-testing. Another, possibly better,
     // solution is to make this class friend of test class but this is not
@@ -450,16 +505,6 @@ protected:
                                                uint16_t type,
                                                const dhcp::OptionBuffer& buf);
 
-    /// \brief Generate DHCPv4 client identifier from HW address.
-    ///
-    /// This method generates DHCPv4 client identifier option from a
-    /// HW address.
-    ///
-    /// \param hwaddr HW address.
-    ///
-    /// \return Pointer to an instance of the generated option.
-    dhcp::OptionPtr generateClientId(const dhcp::HWAddrPtr& hwaddr) const;
-
     /// \brief Generate DUID.
     ///
     /// Method generates unique DUID. The number of DUIDs it can generate
@@ -764,19 +809,6 @@ protected:
     void sendSolicit6(const std::vector<uint8_t>& template_buf,
                       const bool preload = false);
 
-    /// \brief Set default DHCPv4 packet parameters.
-    ///
-    /// This method sets default parameters on the DHCPv4 packet:
-    /// - interface name,
-    /// - local port = 68 (DHCP client port),
-    /// - remote port = 67 (DHCP server port),
-    /// - server's address,
-    /// - GIADDR = local address where socket is bound to,
-    /// - hops = 1 (pretending that we are a relay)
-    ///
-    /// \param pkt reference to packet to be configured.
-    void setDefaults4(const dhcp::Pkt4Ptr& pkt);
-
     /// \brief Set default DHCPv6 packet parameters.
     ///
     /// This method sets default parameters on the DHCPv6 packet:
@@ -790,16 +822,6 @@ protected:
     /// \param pkt reference to packet to be configured.
     void setDefaults6(const dhcp::Pkt6Ptr& pkt);
 
-    /// @brief Inserts extra options specified by user.
-    ///
-    /// Note: addExtraOpts for v4 and v6 could easily be turned into a template.
-    /// However, this would require putting code here that uses CommandOptions,
-    /// and that would create dependency between test_control.h and
-    /// command_options.h.
-    ///
-    /// @param pkt4 options will be added here
-    void addExtraOpts(const dhcp::Pkt4Ptr& pkt4);
-
     /// @brief Inserts extra options specified by user.
     ///
     /// Note: addExtraOpts for v4 and v6 could easily be turned into a template.
@@ -951,7 +973,17 @@ protected:
     std::map<uint8_t, dhcp::Pkt4Ptr> template_packets_v4_;
     std::map<uint8_t, dhcp::Pkt6Ptr> template_packets_v6_;
 
-    static bool interrupted_;  ///< Is program interrupted.
+    /// Is program interrupted.
+    ///
+    /// It is set by the signal handler and by the failing worker
+    /// threads, and read by all worker threads.
+    static std::atomic<bool> interrupted_;
+
+    /// Time when the test exits if not all packets have been received.
+    mutable boost::posix_time::ptime exit_time_;
+
+    /// Last time cached packets were removed.
+    boost::posix_time::ptime last_clean_;
 
     CommandOptions& options_;
 };
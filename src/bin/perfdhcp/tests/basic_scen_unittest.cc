@@ -168,11 +168,17 @@ public:
     using BasicScen::renew_rate_control_;
     using BasicScen::release_rate_control_;
     using BasicScen::tc_;
+    using BasicScen::workers_;
 
     FakeScenPerfSocket fake_sock_;
 
     NakedBasicScen(CommandOptions &opt) : BasicScen(opt, fake_sock_), fake_sock_(opt) {};
 
+    /// \brief Creates fake sockets for the workers.
+    virtual BasePerfSocketPtr createWorkerSocket(CommandOptions& options,
+                                                 const unsigned int) override {
+        return (BasePerfSocketPtr(new FakeScenPerfSocket(options)));
+    }
 };
 
 
@@ -269,6 +275,27 @@ TEST_F(BasicScenTest, Packet4ExchangeMaxDrop10Proc) {
 }
 
 
+TEST_F(BasicScenTest, Packet4ExchangeThreads) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -r 100 -n 10 -g single"
+                   " --threads 2 127.0.0.1");
+    NakedBasicScen bs(opt);
+    bs.run();
+    ASSERT_EQ(2, bs.workers_.size());
+    // Each worker sends its share of the exchanges using its own socket.
+    EXPECT_GE(bs.fake_sock_.sent_cnt_, 10); // Discovery + Request
+    ASSERT_TRUE(bs.workers_[1]->socket_);
+    auto sock = boost::dynamic_pointer_cast<FakeScenPerfSocket>(bs.workers_[1]->socket_);
+    ASSERT_TRUE(sock);
+    EXPECT_GE(sock->sent_cnt_, 10);
+    // The statistics of the workers are merged.
+    EXPECT_GE(bs.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::DO), 10);
+    EXPECT_GE(bs.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::DO), 10);
+    EXPECT_GE(bs.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::RA), 10);
+    EXPECT_GE(bs.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RA), 10);
+}
+
+
 TEST_F(BasicScenTest, Packet6Exchange) {
     // Set number of iterations to 10.
     CommandOptions opt;
@@ -834,3 +834,215 @@ TEST_F(CommandOptionsTest, LoadMacsFromFileNegativeCases) {
     EXPECT_THROW(process(opt, "perfdhcp -M foo -b mac=1234 all"),
                  isc::InvalidParameter);
 }
+
+TEST_F(CommandOptionsTest, Threads) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp --threads 3 --batch-size 16"
+                            " -r 10 -f 5 -n 10 -n 4 -p 20 -D 5 -P 7"
+                            " 127.0.0.1"));
+    EXPECT_EQ(3, opt.getThreadsNum());
+    EXPECT_EQ(16, opt.getBatchSize());
+    EXPECT_TRUE(opt.isDirectSocket());
+
+    // The rates and the numbers of exchanges are split among the
+    // workers, the first ones getting the remainder.
+    CommandOptionsPtr worker;
+    ASSERT_NO_THROW(worker = opt.getWorkerOptions(0));
+    ASSERT_TRUE(worker);
+    EXPECT_EQ(4, worker->getRate());
+    EXPECT_EQ(2, worker->getRenewRate());
+    ASSERT_EQ(2, worker->getNumRequests().size());
+    EXPECT_EQ(4, worker->getNumRequests()[0]);
+    EXPECT_EQ(2, worker->getNumRequests()[1]);
+    EXPECT_EQ(3, worker->getPreload());
+    // The number of drops is rounded up.
+    ASSERT_EQ(1, worker->getMaxDrop().size());
+    EXPECT_EQ(2, worker->getMaxDrop()[0]);
+    // The test period is not split.
+    EXPECT_EQ(20, worker->getPeriod());
+    EXPECT_EQ(3, worker->getThreadsNum());
+
+    ASSERT_NO_THROW(worker = opt.getWorkerOptions(2));
+    EXPECT_EQ(3, worker->getRate());
+    EXPECT_EQ(1, worker->getRenewRate());
+    EXPECT_EQ(3, worker->getNumRequests()[0]);
+    EXPECT_EQ(1, worker->getNumRequests()[1]);
+    EXPECT_EQ(2, worker->getPreload());
+    EXPECT_EQ(2, worker->getMaxDrop()[0]);
+
+    EXPECT_THROW(opt.getWorkerOptions(3), isc::BadValue);
+
+    // By default the test is run by one thread without batches.
+    EXPECT_NO_THROW(process(opt, "perfdhcp 127.0.0.1"));
+    EXPECT_EQ(1, opt.getThreadsNum());
+    EXPECT_EQ(1, opt.getBatchSize());
+    EXPECT_FALSE(opt.isDirectSocket());
+
+    // Batches may be used by a single thread.
+    EXPECT_NO_THROW(process(opt, "perfdhcp --batch-size 8 127.0.0.1"));
+    EXPECT_EQ(1, opt.getThreadsNum());
+    EXPECT_TRUE(opt.isDirectSocket());
+}
+
+TEST_F(CommandOptionsTest, ThreadsNegativeCases) {
+    CommandOptions opt;
+    EXPECT_THROW(process(opt, "perfdhcp --threads 0 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --batch-size 0 127.0.0.1"),
+                 isc::InvalidParameter);
+    // The rate must be split among the threads.
+    EXPECT_THROW(process(opt, "perfdhcp --threads 4 -r 3 127.0.0.1"),
+                 isc::InvalidParameter);
+    // Relayed traffic is required in DHCPv6.
+    EXPECT_THROW(process(opt, "perfdhcp -6 --threads 2 -r 10 ::1"),
+                 isc::InvalidParameter);
+    EXPECT_NO_THROW(process(opt, "perfdhcp -6 -A 1 --threads 2 -r 10 ::1"));
+    // Intermediate reports and templates are not supported.
+    EXPECT_THROW(process(opt, "perfdhcp --threads 2 -r 10 -t 1 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --threads 2 -r 10 -T "
+                         + getFullPath("discover-example.hex")
+                         + " 127.0.0.1"),
+                 isc::InvalidParameter);
+    // Only the basic scenario is supported.
+    EXPECT_THROW(process(opt, "perfdhcp --threads 2 -r 10"
+                         " --scenario avalanche 127.0.0.1"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, ReportFormat) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp -t 1 127.0.0.1"));
+    EXPECT_EQ(ReportFormat::TEXT, opt.getReportFormat());
+    EXPECT_NO_THROW(process(opt, "perfdhcp -t 1 --report-format json"
+                            " 127.0.0.1"));
+    EXPECT_EQ(ReportFormat::JSON, opt.getReportFormat());
+    EXPECT_NO_THROW(process(opt, "perfdhcp -t 1 --report-format csv"
+                            " 127.0.0.1"));
+    EXPECT_EQ(ReportFormat::CSV, opt.getReportFormat());
+    EXPECT_NO_THROW(process(opt, "perfdhcp --report-format text 127.0.0.1"));
+    EXPECT_EQ(ReportFormat::TEXT, opt.getReportFormat());
+
+    // The format is used by the periodic reports only.
+    EXPECT_THROW(process(opt, "perfdhcp --report-format json 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -t 1 --report-format xml 127.0.0.1"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, Distribution) {
+    CommandOptions::Distribution distribution;
+    EXPECT_EQ(CommandOptions::Distribution::NEVER, distribution.getType());
+    EXPECT_EQ("never", distribution.toText());
+
+    ASSERT_NO_THROW(distribution.fromCommandLine("fixed:2.5"));
+    EXPECT_EQ(CommandOptions::Distribution::FIXED, distribution.getType());
+    EXPECT_EQ(2.5, distribution.getMin());
+    EXPECT_EQ(2.5, distribution.getMax());
+    EXPECT_EQ("fixed:2.5", distribution.toText());
+
+    ASSERT_NO_THROW(distribution.fromCommandLine("uniform:1,60"));
+    EXPECT_EQ(CommandOptions::Distribution::UNIFORM, distribution.getType());
+    EXPECT_EQ(1, distribution.getMin());
+    EXPECT_EQ(60, distribution.getMax());
+    EXPECT_EQ("uniform:1,60", distribution.toText());
+
+    ASSERT_NO_THROW(distribution.fromCommandLine("exp:30"));
+    EXPECT_EQ(CommandOptions::Distribution::EXPONENTIAL,
+              distribution.getType());
+    EXPECT_EQ(30, distribution.getMin());
+    EXPECT_EQ("exp:30", distribution.toText());
+
+    ASSERT_NO_THROW(distribution.fromCommandLine("never"));
+    EXPECT_EQ(CommandOptions::Distribution::NEVER, distribution.getType());
+
+    // A wrong value leaves the distribution unchanged.
+    EXPECT_THROW(distribution.fromCommandLine("fixed"), isc::InvalidParameter);
+    EXPECT_THROW(distribution.fromCommandLine("fixed:a"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(distribution.fromCommandLine("fixed:-1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(distribution.fromCommandLine("uniform:5"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(distribution.fromCommandLine("uniform:5,1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(distribution.fromCommandLine("exp:1,2"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(distribution.fromCommandLine("normal:1"),
+                 isc::InvalidParameter);
+    EXPECT_EQ(CommandOptions::Distribution::NEVER, distribution.getType());
+}
+
+TEST_F(CommandOptionsTest, Population) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp --scenario population -R 1000"
+                            " 127.0.0.1"));
+    EXPECT_EQ(Scenario::POPULATION, opt.getScenario());
+    EXPECT_EQ(CommandOptions::Distribution::FIXED, opt.getArrival().getType());
+    EXPECT_EQ(0, opt.getArrival().getMin());
+    EXPECT_EQ(CommandOptions::Distribution::NEVER,
+              opt.getDeparture().getType());
+    EXPECT_EQ(0, opt.getReleasePercent());
+    EXPECT_EQ(0, opt.getRebootStorm());
+    EXPECT_EQ(0, opt.getRelaysNum());
+    EXPECT_EQ("10.0.0.1", opt.getRelayBase());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --scenario population -R 1000"
+                            " --arrival uniform:0,60 --departure exp:600"
+                            " --release-percent 30 --reboot-storm 120"
+                            " --relays 16 --relay-base 10.1.0.1 -p 300"
+                            " 127.0.0.1"));
+    EXPECT_EQ("uniform:0,60", opt.getArrival().toText());
+    EXPECT_EQ("exp:600", opt.getDeparture().toText());
+    EXPECT_EQ(30, opt.getReleasePercent());
+    EXPECT_EQ(120, opt.getRebootStorm());
+    EXPECT_EQ(16, opt.getRelaysNum());
+    EXPECT_EQ("10.1.0.1", opt.getRelayBase());
+}
+
+TEST_F(CommandOptionsTest, PopulationNegativeCases) {
+    CommandOptions opt;
+    // The population options require the population scenario.
+    EXPECT_THROW(process(opt, "perfdhcp --departure fixed:10 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --relays 2 127.0.0.1"),
+                 isc::InvalidParameter);
+    // DHCPv6 is rejected whatever the order of the options.
+    const std::string v6_error = "-6 is not supported by the population"
+        " scenario, which simulates DHCPv4 clients only";
+    try {
+        process(opt, "perfdhcp -6 --scenario population ::1");
+        ADD_FAILURE() << "expected InvalidParameter";
+    } catch (const isc::InvalidParameter& ex) {
+        EXPECT_EQ(v6_error, std::string(ex.what()));
+    }
+    try {
+        process(opt, "perfdhcp --scenario population -6 -l lo");
+        ADD_FAILURE() << "expected InvalidParameter";
+    } catch (const isc::InvalidParameter& ex) {
+        EXPECT_EQ(v6_error, std::string(ex.what()));
+    }
+    // The clients need the 4-way exchange and send their own renewals.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population -i"
+                         " 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population -f 10"
+                         " 127.0.0.1"),
+                 isc::InvalidParameter);
+    // The client index must fit in the lower 24 bits of the transaction id.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population -R 16777217"
+                         " 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population"
+                         " --arrival never 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population"
+                         " --release-percent 101 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population"
+                         " --relay-base 2001:db8::1 127.0.0.1"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --scenario population"
+                         " --reboot-storm 0 127.0.0.1"),
+                 isc::InvalidParameter);
+}
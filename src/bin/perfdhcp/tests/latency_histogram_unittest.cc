@@ -0,0 +1,83 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include "latency_histogram.h"
+#include <gtest/gtest.h>
+
+
+using namespace isc;
+using namespace isc::perfdhcp;
+
+namespace {
+
+// This test verifies that an empty histogram returns 0 percentiles.
+TEST(LatencyHistogram, empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getPercentile(50));
+    EXPECT_EQ(0, histogram.getPercentile(100));
+}
+
+// This test verifies that short delays are recorded exactly.
+TEST(LatencyHistogram, exact) {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 100; ++i) {
+        histogram.record(i);
+    }
+    EXPECT_EQ(100, histogram.getCount());
+    EXPECT_EQ(1, histogram.getPercentile(0));
+    EXPECT_EQ(50, histogram.getPercentile(50));
+    EXPECT_EQ(90, histogram.getPercentile(90));
+    EXPECT_EQ(99, histogram.getPercentile(99));
+    EXPECT_EQ(100, histogram.getPercentile(99.9));
+    EXPECT_EQ(100, histogram.getPercentile(100));
+}
+
+// This test verifies that the relative error of the percentiles of long
+// delays is lower than 1%.
+TEST(LatencyHistogram, precision) {
+    LatencyHistogram histogram;
+    // Delays from 1ms to 10s.
+    for (uint64_t i = 1; i <= 10000; ++i) {
+        histogram.record(i * 1000);
+    }
+    const double percentiles[] = { 1., 50., 90., 99., 99.9 };
+    for (auto percentile : percentiles) {
+        const double expected = percentile * 10000 * 1000 / 100;
+        const double value = histogram.getPercentile(percentile);
+        EXPECT_GE(value, expected) << "percentile " << percentile;
+        EXPECT_LE(value, expected * 1.01) << "percentile " << percentile;
+    }
+    // The highest percentile doesn't exceed the highest delay.
+    EXPECT_EQ(10000000, histogram.getPercentile(100));
+
+    // Delays beyond the maximum are clamped.
+    histogram.record(LatencyHistogram::MAX_VALUE + 1000);
+    EXPECT_EQ(LatencyHistogram::MAX_VALUE, histogram.getPercentile(100));
+}
+
+// This test verifies that histograms are merged and cleared.
+TEST(LatencyHistogram, mergeAndClear) {
+    LatencyHistogram histogram;
+    LatencyHistogram other;
+    for (uint64_t i = 1; i <= 50; ++i) {
+        histogram.record(i);
+        other.record(i + 50);
+    }
+    histogram.merge(other);
+    EXPECT_EQ(100, histogram.getCount());
+    EXPECT_EQ(50, histogram.getPercentile(50));
+    EXPECT_EQ(100, histogram.getPercentile(100));
+    EXPECT_EQ(50, other.getCount());
+
+    histogram.clear();
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getPercentile(50));
+}
+
+}
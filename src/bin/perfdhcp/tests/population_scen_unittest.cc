@@ -0,0 +1,466 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include "command_options_helper.h"
+#include "../population_scen.h"
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/iface_mgr.h>
+#include <util/io_utilities.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <list>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace boost::posix_time;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+
+namespace {
+
+/// \brief Creates an option holding a 32-bit value.
+OptionPtr
+createUint32Option(const uint16_t code, const uint32_t value) {
+    OptionBuffer buf(4);
+    util::writeUint32(value, &buf[0], buf.size());
+    return (OptionPtr(new Option(Option::V4, code, buf)));
+}
+
+/// \brief Returns the 32-bit value of an option.
+uint32_t
+getUint32Option(const OptionPtr& opt) {
+    const OptionBuffer& data = opt->getData();
+    return (util::readUint32(&data[0], data.size()));
+}
+
+/// \brief FakePopulationScenPerfSocket class that mocks PerfSocket.
+///
+/// It records the sent packets and returns the queued responses. If
+/// auto_respond_ is set it answers the DISCOVERs and REQUESTs itself.
+class FakePopulationScenPerfSocket: public BasePerfSocket {
+public:
+    /// \brief Default constructor for FakePopulationScenPerfSocket.
+    FakePopulationScenPerfSocket() :
+        iface_(boost::make_shared<Iface>("fake", 0)),
+        auto_respond_(false) {};
+
+    IfacePtr iface_;  ///< Local fake interface.
+
+    bool auto_respond_; ///< Answer the requests automatically.
+
+    std::vector<Pkt4Ptr> sent_; ///< Sent packets.
+
+    std::list<Pkt4Ptr> responses_; ///< Packets to be received.
+
+    /// \brief Creates a response of the server.
+    ///
+    /// \param msg_type message type.
+    /// \param transid transaction id.
+    /// \param yiaddr leased address.
+    /// \param lease_time lease time.
+    static Pkt4Ptr createResponse(const uint8_t msg_type,
+                                  const uint32_t transid,
+                                  const std::string& yiaddr = "192.0.2.1",
+                                  const uint32_t lease_time = 100) {
+        Pkt4Ptr pkt(new Pkt4(msg_type, transid));
+        pkt->setYiaddr(IOAddress(yiaddr));
+        pkt->addOption(createUint32Option(DHO_DHCP_SERVER_IDENTIFIER,
+                                          IOAddress("192.0.2.254").toUint32()));
+        if (msg_type != DHCPNAK) {
+            pkt->addOption(createUint32Option(DHO_DHCP_LEASE_TIME,
+                                              lease_time));
+        }
+        pkt->updateTimestamp();
+        return (pkt);
+    }
+
+    /// \brief Simulate receiving DHCPv4 packet.
+    virtual dhcp::Pkt4Ptr receive4(uint32_t, uint32_t) override {
+        if (responses_.empty()) {
+            return (Pkt4Ptr());
+        }
+        Pkt4Ptr pkt = responses_.front();
+        responses_.pop_front();
+        return (pkt);
+    };
+
+    /// \brief Simulate receiving DHCPv6 packet.
+    virtual dhcp::Pkt6Ptr receive6(uint32_t, uint32_t) override {
+        return (Pkt6Ptr());
+    };
+
+    /// \brief Simulate sending DHCPv4 packet.
+    virtual bool send(const dhcp::Pkt4Ptr& pkt) override {
+        pkt->updateTimestamp();
+        sent_.push_back(pkt);
+        if (auto_respond_) {
+            if (pkt->getType() == DHCPDISCOVER) {
+                responses_.push_back(createResponse(DHCPOFFER,
+                                                    pkt->getTransid()));
+            } else if (pkt->getType() == DHCPREQUEST) {
+                responses_.push_back(createResponse(DHCPACK,
+                                                    pkt->getTransid()));
+            }
+        }
+        return (true);
+    };
+
+    /// \brief Simulate sending DHCPv6 packet.
+    virtual bool send(const dhcp::Pkt6Ptr&) override {
+        return (false);
+    };
+
+    /// \brief Override getting interface.
+    virtual IfacePtr getIface() override { return iface_; }
+};
+
+/// \brief NakedPopulationScen class.
+///
+/// It exposes PopulationScen internals for UT.
+class NakedPopulationScen: public PopulationScen {
+public:
+    using PopulationScen::tc_;
+    using PopulationScen::clients_;
+    using PopulationScen::processTimers;
+    using PopulationScen::processPacket;
+    using PopulationScen::rebootStorm;
+    using PopulationScen::scheduleArrivals;
+    using PopulationScen::getClientsNum;
+    using PopulationScen::discovers_;
+    using PopulationScen::reboots_;
+    using PopulationScen::renews_;
+    using PopulationScen::rebinds_;
+    using PopulationScen::releases_;
+    using PopulationScen::naks_;
+    using PopulationScen::expirations_;
+    using PopulationScen::retransmissions_;
+    using PopulationScen::OFFLINE;
+    using PopulationScen::SELECTING;
+    using PopulationScen::REQUESTING;
+    using PopulationScen::REBOOTING;
+    using PopulationScen::BOUND;
+    using PopulationScen::RENEWING;
+    using PopulationScen::REBINDING;
+
+    FakePopulationScenPerfSocket fake_sock_;
+
+    NakedPopulationScen(CommandOptions &opt) : PopulationScen(opt, fake_sock_) {};
+
+    /// \brief Answers the last sent packet.
+    ///
+    /// \param msg_type message type of the response.
+    /// \param now time of the response.
+    void respond(const uint8_t msg_type, const ptime& now) {
+        ASSERT_FALSE(fake_sock_.sent_.empty());
+        processPacket(FakePopulationScenPerfSocket::createResponse(
+                          msg_type, fake_sock_.sent_.back()->getTransid()),
+                      now);
+    }
+};
+
+/// \brief Test Fixture Class
+///
+/// This test fixture class is used to perform
+/// unit tests on perfdhcp PopulationScen class.
+class PopulationScenTest : public virtual ::testing::Test
+{
+public:
+    PopulationScenTest() : start_(microsec_clock::universal_time()) { }
+
+    /// \brief Parse command line string with CommandOptions.
+    ///
+    /// \param cmdline command line string to be parsed.
+    /// \throw isc::Unexpected if unexpected error occurred.
+    /// \throw isc::InvalidParameter if command line is invalid.
+    void processCmdLine(CommandOptions &opt, const std::string& cmdline) const {
+        CommandOptionsHelper::process(opt, cmdline);
+    }
+
+    /// \brief Start time of the simulated clock.
+    ptime start_;
+};
+
+// This test verifies that a client gets a lease, renews it at T1,
+// rebinds at T2 and starts over when the lease expires.
+TEST_F(PopulationScenTest, LeaseLifetime) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 3 --scenario population"
+                   " -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    auto& sent = ps.fake_sock_.sent_;
+
+    // All clients arrive at once and send DISCOVERs.
+    ps.scheduleArrivals(start_);
+    EXPECT_EQ(3, ps.processTimers(start_));
+    ASSERT_EQ(3, sent.size());
+    EXPECT_EQ(3, ps.getClientsNum(NakedPopulationScen::SELECTING));
+    EXPECT_EQ(3, ps.discovers_);
+
+    // The OFFER is followed by a REQUEST for the offered address.
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(DHCPDISCOVER, sent[i]->getType());
+        EXPECT_EQ(i, sent[i]->getTransid() & 0x00FFFFFF);
+        ps.processPacket(FakePopulationScenPerfSocket::createResponse(
+                             DHCPOFFER, sent[i]->getTransid()), start_);
+        ps.respond(DHCPACK, start_);
+    }
+    ASSERT_EQ(6, sent.size());
+    Pkt4Ptr request = sent[3];
+    EXPECT_EQ(DHCPREQUEST, request->getType());
+    ASSERT_TRUE(request->getOption(DHO_DHCP_REQUESTED_ADDRESS));
+    EXPECT_EQ("192.0.2.1", IOAddress(getUint32Option(
+        request->getOption(DHO_DHCP_REQUESTED_ADDRESS))).toText());
+    EXPECT_TRUE(request->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+    // Each transmission has its own transaction id.
+    EXPECT_EQ(0, request->getTransid() & 0x00FFFFFF);
+    EXPECT_NE(sent[0]->getTransid(), request->getTransid());
+
+    EXPECT_EQ(3, ps.getClientsNum(NakedPopulationScen::BOUND));
+    EXPECT_EQ(3, ps.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(3, ps.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RA));
+
+    // The 100s leases are renewed at 50s.
+    sent.clear();
+    EXPECT_EQ(0, ps.processTimers(start_ + seconds(49)));
+    EXPECT_EQ(3, ps.processTimers(start_ + seconds(50)));
+    ASSERT_EQ(3, sent.size());
+    EXPECT_EQ(DHCPREQUEST, sent[0]->getType());
+    EXPECT_EQ("192.0.2.1", sent[0]->getCiaddr().toText());
+    EXPECT_FALSE(sent[0]->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+    EXPECT_FALSE(sent[0]->getOption(DHO_DHCP_REQUESTED_ADDRESS));
+    EXPECT_EQ(3, ps.getClientsNum(NakedPopulationScen::RENEWING));
+    EXPECT_EQ(3, ps.renews_);
+    EXPECT_EQ(3, ps.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::RNA));
+
+    // The first client gets its lease extended.
+    ps.processPacket(FakePopulationScenPerfSocket::createResponse(
+                         DHCPACK, sent[0]->getTransid()),
+                     start_ + seconds(50));
+    EXPECT_EQ(NakedPopulationScen::BOUND, ps.clients_[0].state_);
+    EXPECT_EQ(1, ps.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RNA));
+
+    // The others get no answer: the next attempt is the rebind at T2,
+    // i.e. 87.5% of the lease time.
+    sent.clear();
+    EXPECT_EQ(2, ps.processTimers(start_ + seconds(87)));
+    ASSERT_EQ(2, sent.size());
+    EXPECT_EQ(2, ps.getClientsNum(NakedPopulationScen::REBINDING));
+    EXPECT_EQ(2, ps.rebinds_);
+
+    // No answer: the leases expire and the clients start over.
+    sent.clear();
+    EXPECT_EQ(3, ps.processTimers(start_ + seconds(100)));
+    ASSERT_EQ(3, sent.size());
+    EXPECT_EQ(2, ps.getClientsNum(NakedPopulationScen::SELECTING));
+    EXPECT_EQ(2, ps.expirations_);
+    EXPECT_EQ(0, ps.clients_[1].address_);
+    // Meanwhile, the first client renews again.
+    EXPECT_EQ(NakedPopulationScen::RENEWING, ps.clients_[0].state_);
+}
+
+// This test verifies that the requests are retransmitted with an
+// exponential back off and the client starts over when its REQUEST
+// is not answered.
+TEST_F(PopulationScenTest, Retransmissions) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 1 --scenario population"
+                   " -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    auto& sent = ps.fake_sock_.sent_;
+
+    ps.scheduleArrivals(start_);
+    EXPECT_EQ(1, ps.processTimers(start_));
+
+    // The DISCOVER is retransmitted after 4 and 8 seconds, +/- 1 second.
+    EXPECT_EQ(0, ps.processTimers(start_ + seconds(2)));
+    EXPECT_EQ(1, ps.processTimers(start_ + seconds(5)));
+    EXPECT_EQ(0, ps.processTimers(start_ + seconds(10)));
+    EXPECT_EQ(1, ps.processTimers(start_ + seconds(14)));
+    EXPECT_EQ(2, ps.retransmissions_);
+    ASSERT_EQ(3, sent.size());
+    EXPECT_NE(sent[0]->getTransid(), sent[1]->getTransid());
+
+    // A late response to the first DISCOVER is ignored.
+    ps.processPacket(FakePopulationScenPerfSocket::createResponse(
+                         DHCPOFFER, sent[0]->getTransid()),
+                     start_ + seconds(14));
+    EXPECT_EQ(NakedPopulationScen::SELECTING, ps.clients_[0].state_);
+
+    // The REQUEST is retransmitted 4 times before the client goes back
+    // to DISCOVER.
+    ps.respond(DHCPOFFER, start_ + seconds(14));
+    EXPECT_EQ(NakedPopulationScen::REQUESTING, ps.clients_[0].state_);
+    sent.clear();
+    for (int i = 15; i <= 145; ++i) {
+        ps.processTimers(start_ + seconds(i));
+    }
+    size_t requests = 0;
+    for (auto pkt : sent) {
+        if (pkt->getType() == DHCPREQUEST) {
+            ++requests;
+        }
+    }
+    EXPECT_EQ(4, requests);
+    EXPECT_EQ(2, ps.discovers_);
+    EXPECT_EQ(NakedPopulationScen::SELECTING, ps.clients_[0].state_);
+}
+
+// This test verifies that a client leaving the network without releasing
+// its lease confirms it with an INIT-REBOOT when it comes back.
+TEST_F(PopulationScenTest, DepartureAndReboot) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 1 --scenario population"
+                   " --arrival fixed:5 --departure fixed:10"
+                   " -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    auto& sent = ps.fake_sock_.sent_;
+
+    ps.scheduleArrivals(start_);
+    EXPECT_EQ(0, ps.processTimers(start_));
+    EXPECT_EQ(1, ps.processTimers(start_ + seconds(5)));
+    ps.respond(DHCPOFFER, start_ + seconds(5));
+    ps.respond(DHCPACK, start_ + seconds(5));
+    EXPECT_EQ(NakedPopulationScen::BOUND, ps.clients_[0].state_);
+
+    // The client leaves after 10 seconds, keeping its lease.
+    sent.clear();
+    ps.processTimers(start_ + seconds(15));
+    EXPECT_EQ(NakedPopulationScen::OFFLINE, ps.clients_[0].state_);
+    EXPECT_TRUE(sent.empty());
+    EXPECT_EQ(0, ps.releases_);
+
+    // It comes back after 5 seconds and asks for its address.
+    ps.processTimers(start_ + seconds(20));
+    ASSERT_EQ(1, sent.size());
+    EXPECT_EQ(DHCPREQUEST, sent[0]->getType());
+    EXPECT_EQ("0.0.0.0", sent[0]->getCiaddr().toText());
+    EXPECT_TRUE(sent[0]->getOption(DHO_DHCP_REQUESTED_ADDRESS));
+    EXPECT_FALSE(sent[0]->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+    EXPECT_EQ(NakedPopulationScen::REBOOTING, ps.clients_[0].state_);
+    EXPECT_EQ(1, ps.reboots_);
+
+    // The server refuses: the client starts over.
+    ps.respond(DHCPNAK, start_ + seconds(20));
+    EXPECT_EQ(1, ps.naks_);
+    ASSERT_EQ(2, sent.size());
+    EXPECT_EQ(DHCPDISCOVER, sent[1]->getType());
+    EXPECT_EQ(2, ps.discovers_);
+}
+
+// This test verifies that the leaving clients release their leases.
+TEST_F(PopulationScenTest, Release) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 1 --scenario population"
+                   " --departure fixed:10 --release-percent 100"
+                   " -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    auto& sent = ps.fake_sock_.sent_;
+
+    ps.scheduleArrivals(start_);
+    ps.processTimers(start_);
+    ps.respond(DHCPOFFER, start_);
+    ps.respond(DHCPACK, start_);
+
+    sent.clear();
+    ps.processTimers(start_ + seconds(10));
+    ASSERT_EQ(2, sent.size());
+    EXPECT_EQ(DHCPRELEASE, sent[0]->getType());
+    EXPECT_EQ("192.0.2.1", sent[0]->getCiaddr().toText());
+    EXPECT_TRUE(sent[0]->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+    EXPECT_EQ(1, ps.releases_);
+
+    // The client comes back at once without a lease.
+    EXPECT_EQ(DHCPDISCOVER, sent[1]->getType());
+}
+
+// This test verifies that all clients in the network reboot at once.
+TEST_F(PopulationScenTest, RebootStorm) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 4 --scenario population"
+                   " -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    auto& sent = ps.fake_sock_.sent_;
+    ps.fake_sock_.auto_respond_ = true;
+
+    ps.scheduleArrivals(start_);
+    ps.processTimers(start_);
+    PktPtr pkt;
+    while ((pkt = ps.tc_.getReceivedPacket())) {
+        ps.processPacket(boost::dynamic_pointer_cast<Pkt4>(pkt), start_);
+    }
+    EXPECT_EQ(4, ps.getClientsNum(NakedPopulationScen::BOUND));
+
+    ps.fake_sock_.auto_respond_ = false;
+    sent.clear();
+    ps.rebootStorm(start_ + seconds(1));
+    ASSERT_EQ(4, sent.size());
+    for (auto request : sent) {
+        EXPECT_EQ(DHCPREQUEST, request->getType());
+        EXPECT_TRUE(request->getOption(DHO_DHCP_REQUESTED_ADDRESS));
+    }
+    EXPECT_EQ(4, ps.getClientsNum(NakedPopulationScen::REBOOTING));
+    EXPECT_EQ(4, ps.reboots_);
+}
+
+// This test verifies that the clients are spread among the relays.
+TEST_F(PopulationScenTest, Relays) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 4 --scenario population"
+                   " --relays 2 --relay-base 10.1.0.1 -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    auto& sent = ps.fake_sock_.sent_;
+
+    ps.scheduleArrivals(start_);
+    ps.processTimers(start_);
+    ASSERT_EQ(4, sent.size());
+    for (auto discover : sent) {
+        const uint32_t index = discover->getTransid() & 0x00FFFFFF;
+        OptionPtr rai = discover->getOption(DHO_DHCP_AGENT_OPTIONS);
+        ASSERT_TRUE(rai);
+        OptionPtr link = rai->getOption(RAI_OPTION_LINK_SELECTION);
+        ASSERT_TRUE(link);
+        EXPECT_EQ(index % 2 ? "10.1.1.1" : "10.1.0.1",
+                  IOAddress(getUint32Option(link)).toText());
+        OptionPtr circuit_id = rai->getOption(RAI_OPTION_AGENT_CIRCUIT_ID);
+        ASSERT_TRUE(circuit_id);
+        std::ostringstream expected;
+        expected << "relay" << (index % 2) << "/client" << index;
+        const OptionBuffer& data = circuit_id->getData();
+        EXPECT_EQ(expected.str(), std::string(data.begin(), data.end()));
+        OptionPtr remote_id = rai->getOption(RAI_OPTION_REMOTE_ID);
+        ASSERT_TRUE(remote_id);
+        EXPECT_TRUE(remote_id->getData() == discover->getHWAddr()->hwaddr_);
+    }
+}
+
+// This test verifies that the run finishes after the test period.
+TEST_F(PopulationScenTest, Run) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 10 --scenario population"
+                   " -p 1 -g single 127.0.0.1");
+    NakedPopulationScen ps(opt);
+    ps.fake_sock_.auto_respond_ = true;
+
+    EXPECT_EQ(0, ps.run());
+    EXPECT_EQ(10, ps.getClientsNum(NakedPopulationScen::BOUND));
+    EXPECT_EQ(10, ps.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(10, ps.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(10, ps.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::RA));
+    EXPECT_EQ(10, ps.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RA));
+}
+
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include "sent_packet_table.h"
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+using namespace boost::posix_time;
+
+namespace {
+
+// Creates a packet with a transaction id sent at a given time.
+PktPtr createPacket(const uint32_t transid,
+                    ptime timestamp = microsec_clock::universal_time()) {
+    PktPtr packet(new Pkt4(DHCPDISCOVER, transid));
+    packet->setTimestamp(timestamp);
+    return (packet);
+}
+
+// This test verifies that packets are matched by transaction id whatever
+// the order of the responses, and that the oldest packet is reported.
+TEST(SentPacketTable, match) {
+    SentPacketTable table;
+    for (uint32_t transid = 1; transid <= 10; ++transid) {
+        EXPECT_FALSE(table.insert(createPacket(transid)));
+    }
+    EXPECT_EQ(10, table.size());
+
+    bool oldest = true;
+    size_t probes = 0;
+    // Unknown transaction id.
+    EXPECT_FALSE(table.match(11, oldest, probes));
+    EXPECT_FALSE(oldest);
+    EXPECT_GE(probes, 1);
+
+    // Out of order response.
+    PktPtr packet = table.match(5, oldest, probes);
+    ASSERT_TRUE(packet);
+    EXPECT_EQ(5, packet->getTransid());
+    EXPECT_FALSE(oldest);
+    // A packet is matched only once.
+    EXPECT_FALSE(table.match(5, oldest, probes));
+
+    // In order responses.
+    for (uint32_t transid = 1; transid <= 4; ++transid) {
+        packet = table.match(transid, oldest, probes);
+        ASSERT_TRUE(packet);
+        EXPECT_EQ(transid, packet->getTransid());
+        EXPECT_TRUE(oldest) << "transid " << transid;
+    }
+    // The hole left by the packet 5 is skipped.
+    packet = table.match(6, oldest, probes);
+    ASSERT_TRUE(packet);
+    EXPECT_TRUE(oldest);
+    EXPECT_EQ(4, table.size());
+}
+
+// This test verifies that the table grows and that all packets can be
+// matched and removed in any order, including the transaction ids
+// differing only in their high bits.
+TEST(SentPacketTable, grow) {
+    SentPacketTable table(4);
+    EXPECT_EQ(4, table.capacity());
+
+    std::vector<uint32_t> transids;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        transids.push_back(i);
+        if (i < 256) {
+            transids.push_back((i << 24) | 0xFFFF);
+        }
+    }
+    for (auto transid : transids) {
+        ASSERT_FALSE(table.insert(createPacket(transid)));
+    }
+    EXPECT_EQ(transids.size(), table.size());
+    EXPECT_GE(table.capacity(), 2 * transids.size());
+
+    // Remove every third packet then match the remaining ones in
+    // reverse order. The removals must not hide the other packets.
+    bool oldest = false;
+    size_t probes = 0;
+    for (size_t i = 0; i < transids.size(); i += 3) {
+        PktPtr packet = table.match(transids[i], oldest, probes);
+        ASSERT_TRUE(packet) << "transid " << transids[i];
+        EXPECT_EQ(transids[i], packet->getTransid());
+    }
+    for (size_t i = transids.size(); i-- > 0; ) {
+        PktPtr packet = table.match(transids[i], oldest, probes);
+        if (i % 3 == 0) {
+            EXPECT_FALSE(packet) << "transid " << transids[i];
+        } else {
+            ASSERT_TRUE(packet) << "transid " << transids[i];
+            EXPECT_EQ(transids[i], packet->getTransid());
+        }
+    }
+    EXPECT_EQ(0, table.size());
+    EXPECT_TRUE(table.begin() == table.end());
+}
+
+// This test verifies that the packets sent before a deadline are
+// removed from the oldest one.
+TEST(SentPacketTable, expire) {
+    SentPacketTable table;
+    const ptime now = microsec_clock::universal_time();
+    for (uint32_t transid = 1; transid <= 10; ++transid) {
+        table.insert(createPacket(transid, now + seconds(transid)));
+    }
+    bool oldest = false;
+    size_t probes = 0;
+    ASSERT_TRUE(table.match(2, oldest, probes));
+
+    // Packets 1 and 3 were sent before the deadline, 2 has been matched.
+    const ptime deadline = now + seconds(4);
+    PktPtr packet = table.expire(deadline);
+    ASSERT_TRUE(packet);
+    EXPECT_EQ(1, packet->getTransid());
+    packet = table.expire(deadline);
+    ASSERT_TRUE(packet);
+    EXPECT_EQ(3, packet->getTransid());
+    EXPECT_FALSE(table.expire(deadline));
+    EXPECT_EQ(7, table.size());
+
+    // Expired packets can't be matched anymore.
+    EXPECT_FALSE(table.match(3, oldest, probes));
+    packet = table.match(4, oldest, probes);
+    ASSERT_TRUE(packet);
+    EXPECT_TRUE(oldest);
+}
+
+// This test verifies that a packet replaces the outstanding packet with
+// the same transaction id, and that iteration skips the matched packets.
+TEST(SentPacketTable, replaceAndIterate) {
+    SentPacketTable table;
+    PktPtr first = createPacket(1);
+    table.insert(first);
+    table.insert(createPacket(2));
+    table.insert(createPacket(3));
+    PktPtr second = createPacket(1);
+    EXPECT_TRUE(table.insert(second) == first);
+    EXPECT_EQ(3, table.size());
+
+    bool oldest = false;
+    size_t probes = 0;
+    ASSERT_TRUE(table.match(3, oldest, probes));
+
+    std::vector<uint32_t> transids;
+    for (auto it = table.begin(); it != table.end(); ++it) {
+        transids.push_back((*it)->getTransid());
+    }
+    ASSERT_EQ(2, transids.size());
+    EXPECT_EQ(2, transids[0]);
+    EXPECT_EQ(1, transids[1]);
+
+    // The replacing packet is matched.
+    EXPECT_TRUE(table.match(1, oldest, probes) == second);
+}
+
+// This test verifies that the queue of sent packets doesn't keep the
+// matched packets while an old packet is still waiting.
+TEST(SentPacketTable, compact) {
+    SentPacketTable table;
+    table.insert(createPacket(0));
+    bool oldest = false;
+    size_t probes = 0;
+    // Only every tenth packet is left waiting, so the queue is compacted
+    // several times.
+    for (uint32_t transid = 1; transid <= 100000; ++transid) {
+        table.insert(createPacket(transid));
+        if (transid % 10 != 0) {
+            ASSERT_TRUE(table.match(transid, oldest, probes));
+            EXPECT_FALSE(oldest);
+        }
+    }
+    EXPECT_EQ(10001, table.size());
+
+    // All packets are still matched, in order, after the compactions.
+    PktPtr packet = table.match(0, oldest, probes);
+    ASSERT_TRUE(packet);
+    EXPECT_TRUE(oldest);
+    for (uint32_t transid = 10; transid <= 100000; transid += 10) {
+        packet = table.match(transid, oldest, probes);
+        ASSERT_TRUE(packet) << "transid " << transid;
+        EXPECT_EQ(transid, packet->getTransid());
+        EXPECT_TRUE(oldest);
+    }
+    EXPECT_EQ(0, table.size());
+}
+
+}
@@ -421,8 +421,8 @@ TEST_F(StatsMgrTest, SendReceiveUnordered) {
     EXPECT_EQ(0, stats_mgr->getOrphans(ExchangeType::DO));
     // Most of the time we have to do unordered lookups except for the last
     // one. Packets are removed from the sent list every time we have a match
-    // so eventually we come up with the single packet that caching iterator
-    // is pointing to. This is counted as ordered lookup.
+    // so eventually we come up with the single packet which is the oldest
+    // one waiting for a response. This is counted as ordered lookup.
     EXPECT_EQ(1, stats_mgr->getOrderedLookups(ExchangeType::DO));
     EXPECT_EQ(9, stats_mgr->getUnorderedLookups(ExchangeType::DO));
 }
@@ -489,6 +489,51 @@ TEST_F(StatsMgrTest, Delays) {
     passDOPacketsWithDelay(stats_mgr, delay2, common_transid + 1);
     // Standard deviation is expected to be non-zero.
     EXPECT_GT(stats_mgr->getStdDevDelay(ExchangeType::DO), 0);
+
+    // The median is the shorter delay and the highest percentiles
+    // the longer one.
+    EXPECT_GE(stats_mgr->getDelayPercentile(ExchangeType::DO, 50), 1);
+    EXPECT_LT(stats_mgr->getDelayPercentile(ExchangeType::DO, 50), 1.5);
+    EXPECT_GE(stats_mgr->getDelayPercentile(ExchangeType::DO, 99), 2);
+    EXPECT_LE(stats_mgr->getDelayPercentile(ExchangeType::DO, 99),
+              stats_mgr->getMaxDelay(ExchangeType::DO) * 1.01);
+}
+
+TEST_F(StatsMgrTest, IntermediateReports) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO, 5);
+    stats_mgr->addExchangeStats(ExchangeType::RA, 5);
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid);
+
+    // The JSON report is an object on one line.
+    testing::internal::CaptureStdout();
+    stats_mgr->printIntermediateStats(ReportFormat::JSON);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(0, output.find("{ \"time\": ")) << output;
+    EXPECT_NE(std::string::npos,
+              output.find("\"DO\": { \"sent\": 1, \"received\": 1,"
+                          " \"drops\": 0, \"rate\": ")) << output;
+    EXPECT_NE(std::string::npos, output.find("\"p99.9\": 1")) << output;
+    EXPECT_NE(std::string::npos,
+              output.find("\"RA\": { \"sent\": 0, \"received\": 0,"
+                          " \"drops\": 0, \"rate\": 0.000,"
+                          " \"p50\": null, \"p90\": null, \"p99\": null,"
+                          " \"p99.9\": null } } }\n")) << output;
+
+    // The percentiles are reset by the report, while the counters are not.
+    testing::internal::CaptureStdout();
+    stats_mgr->printIntermediateStats(ReportFormat::CSV);
+    stats_mgr->printIntermediateStats(ReportFormat::CSV);
+    output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(0, output.find("time,exchange,sent,received,drops,rate,"
+                             "p50,p90,p99,p99.9\n")) << output;
+    // The header is printed once.
+    EXPECT_EQ(output.find("time,"), output.rfind("time,")) << output;
+    EXPECT_NE(std::string::npos, output.find(",DO,1,1,0,0.000,,,,\n"))
+        << output;
+    EXPECT_NE(std::string::npos, output.find(",RA,0,0,0,0.000,,,,\n"))
+        << output;
 }
 
 TEST_F(StatsMgrTest, CustomCounters) {
@@ -531,6 +576,44 @@ TEST_F(StatsMgrTest, CustomCounters) {
 
 }
 
+TEST_F(StatsMgrTest, Merge) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    boost::shared_ptr<StatsMgr> other(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO);
+    other->addExchangeStats(ExchangeType::DO);
+    other->addExchangeStats(ExchangeType::RA);
+    other->addCustomCounter("shortwait", "Short waits for packets");
+    other->incrementCounter("shortwait", 3);
+
+    // Each statistics get exchanges with different delays.
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid);
+    passDOPacketsWithDelay(other, 3, common_transid);
+    passDOPacketsWithDelay(other, 2, common_transid + 1);
+    boost::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPREQUEST,
+                                                      common_transid));
+    ASSERT_NO_THROW(other->passSentPacket(ExchangeType::RA, sent_packet));
+
+    ASSERT_NO_THROW(stats_mgr->merge(*other));
+
+    EXPECT_EQ(3, stats_mgr->getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(3, stats_mgr->getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(0, stats_mgr->getOrphans(ExchangeType::DO));
+    EXPECT_LE(1, stats_mgr->getMinDelay(ExchangeType::DO));
+    EXPECT_GT(2, stats_mgr->getMinDelay(ExchangeType::DO));
+    EXPECT_LE(3, stats_mgr->getMaxDelay(ExchangeType::DO));
+
+    // Missing exchange types and counters are added.
+    EXPECT_EQ(1, stats_mgr->getSentPacketsNum(ExchangeType::RA));
+    EXPECT_EQ(0, stats_mgr->getRcvdPacketsNum(ExchangeType::RA));
+    CustomCounterPtr counter = stats_mgr->getCounter("shortwait");
+    ASSERT_TRUE(counter);
+    EXPECT_EQ(3, counter->getValue());
+
+    // The merged statistics are not modified.
+    EXPECT_EQ(2, other->getSentPacketsNum(ExchangeType::DO));
+}
+
 TEST_F(StatsMgrTest, PrintStats) {
     std::cout << "This unit test is checking statistics printing "
               << "capabilities. It is expected that some counters "
@@ -1392,6 +1392,47 @@ TEST_F(TestControlTest, Packet6Relayed) {
     EXPECT_EQ(pkt6->relay_info_[0].peeraddr_, tc.socket_.addr_);
 }
 
+// This test verifies that the relay port option is added to the packets
+// sent by the worker threads.
+TEST_F(TestControlTest, PacketRelayPort) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -L 10547 -r 10 --threads 2 all");
+    NakedTestControl tc(opt);
+    boost::shared_ptr<Pkt4> pkt4(new Pkt4(DHCPDISCOVER, 123));
+    tc.setDefaults4(pkt4);
+    OptionPtr rai = pkt4->getOption(DHO_DHCP_AGENT_OPTIONS);
+    ASSERT_TRUE(rai);
+    OptionPtr relay_port = rai->getOption(RAI_OPTION_RELAY_PORT);
+    ASSERT_TRUE(relay_port);
+    EXPECT_EQ(2, relay_port->getData().size());
+
+    CommandOptions opt6;
+    processCmdLine(opt6, "perfdhcp -6 -l fake -A1 -L 10547 -r 10"
+                   " --threads 2 servers");
+    NakedTestControl tc6(opt6);
+    boost::shared_ptr<Pkt6> pkt6(new Pkt6(DHCPV6_SOLICIT, 123));
+    tc6.setDefaults6(pkt6);
+    ASSERT_EQ(1, pkt6->relay_info_.size());
+    EXPECT_EQ(1, pkt6->relay_info_[0].options_.count(D6O_RELAY_SOURCE_PORT));
+
+    // A single thread doesn't ask for the relay port.
+    processCmdLine(opt, "perfdhcp -l fake -L 10547 all");
+    NakedTestControl tc1(opt);
+    pkt4.reset(new Pkt4(DHCPDISCOVER, 123));
+    tc1.setDefaults4(pkt4);
+    EXPECT_FALSE(pkt4->getOption(DHO_DHCP_AGENT_OPTIONS));
+}
+
+// This test verifies that the sequential generator returns the numbers
+// of its range starting from the base.
+TEST_F(TestControlTest, SequentialGenerator) {
+    TestControl::SequentialGenerator gen(3, 100);
+    EXPECT_EQ(100, gen.generate());
+    EXPECT_EQ(101, gen.generate());
+    EXPECT_EQ(102, gen.generate());
+    EXPECT_EQ(100, gen.generate());
+}
+
 TEST_F(TestControlTest, Packet4Exchange) {
     const int iterations_num = 100;
     CommandOptions opt;
@@ -147,6 +147,82 @@ CommandCreator::createLease6GetPage(const Lease6Ptr& last_lease6,
     return (command);
 }
 
+ConstElementPtr
+CommandCreator::createLeaseGetPage(const asiolink::IOAddress& from,
+                                   const asiolink::IOAddress& to,
+                                   const uint32_t limit,
+                                   const HAServerType& server_type) {
+    const bool v4 = (server_type == HAServerType::DHCPv4);
+    const std::string command_name = (v4 ? "lease4-get-page" : "lease6-get-page");
+
+    // Zero value is not allowed.
+    if (limit == 0) {
+        isc_throw(BadValue, "limit value for " << command_name
+                  << " command must not be 0");
+    }
+
+    if ((from.isV4() != v4) || (to.isV4() != v4)) {
+        isc_throw(BadValue, "address range " << from << " - " << to
+                  << " is invalid for " << command_name << " command");
+    }
+
+    ElementPtr args = Element::createMap();
+    args->set("from", Element::create(from.isV4Zero() || from.isV6Zero() ?
+                                      "start" : from.toText()));
+    // The upper bound is not needed when the range ends with the last address.
+    const asiolink::IOAddress last(v4 ? "255.255.255.255" :
+                                   "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+    if (to != last) {
+        args->set("to", Element::create(to.toText()));
+    }
+    args->set("limit", Element::create(static_cast<long long int>(limit)));
+
+    ConstElementPtr command = config::createCommand(command_name, args);
+    insertService(command, server_type);
+    return (command);
+}
+
+ConstElementPtr
+CommandCreator::createJournalGet(const std::string& journal_id,
+                                 const uint64_t from_sequence,
+                                 const uint32_t limit,
+                                 const HAServerType& server_type) {
+    // Zero value is not allowed.
+    if (limit == 0) {
+        isc_throw(BadValue, "limit value for ha-journal-get command must not be 0");
+    }
+
+    ElementPtr args = Element::createMap();
+    args->set("journal-id", Element::create(journal_id));
+    args->set("from-sequence", Element::create(static_cast<long long int>(from_sequence)));
+    args->set("limit", Element::create(static_cast<long long int>(limit)));
+
+    ConstElementPtr command = config::createCommand("ha-journal-get", args);
+    insertService(command, server_type);
+    return (command);
+}
+
+ElementPtr
+CommandCreator::createLeaseBulkApplyEntry(const Lease& lease) {
+    ElementPtr lease_as_json = lease.toElement();
+    insertLeaseExpireTime(lease_as_json);
+    return (lease_as_json);
+}
+
+ConstElementPtr
+CommandCreator::createLeaseBulkApply(const ConstElementPtr& leases,
+                                     const ConstElementPtr& deleted_leases,
+                                     const HAServerType& server_type) {
+    ElementPtr args = Element::createMap();
+    args->set("deleted-leases", deleted_leases);
+    args->set("leases", leases);
+    ConstElementPtr command =
+        config::createCommand(server_type == HAServerType::DHCPv4 ?
+                              "lease4-bulk-apply" : "lease6-bulk-apply", args);
+    insertService(command, server_type);
+    return (command);
+}
+
 void
 CommandCreator::insertLeaseExpireTime(ElementPtr& lease) {
     if ((lease->getType() != Element::map) ||
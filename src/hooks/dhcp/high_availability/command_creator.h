@@ -8,6 +8,7 @@
 #define HA_COMMAND_CREATOR_H
 
 #include <ha_server_type.h>
+#include <asiolink/io_address.h>
 #include <cc/data.h>
 #include <dhcpsrv/lease.h>
 #include <string>
@@ -121,6 +122,61 @@ public:
     createLease6GetPage(const dhcp::Lease6Ptr& lease6,
                         const uint32_t limit);
 
+    /// @brief Creates lease4-get-page or lease6-get-page command fetching
+    /// a page of leases within an address range.
+    ///
+    /// @param from Address following which the page starts. The zero
+    /// address is sent as the "start" keyword.
+    /// @param to Last address of the range. The "to" parameter is omitted
+    /// when it is the highest address of the family.
+    /// @param limit Limit of leases on the page.
+    /// @param server_type type of the DHCP server, i.e. v4 or v6.
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLeaseGetPage(const asiolink::IOAddress& from,
+                       const asiolink::IOAddress& to,
+                       const uint32_t limit,
+                       const HAServerType& server_type);
+
+    /// @brief Creates ha-journal-get command fetching lease changes from
+    /// the partner's lease journal.
+    ///
+    /// @param journal_id Identifier of the partner's journal.
+    /// @param from_sequence Sequence number of the last change known to
+    /// this server.
+    /// @param limit Maximum number of changes to fetch.
+    /// @param server_type type of the DHCP server, i.e. v4 or v6.
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createJournalGet(const std::string& journal_id,
+                     const uint64_t from_sequence,
+                     const uint32_t limit,
+                     const HAServerType& server_type);
+
+    /// @brief Creates an entry of the lists of leases of a bulk apply
+    /// command.
+    ///
+    /// @param lease Reference to the lease, i.e. @c dhcp::Lease4 or
+    /// @c dhcp::Lease6.
+    ///
+    /// @return Pointer to the JSON representation of the lease.
+    static data::ElementPtr
+    createLeaseBulkApplyEntry(const dhcp::Lease& lease);
+
+    /// @brief Creates lease4-bulk-apply or lease6-bulk-apply command.
+    ///
+    /// @param leases List of the leases to be created or updated, built
+    /// with @c createLeaseBulkApplyEntry.
+    /// @param deleted_leases List of the leases to be deleted, built with
+    /// @c createLeaseBulkApplyEntry.
+    /// @param server_type DHCP server type, i.e. DHCPv4 or DHCPv6.
+    ///
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLeaseBulkApply(const data::ConstElementPtr& leases,
+                         const data::ConstElementPtr& deleted_leases,
+                         const HAServerType& server_type);
+
 private:
 
     /// @brief Replaces "cltt" with "expire" value within the lease.
@@ -164,6 +164,19 @@ int heartbeat_command(CalloutHandle& handle) {
     return (0);
 }
 
+/// @brief ha-journal-get command handler implementation.
+int journal_get_command(CalloutHandle& handle) {
+    try {
+        impl->journalGetHandler(handle);
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(ha_logger, HA_JOURNAL_GET_HANDLER_FAILED)
+            .arg(ex.what());
+    }
+
+    return (0);
+}
+
 /// @brief ha-sync command handler implementation.
 int sync_command(CalloutHandle& handle) {
     try {
@@ -219,6 +232,7 @@ int load(LibraryHandle& handle) {
         impl->configure(config);
 
         handle.registerCommandCallout("ha-heartbeat", heartbeat_command);
+        handle.registerCommandCallout("ha-journal-get", journal_get_command);
         handle.registerCommandCallout("ha-sync", sync_command);
         handle.registerCommandCallout("ha-scopes", scopes_command);
         handle.registerCommandCallout("ha-continue", continue_command);
@@ -140,6 +140,10 @@ HAConfig::StateMachineConfig::getStateConfig(const int state) {
 HAConfig::HAConfig()
     : this_server_name_(), ha_mode_(HOT_STANDBY), send_lease_updates_(true),
       sync_leases_(true), sync_timeout_(60000), sync_page_limit_(10000),
+      sync_partitions_(1), lease_journal_size_(10000), lease_update_batch_size_(0),
+      lease_update_batch_window_(10), lease_update_max_outstanding_batches_(4),
+      http_max_connections_(1), http_pipeline_depth_(1),
+      max_parked_queries_(0), parked_queries_drop_policy_(hooks::ParkingLot::DROP_NEW),
       heartbeat_delay_(10000), max_response_delay_(60000), max_ack_delay_(10000),
       max_unacked_clients_(10), peers_(), state_machine_(new StateMachineConfig()) {
 }
@@ -204,6 +208,20 @@ HAConfig::HAModeToString(const HAMode& ha_mode) {
     return ("");
 }
 
+void
+HAConfig::setParkedQueriesDropPolicy(const std::string& policy) {
+    if (policy == "drop-new") {
+        parked_queries_drop_policy_ = hooks::ParkingLot::DROP_NEW;
+
+    } else if (policy == "drop-oldest") {
+        parked_queries_drop_policy_ = hooks::ParkingLot::DROP_OLDEST;
+
+    } else {
+        isc_throw(BadValue, "unsupported value '" << policy << "' for"
+                  " parked-queries-drop-policy parameter");
+    }
+}
+
 HAConfig::PeerConfigPtr
 HAConfig::getPeerConfig(const std::string& name) const {
     auto peer = peers_.find(name);
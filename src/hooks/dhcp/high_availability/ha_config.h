@@ -8,6 +8,7 @@
 #define HA_CONFIG_H
 
 #include <exceptions/exceptions.h>
+#include <hooks/parking_lots.h>
 #include <http/url.h>
 #include <util/state_model.h>
 #include <boost/shared_ptr.hpp>
@@ -364,6 +365,169 @@ public:
         sync_page_limit_ = sync_page_limit;
     }
 
+    /// @brief Returns the number of address range partitions fetched in
+    /// parallel during database synchronization.
+    ///
+    /// The partitions are made of the configured subnets. There are fewer
+    /// partitions when there are fewer subnets.
+    ///
+    /// @return Number of partitions.
+    uint16_t getSyncPartitions() const {
+        return (sync_partitions_);
+    }
+
+    /// @brief Sets the number of address range partitions fetched in
+    /// parallel during database synchronization.
+    ///
+    /// @param sync_partitions New number of partitions.
+    void setSyncPartitions(const uint16_t sync_partitions) {
+        sync_partitions_ = sync_partitions;
+    }
+
+    /// @brief Returns maximum number of lease changes held in the journal.
+    ///
+    /// The partner returning after a short outage fetches the changes
+    /// it missed from the journal instead of all leases. A value of zero
+    /// disables the journal.
+    ///
+    /// @return Maximum number of lease changes.
+    uint32_t getLeaseJournalSize() const {
+        return (lease_journal_size_);
+    }
+
+    /// @brief Sets maximum number of lease changes held in the journal.
+    ///
+    /// @param lease_journal_size New maximum number of lease changes.
+    void setLeaseJournalSize(const uint32_t lease_journal_size) {
+        lease_journal_size_ = lease_journal_size;
+    }
+
+    /// @brief Returns maximum number of leases sent in a batch of lease
+    /// updates.
+    ///
+    /// A value of zero disables batching: the lease updates of each DHCP
+    /// transaction are sent in their own requests.
+    ///
+    /// @return Maximum number of leases in a batch.
+    uint32_t getLeaseUpdateBatchSize() const {
+        return (lease_update_batch_size_);
+    }
+
+    /// @brief Sets maximum number of leases sent in a batch of lease updates.
+    ///
+    /// When batching is enabled the lease updates of many DHCP transactions
+    /// are coalesced and sent to the peer in a single request. The batch is
+    /// sent when it holds this number of leases or when the batch window
+    /// elapses, whichever comes first.
+    ///
+    /// @param lease_update_batch_size new maximum batch size. A value of
+    /// zero disables batching.
+    void setLeaseUpdateBatchSize(const uint32_t lease_update_batch_size) {
+        lease_update_batch_size_ = lease_update_batch_size;
+    }
+
+    /// @brief Returns lease updates batch window in milliseconds.
+    ///
+    /// @return Maximum time a lease update waits in a batch.
+    uint32_t getLeaseUpdateBatchWindow() const {
+        return (lease_update_batch_window_);
+    }
+
+    /// @brief Sets lease updates batch window in milliseconds.
+    ///
+    /// This is the maximum time between the first lease update added to a
+    /// batch and sending the batch. The DHCP responses are delayed by up to
+    /// this time.
+    ///
+    /// @param lease_update_batch_window new batch window.
+    void setLeaseUpdateBatchWindow(const uint32_t lease_update_batch_window) {
+        lease_update_batch_window_ = lease_update_batch_window;
+    }
+
+    /// @brief Returns maximum number of batches of lease updates sent to
+    /// a peer and not yet acknowledged.
+    uint16_t getLeaseUpdateMaxOutstandingBatches() const {
+        return (lease_update_max_outstanding_batches_);
+    }
+
+    /// @brief Sets maximum number of batches of lease updates sent to a
+    /// peer and not yet acknowledged.
+    ///
+    /// The following batches wait until a response is received. A batch
+    /// is also held while it updates an address of an outstanding batch,
+    /// so the peer applies the changes of an address in order.
+    ///
+    /// @param max_outstanding_batches new maximum number of outstanding
+    /// batches.
+    void setLeaseUpdateMaxOutstandingBatches(const uint16_t max_outstanding_batches) {
+        lease_update_max_outstanding_batches_ = max_outstanding_batches;
+    }
+
+    /// @brief Returns maximum number of HTTP connections with each peer.
+    uint16_t getHttpMaxConnections() const {
+        return (http_max_connections_);
+    }
+
+    /// @brief Sets maximum number of HTTP connections with each peer.
+    ///
+    /// With more than one connection, the heartbeats and the lease updates
+    /// of different DHCP transactions are sent to the peer concurrently
+    /// rather than one after another.
+    ///
+    /// @param http_max_connections new maximum number of connections.
+    void setHttpMaxConnections(const uint16_t http_max_connections) {
+        http_max_connections_ = http_max_connections;
+    }
+
+    /// @brief Returns maximum number of HTTP requests in progress over a
+    /// connection with a peer.
+    uint16_t getHttpPipelineDepth() const {
+        return (http_pipeline_depth_);
+    }
+
+    /// @brief Sets maximum number of HTTP requests in progress over a
+    /// connection with a peer.
+    ///
+    /// @param http_pipeline_depth new pipeline depth. A value of 1 disables
+    /// HTTP/1.1 pipelining.
+    void setHttpPipelineDepth(const uint16_t http_pipeline_depth) {
+        http_pipeline_depth_ = http_pipeline_depth;
+    }
+
+    /// @brief Returns maximum number of DHCP queries parked while their
+    /// lease updates are in progress.
+    ///
+    /// @return Maximum number of parked queries. A value of 0 means no limit.
+    uint32_t getMaxParkedQueries() const {
+        return (max_parked_queries_);
+    }
+
+    /// @brief Sets maximum number of DHCP queries parked while their lease
+    /// updates are in progress.
+    ///
+    /// @param max_parked_queries new maximum number of parked queries. A
+    /// value of 0 means no limit.
+    void setMaxParkedQueries(const uint32_t max_parked_queries) {
+        max_parked_queries_ = max_parked_queries;
+    }
+
+    /// @brief Returns the policy applied when the maximum number of parked
+    /// queries is reached.
+    hooks::ParkingLot::DropPolicy getParkedQueriesDropPolicy() const {
+        return (parked_queries_drop_policy_);
+    }
+
+    /// @brief Sets the policy applied when the maximum number of parked
+    /// queries is reached.
+    ///
+    /// The following policies are supported:
+    /// - drop-new
+    /// - drop-oldest
+    ///
+    /// @param policy drop policy in textual form.
+    /// @throw BadValue if non-supported policy has been specified.
+    void setParkedQueriesDropPolicy(const std::string& policy);
+
     /// @brief Returns heartbeat delay in milliseconds.
     ///
     /// This value indicates the delay in sending a heartbeat command after
@@ -497,6 +661,15 @@ public:
     uint32_t sync_timeout_;               ///< Timeout for syncing lease database (ms)
     uint32_t sync_page_limit_;            ///< Page size limit while synchronizing
                                           ///< leases.
+    uint16_t sync_partitions_;            ///< Ranges synchronized in parallel.
+    uint32_t lease_journal_size_;         ///< Max lease changes in the journal.
+    uint32_t lease_update_batch_size_;    ///< Max leases in a batch of updates.
+    uint32_t lease_update_batch_window_;  ///< Batch window in milliseconds.
+    uint16_t lease_update_max_outstanding_batches_; ///< Max batches in flight.
+    uint16_t http_max_connections_;       ///< Max connections with a peer.
+    uint16_t http_pipeline_depth_;        ///< Max requests over a connection.
+    uint32_t max_parked_queries_;         ///< Max parked DHCP queries.
+    hooks::ParkingLot::DropPolicy parked_queries_drop_policy_; ///< Drop policy.
     uint32_t heartbeat_delay_;            ///< Heartbeat delay in milliseconds.
     uint32_t max_response_delay_;         ///< Max delay in response to heartbeats.
     uint32_t max_ack_delay_;              ///< Maximum DHCP message ack delay.
@@ -24,6 +24,15 @@ const SimpleDefaults HA_CONFIG_DEFAULTS = {
     { "sync-leases", Element::boolean, "true" },
     { "sync-timeout", Element::integer, "60000" },
     { "sync-page-limit", Element::integer, "10000" },
+    { "sync-partitions", Element::integer, "1" },
+    { "lease-journal-size", Element::integer, "10000" },
+    { "lease-update-batch-size", Element::integer, "0" },
+    { "lease-update-batch-window", Element::integer, "10" },
+    { "lease-update-max-outstanding-batches", Element::integer, "4" },
+    { "http-max-connections", Element::integer, "1" },
+    { "http-pipeline-depth", Element::integer, "1" },
+    { "max-parked-queries", Element::integer, "0" },
+    { "parked-queries-drop-policy", Element::string, "drop-new" },
     { "heartbeat-delay", Element::integer, "10000" },
     { "max-response-delay", Element::integer, "60000" },
     { "max-ack-delay", Element::integer, "10000" },
@@ -141,6 +150,57 @@ HAConfigParser::parseInternal(const HAConfigPtr& config_storage,
     uint32_t sync_page_limit = getAndValidateInteger<uint32_t>(c, "sync-page-limit");
     config_storage->setSyncPageLimit(sync_page_limit);
 
+    // Get 'sync-partitions'.
+    uint16_t sync_partitions = getAndValidateInteger<uint16_t>(c, "sync-partitions");
+    if (sync_partitions == 0) {
+        isc_throw(ConfigError, "'sync-partitions' must be greater than 0");
+    }
+    config_storage->setSyncPartitions(sync_partitions);
+
+    // Get 'lease-journal-size'.
+    uint32_t lease_journal_size = getAndValidateInteger<uint32_t>(c, "lease-journal-size");
+    config_storage->setLeaseJournalSize(lease_journal_size);
+
+    // Get 'lease-update-batch-size'.
+    uint32_t batch_size = getAndValidateInteger<uint32_t>(c, "lease-update-batch-size");
+    config_storage->setLeaseUpdateBatchSize(batch_size);
+
+    // Get 'lease-update-batch-window'.
+    uint16_t batch_window = getAndValidateInteger<uint16_t>(c, "lease-update-batch-window");
+    config_storage->setLeaseUpdateBatchWindow(batch_window);
+
+    // Get 'lease-update-max-outstanding-batches'.
+    uint16_t max_outstanding_batches =
+        getAndValidateInteger<uint16_t>(c, "lease-update-max-outstanding-batches");
+    if (max_outstanding_batches == 0) {
+        isc_throw(ConfigError, "'lease-update-max-outstanding-batches' must be"
+                  " greater than 0");
+    }
+    config_storage->setLeaseUpdateMaxOutstandingBatches(max_outstanding_batches);
+
+    // Get 'http-max-connections'.
+    uint16_t http_max_connections =
+        getAndValidateInteger<uint16_t>(c, "http-max-connections");
+    if (http_max_connections == 0) {
+        isc_throw(ConfigError, "'http-max-connections' must be greater than 0");
+    }
+    config_storage->setHttpMaxConnections(http_max_connections);
+
+    // Get 'http-pipeline-depth'.
+    uint16_t http_pipeline_depth =
+        getAndValidateInteger<uint16_t>(c, "http-pipeline-depth");
+    if (http_pipeline_depth == 0) {
+        isc_throw(ConfigError, "'http-pipeline-depth' must be greater than 0");
+    }
+    config_storage->setHttpPipelineDepth(http_pipeline_depth);
+
+    // Get 'max-parked-queries'.
+    uint32_t max_parked_queries = getAndValidateInteger<uint32_t>(c, "max-parked-queries");
+    config_storage->setMaxParkedQueries(max_parked_queries);
+
+    // Get 'parked-queries-drop-policy'.
+    config_storage->setParkedQueriesDropPolicy(getString(c, "parked-queries-drop-policy"));
+
     // Get 'heartbeat-delay'.
     uint16_t heartbeat_delay = getAndValidateInteger<uint16_t>(c, "heartbeat-delay");
     config_storage->setHeartbeatDelay(heartbeat_delay);
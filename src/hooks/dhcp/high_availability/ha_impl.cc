@@ -15,7 +15,9 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <dhcpsrv/lease.h>
+#include <hooks/server_hooks.h>
 #include <stats/stats_mgr.h>
+#include <limits>
 
 using namespace isc::asiolink;
 using namespace isc::config;
@@ -23,12 +25,15 @@ using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::log;
+using namespace boost::posix_time;
 
 namespace isc {
 namespace ha {
 
+const long HAImpl::PARKING_LOT_FULL_LOG_INTERVAL;
+
 HAImpl::HAImpl()
-    : config_(new HAConfig()) {
+    : config_(new HAConfig()), last_parking_lot_full_log_() {
 }
 
 void
@@ -44,6 +49,19 @@ HAImpl::startService(const IOServicePtr& io_service,
     // Create the HA service and crank up the state machine.
     service_ = boost::make_shared<HAService>(io_service, network_state,
                                              config_, server_type);
+
+    // Limit the number of queries parked while their lease updates are in
+    // progress. The parking lots are recreated when the server is
+    // reconfigured, before the service is started again.
+    ServerHooks& server_hooks = ServerHooks::getServerHooks();
+    int hook_index = server_hooks.findIndex(server_type == HAServerType::DHCPv4 ?
+                                            "leases4_committed" :
+                                            "leases6_committed");
+    if (hook_index >= 0) {
+        server_hooks.getParkingLotPtr(hook_index)->
+            setLimit(config_->getMaxParkedQueries(),
+                     config_->getParkedQueriesDropPolicy());
+    }
 }
 
 void
@@ -132,19 +150,44 @@ HAImpl::leases4Committed(CalloutHandle& callout_handle) {
     // pointer until we unpark the packet.
     ParkingLotHandlePtr parking_lot = callout_handle.getParkingLotHandlePtr();
 
+    // This is required step every time we ask the server to park the packet.
+    // The reference counting is required to keep the packet parked until
+    // all callouts call unpark. Then, the packet gets unparked and the
+    // associated callback is triggered. The callback resumes packet processing.
+    // The packet is referenced before sending the lease updates because the
+    // parking lot may be full. In that case this packet or the oldest parked
+    // packet is dropped and the client will retransmit.
+    uint64_t overflows = parking_lot->getOverflowCount();
+    bool referenced = parking_lot->reference(query4);
+    if (parkedQueriesDropped(parking_lot->getOverflowCount() - overflows)) {
+        LOG_WARN(ha_logger, HA_LEASES4_COMMITTED_PARKING_LOT_FULL)
+            .arg(query4->getLabel())
+            .arg(config_->getMaxParkedQueries())
+            .arg(parking_lot->getOverflowCount());
+    }
+
+    if (!referenced) {
+        callout_handle.setStatus(CalloutHandle::NEXT_STEP_DROP);
+        return;
+    }
+
     // Asynchronously send lease updates. In some cases no updates will be sent,
     // e.g. when this server is in the partner-down state and there are no backup
     // servers. In those cases we simply return without parking the DHCP query.
     // The response will be sent to the client immediately.
-    if (service_->asyncSendLeaseUpdates(query4, leases4, deleted_leases4, parking_lot) == 0) {
-        return;
+    size_t sent_num = 0;
+    try {
+        sent_num = service_->asyncSendLeaseUpdates(query4, leases4, deleted_leases4,
+                                                   parking_lot);
+    } catch (...) {
+        parking_lot->dereference(query4);
+        throw;
     }
 
-    // This is required step every time we ask the server to park the packet.
-    // The reference counting is required to keep the packet parked until
-    // all callouts call unpark. Then, the packet gets unparked and the
-    // associated callback is triggered. The callback resumes packet processing.
-    parking_lot->reference(query4);
+    if (sent_num == 0) {
+        parking_lot->dereference(query4);
+        return;
+    }
 
     // The callout returns this status code to indicate to the server that it
     // should park the query packet.
@@ -237,25 +280,69 @@ HAImpl::leases6Committed(CalloutHandle& callout_handle) {
     // pointer until we unpark the packet.
     ParkingLotHandlePtr parking_lot = callout_handle.getParkingLotHandlePtr();
 
+    // This is required step every time we ask the server to park the packet.
+    // The reference counting is required to keep the packet parked until
+    // all callouts call unpark. Then, the packet gets unparked and the
+    // associated callback is triggered. The callback resumes packet processing.
+    // The packet is referenced before sending the lease updates because the
+    // parking lot may be full. In that case this packet or the oldest parked
+    // packet is dropped and the client will retransmit.
+    uint64_t overflows = parking_lot->getOverflowCount();
+    bool referenced = parking_lot->reference(query6);
+    if (parkedQueriesDropped(parking_lot->getOverflowCount() - overflows)) {
+        LOG_WARN(ha_logger, HA_LEASES6_COMMITTED_PARKING_LOT_FULL)
+            .arg(query6->getLabel())
+            .arg(config_->getMaxParkedQueries())
+            .arg(parking_lot->getOverflowCount());
+    }
+
+    if (!referenced) {
+        callout_handle.setStatus(CalloutHandle::NEXT_STEP_DROP);
+        return;
+    }
+
     // Asynchronously send lease updates. In some cases no updates will be sent,
     // e.g. when this server is in the partner-down state and there are no backup
     // servers. In those cases we simply return without parking the DHCP query.
     // The response will be sent to the client immediately.
-    if (service_->asyncSendLeaseUpdates(query6, leases6, deleted_leases6, parking_lot) == 0) {
-        return;
+    size_t sent_num = 0;
+    try {
+        sent_num = service_->asyncSendLeaseUpdates(query6, leases6, deleted_leases6,
+                                                   parking_lot);
+    } catch (...) {
+        parking_lot->dereference(query6);
+        throw;
     }
 
-    // This is required step every time we ask the server to park the packet.
-    // The reference counting is required to keep the packet parked until
-    // all callouts call unpark. Then, the packet gets unparked and the
-    // associated callback is triggered. The callback resumes packet processing.
-    parking_lot->reference(query6);
+    if (sent_num == 0) {
+        parking_lot->dereference(query6);
+        return;
+    }
 
     // The callout returns this status code to indicate to the server that it
     // should park the query packet.
     callout_handle.setStatus(CalloutHandle::NEXT_STEP_PARK);
 }
 
+bool
+HAImpl::parkedQueriesDropped(const uint64_t dropped) {
+    if (dropped == 0) {
+        return (false);
+    }
+
+    isc::stats::StatsMgr::instance().addValue("ha-parked-queries-dropped",
+                                              static_cast<int64_t>(dropped));
+
+    // Log the first drop and then at most once per interval.
+    ptime now = microsec_clock::universal_time();
+    if (last_parking_lot_full_log_.is_not_a_date_time() ||
+        (now - last_parking_lot_full_log_ >= seconds(PARKING_LOT_FULL_LOG_INTERVAL))) {
+        last_parking_lot_full_log_ = now;
+        return (true);
+    }
+    return (false);
+}
+
 void
 HAImpl::commandProcessed(hooks::CalloutHandle& callout_handle) {
     std::string command_name;
@@ -271,6 +358,70 @@ HAImpl::heartbeatHandler(CalloutHandle& callout_handle) {
     callout_handle.setArgument("response", response);
 }
 
+void
+HAImpl::journalGetHandler(hooks::CalloutHandle& callout_handle) {
+    // Command must always be provided.
+    ConstElementPtr command;
+    callout_handle.getArgument("command", command);
+
+    // Retrieve arguments.
+    ConstElementPtr args;
+    static_cast<void>(parseCommand(args, command));
+
+    std::string journal_id;
+    uint64_t from_sequence = 0;
+    uint32_t limit = 0;
+
+    try {
+        // Arguments are required for the ha-journal-get command.
+        if (!args) {
+            isc_throw(BadValue, "arguments not found in the 'ha-journal-get' command");
+        }
+
+        // Arguments must be a map.
+        if (args->getType() != Element::map) {
+            isc_throw(BadValue, "arguments in the 'ha-journal-get' command are not a map");
+        }
+
+        ConstElementPtr journal_id_element = args->get("journal-id");
+        if (!journal_id_element || (journal_id_element->getType() != Element::string)) {
+            isc_throw(BadValue, "'journal-id' is mandatory for the 'ha-journal-get'"
+                      " command and must be a string");
+        }
+        journal_id = journal_id_element->stringValue();
+
+        ConstElementPtr from_sequence_element = args->get("from-sequence");
+        if (!from_sequence_element ||
+            (from_sequence_element->getType() != Element::integer) ||
+            (from_sequence_element->intValue() < 0)) {
+            isc_throw(BadValue, "'from-sequence' is mandatory for the 'ha-journal-get'"
+                      " command and must be a non-negative integer");
+        }
+        from_sequence = static_cast<uint64_t>(from_sequence_element->intValue());
+
+        ConstElementPtr limit_element = args->get("limit");
+        if (!limit_element || (limit_element->getType() != Element::integer) ||
+            (limit_element->intValue() <= 0) ||
+            (limit_element->intValue() > std::numeric_limits<uint32_t>::max())) {
+            isc_throw(BadValue, "'limit' is mandatory for the 'ha-journal-get'"
+                      " command and must be a positive 32-bit integer");
+        }
+        limit = static_cast<uint32_t>(limit_element->intValue());
+
+    } catch (const std::exception& ex) {
+        // There was an error while parsing command arguments. Return an error status
+        // code to notify the user.
+        ConstElementPtr response = createAnswer(CONTROL_RESULT_ERROR, ex.what());
+        callout_handle.setArgument("response", response);
+        return;
+    }
+
+    // Command parsing was successful, so let's process the command.
+    ConstElementPtr response = service_->processJournalGet(journal_id, from_sequence,
+                                                           limit);
+    callout_handle.setArgument("response", response);
+}
+
 void
 HAImpl::synchronizeHandler(hooks::CalloutHandle& callout_handle) {
     // Command must always be provided.
@@ -13,9 +13,10 @@
 #include <cc/data.h>
 #include <dhcpsrv/network_state.h>
 #include <hooks/hooks.h>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
-
+#include <stdint.h>
 
 namespace isc {
 namespace ha {
@@ -127,6 +128,11 @@ public:
     /// @param callout_handle Callout handle provided to the callout.
     void heartbeatHandler(hooks::CalloutHandle& callout_handle);
 
+    /// @brief Implements handler for the ha-journal-get command.
+    ///
+    /// @param callout_handle Callout handle provided to the callout.
+    void journalGetHandler(hooks::CalloutHandle& callout_handle);
+
     /// @brief Implements handler for the ha-sync command.
     ///
     /// @param callout_handle Callout handle provided to the callout.
@@ -144,12 +150,31 @@ public:
 
 protected:
 
+    /// @brief Minimum interval between the warnings about the parked
+    /// queries dropped, in seconds.
+    static const long PARKING_LOT_FULL_LOG_INTERVAL = 10;
+
+    /// @brief Accounts for the queries dropped because the parking lot
+    /// is full.
+    ///
+    /// The number of dropped queries is added to the
+    /// "ha-parked-queries-dropped" statistic.
+    ///
+    /// @param dropped Number of queries dropped by the last callout.
+    /// @return true if the drop should be logged, i.e. when there is a
+    /// drop and no drop was logged during the last
+    /// @c PARKING_LOT_FULL_LOG_INTERVAL seconds.
+    bool parkedQueriesDropped(const uint64_t dropped);
+
     /// @brief Holds parsed configuration.
     HAConfigPtr config_;
 
     /// @brief Pointer to the high availability service (state machine).
     HAServicePtr service_;
 
+    /// @brief Time of the last warning about the parked queries dropped.
+    boost::posix_time::ptime last_parking_lot_full_log_;
+
 };
 
 /// @brief Pointer to the High Availability hooks library implementation.
@@ -38,18 +38,27 @@ extern const isc::log::MessageID HA_HEARTBEAT_HANDLER_FAILED = "HA_HEARTBEAT_HAN
 extern const isc::log::MessageID HA_HIGH_CLOCK_SKEW = "HA_HIGH_CLOCK_SKEW";
 extern const isc::log::MessageID HA_HIGH_CLOCK_SKEW_CAUSES_TERMINATION = "HA_HIGH_CLOCK_SKEW_CAUSES_TERMINATION";
 extern const isc::log::MessageID HA_INIT_OK = "HA_INIT_OK";
+extern const isc::log::MessageID HA_JOURNAL_GET_HANDLER_FAILED = "HA_JOURNAL_GET_HANDLER_FAILED";
 extern const isc::log::MessageID HA_LEASES4_COMMITTED_FAILED = "HA_LEASES4_COMMITTED_FAILED";
 extern const isc::log::MessageID HA_LEASES4_COMMITTED_NOTHING_TO_UPDATE = "HA_LEASES4_COMMITTED_NOTHING_TO_UPDATE";
+extern const isc::log::MessageID HA_LEASES4_COMMITTED_PARKING_LOT_FULL = "HA_LEASES4_COMMITTED_PARKING_LOT_FULL";
 extern const isc::log::MessageID HA_LEASES6_COMMITTED_FAILED = "HA_LEASES6_COMMITTED_FAILED";
 extern const isc::log::MessageID HA_LEASES6_COMMITTED_NOTHING_TO_UPDATE = "HA_LEASES6_COMMITTED_NOTHING_TO_UPDATE";
+extern const isc::log::MessageID HA_LEASES6_COMMITTED_PARKING_LOT_FULL = "HA_LEASES6_COMMITTED_PARKING_LOT_FULL";
+extern const isc::log::MessageID HA_LEASES_SYNC_CHANGES_RECEIVED = "HA_LEASES_SYNC_CHANGES_RECEIVED";
 extern const isc::log::MessageID HA_LEASES_SYNC_COMMUNICATIONS_FAILED = "HA_LEASES_SYNC_COMMUNICATIONS_FAILED";
 extern const isc::log::MessageID HA_LEASES_SYNC_FAILED = "HA_LEASES_SYNC_FAILED";
 extern const isc::log::MessageID HA_LEASES_SYNC_LEASE_PAGE_RECEIVED = "HA_LEASES_SYNC_LEASE_PAGE_RECEIVED";
+extern const isc::log::MessageID HA_LEASE_JOURNAL_RESET = "HA_LEASE_JOURNAL_RESET";
 extern const isc::log::MessageID HA_LEASE_SYNC_FAILED = "HA_LEASE_SYNC_FAILED";
+extern const isc::log::MessageID HA_LEASE_SYNC_STALE_DELETE_SKIP = "HA_LEASE_SYNC_STALE_DELETE_SKIP";
 extern const isc::log::MessageID HA_LEASE_SYNC_STALE_LEASE4_SKIP = "HA_LEASE_SYNC_STALE_LEASE4_SKIP";
 extern const isc::log::MessageID HA_LEASE_SYNC_STALE_LEASE6_SKIP = "HA_LEASE_SYNC_STALE_LEASE6_SKIP";
 extern const isc::log::MessageID HA_LEASE_UPDATES_DISABLED = "HA_LEASE_UPDATES_DISABLED";
 extern const isc::log::MessageID HA_LEASE_UPDATES_ENABLED = "HA_LEASE_UPDATES_ENABLED";
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED = "HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED";
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_FAILED = "HA_LEASE_UPDATE_BATCH_FAILED";
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_SENDING = "HA_LEASE_UPDATE_BATCH_SENDING";
 extern const isc::log::MessageID HA_LEASE_UPDATE_COMMUNICATIONS_FAILED = "HA_LEASE_UPDATE_COMMUNICATIONS_FAILED";
 extern const isc::log::MessageID HA_LEASE_UPDATE_FAILED = "HA_LEASE_UPDATE_FAILED";
 extern const isc::log::MessageID HA_LOAD_BALANCING_DUID_MISSING = "HA_LOAD_BALANCING_DUID_MISSING";
@@ -64,8 +73,12 @@ extern const isc::log::MessageID HA_STATE_MACHINE_PAUSED = "HA_STATE_MACHINE_PAU
 extern const isc::log::MessageID HA_STATE_TRANSITION = "HA_STATE_TRANSITION";
 extern const isc::log::MessageID HA_SYNC_FAILED = "HA_SYNC_FAILED";
 extern const isc::log::MessageID HA_SYNC_HANDLER_FAILED = "HA_SYNC_HANDLER_FAILED";
+extern const isc::log::MessageID HA_SYNC_JOURNAL_START = "HA_SYNC_JOURNAL_START";
+extern const isc::log::MessageID HA_SYNC_JOURNAL_UNAVAILABLE = "HA_SYNC_JOURNAL_UNAVAILABLE";
+extern const isc::log::MessageID HA_SYNC_PARTITIONS = "HA_SYNC_PARTITIONS";
 extern const isc::log::MessageID HA_SYNC_START = "HA_SYNC_START";
 extern const isc::log::MessageID HA_SYNC_SUCCESSFUL = "HA_SYNC_SUCCESSFUL";
+extern const isc::log::MessageID HA_SYNC_THROUGHPUT = "HA_SYNC_THROUGHPUT";
 extern const isc::log::MessageID HA_TERMINATED = "HA_TERMINATED";
 
 } // namespace ha
@@ -105,18 +118,27 @@ const char* values[] = {
     "HA_HIGH_CLOCK_SKEW", "partner's clock is %1, please synchronize clocks!",
     "HA_HIGH_CLOCK_SKEW_CAUSES_TERMINATION", "partner's clock is %1, causing HA service to terminate",
     "HA_INIT_OK", "loading High Availability hooks library successful",
+    "HA_JOURNAL_GET_HANDLER_FAILED", "ha-journal-get command failed: %1",
     "HA_LEASES4_COMMITTED_FAILED", "leases4_committed callout failed: %1",
     "HA_LEASES4_COMMITTED_NOTHING_TO_UPDATE", "%1: leases4_committed callout was invoked without any leases",
+    "HA_LEASES4_COMMITTED_PARKING_LOT_FULL", "%1: limit of %2 parked queries reached, %3 queries dropped so far",
     "HA_LEASES6_COMMITTED_FAILED", "leases6_committed callout failed: %1",
     "HA_LEASES6_COMMITTED_NOTHING_TO_UPDATE", "%1: leases6_committed callout was invoked without any leases",
+    "HA_LEASES6_COMMITTED_PARKING_LOT_FULL", "%1: limit of %2 parked queries reached, %3 queries dropped so far",
+    "HA_LEASES_SYNC_CHANGES_RECEIVED", "received %1 lease changes from %2",
     "HA_LEASES_SYNC_COMMUNICATIONS_FAILED", "failed to communicate with %1 while syncing leases: %2",
     "HA_LEASES_SYNC_FAILED", "failed to synchronize leases with %1: %2",
     "HA_LEASES_SYNC_LEASE_PAGE_RECEIVED", "received %1 leases from %2",
+    "HA_LEASE_JOURNAL_RESET", "lease journal reset after discarding a change the partner may have missed",
     "HA_LEASE_SYNC_FAILED", "synchronization failed for lease: %1, reason: %2",
+    "HA_LEASE_SYNC_STALE_DELETE_SKIP", "skipping deletion of lease %1 in subnet %2",
     "HA_LEASE_SYNC_STALE_LEASE4_SKIP", "skipping stale lease %1 in subnet %2",
     "HA_LEASE_SYNC_STALE_LEASE6_SKIP", "skipping stale lease %1 in subnet %2",
     "HA_LEASE_UPDATES_DISABLED", "lease updates will not be sent to the partner while in %1 state",
     "HA_LEASE_UPDATES_ENABLED", "lease updates will be sent to the partner while in %1 state",
+    "HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED", "failed to send lease updates of %1 queries to %2: %3",
+    "HA_LEASE_UPDATE_BATCH_FAILED", "batch of lease updates of %1 queries to %2 failed: %3",
+    "HA_LEASE_UPDATE_BATCH_SENDING", "sending batch of %1 lease updates of %2 queries to %3",
     "HA_LEASE_UPDATE_COMMUNICATIONS_FAILED", "%1: failed to communicate with %2: %3",
     "HA_LEASE_UPDATE_FAILED", "%1: lease update to %2 failed: %3",
     "HA_LOAD_BALANCING_DUID_MISSING", "load balancing failed for the DHCPv6 message (transaction id: %1) because DUID is missing",
@@ -131,8 +153,12 @@ const char* values[] = {
     "HA_STATE_TRANSITION", "server transitions from %1 to %2 state, partner state is %3",
     "HA_SYNC_FAILED", "lease database synchronization with %1 failed: %2",
     "HA_SYNC_HANDLER_FAILED", "ha-sync command failed: %1",
+    "HA_SYNC_JOURNAL_START", "fetching lease changes from %1 following sequence %2",
+    "HA_SYNC_JOURNAL_UNAVAILABLE", "lease changes are not available from %1: %2, fetching all leases",
+    "HA_SYNC_PARTITIONS", "synchronizing %1 address ranges with %2 in parallel",
     "HA_SYNC_START", "starting lease database synchronization with %1",
     "HA_SYNC_SUCCESSFUL", "lease database synchronization with %1 completed successfully in %2",
+    "HA_SYNC_THROUGHPUT", "received %1 leases from %2 in %3 (%4 leases per second)",
     "HA_TERMINATED", "HA service terminated because of the unacceptable clock skew; fix the problem and restart!",
     NULL
 };
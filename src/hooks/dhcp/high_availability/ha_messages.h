@@ -39,18 +39,27 @@ extern const isc::log::MessageID HA_HEARTBEAT_HANDLER_FAILED;
 extern const isc::log::MessageID HA_HIGH_CLOCK_SKEW;
 extern const isc::log::MessageID HA_HIGH_CLOCK_SKEW_CAUSES_TERMINATION;
 extern const isc::log::MessageID HA_INIT_OK;
+extern const isc::log::MessageID HA_JOURNAL_GET_HANDLER_FAILED;
 extern const isc::log::MessageID HA_LEASES4_COMMITTED_FAILED;
 extern const isc::log::MessageID HA_LEASES4_COMMITTED_NOTHING_TO_UPDATE;
+extern const isc::log::MessageID HA_LEASES4_COMMITTED_PARKING_LOT_FULL;
 extern const isc::log::MessageID HA_LEASES6_COMMITTED_FAILED;
 extern const isc::log::MessageID HA_LEASES6_COMMITTED_NOTHING_TO_UPDATE;
+extern const isc::log::MessageID HA_LEASES6_COMMITTED_PARKING_LOT_FULL;
+extern const isc::log::MessageID HA_LEASES_SYNC_CHANGES_RECEIVED;
 extern const isc::log::MessageID HA_LEASES_SYNC_COMMUNICATIONS_FAILED;
 extern const isc::log::MessageID HA_LEASES_SYNC_FAILED;
 extern const isc::log::MessageID HA_LEASES_SYNC_LEASE_PAGE_RECEIVED;
+extern const isc::log::MessageID HA_LEASE_JOURNAL_RESET;
 extern const isc::log::MessageID HA_LEASE_SYNC_FAILED;
+extern const isc::log::MessageID HA_LEASE_SYNC_STALE_DELETE_SKIP;
 extern const isc::log::MessageID HA_LEASE_SYNC_STALE_LEASE4_SKIP;
 extern const isc::log::MessageID HA_LEASE_SYNC_STALE_LEASE6_SKIP;
 extern const isc::log::MessageID HA_LEASE_UPDATES_DISABLED;
 extern const isc::log::MessageID HA_LEASE_UPDATES_ENABLED;
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED;
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_FAILED;
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_SENDING;
 extern const isc::log::MessageID HA_LEASE_UPDATE_COMMUNICATIONS_FAILED;
 extern const isc::log::MessageID HA_LEASE_UPDATE_FAILED;
 extern const isc::log::MessageID HA_LOAD_BALANCING_DUID_MISSING;
@@ -65,8 +74,12 @@ extern const isc::log::MessageID HA_STATE_MACHINE_PAUSED;
 extern const isc::log::MessageID HA_STATE_TRANSITION;
 extern const isc::log::MessageID HA_SYNC_FAILED;
 extern const isc::log::MessageID HA_SYNC_HANDLER_FAILED;
+extern const isc::log::MessageID HA_SYNC_JOURNAL_START;
+extern const isc::log::MessageID HA_SYNC_JOURNAL_UNAVAILABLE;
+extern const isc::log::MessageID HA_SYNC_PARTITIONS;
 extern const isc::log::MessageID HA_SYNC_START;
 extern const isc::log::MessageID HA_SYNC_SUCCESSFUL;
+extern const isc::log::MessageID HA_SYNC_THROUGHPUT;
 extern const isc::log::MessageID HA_TERMINATED;
 
 } // namespace ha
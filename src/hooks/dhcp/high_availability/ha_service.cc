@@ -10,19 +10,25 @@
 #include <ha_log.h>
 #include <ha_service.h>
 #include <ha_service_states.h>
+#include <asiolink/addr_utilities.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <http/date_time.h>
 #include <http/response_json.h>
 #include <http/post_request_json.h>
+#include <stats/stats_mgr.h>
 #include <util/stopwatch.h>
 #include <boost/pointer_cast.hpp>
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/weak_ptr.hpp>
+#include <algorithm>
+#include <set>
 #include <sstream>
+#include <vector>
 
 using namespace isc::asiolink;
 using namespace isc::config;
@@ -31,6 +37,7 @@ using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::http;
 using namespace isc::log;
+using namespace isc::stats;
 using namespace isc::util;
 
 namespace isc {
@@ -44,8 +51,14 @@ const int HAService::HA_SYNCING_SUCCEEDED_EVT;
 HAService::HAService(const IOServicePtr& io_service, const NetworkStatePtr& network_state,
                      const HAConfigPtr& config, const HAServerType& server_type)
     : io_service_(io_service), network_state_(network_state), config_(config),
-      server_type_(server_type), client_(*io_service), communication_state_(),
-      query_filter_(config), pending_requests_() {
+      server_type_(server_type),
+      client_(*io_service, config->getHttpMaxConnections(),
+              config->getHttpPipelineDepth()),
+      communication_state_(),
+      query_filter_(config), pending_requests_(), lease_journal_(),
+      unconfirmed_changes_(), failed_journal_sequence_(0), partner_journal_id_(),
+      partner_journal_sequence_(0),
+      lease_update_batches_() {
 
     if (server_type == HAServerType::DHCPv4) {
         communication_state_.reset(new CommunicationState4(io_service_, config));
@@ -54,6 +67,11 @@ HAService::HAService(const IOServicePtr& io_service, const NetworkStatePtr& netw
         communication_state_.reset(new CommunicationState6(io_service_, config));
     }
 
+    // The lease changes are only journaled when they are sent to the peers.
+    if (config->amSendingLeaseUpdates() && (config->getLeaseJournalSize() > 0)) {
+        lease_journal_.reset(new LeaseJournal(config->getLeaseJournalSize()));
+    }
+
     startModel(HA_WAITING_ST);
 
     LOG_INFO(ha_logger, HA_SERVICE_STARTED)
@@ -674,6 +692,9 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt4Ptr& query,
                                  const dhcp::Lease4CollectionPtr& deleted_leases,
                                  const hooks::ParkingLotHandlePtr& parking_lot) {
 
+    // Record the changes for a partner which would miss the lease updates.
+    const uint64_t first_sequence = journalLeaseChanges(leases, deleted_leases);
+
     // Get configurations of the peers. Exclude this instance.
     HAConfig::PeerConfigMap peers_configs = config_->getOtherServersConfig();
 
@@ -692,6 +713,12 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt4Ptr& query,
         // Count contacted servers.
         ++sent_num;
 
+        // Coalesce the lease updates with those of other queries.
+        if (config_->getLeaseUpdateBatchSize() > 0) {
+            batchLeaseUpdates(query, conf, leases, deleted_leases, parking_lot);
+            continue;
+        }
+
         // Lease updates for deleted leases.
         for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
             asyncSendLeaseUpdate(query, conf, CommandCreator::createLease4Delete(**l),
@@ -705,6 +732,11 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt4Ptr& query,
         }
     }
 
+    // The changes are known to the partner when the lease updates complete.
+    if ((sent_num > 0) && (first_sequence > 0)) {
+        unconfirmed_changes_[query] = first_sequence;
+    }
+
     return (sent_num);
 }
 
@@ -714,6 +746,9 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt6Ptr& query,
                                  const dhcp::Lease6CollectionPtr& deleted_leases,
                                  const hooks::ParkingLotHandlePtr& parking_lot) {
 
+    // Record the changes for a partner which would miss the lease updates.
+    const uint64_t first_sequence = journalLeaseChanges(leases, deleted_leases);
+
     // Get configurations of the peers. Exclude this instance.
     HAConfig::PeerConfigMap peers_configs = config_->getOtherServersConfig();
 
@@ -732,6 +767,12 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt6Ptr& query,
         // Count contacted servers.
         ++sent_num;
 
+        // Coalesce the lease updates with those of other queries.
+        if (config_->getLeaseUpdateBatchSize() > 0) {
+            batchLeaseUpdates(query, conf, leases, deleted_leases, parking_lot);
+            continue;
+        }
+
         // Lease updates for deleted leases.
         for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
             asyncSendLeaseUpdate(query, conf, CommandCreator::createLease6Delete(**l),
@@ -745,6 +786,11 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt6Ptr& query,
         }
     }
 
+    // The changes are known to the partner when the lease updates complete.
+    if ((sent_num > 0) && (first_sequence > 0)) {
+        unconfirmed_changes_[query] = first_sequence;
+    }
+
     return (sent_num);
 }
 
@@ -820,42 +866,7 @@ HAService::asyncSendLeaseUpdate(const QueryPtrType& query,
                 }
             }
 
-            // We don't care about the result of the lease update to the backup server.
-            // It is a best effort update.
-            if (config->getRole() != HAConfig::PeerConfig::BACKUP) {
-                if (lease_update_success) {
-                    // If the lease update was successful and we have sent it to the server
-                    // to which we also send heartbeats (primary, secondary or standby) we
-                    // can assume that the server is online and we can defer next heartbeat.
-                    communication_state_->poke();
-
-                } else {
-                    // Lease update was unsuccessful, so drop the parked DHCP packet.
-                    parking_lot->drop(query);
-                    communication_state_->setPartnerState("unavailable");
-                }
-            }
-
-            auto it = pending_requests_.find(query);
-
-            // If there are no more pending requests for this query, let's unpark
-            // the DHCP packet.
-            if (it == pending_requests_.end() || (--pending_requests_[query] <= 0)) {
-                parking_lot->unpark(query);
-
-                // If we have unparked the packet we can clear pending requests for
-                // this query.
-                if (it != pending_requests_.end()) {
-                    pending_requests_.erase(it);
-                }
-
-                // If we have finished sending the lease updates we need to run the
-                // state machine until the state machine finds that additional events
-                // are required, such as next heartbeat or a lease update. The runModel()
-                // may transition to another state, schedule asynchronous tasks etc.
-                // Then it returns control to the DHCP server.
-                runModel(HA_LEASE_UPDATES_COMPLETE_EVT);
-            }
+            leaseUpdateComplete(query, config, lease_update_success, parking_lot);
         });
 
     // Request scheduled, so update the request counters for the query.
@@ -867,6 +878,332 @@ HAService::asyncSendLeaseUpdate(const QueryPtrType& query,
     }
 }
 
+template<typename QueryPtrType>
+void
+HAService::leaseUpdateComplete(const QueryPtrType& query,
+                               const HAConfig::PeerConfigPtr& config,
+                               const bool success,
+                               const ParkingLotHandlePtr& parking_lot) {
+    // We don't care about the result of the lease update to the backup server.
+    // It is a best effort update.
+    if (config->getRole() != HAConfig::PeerConfig::BACKUP) {
+        if (success) {
+            // If the lease update was successful and we have sent it to the server
+            // to which we also send heartbeats (primary, secondary or standby) we
+            // can assume that the server is online and we can defer next heartbeat.
+            communication_state_->poke();
+
+        } else {
+            // Lease update was unsuccessful, so drop the parked DHCP packet.
+            parking_lot->drop(query);
+            communication_state_->setPartnerState("unavailable");
+
+            // The partner may have missed the change, so it must fetch it
+            // from the journal with the changes following it.
+            auto c = unconfirmed_changes_.find(query);
+            if (c != unconfirmed_changes_.end() &&
+                ((failed_journal_sequence_ == 0) ||
+                 (c->second < failed_journal_sequence_))) {
+                failed_journal_sequence_ = c->second;
+            }
+        }
+    }
+
+    auto it = pending_requests_.find(query);
+
+    // If there are no more pending requests for this query, let's unpark
+    // the DHCP packet.
+    if (it == pending_requests_.end() || (--pending_requests_[query] <= 0)) {
+        parking_lot->unpark(query);
+
+        // If we have unparked the packet we can clear pending requests for
+        // this query.
+        if (it != pending_requests_.end()) {
+            pending_requests_.erase(it);
+        }
+        unconfirmed_changes_.erase(query);
+
+        // If we have finished sending the lease updates we need to run the
+        // state machine until the state machine finds that additional events
+        // are required, such as next heartbeat or a lease update. The runModel()
+        // may transition to another state, schedule asynchronous tasks etc.
+        // Then it returns control to the DHCP server.
+        runModel(HA_LEASE_UPDATES_COMPLETE_EVT);
+    }
+}
+
+template<typename LeaseCollectionPtrType>
+uint64_t
+HAService::journalLeaseChanges(const LeaseCollectionPtrType& leases,
+                               const LeaseCollectionPtrType& deleted_leases) {
+    if (!lease_journal_) {
+        return (0);
+    }
+
+    uint64_t first_sequence = 0;
+    for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
+        uint64_t sequence = lease_journal_->record(LeaseJournal::OP_DELETE, **l);
+        if (first_sequence == 0) {
+            first_sequence = sequence;
+        }
+    }
+    for (auto l = leases->begin(); l != leases->end(); ++l) {
+        uint64_t sequence = lease_journal_->record(LeaseJournal::OP_UPDATE, **l);
+        if (first_sequence == 0) {
+            first_sequence = sequence;
+        }
+    }
+
+    // The partner can't get a change it may have missed once the journal
+    // discarded it. It must not fetch the changes following it either.
+    if ((failed_journal_sequence_ > 0) &&
+        (failed_journal_sequence_ < lease_journal_->getFirstSequence())) {
+        lease_journal_->reset();
+        failed_journal_sequence_ = 0;
+        LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_JOURNAL_RESET);
+    }
+
+    return (first_sequence);
+}
+
+uint64_t
+HAService::getConfirmedJournalSequence() const {
+    uint64_t sequence = lease_journal_->getLastSequence();
+    for (auto c = unconfirmed_changes_.begin(); c != unconfirmed_changes_.end(); ++c) {
+        sequence = std::min(sequence, c->second - 1);
+    }
+    if (failed_journal_sequence_ > 0) {
+        sequence = std::min(sequence, failed_journal_sequence_ - 1);
+    }
+    return (sequence);
+}
+
+template<typename QueryPtrType, typename LeaseCollectionPtrType>
+void
+HAService::batchLeaseUpdates(const QueryPtrType& query,
+                             const HAConfig::PeerConfigPtr& config,
+                             const LeaseCollectionPtrType& leases,
+                             const LeaseCollectionPtrType& deleted_leases,
+                             const ParkingLotHandlePtr& parking_lot) {
+    BatchedQuery batched_query;
+    for (auto l = leases->begin(); l != leases->end(); ++l) {
+        batched_query.addresses_.insert((*l)->addr_.toText());
+    }
+    // A lease updated by the query replaces its deletion.
+    std::vector<const Lease*> deletions;
+    for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
+        if (batched_query.addresses_.insert((*l)->addr_.toText()).second) {
+            deletions.push_back(l->get());
+        }
+    }
+
+    // The peer applies the deleted leases of a batch before the updated
+    // ones, so a batch must not hold two changes of the same address.
+    // Complete the pending batch if the query changes one of its addresses.
+    PeerLeaseUpdateBatches& peer = lease_update_batches_[config->getName()];
+    if (peer.pending_) {
+        for (auto a = batched_query.addresses_.begin();
+             a != batched_query.addresses_.end(); ++a) {
+            if (peer.pending_->addresses_.count(*a) > 0) {
+                asyncSendLeaseUpdateBatch(config->getName());
+                break;
+            }
+        }
+    }
+
+    // Get the pending batch for the peer or start a new one.
+    if (!peer.pending_) {
+        peer.pending_.reset(new LeaseUpdateBatch());
+        peer.pending_->config_ = config;
+        peer.pending_->leases_ = Element::createList();
+        peer.pending_->deleted_leases_ = Element::createList();
+    }
+    LeaseUpdateBatchPtr batch = peer.pending_;
+
+    for (auto l = deletions.begin(); l != deletions.end(); ++l) {
+        batch->deleted_leases_->add(CommandCreator::createLeaseBulkApplyEntry(**l));
+    }
+    for (auto l = leases->begin(); l != leases->end(); ++l) {
+        batch->leases_->add(CommandCreator::createLeaseBulkApplyEntry(**l));
+    }
+    batch->addresses_.insert(batched_query.addresses_.begin(),
+                             batched_query.addresses_.end());
+
+    // As for the lease updates sent one by one, pass a weak pointer to the
+    // query.
+    boost::weak_ptr<typename QueryPtrType::element_type> weak_query(query);
+    batched_query.complete_ = [this, weak_query, parking_lot, config]
+        (const bool success, const std::string& error_str) {
+        // The server keeps the pointer to the query and parks it so it is
+        // not expected to be null. If it is, skip it so the other queries
+        // of the batch are processed.
+        QueryPtrType query = weak_query.lock();
+        if (!query) {
+            return;
+        }
+
+        if (!error_str.empty()) {
+            LOG_WARN(ha_logger, HA_LEASE_UPDATE_FAILED)
+                .arg(query->getLabel())
+                .arg(config->getLogLabel())
+                .arg(error_str);
+        }
+
+        leaseUpdateComplete(query, config, success, parking_lot);
+    };
+    batch->queries_.push_back(batched_query);
+
+    // The query waits for the batch as for any other request.
+    ++pending_requests_[query];
+
+    // Send the batch when full. Otherwise make sure it is sent when the
+    // batch window elapses.
+    if (batch->leases_->size() + batch->deleted_leases_->size() >=
+        config_->getLeaseUpdateBatchSize()) {
+        asyncSendLeaseUpdateBatch(config->getName());
+
+    } else if (!batch->timer_) {
+        batch->timer_.reset(new IntervalTimer(*io_service_));
+        batch->timer_->setup(boost::bind(&HAService::asyncSendLeaseUpdateBatch,
+                                         this, config->getName()),
+                             std::max(config_->getLeaseUpdateBatchWindow(),
+                                      static_cast<uint32_t>(1)),
+                             IntervalTimer::ONE_SHOT);
+    }
+}
+
+void
+HAService::asyncSendLeaseUpdateBatch(const std::string& peer_name) {
+    auto it = lease_update_batches_.find(peer_name);
+    if ((it == lease_update_batches_.end()) || !it->second.pending_) {
+        return;
+    }
+
+    // Lease updates added from now on go to a new batch.
+    LeaseUpdateBatchPtr batch = it->second.pending_;
+    it->second.pending_.reset();
+    if (batch->timer_) {
+        batch->timer_->cancel();
+    }
+    it->second.waiting_.push_back(batch);
+
+    sendWaitingLeaseUpdateBatches(peer_name);
+}
+
+void
+HAService::sendWaitingLeaseUpdateBatches(const std::string& peer_name) {
+    PeerLeaseUpdateBatches& peer = lease_update_batches_[peer_name];
+    while (!peer.waiting_.empty() &&
+           (peer.outstanding_ < config_->getLeaseUpdateMaxOutstandingBatches())) {
+        LeaseUpdateBatchPtr batch = peer.waiting_.front();
+
+        // Hold the batches in order until the changes of the same addresses
+        // have been applied by the peer.
+        for (auto a = batch->addresses_.begin(); a != batch->addresses_.end(); ++a) {
+            if (peer.outstanding_addresses_.count(*a) > 0) {
+                return;
+            }
+        }
+
+        peer.waiting_.pop_front();
+        ++peer.outstanding_;
+        peer.outstanding_addresses_.insert(batch->addresses_.begin(),
+                                           batch->addresses_.end());
+
+        LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_UPDATE_BATCH_SENDING)
+            .arg(batch->leases_->size() + batch->deleted_leases_->size())
+            .arg(batch->queries_.size())
+            .arg(batch->config_->getLogLabel());
+
+        // Create HTTP/1.1 request including our command.
+        PostHttpRequestJsonPtr request = boost::make_shared<PostHttpRequestJson>
+            (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11());
+        request->setBodyAsJson(CommandCreator::createLeaseBulkApply(batch->leases_,
+                                                                    batch->deleted_leases_,
+                                                                    server_type_));
+        request->finalize();
+
+        // Response object should also be created because the HTTP client needs
+        // to know the type of the expected response.
+        HttpResponseJsonPtr response = boost::make_shared<HttpResponseJson>();
+
+        // Schedule asynchronous HTTP request.
+        client_.asyncSendRequest(batch->config_->getUrl(), request, response,
+            [this, batch, peer_name](const boost::system::error_code& ec,
+                                     const HttpResponsePtr& response,
+                                     const std::string& error_str) {
+            // As for the lease updates sent one by one, an IO error, an HTTP
+            // parsing error or an error status code fail the lease updates
+            // of all the queries.
+            bool batch_success = true;
+            ConstElementPtr args;
+            if (ec || !error_str.empty()) {
+                LOG_WARN(ha_logger, HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED)
+                    .arg(batch->queries_.size())
+                    .arg(batch->config_->getLogLabel())
+                    .arg(ec ? ec.message() : error_str);
+                batch_success = false;
+
+            } else {
+                try {
+                    args = verifyAsyncResponse(response);
+
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_UPDATE_BATCH_FAILED)
+                        .arg(batch->queries_.size())
+                        .arg(batch->config_->getLogLabel())
+                        .arg(ex.what());
+                    batch_success = false;
+                }
+            }
+
+            // The peer lists the leases it could not apply. These fail the
+            // lease updates of the queries they belong to. Each address
+            // appears once in the batch so it belongs to a single query.
+            std::map<std::string, std::string> failed_leases;
+            if (args && (args->getType() == Element::map)) {
+                ConstElementPtr failed_list = args->get("failed-leases");
+                if (failed_list && (failed_list->getType() == Element::list)) {
+                    for (auto failed : failed_list->listValue()) {
+                        ConstElementPtr address = failed->get("ip-address");
+                        ConstElementPtr error = failed->get("error-message");
+                        if (address && (address->getType() == Element::string)) {
+                            failed_leases[address->stringValue()] =
+                                (error && (error->getType() == Element::string) ?
+                                 error->stringValue() : "unknown error");
+                        }
+                    }
+                }
+            }
+
+            // The batch is no longer outstanding. Send the batches which
+            // waited for it.
+            PeerLeaseUpdateBatches& peer = lease_update_batches_[peer_name];
+            --peer.outstanding_;
+            for (auto a = batch->addresses_.begin(); a != batch->addresses_.end(); ++a) {
+                auto o = peer.outstanding_addresses_.find(*a);
+                if (o != peer.outstanding_addresses_.end()) {
+                    peer.outstanding_addresses_.erase(o);
+                }
+            }
+            sendWaitingLeaseUpdateBatches(peer_name);
+
+            for (auto q = batch->queries_.begin(); q != batch->queries_.end(); ++q) {
+                std::string query_error;
+                for (auto a = q->addresses_.begin();
+                     batch_success && query_error.empty() &&
+                     (a != q->addresses_.end()); ++a) {
+                    auto f = failed_leases.find(*a);
+                    if (f != failed_leases.end()) {
+                        query_error = *a + ": " + f->second;
+                    }
+                }
+                q->complete_(batch_success && query_error.empty(), query_error);
+            }
+        });
+    }
+}
+
 bool
 HAService::shouldSendLeaseUpdates(const HAConfig::PeerConfigPtr& peer_config) const {
     // Never send lease updates if they are administratively disabled.
@@ -907,10 +1244,63 @@ HAService::processHeartbeat() {
     std::string date_time = HttpDateTime().rfc1123Format();
     arguments->set("date-time", Element::create(date_time));
 
+    // The partner remembers the position in the lease journal to fetch
+    // the changes it misses during an outage.
+    if (lease_journal_) {
+        arguments->set("journal-id", Element::create(lease_journal_->getId()));
+        arguments->set("journal-sequence",
+                       Element::create(static_cast<long long int>(getConfirmedJournalSequence())));
+    }
+
     return (createAnswer(CONTROL_RESULT_SUCCESS, "HA peer status returned.",
                          arguments));
 }
 
+ConstElementPtr
+HAService::processJournalGet(const std::string& journal_id,
+                             const uint64_t from_sequence,
+                             const uint32_t limit) {
+    if (!lease_journal_) {
+        return (createAnswer(CONTROL_RESULT_ERROR, "lease journal is disabled"));
+    }
+
+    if (journal_id != lease_journal_->getId()) {
+        return (createAnswer(CONTROL_RESULT_ERROR, "lease journal '" + journal_id +
+                             "' not found"));
+    }
+
+    std::vector<LeaseJournal::Entry> entries;
+    if (!lease_journal_->getChanges(from_sequence, limit, entries)) {
+        std::ostringstream s;
+        s << "lease changes following sequence " << from_sequence
+          << " are not available";
+        return (createAnswer(CONTROL_RESULT_ERROR, s.str()));
+    }
+
+    // The partner applied the changes it fetched before, including the
+    // change of a failed lease update.
+    if ((failed_journal_sequence_ > 0) && (from_sequence >= failed_journal_sequence_)) {
+        failed_journal_sequence_ = 0;
+    }
+
+    ElementPtr changes = Element::createList();
+    for (auto e = entries.begin(); e != entries.end(); ++e) {
+        ElementPtr change = Element::createMap();
+        change->set("sequence", Element::create(static_cast<long long int>(e->sequence_)));
+        change->set("operation", Element::create(LeaseJournal::operationToString(e->operation_)));
+        change->set("lease", e->lease_->toElement());
+        changes->add(change);
+    }
+
+    ElementPtr arguments = Element::createMap();
+    arguments->set("journal-id", Element::create(lease_journal_->getId()));
+    arguments->set("changes", changes);
+
+    std::ostringstream s;
+    s << entries.size() << " lease changes returned.";
+    return (createAnswer(CONTROL_RESULT_SUCCESS, s.str(), arguments));
+}
+
 void
 HAService::asyncSendHeartbeat() {
     HAConfig::PeerConfigPtr partner_config = config_->getFailoverPeerConfig();
@@ -976,6 +1366,8 @@ HAService::asyncSendHeartbeat() {
                     // Note the time returned by the partner to calculate the clock skew.
                     communication_state_->setPartnerTime(date_time->stringValue());
 
+                    updatePartnerJournal(args);
+
                 } catch (const std::exception& ex) {
                     LOG_WARN(ha_logger, HA_HEARTBEAT_FAILED)
                         .arg(partner_config->getLogLabel())
@@ -1005,6 +1397,33 @@ HAService::asyncSendHeartbeat() {
       });
 }
 
+void
+HAService::updatePartnerJournal(const ConstElementPtr& args) {
+    if (config_->getLeaseJournalSize() == 0) {
+        return;
+    }
+
+    // This server doesn't receive the lease updates in other states.
+    const int state = getCurrState();
+    const int partner_state = communication_state_->getPartnerState();
+    if (((state != HA_LOAD_BALANCING_ST) && (state != HA_HOT_STANDBY_ST)) ||
+        (partner_state != state)) {
+        return;
+    }
+
+    ConstElementPtr journal_id = args->get("journal-id");
+    ConstElementPtr journal_sequence = args->get("journal-sequence");
+    if (!journal_id || (journal_id->getType() != Element::string) ||
+        !journal_sequence || (journal_sequence->getType() != Element::integer) ||
+        (journal_sequence->intValue() < 0)) {
+        partner_journal_id_.clear();
+        return;
+    }
+
+    partner_journal_id_ = journal_id->stringValue();
+    partner_journal_sequence_ = static_cast<uint64_t>(journal_sequence->intValue());
+}
+
 void
 HAService::scheduleHeartbeat() {
     if (!communication_state_->isHeartbeatRunning()) {
@@ -1189,26 +1608,115 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
                            const dhcp::LeasePtr& last_lease,
                            PostSyncCallback post_sync_action,
                            const bool dhcp_disabled) {
+    SyncContextPtr context(new SyncContext(server_name, post_sync_action,
+                                           dhcp_disabled));
+
+    std::vector<SyncPartition> partitions;
+    if (last_lease) {
+        // Continue fetching the leases following the given one.
+        partitions.push_back(SyncPartition(last_lease->addr_,
+                                           getSyncPartitions().back().second));
+
+    } else {
+        partitions = getSyncPartitions();
+    }
+
+    if (partitions.size() > 1) {
+        LOG_INFO(ha_logger, HA_SYNC_PARTITIONS)
+            .arg(partitions.size())
+            .arg(server_name);
+    }
+
+    // The ranges are synchronized in parallel, each with its own sequence
+    // of pages.
+    context->pending_ = partitions.size();
+    for (auto p = partitions.begin(); p != partitions.end(); ++p) {
+        asyncSyncPartition(http_client, server_name, max_period, *p, context);
+    }
+}
+
+std::vector<HAService::SyncPartition>
+HAService::getSyncPartitions() const {
+    const bool v4 = (server_type_ == HAServerType::DHCPv4);
+    const IOAddress first_address(v4 ? "0.0.0.0" : "::");
+    const IOAddress last_address(v4 ? "255.255.255.255" :
+                                 "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+
+    // The first addresses of the configured subnets are the candidate
+    // range boundaries.
+    std::set<IOAddress> subnet_starts;
+    if (config_->getSyncPartitions() > 1) {
+        ConstSrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+        if (v4) {
+            const Subnet4Collection* subnets = cfg->getCfgSubnets4()->getAll();
+            for (auto s = subnets->begin(); s != subnets->end(); ++s) {
+                std::pair<IOAddress, uint8_t> prefix = (*s)->get();
+                subnet_starts.insert(firstAddrInPrefix(prefix.first, prefix.second));
+            }
+
+        } else {
+            const Subnet6Collection* subnets = cfg->getCfgSubnets6()->getAll();
+            for (auto s = subnets->begin(); s != subnets->end(); ++s) {
+                std::pair<IOAddress, uint8_t> prefix = (*s)->get();
+                subnet_starts.insert(firstAddrInPrefix(prefix.first, prefix.second));
+            }
+        }
+        subnet_starts.erase(first_address);
+    }
+
+    std::vector<IOAddress> starts(subnet_starts.begin(), subnet_starts.end());
+    const size_t count = std::max(static_cast<size_t>(1),
+                                  std::min(static_cast<size_t>(config_->getSyncPartitions()),
+                                           starts.size()));
+
+    // Pick the boundaries evenly among the subnets. The first range holds
+    // the first subnet, so a boundary is never the first subnet start.
+    std::vector<IOAddress> boundaries;
+    for (size_t i = 1; i < count; ++i) {
+        boundaries.push_back(starts[i * starts.size() / count]);
+    }
+
+    // The first address of a range is excluded from it, as it is the last
+    // address of the previous page. Hence, it is one less than the boundary.
+    const IOAddress one(v4 ? "0.0.0.1" : "::1");
+    std::vector<SyncPartition> partitions;
+    IOAddress from = first_address;
+    for (auto b = boundaries.begin(); b != boundaries.end(); ++b) {
+        IOAddress to = IOAddress::subtract(*b, one);
+        partitions.push_back(SyncPartition(from, to));
+        from = to;
+    }
+    partitions.push_back(SyncPartition(from, last_address));
+
+    return (partitions);
+}
+
+void
+HAService::asyncSyncPartition(http::HttpClient& http_client,
+                              const std::string& server_name,
+                              const unsigned int max_period,
+                              const SyncPartition& partition,
+                              const SyncContextPtr& context) {
     // Synchronization starts with a command to disable DHCP service of the
     // peer from which we're fetching leases. We don't want the other server
     // to allocate new leases while we fetch from it. The DHCP service will
     // be disabled for a certain amount of time and will be automatically
     // re-enabled if we die during the synchronization.
     asyncDisableDHCPService(http_client, server_name, max_period,
-                            [this, &http_client, server_name, max_period, last_lease,
-                             post_sync_action, dhcp_disabled]
+                            [this, &http_client, server_name, max_period, partition,
+                             context]
                             (const bool success, const std::string& error_message) {
 
         // If we have successfully disabled the DHCP service on the peer,
         // we can start fetching the leases.
         if (success) {
-            // The last argument indicates that disabling the DHCP
-            // service on the partner server was successful.
+            // Disabling the DHCP service on the partner server was successful.
+            context->dhcp_disabled_ = true;
             asyncSyncLeasesInternal(http_client, server_name, max_period,
-                                    last_lease, post_sync_action, true);
+                                    partition, context);
 
         } else {
-            post_sync_action(success, error_message, dhcp_disabled);
+            syncPartitionComplete(context, error_message);
         }
     });
 }
@@ -1217,23 +1725,18 @@ void
 HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                    const std::string& server_name,
                                    const unsigned int max_period,
-                                   const dhcp::LeasePtr& last_lease,
-                                   PostSyncCallback post_sync_action,
-                                   const bool dhcp_disabled) {
+                                   const SyncPartition& partition,
+                                   const SyncContextPtr& context) {
 
     HAConfig::PeerConfigPtr partner_config = config_->getFailoverPeerConfig();
 
     // Create HTTP/1.1 request including our command.
     PostHttpRequestJsonPtr request = boost::make_shared<PostHttpRequestJson>
         (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11());
-    if (server_type_ == HAServerType::DHCPv4) {
-        request->setBodyAsJson(CommandCreator::createLease4GetPage(
-            boost::dynamic_pointer_cast<Lease4>(last_lease), config_->getSyncPageLimit()));
-
-    } else {
-        request->setBodyAsJson(CommandCreator::createLease6GetPage(
-            boost::dynamic_pointer_cast<Lease6>(last_lease), config_->getSyncPageLimit()));
-    }
+    request->setBodyAsJson(CommandCreator::createLeaseGetPage(partition.first,
+                                                              partition.second,
+                                                              config_->getSyncPageLimit(),
+                                                              server_type_));
     request->finalize();
 
     // Response object should also be created because the HTTP client needs
@@ -1242,12 +1745,11 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
 
     // Schedule asynchronous HTTP request.
     http_client.asyncSendRequest(partner_config->getUrl(), request, response,
-        [this, partner_config, post_sync_action, &http_client, server_name,
-         max_period, dhcp_disabled]
+        [this, partner_config, &http_client, server_name, max_period, partition,
+         context]
             (const boost::system::error_code& ec,
              const HttpResponsePtr& response,
              const std::string& error_str) {
-
              // Holds last lease received on the page of leases. If the last
              // page was hit, this value remains null.
              LeasePtr last_lease;
@@ -1292,68 +1794,20 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                         .arg(leases_element.size())
                         .arg(server_name);
 
+                    context->leases_ += leases_element.size();
+
                     for (auto l = leases_element.begin(); l != leases_element.end(); ++l) {
                         try {
-
-                            if (server_type_ == HAServerType::DHCPv4) {
-                                Lease4Ptr lease = Lease4::fromElement(*l);
-
-                                // Check if there is such lease in the database already.
-                                Lease4Ptr existing_lease = LeaseMgrFactory::instance().getLease4(lease->addr_);
-                                if (!existing_lease) {
-                                    // There is no such lease, so let's add it.
-                                    LeaseMgrFactory::instance().addLease(lease);
-
-                                } else if (existing_lease->cltt_ < lease->cltt_) {
-                                    // If the existing lease is older than the fetched lease, update
-                                    // the lease in our local database.
-                                    LeaseMgrFactory::instance().updateLease4(lease);
-
-                                } else {
-                                    LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE4_SKIP)
-                                        .arg(lease->addr_.toText())
-                                        .arg(lease->subnet_id_);
-                                }
-
-                                // If we're not on the last page and we're processing final lease on
-                                // this page, let's record the lease as input to the next
-                                // lease4-get-page command.
-                                if ((leases_element.size() >= config_->getSyncPageLimit()) &&
-                                    (l + 1 == leases_element.end())) {
-                                    last_lease = boost::dynamic_pointer_cast<Lease>(lease);
-                                }
-
-                            } else {
-                                Lease6Ptr lease = Lease6::fromElement(*l);
-
-                                // Check if there is such lease in the database already.
-                                Lease6Ptr existing_lease = LeaseMgrFactory::instance().getLease6(lease->type_,
-                                                                                                 lease->addr_);
-                                if (!existing_lease) {
-                                    // There is no such lease, so let's add it.
-                                    LeaseMgrFactory::instance().addLease(lease);
-
-                                } else if (existing_lease->cltt_ < lease->cltt_) {
-                                    // If the existing lease is older than the fetched lease, update
-                                    // the lease in our local database.
-                                    LeaseMgrFactory::instance().updateLease6(lease);
-
-                                } else {
-                                    LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE6_SKIP)
-                                        .arg(lease->addr_.toText())
-                                        .arg(lease->subnet_id_);
-                                }
-
-                                // If we're not on the last page and we're processing final lease on
-                                // this page, let's record the lease as input to the next
-                                // lease6-get-page command.
-                                if ((leases_element.size() >= config_->getSyncPageLimit()) &&
-                                    (l + 1 == leases_element.end())) {
-                                    last_lease = boost::dynamic_pointer_cast<Lease>(lease);
-                                }
+                            LeasePtr lease = updateSyncedLease(*l);
+
+                            // If we're not on the last page and we're processing final lease on
+                            // this page, let's record the lease as input to the next
+                            // leaseX-get-page command.
+                            if ((leases_element.size() >= config_->getSyncPageLimit()) &&
+                                (l + 1 == leases_element.end())) {
+                                last_lease = lease;
                             }
 
-
                         } catch (const std::exception& ex) {
                             LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
                                 .arg((*l)->str())
@@ -1374,23 +1828,299 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
              if (!error_message.empty()) {
                  communication_state_->setPartnerState("unavailable");
 
-             } else if (last_lease) {
-                 // This indicates that there are more leases to be fetched.
-                 // Therefore, we have to send another leaseX-get-page command.
-                 asyncSyncLeases(http_client, server_name, max_period, last_lease,
-                                 post_sync_action, dhcp_disabled);
+             } else if (last_lease && context->error_message_.empty()) {
+                 // This indicates that there are more leases to be fetched
+                 // in this range. Therefore, we have to send another
+                 // leaseX-get-page command, unless another range failed.
+                 asyncSyncPartition(http_client, server_name, max_period,
+                                    SyncPartition(last_lease->addr_, partition.second),
+                                    context);
                  return;
              }
 
-            // Invoke post synchronization action if it was specified.
+             syncPartitionComplete(context, error_message);
+    }, HttpClient::RequestTimeout(config_->getSyncTimeout()));
+}
+
+LeasePtr
+HAService::updateSyncedLease(const ConstElementPtr& lease_element) {
+    if (server_type_ == HAServerType::DHCPv4) {
+        Lease4Ptr lease = Lease4::fromElement(lease_element);
+
+        // Check if there is such lease in the database already.
+        Lease4Ptr existing_lease = LeaseMgrFactory::instance().getLease4(lease->addr_);
+        if (!existing_lease) {
+            // There is no such lease, so let's add it.
+            LeaseMgrFactory::instance().addLease(lease);
+
+        } else if (existing_lease->cltt_ < lease->cltt_) {
+            // If the existing lease is older than the fetched lease, update
+            // the lease in our local database.
+            LeaseMgrFactory::instance().updateLease4(lease);
+
+        } else {
+            LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE4_SKIP)
+                .arg(lease->addr_.toText())
+                .arg(lease->subnet_id_);
+        }
+
+        return (lease);
+    }
+
+    Lease6Ptr lease = Lease6::fromElement(lease_element);
+
+    // Check if there is such lease in the database already.
+    Lease6Ptr existing_lease = LeaseMgrFactory::instance().getLease6(lease->type_,
+                                                                     lease->addr_);
+    if (!existing_lease) {
+        // There is no such lease, so let's add it.
+        LeaseMgrFactory::instance().addLease(lease);
+
+    } else if (existing_lease->cltt_ < lease->cltt_) {
+        // If the existing lease is older than the fetched lease, update
+        // the lease in our local database.
+        LeaseMgrFactory::instance().updateLease6(lease);
+
+    } else {
+        LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE6_SKIP)
+            .arg(lease->addr_.toText())
+            .arg(lease->subnet_id_);
+    }
+
+    return (lease);
+}
+
+void
+HAService::deleteSyncedLease(const ConstElementPtr& lease_element) {
+    LeasePtr lease;
+    LeasePtr existing_lease;
+    if (server_type_ == HAServerType::DHCPv4) {
+        Lease4Ptr lease4 = Lease4::fromElement(lease_element);
+        existing_lease = LeaseMgrFactory::instance().getLease4(lease4->addr_);
+        lease = lease4;
+
+    } else {
+        Lease6Ptr lease6 = Lease6::fromElement(lease_element);
+        existing_lease = LeaseMgrFactory::instance().getLease6(lease6->type_,
+                                                               lease6->addr_);
+        lease = lease6;
+    }
+
+    if (!existing_lease) {
+        return;
+    }
+
+    // The lease may have been renewed by this server after the partner
+    // deleted it.
+    if (existing_lease->cltt_ > lease->cltt_) {
+        LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_DELETE_SKIP)
+            .arg(lease->addr_.toText())
+            .arg(lease->subnet_id_);
+        return;
+    }
+
+    LeaseMgrFactory::instance().deleteLease(lease->addr_);
+}
+
+uint64_t
+HAService::applySyncedLeaseChange(const ConstElementPtr& change) {
+    if (!change || (change->getType() != Element::map)) {
+        isc_throw(BadValue, "lease change must be a map");
+    }
+
+    ConstElementPtr sequence = change->get("sequence");
+    if (!sequence || (sequence->getType() != Element::integer) ||
+        (sequence->intValue() <= 0)) {
+        isc_throw(BadValue, "'sequence' of the lease change must be a positive"
+                  " integer");
+    }
+
+    ConstElementPtr operation = change->get("operation");
+    if (!operation || (operation->getType() != Element::string)) {
+        isc_throw(BadValue, "'operation' of the lease change must be a string");
+    }
+
+    ConstElementPtr lease = change->get("lease");
+    if (!lease || (lease->getType() != Element::map)) {
+        isc_throw(BadValue, "'lease' of the lease change must be a map");
+    }
+
+    if (LeaseJournal::stringToOperation(operation->stringValue()) ==
+        LeaseJournal::OP_DELETE) {
+        deleteSyncedLease(lease);
+
+    } else {
+        static_cast<void>(updateSyncedLease(lease));
+    }
+
+    return (static_cast<uint64_t>(sequence->intValue()));
+}
+
+void
+HAService::asyncSyncLeaseChanges(http::HttpClient& http_client,
+                                 const std::string& server_name,
+                                 const unsigned int max_period,
+                                 const uint64_t from_sequence,
+                                 PostSyncCallback post_sync_action,
+                                 const bool dhcp_disabled) {
+    // As for fetching the pages of leases, the DHCP service of the partner
+    // is disabled before fetching each page of changes.
+    asyncDisableDHCPService(http_client, server_name, max_period,
+                            [this, &http_client, server_name, max_period, from_sequence,
+                             post_sync_action, dhcp_disabled]
+                            (const bool success, const std::string& error_message) {
+        if (success) {
+            asyncSyncLeaseChangesInternal(http_client, server_name, max_period,
+                                          from_sequence, post_sync_action);
+
+        } else if (post_sync_action) {
+            post_sync_action(success, error_message, dhcp_disabled);
+        }
+    });
+}
+
+void
+HAService::asyncSyncLeaseChangesInternal(http::HttpClient& http_client,
+                                         const std::string& server_name,
+                                         const unsigned int max_period,
+                                         const uint64_t from_sequence,
+                                         PostSyncCallback post_sync_action) {
+
+    HAConfig::PeerConfigPtr partner_config = config_->getFailoverPeerConfig();
+
+    // Create HTTP/1.1 request including our command.
+    PostHttpRequestJsonPtr request = boost::make_shared<PostHttpRequestJson>
+        (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11());
+    request->setBodyAsJson(CommandCreator::createJournalGet(partner_journal_id_,
+                                                            from_sequence,
+                                                            config_->getSyncPageLimit(),
+                                                            server_type_));
+    request->finalize();
+
+    // Response object should also be created because the HTTP client needs
+    // to know the type of the expected response.
+    HttpResponseJsonPtr response = boost::make_shared<HttpResponseJson>();
+
+    // Schedule asynchronous HTTP request.
+    http_client.asyncSendRequest(partner_config->getUrl(), request, response,
+        [this, partner_config, &http_client, server_name, max_period, from_sequence,
+         post_sync_action]
+            (const boost::system::error_code& ec,
+             const HttpResponsePtr& response,
+             const std::string& error_str) {
+
+            // Communication errors terminate the synchronization.
+            if (ec || !error_str.empty()) {
+                std::string error_message = (ec ? ec.message() : error_str);
+                LOG_ERROR(ha_logger, HA_LEASES_SYNC_COMMUNICATIONS_FAILED)
+                    .arg(partner_config->getLogLabel())
+                    .arg(error_message);
+                communication_state_->setPartnerState("unavailable");
+                if (post_sync_action) {
+                    post_sync_action(false, error_message, true);
+                }
+                return;
+            }
+
+            ConstElementPtr changes;
+            try {
+                ConstElementPtr args = verifyAsyncResponse(response);
+                if (!args || (args->getType() != Element::map)) {
+                    isc_throw(CtrlChannelError,
+                              "arguments in the received response must be a map");
+                }
+
+                changes = args->get("changes");
+                if (!changes || (changes->getType() != Element::list)) {
+                    isc_throw(CtrlChannelError,
+                              "server response does not contain changes argument or"
+                              " this argument is not a list");
+                }
+
+            } catch (const std::exception& ex) {
+                // The changes are not available, e.g. because the journal
+                // has been truncated or the partner has been restarted.
+                // Fetch all leases instead.
+                LOG_INFO(ha_logger, HA_SYNC_JOURNAL_UNAVAILABLE)
+                    .arg(server_name)
+                    .arg(ex.what());
+                partner_journal_id_.clear();
+                asyncSyncLeases(http_client, server_name, max_period, LeasePtr(),
+                                post_sync_action, true);
+                return;
+            }
+
+            const auto& changes_element = changes->listValue();
+
+            LOG_INFO(ha_logger, HA_LEASES_SYNC_CHANGES_RECEIVED)
+                .arg(changes_element.size())
+                .arg(server_name);
+
+            uint64_t last_sequence = from_sequence;
+            for (auto c = changes_element.begin(); c != changes_element.end(); ++c) {
+                try {
+                    last_sequence = std::max(last_sequence, applySyncedLeaseChange(*c));
+
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                        .arg((*c)->str())
+                        .arg(ex.what());
+                }
+            }
+
+            // The next synchronization continues from there.
+            partner_journal_sequence_ = last_sequence;
+
+            // Fetch the next page of changes.
+            if ((changes_element.size() >= config_->getSyncPageLimit()) &&
+                (last_sequence > from_sequence)) {
+                asyncSyncLeaseChanges(http_client, server_name, max_period,
+                                      last_sequence, post_sync_action, true);
+                return;
+            }
+
             if (post_sync_action) {
-                post_sync_action(error_message.empty(),
-                                 error_message,
-                                 dhcp_disabled);
+                post_sync_action(true, "", true);
             }
     }, HttpClient::RequestTimeout(config_->getSyncTimeout()));
 }
 
+void
+HAService::syncPartitionComplete(const SyncContextPtr& context,
+                                 const std::string& error_message) {
+    // Only the first error is reported.
+    if (!error_message.empty() && context->error_message_.empty()) {
+        context->error_message_ = error_message;
+    }
+
+    if (--context->pending_ > 0) {
+        return;
+    }
+
+    context->stopwatch_.stop();
+
+    if (context->error_message_.empty()) {
+        // Leases per second, with the duration in microseconds so that
+        // fast synchronizations are also reported.
+        const long duration = std::max(context->stopwatch_.getTotalMicroseconds(), 1L);
+        const uint64_t throughput = context->leases_ * 1000000 / duration;
+        LOG_INFO(ha_logger, HA_SYNC_THROUGHPUT)
+            .arg(context->leases_)
+            .arg(context->server_name_)
+            .arg(context->stopwatch_.logFormatTotalDuration())
+            .arg(throughput);
+        StatsMgr::instance().setValue("ha-sync-throughput",
+                                      static_cast<int64_t>(throughput));
+    }
+
+    // Invoke post synchronization action if it was specified.
+    if (context->post_sync_action_) {
+        context->post_sync_action_(context->error_message_.empty(),
+                                   context->error_message_,
+                                   context->dhcp_disabled_);
+    }
+}
+
 ConstElementPtr
 HAService::processSynchronize(const std::string& server_name,
                               const unsigned int max_period) {
@@ -1403,11 +2133,12 @@ int
 HAService::synchronize(std::string& status_message, const std::string& server_name,
                        const unsigned int max_period) {
     IOService io_service;
-    HttpClient client(io_service);
+    // Use a connection for each address range synchronized in parallel.
+    HttpClient client(io_service, config_->getSyncPartitions());
 
-    asyncSyncLeases(client, server_name, max_period, Lease4Ptr(),
-                    [&](const bool success, const std::string& error_message,
-                        const bool dhcp_disabled) {
+    PostSyncCallback post_sync_action =
+        [&](const bool success, const std::string& error_message,
+            const bool dhcp_disabled) {
         // If there was a fatal error while fetching the leases, let's
         // log an error message so as it can be included in the response
         // to the controlling client.
@@ -1440,10 +2171,25 @@ HAService::synchronize(std::string& status_message, const std::string& server_na
             // service.
             io_service.stop();
         }
-    });
+    };
 
     LOG_INFO(ha_logger, HA_SYNC_START).arg(server_name);
 
+    // Only fetch the lease changes missed since the last known position
+    // in the partner's lease journal if there is one.
+    if (!partner_journal_id_.empty() &&
+        (server_name == config_->getFailoverPeerConfig()->getName())) {
+        LOG_INFO(ha_logger, HA_SYNC_JOURNAL_START)
+            .arg(server_name)
+            .arg(partner_journal_sequence_);
+        asyncSyncLeaseChanges(client, server_name, max_period,
+                              partner_journal_sequence_, post_sync_action);
+
+    } else {
+        asyncSyncLeases(client, server_name, max_period, Lease4Ptr(),
+                        post_sync_action);
+    }
+
     // Measure duration of the synchronization.
     Stopwatch stopwatch;
 
@@ -10,7 +10,10 @@
 #include <communication_state.h>
 #include <ha_config.h>
 #include <ha_server_type.h>
+#include <lease_journal.h>
 #include <query_filter.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_address.h>
 #include <asiolink/io_service.h>
 #include <cc/data.h>
 #include <dhcp/pkt4.h>
@@ -21,10 +24,15 @@
 #include <hooks/parking_lots.h>
 #include <http/client.h>
 #include <util/state_model.h>
+#include <util/stopwatch.h>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <functional>
+#include <list>
 #include <map>
+#include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace isc {
@@ -68,6 +76,43 @@ protected:
     /// re-enabled.
     typedef std::function<void(const bool, const std::string&, const bool)> PostSyncCallback;
 
+    /// @brief Address range synchronized with its own sequence of pages.
+    ///
+    /// The first address follows the last address of the previous page
+    /// and is excluded from the range. The second address is the last
+    /// address of the range.
+    typedef std::pair<asiolink::IOAddress, asiolink::IOAddress> SyncPartition;
+
+    /// @brief State of a lease database synchronization shared by the
+    /// address ranges fetched in parallel.
+    struct SyncContext {
+        /// @brief Constructor.
+        ///
+        /// @param server_name name of the server to fetch leases from.
+        /// @param post_sync_action function to be executed when all ranges
+        /// are synchronized.
+        /// @param dhcp_disabled indicates if the DHCP service of the
+        /// partner is already disabled.
+        SyncContext(const std::string& server_name,
+                    const PostSyncCallback& post_sync_action,
+                    const bool dhcp_disabled)
+            : server_name_(server_name), post_sync_action_(post_sync_action),
+              pending_(0), error_message_(), dhcp_disabled_(dhcp_disabled),
+              leases_(0), stopwatch_() {
+        }
+
+        std::string server_name_;           ///< Server to fetch leases from.
+        PostSyncCallback post_sync_action_; ///< Executed when complete.
+        size_t pending_;                    ///< Ranges being synchronized.
+        std::string error_message_;         ///< First error encountered.
+        bool dhcp_disabled_;                ///< Partner's DHCP disabled?
+        uint64_t leases_;                   ///< Leases received.
+        util::Stopwatch stopwatch_;         ///< Measures the duration.
+    };
+
+    /// @brief Pointer to the @c SyncContext.
+    typedef boost::shared_ptr<SyncContext> SyncContextPtr;
+
 public:
 
     /// @brief Constructor.
@@ -450,6 +495,71 @@ protected:
                               const data::ConstElementPtr& command,
                               const hooks::ParkingLotHandlePtr& parking_lot);
 
+    /// @brief Adds lease updates to the batch of lease updates to the peer.
+    ///
+    /// This method is used instead of @c asyncSendLeaseUpdate when batching
+    /// of the lease updates is enabled. The batch is sent when it holds the
+    /// configured maximum number of leases or when the batch window elapses.
+    /// The query is unparked when the batches holding its lease updates
+    /// have been acknowledged.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param config Pointer to the configuration of the server to which the
+    /// lease updates should be sent.
+    /// @param leases Pointer to a collection of the newly allocated or
+    /// updated leases.
+    /// @param deleted_leases Pointer to a collection of the released leases.
+    /// @param [out] parking_lot Parking lot where the query is parked.
+    /// @tparam QueryPtrType Type of the pointer to the DHCP client's message,
+    /// i.e. Pkt4Ptr or Pkt6Ptr.
+    /// @tparam LeaseCollectionPtrType Type of the pointer to the collections
+    /// of leases, i.e. Lease4CollectionPtr or Lease6CollectionPtr.
+    template<typename QueryPtrType, typename LeaseCollectionPtrType>
+    void batchLeaseUpdates(const QueryPtrType& query,
+                           const HAConfig::PeerConfigPtr& config,
+                           const LeaseCollectionPtrType& leases,
+                           const LeaseCollectionPtrType& deleted_leases,
+                           const hooks::ParkingLotHandlePtr& parking_lot);
+
+    /// @brief Completes the pending batch of lease updates to the peer.
+    ///
+    /// The batch is queued behind the batches waiting to be sent and the
+    /// waiting batches are sent as the window of outstanding batches allows.
+    /// It does nothing if there is no pending batch for the peer.
+    ///
+    /// @param peer_name Name of the peer.
+    void asyncSendLeaseUpdateBatch(const std::string& peer_name);
+
+    /// @brief Sends the waiting batches of lease updates to the peer.
+    ///
+    /// The batches are sent in order while fewer than the configured
+    /// maximum number of batches are outstanding. A batch holding an
+    /// address of an outstanding batch waits for the response to that
+    /// batch: the peer may process the requests received over different
+    /// connections in any order.
+    ///
+    /// @param peer_name Name of the peer.
+    void sendWaitingLeaseUpdateBatches(const std::string& peer_name);
+
+    /// @brief Handles the result of the lease updates of a query.
+    ///
+    /// If the lease updates were sent to a partner and failed, the query is
+    /// dropped. Otherwise the query is unparked when all its lease updates
+    /// have completed.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param config Pointer to the configuration of the server to which the
+    /// lease updates were sent.
+    /// @param success Indicates if the lease updates were successful.
+    /// @param [out] parking_lot Parking lot where the query is parked.
+    /// @tparam QueryPtrType Type of the pointer to the DHCP client's message,
+    /// i.e. Pkt4Ptr or Pkt6Ptr.
+    template<typename QueryPtrType>
+    void leaseUpdateComplete(const QueryPtrType& query,
+                             const HAConfig::PeerConfigPtr& config,
+                             const bool success,
+                             const hooks::ParkingLotHandlePtr& parking_lot);
+
     /// @brief Checks if the lease updates should be sent as result of leases
     /// allocation or release.
     ///
@@ -462,6 +572,33 @@ protected:
     /// @return true if the server should send lease updates, false otherwise.
     bool shouldSendLeaseUpdates(const HAConfig::PeerConfigPtr& peer_config) const;
 
+    /// @brief Records lease changes in the lease journal.
+    ///
+    /// It does nothing if the lease journal is disabled.
+    ///
+    /// @param leases Pointer to a collection of the newly allocated or
+    /// updated leases.
+    /// @param deleted_leases Pointer to a collection of the released leases.
+    /// @tparam LeaseCollectionPtrType Type of the pointer to the collections
+    /// of leases, i.e. Lease4CollectionPtr or Lease6CollectionPtr.
+    /// @return Sequence number of the first recorded change or 0 if no
+    /// change was recorded.
+    template<typename LeaseCollectionPtrType>
+    uint64_t journalLeaseChanges(const LeaseCollectionPtrType& leases,
+                                 const LeaseCollectionPtrType& deleted_leases);
+
+    /// @brief Returns the sequence number of the last lease change known
+    /// to the partner.
+    ///
+    /// The changes up to the first change of the queries with lease
+    /// updates still in progress have been acknowledged by the partner.
+    /// The changes following a failed lease update are not confirmed
+    /// until the partner fetches them from the journal.
+    ///
+    /// @return Sequence number in the lease journal. The lease journal
+    /// must be enabled.
+    uint64_t getConfirmedJournalSequence() const;
+
 public:
 
     /// @brief Processes ha-heartbeat command and returns a response.
@@ -489,11 +626,61 @@ public:
     /// @return Pointer to the response to the heartbeat.
     data::ConstElementPtr processHeartbeat();
 
+    /// @brief Processes ha-journal-get command and returns a response.
+    ///
+    /// This command is sent by the partner returning after an outage to
+    /// fetch the lease changes it has missed. The response contains the
+    /// changes in the following format:
+    ///
+    /// @code
+    /// {
+    ///     "arguments": {
+    ///         "journal-id": "58a1f0c2d3e40-1",
+    ///         "changes": [
+    ///             {
+    ///                 "sequence": 1024,
+    ///                 "operation": "update",
+    ///                 "lease": { ... }
+    ///             }
+    ///         ]
+    ///     },
+    ///     "result": 0,
+    ///     "text": "1 lease changes returned."
+    /// }
+    /// @endcode
+    ///
+    /// An error is returned if the lease journal is disabled, if it is not
+    /// the journal known to the partner or if the changes following the
+    /// specified sequence number are no longer available. The partner then
+    /// fetches all leases.
+    ///
+    /// @param journal_id identifier of the lease journal known to the
+    /// partner.
+    /// @param from_sequence sequence number of the last lease change known
+    /// to the partner.
+    /// @param limit maximum number of changes to return.
+    /// @return Pointer to the response to the ha-journal-get command.
+    data::ConstElementPtr processJournalGet(const std::string& journal_id,
+                                            const uint64_t from_sequence,
+                                            const uint32_t limit);
+
 protected:
 
     /// @brief Starts asynchronous heartbeat to a peer.
     void asyncSendHeartbeat();
 
+    /// @brief Remembers the position in the partner's lease journal
+    /// returned in response to a heartbeat.
+    ///
+    /// The position is only updated while both servers are in the
+    /// load-balancing or hot-standby state, i.e. when this server receives
+    /// the lease updates from the partner. It is used to fetch the lease
+    /// changes following it during the next synchronization. It is
+    /// cleared if the partner doesn't return it.
+    ///
+    /// @param args arguments of the response to the heartbeat.
+    void updatePartnerJournal(const data::ConstElementPtr& args);
+
     /// @brief Schedules asynchronous heartbeat to a peer if it is not scheduled.
     ///
     /// The heartbeat will be sent according to the value of the heartbeat-delay
@@ -559,6 +746,12 @@ protected:
     /// @brief Asynchronously reads leases from a peer and updates local
     /// lease database using a provided client instance.
     ///
+    /// The address space is split into the number of ranges specified
+    /// with the @c sync-partitions parameter, along the configured subnets.
+    /// The leases of each range are fetched in parallel with sequences
+    /// of pages. The HTTP client should allow as many connections with
+    /// the peer as there are ranges, otherwise the requests are queued.
+    ///
     /// This method first sends dhcp-disable command to the server from which
     /// it will be fetching leases to disable its DHCP function while database
     /// synchronization is in progress. If the command is successful, it then
@@ -574,11 +767,9 @@ protected:
     /// longer period of time. If the synchronization is progressing the
     /// timeout must be deferred.
     ///
-    /// The @c asyncSyncLeases method calls itself (recurses) when the previous
-    /// @c lease4-get-page or @c lease6-get-page command has completed
-    /// successfully. If the last page of leases was fetched or if any
-    /// error occurred, the synchronization is terminated and the
-    /// @c post_sync_action callback is invoked.
+    /// When all ranges have been fetched or if any error occurred, the
+    /// synchronization is terminated and the @c post_sync_action callback
+    /// is invoked.
     ///
     /// The last parameter passed to the @c post_sync_action callback indicates
     /// whether this server has successfully disabled DHCP service on
@@ -595,10 +786,8 @@ protected:
     /// @param server_name name of the server to fetch leases from.
     /// @param max_period maximum number of seconds to disable DHCP service
     /// @param last_lease Pointer to the last lease returned on the previous
-    /// page of leases. This lease is used to set the value of the "from"
-    /// parameter in the @c lease4-get-page and @c lease6-get-page commands. If this
-    /// command is sent to fetch the first page, the @c last_lease parameter
-    /// should be set to null.
+    /// page of leases. If it is not null, the leases following this lease
+    /// are fetched in a single range. It should be null to fetch all leases.
     /// @param post_sync_action pointer to the function to be executed when
     /// lease database synchronization is complete. If this is null, no
     /// post synchronization action is invoked.
@@ -613,39 +802,141 @@ protected:
                          PostSyncCallback post_sync_action,
                          const bool dhcp_disabled = false);
 
+    /// @brief Returns the address ranges synchronized in parallel.
+    ///
+    /// The ranges start with the first addresses of the configured subnets,
+    /// picked evenly. The first range starts with the zero address and the
+    /// last range ends with the highest address, so that the ranges cover
+    /// the whole address space. There is a single range when there is
+    /// one partition configured or when there are no subnets.
+    ///
+    /// @return ranges ordered by addresses.
+    std::vector<SyncPartition> getSyncPartitions() const;
+
+    /// @brief Schedules fetching of the next page of leases of a range.
+    ///
+    /// This method sends @c dhcp-disable command to the partner and then
+    /// calls @c HAService::asyncSyncLeasesInternal.
+    ///
+    /// @param http_client reference to the client to be used to communicate
+    /// with the other server.
+    /// @param server_name name of the server to fetch leases from.
+    /// @param max_period maximum number of seconds to disable DHCP service
+    /// @param partition address range. Its first address is the last
+    /// address of the previous page.
+    /// @param context synchronization state shared by the ranges.
+    void asyncSyncPartition(http::HttpClient& http_client,
+                            const std::string& server_name,
+                            const unsigned int max_period,
+                            const SyncPartition& partition,
+                            const SyncContextPtr& context);
+
     /// @brief Implements fetching one page of leases during synchronization.
     ///
     /// This method implements the actual lease fetching from the partner
     /// and synchronization of the database. It excludes sending @c dhcp-disable
-    /// command. This command is sent by @c HAService::asyncSyncLeases.
+    /// command. This command is sent by @c HAService::asyncSyncPartition.
     ///
     /// When the page of leases is successfully synchronized, this method
-    /// will call @c HAService::asyncSyncLeases to schedule synchronization of
-    /// the next page of leases.
+    /// will call @c HAService::asyncSyncPartition to schedule synchronization
+    /// of the next page of leases in the range.
     ///
     /// @param http_client reference to the client to be used to communicate
     /// with the other server.
     /// @param server_name name of the server to fetch leases from.
     /// @param max_period maximum number of seconds to disable DHCP service
-    /// @param last_lease Pointer to the last lease returned on the previous
-    /// page of leases. This lease is used to set the value of the "from"
-    /// parameter in the lease4-get-page and lease6-get-page commands. If this
-    /// command is sent to fetch the first page, the @c last_lease parameter
-    /// should be set to null.
-    /// @param post_sync_action pointer to the function to be executed when
-    /// lease database synchronization is complete. If this is null, no
-    /// post synchronization action is invoked.
-    /// @param dhcp_disabled Boolean flag indicating if the remote DHCP
-    /// server is disabled. This flag propagates down to the
-    /// @c post_sync_action to indicate whether the DHCP service has to
-    /// be enabled after the leases synchronization.
+    /// @param partition address range. Its first address is the last
+    /// address of the previous page.
+    /// @param context synchronization state shared by the ranges.
     void asyncSyncLeasesInternal(http::HttpClient& http_client,
                                  const std::string& server_name,
                                  const unsigned int max_period,
-                                 const dhcp::LeasePtr& last_lease,
-                                 PostSyncCallback post_sync_action,
-                                 const bool dhcp_disabled);
+                                 const SyncPartition& partition,
+                                 const SyncContextPtr& context);
+
+    /// @brief Records the completion of the synchronization of a range.
+    ///
+    /// When the last range completes, it logs the synchronization
+    /// throughput and invokes the post synchronization action.
+    ///
+    /// @param context synchronization state shared by the ranges.
+    /// @param error_message error message or empty string if the range
+    /// was synchronized successfully.
+    void syncPartitionComplete(const SyncContextPtr& context,
+                               const std::string& error_message);
+
+    /// @brief Asynchronously fetches the lease changes following a
+    /// sequence number from the partner's lease journal and updates
+    /// local lease database.
+    ///
+    /// This method sends dhcp-disable command to the partner and then
+    /// calls @c HAService::asyncSyncLeaseChangesInternal. If the changes
+    /// are no longer available, it falls back to fetching all leases with
+    /// @c HAService::asyncSyncLeases.
+    ///
+    /// @param http_client reference to the client to be used to communicate
+    /// with the other server.
+    /// @param server_name name of the server to fetch lease changes from.
+    /// @param max_period maximum number of seconds to disable DHCP service
+    /// @param from_sequence sequence number of the last change known to
+    /// this server.
+    /// @param post_sync_action pointer to the function to be executed when
+    /// lease database synchronization is complete.
+    /// @param dhcp_disabled Boolean flag indicating if the remote DHCP
+    /// server is disabled.
+    void asyncSyncLeaseChanges(http::HttpClient& http_client,
+                               const std::string& server_name,
+                               const unsigned int max_period,
+                               const uint64_t from_sequence,
+                               PostSyncCallback post_sync_action,
+                               const bool dhcp_disabled = false);
 
+    /// @brief Implements fetching one page of lease changes during
+    /// synchronization.
+    ///
+    /// When a full page of changes is received, this method calls
+    /// @c HAService::asyncSyncLeaseChanges to fetch the next page.
+    ///
+    /// @param http_client reference to the client to be used to communicate
+    /// with the other server.
+    /// @param server_name name of the server to fetch lease changes from.
+    /// @param max_period maximum number of seconds to disable DHCP service
+    /// @param from_sequence sequence number of the last change known to
+    /// this server.
+    /// @param post_sync_action pointer to the function to be executed when
+    /// lease database synchronization is complete.
+    void asyncSyncLeaseChangesInternal(http::HttpClient& http_client,
+                                       const std::string& server_name,
+                                       const unsigned int max_period,
+                                       const uint64_t from_sequence,
+                                       PostSyncCallback post_sync_action);
+
+    /// @brief Applies a lease change fetched from the partner to the local
+    /// lease database.
+    ///
+    /// @param change lease change returned in response to ha-journal-get.
+    /// @return Sequence number of the change.
+    /// @throw BadValue if the change is malformed.
+    uint64_t applySyncedLeaseChange(const data::ConstElementPtr& change);
+
+    /// @brief Inserts or updates a lease fetched from the partner in the
+    /// local lease database.
+    ///
+    /// The lease is not updated if the instance in the local database is
+    /// newer (based on cltt).
+    ///
+    /// @param lease_element lease in the JSON format.
+    /// @return Pointer to the fetched lease.
+    dhcp::LeasePtr updateSyncedLease(const data::ConstElementPtr& lease_element);
+
+    /// @brief Deletes a lease deleted by the partner from the local lease
+    /// database.
+    ///
+    /// The lease is not deleted if the instance in the local database is
+    /// newer (based on cltt).
+    ///
+    /// @param lease_element deleted lease in the JSON format.
+    void deleteSyncedLease(const data::ConstElementPtr& lease_element);
 
 public:
 
@@ -746,6 +1037,95 @@ protected:
     /// the number of responses received so far and unpark the packet when
     /// all responses have been received. That's what this map is used for.
     std::map<boost::shared_ptr<dhcp::Pkt>, int> pending_requests_;
+
+    /// @brief Journal of the lease changes sent to the peers.
+    ///
+    /// It is null if the journal is disabled.
+    LeaseJournalPtr lease_journal_;
+
+    /// @brief Sequence numbers of the first lease changes of the queries
+    /// with lease updates in progress.
+    std::map<boost::shared_ptr<dhcp::Pkt>, uint64_t> unconfirmed_changes_;
+
+    /// @brief Sequence number of the first lease change of a query with
+    /// failed lease updates.
+    ///
+    /// The partner may have missed this change, so the changes confirmed
+    /// to the partner stop before it. It is 0 if there is no such change.
+    uint64_t failed_journal_sequence_;
+
+    /// @brief Identifier of the partner's lease journal.
+    ///
+    /// It is empty if the position in the partner's journal is unknown.
+    std::string partner_journal_id_;
+
+    /// @brief Sequence number of the last lease change received from the
+    /// partner.
+    uint64_t partner_journal_sequence_;
+
+    /// @brief Lease updates of a query held in a batch.
+    struct BatchedQuery {
+        /// @brief Addresses of the leases of the query.
+        std::set<std::string> addresses_;
+
+        /// @brief Function invoked when the batch completes.
+        ///
+        /// The first argument indicates if the lease updates of the query
+        /// were successful. The second argument holds an error message to
+        /// be logged, if any.
+        std::function<void(const bool, const std::string&)> complete_;
+    };
+
+    /// @brief Lease updates to a peer waiting to be sent in one request.
+    struct LeaseUpdateBatch {
+        /// @brief Configuration of the peer.
+        HAConfig::PeerConfigPtr config_;
+
+        /// @brief Leases to be created or updated.
+        data::ElementPtr leases_;
+
+        /// @brief Leases to be deleted.
+        data::ElementPtr deleted_leases_;
+
+        /// @brief Addresses of the leases in the batch.
+        ///
+        /// An address appears at most once in a batch so the peer applies
+        /// the changes of an address in the order they were made and its
+        /// failures map to a single query.
+        std::set<std::string> addresses_;
+
+        /// @brief Queries waiting for the batch.
+        std::vector<BatchedQuery> queries_;
+
+        /// @brief Timer sending the batch when the batch window elapses.
+        asiolink::IntervalTimerPtr timer_;
+    };
+
+    /// @brief Pointer to a batch of lease updates.
+    typedef boost::shared_ptr<LeaseUpdateBatch> LeaseUpdateBatchPtr;
+
+    /// @brief Batches of lease updates to a peer.
+    struct PeerLeaseUpdateBatches {
+        /// @brief Batch collecting the lease updates.
+        LeaseUpdateBatchPtr pending_;
+
+        /// @brief Complete batches waiting to be sent, oldest first.
+        std::list<LeaseUpdateBatchPtr> waiting_;
+
+        /// @brief Number of batches sent and not yet acknowledged.
+        size_t outstanding_;
+
+        /// @brief Addresses of the leases in the outstanding batches.
+        std::multiset<std::string> outstanding_addresses_;
+
+        /// @brief Constructor.
+        PeerLeaseUpdateBatches()
+            : pending_(), waiting_(), outstanding_(0), outstanding_addresses_() {
+        }
+    };
+
+    /// @brief Batches of lease updates by peer name.
+    std::map<std::string, PeerLeaseUpdateBatches> lease_update_batches_;
 };
 
 /// @brief Pointer to the @c HAService class.
@@ -0,0 +1,108 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <lease_journal.h>
+#include <exceptions/exceptions.h>
+#include <chrono>
+#include <sstream>
+
+using namespace isc::dhcp;
+
+namespace isc {
+namespace ha {
+
+LeaseJournal::LeaseJournal(const size_t max_entries)
+    : max_entries_(max_entries), id_(generateId()), last_sequence_(0),
+      entries_() {
+}
+
+uint64_t
+LeaseJournal::record(const Operation& operation, const Lease4& lease) {
+    return (record(operation, LeasePtr(new Lease4(lease))));
+}
+
+uint64_t
+LeaseJournal::record(const Operation& operation, const Lease6& lease) {
+    return (record(operation, LeasePtr(new Lease6(lease))));
+}
+
+uint64_t
+LeaseJournal::record(const Operation& operation, const LeasePtr& lease) {
+    Entry entry;
+    entry.sequence_ = ++last_sequence_;
+    entry.operation_ = operation;
+    entry.lease_ = lease;
+    entries_.push_back(entry);
+
+    while (entries_.size() > max_entries_) {
+        entries_.pop_front();
+    }
+
+    return (last_sequence_);
+}
+
+bool
+LeaseJournal::getChanges(const uint64_t from_sequence, const size_t limit,
+                         std::vector<Entry>& changes) const {
+    if (from_sequence > last_sequence_) {
+        return (false);
+    }
+
+    // The sequence numbers of the retained changes are consecutive.
+    const uint64_t first_sequence = getFirstSequence();
+    if (from_sequence + 1 < first_sequence) {
+        return (false);
+    }
+
+    for (size_t i = from_sequence + 1 - first_sequence;
+         (i < entries_.size()) && (changes.size() < limit); ++i) {
+        changes.push_back(entries_[i]);
+    }
+
+    return (true);
+}
+
+void
+LeaseJournal::reset() {
+    entries_.clear();
+    id_ = generateId();
+}
+
+std::string
+LeaseJournal::operationToString(const Operation& operation) {
+    return (operation == OP_DELETE ? "delete" : "update");
+}
+
+LeaseJournal::Operation
+LeaseJournal::stringToOperation(const std::string& operation) {
+    if (operation == "update") {
+        return (OP_UPDATE);
+
+    } else if (operation == "delete") {
+        return (OP_DELETE);
+    }
+
+    isc_throw(BadValue, "unsupported lease change operation '" << operation
+              << "'");
+}
+
+std::string
+LeaseJournal::generateId() {
+    // The counter makes identifiers generated within the same microsecond
+    // distinct.
+    static uint64_t counter = 0;
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    std::ostringstream s;
+    s << std::hex
+      << std::chrono::duration_cast<std::chrono::microseconds>(now).count()
+      << "-" << ++counter;
+    return (s.str());
+}
+
+} // end of namespace isc::ha
+} // end of namespace isc
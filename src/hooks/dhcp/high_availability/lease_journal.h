@@ -0,0 +1,170 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef HA_LEASE_JOURNAL_H
+#define HA_LEASE_JOURNAL_H
+
+#include <dhcpsrv/lease.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace ha {
+
+/// @brief Bounded in-memory journal of the lease changes.
+///
+/// The server records the leases it sends to its partner in lease
+/// updates in this journal. Each change is given a sequence number,
+/// incremented by one for each change. The partner remembers the last
+/// sequence number it is known to have received and, when it returns
+/// after a short outage, it fetches the changes following this sequence
+/// number rather than the entire lease database.
+///
+/// The journal holds a limited number of the most recent changes. When
+/// it is full, the oldest change is discarded and the changes preceding
+/// the retained ones are no longer available. The journal is also
+/// identified by an identifier generated when it is created or reset,
+/// so that a partner doesn't use the sequence numbers of a journal
+/// which has been lost, e.g. because the server was restarted.
+class LeaseJournal : public boost::noncopyable {
+public:
+
+    /// @brief Type of the lease change.
+    enum Operation {
+        OP_UPDATE,
+        OP_DELETE
+    };
+
+    /// @brief Lease change held in the journal.
+    struct Entry {
+        /// @brief Sequence number of the change.
+        uint64_t sequence_;
+
+        /// @brief Type of the change.
+        Operation operation_;
+
+        /// @brief Copy of the lease.
+        dhcp::LeasePtr lease_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param max_entries maximum number of changes held in the journal.
+    explicit LeaseJournal(const size_t max_entries);
+
+    /// @brief Records a change of a DHCPv4 lease.
+    ///
+    /// @param operation type of the change.
+    /// @param lease changed lease. The journal holds a copy of it.
+    /// @return sequence number of the change.
+    uint64_t record(const Operation& operation, const dhcp::Lease4& lease);
+
+    /// @brief Records a change of a DHCPv6 lease.
+    ///
+    /// @param operation type of the change.
+    /// @param lease changed lease. The journal holds a copy of it.
+    /// @return sequence number of the change.
+    uint64_t record(const Operation& operation, const dhcp::Lease6& lease);
+
+    /// @brief Returns the changes following a sequence number.
+    ///
+    /// @param from_sequence sequence number of the last change known to
+    /// the caller. It is 0 to get the changes from the first one.
+    /// @param limit maximum number of changes to return.
+    /// @param [out] changes changes with sequence numbers greater than
+    /// @c from_sequence, in order.
+    /// @return false if some changes following @c from_sequence have been
+    /// discarded from the journal or if @c from_sequence is greater than
+    /// the sequence number of the last change, true otherwise.
+    bool getChanges(const uint64_t from_sequence, const size_t limit,
+                    std::vector<Entry>& changes) const;
+
+    /// @brief Discards all changes and generates a new identifier.
+    ///
+    /// This is used when a change may not have reached the partner, so
+    /// that the partner doesn't skip it.
+    void reset();
+
+    /// @brief Returns the identifier of the journal.
+    const std::string& getId() const {
+        return (id_);
+    }
+
+    /// @brief Returns the sequence number of the last recorded change.
+    ///
+    /// Sequence numbers continue across resets. It is 0 if no change
+    /// has been recorded.
+    uint64_t getLastSequence() const {
+        return (last_sequence_);
+    }
+
+    /// @brief Returns the sequence number of the oldest retained change.
+    ///
+    /// It is the sequence number of the next change if the journal is
+    /// empty.
+    uint64_t getFirstSequence() const {
+        return (entries_.empty() ? last_sequence_ + 1 : entries_.front().sequence_);
+    }
+
+    /// @brief Returns the number of changes held in the journal.
+    size_t size() const {
+        return (entries_.size());
+    }
+
+    /// @brief Returns the maximum number of changes held in the journal.
+    size_t getMaxEntries() const {
+        return (max_entries_);
+    }
+
+    /// @brief Returns the textual representation of the type of a change.
+    ///
+    /// @param operation type of the change.
+    /// @return "update" or "delete".
+    static std::string operationToString(const Operation& operation);
+
+    /// @brief Returns the type of a change from its textual representation.
+    ///
+    /// @param operation "update" or "delete".
+    /// @return type of the change.
+    /// @throw BadValue if the type is not supported.
+    static Operation stringToOperation(const std::string& operation);
+
+private:
+
+    /// @brief Records a change.
+    ///
+    /// @param operation type of the change.
+    /// @param lease copy of the changed lease.
+    /// @return sequence number of the change.
+    uint64_t record(const Operation& operation, const dhcp::LeasePtr& lease);
+
+    /// @brief Generates a new journal identifier.
+    static std::string generateId();
+
+    /// @brief Maximum number of changes held in the journal.
+    size_t max_entries_;
+
+    /// @brief Identifier of the journal.
+    std::string id_;
+
+    /// @brief Sequence number of the last recorded change.
+    uint64_t last_sequence_;
+
+    /// @brief Recorded changes, the oldest first.
+    std::deque<Entry> entries_;
+};
+
+/// @brief Pointer to the @c LeaseJournal.
+typedef boost::shared_ptr<LeaseJournal> LeaseJournalPtr;
+
+} // end of namespace isc::ha
+} // end of namespace isc
+
+#endif
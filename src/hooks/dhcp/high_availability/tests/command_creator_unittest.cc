@@ -200,6 +200,31 @@ TEST(CommandCreatorTest, createLease4Delete) {
     EXPECT_EQ(lease_as_json->str(), arguments->str());
 }
 
+// This test verifies that the lease4-bulk-apply command is correct.
+TEST(CommandCreatorTest, createLease4BulkApply) {
+    ElementPtr leases = Element::createList();
+    leases->add(CommandCreator::createLeaseBulkApplyEntry(*createLease4()));
+    ElementPtr deleted_leases = Element::createList();
+    ConstElementPtr command =
+        CommandCreator::createLeaseBulkApply(leases, deleted_leases,
+                                             HAServerType::DHCPv4);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-bulk-apply",
+                                              "dhcp4", arguments));
+
+    ConstElementPtr deleted = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted);
+    ASSERT_EQ(Element::list, deleted->getType());
+    EXPECT_EQ(0, deleted->size());
+
+    ConstElementPtr updated = arguments->get("leases");
+    ASSERT_TRUE(updated);
+    ASSERT_EQ(Element::list, updated->getType());
+    ASSERT_EQ(1, updated->size());
+    ElementPtr lease_as_json = leaseAsJson(createLease4());
+    EXPECT_EQ(lease_as_json->str(), updated->get(0)->str());
+}
+
 // This test verifies that the lease4-get-all command is correct.
 TEST(CommandCreatorTest, createLease4GetAll) {
     ConstElementPtr command = CommandCreator::createLease4GetAll();
@@ -255,6 +280,64 @@ TEST(CommandCreatorTest, createLease4GetPageZeroLimit) {
     EXPECT_THROW(CommandCreator::createLease4GetPage(lease4, 0), BadValue);
 }
 
+// This test verifies that the leaseX-get-page command fetching an address
+// range is correct.
+TEST(CommandCreatorTest, createLeaseGetPageRange) {
+    ConstElementPtr command =
+        CommandCreator::createLeaseGetPage(IOAddress("0.0.0.0"),
+                                           IOAddress("192.0.2.255"), 20,
+                                           HAServerType::DHCPv4);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-get-page", "dhcp4",
+                                              arguments));
+    ASSERT_TRUE(arguments->get("from"));
+    EXPECT_EQ("start", arguments->get("from")->stringValue());
+    ASSERT_TRUE(arguments->get("to"));
+    EXPECT_EQ("192.0.2.255", arguments->get("to")->stringValue());
+    ASSERT_TRUE(arguments->get("limit"));
+    EXPECT_EQ(20, arguments->get("limit")->intValue());
+
+    // The upper bound is omitted for the last range.
+    command = CommandCreator::createLeaseGetPage(IOAddress("2001:db8:1::ffff"),
+                                                 IOAddress("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"),
+                                                 5, HAServerType::DHCPv6);
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-get-page", "dhcp6",
+                                              arguments));
+    ASSERT_TRUE(arguments->get("from"));
+    EXPECT_EQ("2001:db8:1::ffff", arguments->get("from")->stringValue());
+    EXPECT_FALSE(arguments->get("to"));
+
+    // Zero limit and addresses of the other family are rejected.
+    EXPECT_THROW(CommandCreator::createLeaseGetPage(IOAddress("0.0.0.0"),
+                                                    IOAddress("192.0.2.255"), 0,
+                                                    HAServerType::DHCPv4),
+                 BadValue);
+    EXPECT_THROW(CommandCreator::createLeaseGetPage(IOAddress("::"),
+                                                    IOAddress("2001:db8::1"), 5,
+                                                    HAServerType::DHCPv4),
+                 BadValue);
+}
+
+// This test verifies that the ha-journal-get command is correct.
+TEST(CommandCreatorTest, createJournalGet) {
+    ConstElementPtr command = CommandCreator::createJournalGet("journal1", 12, 100,
+                                                               HAServerType::DHCPv6);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "ha-journal-get", "dhcp6",
+                                              arguments));
+    ASSERT_TRUE(arguments->get("journal-id"));
+    EXPECT_EQ("journal1", arguments->get("journal-id")->stringValue());
+    ASSERT_TRUE(arguments->get("from-sequence"));
+    EXPECT_EQ(12, arguments->get("from-sequence")->intValue());
+    ASSERT_TRUE(arguments->get("limit"));
+    EXPECT_EQ(100, arguments->get("limit")->intValue());
+
+    // Zero limit is rejected.
+    EXPECT_THROW(CommandCreator::createJournalGet("journal1", 12, 0,
+                                                  HAServerType::DHCPv4),
+                 BadValue);
+}
+
 // This test verifies that the dhcp-disable command (DHCPv6 case) is
 // correct.
 TEST(CommandCreatorTest, createDHCPDisable6) {
@@ -303,6 +386,31 @@ TEST(CommandCreatorTest, createLease6Delete) {
     EXPECT_EQ(lease_as_json->str(), arguments->str());
 }
 
+// This test verifies that the lease6-bulk-apply command is correct.
+TEST(CommandCreatorTest, createLease6BulkApply) {
+    ElementPtr leases = Element::createList();
+    ElementPtr deleted_leases = Element::createList();
+    deleted_leases->add(CommandCreator::createLeaseBulkApplyEntry(*createLease6()));
+    ConstElementPtr command =
+        CommandCreator::createLeaseBulkApply(leases, deleted_leases,
+                                             HAServerType::DHCPv6);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-bulk-apply",
+                                              "dhcp6", arguments));
+
+    ConstElementPtr deleted = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted);
+    ASSERT_EQ(Element::list, deleted->getType());
+    ASSERT_EQ(1, deleted->size());
+    ElementPtr lease_as_json = leaseAsJson(createLease6());
+    EXPECT_EQ(lease_as_json->str(), deleted->get(0)->str());
+
+    ConstElementPtr updated = arguments->get("leases");
+    ASSERT_TRUE(updated);
+    ASSERT_EQ(Element::list, updated->getType());
+    EXPECT_EQ(0, updated->size());
+}
+
 // This test verifies that the lease6-get-all command is correct.
 TEST(CommandCreatorTest, createLease6GetAll) {
     ConstElementPtr command = CommandCreator::createLease6GetAll();
@@ -69,6 +69,15 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
         "        \"sync-leases\": false,"
         "        \"sync-timeout\": 20000,"
         "        \"sync-page-limit\": 3,"
+        "        \"sync-partitions\": 4,"
+        "        \"lease-journal-size\": 500,"
+        "        \"lease-update-batch-size\": 50,"
+        "        \"lease-update-batch-window\": 4,"
+        "        \"lease-update-max-outstanding-batches\": 2,"
+        "        \"http-max-connections\": 3,"
+        "        \"http-pipeline-depth\": 2,"
+        "        \"max-parked-queries\": 1000,"
+        "        \"parked-queries-drop-policy\": \"drop-oldest\","
         "        \"heartbeat-delay\": 8,"
         "        \"max-response-delay\": 11,"
         "        \"max-ack-delay\": 5,"
@@ -119,6 +128,15 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
     EXPECT_FALSE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(20000, impl->getConfig()->getSyncTimeout());
     EXPECT_EQ(3, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(4, impl->getConfig()->getSyncPartitions());
+    EXPECT_EQ(500, impl->getConfig()->getLeaseJournalSize());
+    EXPECT_EQ(50, impl->getConfig()->getLeaseUpdateBatchSize());
+    EXPECT_EQ(4, impl->getConfig()->getLeaseUpdateBatchWindow());
+    EXPECT_EQ(2, impl->getConfig()->getLeaseUpdateMaxOutstandingBatches());
+    EXPECT_EQ(3, impl->getConfig()->getHttpMaxConnections());
+    EXPECT_EQ(2, impl->getConfig()->getHttpPipelineDepth());
+    EXPECT_EQ(1000, impl->getConfig()->getMaxParkedQueries());
+    EXPECT_EQ(ParkingLot::DROP_OLDEST, impl->getConfig()->getParkedQueriesDropPolicy());
     EXPECT_EQ(8, impl->getConfig()->getHeartbeatDelay());
     EXPECT_EQ(11, impl->getConfig()->getMaxResponseDelay());
     EXPECT_EQ(5, impl->getConfig()->getMaxAckDelay());
@@ -225,6 +243,15 @@ TEST_F(HAConfigTest, configureHotStandby) {
     EXPECT_TRUE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(60000, impl->getConfig()->getSyncTimeout());
     EXPECT_EQ(10000, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(1, impl->getConfig()->getSyncPartitions());
+    EXPECT_EQ(10000, impl->getConfig()->getLeaseJournalSize());
+    EXPECT_EQ(0, impl->getConfig()->getLeaseUpdateBatchSize());
+    EXPECT_EQ(10, impl->getConfig()->getLeaseUpdateBatchWindow());
+    EXPECT_EQ(4, impl->getConfig()->getLeaseUpdateMaxOutstandingBatches());
+    EXPECT_EQ(1, impl->getConfig()->getHttpMaxConnections());
+    EXPECT_EQ(1, impl->getConfig()->getHttpPipelineDepth());
+    EXPECT_EQ(0, impl->getConfig()->getMaxParkedQueries());
+    EXPECT_EQ(ParkingLot::DROP_NEW, impl->getConfig()->getParkedQueriesDropPolicy());
     EXPECT_EQ(10000, impl->getConfig()->getHeartbeatDelay());
     EXPECT_EQ(10000, impl->getConfig()->getMaxAckDelay());
     EXPECT_EQ(10, impl->getConfig()->getMaxUnackedClients());
@@ -419,6 +446,141 @@ TEST_F(HAConfigTest, largeHeartbeatDelay) {
         "'heartbeat-delay' must not be greater than 65535");
 }
 
+// Error should be returned when lease-update-max-outstanding-batches is 0.
+TEST_F(HAConfigTest, zeroLeaseUpdateMaxOutstandingBatches) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"lease-update-max-outstanding-batches\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'lease-update-max-outstanding-batches' must be greater than 0");
+}
+
+// Error should be returned when http-max-connections is 0.
+TEST_F(HAConfigTest, zeroHttpMaxConnections) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"http-max-connections\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'http-max-connections' must be greater than 0");
+}
+
+// Error should be returned when http-pipeline-depth is 0.
+TEST_F(HAConfigTest, zeroHttpPipelineDepth) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"http-pipeline-depth\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'http-pipeline-depth' must be greater than 0");
+}
+
+// Error should be returned when sync-partitions is 0.
+TEST_F(HAConfigTest, zeroSyncPartitions) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"sync-partitions\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'sync-partitions' must be greater than 0");
+}
+
+// Error should be returned when parked-queries-drop-policy is invalid.
+TEST_F(HAConfigTest, invalidParkedQueriesDropPolicy) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"parked-queries-drop-policy\": \"drop-all\","
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "unsupported value 'drop-all' for parked-queries-drop-policy parameter");
+}
+
 // There must be at least two servers provided.
 TEST_F(HAConfigTest, singlePeer) {
     testInvalidConfig(
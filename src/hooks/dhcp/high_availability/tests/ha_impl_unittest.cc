@@ -17,6 +17,8 @@
 #include <dhcpsrv/lease.h>
 #include <dhcpsrv/network_state.h>
 #include <hooks/hooks_manager.h>
+#include <hooks/server_hooks.h>
+#include <stats/stats_mgr.h>
 #include <boost/pointer_cast.hpp>
 #include <gtest/gtest.h>
 #include <string>
@@ -28,6 +30,7 @@ using namespace isc::dhcp;
 using namespace isc::ha;
 using namespace isc::ha::test;
 using namespace isc::hooks;
+using namespace isc::stats;
 
 namespace {
 
@@ -375,6 +378,90 @@ TEST_F(HAImplTest, leases4Committed) {
     EXPECT_TRUE(callout_handle->getParkingLotHandlePtr()->drop(query4));
 }
 
+// Tests that the service limits the number of parked queries.
+TEST_F(HAImplTest, startServiceParkingLotLimit) {
+    ServerHooks& server_hooks = ServerHooks::getServerHooks();
+    if (server_hooks.findIndex("leases4_committed") < 0) {
+        server_hooks.registerHook("leases4_committed");
+    }
+
+    TestHAImpl ha_impl;
+    ASSERT_NO_THROW(ha_impl.configure(createValidJsonConfiguration()));
+    ha_impl.config_->setMaxParkedQueries(100);
+    ha_impl.config_->setParkedQueriesDropPolicy("drop-oldest");
+
+    NetworkStatePtr network_state(new NetworkState(NetworkState::DHCPv4));
+    ASSERT_NO_THROW(ha_impl.startService(io_service_, network_state,
+                                         HAServerType::DHCPv4));
+
+    ParkingLotPtr parking_lot = server_hooks.getParkingLotPtr("leases4_committed");
+    EXPECT_EQ(100, parking_lot->getLimit());
+    EXPECT_EQ(ParkingLot::DROP_OLDEST, parking_lot->getDropPolicy());
+    HooksManager::clearParkingLots();
+}
+
+// Tests that leases4_committed callout drops the query when the parking
+// lot is full.
+TEST_F(HAImplTest, leases4CommittedParkingLotFull) {
+    HooksManager::clearParkingLots();
+    StatsMgr::instance().removeAll();
+
+    TestHAImpl ha_impl;
+    ASSERT_NO_THROW(ha_impl.configure(createValidJsonConfiguration()));
+
+    NetworkStatePtr network_state(new NetworkState(NetworkState::DHCPv4));
+    ASSERT_NO_THROW(ha_impl.startService(io_service_, network_state,
+                                         HAServerType::DHCPv4));
+
+    CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
+    ASSERT_TRUE(callout_handle);
+
+    Pkt4Ptr query4 = createMessage4(DHCPREQUEST, 1, 0, 0);
+    callout_handle->setArgument("query4", query4);
+
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    Lease4Ptr lease4(new Lease4(IOAddress("192.1.2.3"), hwaddr,
+                                static_cast<const uint8_t*>(0), 0,
+                                60, 30, 40, 0, 1));
+    Lease4CollectionPtr leases4(new Lease4Collection());
+    leases4->push_back(lease4);
+    callout_handle->setArgument("leases4", leases4);
+
+    Lease4CollectionPtr deleted_leases4(new Lease4Collection());
+    callout_handle->setArgument("deleted_leases4", deleted_leases4);
+
+    // The parking lot of the callout is limited as the service does it
+    // for the leases4_committed hook point. Another query fills it.
+    ParkingLotHandlePtr parking_lot = callout_handle->getParkingLotHandlePtr();
+    parking_lot->setLimit(1, ParkingLot::DROP_NEW);
+    Pkt4Ptr parked_query4 = createMessage4(DHCPREQUEST, 2, 0, 0);
+    ASSERT_TRUE(parking_lot->reference(parked_query4));
+
+    // The new query can't be parked and is dropped.
+    callout_handle->setStatus(CalloutHandle::NEXT_STEP_CONTINUE);
+    ASSERT_NO_THROW(ha_impl.leases4Committed(*callout_handle));
+    EXPECT_EQ(CalloutHandle::NEXT_STEP_DROP, callout_handle->getStatus());
+    EXPECT_FALSE(parking_lot->drop(query4));
+    EXPECT_EQ(1, parking_lot->getOverflowCount());
+
+    // With the drop-oldest policy the parked query is dropped instead.
+    parking_lot->setLimit(1, ParkingLot::DROP_OLDEST);
+    callout_handle->setStatus(CalloutHandle::NEXT_STEP_CONTINUE);
+    ASSERT_NO_THROW(ha_impl.leases4Committed(*callout_handle));
+    EXPECT_EQ(CalloutHandle::NEXT_STEP_PARK, callout_handle->getStatus());
+    EXPECT_FALSE(parking_lot->drop(parked_query4));
+    EXPECT_TRUE(parking_lot->drop(query4));
+    EXPECT_EQ(2, parking_lot->getOverflowCount());
+
+    // The dropped queries are counted.
+    ObservationPtr dropped =
+        StatsMgr::instance().getObservation("ha-parked-queries-dropped");
+    ASSERT_TRUE(dropped);
+    EXPECT_EQ(2, dropped->getInteger().first);
+
+    HooksManager::clearParkingLots();
+}
+
 // Tests leases6_committed callout implementation.
 TEST_F(HAImplTest, leases6Committed) {
     // Create implementation object and configure it.
@@ -9,6 +9,7 @@
 #include <ha_config.h>
 #include <ha_service.h>
 #include <ha_service_states.h>
+#include <asiolink/addr_utilities.h>
 #include <asiolink/interval_timer.h>
 #include <asiolink/io_address.h>
 #include <asiolink/io_service.h>
@@ -20,6 +21,7 @@
 #include <dhcp/duid.h>
 #include <dhcp/hwaddr.h>
 #include <dhcp/pkt4.h>
+#include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
@@ -33,6 +35,7 @@
 #include <http/response_creator.h>
 #include <http/response_creator_factory.h>
 #include <http/response_json.h>
+#include <stats/stats_mgr.h>
 #include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/pointer_cast.hpp>
@@ -193,6 +196,13 @@ public:
     using HAService::communication_state_;
     using HAService::query_filter_;
     using HAService::pending_requests_;
+    using HAService::journalLeaseChanges;
+    using HAService::updatePartnerJournal;
+    using HAService::lease_journal_;
+    using HAService::failed_journal_sequence_;
+    using HAService::unconfirmed_changes_;
+    using HAService::partner_journal_id_;
+    using HAService::partner_journal_sequence_;
 };
 
 /// @brief Pointer to the @c TestHAService.
@@ -209,7 +219,7 @@ public:
     TestHttpResponseCreator() :
         requests_(), control_result_(CONTROL_RESULT_SUCCESS),
         arguments_(), per_request_control_result_(),
-        per_request_arguments_(), request_index_() {
+        per_request_arguments_(), request_index_(), paged_leases_() {
     }
 
     /// @brief Removes all received requests.
@@ -289,6 +299,20 @@ public:
         }
     }
 
+    /// @brief Sets leases to be returned in pages to a leaseX-get-page
+    /// command.
+    ///
+    /// The page is selected with the "from", "to" and "limit" arguments
+    /// of each command, like the lease_cmds hook library does, so the
+    /// leases can be fetched in any order, e.g. in parallel ranges.
+    ///
+    /// @param command_name command name.
+    /// @param leases leases ordered by address.
+    void setPagedLeases(const std::string& command_name,
+                        const std::vector<LeasePtr>& leases) {
+        paged_leases_[command_name] = leases;
+    }
+
     /// @brief Create a new request.
     ///
     /// @return Pointer to the new instance of the @ref HttpRequest.
@@ -356,7 +380,11 @@ private:
 
                 // Check if there are specific arguments to be returned for this
                 // command.
-                if (per_request_arguments_.count(command_name) > 0) {
+                if (paged_leases_.count(command_name) > 0) {
+                    arguments = getPage(paged_leases_[command_name],
+                                        body->get("arguments"));
+
+                } else if (per_request_arguments_.count(command_name) > 0) {
                     // For certain requests we may return different arguments for consecutive
                     // instances of the same command. The request_index_ tracks the current
                     // index of the arguments to be returned.
@@ -401,6 +429,29 @@ private:
         return (response);
     }
 
+    /// @brief Returns a page of leases.
+    ///
+    /// @param leases leases ordered by address.
+    /// @param arguments leaseX-get-page command arguments.
+    /// @return arguments holding the leases of the page.
+    ElementPtr getPage(const std::vector<LeasePtr>& leases,
+                       const ConstElementPtr& arguments) const {
+        ElementPtr leases_json = Element::createList();
+        std::string from = arguments->get("from")->stringValue();
+        ConstElementPtr to = arguments->get("to");
+        size_t limit = static_cast<size_t>(arguments->get("limit")->intValue());
+        for (auto l = leases.begin(); (l != leases.end()) &&
+                 (leases_json->size() < limit); ++l) {
+            if (((from == "start") || (IOAddress(from) < (*l)->addr_)) &&
+                (!to || ((*l)->addr_ <= IOAddress(to->stringValue())))) {
+                leases_json->add((*l)->toElement());
+            }
+        }
+        ElementPtr page = Element::createMap();
+        page->set("leases", leases_json);
+        return (page);
+    }
+
     /// @brief Holds received HTTP requests.
     std::vector<ConstPostHttpRequestJsonPtr> requests_;
 
@@ -418,6 +469,9 @@ private:
 
     /// @brief Index of the next request of the given type.
     std::map<std::string, size_t> request_index_;
+
+    /// @brief Command specific leases returned in pages.
+    std::map<std::string, std::vector<LeasePtr> > paged_leases_;
 };
 
 /// @brief Shared pointer to the @c TestHttpResponseCreator.
@@ -1579,6 +1633,179 @@ TEST_F(HAServiceTest, processHeartbeat) {
     // Let's allow the response propagation time of 5 seconds to make
     // sure this test doesn't fail on slow systems.
     EXPECT_LT(td.seconds(), 5);
+
+    // Response must include the position in the lease journal.
+    ConstElementPtr journal_id = args->get("journal-id");
+    ASSERT_TRUE(journal_id);
+    EXPECT_EQ(Element::string, journal_id->getType());
+    ConstElementPtr journal_sequence = args->get("journal-sequence");
+    ASSERT_TRUE(journal_sequence);
+    EXPECT_EQ(Element::integer, journal_sequence->getType());
+    EXPECT_EQ(0, journal_sequence->intValue());
+}
+
+// This test verifies that the lease changes are recorded in the journal,
+// returned with the ha-journal-get command and that the heartbeat returns
+// the last change acknowledged by the partner.
+TEST_F(HAServiceTest, processJournalGet) {
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    TestHAService service(io_service_, network_state_, config_storage);
+    ASSERT_TRUE(service.lease_journal_);
+    const std::string journal_id = service.lease_journal_->getId();
+
+    Lease4CollectionPtr leases(new Lease4Collection());
+    leases->push_back(leases4_[1]);
+    leases->push_back(leases4_[2]);
+    Lease4CollectionPtr deleted_leases(new Lease4Collection());
+    deleted_leases->push_back(leases4_[0]);
+    EXPECT_EQ(1, service.journalLeaseChanges(leases, deleted_leases));
+
+    // Lease updates of a query are in progress.
+    Pkt4Ptr query(new Pkt4(DHCPREQUEST, 1234));
+    EXPECT_EQ(4, service.journalLeaseChanges(leases, Lease4CollectionPtr(new Lease4Collection())));
+    service.unconfirmed_changes_[query] = 4;
+
+    ConstElementPtr rsp = service.processHeartbeat();
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("journal-sequence"));
+    EXPECT_EQ(3, args->get("journal-sequence")->intValue());
+    service.unconfirmed_changes_.clear();
+    args = service.processHeartbeat()->get("arguments");
+    EXPECT_EQ(5, args->get("journal-sequence")->intValue());
+
+    // Fetch the changes following the first one.
+    rsp = service.processJournalGet(journal_id, 1, 3);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "3 lease changes returned.");
+    args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    EXPECT_EQ(journal_id, args->get("journal-id")->stringValue());
+    ConstElementPtr changes = args->get("changes");
+    ASSERT_TRUE(changes);
+    ASSERT_EQ(3, changes->size());
+    EXPECT_EQ(2, changes->get(0)->get("sequence")->intValue());
+    EXPECT_EQ("update", changes->get(0)->get("operation")->stringValue());
+    EXPECT_EQ(leases4_[1]->addr_.toText(),
+              changes->get(0)->get("lease")->get("ip-address")->stringValue());
+    EXPECT_EQ(4, changes->get(2)->get("sequence")->intValue());
+
+    rsp = service.processJournalGet(journal_id, 5, 3);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "0 lease changes returned.");
+
+    // Unknown journal and sequence.
+    rsp = service.processJournalGet("foo", 1, 3);
+    checkAnswer(rsp, CONTROL_RESULT_ERROR);
+    rsp = service.processJournalGet(journal_id, 6, 3);
+    checkAnswer(rsp, CONTROL_RESULT_ERROR);
+
+    // The changes are no longer available after a reset.
+    service.lease_journal_->reset();
+    rsp = service.processJournalGet(service.lease_journal_->getId(), 1, 3);
+    checkAnswer(rsp, CONTROL_RESULT_ERROR);
+}
+
+// This test verifies that the partner fetches the change of a failed lease
+// update again and that the journal is only reset when it discards it.
+TEST_F(HAServiceTest, processJournalGetFailedUpdate) {
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setLeaseJournalSize(4);
+    TestHAService service(io_service_, network_state_, config_storage);
+    ASSERT_TRUE(service.lease_journal_);
+    const std::string journal_id = service.lease_journal_->getId();
+
+    Lease4CollectionPtr leases(new Lease4Collection());
+    leases->push_back(leases4_[0]);
+    Lease4CollectionPtr deleted_leases(new Lease4Collection());
+    EXPECT_EQ(1, service.journalLeaseChanges(leases, deleted_leases));
+    EXPECT_EQ(2, service.journalLeaseChanges(leases, deleted_leases));
+    EXPECT_EQ(3, service.journalLeaseChanges(leases, deleted_leases));
+
+    // The lease update of the second change failed.
+    service.failed_journal_sequence_ = 2;
+    ConstElementPtr args = service.processHeartbeat()->get("arguments");
+    ASSERT_TRUE(args);
+    EXPECT_EQ(1, args->get("journal-sequence")->intValue());
+
+    // The journal keeps the changes.
+    EXPECT_EQ(4, service.journalLeaseChanges(leases, deleted_leases));
+    EXPECT_EQ(journal_id, service.lease_journal_->getId());
+    args = service.processHeartbeat()->get("arguments");
+    EXPECT_EQ(1, args->get("journal-sequence")->intValue());
+
+    // The partner fetches the changes following the confirmed one.
+    ConstElementPtr rsp = service.processJournalGet(journal_id, 1, 1);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "1 lease changes returned.");
+    EXPECT_EQ(2, service.failed_journal_sequence_);
+
+    // Once it has fetched the failed change, the changes are confirmed.
+    rsp = service.processJournalGet(journal_id, 2, 3);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "2 lease changes returned.");
+    EXPECT_EQ(0, service.failed_journal_sequence_);
+    args = service.processHeartbeat()->get("arguments");
+    EXPECT_EQ(4, args->get("journal-sequence")->intValue());
+
+    // Another lease update failed. The journal is reset when it discards
+    // the change.
+    service.failed_journal_sequence_ = 3;
+    EXPECT_EQ(5, service.journalLeaseChanges(leases, deleted_leases));
+    EXPECT_EQ(journal_id, service.lease_journal_->getId());
+    EXPECT_EQ(6, service.journalLeaseChanges(leases, deleted_leases));
+    EXPECT_EQ(journal_id, service.lease_journal_->getId());
+    EXPECT_EQ(7, service.journalLeaseChanges(leases, deleted_leases));
+    EXPECT_NE(journal_id, service.lease_journal_->getId());
+    EXPECT_EQ(0, service.failed_journal_sequence_);
+}
+
+// This test verifies that the lease journal is disabled with a zero size.
+TEST_F(HAServiceTest, processJournalGetDisabled) {
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setLeaseJournalSize(0);
+    TestHAService service(io_service_, network_state_, config_storage);
+    EXPECT_FALSE(service.lease_journal_);
+
+    ConstElementPtr args = service.processHeartbeat()->get("arguments");
+    ASSERT_TRUE(args);
+    EXPECT_FALSE(args->get("journal-id"));
+    EXPECT_FALSE(args->get("journal-sequence"));
+
+    checkAnswer(service.processJournalGet("foo", 0, 3), CONTROL_RESULT_ERROR);
+}
+
+// This test verifies that the position in the partner's lease journal is
+// only remembered while both servers are in the load-balancing state.
+TEST_F(HAServiceTest, updatePartnerJournal) {
+    HAConfigPtr config_storage = createValidConfiguration();
+    TestHAService service(io_service_, network_state_, config_storage);
+
+    ElementPtr args = Element::createMap();
+    args->set("journal-id", Element::create("journal1"));
+    args->set("journal-sequence", Element::create(7));
+
+    // This server is waiting.
+    service.communication_state_->setPartnerState("load-balancing");
+    service.updatePartnerJournal(args);
+    EXPECT_TRUE(service.partner_journal_id_.empty());
+
+    // Both servers are load balancing.
+    ASSERT_NO_THROW(service.verboseTransition(HA_LOAD_BALANCING_ST));
+    service.updatePartnerJournal(args);
+    EXPECT_EQ("journal1", service.partner_journal_id_);
+    EXPECT_EQ(7, service.partner_journal_sequence_);
+
+    // The partner is not load balancing.
+    service.communication_state_->setPartnerState("partner-down");
+    args->set("journal-sequence", Element::create(8));
+    service.updatePartnerJournal(args);
+    EXPECT_EQ(7, service.partner_journal_sequence_);
+
+    // The partner doesn't return the position.
+    service.communication_state_->setPartnerState("load-balancing");
+    service.updatePartnerJournal(Element::createMap());
+    EXPECT_TRUE(service.partner_journal_id_.empty());
 }
 
 // This test verifies that the correct value of the heartbeat-delay is used.
@@ -2037,6 +2264,188 @@ TEST_F(HAServiceTest, processSynchronize4) {
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
+// This test verifies that the leases of several address ranges are fetched
+// in parallel when partitions are configured.
+TEST_F(HAServiceTest, processSynchronizePartitions4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    // Each lease belongs to its own /24 subnet.
+    CfgMgr::instance().clear();
+    CfgSubnets4Ptr subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    for (size_t i = 0; i < leases4_.size(); ++i) {
+        IOAddress prefix = firstAddrInPrefix(leases4_[i]->addr_, 24);
+        ASSERT_NO_THROW(subnets->add(Subnet4Ptr(new Subnet4(prefix, 24, 30, 40, 50,
+                                                            leases4_[i]->subnet_id_))));
+    }
+
+    // Serve the leases in pages selected by the command arguments.
+    std::vector<LeasePtr> leases(leases4_.begin(), leases4_.end());
+    factory2_->getResponseCreator()->setPagedLeases("lease4-get-page", leases);
+
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    isc::stats::StatsMgr::instance().removeAll();
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setSyncPartitions(3);
+    HAService service(io_service_, network_state_, config_storage);
+
+    auto thread = runIOServiceInThread();
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = service.processSynchronize("server2", 20));
+    io_service_->stop();
+    thread->wait();
+    io_service_->get_io_service().reset();
+    io_service_->poll();
+    CfgMgr::instance().clear();
+
+    ASSERT_TRUE(rsp);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "Lease database synchronization"
+                " complete.");
+
+    // All leases should have been inserted into the database.
+    for (size_t i = 0; i < leases4_.size(); ++i) {
+        EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(leases4_[i]->addr_))
+            << "lease " << leases4_[i]->addr_.toText()
+            << " not in the lease database";
+    }
+
+    // The address space is split after the third and the sixth subnet.
+    TestHttpResponseCreatorPtr creator = factory2_->getResponseCreator();
+    EXPECT_TRUE(creator->findRequest("\"from\": \"start\"",
+                                     "\"to\": \"192.0.5.255\""));
+    EXPECT_TRUE(creator->findRequest("\"from\": \"192.0.5.255\"",
+                                     "\"to\": \"192.0.8.255\""));
+    ConstPostHttpRequestJsonPtr last_range =
+        creator->findRequest("\"from\": \"192.0.8.255\"", "lease4-get-page");
+    ASSERT_TRUE(last_range);
+    EXPECT_EQ(std::string::npos, last_range->toString().find("\"to\""));
+    EXPECT_TRUE(creator->findRequest("dhcp-enable",""));
+
+    // The throughput of the synchronization has been recorded.
+    EXPECT_TRUE(isc::stats::StatsMgr::instance().getObservation("ha-sync-throughput"));
+}
+
+// This test verifies that only the lease changes following the last known
+// position in the partner's lease journal are fetched when there is one.
+TEST_F(HAServiceTest, processSynchronizeJournal4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    // The first two leases are already in the database.
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(leases4_[0]));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(leases4_[1]));
+
+    // The partner deleted the first lease and allocated the third one.
+    ElementPtr changes = Element::createList();
+    ElementPtr change = Element::createMap();
+    change->set("sequence", Element::create(5));
+    change->set("operation", Element::create("delete"));
+    change->set("lease", leases4_[0]->toElement());
+    changes->add(change);
+    change = Element::createMap();
+    change->set("sequence", Element::create(6));
+    change->set("operation", Element::create("update"));
+    change->set("lease", leases4_[2]->toElement());
+    changes->add(change);
+    ElementPtr args = Element::createMap();
+    args->set("journal-id", Element::create("journal1"));
+    args->set("changes", changes);
+    factory2_->getResponseCreator()->setArguments("ha-journal-get", args);
+
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    TestHAService service(io_service_, network_state_, config_storage);
+    service.partner_journal_id_ = "journal1";
+    service.partner_journal_sequence_ = 4;
+
+    auto thread = runIOServiceInThread();
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = service.processSynchronize("server2", 20));
+    io_service_->stop();
+    thread->wait();
+    io_service_->get_io_service().reset();
+    io_service_->poll();
+
+    ASSERT_TRUE(rsp);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "Lease database synchronization"
+                " complete.");
+
+    EXPECT_FALSE(LeaseMgrFactory::instance().getLease4(leases4_[0]->addr_));
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(leases4_[1]->addr_));
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(leases4_[2]->addr_));
+    EXPECT_FALSE(LeaseMgrFactory::instance().getLease4(leases4_[3]->addr_));
+
+    // The next synchronization continues from the last change.
+    EXPECT_EQ("journal1", service.partner_journal_id_);
+    EXPECT_EQ(6, service.partner_journal_sequence_);
+
+    TestHttpResponseCreatorPtr creator = factory2_->getResponseCreator();
+    EXPECT_TRUE(creator->findRequest("dhcp-disable","20"));
+    EXPECT_TRUE(creator->findRequest("ha-journal-get", "\"from-sequence\": 4"));
+    EXPECT_FALSE(creator->findRequest("lease4-get-page",""));
+    EXPECT_TRUE(creator->findRequest("dhcp-enable",""));
+}
+
+// This test verifies that all leases are fetched when the lease changes
+// are not available from the partner's lease journal.
+TEST_F(HAServiceTest, processSynchronizeJournalUnavailable4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    std::vector<LeasePtr> leases(leases4_.begin(), leases4_.end());
+    factory2_->getResponseCreator()->setPagedLeases("lease4-get-page", leases);
+    factory2_->getResponseCreator()->setControlResult("ha-journal-get",
+                                                      CONTROL_RESULT_ERROR);
+
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    TestHAService service(io_service_, network_state_, config_storage);
+    service.partner_journal_id_ = "journal1";
+    service.partner_journal_sequence_ = 4;
+
+    auto thread = runIOServiceInThread();
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = service.processSynchronize("server2", 20));
+    io_service_->stop();
+    thread->wait();
+    io_service_->get_io_service().reset();
+    io_service_->poll();
+
+    ASSERT_TRUE(rsp);
+    checkAnswer(rsp, CONTROL_RESULT_SUCCESS, "Lease database synchronization"
+                " complete.");
+
+    for (size_t i = 0; i < leases4_.size(); ++i) {
+        EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(leases4_[i]->addr_))
+            << "lease " << leases4_[i]->addr_.toText()
+            << " not in the lease database";
+    }
+
+    // The position in the journal is no longer used.
+    EXPECT_TRUE(service.partner_journal_id_.empty());
+
+    TestHttpResponseCreatorPtr creator = factory2_->getResponseCreator();
+    EXPECT_TRUE(creator->findRequest("ha-journal-get",""));
+    EXPECT_TRUE(creator->findRequest("lease4-get-page",""));
+    EXPECT_TRUE(creator->findRequest("dhcp-enable",""));
+}
+
 // This test verifies that an error is reported when sending a dhcp-disable
 // command causes an error.
 TEST_F(HAServiceTest, processSynchronizeDisableError) {
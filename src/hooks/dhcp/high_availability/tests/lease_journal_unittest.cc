@@ -0,0 +1,144 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <lease_journal.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/lease.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::ha;
+
+namespace {
+
+/// @brief Creates an IPv4 lease for the address 192.0.2.<index>.
+///
+/// @param index last byte of the address.
+Lease4
+createLease4(const int index) {
+    std::ostringstream s;
+    s << "192.0.2." << index;
+    Lease4 lease;
+    lease.addr_ = IOAddress(s.str());
+    return (lease);
+}
+
+// This test verifies that the changes are returned in order from a given
+// sequence number.
+TEST(LeaseJournalTest, getChanges) {
+    LeaseJournal journal(10);
+    EXPECT_FALSE(journal.getId().empty());
+    EXPECT_EQ(0, journal.getLastSequence());
+    EXPECT_EQ(10, journal.getMaxEntries());
+
+    // An empty journal has no changes.
+    std::vector<LeaseJournal::Entry> changes;
+    EXPECT_TRUE(journal.getChanges(0, 10, changes));
+    EXPECT_TRUE(changes.empty());
+
+    EXPECT_EQ(1, journal.record(LeaseJournal::OP_UPDATE, createLease4(1)));
+    EXPECT_EQ(2, journal.record(LeaseJournal::OP_DELETE, createLease4(2)));
+    Lease6 lease6;
+    lease6.addr_ = IOAddress("2001:db8:1::1");
+    EXPECT_EQ(3, journal.record(LeaseJournal::OP_UPDATE, lease6));
+    EXPECT_EQ(3, journal.getLastSequence());
+    EXPECT_EQ(3, journal.size());
+
+    ASSERT_TRUE(journal.getChanges(0, 10, changes));
+    ASSERT_EQ(3, changes.size());
+    EXPECT_EQ(1, changes[0].sequence_);
+    EXPECT_EQ(LeaseJournal::OP_UPDATE, changes[0].operation_);
+    ASSERT_TRUE(changes[0].lease_);
+    EXPECT_EQ("192.0.2.1", changes[0].lease_->addr_.toText());
+    EXPECT_EQ(LeaseJournal::OP_DELETE, changes[1].operation_);
+    ASSERT_TRUE(boost::dynamic_pointer_cast<Lease6>(changes[2].lease_));
+    EXPECT_EQ("2001:db8:1::1", changes[2].lease_->addr_.toText());
+
+    // The number of changes is limited.
+    changes.clear();
+    ASSERT_TRUE(journal.getChanges(1, 1, changes));
+    ASSERT_EQ(1, changes.size());
+    EXPECT_EQ(2, changes[0].sequence_);
+
+    // There is no change after the last one.
+    changes.clear();
+    EXPECT_TRUE(journal.getChanges(3, 10, changes));
+    EXPECT_TRUE(changes.empty());
+    EXPECT_FALSE(journal.getChanges(4, 10, changes));
+}
+
+// This test verifies that the oldest changes are discarded when the
+// journal is full.
+TEST(LeaseJournalTest, truncated) {
+    LeaseJournal journal(3);
+    for (int i = 1; i <= 5; ++i) {
+        journal.record(LeaseJournal::OP_UPDATE, createLease4(i));
+    }
+    EXPECT_EQ(3, journal.size());
+    EXPECT_EQ(5, journal.getLastSequence());
+    EXPECT_EQ(3, journal.getFirstSequence());
+
+    // The first two changes are lost.
+    std::vector<LeaseJournal::Entry> changes;
+    EXPECT_FALSE(journal.getChanges(0, 10, changes));
+    EXPECT_FALSE(journal.getChanges(1, 10, changes));
+    ASSERT_TRUE(journal.getChanges(2, 10, changes));
+    ASSERT_EQ(3, changes.size());
+    EXPECT_EQ(3, changes[0].sequence_);
+    EXPECT_EQ("192.0.2.3", changes[0].lease_->addr_.toText());
+    EXPECT_EQ(5, changes[2].sequence_);
+
+    // A journal of size zero holds no change.
+    LeaseJournal none(0);
+    none.record(LeaseJournal::OP_UPDATE, createLease4(1));
+    EXPECT_EQ(0, none.size());
+    EXPECT_FALSE(none.getChanges(0, 10, changes));
+}
+
+// This test verifies that a reset discards the changes and changes the
+// identifier, while the sequence numbers continue.
+TEST(LeaseJournalTest, reset) {
+    LeaseJournal journal(10);
+    const std::string id = journal.getId();
+    journal.record(LeaseJournal::OP_UPDATE, createLease4(1));
+    journal.record(LeaseJournal::OP_UPDATE, createLease4(2));
+
+    journal.reset();
+    EXPECT_NE(id, journal.getId());
+    EXPECT_EQ(0, journal.size());
+    EXPECT_EQ(2, journal.getLastSequence());
+    EXPECT_EQ(3, journal.getFirstSequence());
+
+    std::vector<LeaseJournal::Entry> changes;
+    EXPECT_FALSE(journal.getChanges(1, 10, changes));
+    EXPECT_TRUE(journal.getChanges(2, 10, changes));
+    EXPECT_EQ(3, journal.record(LeaseJournal::OP_UPDATE, createLease4(3)));
+    ASSERT_TRUE(journal.getChanges(2, 10, changes));
+    ASSERT_EQ(1, changes.size());
+    EXPECT_EQ(3, changes[0].sequence_);
+
+    // Each journal has its own identifier.
+    LeaseJournal other(10);
+    EXPECT_NE(other.getId(), journal.getId());
+}
+
+// This test verifies the conversions of the types of the changes.
+TEST(LeaseJournalTest, operation) {
+    EXPECT_EQ("update", LeaseJournal::operationToString(LeaseJournal::OP_UPDATE));
+    EXPECT_EQ("delete", LeaseJournal::operationToString(LeaseJournal::OP_DELETE));
+    EXPECT_EQ(LeaseJournal::OP_UPDATE, LeaseJournal::stringToOperation("update"));
+    EXPECT_EQ(LeaseJournal::OP_DELETE, LeaseJournal::stringToOperation("delete"));
+    EXPECT_THROW(LeaseJournal::stringToOperation("add"), BadValue);
+}
+
+} // end of anonymous namespace
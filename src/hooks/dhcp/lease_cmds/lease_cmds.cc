@@ -7,8 +7,10 @@
 #include <config.h>
 #include <config/command_mgr.h>
 #include <config/cmds_impl.h>
+#include <config/response_stream.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <asiolink/addr_utilities.h>
 #include <asiolink/io_address.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr.h>
@@ -21,11 +23,14 @@
 #include <lease_cmds.h>
 #include <lease_parser.h>
 #include <lease_cmds_log.h>
+#include <log/log_dbglevels.h>
 #include <util/encode/hex.h>
 #include <util/strutil.h>
 
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <algorithm>
+#include <set>
 #include <string>
 #include <sstream>
 
@@ -39,6 +44,161 @@ using namespace std;
 namespace isc {
 namespace lease_cmds {
 
+namespace {
+
+/// @brief Number of leases fetched at once by the @c LeaseGetAllStream.
+const size_t LEASE_STREAM_PAGE_SIZE = 1000;
+
+/// @brief Streamed response to the lease4-get-all and lease6-get-all
+/// commands.
+///
+/// The response is the same as the one created from the elements, but
+/// it is produced a page of leases at a time. When all leases are
+/// returned, they are fetched from the lease database in pages ordered
+/// by address. When the leases of selected subnets are returned, they
+/// are fetched one subnet at a time. Only a page or a subnet worth of
+/// leases is held in memory, and the server processes other events while
+/// each part is being sent.
+///
+/// Unlike the response created at once, the streamed response is not a
+/// snapshot of the lease database: the leases updated while the response
+/// is being sent may or may not be returned with their new values.
+class LeaseGetAllStream : public ResponseStream {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param v4 true for DHCPv4 leases, false for DHCPv6 leases.
+    /// @param all true if all leases are returned, false if the leases
+    /// of the selected subnets are returned.
+    /// @param subnet_ids identifiers of the selected subnets.
+    LeaseGetAllStream(const bool v4, const bool all,
+                      const std::vector<SubnetID>& subnet_ids)
+        : v4_(v4), all_(all), subnet_ids_(subnet_ids), next_subnet_(0),
+          from_(v4 ? IOAddress::IPV4_ZERO_ADDRESS() :
+                IOAddress::IPV6_ZERO_ADDRESS()),
+          started_(false), count_(0) {
+    }
+
+    /// @brief Appends the next part of the response.
+    ///
+    /// The first part opens the response and the last part closes it
+    /// with the result and the text holding the number of leases.
+    ///
+    /// @param [out] out string to which the part is appended.
+    /// @return true if more parts follow, false otherwise.
+    virtual bool next(std::string& out) {
+        if (!started_) {
+            out += "{ \"arguments\": { \"leases\": [ ";
+            started_ = true;
+        }
+
+        bool more;
+        if (v4_) {
+            Lease4Collection leases;
+            more = getLeases(leases);
+            appendLeases(leases, out);
+
+        } else {
+            Lease6Collection leases;
+            more = getLeases(leases);
+            appendLeases(leases, out);
+        }
+
+        if (!more) {
+            std::ostringstream s;
+            s << count_ << " IPv" << (v4_ ? "4" : "6") << " lease(s) found.";
+            out += " ] }, \"result\": ";
+            out += std::to_string(count_ > 0 ? CONTROL_RESULT_SUCCESS :
+                                  CONTROL_RESULT_EMPTY);
+            out += ", \"text\": ";
+            Element::create(s.str())->appendJSON(out);
+            out += " }";
+        }
+        return (more);
+    }
+
+private:
+
+    /// @brief Fetches the next page of DHCPv4 leases.
+    ///
+    /// @param [out] leases fetched leases.
+    /// @return true if more leases may follow.
+    bool getLeases(Lease4Collection& leases) {
+        if (!all_) {
+            if (next_subnet_ < subnet_ids_.size()) {
+                leases = LeaseMgrFactory::instance().
+                    getLeases4(subnet_ids_[next_subnet_++]);
+            }
+            return (next_subnet_ < subnet_ids_.size());
+        }
+        leases = LeaseMgrFactory::instance().getLeases4(from_,
+                     LeasePageSize(LEASE_STREAM_PAGE_SIZE));
+        if (!leases.empty()) {
+            from_ = leases.back()->addr_;
+        }
+        return (leases.size() == LEASE_STREAM_PAGE_SIZE);
+    }
+
+    /// @brief Fetches the next page of DHCPv6 leases.
+    ///
+    /// @param [out] leases fetched leases.
+    /// @return true if more leases may follow.
+    bool getLeases(Lease6Collection& leases) {
+        if (!all_) {
+            if (next_subnet_ < subnet_ids_.size()) {
+                leases = LeaseMgrFactory::instance().
+                    getLeases6(subnet_ids_[next_subnet_++]);
+            }
+            return (next_subnet_ < subnet_ids_.size());
+        }
+        leases = LeaseMgrFactory::instance().getLeases6(from_,
+                     LeasePageSize(LEASE_STREAM_PAGE_SIZE));
+        if (!leases.empty()) {
+            from_ = leases.back()->addr_;
+        }
+        return (leases.size() == LEASE_STREAM_PAGE_SIZE);
+    }
+
+    /// @brief Appends leases to the list in the response.
+    ///
+    /// @param leases leases to append.
+    /// @param [out] out string to which the leases are appended.
+    template<typename LeaseCollectionType>
+    void appendLeases(const LeaseCollectionType& leases, std::string& out) {
+        for (auto lease : leases) {
+            if (count_ > 0) {
+                out += ", ";
+            }
+            lease->toElement()->appendJSON(out);
+            ++count_;
+        }
+    }
+
+    /// @brief Indicates if DHCPv4 or DHCPv6 leases are returned.
+    bool v4_;
+
+    /// @brief Indicates if all leases are returned.
+    bool all_;
+
+    /// @brief Identifiers of the subnets which leases are returned.
+    std::vector<SubnetID> subnet_ids_;
+
+    /// @brief Index of the next subnet which leases are fetched.
+    size_t next_subnet_;
+
+    /// @brief Address of the last lease fetched in the previous page.
+    IOAddress from_;
+
+    /// @brief Indicates if the first part has been produced.
+    bool started_;
+
+    /// @brief Number of leases returned so far.
+    size_t count_;
+};
+
+} // end of anonymous namespace
+
 /// @brief Wrapper class around reservation command handlers.
 class LeaseCmdsImpl : private CmdsImpl {
 public:
@@ -139,12 +299,24 @@ public:
     /// subnets. If no subnet identifiers are provided, it returns all
     /// IPv4 or IPv6 leases from the database.
     ///
+    /// If the caller accepts a streamed response, the leases are returned
+    /// by a @c LeaseGetAllStream a page at a time.
+    ///
     /// @param handle Callout context - which is expected to contain the
     /// get command JSON text in the "command" argument
     /// @return 0 upon success, non-zero otherwise.
     int
     leaseGetAllHandler(CalloutHandle& handle);
 
+    /// @brief Returns the subnet identifiers specified in the arguments
+    /// of the lease4-get-all and lease6-get-all commands.
+    ///
+    /// @param args command arguments.
+    /// @return list of the subnet identifiers.
+    /// @throw BadValue if the list is missing or malformed.
+    ConstElementPtr
+    getSubnetIds(const ConstElementPtr& args) const;
+
     /// @brief lease4-get-page, lease6-get-page commands handler
     ///
     /// These commands attempt to retrieve 1 page of leases. The maximum size
@@ -202,6 +374,16 @@ public:
     int
     lease6UpdateHandler(CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply, lease6-bulk-apply handler
+    ///
+    /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::leaseBulkApplyHandler
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// bulk apply command JSON text in the "command" argument
+    /// @return 0 upon success, non-zero otherwise
+    int
+    leaseBulkApplyHandler(CalloutHandle& handle);
+
     /// @brief lease4-wipe handler
     ///
     /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::lease4WipeHandler
@@ -232,6 +414,15 @@ public:
     /// @return parsed parameters
     /// @throw BadValue if input arguments don't make sense.
     Parameters getParameters(bool v6, const ConstElementPtr& args);
+
+    /// @brief Creates an entry of the list of leases which could not be
+    /// applied by a bulk apply command.
+    ///
+    /// @param lease lease as specified in the command.
+    /// @param error_message reason of the failure.
+    /// @return map holding the address of the lease and the error message.
+    static ElementPtr createFailedLease(const ConstElementPtr& lease,
+                                        const std::string& error_message);
 };
 
 int
@@ -498,6 +689,25 @@ LeaseCmdsImpl::leaseGetHandler(CalloutHandle& handle) {
     return (0);
 }
 
+ConstElementPtr
+LeaseCmdsImpl::getSubnetIds(const ConstElementPtr& args) const {
+    ConstElementPtr subnets = args->get("subnets");
+    if (!subnets) {
+        isc_throw(BadValue, "'subnets' parameter not specified");
+    }
+    if (subnets->getType() != Element::list) {
+        isc_throw(BadValue, "'subnets' parameter must be a list");
+    }
+
+    const std::vector<ElementPtr>& subnet_ids = subnets->listValue();
+    for (auto subnet_id : subnet_ids) {
+        if (subnet_id->getType() != Element::integer) {
+            isc_throw(BadValue, "listed subnet identifiers must be numbers");
+        }
+    }
+    return (subnets);
+}
+
 int
 LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
     bool v4 = true;
@@ -505,27 +715,33 @@ LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
         extractCommand(handle);
         v4 = (cmd_name_ == "lease4-get-all");
 
+        // The caller may accept the response in parts. In this case the
+        // leases are fetched and returned in pages rather than at once.
+        if (isResponseStreamAccepted(handle)) {
+            std::vector<SubnetID> subnet_ids;
+            if (cmd_args_) {
+                const std::vector<ElementPtr>& subnets =
+                    getSubnetIds(cmd_args_)->listValue();
+                for (auto subnet_id : subnets) {
+                    subnet_ids.push_back(subnet_id->intValue());
+                }
+            }
+            ResponseStreamPtr stream(new LeaseGetAllStream(v4, !cmd_args_,
+                                                           subnet_ids));
+            setResponseStream(handle, stream);
+            return (0);
+        }
+
         ElementPtr leases_json = Element::createList();
 
         // The argument may contain a list of subnets for which leases should
         // be returned.
         if (cmd_args_) {
-            ConstElementPtr subnets = cmd_args_->get("subnets");
-            if (!subnets) {
-                isc_throw(BadValue, "'subnets' parameter not specified");
-            }
-            if (subnets->getType() != Element::list) {
-                isc_throw(BadValue, "'subnets' parameter must be a list");
-            }
-
-            const std::vector<ElementPtr>& subnet_ids = subnets->listValue();
+            const std::vector<ElementPtr>& subnet_ids =
+                getSubnetIds(cmd_args_)->listValue();
             for (auto subnet_id = subnet_ids.begin();
                  subnet_id != subnet_ids.end();
                  ++subnet_id) {
-                if ((*subnet_id)->getType() != Element::integer) {
-                    isc_throw(BadValue, "listed subnet identifiers must be numbers");
-                }
-
                 if (v4) {
                     Lease4Collection leases =
                         LeaseMgrFactory::instance().getLeases4((*subnet_id)->intValue());
@@ -633,6 +849,30 @@ LeaseCmdsImpl::leaseGetPageHandler(CalloutHandle& handle) {
                       << " is not an IPv6 address");
         }
 
+        // The optional 'to' argument denotes the last address which may be
+        // returned in the results page. It allows for fetching the leases
+        // of distinct address ranges in parallel.
+        boost::scoped_ptr<IOAddress> to_address;
+        ConstElementPtr to = cmd_args_->get("to");
+        if (to) {
+            if (to->getType() != Element::string) {
+                isc_throw(BadValue, "'to' parameter must be a string");
+            }
+
+            try {
+                to_address.reset(new IOAddress(to->stringValue()));
+
+            } catch (...) {
+                isc_throw(BadValue, "'to' parameter value is not a valid IPv"
+                          << (v4 ? "4" : "6") << " address");
+            }
+
+            if (v4 != to_address->isV4()) {
+                isc_throw(BadValue, "'to' parameter value " << to_address->toText()
+                          << " is not an IPv" << (v4 ? "4" : "6") << " address");
+            }
+        }
+
         // The 'limit' is a desired page size. It must always be present.
         ConstElementPtr page_limit = cmd_args_->get("limit");
         if (!page_limit) {
@@ -647,29 +887,53 @@ LeaseCmdsImpl::leaseGetPageHandler(CalloutHandle& handle) {
         // Retrieve the desired page size.
         size_t page_limit_value = static_cast<size_t>(page_limit->intValue());
 
-        ElementPtr leases_json = Element::createList();
+        // Don't fetch more leases than the range following the 'from'
+        // address may hold.
+        if (to_address) {
+            if (*from_address < *to_address) {
+                uint64_t range_size = addrsInRange(*from_address, *to_address) - 1;
+                page_limit_value = static_cast<size_t>
+                    (std::min(static_cast<uint64_t>(page_limit_value), range_size));
 
-        if (v4) {
-            // Get page of IPv4 leases.
-            Lease4Collection leases =
-                LeaseMgrFactory::instance().getLeases4(*from_address,
-                                                       LeasePageSize(page_limit_value));
-
-            // Convert leases into JSON list.
-            for (auto lease : leases) {
-                ElementPtr lease_json = lease->toElement();
-                leases_json->add(lease_json);
+            } else {
+                page_limit_value = 0;
             }
+        }
 
-        } else {
-            // Get page of IPv6 leases.
-            Lease6Collection leases =
-                LeaseMgrFactory::instance().getLeases6(*from_address,
-                                                       LeasePageSize(page_limit_value));
-            // Convert leases into JSON list.
-            for (auto lease : leases) {
-                ElementPtr lease_json = lease->toElement();
-                leases_json->add(lease_json);
+        ElementPtr leases_json = Element::createList();
+
+        // No lease may be in an empty range.
+        if (page_limit_value > 0) {
+            if (v4) {
+                // Get page of IPv4 leases.
+                Lease4Collection leases =
+                    LeaseMgrFactory::instance().getLeases4(*from_address,
+                                                           LeasePageSize(page_limit_value));
+
+                // Convert leases into JSON list.
+                for (auto lease : leases) {
+                    // Skip the leases beyond the requested range.
+                    if (to_address && (*to_address < lease->addr_)) {
+                        continue;
+                    }
+                    ElementPtr lease_json = lease->toElement();
+                    leases_json->add(lease_json);
+                }
+
+            } else {
+                // Get page of IPv6 leases.
+                Lease6Collection leases =
+                    LeaseMgrFactory::instance().getLeases6(*from_address,
+                                                           LeasePageSize(page_limit_value));
+                // Convert leases into JSON list.
+                for (auto lease : leases) {
+                    // Skip the leases beyond the requested range.
+                    if (to_address && (*to_address < lease->addr_)) {
+                        continue;
+                    }
+                    ElementPtr lease_json = lease->toElement();
+                    leases_json->add(lease_json);
+                }
             }
         }
 
@@ -900,6 +1164,153 @@ LeaseCmdsImpl::lease6UpdateHandler(CalloutHandle& handle) {
     return (0);
 }
 
+int
+LeaseCmdsImpl::leaseBulkApplyHandler(CalloutHandle& handle) {
+    bool v4 = true;
+    try {
+        extractCommand(handle);
+        v4 = (cmd_name_ == "lease4-bulk-apply");
+
+        // We need the leases to be specified.
+        if (!cmd_args_ || (cmd_args_->getType() != Element::map)) {
+            isc_throw(isc::BadValue, "no parameters specified for "
+                      << cmd_name_ << " command");
+        }
+
+        ConstElementPtr deleted_leases = cmd_args_->get("deleted-leases");
+        ConstElementPtr leases = cmd_args_->get("leases");
+        if (!deleted_leases && !leases) {
+            isc_throw(isc::BadValue, "neither 'deleted-leases' nor 'leases'"
+                      " parameter specified");
+        }
+        if (deleted_leases && (deleted_leases->getType() != Element::list)) {
+            isc_throw(isc::BadValue, "'deleted-leases' parameter must be a list");
+        }
+        if (leases && (leases->getType() != Element::list)) {
+            isc_throw(isc::BadValue, "'leases' parameter must be a list");
+        }
+
+        ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+        ElementPtr failed_leases = Element::createList();
+        size_t applied = 0;
+
+        // The deleted leases are applied before the other leases, so the
+        // order of two changes of an address would be lost. Such a change
+        // fails, which also keeps the failed leases unambiguous.
+        std::set<std::string> addresses;
+        auto check_unique = [&addresses](const ConstElementPtr& lease) {
+            if (lease->getType() != Element::map) {
+                return;
+            }
+            ConstElementPtr addr = lease->get("ip-address");
+            if (addr && (addr->getType() == Element::string) &&
+                !addresses.insert(IOAddress(addr->stringValue()).toText()).second) {
+                isc_throw(isc::BadValue, "address " << addr->stringValue()
+                          << " appears more than once in the command");
+            }
+        };
+
+        // A lease which is not found is not an error: the requester only
+        // wants it to be gone.
+        if (deleted_leases) {
+            for (auto l : deleted_leases->listValue()) {
+                try {
+                    if (l->getType() != Element::map) {
+                        isc_throw(isc::BadValue, "deleted lease must be a map");
+                    }
+                    check_unique(l);
+                    ConstElementPtr addr = l->get("ip-address");
+                    if (!addr || (addr->getType() != Element::string)) {
+                        isc_throw(isc::BadValue, "'ip-address' is not specified");
+                    }
+                    IOAddress ip(addr->stringValue());
+                    if (ip.isV4() != v4) {
+                        isc_throw(isc::BadValue, "invalid address "
+                                  << ip.toText() << " for " << cmd_name_);
+                    }
+                    LeaseMgrFactory::instance().deleteLease(ip);
+                    ++applied;
+
+                } catch (const std::exception& ex) {
+                    failed_leases->add(createFailedLease(l, ex.what()));
+                }
+            }
+        }
+
+        // Leases are created if they don't exist or updated otherwise.
+        if (leases) {
+            for (auto l : leases->listValue()) {
+                try {
+                    check_unique(l);
+                    bool force_create = false;
+                    if (v4) {
+                        Lease4Parser parser;
+                        Lease4Ptr lease4 = parser.parse(config, l, force_create);
+                        if (!LeaseMgrFactory::instance().getLease4(lease4->addr_)) {
+                            LeaseMgrFactory::instance().addLease(lease4);
+                        } else {
+                            LeaseMgrFactory::instance().updateLease4(lease4);
+                        }
+
+                    } else {
+                        Lease6Parser parser;
+                        Lease6Ptr lease6 = parser.parse(config, l, force_create);
+                        if (!LeaseMgrFactory::instance().getLease6(lease6->type_,
+                                                                   lease6->addr_)) {
+                            LeaseMgrFactory::instance().addLease(lease6);
+                        } else {
+                            LeaseMgrFactory::instance().updateLease6(lease6);
+                        }
+                    }
+                    ++applied;
+
+                } catch (const std::exception& ex) {
+                    failed_leases->add(createFailedLease(l, ex.what()));
+                }
+            }
+        }
+
+        std::ostringstream text;
+        text << "Bulk apply of " << applied << (v4 ? " IPv4" : " IPv6")
+             << " leases completed.";
+        ElementPtr args = Element::createMap();
+        if (!failed_leases->empty()) {
+            args->set("failed-leases", failed_leases);
+        }
+        ConstElementPtr response = createAnswer(CONTROL_RESULT_SUCCESS,
+                                                text.str(), args);
+        setResponse(handle, response);
+
+        LOG_DEBUG(lease_cmds_logger, isc::log::DBGLVL_TRACE_BASIC,
+                  v4 ? LEASE_CMDS_BULK_APPLY4 : LEASE_CMDS_BULK_APPLY6)
+            .arg(applied)
+            .arg(failed_leases->size());
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(lease_cmds_logger, v4 ? LEASE_CMDS_BULK_APPLY4_FAILED :
+                  LEASE_CMDS_BULK_APPLY6_FAILED)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    return (0);
+}
+
+ElementPtr
+LeaseCmdsImpl::createFailedLease(const ConstElementPtr& lease,
+                                 const std::string& error_message) {
+    ElementPtr failed_lease = Element::createMap();
+    if (lease && (lease->getType() == Element::map)) {
+        ConstElementPtr addr = lease->get("ip-address");
+        if (addr) {
+            failed_lease->set("ip-address", addr);
+        }
+    }
+    failed_lease->set("error-message", Element::create(error_message));
+    return (failed_lease);
+}
+
 int
 LeaseCmdsImpl::lease4WipeHandler(CalloutHandle& handle) {
     try {
@@ -1038,6 +1449,11 @@ LeaseCmds::lease6UpdateHandler(CalloutHandle& handle) {
     return(impl_->lease6UpdateHandler(handle));
 }
 
+int
+LeaseCmds::leaseBulkApplyHandler(CalloutHandle& handle) {
+    return(impl_->leaseBulkApplyHandler(handle));
+}
+
 int
 LeaseCmds::lease4WipeHandler(CalloutHandle& handle) {
    return(impl_->lease4WipeHandler(handle));
@@ -167,7 +167,9 @@ public:
     /// page. The new page starts from the first address following the
     /// address specified by the caller. If the first page should be
     /// returned the IPv4 zero address, IPv6 zero address or the keyword
-    /// "start" should be provided instead of the last address.
+    /// "start" should be provided instead of the last address. The
+    /// optional "to" parameter holds the last address which may be
+    /// returned, so distinct address ranges can be fetched in parallel.
     ///
     /// @param handle Callout context - which is expected to contain the
     /// get commands JSON text in the "command" argument.
@@ -314,6 +316,42 @@ public:
     int
     lease6UpdateHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply, lease6-bulk-apply handler
+    ///
+    /// This command deletes and creates or updates a set of leases in a
+    /// single command. It is used by the High Availability hooks library
+    /// to send the lease updates of many DHCP transactions in one request.
+    /// The deleted leases are identified by their address and it is not
+    /// an error if one does not exist. The other leases are created when
+    /// they don't exist and updated otherwise. The leases which could not
+    /// be applied are listed in the "failed-leases" argument of the
+    /// response along with the reason of the failure.
+    ///
+    /// Example command:
+    /// {
+    ///     "command": "lease4-bulk-apply",
+    ///     "arguments": {
+    ///         "deleted-leases": [
+    ///             {
+    ///                 "ip-address": "192.0.2.2"
+    ///             }
+    ///         ],
+    ///         "leases": [
+    ///             {
+    ///                 "subnet-id": 44,
+    ///                 "ip-address": "192.0.2.1",
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f"
+    ///             }
+    ///         ]
+    ///     }
+    /// };
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// bulk apply command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    leaseBulkApplyHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease4-wipe handler
     ///
     /// This commands attempts to remove all IPv4 leases from a specific
@@ -8,6 +8,10 @@ extern const isc::log::MessageID LEASE_CMDS_ADD4 = "LEASE_CMDS_ADD4";
 extern const isc::log::MessageID LEASE_CMDS_ADD4_FAILED = "LEASE_CMDS_ADD4_FAILED";
 extern const isc::log::MessageID LEASE_CMDS_ADD6 = "LEASE_CMDS_ADD6";
 extern const isc::log::MessageID LEASE_CMDS_ADD6_FAILED = "LEASE_CMDS_ADD6_FAILED";
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY4 = "LEASE_CMDS_BULK_APPLY4";
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY4_FAILED = "LEASE_CMDS_BULK_APPLY4_FAILED";
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY6 = "LEASE_CMDS_BULK_APPLY6";
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY6_FAILED = "LEASE_CMDS_BULK_APPLY6_FAILED";
 extern const isc::log::MessageID LEASE_CMDS_DEINIT_FAILED = "LEASE_CMDS_DEINIT_FAILED";
 extern const isc::log::MessageID LEASE_CMDS_DEINIT_OK = "LEASE_CMDS_DEINIT_OK";
 extern const isc::log::MessageID LEASE_CMDS_DEL4 = "LEASE_CMDS_DEL4";
@@ -24,6 +28,10 @@ const char* values[] = {
     "LEASE_CMDS_ADD4_FAILED", "lease4-add command failed (parameters: %1, reason: %2)",
     "LEASE_CMDS_ADD6", "lease6-add command successful (parameters: %1)",
     "LEASE_CMDS_ADD6_FAILED", "Lease6-add command failed (parameters: %1, reason: %2)",
+    "LEASE_CMDS_BULK_APPLY4", "lease4-bulk-apply command applied %1 leases, %2 leases failed",
+    "LEASE_CMDS_BULK_APPLY4_FAILED", "lease4-bulk-apply command failed (reason: %1)",
+    "LEASE_CMDS_BULK_APPLY6", "lease6-bulk-apply command applied %1 leases, %2 leases failed",
+    "LEASE_CMDS_BULK_APPLY6_FAILED", "lease6-bulk-apply command failed (reason: %1)",
     "LEASE_CMDS_DEINIT_FAILED", "unloading Lease Commands hooks library failed: %1",
     "LEASE_CMDS_DEINIT_OK", "unloading Lease Commands hooks library successful",
     "LEASE_CMDS_DEL4", "lease4-del command successful (parameters: %1)",
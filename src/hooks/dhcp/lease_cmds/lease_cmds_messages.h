@@ -9,6 +9,10 @@ extern const isc::log::MessageID LEASE_CMDS_ADD4;
 extern const isc::log::MessageID LEASE_CMDS_ADD4_FAILED;
 extern const isc::log::MessageID LEASE_CMDS_ADD6;
 extern const isc::log::MessageID LEASE_CMDS_ADD6_FAILED;
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY4;
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY4_FAILED;
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY6;
+extern const isc::log::MessageID LEASE_CMDS_BULK_APPLY6_FAILED;
 extern const isc::log::MessageID LEASE_CMDS_DEINIT_FAILED;
 extern const isc::log::MessageID LEASE_CMDS_DEINIT_OK;
 extern const isc::log::MessageID LEASE_CMDS_DEL4;
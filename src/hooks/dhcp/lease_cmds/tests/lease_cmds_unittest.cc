@@ -123,6 +123,36 @@ public:
         return (rsp);
     }
 
+    /// @brief Checks that the streamed response to a command is the same
+    /// as the response created at once.
+    ///
+    /// @param cmd_txt JSON command to be sent (must be valid JSON)
+    /// @param exp_parts expected number of parts of the streamed response.
+    void testCommandStream(const string& cmd_txt, const size_t exp_parts) {
+        loadLib();
+
+        ConstElementPtr cmd;
+        ASSERT_NO_THROW(cmd = Element::fromJSON(cmd_txt));
+
+        ConstElementPtr rsp = CommandMgr::instance().processCommand(cmd);
+        ASSERT_TRUE(rsp);
+
+        ResponseStreamPtr stream;
+        ConstElementPtr streamed_rsp;
+        ASSERT_NO_THROW(streamed_rsp =
+                        CommandMgr::instance().processCommandStream(cmd, stream));
+        EXPECT_FALSE(streamed_rsp);
+        ASSERT_TRUE(stream);
+
+        std::string text;
+        size_t parts = 1;
+        while (stream->next(text)) {
+            ++parts;
+        }
+        EXPECT_EQ(exp_parts, parts);
+        EXPECT_EQ(rsp->str(), text);
+    }
+
     /// @brief Compares the status in the given parse result to a given value.
     ///
     /// @param answer Element set containing an integer response and string
@@ -509,6 +539,7 @@ TEST_F(LeaseCmdsTest, commands) {
                             "lease4-get-page", "lease6-get-page",
                             "lease4-del",      "lease6-del",
                             "lease4-update",   "lease6-update",
+                            "lease4-bulk-apply", "lease6-bulk-apply",
                             "lease4-wipe",     "lease6-wipe" };
     testCommands(cmds);
 }
@@ -1803,6 +1834,32 @@ TEST_F(LeaseCmdsTest, Lease4GetAll) {
 }
 
 // Checks that lease4-get-all returns empty set if no leases are found.
+// Checks that the leases can be streamed.
+TEST_F(LeaseCmdsTest, Lease4GetAllStream) {
+    initLeaseMgr(false, true);
+
+    testCommandStream("{ \"command\": \"lease4-get-all\" }", 1);
+    testCommandStream("{ \"command\": \"lease4-get-all\","
+                      "  \"arguments\": { \"subnets\": [ 44, 127, 88 ] } }", 3);
+    testCommandStream("{ \"command\": \"lease4-get-all\","
+                      "  \"arguments\": { \"subnets\": [ ] } }", 1);
+
+    // Errors in the arguments are reported at once.
+    ConstElementPtr cmd = Element::fromJSON("{ \"command\": \"lease4-get-all\","
+                                            "  \"arguments\": { \"subnets\": 44 } }");
+    ResponseStreamPtr stream;
+    ConstElementPtr rsp = CommandMgr::instance().processCommandStream(cmd, stream);
+    EXPECT_FALSE(stream);
+    checkAnswer(rsp, CONTROL_RESULT_ERROR, "'subnets' parameter must be a list");
+}
+
+// Checks that the empty response can be streamed.
+TEST_F(LeaseCmdsTest, Lease4GetAllStreamNoLeases) {
+    initLeaseMgr(false, false);
+
+    testCommandStream("{ \"command\": \"lease4-get-all\" }", 1);
+}
+
 TEST_F(LeaseCmdsTest, Lease4GetAllNoLeases) {
 
     // Initialize lease manager (false = v4, false = do not add leasesxs)
@@ -2105,6 +2162,120 @@ TEST_F(LeaseCmdsTest, Lease4GetPagedIPv4Address) {
     testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
 }
 
+// Verifies that the leases beyond the 'to' address are not returned.
+TEST_F(LeaseCmdsTest, Lease4GetPagedTo) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    // Query for a page of leases within the 192.0.2.0/24 range.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"192.0.2.255\","
+        "        \"limit\": 3"
+        "    }"
+        "}";
+
+    string exp_rsp = "2 IPv4 lease(s) found.";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ASSERT_TRUE(rsp);
+
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(Element::list, leases->getType());
+    ASSERT_EQ(2, leases->size());
+    checkLease4(leases, "192.0.2.1", 44, "08:08:08:08:08:08", true);
+    checkLease4(leases, "192.0.2.2", 44, "09:09:09:09:09:09", true);
+
+    // The next range holds the remaining leases.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"192.0.2.255\","
+        "        \"to\": \"192.0.3.1\","
+        "        \"limit\": 3"
+        "    }"
+        "}";
+
+    exp_rsp = "1 IPv4 lease(s) found.";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ASSERT_TRUE(rsp);
+    leases = rsp->get("arguments")->get("leases");
+    ASSERT_EQ(1, leases->size());
+    checkLease4(leases, "192.0.3.1", 88, "08:08:08:08:08:08", true);
+
+    // The page is clamped to the range.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"192.0.2.0\","
+        "        \"to\": \"192.0.2.1\","
+        "        \"limit\": 3"
+        "    }"
+        "}";
+
+    exp_rsp = "1 IPv4 lease(s) found.";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ASSERT_TRUE(rsp);
+    leases = rsp->get("arguments")->get("leases");
+    ASSERT_EQ(1, leases->size());
+    checkLease4(leases, "192.0.2.1", 44, "08:08:08:08:08:08", true);
+
+    // No lease follows the 'from' address in an empty range.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"192.0.2.1\","
+        "        \"to\": \"192.0.2.1\","
+        "        \"limit\": 3"
+        "    }"
+        "}";
+
+    exp_rsp = "0 IPv4 lease(s) found.";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, exp_rsp);
+}
+
+// Verifies that an invalid 'to' address is rejected.
+TEST_F(LeaseCmdsTest, Lease4GetPagedInvalidTo) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"2001:db8::1\","
+        "        \"limit\": 2"
+        "    }"
+        "}";
+
+    string exp_rsp = "'to' parameter value 2001:db8::1 is not an IPv4 address";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"foo\","
+        "        \"limit\": 2"
+        "    }"
+        "}";
+
+    exp_rsp = "'to' parameter value is not a valid IPv4 address";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+}
+
 // Checks that lease6-get-all returns all leases.
 TEST_F(LeaseCmdsTest, Lease6GetAll) {
 
@@ -2138,6 +2309,15 @@ TEST_F(LeaseCmdsTest, Lease6GetAll) {
 }
 
 // Checks that lease6-get-all returns empty set if no leases are found.
+// Checks that the leases can be streamed.
+TEST_F(LeaseCmdsTest, Lease6GetAllStream) {
+    initLeaseMgr(true, true);
+
+    testCommandStream("{ \"command\": \"lease6-get-all\" }", 1);
+    testCommandStream("{ \"command\": \"lease6-get-all\","
+                      "  \"arguments\": { \"subnets\": [ 66, 99 ] } }", 2);
+}
+
 TEST_F(LeaseCmdsTest, Lease6GetAllNoLeases) {
 
     // Initialize lease manager (true = v6, false = do not add leasesxs)
@@ -3690,6 +3870,197 @@ TEST_F(LeaseCmdsTest, Lease6DelByDUID) {
     EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1")));
 }
 
+// Check that lease4-bulk-apply refuses malformed arguments.
+TEST_F(LeaseCmdsTest, Lease4BulkApplyBadParams) {
+    initLeaseMgr(false, true);
+    ASSERT_TRUE(lmptr_);
+
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\"\n"
+        "}";
+    testCommand(txt, CONTROL_RESULT_ERROR,
+                "no parameters specified for lease4-bulk-apply command");
+
+    txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": { }\n"
+        "}";
+    testCommand(txt, CONTROL_RESULT_ERROR,
+                "neither 'deleted-leases' nor 'leases' parameter specified");
+
+    txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"leases\": { }"
+        "    }\n"
+        "}";
+    testCommand(txt, CONTROL_RESULT_ERROR, "'leases' parameter must be a list");
+
+    // Nothing has been deleted.
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+}
+
+// Check that lease4-bulk-apply deletes, creates and updates leases and
+// reports the leases it could not apply.
+TEST_F(LeaseCmdsTest, Lease4BulkApply) {
+    initLeaseMgr(false, true);
+    ASSERT_TRUE(lmptr_);
+
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            { \"ip-address\": \"192.0.2.2\" },"
+        "            { \"ip-address\": \"192.0.2.200\" }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.1\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\",\n"
+        "                \"hostname\": \"newhostname.example.org\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.10\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"10.0.0.1\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\""
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(txt, CONTROL_RESULT_SUCCESS,
+                                      "Bulk apply of 4 IPv4 leases completed.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr failed_leases = args->get("failed-leases");
+    ASSERT_TRUE(failed_leases);
+    ASSERT_EQ(Element::list, failed_leases->getType());
+    ASSERT_EQ(1, failed_leases->size());
+    ASSERT_TRUE(failed_leases->get(0)->get("ip-address"));
+    EXPECT_EQ("10.0.0.1",
+              failed_leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_TRUE(failed_leases->get(0)->get("error-message"));
+
+    // The deleted lease is gone.
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+
+    // The existing lease has been updated.
+    Lease4Ptr l = lmptr_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("1a:1b:1c:1d:1e:1f", l->hwaddr_->toText(false));
+    EXPECT_EQ("newhostname.example.org", l->hostname_);
+
+    // The new lease has been created.
+    l = lmptr_->getLease4(IOAddress("192.0.2.10"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("2a:2b:2c:2d:2e:2f", l->hwaddr_->toText(false));
+}
+
+// Check that lease4-bulk-apply refuses a second change of an address.
+TEST_F(LeaseCmdsTest, Lease4BulkApplyDuplicateAddress) {
+    initLeaseMgr(false, true);
+    ASSERT_TRUE(lmptr_);
+
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            { \"ip-address\": \"192.0.2.1\" }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.1\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\""
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(txt, CONTROL_RESULT_SUCCESS,
+                                      "Bulk apply of 1 IPv4 leases completed.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr failed_leases = args->get("failed-leases");
+    ASSERT_TRUE(failed_leases);
+    ASSERT_EQ(1, failed_leases->size());
+    EXPECT_EQ("192.0.2.1",
+              failed_leases->get(0)->get("ip-address")->stringValue());
+    ASSERT_TRUE(failed_leases->get(0)->get("error-message"));
+    EXPECT_EQ("address 192.0.2.1 appears more than once in the command",
+              failed_leases->get(0)->get("error-message")->stringValue());
+
+    // Only the deletion has been applied.
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+}
+
+// Check that lease6-bulk-apply deletes, creates and updates leases.
+TEST_F(LeaseCmdsTest, Lease6BulkApply) {
+    initLeaseMgr(true, true);
+    ASSERT_TRUE(lmptr_);
+
+    string txt =
+        "{\n"
+        "    \"command\": \"lease6-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            { \"ip-address\": \"2001:db8:1::2\" },"
+        "            { \"ip-address\": \"192.0.2.1\" }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 66,\n"
+        "                \"ip-address\": \"2001:db8:1::1\",\n"
+        "                \"iaid\": 7654321,\n"
+        "                \"duid\": \"88:88:88:88:88:88:88:88\",\n"
+        "                \"hostname\": \"newhostname.example.org\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 66,\n"
+        "                \"ip-address\": \"2001:db8:1::10\",\n"
+        "                \"iaid\": 1234,\n"
+        "                \"duid\": \"77:77:77:77:77:77:77:77\""
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(txt, CONTROL_RESULT_SUCCESS,
+                                      "Bulk apply of 3 IPv6 leases completed.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr failed_leases = args->get("failed-leases");
+    ASSERT_TRUE(failed_leases);
+    ASSERT_EQ(1, failed_leases->size());
+    EXPECT_EQ("192.0.2.1",
+              failed_leases->get(0)->get("ip-address")->stringValue());
+
+    EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2")));
+
+    Lease6Ptr l = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->duid_);
+    EXPECT_EQ("88:88:88:88:88:88:88:88", l->duid_->toText());
+    EXPECT_EQ("newhostname.example.org", l->hostname_);
+
+    l = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::10"));
+    ASSERT_TRUE(l);
+    EXPECT_EQ(1234, l->iaid_);
+}
+
 // Checks that lease4-wipe can remove leases.
 TEST_F(LeaseCmdsTest, Lease4Wipe) {
 
@@ -27,6 +27,7 @@ const char *CONTROL_RESULT = "result";
 const char *CONTROL_TEXT = "text";
 const char *CONTROL_ARGUMENTS = "arguments";
 const char *CONTROL_SERVICE = "service";
+const char *CONTROL_KEEP_ALIVE = "keep-alive";
 
 // Full version, with status, text and arguments
 ConstElementPtr
@@ -35,6 +35,10 @@ extern const char *CONTROL_ARGUMENTS;
 /// @brief String used for service list ("service")
 extern const char *CONTROL_SERVICE;
 
+/// @brief String used by the clients of the control channel to keep
+/// the connection open after the response ("keep-alive")
+extern const char *CONTROL_KEEP_ALIVE;
+
 /// @brief Status code indicating a successful operation
 const int CONTROL_RESULT_SUCCESS = 0;
 
@@ -13,6 +13,8 @@
 #include <climits>
 #include <list>
 #include <map>
+#include <mutex>
+#include <set>
 #include <cstdio>
 #include <iostream>
 #include <iomanip>
@@ -22,6 +24,7 @@
 #include <cerrno>
 
 #include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
 
 #include <cmath>
 
@@ -47,18 +50,186 @@ operator<<(std::ostream& out, const Element::Position& pos) {
     return (out);
 }
 
+const std::string*
+Element::internFileName(const std::string& file) {
+    // Most elements are created without a position.
+    static const std::string* empty = new std::string();
+    if (file.empty()) {
+        return (empty);
+    }
+
+    // Consecutive elements are usually read from the same file.
+    static thread_local const std::string* last = 0;
+    if (last && (*last == file)) {
+        return (last);
+    }
+
+    // The names are allocated dynamically and never released so as they
+    // outlive the static elements.
+    static std::mutex* mutex = new std::mutex();
+    static std::set<std::string>* names = new std::set<std::string>();
+    std::lock_guard<std::mutex> lock(*mutex);
+    last = &*names->insert(file).first;
+    return (last);
+}
+
+const Element::Position&
+Element::getPosition() const {
+    Position* position = position_.load();
+    if (position) {
+        return (*position);
+    }
+    if (file_->empty() && (line_ == 0) && (pos_ == 0)) {
+        return (ZERO_POSITION());
+    }
+
+    // Another thread may build the position at the same time, only one
+    // of the copies is kept.
+    Position* built = new Position(*file_, line_, pos_);
+    if (!position_.compare_exchange_strong(position, built)) {
+        delete built;
+        return (*position);
+    }
+    return (*built);
+}
+
 std::string
 Element::str() const {
-    std::stringstream ss;
-    toJSON(ss);
-    return (ss.str());
+    std::string s;
+    appendJSON(s);
+    return (s);
 }
 
 std::string
 Element::toWire() const {
-    std::stringstream ss;
-    toJSON(ss);
-    return (ss.str());
+    std::string s;
+    appendJSON(s);
+    return (s);
+}
+
+void
+Element::appendJSON(std::string& out) const {
+    switch (getType()) {
+    case integer:
+        out += std::to_string(intValue());
+        break;
+
+    case real:
+        {
+            // Same format as the default output of doubles on a stream,
+            // see DoubleElement::toJSON().
+            char buf[32];
+            const int len = snprintf(buf, sizeof(buf), "%g", doubleValue());
+            out.append(buf, len);
+            if (std::memchr(buf, '.', len) == 0) {
+                out += ".0";
+            }
+        }
+        break;
+
+    case boolean:
+        out += (boolValue() ? "true" : "false");
+        break;
+
+    case null:
+        out += "null";
+        break;
+
+    case string:
+        {
+            out += '"';
+            const std::string& str = stringValue();
+            const char* run = str.data();
+            const char* const end = run + str.size();
+            for (const char* p = run; p != end; ++p) {
+                const char c = *p;
+                if ((c >= 0x20) && (c < 0x7f) && (c != '"') && (c != '\\')) {
+                    continue;
+                }
+                // Escape as in StringElement::toJSON().
+                out.append(run, p - run);
+                run = p + 1;
+                switch (c) {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\b':
+                    out += "\\b";
+                    break;
+                case '\f':
+                    out += "\\f";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                default:
+                    {
+                        static const char hex[] = "0123456789abcdef";
+                        const unsigned char u = static_cast<unsigned char>(c);
+                        out += "\\u00";
+                        out += hex[u >> 4];
+                        out += hex[u & 0xf];
+                    }
+                }
+            }
+            out.append(run, end - run);
+            out += '"';
+        }
+        break;
+
+    case list:
+        {
+            out += "[ ";
+            const std::vector<ElementPtr>& v = listValue();
+            for (std::vector<ElementPtr>::const_iterator it = v.begin();
+                 it != v.end(); ++it) {
+                if (it != v.begin()) {
+                    out += ", ";
+                }
+                (*it)->appendJSON(out);
+            }
+            out += " ]";
+        }
+        break;
+
+    case map:
+        {
+            out += "{ ";
+            const std::map<std::string, ConstElementPtr>& m = mapValue();
+            for (std::map<std::string, ConstElementPtr>::const_iterator it =
+                     m.begin(); it != m.end(); ++it) {
+                if (it != m.begin()) {
+                    out += ", ";
+                }
+                out += '"';
+                out += it->first;
+                out += "\": ";
+                if (it->second) {
+                    it->second->appendJSON(out);
+                } else {
+                    out += "None";
+                }
+            }
+            out += " }";
+        }
+        break;
+
+    default:
+        {
+            std::ostringstream ss;
+            toJSON(ss);
+            out += ss.str();
+        }
+    }
 }
 
 void
@@ -221,12 +392,12 @@ bool operator!=(const Element& a, const Element& b) {
 //
 ElementPtr
 Element::create(const Position& pos) {
-    return (ElementPtr(new NullElement(pos)));
+    return (boost::make_shared<NullElement>(pos));
 }
 
 ElementPtr
 Element::create(const long long int i, const Position& pos) {
-    return (ElementPtr(new IntElement(static_cast<int64_t>(i), pos)));
+    return (boost::make_shared<IntElement>(static_cast<int64_t>(i), pos));
 }
 
 ElementPtr
@@ -241,17 +412,17 @@ Element::create(const long int i, const Position& pos) {
 
 ElementPtr
 Element::create(const double d, const Position& pos) {
-    return (ElementPtr(new DoubleElement(d, pos)));
+    return (boost::make_shared<DoubleElement>(d, pos));
 }
 
 ElementPtr
 Element::create(const bool b, const Position& pos) {
-    return (ElementPtr(new BoolElement(b, pos)));
+    return (boost::make_shared<BoolElement>(b, pos));
 }
 
 ElementPtr
 Element::create(const std::string& s, const Position& pos) {
-    return (ElementPtr(new StringElement(s, pos)));
+    return (boost::make_shared<StringElement>(s, pos));
 }
 
 ElementPtr
@@ -261,12 +432,12 @@ Element::create(const char *s, const Position& pos) {
 
 ElementPtr
 Element::createList(const Position& pos) {
-    return (ElementPtr(new ListElement(pos)));
+    return (boost::make_shared<ListElement>(pos));
 }
 
 ElementPtr
 Element::createMap(const Position& pos) {
-    return (ElementPtr(new MapElement(pos)));
+    return (boost::make_shared<MapElement>(pos));
 }
 
 
@@ -599,6 +770,362 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
     }
     return (map);
 }
+
+// Parser of JSON text held in a contiguous buffer.
+//
+// It follows the same grammar and reports the same errors at the same
+// positions as the stream based functions above, but it scans the buffer
+// in place: strings are copied in runs between the escapes and numbers
+// are converted without building an intermediate string.
+class JSONBufferParser {
+public:
+    JSONBufferParser(const char* data, const size_t length,
+                     const std::string& file, const bool track_position,
+                     const int line, const int pos)
+        : cur_(data), end_(data + length), file_(file),
+          track_position_(track_position), line_(line), pos_(pos) {
+    }
+
+    // Parses the value at the current position.
+    ElementPtr parse() {
+        skipWhitespace();
+        if (cur_ == end_) {
+            isc_throw(JSONError, "nothing read");
+        }
+        switch (*cur_) {
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+        case '0':
+        case '-':
+        case '+':
+        case '.':
+            return (parseNumber());
+        case 't':
+        case 'f':
+            return (parseBool());
+        case 'n':
+            return (parseNull());
+        case '"':
+            return (parseString());
+        case '[':
+            ++cur_;
+            ++pos_;
+            return (parseList());
+        case '{':
+            ++cur_;
+            ++pos_;
+            return (parseMap());
+        default:
+            ++pos_;
+            throwJSONError(std::string("error: unexpected character ") +
+                           std::string(1, *cur_), file_, line_, pos_);
+        }
+        return (ElementPtr());
+    }
+
+    // Throws if anything but whitespace follows the parsed value.
+    void checkEnd() {
+        skipWhitespace();
+        if (cur_ != end_) {
+            throwJSONError("Extra data", file_, line_, pos_);
+        }
+    }
+
+private:
+    static bool isWhitespace(const int c) {
+        switch (c) {
+        case ' ':
+        case '\b':
+        case '\f':
+        case '\n':
+        case '\r':
+        case '\t':
+            return (true);
+        default:
+            return (false);
+        }
+    }
+
+    int peek() const {
+        return (cur_ != end_ ? static_cast<unsigned char>(*cur_) : EOF);
+    }
+
+    int get() {
+        return (cur_ != end_ ? static_cast<unsigned char>(*cur_++) : EOF);
+    }
+
+    Element::Position position(const int pos) const {
+        if (track_position_) {
+            return (Element::Position(file_, line_, pos));
+        }
+        return (Element::ZERO_POSITION());
+    }
+
+    void skipWhitespace() {
+        while ((cur_ != end_) && isWhitespace(*cur_)) {
+            if (*cur_ == '\n') {
+                ++line_;
+                pos_ = 1;
+            } else {
+                ++pos_;
+            }
+            ++cur_;
+        }
+    }
+
+    // Same as skipTo() with the whitespace as the characters to skip.
+    int skipTo(const char* chars) {
+        int c = get();
+        ++pos_;
+        while (c != EOF) {
+            if (c == '\n') {
+                pos_ = 1;
+                ++line_;
+            }
+            if (isWhitespace(c)) {
+                c = get();
+                ++pos_;
+            } else if (charIn(c, chars)) {
+                skipWhitespace();
+                return (c);
+            } else {
+                throwJSONError(std::string("'") + std::string(1, c) +
+                               "' read, one of \"" + chars + "\" expected",
+                               file_, line_, pos_);
+            }
+        }
+        throwJSONError(std::string("EOF read, one of \"") + chars +
+                       "\" expected", file_, line_, pos_);
+        return (c);
+    }
+
+    int hexDigit(const int error_offset) {
+        const int d = peek();
+        if ((d >= '0') && (d <= '9')) {
+            return (d - '0');
+        } else if ((d >= 'A') && (d <= 'F')) {
+            return (d - 'A' + 10);
+        } else if ((d >= 'a') && (d <= 'f')) {
+            return (d - 'a' + 10);
+        }
+        throwJSONError("Not hexadecimal in unicode escape", file_, line_,
+                       pos_ - error_offset);
+        return (0);
+    }
+
+    // Returns the character escaped by the sequence following a backslash.
+    char unescape() {
+        int c;
+        switch (peek()) {
+        case '"':
+            c = '"';
+            break;
+        case '/':
+            c = '/';
+            break;
+        case '\\':
+            c = '\\';
+            break;
+        case 'b':
+            c = '\b';
+            break;
+        case 'f':
+            c = '\f';
+            break;
+        case 'n':
+            c = '\n';
+            break;
+        case 'r':
+            c = '\r';
+            break;
+        case 't':
+            c = '\t';
+            break;
+        case 'u':
+            ++cur_;
+            ++pos_;
+            if (peek() != '0') {
+                throwJSONError("Unsupported unicode escape", file_, line_,
+                               pos_);
+            }
+            ++cur_;
+            ++pos_;
+            if (peek() != '0') {
+                throwJSONError("Unsupported unicode escape", file_, line_,
+                               pos_ - 2);
+            }
+            ++cur_;
+            ++pos_;
+            c = hexDigit(3) << 4;
+            ++cur_;
+            ++pos_;
+            c |= hexDigit(4);
+            break;
+        default:
+            throwJSONError("Bad escape", file_, line_, pos_);
+        }
+        // drop the escaped char
+        ++cur_;
+        ++pos_;
+        return (static_cast<char>(c));
+    }
+
+    std::string parseStringValue() {
+        if (get() != '"') {
+            ++pos_;
+            throwJSONError("String expected", file_, line_, pos_);
+        }
+        ++pos_;
+        std::string value;
+        for (;;) {
+            const char* run = cur_;
+            while ((cur_ != end_) && (*cur_ != '"') && (*cur_ != '\\')) {
+                ++cur_;
+            }
+            value.append(run, cur_ - run);
+            pos_ += cur_ - run;
+            if (cur_ == end_) {
+                ++pos_;
+                throwJSONError("Unterminated string", file_, line_, pos_);
+            }
+            ++pos_;
+            if (*cur_++ == '"') {
+                break;
+            }
+            value.push_back(unescape());
+        }
+        return (value);
+    }
+
+    ElementPtr parseString() {
+        const int start_pos = pos_;
+        const std::string value = parseStringValue();
+        return (Element::create(value, position(start_pos)));
+    }
+
+    // Returns the length of the run of alphabetic characters.
+    size_t wordLength() const {
+        const char* p = cur_;
+        while ((p != end_) && isalpha(static_cast<unsigned char>(*p))) {
+            ++p;
+        }
+        return (p - cur_);
+    }
+
+    ElementPtr parseBool() {
+        const int start_pos = pos_;
+        const size_t length = wordLength();
+        const char* word = cur_;
+        cur_ += length;
+        pos_ += length;
+        if ((length == 4) && (std::strncmp(word, "true", 4) == 0)) {
+            return (Element::create(true, position(start_pos)));
+        } else if ((length == 5) && (std::strncmp(word, "false", 5) == 0)) {
+            return (Element::create(false, position(start_pos)));
+        }
+        throwJSONError(std::string("Bad boolean value: ") +
+                       std::string(word, length), file_, line_, start_pos);
+        return (ElementPtr());
+    }
+
+    ElementPtr parseNull() {
+        const int start_pos = pos_;
+        const size_t length = wordLength();
+        const char* word = cur_;
+        cur_ += length;
+        pos_ += length;
+        if ((length == 4) && (std::strncmp(word, "null", 4) == 0)) {
+            return (Element::create(position(start_pos)));
+        }
+        throwJSONError(std::string("Bad null value: ") +
+                       std::string(word, length), file_, line_, start_pos);
+        return (ElementPtr());
+    }
+
+    ElementPtr parseNumber() {
+        const int start_pos = pos_;
+        const char* number = cur_;
+        bool real = false;
+        while (cur_ != end_) {
+            const char c = *cur_;
+            if ((c == '.') || (c == 'e') || (c == 'E')) {
+                real = true;
+            } else if (!isdigit(static_cast<unsigned char>(c)) &&
+                       (c != '+') && (c != '-')) {
+                break;
+            }
+            ++cur_;
+        }
+        const size_t length = cur_ - number;
+        pos_ += length;
+        try {
+            if (real) {
+                return (Element::create(boost::lexical_cast<double>(number,
+                                                                    length),
+                                        position(start_pos)));
+            }
+            return (Element::create(boost::lexical_cast<int64_t>(number,
+                                                                 length),
+                                    position(start_pos)));
+        } catch (const boost::bad_lexical_cast&) {
+            throwJSONError(std::string("Number overflow: ") +
+                           std::string(number, length), file_, line_,
+                           start_pos);
+        }
+        return (ElementPtr());
+    }
+
+    ElementPtr parseList() {
+        ElementPtr list = Element::createList(position(pos_));
+        int c = 0;
+        skipWhitespace();
+        while ((c != EOF) && (c != ']')) {
+            if (peek() != ']') {
+                list->add(parse());
+                c = skipTo(",]");
+            } else {
+                c = get();
+                ++pos_;
+            }
+        }
+        return (list);
+    }
+
+    ElementPtr parseMap() {
+        ElementPtr map = Element::createMap(position(pos_));
+        skipWhitespace();
+        int c = peek();
+        if (c == EOF) {
+            throwJSONError(std::string("Unterminated map, <string> or } expected"),
+                           file_, line_, pos_);
+        } else if (c == '}') {
+            // empty map, skip closing curly
+            ++cur_;
+        } else {
+            while ((c != EOF) && (c != '}')) {
+                const std::string key = parseStringValue();
+                skipTo(":");
+                map->set(key, parse());
+                c = skipTo(",}");
+            }
+        }
+        return (map);
+    }
+
+    const char* cur_;
+    const char* const end_;
+    const std::string& file_;
+    const bool track_position_;
+    int line_;
+    int pos_;
+};
 } // unnamed namespace
 
 std::string
@@ -748,15 +1275,17 @@ Element::fromJSON(std::istream& in, const std::string& file, int& line,
 
 ElementPtr
 Element::fromJSON(const std::string& in, bool preproc) {
+    if (!preproc) {
+        return (fromJSONBuffer(in.data(), in.size()));
+    }
+
     std::stringstream ss;
     ss << in;
 
     int line = 1, pos = 1;
     stringstream filtered;
-    if (preproc) {
-        preprocess(ss, filtered);
-    }
-    ElementPtr result(fromJSON(preproc ? filtered : ss, "<string>", line, pos));
+    preprocess(ss, filtered);
+    ElementPtr result(fromJSON(filtered, "<string>", line, pos));
     skipChars(ss, WHITESPACE, line, pos);
     // ss must now be at end
     if (ss.peek() != EOF) {
@@ -765,6 +1294,15 @@ Element::fromJSON(const std::string& in, bool preproc) {
     return result;
 }
 
+ElementPtr
+Element::fromJSONBuffer(const char* data, const size_t length,
+                        const std::string& file, const bool track_position) {
+    JSONBufferParser parser(data, length, file, track_position, 1, 1);
+    ElementPtr result = parser.parse();
+    parser.checkEnd();
+    return (result);
+}
+
 ElementPtr
 Element::fromJSONFile(const std::string& file_name,
                       bool preproc) {
@@ -928,10 +1466,9 @@ MapElement::find(const std::string& id) const {
 
 ElementPtr
 Element::fromWire(const std::string& s) {
-    std::stringstream ss;
-    ss << s;
-    int line = 0, pos = 0;
-    return (fromJSON(ss, "<wire>", line, pos));
+    const std::string file("<wire>");
+    JSONBufferParser parser(s.data(), s.size(), file, true, 0, 0);
+    return (parser.parse());
 }
 
 ElementPtr
@@ -1128,17 +1665,17 @@ copy(ConstElementPtr from, int level) {
     }
     int from_type = from->getType();
     if (from_type == Element::integer) {
-        return (ElementPtr(new IntElement(from->intValue())));
+        return (boost::make_shared<IntElement>(from->intValue()));
     } else if (from_type == Element::real) {
-        return (ElementPtr(new DoubleElement(from->doubleValue())));
+        return (boost::make_shared<DoubleElement>(from->doubleValue()));
     } else if (from_type == Element::boolean) {
-        return (ElementPtr(new BoolElement(from->boolValue())));
+        return (boost::make_shared<BoolElement>(from->boolValue()));
     } else if (from_type == Element::null) {
-        return (ElementPtr(new NullElement()));
+        return (boost::make_shared<NullElement>());
     } else if (from_type == Element::string) {
-        return (ElementPtr(new StringElement(from->stringValue())));
+        return (boost::make_shared<StringElement>(from->stringValue()));
     } else if (from_type == Element::list) {
-        ElementPtr result = ElementPtr(new ListElement());
+        ElementPtr result = boost::make_shared<ListElement>();
         typedef std::vector<ElementPtr> ListType;
         const ListType& value = from->listValue();
         for (ListType::const_iterator it = value.cbegin();
@@ -1151,7 +1688,7 @@ copy(ConstElementPtr from, int level) {
         }
         return (result);
     } else if (from_type == Element::map) {
-        ElementPtr result = ElementPtr(new MapElement());
+        ElementPtr result = boost::make_shared<MapElement>();
         typedef std::map<std::string, ConstElementPtr> MapType;
         const MapType& value = from->mapValue();
         for (MapType::const_iterator it = value.cbegin();
@@ -7,6 +7,7 @@
 #ifndef ISC_DATA_H
 #define ISC_DATA_H 1
 
+#include <atomic>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -128,8 +129,34 @@ private:
     // function getType?
     int type_;
 
-    /// @brief Position of the element in the configuration string.
-    Position position_;
+    /// @brief Line number of the element in the configuration string.
+    ///
+    /// The position is not held in a @c Position structure because
+    /// the file name would be copied into each element. The elements
+    /// point to a single copy of each file name instead.
+    uint32_t line_;
+
+    /// @brief Position of the element within the line.
+    uint32_t pos_;
+
+    /// @brief Interned name of the file holding the element.
+    const std::string* file_;
+
+    /// @brief Position returned by @c getPosition, built on the first call.
+    ///
+    /// It is only built for the elements whose position is asked for,
+    /// typically when a configuration error is reported.
+    mutable std::atomic<Position*> position_;
+
+    /// @brief Returns the interned copy of a file name.
+    ///
+    /// The copies are never released: a process reads configurations
+    /// from few files.
+    ///
+    /// @param file File name.
+    /// @return Pointer to the copy of the file name shared by all
+    /// elements read from this file.
+    static const std::string* internFileName(const std::string& file);
 
 protected:
 
@@ -140,7 +167,8 @@ protected:
     /// It comprises the line number and the position within this line. The values
     /// held in this structure are used for error logging purposes.
     Element(int t, const Position& pos = ZERO_POSITION())
-        : type_(t), position_(pos) {
+        : type_(t), line_(pos.line_), pos_(pos.pos_),
+          file_(internFileName(pos.file_)), position_(0) {
     }
 
 
@@ -149,8 +177,32 @@ public:
     // any is a special type used in list specifications, specifying
     // that the elements can be of any type
     enum types { integer, real, boolean, null, string, list, map, any };
+    /// @brief Copy constructor.
+    ///
+    /// @param other Element to be copied.
+    Element(const Element& other)
+        : type_(other.type_), line_(other.line_), pos_(other.pos_),
+          file_(other.file_), position_(0) {
+    }
+
+    /// @brief Assignment operator.
+    ///
+    /// @param other Element to be copied.
+    Element& operator=(const Element& other) {
+        if (this != &other) {
+            type_ = other.type_;
+            line_ = other.line_;
+            pos_ = other.pos_;
+            file_ = other.file_;
+            delete position_.exchange(0);
+        }
+        return (*this);
+    }
+
     // base class; make dtor virtual
-    virtual ~Element() {};
+    virtual ~Element() {
+        delete position_.load();
+    };
 
     /// @return the type of this element
     int getType() const { return (type_); }
@@ -160,7 +212,7 @@ public:
     ///
     /// @warning The returned reference is valid as long as the object which
     /// created it lives.
-    const Position& getPosition() const { return (position_); }
+    const Position& getPosition() const;
 
     /// Returns a string representing the Element and all its
     /// child elements; note that this is different from stringValue(),
@@ -178,15 +230,26 @@ public:
     std::string toWire() const;
     void toWire(std::ostream& out) const;
 
+    /// @brief Appends the Element and all its child elements in JSON
+    /// format to a string.
+    ///
+    /// The text is the same as the one produced by @c toJSON, but it is
+    /// written directly to the string rather than through a stream. This
+    /// is the fast path used by @c str and @c toWire. The caller may
+    /// reserve the capacity of the string beforehand.
+    ///
+    /// @param out string to which the JSON text is appended.
+    void appendJSON(std::string& out) const;
+
     /// @brief Add the position to a TypeError message
     /// should be used in place of isc_throw(TypeError, error)
 #define throwTypeError(error)                   \
     {                                           \
         std::string msg_ = error;               \
-        if ((position_.file_ != "") ||          \
-            (position_.line_ != 0) ||           \
-            (position_.pos_ != 0)) {            \
-            msg_ += " in (" + position_.str() + ")";   \
+        if ((!file_->empty()) ||                \
+            (line_ != 0) ||                     \
+            (pos_ != 0)) {                      \
+            msg_ += " in (" + getPosition().str() + ")";   \
         }                                       \
         isc_throw(TypeError, msg_);             \
     }
@@ -461,6 +524,27 @@ public:
     static ElementPtr fromJSON(std::istream& in, const std::string& file,
                                int& line, int &pos);
 
+    /// Creates an Element from JSON text held in a contiguous buffer.
+    ///
+    /// This is faster than parsing from a stream: the buffer is scanned
+    /// in place and the strings are copied in runs rather than character
+    /// by character. The buffer must hold a single JSON value, optionally
+    /// surrounded by whitespace. The text is not preprocessed.
+    ///
+    /// @param data pointer to the JSON text.
+    /// @param length length of the JSON text.
+    /// @param file name of the input used in error reporting.
+    /// @param track_position when false, the positions of the elements
+    /// are not recorded and all elements have the @c ZERO_POSITION. This
+    /// saves time and memory when the text is not a configuration, e.g.
+    /// a command response. The parse errors still report the position.
+    /// @throw JSONError
+    /// @return An ElementPtr that contains the element(s) specified
+    /// in the given buffer.
+    static ElementPtr fromJSONBuffer(const char* data, const size_t length,
+                                     const std::string& file = "<string>",
+                                     const bool track_position = true);
+
     /// Reads contents of specified file and interprets it as JSON.
     ///
     /// @param file_name name of the file to read
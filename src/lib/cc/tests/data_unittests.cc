@@ -1370,6 +1370,51 @@ TEST(Element, getPositionCommented) {
     EXPECT_EQ("kea.conf", level2_el->getPosition().file_);
 }
 
+// This test verifies that the position of an element is kept when the
+// element is created, copied to its users and reported in the errors.
+TEST(Element, positionFileName) {
+    const std::string file = "/etc/kea/a-rather-long-configuration-file.json";
+    ElementPtr first = Element::create(1, Element::Position(file, 10, 20));
+    ElementPtr second = Element::create("x", Element::Position(file, 11, 5));
+    ElementPtr other = Element::create(true, Element::Position("other", 1, 1));
+
+    EXPECT_EQ(file, first->getPosition().file_);
+    EXPECT_EQ(10, first->getPosition().line_);
+    EXPECT_EQ(20, first->getPosition().pos_);
+    EXPECT_EQ(file + ":11:5", second->getPosition().str());
+    EXPECT_EQ("other:1:1", other->getPosition().str());
+    EXPECT_EQ(":0:0", Element::create(2)->getPosition().str());
+
+    try {
+        second->intValue();
+        ADD_FAILURE() << "expected TypeError";
+    } catch (const TypeError& ex) {
+        EXPECT_EQ("intValue() called on non-integer Element in (" + file +
+                  ":11:5)", std::string(ex.what()));
+    }
+}
+
+// This test verifies that getPosition() returns a reference to the same
+// position on every call, and that a copied element has its own position.
+TEST(Element, positionReference) {
+    ElementPtr elem = Element::create(1, Element::Position("kea.conf", 3, 4));
+    const Element::Position& position = elem->getPosition();
+    EXPECT_EQ(&position, &elem->getPosition());
+    EXPECT_EQ("kea.conf:3:4", position.str());
+
+    // Elements without a position share the zero position.
+    EXPECT_EQ(&Element::ZERO_POSITION(), &Element::create(2)->getPosition());
+
+    IntElement copied(*boost::dynamic_pointer_cast<IntElement>(elem));
+    EXPECT_NE(&position, &copied.getPosition());
+    EXPECT_EQ("kea.conf:3:4", copied.getPosition().str());
+
+    IntElement assigned(5);
+    EXPECT_EQ(":0:0", assigned.getPosition().str());
+    assigned = copied;
+    EXPECT_EQ("kea.conf:3:4", assigned.getPosition().str());
+}
+
 TEST(Element, empty) {
 
     // Let's try Map first
@@ -1388,4 +1433,89 @@ TEST(Element, empty) {
     l->remove(0);
     EXPECT_TRUE(l->empty());
 }
+
+// This test verifies that the buffer parser produces the same elements,
+// positions and errors as the stream parser.
+TEST(Element, fromJSONBuffer) {
+    const std::string config = "{\n"
+        "    \"a\":  2,\n"
+        "    \"b\": [ true, null, \"x\\ty\\u00e9\" ],\n"
+        "    \"c\": { \"d\": -1.5e3 }\n"
+        "}\n";
+
+    std::istringstream ss(config);
+    ElementPtr from_stream = Element::fromJSON(ss, string("kea.conf"));
+    ElementPtr from_buffer;
+    ASSERT_NO_THROW(from_buffer = Element::fromJSONBuffer(config.data(),
+                                                          config.size(),
+                                                          "kea.conf"));
+    ASSERT_TRUE(from_buffer);
+    EXPECT_TRUE(from_stream->equals(*from_buffer));
+
+    // Positions are the same.
+    ConstElementPtr b = from_buffer->get("b");
+    ASSERT_TRUE(b);
+    EXPECT_EQ(from_stream->get("b")->getPosition().str(),
+              b->getPosition().str());
+    ASSERT_EQ(3, b->size());
+    EXPECT_EQ(from_stream->get("b")->get(2)->getPosition().str(),
+              b->get(2)->getPosition().str());
+    EXPECT_EQ("kea.conf:3:24", b->get(2)->getPosition().str());
+    EXPECT_EQ(from_stream->get("c")->get("d")->getPosition().str(),
+              from_buffer->get("c")->get("d")->getPosition().str());
+
+    // Without the position tracking the elements have no position.
+    ASSERT_NO_THROW(from_buffer = Element::fromJSONBuffer(config.data(),
+                                                          config.size(),
+                                                          "kea.conf",
+                                                          false));
+    EXPECT_TRUE(from_stream->equals(*from_buffer));
+    EXPECT_EQ(Element::ZERO_POSITION().str(),
+              from_buffer->get("b")->get(2)->getPosition().str());
+
+    // The buffer doesn't have to be null terminated.
+    const std::string text = "[ 1, 2 ]3";
+    ElementPtr list = Element::fromJSONBuffer(text.data(), text.size() - 1);
+    EXPECT_EQ("[ 1, 2 ]", list->str());
+
+    // Errors report the position even without the tracking.
+    const std::string bad = "{ \"a\": 1,\n  \"b\" 2 }";
+    try {
+        Element::fromJSONBuffer(bad.data(), bad.size(), "<string>", false);
+        ADD_FAILURE() << "expected JSONError";
+    } catch (const JSONError& ex) {
+        EXPECT_EQ("'2' read, one of \":\" expected in <string>:2:8",
+                  std::string(ex.what()));
+    }
+    EXPECT_THROW(Element::fromJSONBuffer(text.data(), text.size()),
+                 JSONError);
+    EXPECT_THROW(Element::fromJSONBuffer(text.data(), 0), JSONError);
+}
+
+// This test verifies that appendJSON produces the same text as toJSON.
+TEST(Element, appendJSON) {
+    ElementPtr map = Element::createMap();
+    map->set("integer", Element::create(-12345678901LL));
+    map->set("real", Element::create(3.0));
+    map->set("small", Element::create(1.5e-7));
+    map->set("bool", Element::create(false));
+    map->set("null", Element::create());
+    map->set("string", Element::create(std::string("q\"b\\\b\f\n\r\t\x01\x7f\xe9/")));
+    ElementPtr list = Element::createList();
+    list->add(Element::create("a"));
+    list->add(Element::createMap());
+    list->add(Element::createList());
+    map->set("list", list);
+    map->set("none", ConstElementPtr());
+
+    std::ostringstream ss;
+    map->toJSON(ss);
+    EXPECT_EQ(ss.str(), map->str());
+    EXPECT_EQ(ss.str(), map->toWire());
+
+    // The text is appended.
+    std::string out = "prefix ";
+    list->appendJSON(out);
+    EXPECT_EQ("prefix [ \"a\", {  }, [  ] ]", out);
+}
 }
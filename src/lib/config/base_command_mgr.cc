@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -44,6 +44,31 @@ BaseCommandMgr::BaseCommandMgr() {
                                                  this, _1, _2));
 }
 
+void
+BaseCommandMgr::callCommandProcessedCallouts(const std::string& name,
+                                             const ConstElementPtr& arg,
+                                             ConstElementPtr& response) {
+    // If there any callouts for command-processed hook point call them
+    if (HooksManager::calloutsPresent(Hooks.hook_index_command_processed_)) {
+        // Commands are not associated with anything so there's no pre-existing
+        // callout.
+        CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
+
+        // Add the command name, arguments, and response to the callout context
+        callout_handle->setArgument("name", name);
+        callout_handle->setArgument("arguments", arg);
+        callout_handle->setArgument("response", response);
+
+        // Call callouts
+        HooksManager::callCallouts(Hooks.hook_index_command_processed_,
+                                    *callout_handle);
+
+        // Refresh the response from the callout context in case it was modified.
+        // @todo Should we allow this?
+        callout_handle->getArgument("response", response);
+    }
+}
+
 void
 BaseCommandMgr::registerCommand(const std::string& cmd, CommandHandler handler) {
     if (!handler) {
@@ -125,25 +150,7 @@ BaseCommandMgr::processCommand(const isc::data::ConstElementPtr& cmd) {
 
         ConstElementPtr response = handleCommand(name, arg, cmd);
 
-        // If there any callouts for command-processed hook point call them
-        if (HooksManager::calloutsPresent(Hooks.hook_index_command_processed_)) {
-            // Commands are not associated with anything so there's no pre-existing
-            // callout.
-            CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
-
-            // Add the command name, arguments, and response to the callout context
-            callout_handle->setArgument("name", name);
-            callout_handle->setArgument("arguments", arg);
-            callout_handle->setArgument("response", response);
-
-            // Call callouts
-            HooksManager::callCallouts(Hooks.hook_index_command_processed_,
-                                        *callout_handle);
-
-            // Refresh the response from the callout context in case it was modified.
-            // @todo Should we allow this?
-            callout_handle->getArgument("response", response);
-        }
+        callCommandProcessedCallouts(name, arg, response);
 
         return (response);
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -169,6 +169,20 @@ protected:
                   const isc::data::ConstElementPtr& params,
                   const isc::data::ConstElementPtr& original_cmd);
 
+    /// @brief Invokes the callouts for the "command_processed" hook point.
+    ///
+    /// This is called by @ref processCommand after the command has been
+    /// handled. The derived classes handling commands asynchronously call
+    /// it when the response is available.
+    ///
+    /// @param name Command name.
+    /// @param arg Command arguments.
+    /// @param [in,out] response Response to the command which the callouts
+    /// may replace.
+    void callCommandProcessedCallouts(const std::string& name,
+                                      const isc::data::ConstElementPtr& arg,
+                                      isc::data::ConstElementPtr& response);
+
     struct HandlersPair {
         CommandHandler handler;
         ExtendedCommandHandler extended_handler;
@@ -9,10 +9,13 @@
 #include <config.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <config/response_stream.h>
 #include <hooks/hooks.h>
 #include <exceptions/exceptions.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 namespace isc {
 namespace config {
@@ -65,6 +68,27 @@ protected:
         handle.setArgument ("response", response);
     }
 
+    /// @brief Checks if the caller accepts a streamed response
+    ///
+    /// @param handle Callout context handle
+    /// @return true if the "response-stream" argument is present
+    bool isResponseStreamAccepted(hooks::CalloutHandle& handle) const {
+        const std::vector<std::string> names = handle.getArgumentNames();
+        return (std::find(names.begin(), names.end(), "response-stream") !=
+                names.end());
+    }
+
+    /// @brief Set the callout argument "response-stream" to the given stream
+    ///
+    /// The "response" argument is left empty.
+    ///
+    /// @param handle Callout context handle in which to set the argument
+    /// @param stream stream producing the response
+    void setResponseStream(hooks::CalloutHandle& handle,
+                           const ResponseStreamPtr& stream) {
+        handle.setArgument("response-stream", stream);
+    }
+
     /// @brief Stores the command name extracted by a call to extractCommand
     std::string cmd_name_;
 
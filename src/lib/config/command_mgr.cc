@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -19,22 +19,267 @@
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
 #include <config/timeouts.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
 #include <util/watch_socket.h>
 #include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
 #include <array>
+#include <list>
+#include <vector>
 #include <unistd.h>
 
 using namespace isc;
 using namespace isc::asiolink;
 using namespace isc::config;
 using namespace isc::data;
+using namespace isc::util::thread;
 
 namespace {
 
 /// @brief Maximum size of the data chunk sent/received over the socket.
 const size_t BUF_SIZE = 32768;
 
+/// @brief Maximum number of the command threads.
+const int64_t MAX_COMMAND_THREADS = 64;
+
+/// @brief Text of the error response sent when the first part of a
+/// streamed response can't be produced.
+const char* STREAM_FAILED_TEXT =
+    "internal server error: failed to produce the response";
+
+/// @brief Runs the jobs producing the responses to the commands in the
+/// command threads.
+///
+/// The server processes the commands on its main thread, between the
+/// packets. The commands which only read the server state take a snapshot
+/// of it and may leave producing the response out of the snapshot, e.g.
+/// converting a large configuration to text, to a command thread. The
+/// commands which modify the server state are still processed on the main
+/// thread, so they never run concurrently with the packet processing.
+///
+/// The completion handler of a job is posted to the IO service of the
+/// server, so it is invoked by the main thread. The watch socket installed
+/// in the Interface Manager breaks the synchronous @c select() call of the
+/// DHCP servers when a job completes.
+class CommandExecutor : public boost::noncopyable {
+public:
+
+    /// @brief Type of a job and of its completion handler.
+    typedef boost::function<void()> Job;
+
+    /// @brief Constructor.
+    CommandExecutor()
+        : io_service_(), threads_(), jobs_(), stopping_(false), mutex_(),
+          cond_var_(), watch_socket_() {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Stops the command threads.
+    ~CommandExecutor() {
+        try {
+            stop();
+        } catch (...) {
+            // Nothing we can do about it.
+        }
+    }
+
+    /// @brief Starts the command threads.
+    ///
+    /// The threads already running are stopped first.
+    ///
+    /// @param io_service IO service to which the completion handlers are
+    /// posted.
+    /// @param threads_num Number of the threads, no thread is started if
+    /// it is 0.
+    void start(const IOServicePtr& io_service, const size_t threads_num);
+
+    /// @brief Stops the command threads.
+    ///
+    /// The jobs already submitted are run before the threads exit.
+    void stop();
+
+    /// @brief Returns the number of the running command threads.
+    size_t getThreadsNum() const {
+        return (threads_.size());
+    }
+
+    /// @brief Submits a job.
+    ///
+    /// The jobs are picked by the command threads in the order in which
+    /// they have been submitted. This must only be called when the threads
+    /// are running.
+    ///
+    /// @param job Job to be run by a command thread.
+    /// @param handler Handler invoked by the main thread when the job has
+    /// completed.
+    void run(const Job& job, const Job& handler);
+
+private:
+
+    /// @brief Main function of a command thread.
+    void worker();
+
+    /// @brief Invokes the completion handler of a job.
+    ///
+    /// @param handler Handler to be invoked.
+    void complete(const Job& handler);
+
+    /// @brief IO service to which the completion handlers are posted.
+    IOServicePtr io_service_;
+
+    /// @brief Command threads.
+    std::vector<boost::shared_ptr<Thread> > threads_;
+
+    /// @brief Jobs waiting for a command thread with their handlers.
+    std::list<std::pair<Job, Job> > jobs_;
+
+    /// @brief Indicates if the threads should exit when no job is left.
+    bool stopping_;
+
+    /// @brief Mutex protecting the members above and the watch socket.
+    Mutex mutex_;
+
+    /// @brief Condition variable signalled when a job is submitted.
+    CondVar cond_var_;
+
+    /// @brief Watch socket marked ready when a completion handler has been
+    /// posted.
+    util::WatchSocketPtr watch_socket_;
+};
+
+void
+CommandExecutor::start(const IOServicePtr& io_service,
+                       const size_t threads_num) {
+    stop();
+    if (threads_num == 0) {
+        return;
+    }
+
+    io_service_ = io_service;
+    if (!watch_socket_) {
+        watch_socket_.reset(new util::WatchSocket());
+    }
+    // Callback value of 0 is used to indicate that callback function is
+    // not installed.
+    isc::dhcp::IfaceMgr::instance().addExternalSocket(watch_socket_->getSelectFd(), 0);
+
+    stopping_ = false;
+    for (size_t i = 0; i < threads_num; ++i) {
+        threads_.push_back(boost::shared_ptr<Thread>
+                           (new Thread(boost::bind(&CommandExecutor::worker,
+                                                   this))));
+    }
+}
+
+void
+CommandExecutor::stop() {
+    if (threads_.empty()) {
+        return;
+    }
+
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = true;
+        for (size_t i = 0; i < threads_.size(); ++i) {
+            cond_var_.signal();
+        }
+    }
+    for (auto thread = threads_.begin(); thread != threads_.end(); ++thread) {
+        (*thread)->wait();
+    }
+    threads_.clear();
+
+    // The handlers already posted are still invoked. The watch socket is
+    // kept for them.
+    isc::dhcp::IfaceMgr::instance().deleteExternalSocket(watch_socket_->getSelectFd());
+}
+
+void
+CommandExecutor::run(const Job& job, const Job& handler) {
+    Mutex::Locker lock(mutex_);
+    jobs_.push_back(std::make_pair(job, handler));
+    cond_var_.signal();
+}
+
+void
+CommandExecutor::worker() {
+    for (;;) {
+        std::pair<Job, Job> job;
+        {
+            Mutex::Locker lock(mutex_);
+            while (jobs_.empty()) {
+                if (stopping_) {
+                    return;
+                }
+                cond_var_.wait(mutex_);
+            }
+            job = jobs_.front();
+            jobs_.pop_front();
+        }
+
+        try {
+            job.first();
+        } catch (...) {
+            // The jobs report their errors to their handlers.
+        }
+
+        Mutex::Locker lock(mutex_);
+        io_service_->post(boost::bind(&CommandExecutor::complete, this,
+                                      job.second));
+        try {
+            watch_socket_->markReady();
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_WATCH_SOCKET_MARK_READY_ERROR)
+                .arg(ex.what());
+        }
+    }
+}
+
+void
+CommandExecutor::complete(const Job& handler) {
+    // The handlers posted before the watch socket is cleared are already
+    // in the IO service, so they are invoked by the same poll.
+    {
+        Mutex::Locker lock(mutex_);
+        try {
+            watch_socket_->clearReady();
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_WATCH_SOCKET_CLEAR_ERROR)
+                .arg(ex.what());
+        }
+    }
+    handler();
+}
+
+/// @brief Part of a streamed response produced by a command thread.
+struct ResponsePart {
+    /// @brief Constructor.
+    ResponsePart()
+        : text_(), more_(true), failed_(false), error_() {
+    }
+
+    /// @brief Text of the part.
+    std::string text_;
+
+    /// @brief Indicates if more parts follow.
+    bool more_;
+
+    /// @brief Indicates if the stream has failed to produce the part.
+    bool failed_;
+
+    /// @brief Reason of the failure.
+    std::string error_;
+};
+
+/// @brief Pointer to the @c ResponsePart.
+typedef boost::shared_ptr<ResponsePart> ResponsePartPtr;
+
 class ConnectionPool;
 
 /// @brief Represents a single connection over control socket.
@@ -60,14 +305,19 @@ public:
     /// for data transmission.
     /// @param connection_pool Reference to the connection pool to which this
     /// connection belongs.
+    /// @param executor Reference to the executor of the command threads.
     /// @param timeout Connection timeout (in seconds).
     Connection(const IOServicePtr& io_service,
                const boost::shared_ptr<UnixDomainSocket>& socket,
                ConnectionPool& connection_pool,
+               CommandExecutor& executor,
                const long timeout)
         : socket_(socket), timeout_timer_(*io_service), timeout_(timeout),
-          buf_(), response_(), connection_pool_(connection_pool), feed_(),
-          response_in_progress_(false), watch_socket_(new util::WatchSocket()) {
+          buf_(), response_(), response_stream_(),
+          connection_pool_(connection_pool), executor_(executor),
+          feed_(new JSONFeed()), response_in_progress_(false),
+          keep_alive_(false), idle_(false), command_name_(), command_start_(),
+          watch_socket_(new util::WatchSocket()) {
 
         LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_CONNECTION_OPENED)
             .arg(socket_->getNative());
@@ -78,7 +328,7 @@ public:
         isc::dhcp::IfaceMgr::instance().addExternalSocket(socket_->getNative(), 0);
 
         // Initialize state model for receiving and preparsing commands.
-        feed_.initModel();
+        feed_->initModel();
 
         // Start timer for detecting timeouts.
         scheduleTimer();
@@ -129,6 +379,19 @@ public:
     /// graceful shutdown.
     void terminate();
 
+    /// @brief Waits for the next command over a connection kept open.
+    ///
+    /// Resets the state of the connection as it was when it was opened.
+    void waitNextCommand() {
+        keep_alive_ = false;
+        idle_ = true;
+        command_name_.clear();
+        feed_.reset(new JSONFeed());
+        feed_->initModel();
+        scheduleTimer();
+        doReceive();
+    }
+
     /// @brief Start asynchronous read over the unix domain socket.
     ///
     /// This method doesn't block. Once the transmission is received over the
@@ -164,6 +427,76 @@ public:
         }
     }
 
+    /// @brief Appends the next part of the streamed response to the data
+    /// to be sent.
+    ///
+    /// The stream is released when it has produced its last part or when
+    /// it has failed.
+    ///
+    /// @return false if the stream has failed to produce the next part.
+    bool nextResponsePart() {
+        try {
+            while (response_.empty() && response_stream_) {
+                if (!response_stream_->next(response_)) {
+                    response_stream_.reset();
+                }
+            }
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_RESPONSE_STREAM_FAILED)
+                .arg(socket_->getNative()).arg(ex.what());
+            response_stream_.reset();
+            return (false);
+        }
+        return (true);
+    }
+
+    /// @brief Checks if the next part of the streamed response should be
+    /// produced by a command thread.
+    bool isConcurrentStream() const {
+        return (response_stream_ && response_stream_->isConcurrent() &&
+                (executor_.getThreadsNum() > 0));
+    }
+
+    /// @brief Asks a command thread for the next part of the streamed
+    /// response.
+    ///
+    /// The server processes other events while the part is being produced.
+    /// The connection doesn't time out in the meantime.
+    ///
+    /// @param first Indicates if this is the first part of the response.
+    void nextResponsePartAsync(const bool first) {
+        timeout_timer_.cancel();
+
+        ResponseStreamPtr stream = response_stream_;
+        ResponsePartPtr part(new ResponsePart());
+        executor_.run([stream, part]() {
+            try {
+                while (part->text_.empty() && part->more_) {
+                    part->more_ = stream->next(part->text_);
+                }
+
+            } catch (const std::exception& ex) {
+                part->failed_ = true;
+                part->error_ = ex.what();
+            }
+        }, boost::bind(&Connection::responsePartProduced, shared_from_this(),
+                       part, first));
+    }
+
+    /// @brief Handler invoked when a command thread has produced the next
+    /// part of the streamed response.
+    ///
+    /// @param part Part of the response.
+    /// @param first Indicates if this is the first part of the response.
+    void responsePartProduced(const ResponsePartPtr& part, const bool first);
+
+    /// @brief Completes the command when the whole response has been sent.
+    ///
+    /// Reports how long it has taken to process the command and closes the
+    /// connection, unless the client has asked to keep it open.
+    void responseSent();
+
     /// @brief Handler invoked when the data is received over the control
     /// socket.
     ///
@@ -184,7 +517,7 @@ public:
     ///
     /// If there are still data to be sent, another asynchronous send is
     /// scheduled. When the entire command is sent, the connection is shutdown
-    /// and closed.
+    /// and closed, unless the client has asked to keep it open.
     ///
     /// @param ec Error code.
     /// @param bytes_transferred Number of bytes sent.
@@ -194,7 +527,8 @@ public:
     /// @brief Handler invoked when timeout has occurred.
     ///
     /// Asynchronously sends a response to the client indicating that the
-    /// timeout has occurred.
+    /// timeout has occurred. If the connection is idle after a response,
+    /// simply closes it.
     void timeoutHandler();
 
 private:
@@ -212,19 +546,41 @@ private:
     std::array<char, BUF_SIZE> buf_;
 
     /// @brief Response created by the server.
+    ///
+    /// When the response is streamed it holds the part being sent.
     std::string response_;
 
+    /// @brief Stream producing the remaining parts of the response.
+    ResponseStreamPtr response_stream_;
+
     /// @brief Reference to the pool of connections.
     ConnectionPool& connection_pool_;
 
+    /// @brief Reference to the executor of the command threads.
+    CommandExecutor& executor_;
+
     /// @brief State model used to receive data over the connection and detect
     /// when the command ends.
-    JSONFeed feed_;
+    JSONFeedPtr feed_;
 
     /// @brief Boolean flag indicating if the request to stop connection is a
     /// result of server reconfiguration.
     bool response_in_progress_;
 
+    /// @brief Boolean flag indicating if the client has asked to keep the
+    /// connection open after the response to the current command.
+    bool keep_alive_;
+
+    /// @brief Boolean flag indicating if the connection is kept open and
+    /// waits for the next command.
+    bool idle_;
+
+    /// @brief Name of the command being processed, empty if none.
+    std::string command_name_;
+
+    /// @brief Time when the command being processed has been received.
+    boost::posix_time::ptime command_start_;
+
     /// @brief Pointer to watch socket instance used to signal that the socket
     /// is ready for read or write.
     util::WatchSocketPtr watch_socket_;
@@ -291,12 +647,12 @@ Connection::receiveHandler(const boost::system::error_code& ec,
     if (ec) {
         if (ec.value() == boost::asio::error::eof) {
             std::stringstream os;
-            if (feed_.getProcessedText().empty()) {
+            if (feed_->getProcessedText().empty()) {
                os << "no input data to discard";
             }
             else {
                os << "discarding partial command of "
-                  << feed_.getProcessedText().size() << " bytes";
+                  << feed_->getProcessedText().size() << " bytes";
             }
 
             // Foreign host has closed the connection. We should remove it from the
@@ -322,31 +678,55 @@ Connection::receiveHandler(const boost::system::error_code& ec,
 
     // Reschedule the timer because the transaction is ongoing.
     scheduleTimer();
+    idle_ = false;
 
     ConstElementPtr rsp;
 
     try {
         // Received some data over the socket. Append them to the JSON feed
         // to see if we have reached the end of command.
-        feed_.postBuffer(&buf_[0], bytes_transferred);
-        feed_.poll();
+        feed_->postBuffer(&buf_[0], bytes_transferred);
+        feed_->poll();
         // If we haven't yet received the full command, continue receiving.
-        if (feed_.needData()) {
+        if (feed_->needData()) {
             doReceive();
             return;
         }
 
         // Received entire command. Parse the command into JSON.
-        if (feed_.feedOk()) {
-            ConstElementPtr cmd = feed_.toElement();
+        if (feed_->feedOk()) {
+            ConstElementPtr cmd = feed_->toElement();
             response_in_progress_ = true;
 
+            // The processing time is reported when the response is sent.
+            command_start_ = boost::posix_time::microsec_clock::universal_time();
+            ConstElementPtr name = (cmd->getType() == Element::map) ?
+                cmd->get(CONTROL_COMMAND) : ConstElementPtr();
+            if (name && (name->getType() == Element::string)) {
+                command_name_ = name->stringValue();
+            }
+
+            // Keeping the connection open is a property of the connection
+            // rather than of the command, so the flag is removed before
+            // the command is processed.
+            if ((cmd->getType() == Element::map) &&
+                cmd->contains(CONTROL_KEEP_ALIVE)) {
+                ConstElementPtr keep_alive = cmd->get(CONTROL_KEEP_ALIVE);
+                keep_alive_ = ((keep_alive->getType() == Element::boolean) &&
+                               keep_alive->boolValue());
+                ElementPtr stripped_cmd = copy(cmd, 0);
+                stripped_cmd->remove(CONTROL_KEEP_ALIVE);
+                cmd = stripped_cmd;
+            }
+
             // Cancel the timer to make sure that long lasting command
             // processing doesn't cause the timeout.
             timeout_timer_.cancel();
 
-            // If successful, then process it as a command.
-            rsp = CommandMgr::instance().processCommand(cmd);
+            // If successful, then process it as a command. The response
+            // to some commands may be streamed.
+            rsp = CommandMgr::instance().processCommandStream(cmd,
+                                                              response_stream_);
 
             response_in_progress_ = false;
 
@@ -354,16 +734,35 @@ Connection::receiveHandler(const boost::system::error_code& ec,
             // Failed to parse command as JSON or process the received command.
             // This exception will be caught below and the error response will
             // be sent.
-            isc_throw(BadValue, feed_.getErrorMessage());
+            isc_throw(BadValue, feed_->getErrorMessage());
         }
 
     } catch (const Exception& ex) {
         LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg(ex.what());
         rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
+        response_stream_.reset();
     }
 
+    if (response_stream_) {
+        // The response is sent in parts as they are produced. Nothing has
+        // been sent yet, so an error response can still be sent if the
+        // first part can't be produced.
+        scheduleTimer();
+        if (isConcurrentStream()) {
+            nextResponsePartAsync(true);
+            return;
+        }
+        if (!nextResponsePart()) {
+            response_ = createAnswer(CONTROL_RESULT_ERROR,
+                                     STREAM_FAILED_TEXT)->str();
+        }
+        if (!response_.empty()) {
+            doSend();
+            return;
+        }
+
     // No response generated. Connection will be closed.
-    if (!rsp) {
+    } else if (!rsp) {
         LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
         rsp = createAnswer(CONTROL_RESULT_ERROR,
                            "internal server error: no response generated");
@@ -420,25 +819,111 @@ Connection::sendHandler(const boost::system::error_code& ec,
             .arg(bytes_transferred).arg(response_.size())
             .arg(socket_->getNative());
 
+        // The part of the streamed response has been sent. Produce the
+        // next one. This is done here rather than at once so as the server
+        // processes other events in between.
+        if (response_.empty() && isConcurrentStream()) {
+            nextResponsePartAsync(false);
+            return;
+        }
+        if (!nextResponsePart()) {
+            connection_pool_.stop(shared_from_this());
+            return;
+        }
+
         // Check if there is any data left to be sent and sent it.
         if (!response_.empty()) {
             doSend();
             return;
         }
 
-        // Gracefully shutdown the connection and close the socket if
-        // we have sent the whole response.
-        terminate();
+        responseSent();
+        return;
     }
 
-    // All data sent or an error has occurred. Close the connection.
+    // An error has occurred. Close the connection.
+    connection_pool_.stop(shared_from_this());
+}
+
+void
+Connection::responsePartProduced(const ResponsePartPtr& part,
+                                 const bool first) {
+    // The connection has been closed while the part was being produced.
+    if (!socket_->getASIOSocket().is_open()) {
+        return;
+    }
+
+    scheduleTimer();
+
+    if (part->failed_) {
+        LOG_ERROR(command_logger, COMMAND_RESPONSE_STREAM_FAILED)
+            .arg(socket_->getNative()).arg(part->error_);
+        response_stream_.reset();
+        // The response can't be replaced once its first part has been sent.
+        if (!first) {
+            connection_pool_.stop(shared_from_this());
+            return;
+        }
+        response_ = createAnswer(CONTROL_RESULT_ERROR,
+                                 STREAM_FAILED_TEXT)->str();
+
+    } else {
+        response_.swap(part->text_);
+        if (!part->more_) {
+            response_stream_.reset();
+        }
+    }
+
+    if (!response_.empty()) {
+        doSend();
+
+    } else if (first) {
+        // Nothing to be sent.
+        connection_pool_.stop(shared_from_this());
+
+    } else {
+        responseSent();
+    }
+}
+
+void
+Connection::responseSent() {
+    if (!command_name_.empty()) {
+        boost::posix_time::time_duration duration =
+            boost::posix_time::microsec_clock::universal_time() - command_start_;
+        LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_COMMAND_PROCESSED)
+            .arg(command_name_).arg(socket_->getNative())
+            .arg(static_cast<double>(duration.total_microseconds()) / 1000);
+    }
+
+    // The client will send another command over this connection.
+    if (keep_alive_) {
+        waitNextCommand();
+        return;
+    }
+
+    // Gracefully shutdown the connection and close the socket if
+    // we have sent the whole response.
+    terminate();
     connection_pool_.stop(shared_from_this());
 }
 
 void
 Connection::timeoutHandler() {
+    // The client keeping the connection open has not sent a new command.
+    // Sending an error response would make the client take it for the
+    // response to its next command, so just close the connection.
+    if (idle_) {
+        LOG_DEBUG(command_logger, DBG_COMMAND,
+                  COMMAND_SOCKET_CONNECTION_IDLE_TIMEOUT)
+            .arg(socket_->getNative());
+        connection_pool_.stop(shared_from_this());
+        return;
+    }
+
     LOG_INFO(command_logger, COMMAND_SOCKET_CONNECTION_TIMEOUT)
         .arg(socket_->getNative());
+    command_name_.clear();
 
     try {
         socket_->cancel();
@@ -451,9 +936,9 @@ Connection::timeoutHandler() {
 
     std::stringstream os;
     os << "Connection over control channel timed out";
-    if (!feed_.getProcessedText().empty()) {
+    if (!feed_->getProcessedText().empty()) {
         os << ", discarded partial command of "
-           << feed_.getProcessedText().size() << " bytes";
+           << feed_->getProcessedText().size() << " bytes";
     }
 
     ConstElementPtr rsp = createAnswer(CONTROL_RESULT_ERROR, os.str());
@@ -474,7 +959,8 @@ public:
     /// @brief Constructor.
     CommandMgrImpl()
         : io_service_(), acceptor_(), socket_(), socket_name_(),
-          connection_pool_(), timeout_(TIMEOUT_DHCP_SERVER_RECEIVE_COMMAND) {
+          connection_pool_(), executor_(),
+          timeout_(TIMEOUT_DHCP_SERVER_RECEIVE_COMMAND) {
     }
 
     /// @brief Opens acceptor service allowing the control clients to connect.
@@ -505,6 +991,9 @@ public:
     /// @brief Pool of connections.
     ConnectionPool connection_pool_;
 
+    /// @brief Executor of the command threads.
+    CommandExecutor executor_;
+
     /// @brief Connection timeout
     long timeout_;
 };
@@ -539,6 +1028,24 @@ CommandMgrImpl::openCommandSocket(const isc::data::ConstElementPtr& socket_info)
         isc_throw(BadSocketInfo, "'socket-name' parameter expected to be a string");
     }
 
+    // The threads producing the deferred responses, i.e. those of
+    // config-get and config-write. By default the responses are produced
+    // by the main thread.
+    int64_t threads_num = 0;
+    ConstElementPtr threads = socket_info->get("config-output-threads");
+    if (threads) {
+        if (threads->getType() != Element::integer) {
+            isc_throw(BadSocketInfo, "'config-output-threads' parameter expected"
+                      " to be an integer");
+        }
+        threads_num = threads->intValue();
+        if ((threads_num < 0) || (threads_num > MAX_COMMAND_THREADS)) {
+            isc_throw(BadSocketInfo, "'config-output-threads' parameter value "
+                      << threads_num << " is out of range 0.."
+                      << MAX_COMMAND_THREADS);
+        }
+    }
+
     socket_name_ = name->stringValue();
 
     LOG_INFO(command_logger, COMMAND_ACCEPTOR_START)
@@ -557,6 +1064,8 @@ CommandMgrImpl::openCommandSocket(const isc::data::ConstElementPtr& socket_info)
 
         doAccept();
 
+        executor_.start(io_service_, static_cast<size_t>(threads_num));
+
     } catch (const std::exception& ex) {
         isc_throw(SocketError, ex.what());
     }
@@ -571,7 +1080,7 @@ CommandMgrImpl::doAccept() {
             // New connection is arriving. Start asynchronous transmission.
             ConnectionPtr connection(new Connection(io_service_, socket_,
                                                     connection_pool_,
-                                                    timeout_));
+                                                    executor_, timeout_));
             connection_pool_.start(connection);
 
         } else if (ec.value() != boost::asio::error::operation_aborted) {
@@ -608,6 +1117,10 @@ void CommandMgr::closeCommandSocket() {
     // the server. This connection will be held until the CommandMgr responds to
     // such request.
     impl_->connection_pool_.stopAll();
+
+    // Let the command threads complete the jobs already submitted. The
+    // connections which have been closed ignore their results.
+    impl_->executor_.stop();
 }
 
 int
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -64,6 +64,12 @@ public:
     /// Currently supported types are:
     /// - unix (required parameters: socket-type: unix, socket-name:/unix/path)
     ///
+    /// The optional config-output-threads parameter specifies the number of
+    /// the threads producing the responses deferred by the command handlers,
+    /// see @ref HookedCommandMgr::deferResponse. The servers only defer the
+    /// responses to config-get and config-write. By default the responses
+    /// are produced by the thread which processes the commands.
+    ///
     /// @throw BadSocketInfo When socket configuration is invalid.
     /// @throw SocketError When socket operation fails.
     ///
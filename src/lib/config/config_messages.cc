@@ -15,11 +15,14 @@ extern const isc::log::MessageID COMMAND_PROCESS_ERROR2 = "COMMAND_PROCESS_ERROR
 extern const isc::log::MessageID COMMAND_RECEIVED = "COMMAND_RECEIVED";
 extern const isc::log::MessageID COMMAND_REGISTERED = "COMMAND_REGISTERED";
 extern const isc::log::MessageID COMMAND_RESPONSE_ERROR = "COMMAND_RESPONSE_ERROR";
+extern const isc::log::MessageID COMMAND_RESPONSE_STREAM_FAILED = "COMMAND_RESPONSE_STREAM_FAILED";
 extern const isc::log::MessageID COMMAND_SOCKET_ACCEPT_FAIL = "COMMAND_SOCKET_ACCEPT_FAIL";
 extern const isc::log::MessageID COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST = "COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST";
+extern const isc::log::MessageID COMMAND_SOCKET_COMMAND_PROCESSED = "COMMAND_SOCKET_COMMAND_PROCESSED";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CANCEL_FAIL = "COMMAND_SOCKET_CONNECTION_CANCEL_FAIL";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CLOSED = "COMMAND_SOCKET_CONNECTION_CLOSED";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CLOSE_FAIL = "COMMAND_SOCKET_CONNECTION_CLOSE_FAIL";
+extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_IDLE_TIMEOUT = "COMMAND_SOCKET_CONNECTION_IDLE_TIMEOUT";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_OPENED = "COMMAND_SOCKET_CONNECTION_OPENED";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_SHUTDOWN_FAIL = "COMMAND_SOCKET_CONNECTION_SHUTDOWN_FAIL";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_TIMEOUT = "COMMAND_SOCKET_CONNECTION_TIMEOUT";
@@ -45,11 +48,14 @@ const char* values[] = {
     "COMMAND_RECEIVED", "Received command '%1'",
     "COMMAND_REGISTERED", "Command %1 registered",
     "COMMAND_RESPONSE_ERROR", "Server failed to generate response for command: %1",
+    "COMMAND_RESPONSE_STREAM_FAILED", "Failed to produce the next part of the response streamed over the connection on fd %1: %2",
     "COMMAND_SOCKET_ACCEPT_FAIL", "Failed to accept incoming connection on command socket %1: %2",
     "COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST", "Closed command socket %1 by foreign host, %2",
+    "COMMAND_SOCKET_COMMAND_PROCESSED", "Command %1 received over socket %2 processed in %3 ms",
     "COMMAND_SOCKET_CONNECTION_CANCEL_FAIL", "Failed to cancel read operation on socket %1: %2",
     "COMMAND_SOCKET_CONNECTION_CLOSED", "Closed socket %1 for existing command connection",
     "COMMAND_SOCKET_CONNECTION_CLOSE_FAIL", "Failed to close command connection: %1",
+    "COMMAND_SOCKET_CONNECTION_IDLE_TIMEOUT", "Closing idle connection over socket %1",
     "COMMAND_SOCKET_CONNECTION_OPENED", "Opened socket %1 for incoming command connection",
     "COMMAND_SOCKET_CONNECTION_SHUTDOWN_FAIL", "Encountered error %1 while trying to gracefully shutdown socket",
     "COMMAND_SOCKET_CONNECTION_TIMEOUT", "Timeout occurred for connection over socket %1",
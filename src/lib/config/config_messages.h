@@ -16,11 +16,14 @@ extern const isc::log::MessageID COMMAND_PROCESS_ERROR2;
 extern const isc::log::MessageID COMMAND_RECEIVED;
 extern const isc::log::MessageID COMMAND_REGISTERED;
 extern const isc::log::MessageID COMMAND_RESPONSE_ERROR;
+extern const isc::log::MessageID COMMAND_RESPONSE_STREAM_FAILED;
 extern const isc::log::MessageID COMMAND_SOCKET_ACCEPT_FAIL;
 extern const isc::log::MessageID COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST;
+extern const isc::log::MessageID COMMAND_SOCKET_COMMAND_PROCESSED;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CANCEL_FAIL;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CLOSED;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CLOSE_FAIL;
+extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_IDLE_TIMEOUT;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_OPENED;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_SHUTDOWN_FAIL;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_TIMEOUT;
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -22,7 +22,44 @@ namespace isc {
 namespace config {
 
 HookedCommandMgr::HookedCommandMgr()
-    : BaseCommandMgr() {
+    : BaseCommandMgr(), stream_response_(false), defer_response_(false),
+      response_stream_() {
+}
+
+ConstElementPtr
+HookedCommandMgr::processCommandStream(const ConstElementPtr& cmd,
+                                       ResponseStreamPtr& stream) {
+    stream_response_ = true;
+    response_stream_.reset();
+    ConstElementPtr answer;
+    try {
+        answer = processCommand(cmd);
+
+    } catch (...) {
+        stream_response_ = false;
+        defer_response_ = false;
+        response_stream_.reset();
+        throw;
+    }
+    stream_response_ = false;
+    defer_response_ = false;
+
+    stream = response_stream_;
+    response_stream_.reset();
+    if (stream) {
+        answer.reset();
+    }
+    return (answer);
+}
+
+ConstElementPtr
+HookedCommandMgr::deferResponse(const ResponseTask& task) {
+    if (!defer_response_) {
+        return (task());
+    }
+    defer_response_ = false;
+    response_stream_.reset(new TaskResponseStream(task));
+    return (ConstElementPtr());
 }
 
 bool
@@ -49,11 +86,23 @@ HookedCommandMgr::delegateCommandToHookLibrary(const std::string& cmd_name,
         callout_handle->setArgument("command", command);
         callout_handle->setArgument("response", hook_response);
 
+        // Only the command received by processCommandStream may be streamed,
+        // not the commands which its handlers may issue.
+        const bool stream_response = stream_response_;
+        stream_response_ = false;
+        if (stream_response) {
+            callout_handle->setArgument("response-stream", ResponseStreamPtr());
+        }
+
         HooksManager::callCommandHandlers(cmd_name, *callout_handle);
 
         // The callouts should set the response.
         callout_handle->getArgument("response", hook_response);
 
+        if (stream_response) {
+            callout_handle->getArgument("response-stream", response_stream_);
+        }
+
         answer = boost::const_pointer_cast<Element>(hook_response);
 
         return (true);
@@ -84,10 +133,15 @@ HookedCommandMgr::handleCommand(const std::string& cmd_name,
     }
 
     // If we're here it means that the callouts weren't called. We need
-    // to handle the command using local Command Mananger.
+    // to handle the command using local Command Mananger. Only the handler
+    // of the command received by processCommandStream may defer the
+    // response, not the handlers of the commands which it may issue.
+    defer_response_ = stream_response_;
+    stream_response_ = false;
     ConstElementPtr response = BaseCommandMgr::handleCommand(cmd_name,
                                                              params,
                                                              original_cmd);
+    defer_response_ = false;
 
     // If we're processing 'list-commands' command we may need to include
     // commands supported by hooks libraries in the response.
@@ -9,6 +9,7 @@
 
 #include <cc/data.h>
 #include <config/base_command_mgr.h>
+#include <config/response_stream.h>
 
 namespace isc {
 namespace config {
@@ -44,6 +45,38 @@ public:
     /// Initializes callout handle used by the Command Manager.
     HookedCommandMgr();
 
+    /// @brief Processes the command, allowing its response to be streamed.
+    ///
+    /// This is the same as @c processCommand but the command handlers in
+    /// the hook libraries are given the "response-stream" argument. A
+    /// handler may set it to a @c ResponseStream producing the response
+    /// text in parts rather than returning the response as an element.
+    ///
+    /// @param cmd Pointer to the data element representing command in JSON
+    /// format.
+    /// @param [out] stream Stream producing the response, or null if the
+    /// response is not streamed.
+    /// @return Pointer to the response or null if the response is streamed.
+    isc::data::ConstElementPtr
+    processCommandStream(const isc::data::ConstElementPtr& cmd,
+                         ResponseStreamPtr& stream);
+
+    /// @brief Produces the response to the command being processed by
+    /// running a task, possibly in a command thread.
+    ///
+    /// This is intended for the handlers of the commands which only read
+    /// the server state, e.g. config-get. The handler takes a snapshot of
+    /// the state it needs on the main thread, binds it to the task and
+    /// returns the value returned by this method. If the command has been
+    /// received by @c processCommandStream, the task is wrapped in a
+    /// @c TaskResponseStream and null is returned. Otherwise, the task is
+    /// run at once and its response is returned.
+    ///
+    /// @param task Function producing the response out of the snapshot.
+    /// @return Response produced by the task or null if the response is
+    /// streamed.
+    isc::data::ConstElementPtr deferResponse(const ResponseTask& task);
+
 protected:
 
     /// @brief Handles the command within the hooks libraries.
@@ -83,6 +116,17 @@ protected:
                   const isc::data::ConstElementPtr& params,
                   const isc::data::ConstElementPtr& original_cmd);
 
+private:
+
+    /// @brief Indicates if the command being processed may be streamed.
+    bool stream_response_;
+
+    /// @brief Indicates if the built-in handler of the command being
+    /// processed may defer the response.
+    bool defer_response_;
+
+    /// @brief Stream set by the command handler.
+    ResponseStreamPtr response_stream_;
 };
 
 } // end of namespace isc::config
@@ -0,0 +1,28 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <config/response_stream.h>
+#include <exceptions/exceptions.h>
+
+using namespace isc::data;
+
+namespace isc {
+namespace config {
+
+bool
+TaskResponseStream::next(std::string& out) {
+    ConstElementPtr response = task_();
+    if (!response) {
+        isc_throw(Unexpected, "no response generated");
+    }
+    out += response->str();
+    return (false);
+}
+
+} // end of namespace isc::config
+} // end of namespace isc
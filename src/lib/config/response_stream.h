@@ -0,0 +1,107 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef RESPONSE_STREAM_H
+#define RESPONSE_STREAM_H
+
+#include <cc/data.h>
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+
+namespace isc {
+namespace config {
+
+/// @brief Base class for command responses produced in parts.
+///
+/// Some commands, e.g. lease4-get-all, may return responses much larger
+/// than the server should hold in memory at once. A command handler
+/// implemented in a hook library may return an instance of a class
+/// derived from this one instead of a response element. The control
+/// channel then asks the stream for the next part of the response text
+/// each time the previous part has been sent, so that the server keeps
+/// processing other events between the parts.
+///
+/// The command handler finds out whether the caller accepts a streamed
+/// response by checking if the "response-stream" argument is present in
+/// the callout handle. If it is, the handler may set this argument to
+/// the stream and leave the "response" argument empty.
+class ResponseStream {
+public:
+
+    /// @brief Virtual destructor.
+    virtual ~ResponseStream() {
+    }
+
+    /// @brief Appends the next part of the response text.
+    ///
+    /// The concatenated parts form the JSON text of the response.
+    ///
+    /// @param [out] out string to which the next part is appended.
+    /// @return true if more parts follow, false if this is the last one.
+    /// @throw isc::Exception if the next part can't be produced. The
+    /// response is truncated in this case.
+    virtual bool next(std::string& out) = 0;
+
+    /// @brief Checks if the parts may be produced by a command thread.
+    ///
+    /// A stream which works on its own copy of the server state, rather
+    /// than on the state itself, may be asked for the parts of the response
+    /// by one of the threads configured with the "config-output-threads"
+    /// parameter of the control socket. The server keeps processing packets
+    /// and other commands in the meantime.
+    ///
+    /// @return true if @c next may be called by a command thread. The
+    /// default implementation returns false.
+    virtual bool isConcurrent() const {
+        return (false);
+    }
+};
+
+/// @brief Pointer to the @c ResponseStream.
+typedef boost::shared_ptr<ResponseStream> ResponseStreamPtr;
+
+/// @brief Type of the function producing the response to a command.
+typedef boost::function<isc::data::ConstElementPtr()> ResponseTask;
+
+/// @brief Stream producing the whole response by running a task.
+///
+/// The command handler takes a snapshot of the server state it needs and
+/// binds it to the task, which makes the response out of the snapshot,
+/// e.g. converts the configuration to text. The task is run by a command
+/// thread, if any, so it must not access the server state.
+class TaskResponseStream : public ResponseStream {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param task Function producing the response.
+    explicit TaskResponseStream(const ResponseTask& task)
+        : task_(task) {
+    }
+
+    /// @brief Runs the task and appends the response text.
+    ///
+    /// @param [out] out string to which the response text is appended.
+    /// @return false as the whole response is produced at once.
+    /// @throw isc::Unexpected if the task has returned no response.
+    virtual bool next(std::string& out);
+
+    /// @brief Returns true, the task doesn't access the server state.
+    virtual bool isConcurrent() const {
+        return (true);
+    }
+
+private:
+
+    /// @brief Function producing the response.
+    ResponseTask task_;
+};
+
+} // end of namespace isc::config
+} // end of namespace isc
+
+#endif
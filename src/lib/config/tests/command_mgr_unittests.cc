@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,6 +26,39 @@ using namespace isc::data;
 using namespace isc::hooks;
 using namespace std;
 
+namespace {
+
+/// @brief Response stream producing the response in two parts.
+class TestResponseStream : public ResponseStream {
+public:
+
+    /// @brief Constructor.
+    TestResponseStream() : part_(0) {
+    }
+
+    /// @brief Appends the next part of the response.
+    virtual bool next(std::string& out) {
+        out += (part_++ == 0 ? "{ \"result\": 0, " : "\"text\": \"streamed\" }");
+        return (part_ < 2);
+    }
+
+private:
+
+    /// @brief Number of parts produced.
+    int part_;
+};
+
+/// @brief Command handler deferring the response.
+ConstElementPtr
+deferring_handler(const std::string&, const ConstElementPtr&) {
+    ConstElementPtr arguments = Element::fromJSON("{ \"deferred\": true }");
+    return (CommandMgr::instance().deferResponse([arguments]() {
+        return (createAnswer(0, arguments));
+    }));
+}
+
+}
+
 // Test class for Command Manager
 class CommandMgrTest : public ::testing::Test {
 public:
@@ -121,6 +154,30 @@ public:
         return (0);
     }
 
+    /// @brief Test callback which streams the response if the caller
+    /// accepts it.
+    ///
+    /// @param callout_handle Handle passed by the hooks framework.
+    /// @return Always 0.
+    static int
+    hook_lib_stream_callout(CalloutHandle& callout_handle) {
+        callout_name_ = "hook_lib_stream_callout";
+
+        callout_argument_names_ = callout_handle.getArgumentNames();
+        std::sort(callout_argument_names_.begin(), callout_argument_names_.end());
+
+        if (std::find(callout_argument_names_.begin(),
+                      callout_argument_names_.end(),
+                      "response-stream") != callout_argument_names_.end()) {
+            callout_handle.setArgument("response-stream",
+                                       ResponseStreamPtr(new TestResponseStream()));
+        } else {
+            callout_handle.setArgument("response",
+                                       createAnswer(0, "not streamed"));
+        }
+        return (0);
+    }
+
     /// @brief Test callback which stores callout name and passed arguments and
     /// which handles the command.
     ///
@@ -384,6 +441,66 @@ TEST_F(CommandMgrTest, delegateProcessCommand) {
     EXPECT_EQ("response", callout_argument_names_[1]);
 }
 
+// Verify that a hook library may stream the response if the caller
+// accepts it.
+TEST_F(CommandMgrTest, delegateProcessCommandStream) {
+    HooksManager::preCalloutsLibraryHandle().registerCommandCallout(
+        "my-command", hook_lib_stream_callout);
+
+    ConstElementPtr command = createCommand("my-command");
+
+    // The response is streamed.
+    ResponseStreamPtr stream;
+    ConstElementPtr answer;
+    ASSERT_NO_THROW(answer = CommandMgr::instance().processCommandStream(command,
+                                                                          stream));
+    EXPECT_FALSE(answer);
+    ASSERT_TRUE(stream);
+    ASSERT_EQ(3, callout_argument_names_.size());
+    EXPECT_EQ("response-stream", callout_argument_names_[2]);
+
+    std::string text;
+    EXPECT_TRUE(stream->next(text));
+    EXPECT_FALSE(stream->next(text));
+    ASSERT_NO_THROW(answer = Element::fromJSON(text));
+    int status_code;
+    ASSERT_NO_THROW(parseAnswer(status_code, answer));
+    EXPECT_EQ(0, status_code);
+    EXPECT_EQ("streamed", answer->get("text")->stringValue());
+
+    // The callout is not offered to stream the response otherwise.
+    ASSERT_NO_THROW(answer = CommandMgr::instance().processCommand(command));
+    ASSERT_TRUE(answer);
+    EXPECT_EQ("not streamed", answer->get("text")->stringValue());
+    ASSERT_EQ(2, callout_argument_names_.size());
+}
+
+// Verify that a built-in command handler may defer the response if the
+// caller accepts a streamed response.
+TEST_F(CommandMgrTest, deferResponse) {
+    EXPECT_NO_THROW(CommandMgr::instance().registerCommand("my-command",
+                                                           deferring_handler));
+    ConstElementPtr command = createCommand("my-command");
+
+    // The response is produced by a stream which may be run concurrently.
+    ResponseStreamPtr stream;
+    ConstElementPtr answer;
+    ASSERT_NO_THROW(answer = CommandMgr::instance().processCommandStream(command,
+                                                                          stream));
+    EXPECT_FALSE(answer);
+    ASSERT_TRUE(stream);
+    EXPECT_TRUE(stream->isConcurrent());
+
+    std::string text;
+    EXPECT_FALSE(stream->next(text));
+    EXPECT_EQ("{ \"arguments\": { \"deferred\": true }, \"result\": 0 }", text);
+
+    // The response is returned at once otherwise.
+    ASSERT_NO_THROW(answer = CommandMgr::instance().processCommand(command));
+    ASSERT_TRUE(answer);
+    EXPECT_EQ(text, answer->str());
+}
+
 // Verify that 'list-command' command returns combined list of supported
 // commands from hook library and from the Kea Command Manager.
 TEST_F(CommandMgrTest, delegateListCommands) {
@@ -468,6 +585,33 @@ TEST_F(CommandMgrTest, unixCreateTooLong) {
                  SocketError);
 }
 
+// This test verifies that the number of the config output threads is
+// verified.
+TEST_F(CommandMgrTest, unixCreateConfigOutputThreads) {
+    ElementPtr socket_info = Element::createMap();
+    socket_info->set("socket-type", Element::create("unix"));
+    socket_info->set("socket-name", Element::create(getSocketPath()));
+
+    socket_info->set("config-output-threads", Element::create("2"));
+    EXPECT_THROW(CommandMgr::instance().openCommandSocket(socket_info),
+                 isc::config::BadSocketInfo);
+
+    socket_info->set("config-output-threads", Element::create(-1));
+    EXPECT_THROW(CommandMgr::instance().openCommandSocket(socket_info),
+                 isc::config::BadSocketInfo);
+
+    socket_info->set("config-output-threads", Element::create(65));
+    EXPECT_THROW(CommandMgr::instance().openCommandSocket(socket_info),
+                 isc::config::BadSocketInfo);
+
+    socket_info->set("config-output-threads", Element::create(2));
+    EXPECT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+    EXPECT_GE(CommandMgr::instance().getControlSocketFD(), 0);
+
+    // Closing the socket stops the threads.
+    EXPECT_NO_THROW(CommandMgr::instance().closeCommandSocket());
+}
+
 // This test verifies that a registered callout for the command_processed
 // hookpoint is invoked and passed the correct information.
 TEST_F(CommandMgrTest, commandProcessedHook) {
@@ -61,7 +61,8 @@ DbAccessParser::parse(std::string& access_string,
         try {
             if ((param.first == "persist") ||
                 (param.first == "tcp-nodelay") ||
-                (param.first == "readonly")) {
+                (param.first == "readonly") ||
+                (param.first == "lfc-in-process")) {
                 values_copy[param.first] = (param.second->boolValue() ?
                                             "true" : "false");
 
@@ -168,7 +168,8 @@ private:
          return ((parameter != "persist") && (parameter != "lfc-interval") &&
                  (parameter != "connect-timeout") &&
                  (parameter != "port") &&
-                 (parameter != "readonly"));
+                 (parameter != "readonly") &&
+                 (parameter != "lfc-in-process"));
     }
 
 };
@@ -352,6 +353,41 @@ TEST_F(DbAccessParserTest, largeLFCInterval) {
     EXPECT_THROW(parser.parse(json_elements), DbConfigError);
 }
 
+// This test checks that the parser accepts the valid value of the
+// lfc-in-process parameter.
+TEST_F(DbAccessParserTest, validLFCInProcess) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases6.csv",
+                            "lfc-interval", "3600",
+                            "lfc-in-process", "true",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid LFC in process", parser.getDbAccessParameters(),
+                      config);
+}
+
+// This test checks that the parser rejects the non-boolean value of the
+// lfc-in-process parameter.
+TEST_F(DbAccessParserTest, invalidLFCInProcess) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases6.csv",
+                            "lfc-in-process", "1",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_THROW(parser.parse(json_elements), DbConfigError);
+}
+
 // This test checks that the parser accepts the valid value of the
 // timeout parameter.
 TEST_F(DbAccessParserTest, validTimeout) {
@@ -33,8 +33,11 @@ Option::factory(Option::Universe u,
 }
 
 
+std::atomic<uint64_t> Option::modification_counter_(0);
+
 Option::Option(Universe u, uint16_t type)
-    :universe_(u), type_(type) {
+    :universe_(u), type_(type), modified_(0), wire_cache_enabled_(false),
+     cached_at_(0) {
 
     // END option (type 255 is forbidden as well)
     if ((u == V4) && ((type == 0) || (type > 254))) {
@@ -44,20 +47,23 @@ Option::Option(Universe u, uint16_t type)
 }
 
 Option::Option(Universe u, uint16_t type, const OptionBuffer& data)
-    :universe_(u), type_(type), data_(data) {
+    :universe_(u), type_(type), data_(data), modified_(0),
+     wire_cache_enabled_(false), cached_at_(0) {
     check();
 }
 
 Option::Option(Universe u, uint16_t type, OptionBufferConstIter first,
                OptionBufferConstIter last)
-    :universe_(u), type_(type), data_(first, last) {
+    :universe_(u), type_(type), data_(first, last), modified_(0),
+     wire_cache_enabled_(false), cached_at_(0) {
     check();
 }
 
 Option::Option(const Option& option)
     : universe_(option.universe_), type_(option.type_),
       data_(option.data_), options_(),
-      encapsulated_space_(option.encapsulated_space_) {
+      encapsulated_space_(option.encapsulated_space_), modified_(0),
+      wire_cache_enabled_(option.wire_cache_enabled_), cached_at_(0) {
     option.getOptionsCopy(options_);
 }
 
@@ -69,6 +75,8 @@ Option::operator=(const Option& rhs) {
         data_ = rhs.data_;
         rhs.getOptionsCopy(options_);
         encapsulated_space_ = rhs.encapsulated_space_;
+        wire_cache_enabled_ = rhs.wire_cache_enabled_;
+        markModified();
     }
     return (*this);
 }
@@ -113,6 +121,53 @@ void Option::pack(isc::util::OutputBuffer& buf) const {
     packOptions(buf);
 }
 
+void
+Option::packCached(isc::util::OutputBuffer& buf) const {
+    if (!wire_cache_enabled_) {
+        pack(buf);
+        return;
+    }
+
+    if (!isWireCacheValid()) {
+        isc::util::OutputBuffer wire(len());
+        pack(wire);
+        const uint8_t* data = static_cast<const uint8_t*>(wire.getData());
+        wire_cache_.assign(data, data + wire.getLength());
+        cached_at_ = ++modification_counter_;
+    }
+
+    if (!wire_cache_.empty()) {
+        buf.writeData(&wire_cache_[0], wire_cache_.size());
+    }
+}
+
+void
+Option::setWireCacheEnabled(const bool enabled) {
+    wire_cache_enabled_ = enabled;
+    cached_at_ = 0;
+    OptionBuffer().swap(wire_cache_);
+}
+
+bool
+Option::isWireCacheValid() const {
+    return (wire_cache_enabled_ && (cached_at_ > 0) &&
+            !modifiedSince(cached_at_));
+}
+
+bool
+Option::modifiedSince(const uint64_t stamp) const {
+    if (modified_ > stamp) {
+        return (true);
+    }
+    for (OptionCollection::const_iterator it = options_.begin();
+         it != options_.end(); ++it) {
+        if (it->second->modifiedSince(stamp)) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
 void
 Option::packHeader(isc::util::OutputBuffer& buf) const {
     if (universe_ == V4) {
@@ -154,6 +209,7 @@ void Option::unpack(OptionBufferConstIter begin,
 
 void
 Option::unpackOptions(const OptionBuffer& buf) {
+    markModified();
     list<uint16_t> deferred;
     switch (universe_) {
     case V4:
@@ -225,6 +281,7 @@ bool Option::delOption(uint16_t opt_type) {
     isc::dhcp::OptionCollection::iterator x = options_.find(opt_type);
     if ( x != options_.end() ) {
         options_.erase(x);
+        markModified();
         return true; // delete successful
     }
     return (false); // option not found, can't delete
@@ -344,6 +401,7 @@ void Option::addOption(OptionPtr opt) {
         }
     }
     options_.insert(make_pair(opt->getType(), opt));
+    markModified();
 }
 
 uint8_t Option::getUint8() const {
@@ -367,16 +425,19 @@ uint32_t Option::getUint32() const {
 void Option::setUint8(uint8_t value) {
     data_.resize(sizeof(value));
     data_[0] = value;
+    markModified();
 }
 
 void Option::setUint16(uint16_t value) {
     data_.resize(sizeof(value));
     writeUint16(value, &data_[0], data_.size());
+    markModified();
 }
 
 void Option::setUint32(uint32_t value) {
     data_.resize(sizeof(value));
     writeUint32(value, &data_[0], data_.size());
+    markModified();
 }
 
 bool Option::equals(const OptionPtr& other) const {
@@ -12,7 +12,9 @@
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <map>
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -200,6 +202,42 @@ public:
     /// @throw BadValue Universe of the option is neither V4 nor V6.
     virtual void pack(isc::util::OutputBuffer& buf) const;
 
+    /// @brief Writes option in wire-format to a buffer using the wire cache.
+    ///
+    /// When the wire cache is enabled the wire format of the option is
+    /// kept after it was first packed and is copied as is to the buffer.
+    /// The cached wire format is computed again when the option or one of
+    /// its sub-options has been modified since. When the wire cache is
+    /// disabled this is the same as @c pack.
+    ///
+    /// Although the method is const, it updates the wire cache of the
+    /// option. It is not thread safe: the same option must not be packed
+    /// by several threads at once while the wire cache is enabled.
+    ///
+    /// @param buf output buffer.
+    void packCached(isc::util::OutputBuffer& buf) const;
+
+    /// @brief Enables or disables the wire cache.
+    ///
+    /// The server enables the wire cache of the options held in its
+    /// configuration: these options are the same objects in every
+    /// response so packing them every time is wasteful.
+    ///
+    /// @param enabled true to enable the wire cache.
+    void setWireCacheEnabled(const bool enabled);
+
+    /// @brief Checks if the wire cache is enabled.
+    bool getWireCacheEnabled() const {
+        return (wire_cache_enabled_);
+    }
+
+    /// @brief Checks if the cached wire format may be used.
+    ///
+    /// @return true if the wire cache is enabled, holds the wire format
+    /// and neither the option nor one of its sub-options was modified
+    /// since it was computed.
+    bool isWireCacheValid() const;
+
     /// @brief Parses received buffer.
     ///
     /// @param begin iterator to first byte of option data
@@ -365,6 +403,7 @@ public:
     template<typename InputIterator>
     void setData(InputIterator first, InputIterator last) {
         data_.assign(first, last);
+        markModified();
     }
 
     /// @brief Sets the name of the option space encapsulated by this option.
@@ -373,6 +412,7 @@ public:
     /// this option.
     void setEncapsulatedSpace(const std::string& encapsulated_space) {
         encapsulated_space_ = encapsulated_space;
+        markModified();
     }
 
     /// @brief Returns the name of the option space encapsulated by this option.
@@ -501,6 +541,22 @@ protected:
     //// @return Suboptions in the textual format.
     std::string suboptionsToText(const int indent = 0) const;
 
+    /// @brief Marks the option as modified.
+    ///
+    /// This method must be called by all methods modifying the content of
+    /// the option, including those of the derived classes, so the cached
+    /// wire format of the option and of the options encapsulating it is
+    /// not used anymore.
+    void markModified() {
+        modified_ = ++modification_counter_;
+    }
+
+    /// @brief Checks if the option or a sub-option was modified after
+    /// a given point in time.
+    ///
+    /// @param stamp value of the modification counter to compare to.
+    bool modifiedSince(const uint64_t stamp) const;
+
     /// @brief A protected method used for option correctness.
     ///
     /// It is used in constructors. In there are any problems detected
@@ -523,6 +579,28 @@ protected:
     /// Name of the option space being encapsulated by this option.
     std::string encapsulated_space_;
 
+private:
+
+    /// @brief Value of the modification counter at the last modification.
+    uint64_t modified_;
+
+    /// @brief Indicates if the wire cache is enabled.
+    bool wire_cache_enabled_;
+
+    /// @brief Value of the modification counter when the wire format was
+    /// cached, 0 when it was not.
+    mutable uint64_t cached_at_;
+
+    /// @brief Cached wire format of the option.
+    mutable OptionBuffer wire_cache_;
+
+    /// @brief Counter incremented at each modification of any option.
+    ///
+    /// The counter is shared by all options, and options are created and
+    /// modified by several threads at once, e.g. by the perfdhcp sender
+    /// threads, so it is atomic.
+    static std::atomic<uint64_t> modification_counter_;
+
     /// @todo probably 2 different containers have to be used for v4 (unique
     /// options) and v6 (options with the same type can repeat)
 };
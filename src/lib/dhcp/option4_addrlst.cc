@@ -102,6 +102,7 @@ void Option4AddrLst::setAddresses(const AddressContainer& addrs) {
          addr != addrs.end(); ++addr) {
         addAddress(*addr);
     }
+    markModified();
 }
 
 
@@ -111,6 +112,7 @@ void Option4AddrLst::addAddress(const isc::asiolink::IOAddress& addr) {
                   << "Option4AddrLst option");
     }
     addrs_.push_back(addr);
+    markModified();
 }
 
 uint16_t Option4AddrLst::len() const {
@@ -410,6 +410,7 @@ Option4ClientFqdn::setFlag(const uint8_t flag, const bool set_flag) {
     // bits are not set.
     Option4ClientFqdnImpl::checkFlags(new_flag, true);
     impl_->flags_ = new_flag;
+    markModified();
 }
 
 std::pair<Option4ClientFqdn::Rcode, Option4ClientFqdn::Rcode>
@@ -421,6 +422,7 @@ void
 Option4ClientFqdn::setRcode(const Rcode& rcode) {
     impl_->rcode1_ = rcode;
     impl_->rcode2_ = rcode;
+    markModified();
 }
 
 void
@@ -471,6 +473,7 @@ void
 Option4ClientFqdn::setDomainName(const std::string& domain_name,
                                  const DomainNameType domain_name_type) {
     impl_->setDomainName(domain_name, domain_name_type);
+    markModified();
 }
 
 void
@@ -505,6 +508,7 @@ Option4ClientFqdn::unpack(OptionBufferConstIter first,
     // because we don't want to discard the whole option because of MBZ bits
     // being set.
     impl_->checkFlags(impl_->flags_, false);
+    markModified();
 }
 
 std::string
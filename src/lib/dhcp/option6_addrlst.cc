@@ -54,11 +54,13 @@ Option6AddrLst::setAddress(const isc::asiolink::IOAddress& addr) {
 
     addrs_.clear();
     addrs_.push_back(addr);
+    markModified();
 }
 
 void
 Option6AddrLst::setAddresses(const AddressContainer& addrs) {
     addrs_ = addrs;
+    markModified();
 }
 
 void Option6AddrLst::pack(isc::util::OutputBuffer& buf) const {
@@ -92,6 +94,7 @@ void Option6AddrLst::unpack(OptionBufferConstIter begin,
         addrs_.push_back(IOAddress::fromBytes(AF_INET6, &(*begin)));
         begin += V6ADDRESS_LEN;
     }
+    markModified();
 }
 
 std::string Option6AddrLst::toText(int indent) const {
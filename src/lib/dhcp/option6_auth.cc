@@ -112,6 +112,7 @@ Option6Auth::unpack(OptionBufferConstIter begin,
    auth_info_.erase(auth_info_.begin(), auth_info_.end());
    std::for_each(begin, end, [this](uint8_t msgdata)
                 {  auth_info_.push_back(msgdata); });
+    markModified();
 }
 
 std::string
@@ -349,6 +349,7 @@ Option6ClientFqdn::setFlag(const uint8_t flag, const bool set_flag) {
     // Check new flags. If they are valid, apply them.
     Option6ClientFqdnImpl::checkFlags(new_flag, true);
     impl_->flags_ = new_flag;
+    markModified();
 }
 
 void
@@ -390,6 +391,7 @@ void
 Option6ClientFqdn::setDomainName(const std::string& domain_name,
                                  const DomainNameType domain_name_type) {
     impl_->setDomainName(domain_name, domain_name_type);
+    markModified();
 }
 
 void
@@ -421,6 +423,7 @@ Option6ClientFqdn::unpack(OptionBufferConstIter first,
     // because we don't want to discard the whole option because of MBZ bits
     // being set.
     impl_->checkFlags(impl_->flags_, false);
+    markModified();
 }
 
 std::string
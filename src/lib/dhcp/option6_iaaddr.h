@@ -76,19 +76,22 @@ public:
     /// sets address in this option.
     ///
     /// @param addr address to be sent in this option
-    void setAddress(const isc::asiolink::IOAddress& addr) { addr_ = addr; }
+    void setAddress(const isc::asiolink::IOAddress& addr) {
+        addr_ = addr;
+        markModified();
+    }
 
     /// Sets preferred lifetime (in seconds)
     ///
     /// @param pref address preferred lifetime (in seconds)
     ///
-    void setPreferred(unsigned int pref) { preferred_=pref; }
+    void setPreferred(unsigned int pref) { preferred_ = pref; markModified(); }
 
     /// Sets valid lifetime (in seconds).
     ///
     /// @param valid address valid lifetime (in seconds)
     ///
-    void setValid(unsigned int valid) { valid_=valid; }
+    void setValid(unsigned int valid) { valid_ = valid; markModified(); }
 
     /// Returns  address contained within this option.
     ///
@@ -174,6 +174,7 @@ Option6PDExclude::unpack(OptionBufferConstIter begin,
 
     excluded_prefix_length_ = excluded_prefix_length;
     subnet_id_.swap(subnet_id_bytes);
+    markModified();
 }
 
 uint16_t
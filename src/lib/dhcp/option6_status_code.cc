@@ -74,6 +74,7 @@ Option6StatusCode::unpack(OptionBufferConstIter begin, OptionBufferConstIter end
     begin += sizeof(uint16_t);
 
     status_message_.assign(begin, end);
+    markModified();
 }
 
 uint16_t
@@ -191,6 +192,7 @@ Option4SlpServiceScope::unpack(OptionBufferConstIter begin, OptionBufferConstIte
     begin += sizeof(uint8_t);
 
     scope_list_.assign(begin, end);
+    markModified();
 }
 
 uint16_t
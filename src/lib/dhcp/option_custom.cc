@@ -62,6 +62,7 @@ OptionCustom::addArrayDataField(const IOAddress& address) {
     OptionBuffer buf;
     OptionDataTypeUtil::writeAddress(address, buf);
     buffers_.push_back(buf);
+    markModified();
 }
 
 void
@@ -73,6 +74,7 @@ OptionCustom::addArrayDataField(const std::string& value) {
     OptionBuffer buf;
     OptionDataTypeUtil::writeTuple(value, lft, buf);
     buffers_.push_back(buf);
+    markModified();
 }
 
 void
@@ -82,6 +84,7 @@ OptionCustom::addArrayDataField(const OpaqueDataTuple& value) {
     OptionBuffer buf;
     OptionDataTypeUtil::writeTuple(value, buf);
     buffers_.push_back(buf);
+    markModified();
 }
 
 void
@@ -91,6 +94,7 @@ OptionCustom::addArrayDataField(const bool value) {
     OptionBuffer buf;
     OptionDataTypeUtil::writeBool(value, buf);
     buffers_.push_back(buf);
+    markModified();
 }
 
 void
@@ -106,6 +110,7 @@ OptionCustom::addArrayDataField(const PrefixLen& prefix_len,
     OptionBuffer buf;
     OptionDataTypeUtil::writePrefix(prefix_len, prefix, buf);
     buffers_.push_back(buf);
+    markModified();
 }
 
 void
@@ -121,6 +126,7 @@ OptionCustom::addArrayDataField(const PSIDLen& psid_len, const PSID& psid) {
     OptionBuffer buf;
     OptionDataTypeUtil::writePsid(psid_len, psid, buf);
     buffers_.push_back(buf);
+    markModified();
 }
 
 void
@@ -509,6 +515,7 @@ OptionCustom::writeAddress(const IOAddress& address,
     OptionBuffer buf;
     OptionDataTypeUtil::writeAddress(address, buf);
     std::swap(buf, buffers_[index]);
+    markModified();
 }
 
 const OptionBuffer&
@@ -522,6 +529,7 @@ OptionCustom::writeBinary(const OptionBuffer& buf,
                           const uint32_t index) {
     checkIndex(index);
     buffers_[index] = buf;
+    markModified();
 }
 
 std::string
@@ -547,6 +555,7 @@ OptionCustom::writeTuple(const std::string& value, const uint32_t index) {
     OpaqueDataTuple::LengthFieldType lft = getUniverse() == Option::V4 ?
         OpaqueDataTuple::LENGTH_1_BYTE : OpaqueDataTuple::LENGTH_2_BYTES;
     OptionDataTypeUtil::writeTuple(value, lft, buffers_[index]);
+    markModified();
 }
 
 void
@@ -555,6 +564,7 @@ OptionCustom::writeTuple(const OpaqueDataTuple& value, const uint32_t index) {
 
     buffers_[index].clear();
     OptionDataTypeUtil::writeTuple(value, buffers_[index]);
+    markModified();
 }
 
 bool
@@ -569,6 +579,7 @@ OptionCustom::writeBoolean(const bool value, const uint32_t index) {
 
     buffers_[index].clear();
     OptionDataTypeUtil::writeBool(value, buffers_[index]);
+    markModified();
 }
 
 std::string
@@ -592,6 +603,7 @@ OptionCustom::writeFqdn(const std::string& fqdn, const uint32_t index) {
     // We can move the contents of the temporary buffer to the
     // target buffer.
     std::swap(buffers_[index], buf);
+    markModified();
 }
 
 PrefixTuple
@@ -611,6 +623,7 @@ OptionCustom::writePrefix(const PrefixLen& prefix_len,
     // If there are no errors while writing PSID to a buffer, we can
     // replace the current buffer with a new buffer.
     std::swap(buffers_[index], buf);
+    markModified();
 }
 
 
@@ -630,6 +643,7 @@ OptionCustom::writePsid(const PSIDLen& psid_len, const PSID& psid,
     // If there are no errors while writing PSID to a buffer, we can
     // replace the current buffer with a new buffer.
     std::swap(buffers_[index], buf);
+    markModified();
 }
 
 
@@ -652,12 +666,14 @@ OptionCustom::writeString(const std::string& text, const uint32_t index) {
     if (!text.empty()) {
         OptionDataTypeUtil::writeString(text, buffers_[index]);
     }
+    markModified();
 }
 
 void
 OptionCustom::unpack(OptionBufferConstIter begin,
                      OptionBufferConstIter end) {
     initialize(begin, end);
+    markModified();
 }
 
 uint16_t
@@ -115,6 +115,7 @@ public:
         OptionBuffer buf;
         OptionDataTypeUtil::writeInt<T>(value, buf);
         buffers_.push_back(buf);
+        markModified();
     }
 
     /// @brief Create new buffer and store tuple value in it
@@ -282,6 +283,7 @@ public:
         OptionDataTypeUtil::writeInt<T>(value, buf);
         // If successful, replace the old buffer with new one.
         std::swap(buffers_[index], buf);
+        markModified();
     }
 
     /// @brief Read a buffer as variable length prefix.
@@ -182,7 +182,10 @@ public:
     /// @brief Set option value.
     ///
     /// @param value new option value.
-    void setValue(T value) { value_ = value; }
+    void setValue(T value) {
+        value_ = value;
+        markModified();
+    }
 
     /// @brief Return option value.
     ///
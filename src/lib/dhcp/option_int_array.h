@@ -131,6 +131,7 @@ public:
     /// @param value a value being added.
     void addValue(const T value) {
         values_.push_back(value);
+        markModified();
     }
 
     /// Writes option in wire-format to buf, returns pointer to first unused
@@ -219,6 +220,7 @@ public:
             // OptionDataTypeTraits structure during linking.
             begin += data_size_len;
         }
+        markModified();
         // We do not unpack sub-options here because we have array-type option.
         // Such option have variable number of data fields, thus there is no
         // way to assess where sub-options start.
@@ -232,7 +234,10 @@ public:
     /// @brief Set option values.
     ///
     /// @param values collection of values to be set for option.
-    void setValues(const std::vector<T>& values) { values_ = values; }
+    void setValues(const std::vector<T>& values) {
+        values_ = values;
+        markModified();
+    }
 
     /// @brief returns complete length of option
     ///
@@ -60,6 +60,7 @@ OptionOpaqueDataTuples::unpack(OptionBufferConstIter begin,
         // advance the offset by its total length.
         offset += tuple.getTotalLength();
     }
+    markModified();
 }
 
 void
@@ -71,6 +72,7 @@ OptionOpaqueDataTuples::addTuple(const OpaqueDataTuple& tuple) {
     }
 
     tuples_.push_back(tuple);
+    markModified();
 }
 
 
@@ -88,6 +90,7 @@ OptionOpaqueDataTuples::setTuple(const size_t at, const OpaqueDataTuple& tuple)
     }
 
     tuples_[at] = tuple;
+    markModified();
 }
 
 OpaqueDataTuple
@@ -51,6 +51,7 @@ OptionString::setValue(const std::string& value) {
     }
 
     setData(value.begin(), value.end());
+    markModified();
 }
 
 
@@ -80,6 +81,7 @@ OptionString::unpack(OptionBufferConstIter begin,
                   << " - empty value is not accepted");
     }
     setData(begin, end);
+    markModified();
 }
 
 std::string
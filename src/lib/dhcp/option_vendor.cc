@@ -71,6 +71,7 @@ void OptionVendor::unpack(OptionBufferConstIter begin,
     } else {
         LibDHCP::unpackVendorOptions4(vendor_id_, vendor_buffer, options_);
     }
+    markModified();
 }
 
 uint16_t OptionVendor::len() const {
@@ -90,6 +90,7 @@ OptionVendorClass::unpack(OptionBufferConstIter begin,
             }
         }
     }
+    markModified();
 }
 
 void
@@ -101,6 +102,7 @@ OptionVendorClass::addTuple(const OpaqueDataTuple& tuple) {
     }
 
     tuples_.push_back(tuple);
+    markModified();
 }
 
 
@@ -118,6 +120,7 @@ OptionVendorClass::setTuple(const size_t at, const OpaqueDataTuple& tuple) {
     }
 
     tuples_[at] = tuple;
+    markModified();
 }
 
 OpaqueDataTuple
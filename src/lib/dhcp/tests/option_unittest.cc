@@ -618,4 +618,113 @@ TEST_F(OptionTest, cloneInternal) {
     EXPECT_FALSE(clone);
 }
 
+/// @brief Returns the wire format of an option packed with @c pack.
+///
+/// @param option option to pack.
+std::vector<uint8_t>
+packed(const Option& option) {
+    OutputBuffer buf(64);
+    option.pack(buf);
+    const uint8_t* data = static_cast<const uint8_t*>(buf.getData());
+    return (std::vector<uint8_t>(data, data + buf.getLength()));
+}
+
+/// @brief Returns the wire format of an option packed with @c packCached.
+///
+/// @param option option to pack.
+std::vector<uint8_t>
+packedCached(const Option& option) {
+    OutputBuffer buf(64);
+    option.packCached(buf);
+    const uint8_t* data = static_cast<const uint8_t*>(buf.getData());
+    return (std::vector<uint8_t>(data, data + buf.getLength()));
+}
+
+// This test verifies that the cached wire format is used and is
+// computed again when the option is modified.
+TEST_F(OptionTest, wireCache) {
+    Option opt(Option::V4, 12, OptionBuffer(buf_.begin(), buf_.begin() + 4));
+    EXPECT_FALSE(opt.getWireCacheEnabled());
+
+    // The cache is not used when disabled.
+    EXPECT_EQ(packed(opt), packedCached(opt));
+    EXPECT_FALSE(opt.isWireCacheValid());
+
+    opt.setWireCacheEnabled(true);
+    EXPECT_TRUE(opt.getWireCacheEnabled());
+    EXPECT_FALSE(opt.isWireCacheValid());
+    EXPECT_EQ(packed(opt), packedCached(opt));
+    EXPECT_TRUE(opt.isWireCacheValid());
+    EXPECT_EQ(packed(opt), packedCached(opt));
+
+    // Each modification invalidates the cache.
+    opt.setUint16(0x1234);
+    EXPECT_FALSE(opt.isWireCacheValid());
+    std::vector<uint8_t> wire = packedCached(opt);
+    ASSERT_EQ(4, wire.size());
+    EXPECT_EQ(0x12, wire[2]);
+    EXPECT_EQ(0x34, wire[3]);
+    EXPECT_TRUE(opt.isWireCacheValid());
+
+    opt.setData(buf_.begin(), buf_.begin() + 2);
+    EXPECT_FALSE(opt.isWireCacheValid());
+    EXPECT_EQ(packed(opt), packedCached(opt));
+
+    OptionPtr sub(new Option(Option::V4, 1, OptionBuffer(1, 1)));
+    opt.addOption(sub);
+    EXPECT_FALSE(opt.isWireCacheValid());
+    EXPECT_EQ(packed(opt), packedCached(opt));
+
+    EXPECT_TRUE(opt.delOption(1));
+    EXPECT_FALSE(opt.isWireCacheValid());
+    EXPECT_EQ(packed(opt), packedCached(opt));
+
+    // Disabling the cache drops the cached wire format.
+    opt.setWireCacheEnabled(false);
+    EXPECT_FALSE(opt.isWireCacheValid());
+    EXPECT_EQ(packed(opt), packedCached(opt));
+}
+
+// This test verifies that the modification of a sub-option invalidates
+// the cached wire format of the option encapsulating it.
+TEST_F(OptionTest, wireCacheSubOption) {
+    OptionPtr opt(new Option(Option::V6, 1000));
+    boost::shared_ptr<OptionUint16> sub(new OptionUint16(Option::V6, 1001,
+                                                         0x0102));
+    boost::shared_ptr<OptionUint8> subsub(new OptionUint8(Option::V6, 1002,
+                                                          3));
+    sub->addOption(subsub);
+    opt->addOption(sub);
+    opt->setWireCacheEnabled(true);
+
+    std::vector<uint8_t> wire = packedCached(*opt);
+    EXPECT_EQ(packed(*opt), wire);
+    EXPECT_TRUE(opt->isWireCacheValid());
+
+    sub->setValue(0x0405);
+    EXPECT_FALSE(opt->isWireCacheValid());
+    EXPECT_NE(wire, packedCached(*opt));
+    EXPECT_EQ(packed(*opt), packedCached(*opt));
+    EXPECT_TRUE(opt->isWireCacheValid());
+
+    subsub->setValue(4);
+    EXPECT_FALSE(opt->isWireCacheValid());
+    EXPECT_EQ(packed(*opt), packedCached(*opt));
+
+    // The cached wire format is used when packing options.
+    OptionCollection options;
+    options.insert(std::make_pair(opt->getType(), opt));
+    OutputBuffer buf(64);
+    LibDHCP::packOptions6(buf, options);
+    const uint8_t* data = static_cast<const uint8_t*>(buf.getData());
+    EXPECT_EQ(packed(*opt),
+              std::vector<uint8_t>(data, data + buf.getLength()));
+
+    // A copy does not share the cached wire format.
+    OptionPtr copy = opt->clone();
+    EXPECT_TRUE(copy->getWireCacheEnabled());
+    EXPECT_FALSE(copy->isWireCacheValid());
+    EXPECT_EQ(packed(*opt), packedCached(*copy));
+}
+
 }
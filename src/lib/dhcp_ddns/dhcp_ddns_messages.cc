@@ -8,6 +8,7 @@ namespace isc {
 namespace dhcp_ddns {
 
 extern const isc::log::MessageID DHCP_DDNS_INVALID_NCR = "DHCP_DDNS_INVALID_NCR";
+extern const isc::log::MessageID DHCP_DDNS_NCR_BATCH_DROPPED = "DHCP_DDNS_NCR_BATCH_DROPPED";
 extern const isc::log::MessageID DHCP_DDNS_NCR_FLUSH_IO_ERROR = "DHCP_DDNS_NCR_FLUSH_IO_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_NCR_LISTEN_CLOSE_ERROR = "DHCP_DDNS_NCR_LISTEN_CLOSE_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_NCR_RECV_NEXT_ERROR = "DHCP_DDNS_NCR_RECV_NEXT_ERROR";
@@ -29,6 +30,7 @@ namespace {
 
 const char* values[] = {
     "DHCP_DDNS_INVALID_NCR", "application received an invalid DNS update request: %1",
+    "DHCP_DDNS_NCR_BATCH_DROPPED", "application stopped listening, %1 DNS update requests received in the same packet were dropped",
     "DHCP_DDNS_NCR_FLUSH_IO_ERROR", "DHCP-DDNS Last send before stopping did not complete successfully: %1",
     "DHCP_DDNS_NCR_LISTEN_CLOSE_ERROR", "application encountered an error while closing the listener used to receive NameChangeRequests : %1",
     "DHCP_DDNS_NCR_RECV_NEXT_ERROR", "application could not initiate the next read following a request receive.",
@@ -9,6 +9,7 @@ namespace isc {
 namespace dhcp_ddns {
 
 extern const isc::log::MessageID DHCP_DDNS_INVALID_NCR;
+extern const isc::log::MessageID DHCP_DDNS_NCR_BATCH_DROPPED;
 extern const isc::log::MessageID DHCP_DDNS_NCR_FLUSH_IO_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_NCR_LISTEN_CLOSE_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_NCR_RECV_NEXT_ERROR;
@@ -101,6 +101,35 @@ NameChangeListener::stopListening() {
     setListening(false);
 }
 
+void
+NameChangeListener::invokeRecvHandler(const Result result,
+                                      std::vector<NameChangeRequestPtr>& ncrs) {
+    // Hand all but the last request to the handler without starting the
+    // next receive. The last one goes through the single request variant
+    // which does that.
+    for (size_t i = 0; i + 1 < ncrs.size(); ++i) {
+        try {
+            io_pending_ = false;
+            recv_handler_(result, ncrs[i]);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_UNCAUGHT_NCR_RECV_HANDLER_ERROR)
+                      .arg(ex.what());
+        }
+
+        // The handler has stopped listening, there is nobody to hand the
+        // rest of the requests to.
+        if (!amListening()) {
+            LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_BATCH_DROPPED)
+                      .arg(ncrs.size() - i - 1);
+            return;
+        }
+    }
+
+    if (!ncrs.empty()) {
+        invokeRecvHandler(result, ncrs.back());
+    }
+}
+
 void
 NameChangeListener::invokeRecvHandler(const Result result,
                                       NameChangeRequestPtr& ncr) {
@@ -266,23 +295,34 @@ NameChangeSender::sendNext() {
 }
 
 void
-NameChangeSender::invokeSendHandler(const NameChangeSender::Result result) {
+NameChangeSender::invokeSendHandler(const NameChangeSender::Result result,
+                                    const size_t count) {
     // @todo reset defense timer
+    std::vector<NameChangeRequestPtr> sent;
     if (result == SUCCESS) {
-        // It shipped so pull it off the queue.
-        send_queue_.pop_front();
+        // They shipped so pull them off the queue.
+        for (size_t i = 0; (i < count) && !send_queue_.empty(); ++i) {
+            sent.push_back(send_queue_.front());
+            send_queue_.pop_front();
+        }
+    }
+
+    if (sent.empty()) {
+        sent.push_back(ncr_to_send_);
     }
 
     // Invoke the completion handler passing in the result and a pointer
-    // the request involved.
+    // the request involved, for each request.
     // Surround the invocation with a try-catch. The invoked handler is
     // not supposed to throw, but in the event it does we will at least
     // report it.
-    try {
-        send_handler_(result, ncr_to_send_);
-    } catch (const std::exception& ex) {
-        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_UNCAUGHT_NCR_SEND_HANDLER_ERROR)
-                  .arg(ex.what());
+    for (auto ncr = sent.begin(); ncr != sent.end(); ++ncr) {
+        try {
+            send_handler_(result, *ncr);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_UNCAUGHT_NCR_SEND_HANDLER_ERROR)
+                      .arg(ex.what());
+        }
     }
 
     // Clear the pending ncr pointer.
@@ -54,6 +54,7 @@
 #include <exceptions/exceptions.h>
 
 #include <deque>
+#include <vector>
 
 namespace isc {
 namespace dhcp_ddns {
@@ -265,6 +266,19 @@ protected:
     /// wise.
     void invokeRecvHandler(const Result result, NameChangeRequestPtr& ncr);
 
+    /// @brief Calls the NCR receive handler for each of several requests
+    /// received at once.
+    ///
+    /// The handler is called for each request in turn and the next receive
+    /// is started after the last one, as by the single request variant.
+    /// If the handler stops the listener (e.g. because its queue is full)
+    /// the remaining requests are dropped.
+    ///
+    /// @param result contains that receive outcome status.
+    /// @param ncrs the newly received requests. It must not be empty.
+    void invokeRecvHandler(const Result result,
+                           std::vector<NameChangeRequestPtr>& ncrs);
+
     /// @brief Abstract method which opens the IO source for reception.
     ///
     /// The derivation uses this method to perform the steps needed to
@@ -592,6 +606,12 @@ protected:
     /// If not we leave it there so we can retry it.  After we invoke the
     /// handler we clear the pending ncr value and queue up the next send.
     ///
+    /// A derivation may send several requests from the front of the queue
+    /// at once. When such a send succeeds, all of them are removed from the
+    /// queue and the handler is invoked for each of them. When it fails,
+    /// they are all left on the queue and the handler is invoked once, for
+    /// the request at the front.
+    ///
     /// NOTE:
     /// The handler invoked by this method MUST NOT THROW. The handler is
     /// application level logic and should trap and handle any errors at
@@ -608,7 +628,10 @@ protected:
     /// the interface contract.
     ///
     /// @param result contains that send outcome status.
-    void invokeSendHandler(const NameChangeSender::Result result);
+    /// @param count number of requests sent at once, starting with the
+    /// one at the front of the queue.
+    void invokeSendHandler(const NameChangeSender::Result result,
+                           const size_t count = 1);
 
     /// @brief Abstract method which opens the IO sink for transmission.
     ///
@@ -29,6 +29,10 @@ NameChangeFormat stringToNcrFormat(const std::string& fmt_str) {
         return FMT_JSON;
     }
 
+    if (boost::iequals(fmt_str, "BINARY")) {
+        return FMT_BINARY;
+    }
+
     isc_throw(BadValue, "Invalid NameChangeRequest format: " << fmt_str);
 }
 
@@ -38,6 +42,10 @@ std::string ncrFormatToString(NameChangeFormat format) {
         return ("JSON");
     }
 
+    if (format == FMT_BINARY) {
+        return ("BINARY");
+    }
+
     std::ostringstream stream;
     stream  << "UNKNOWN(" << format << ")";
     return (stream.str());
@@ -255,6 +263,29 @@ NameChangeRequest::fromFormat(const NameChangeFormat format,
                       << ex.what());
         }
 
+        break;
+        }
+    case FMT_BINARY: {
+        try {
+            // Get the length of the request data and make sure the buffer
+            // holds that much before handing it to the decoder.
+            size_t len = buffer.readUint16();
+            if (buffer.getLength() - buffer.getPosition() < len) {
+                isc_throw(NcrMessageError, "fromFormat: request length "
+                          << len << " exceeds remaining buffer length "
+                          << buffer.getLength() - buffer.getPosition());
+            }
+
+            std::vector<uint8_t> data;
+            buffer.readVector(data, len);
+            ncr = NameChangeRequest::fromBinary(data.empty() ? NULL : &data[0],
+                                                data.size());
+        } catch (isc::util::InvalidBufferPosition& ex) {
+            // Read error accessing data in InputBuffer.
+            isc_throw(NcrMessageError, "fromFormat: buffer read error: "
+                      << ex.what());
+        }
+
         break;
         }
     default:
@@ -283,6 +314,15 @@ NameChangeRequest::toFormat(const NameChangeFormat format,
         buffer.writeData(json.c_str(), length);
         break;
         }
+    case FMT_BINARY: {
+        // Reserve room for the length, write the data and then go back
+        // and fill in the length.
+        size_t length_pos = buffer.getLength();
+        buffer.writeUint16(0);
+        toBinary(buffer);
+        buffer.writeUint16At(buffer.getLength() - length_pos - 2, length_pos);
+        break;
+        }
     default:
         // Programmatic error, shouldn't happen.
         isc_throw(NcrMessageError, "toFormat - invalid format");
@@ -373,6 +413,109 @@ NameChangeRequest::toJSON() const  {
 }
 
 
+namespace {
+
+/// @brief Version of the binary rendition of a request.
+const uint8_t NCR_BINARY_VERSION = 1;
+
+/// @brief Flag set in the binary rendition for a forward change.
+const uint8_t NCR_BINARY_FORWARD = 0x01;
+
+/// @brief Flag set in the binary rendition for a reverse change.
+const uint8_t NCR_BINARY_REVERSE = 0x02;
+
+}
+
+NameChangeRequestPtr
+NameChangeRequest::fromBinary(const uint8_t* data, const size_t length) {
+    isc::util::InputBuffer buffer(data, length);
+    NameChangeRequestPtr ncr(new NameChangeRequest());
+    try {
+        uint8_t version = buffer.readUint8();
+        if (version != NCR_BINARY_VERSION) {
+            isc_throw(NcrMessageError, "Unsupported binary NameChangeRequest"
+                      " version: " << static_cast<int>(version));
+        }
+
+        uint8_t change_type = buffer.readUint8();
+        if ((change_type != CHG_ADD) && (change_type != CHG_REMOVE)) {
+            isc_throw(NcrMessageError, "Invalid NameChangeRequest change type: "
+                      << static_cast<int>(change_type));
+        }
+        ncr->setChangeType(static_cast<NameChangeType>(change_type));
+
+        uint8_t flags = buffer.readUint8();
+        ncr->setForwardChange(flags & NCR_BINARY_FORWARD);
+        ncr->setReverseChange(flags & NCR_BINARY_REVERSE);
+
+        std::vector<uint8_t> vec;
+        buffer.readVector(vec, buffer.readUint16());
+        ncr->setFqdn(std::string(vec.begin(), vec.end()));
+
+        uint8_t addr_len = buffer.readUint8();
+        uint8_t addr[isc::asiolink::V6ADDRESS_LEN];
+        if (addr_len == isc::asiolink::V4ADDRESS_LEN) {
+            buffer.readData(addr, addr_len);
+            ncr->ip_io_address_ = isc::asiolink::IOAddress::fromBytes(AF_INET,
+                                                                      addr);
+        } else if (addr_len == isc::asiolink::V6ADDRESS_LEN) {
+            buffer.readData(addr, addr_len);
+            ncr->ip_io_address_ = isc::asiolink::IOAddress::fromBytes(AF_INET6,
+                                                                      addr);
+        } else {
+            isc_throw(NcrMessageError, "Invalid NameChangeRequest address"
+                      " length: " << static_cast<int>(addr_len));
+        }
+
+        buffer.readVector(vec, buffer.readUint16());
+        ncr->dhcid_.fromBytes(vec);
+
+        uint64_t expires_on = buffer.readUint32();
+        expires_on = (expires_on << 32) | buffer.readUint32();
+        ncr->lease_expires_on_ = expires_on;
+
+        ncr->setLeaseLength(buffer.readUint32());
+    } catch (const isc::util::InvalidBufferPosition& ex) {
+        isc_throw(NcrMessageError, "Truncated binary NameChangeRequest: "
+                  << ex.what());
+    }
+
+    if (buffer.getPosition() != length) {
+        isc_throw(NcrMessageError, "Binary NameChangeRequest has "
+                  << length - buffer.getPosition() << " trailing bytes");
+    }
+
+    // Validate the overall content semantically, as the JSON parser does.
+    ncr->validateContent();
+
+    return (ncr);
+}
+
+void
+NameChangeRequest::toBinary(isc::util::OutputBuffer& buffer) const {
+    buffer.writeUint8(NCR_BINARY_VERSION);
+    buffer.writeUint8(static_cast<uint8_t>(change_type_));
+    buffer.writeUint8((forward_change_ ? NCR_BINARY_FORWARD : 0) |
+                      (reverse_change_ ? NCR_BINARY_REVERSE : 0));
+
+    buffer.writeUint16(fqdn_.size());
+    buffer.writeData(fqdn_.c_str(), fqdn_.size());
+
+    const std::vector<uint8_t> addr = ip_io_address_.toBytes();
+    buffer.writeUint8(addr.size());
+    buffer.writeData(&addr[0], addr.size());
+
+    const std::vector<uint8_t>& dhcid = dhcid_.getBytes();
+    buffer.writeUint16(dhcid.size());
+    if (!dhcid.empty()) {
+        buffer.writeData(&dhcid[0], dhcid.size());
+    }
+
+    buffer.writeUint32(static_cast<uint32_t>(lease_expires_on_ >> 32));
+    buffer.writeUint32(static_cast<uint32_t>(lease_expires_on_));
+    buffer.writeUint32(lease_length_);
+}
+
 void
 NameChangeRequest::validateContent() {
     //@todo This is an initial implementation which provides a minimal amount
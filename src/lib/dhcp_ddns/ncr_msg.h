@@ -58,13 +58,14 @@ enum NameChangeStatus  {
 
 /// @brief Defines the list of data wire formats supported.
 enum NameChangeFormat {
-  FMT_JSON
+  FMT_JSON,
+  FMT_BINARY
 };
 
 /// @brief Function which converts labels to  NameChangeFormat enum values.
 ///
 /// @param fmt_str text to convert to an enum.
-/// Valid string values: "JSON"
+/// Valid string values: "JSON", "BINARY"
 ///
 /// @return NameChangeFormat value which maps to the given string.
 ///
@@ -128,6 +129,13 @@ public:
     /// @return a string containing a contiguous stream of digits.
     std::string toStr() const;
 
+    /// @brief Sets the DHCID value from raw bytes.
+    ///
+    /// @param bytes DHCID value in unsigned bytes.
+    void fromBytes(const std::vector<uint8_t>& bytes) {
+        bytes_ = bytes;
+    }
+
     /// @brief Sets the DHCID value based on the given string.
     ///
     /// @param data is a string of hexadecimal digits. The format is simply
@@ -272,7 +280,13 @@ public:
     /// is than treated as JSON which is then parsed into the data needed
     /// to create a request instance.
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: The buffer is expected to contain a two byte unsigned integer
+    /// which specifies the length of the request data; followed by the data
+    /// itself, as described under
+    /// isc::dhcp_ddns::NameChangeRequest::fromBinary.
+    ///
+    /// In both formats the buffer is left positioned after the request, so
+    /// as several requests stored back to back may be read in turn.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the input buffer containing the marshalled request
@@ -297,7 +311,10 @@ public:
     /// is identical that described under
     /// isc::dhcp_ddns::NameChangeRequest::fromJSON
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: Upon completion, the buffer will contain a two byte unsigned
+    /// integer which specifies the length of the request data; followed by
+    /// the data itself, as described under
+    /// isc::dhcp_ddns::NameChangeRequest::fromBinary.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the output buffer to which the request should be
@@ -403,6 +420,39 @@ public:
     /// @return a string containing the JSON rendition of the request
     std::string toJSON() const;
 
+    /// @brief Static method for creating a NameChangeRequest from its
+    /// binary rendition.
+    ///
+    /// The binary rendition carries the same members as the JSON one
+    /// without the need to format and parse text. All integers are in
+    /// network byte order:
+    ///
+    /// - version (1 byte) - version of the rendition, currently 1.
+    /// - change-type (1 byte) - 0 for add/update and 1 for remove.
+    /// - flags (1 byte) - 0x01 if the forward zone should be updated,
+    ///   0x02 if the reverse zone should be updated.
+    /// - fqdn length (2 bytes) followed by the fqdn text.
+    /// - ip-address length (1 byte), 4 or 16, followed by the address.
+    /// - dhcid length (2 bytes) followed by the dhcid bytes.
+    /// - lease-expires-on (8 bytes) - seconds since the epoch.
+    /// - lease-length (4 bytes) - the length of the lease in seconds.
+    ///
+    /// @param data pointer to the binary rendition.
+    /// @param length length of the binary rendition.
+    ///
+    /// @return a pointer to the new NameChangeRequest
+    ///
+    /// @throw NcrMessageError if an error occurs creating new request.
+    static NameChangeRequestPtr fromBinary(const uint8_t* data,
+                                           const size_t length);
+
+    /// @brief Instance method for marshalling the contents of the request
+    /// into its binary rendition.
+    ///
+    /// @param buffer is the output buffer to which the binary rendition
+    /// (without the length prefix) is appended.
+    void toBinary(isc::util::OutputBuffer& buffer) const;
+
     /// @brief Validates the content of a populated request.  This method is
     /// used by both the full constructor and from-wire marshalling to ensure
     /// that the request is content valid.  Currently it enforces the
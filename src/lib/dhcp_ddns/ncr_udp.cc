@@ -158,6 +158,31 @@ NameChangeUDPListener::receiveCompletionHandler(const bool successful,
         isc::util::InputBuffer input_buffer(callback->getData(),
                                             callback->getBytesTransferred());
 
+        // A binary packet may carry several requests back to back.
+        if (format_ == FMT_BINARY) {
+            std::vector<NameChangeRequestPtr> ncrs;
+            try {
+                while (input_buffer.getPosition() < input_buffer.getLength()) {
+                    ncrs.push_back(NameChangeRequest::fromFormat(format_,
+                                                                 input_buffer));
+                }
+            } catch (const NcrMessageError& ex) {
+                // The requests behind a bad one can't be located, but
+                // those in front of it are fine.
+                LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_INVALID_NCR).arg(ex.what());
+            }
+
+            if (ncrs.empty()) {
+                // Queue up the next receive.
+                // NOTE: We must call the base class, NEVER doReceive
+                receiveNext();
+                return;
+            }
+
+            invokeRecvHandler(result, ncrs);
+            return;
+        }
+
         try {
             ncr = NameChangeRequest::fromFormat(format_, input_buffer);
         } catch (const NcrMessageError& ex) {
@@ -201,7 +226,8 @@ NameChangeUDPSender(const isc::asiolink::IOAddress& ip_address,
     : NameChangeSender(ncr_send_handler, send_que_max),
       ip_address_(ip_address), port_(port), server_address_(server_address),
       server_port_(server_port), format_(format),
-      reuse_address_(reuse_address) {
+      reuse_address_(reuse_address), max_batch_(MAX_BATCH_DEFAULT),
+      batch_size_(1) {
     // Instantiate the send callback.  This gets passed into each send.
     // Note that the callback constructor is passed the an instance method
     // pointer to our completion handler, sendCompletionHandler.
@@ -288,6 +314,22 @@ NameChangeUDPSender::doSend(NameChangeRequestPtr& ncr) {
     // Now use the NCR to write JSON to an output buffer.
     isc::util::OutputBuffer ncr_buffer(SEND_BUF_MAX);
     ncr->toFormat(format_, ncr_buffer);
+    batch_size_ = 1;
+
+    // Binary requests are self delimiting, so the requests queued behind
+    // this one may ride along in the same packet.
+    if (format_ == FMT_BINARY) {
+        isc::util::OutputBuffer next_buffer(SEND_BUF_MAX);
+        while ((batch_size_ < max_batch_) && (batch_size_ < getQueueSize())) {
+            next_buffer.clear();
+            peekAt(batch_size_)->toFormat(format_, next_buffer);
+            if (ncr_buffer.getLength() + next_buffer.getLength() > SEND_BUF_MAX) {
+                break;
+            }
+            ncr_buffer.writeData(next_buffer.getData(), next_buffer.getLength());
+            ++batch_size_;
+        }
+    }
 
     // Copy the wire-ized request to callback.  This way we know after
     // send completes what we sent (or attempted to send).
@@ -342,7 +384,16 @@ NameChangeUDPSender::sendCompletionHandler(const bool successful,
     }
 
     // Call the application's registered request send handler.
-    invokeSendHandler(result);
+    invokeSendHandler(result, batch_size_);
+}
+
+void
+NameChangeUDPSender::setMaxBatch(const size_t max_batch) {
+    if (max_batch == 0) {
+        isc_throw(BadValue, "maximum number of requests per packet must"
+                  " be greater than 0");
+    }
+    max_batch_ = max_batch;
 }
 
 int
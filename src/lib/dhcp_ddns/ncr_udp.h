@@ -444,6 +444,10 @@ public:
     /// @brief Defines the maximum size packet that can be sent.
     static const size_t SEND_BUF_MAX =  NameChangeUDPListener::RECV_BUF_MAX;
 
+    /// @brief Defines the default maximum number of requests sent in a
+    /// single packet.
+    static const size_t MAX_BATCH_DEFAULT = 32;
+
     /// @brief Constructor
     ///
     /// @param ip_address the IP address from which to send
@@ -497,6 +501,11 @@ public:
     /// asyncSend() method is called, passing in send_callback_ member's
     /// transfer buffer as the send buffer and the send_callback_ itself
     /// as the callback object.
+    ///
+    /// When the format is BINARY, the requests queued behind the given one
+    /// are sent in the same packet, as many of them as fit into the packet
+    /// and the maximum batch size allows.
+    ///
     /// @param ncr NameChangeRequest to send.
     virtual void doSend(NameChangeRequestPtr& ncr);
 
@@ -540,6 +549,22 @@ public:
     /// @return true if the sender has at IO ready, false otherwise.
     virtual bool ioReady();
 
+    /// @brief Returns the maximum number of requests sent in a single
+    /// packet.
+    size_t getMaxBatch() const {
+        return (max_batch_);
+    }
+
+    /// @brief Sets the maximum number of requests sent in a single packet.
+    ///
+    /// It only applies to the BINARY format. A value of 1 disables
+    /// batching.
+    ///
+    /// @param max_batch new maximum.
+    ///
+    /// @throw BadValue if max_batch is 0.
+    void setMaxBatch(const size_t max_batch);
+
 private:
 
     /// @brief Closes watch socket if the socket is open.
@@ -580,6 +605,12 @@ private:
 
     /// @brief Pointer to WatchSocket instance supplying the "select-fd".
     util::WatchSocketPtr watch_socket_;
+
+    /// @brief Maximum number of requests sent in a single packet.
+    size_t max_batch_;
+
+    /// @brief Number of requests in the packet being sent.
+    size_t batch_size_;
 };
 
 } // namespace isc::dhcp_ddns
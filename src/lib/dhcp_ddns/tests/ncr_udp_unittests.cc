@@ -641,6 +641,20 @@ public:
         received_ncrs_.clear();
     }
 
+    /// @brief Replaces the listener and sender with ones using the
+    /// given format.
+    ///
+    /// @param format format of the requests on the wire.
+    void useFormat(const NameChangeFormat format) {
+        isc::asiolink::IOAddress addr(TEST_ADDRESS);
+        listener_.reset(
+            new NameChangeUDPListener(addr, LISTENER_PORT, format,
+                                      *this, true));
+        sender_.reset(
+            new NameChangeUDPSender(addr, SENDER_PORT, addr, LISTENER_PORT,
+                                    format, *this, 100, true));
+    }
+
     /// @brief Implements the receive completion handler.
     virtual void operator ()(const NameChangeListener::Result result,
                              NameChangeRequestPtr& ncr) {
@@ -719,6 +733,62 @@ TEST_F (NameChangeUDPTest, roundTripTest) {
     EXPECT_FALSE(sender_->amSending());
 }
 
+/// @brief Uses a sender and listener to test batched delivery of binary NCRs.
+/// The requests queued while the first one is being sent are all sent in
+/// the second packet. The test verifies that what was sent matches what was
+/// received both in quantity and in content.
+TEST_F (NameChangeUDPTest, binaryBatchRoundTripTest) {
+    // Replace the listener and sender with binary ones.
+    useFormat(FMT_BINARY);
+
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    int num_msgs = sizeof(valid_msgs)/sizeof(char*);
+    ASSERT_GT(num_msgs, 2);
+    for (int i = 0; i < num_msgs; i++) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[i]));
+        sender_->sendRequest(ncr);
+    }
+
+    // Count the send completions. The first request went out alone, the
+    // rest went out together.
+    int sends = 0;
+    while (sender_->getQueueSize() > 0 || (received_ncrs_.size() < num_msgs)) {
+        size_t sent = sent_ncrs_.size();
+        EXPECT_NO_THROW(io_service_.run_one());
+        if (sent_ncrs_.size() > sent) {
+            ++sends;
+        }
+    }
+    EXPECT_EQ(2, sends);
+
+    ASSERT_EQ(num_msgs, sent_ncrs_.size());
+    ASSERT_EQ(num_msgs, received_ncrs_.size());
+    EXPECT_EQ(NameChangeSender::SUCCESS, send_result_);
+    EXPECT_EQ(NameChangeListener::SUCCESS, recv_result_);
+    for (int i = 0; i < num_msgs; i++) {
+        EXPECT_TRUE (checkSendVsReceived(sent_ncrs_[i], received_ncrs_[i]));
+    }
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(io_service_.run_one());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Tests the maximum number of requests sent in a single packet.
+TEST(NameChangeUDPSenderBasicTest, maxBatch) {
+    isc::asiolink::IOAddress ip_address(TEST_ADDRESS);
+    SimpleSendHandler ncr_handler;
+    NameChangeUDPSender sender(ip_address, SENDER_PORT, ip_address,
+                               LISTENER_PORT, FMT_BINARY, ncr_handler);
+    EXPECT_EQ(NameChangeUDPSender::MAX_BATCH_DEFAULT, sender.getMaxBatch());
+    EXPECT_THROW(sender.setMaxBatch(0), isc::BadValue);
+    ASSERT_NO_THROW(sender.setMaxBatch(1));
+    EXPECT_EQ(1, sender.getMaxBatch());
+}
+
 // Tests error handling of a failure to mark the watch socket ready, when
 // sendRequest() is called.
 TEST(NameChangeUDPSenderBasicTest, watchClosedBeforeSendRequest) {
@@ -584,6 +584,88 @@ TEST(NameChangeRequestTest, toFromBufferTest) {
     ASSERT_EQ(final_str, msg_str);
 }
 
+/// @brief Tests binary rendition of requests.
+/// This test verifies that:
+/// 1. Several NameChangeRequests can be rendered in binary written back to
+/// back to an OutputBuffer.
+/// 2. The requests can be read in turn from an InputBuffer and are equal
+/// to the originals.
+TEST(NameChangeRequestTest, binaryToFromBufferTest) {
+    std::vector<NameChangeRequestPtr> ncrs;
+    isc::util::OutputBuffer output_buffer(1024);
+    int num_msgs = sizeof(valid_msgs)/sizeof(char*);
+    for (int i = 0; i < num_msgs; i++) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[i]));
+        ASSERT_NO_THROW(ncr->toFormat(FMT_BINARY, output_buffer));
+        ncrs.push_back(ncr);
+    }
+
+    isc::util::InputBuffer input_buffer(output_buffer.getData(),
+                                        output_buffer.getLength());
+    for (int i = 0; i < num_msgs; i++) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromFormat(FMT_BINARY,
+                                                            input_buffer));
+        ASSERT_TRUE(ncr);
+        EXPECT_TRUE(*ncr == *ncrs[i]) << " index: " << i;
+        EXPECT_EQ(ncrs[i]->toJSON(), ncr->toJSON());
+    }
+    EXPECT_EQ(input_buffer.getLength(), input_buffer.getPosition());
+}
+
+/// @brief Tests that invalid binary renditions are rejected.
+TEST(NameChangeRequestTest, invalidBinaryChecks) {
+    NameChangeRequestPtr ncr;
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+    isc::util::OutputBuffer valid(1024);
+    ASSERT_NO_THROW(ncr->toBinary(valid));
+    const uint8_t* data = static_cast<const uint8_t*>(valid.getData());
+    std::vector<uint8_t> bytes(data, data + valid.getLength());
+
+    // The valid rendition is accepted.
+    ASSERT_NO_THROW(NameChangeRequest::fromBinary(&bytes[0], bytes.size()));
+
+    // Unsupported version.
+    std::vector<uint8_t> bad = bytes;
+    bad[0] = 2;
+    EXPECT_THROW(NameChangeRequest::fromBinary(&bad[0], bad.size()),
+                 NcrMessageError);
+
+    // Invalid change type.
+    bad = bytes;
+    bad[1] = 7;
+    EXPECT_THROW(NameChangeRequest::fromBinary(&bad[0], bad.size()),
+                 NcrMessageError);
+
+    // Neither forward nor reverse change.
+    bad = bytes;
+    bad[2] = 0;
+    EXPECT_THROW(NameChangeRequest::fromBinary(&bad[0], bad.size()),
+                 NcrMessageError);
+
+    // Truncated.
+    for (size_t len = 0; len < bytes.size(); ++len) {
+        EXPECT_THROW(NameChangeRequest::fromBinary(&bytes[0], len),
+                     NcrMessageError) << " length: " << len;
+    }
+
+    // Trailing bytes.
+    bad = bytes;
+    bad.push_back(0);
+    EXPECT_THROW(NameChangeRequest::fromBinary(&bad[0], bad.size()),
+                 NcrMessageError);
+
+    // Length prefix exceeding the buffer.
+    isc::util::OutputBuffer prefixed(1024);
+    prefixed.writeUint16(bytes.size() + 1);
+    prefixed.writeData(&bytes[0], bytes.size());
+    isc::util::InputBuffer input_buffer(prefixed.getData(),
+                                        prefixed.getLength());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, input_buffer),
+                 NcrMessageError);
+}
+
 /// @brief Tests ip address modification and validation
 TEST(NameChangeRequestTest, ipAddresses) {
     NameChangeRequest ncr;
@@ -610,9 +692,12 @@ TEST(NameChangeRequestTest, ipAddresses) {
 TEST(NameChangeFormatTest, formatEnumConversion){
     ASSERT_EQ(stringToNcrFormat("JSON"), dhcp_ddns::FMT_JSON);
     ASSERT_EQ(stringToNcrFormat("jSoN"), dhcp_ddns::FMT_JSON);
+    ASSERT_EQ(stringToNcrFormat("BINARY"), dhcp_ddns::FMT_BINARY);
+    ASSERT_EQ(stringToNcrFormat("binary"), dhcp_ddns::FMT_BINARY);
     ASSERT_THROW(stringToNcrFormat("bogus"), isc::BadValue);
 
     ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_JSON), "JSON");
+    ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_BINARY), "BINARY");
 }
 
 /// @brief Tests conversion of NameChangeProtocol between enum and strings.
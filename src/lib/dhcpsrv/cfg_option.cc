@@ -30,7 +30,8 @@ OptionDescriptor::equals(const OptionDescriptor& other) const {
             option_->equals(other.option_));
 }
 
-CfgOption::CfgOption() {
+CfgOption::CfgOption()
+    : generation_(0) {
 }
 
 bool
@@ -71,6 +72,7 @@ CfgOption::add(const OptionDescriptor& desc, const std::string& option_space) {
     } else {
         options_.addItem(desc, option_space);
     }
+    ++generation_;
 }
 
 void
@@ -96,6 +98,7 @@ CfgOption::replace(const OptionDescriptor& desc, const std::string& option_space
     } 
 
     idx.replace(od_itr, desc);
+    ++generation_;
 }
 
 
@@ -215,6 +218,7 @@ CfgOption::mergeTo(CfgOption& other) const {
     mergeInternal(options_, other.options_);
     // Merge vendor options.
     mergeInternal(vendor_options_, other.vendor_options_);
+    ++other.generation_;
 }
 
 void
@@ -319,6 +323,8 @@ CfgOption::getAll(const uint32_t vendor_id) const {
 
 size_t
 CfgOption::del(const std::string& option_space, const uint16_t option_code) {
+    ++generation_;
+
     // Check for presence of options.
     OptionContainerPtr options = getAll(option_space);
     if (!options || options->empty()) {
@@ -356,6 +362,8 @@ CfgOption::del(const std::string& option_space, const uint16_t option_code) {
 
 size_t
 CfgOption::del(const uint32_t vendor_id, const uint16_t option_code) {
+    ++generation_;
+
     // Check for presence of options.
     OptionContainerPtr vendor_options = getAll(vendor_id);
     if (!vendor_options || vendor_options->empty()) {
@@ -369,6 +377,8 @@ CfgOption::del(const uint32_t vendor_id, const uint16_t option_code) {
 
 size_t
 CfgOption::del(const uint64_t id) {
+    ++generation_;
+
     // Hierarchical nature of the options configuration requires that
     // we go over all options and decapsulate them before removing
     // any of them. Let's walk over the existing option spaces.
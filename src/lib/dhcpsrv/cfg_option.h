@@ -277,6 +277,15 @@ public:
     /// @return true when the object is empty
     bool empty() const;
 
+    /// @brief Returns the number of modifications of the object.
+    ///
+    /// The value is incremented each time options are added, replaced,
+    /// deleted or merged into the object. It allows for detecting that
+    /// data derived from the object is stale.
+    uint64_t getGeneration() const {
+        return (generation_);
+    }
+
     /// @name Methods and operators used for comparing objects.
     ///
     //@{
@@ -643,6 +652,9 @@ private:
                                  uint32_t> VendorOptionSpaceCollection;
     /// @brief Container holding options grouped by vendor id.
     VendorOptionSpaceCollection vendor_options_;
+
+    /// @brief Number of modifications of the object.
+    uint64_t generation_;
 };
 
 /// @name Pointers to the @c CfgOption objects.
@@ -0,0 +1,162 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/cfg_option_flat.h>
+#include <algorithm>
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Orders the options of a flattened view by code.
+struct CodeLess {
+    bool operator()(const std::pair<uint16_t, OptionPtr>& option,
+                    const uint16_t code) const {
+        return (option.first < code);
+    }
+};
+
+}
+
+CfgOptionFlat::CfgOptionFlat(const std::string& option_space,
+                             CfgOptionList::const_iterator begin,
+                             CfgOptionList::const_iterator end,
+                             const ConstCfgOptionFlatPtr& base)
+    : option_space_(option_space), options_(), persistent_() {
+    std::map<uint16_t, OptionPtr> options;
+    for (CfgOptionList::const_iterator copts = begin; copts != end; ++copts) {
+        const OptionContainerPtr& opts = (*copts)->getAll(option_space);
+        if (!opts) {
+            continue;
+        }
+
+        for (OptionContainer::const_iterator desc = opts->begin();
+             desc != opts->end(); ++desc) {
+            if (!desc->option_) {
+                continue;
+            }
+
+            uint16_t code = desc->option_->getType();
+            if (desc->persistent_) {
+                persistent_.push_back(code);
+            }
+
+            // A previous configuration takes precedence. Within the same
+            // configuration pick the option CfgOption::get would return.
+            if (options.count(code) == 0) {
+                options[code] = (*copts)->get(option_space, code).option_;
+            }
+        }
+    }
+
+    // The options of the base view come last.
+    if (base) {
+        options.insert(base->options_.begin(), base->options_.end());
+        persistent_.insert(persistent_.end(), base->persistent_.begin(),
+                           base->persistent_.end());
+    }
+
+    options_.assign(options.begin(), options.end());
+}
+
+OptionPtr
+CfgOptionFlat::get(const uint16_t option_code) const {
+    std::vector<CodedOption>::const_iterator it =
+        std::lower_bound(options_.begin(), options_.end(), option_code,
+                         CodeLess());
+    if ((it != options_.end()) && (it->first == option_code)) {
+        return (it->second);
+    }
+    return (OptionPtr());
+}
+
+// Makes constant visible to Google test macros.
+const size_t CfgOptionFlatCache::MAX_ENTRIES_DEFAULT;
+
+bool
+CfgOptionFlatCache::Entry::expired() const {
+    for (std::vector<boost::weak_ptr<const CfgOption> >::const_iterator cfg =
+             cfg_options_.begin(); cfg != cfg_options_.end(); ++cfg) {
+        if (cfg->expired()) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+CfgOptionFlatCache::CfgOptionFlatCache(const size_t max_entries)
+    : max_entries_(max_entries), cache_() {
+}
+
+ConstCfgOptionFlatPtr
+CfgOptionFlatCache::get(const std::string& option_space,
+                        const CfgOptionList& co_list,
+                        const size_t uncached) {
+    CfgOptionList::const_iterator first = co_list.begin();
+    for (size_t i = 0; (i < uncached) && (first != co_list.end()); ++i) {
+        ++first;
+    }
+
+    Key key(option_space, std::vector<const CfgOption*>());
+    Entry entry;
+    for (CfgOptionList::const_iterator copts = first; copts != co_list.end();
+         ++copts) {
+        key.second.push_back(copts->get());
+        entry.cfg_options_.push_back(*copts);
+        entry.generations_.push_back((*copts)->getGeneration());
+    }
+
+    // The configurations of the key may have been freed and others
+    // allocated at the same addresses since the entry was built.
+    std::map<Key, Entry>::iterator it = cache_.find(key);
+    if ((it != cache_.end()) && !it->second.expired() &&
+        (it->second.generations_ == entry.generations_)) {
+        entry.flat_ = it->second.flat_;
+
+    } else {
+        entry.flat_.reset(new CfgOptionFlat(option_space, first,
+                                            co_list.end()));
+        if (it != cache_.end()) {
+            // Stale entry.
+            it->second = entry;
+
+        } else if (max_entries_ > 0) {
+            if (cache_.size() >= max_entries_) {
+                purge();
+            }
+            if (cache_.size() >= max_entries_) {
+                cache_.clear();
+            }
+            cache_.insert(std::make_pair(key, entry));
+        }
+    }
+
+    if (first == co_list.begin()) {
+        return (entry.flat_);
+    }
+
+    // Lay the client specific configurations over the cached view.
+    return (ConstCfgOptionFlatPtr(new CfgOptionFlat(option_space,
+                                                    co_list.begin(), first,
+                                                    entry.flat_)));
+}
+
+void
+CfgOptionFlatCache::purge() {
+    for (std::map<Key, Entry>::iterator it = cache_.begin();
+         it != cache_.end(); ) {
+        if (it->second.expired()) {
+            cache_.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+}
+}
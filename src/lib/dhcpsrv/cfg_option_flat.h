@@ -0,0 +1,196 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CFG_OPTION_FLAT_H
+#define CFG_OPTION_FLAT_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+class CfgOptionFlat;
+
+/// @brief Pointer to a const @c CfgOptionFlat.
+typedef boost::shared_ptr<const CfgOptionFlat> ConstCfgOptionFlatPtr;
+
+/// @brief Flattened view of the options of a list of option configurations.
+///
+/// The server looks for the options to send to a client in an ordered
+/// list of option configurations (host, pool, subnet, shared network,
+/// classes and global), the first configuration holding an option with
+/// the requested code taking precedence. This class resolves such a list
+/// once for a given option space: the options are then held in a vector
+/// sorted by code, so the option with a given code is found by a binary
+/// search, and the codes of the persistent options are available as a
+/// prebuilt list. The size of the view depends on the number of
+/// configured options, not on the highest option code.
+///
+/// The resolution is the same as walking the list and calling
+/// @c CfgOption::get for each configuration.
+class CfgOptionFlat {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param option_space option space to resolve, e.g. "dhcp4".
+    /// @param begin iterator to the first option configuration, i.e. the
+    /// one with the highest precedence.
+    /// @param end iterator past the last option configuration.
+    /// @param base optional view of the option configurations following
+    /// the list. Its options have the lowest precedence.
+    CfgOptionFlat(const std::string& option_space,
+                  CfgOptionList::const_iterator begin,
+                  CfgOptionList::const_iterator end,
+                  const ConstCfgOptionFlatPtr& base = ConstCfgOptionFlatPtr());
+
+    /// @brief Returns the option with the given code.
+    ///
+    /// @param option_code code of the option.
+    /// @return the option taking precedence or null if there is none.
+    OptionPtr get(const uint16_t option_code) const;
+
+    /// @brief Returns the codes of the persistent options.
+    ///
+    /// The codes are in configuration order, one per persistent option
+    /// in each configuration, so a code may appear more than once.
+    const std::vector<uint16_t>& getPersistent() const {
+        return (persistent_);
+    }
+
+    /// @brief Returns the option space.
+    const std::string& getOptionSpace() const {
+        return (option_space_);
+    }
+
+    /// @brief Checks if there is no option.
+    bool empty() const {
+        return (options_.empty());
+    }
+
+    /// @brief Returns the number of options.
+    size_t size() const {
+        return (options_.size());
+    }
+
+private:
+
+    /// @brief Type of an option with its code.
+    typedef std::pair<uint16_t, OptionPtr> CodedOption;
+
+    /// @brief Option space.
+    std::string option_space_;
+
+    /// @brief Options sorted by code.
+    std::vector<CodedOption> options_;
+
+    /// @brief Codes of the persistent options.
+    std::vector<uint16_t> persistent_;
+};
+
+/// @brief Cache of flattened option configuration lists.
+///
+/// The lists built for the clients of a given pool, subnet and set of
+/// classes are the same so the flattened views are cached. The cache is
+/// held by the server configuration and is cleared when the configuration
+/// stops being the current one.
+///
+/// The entries are keyed by the option space and the addresses of the
+/// option configurations of the list. An entry holds weak pointers to
+/// these configurations, so it doesn't keep them alive, and records their
+/// generations: it is rebuilt when one of them has been freed or modified.
+///
+/// The options of a host reservation are specific to a client and, when
+/// the reservations are held in a database, fetched for each packet. The
+/// caller excludes them from caching: the configurations at the head of
+/// the list which are specific to the client are laid over the cached
+/// view of the rest of the list. The cache therefore only grows with the
+/// number of distinct pool, subnet, shared network and class combinations.
+/// When it reaches its maximum size, the entries referring to freed
+/// configurations are removed, and if none are, the cache is cleared.
+class CfgOptionFlatCache {
+public:
+
+    /// @brief Default maximum number of entries.
+    static const size_t MAX_ENTRIES_DEFAULT = 1024;
+
+    /// @brief Constructor.
+    ///
+    /// @param max_entries maximum number of entries.
+    explicit CfgOptionFlatCache(const size_t max_entries = MAX_ENTRIES_DEFAULT);
+
+    /// @brief Returns the flattened view of a list, building it if needed.
+    ///
+    /// @param option_space option space to resolve.
+    /// @param co_list list of option configurations.
+    /// @param uncached number of configurations at the head of the list
+    /// which are specific to the client, e.g. the options of its host
+    /// reservation. They are not cached.
+    /// @return the flattened view.
+    ConstCfgOptionFlatPtr get(const std::string& option_space,
+                              const CfgOptionList& co_list,
+                              const size_t uncached = 0);
+
+    /// @brief Removes all entries.
+    void clear() {
+        cache_.clear();
+    }
+
+    /// @brief Returns the number of entries.
+    size_t size() const {
+        return (cache_.size());
+    }
+
+    /// @brief Returns the maximum number of entries.
+    size_t getMaxEntries() const {
+        return (max_entries_);
+    }
+
+private:
+
+    /// @brief Type of the cache key.
+    typedef std::pair<std::string, std::vector<const CfgOption*> > Key;
+
+    /// @brief A cache entry.
+    struct Entry {
+        /// @brief The option configurations of the list.
+        std::vector<boost::weak_ptr<const CfgOption> > cfg_options_;
+
+        /// @brief The generations of the option configurations.
+        std::vector<uint64_t> generations_;
+
+        /// @brief The flattened view.
+        ConstCfgOptionFlatPtr flat_;
+
+        /// @brief Checks if an option configuration has been freed.
+        bool expired() const;
+    };
+
+    /// @brief Removes the entries referring to freed configurations.
+    void purge();
+
+    /// @brief Maximum number of entries.
+    size_t max_entries_;
+
+    /// @brief The entries.
+    std::map<Key, Entry> cache_;
+};
+
+/// @brief Pointer to a @c CfgOptionFlatCache.
+typedef boost::shared_ptr<CfgOptionFlatCache> CfgOptionFlatCachePtr;
+
+}
+}
+
+#endif // CFG_OPTION_FLAT_H
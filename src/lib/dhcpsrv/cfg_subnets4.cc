@@ -424,25 +424,31 @@ CfgSubnets4::removeStatistics() {
     using namespace isc::stats;
 
     // For each v4 subnet currently configured, remove the statistic.
-    StatsMgr& stats_mgr = StatsMgr::instance();
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
+        removeSubnetStatistics((*subnet4)->getID());
+    }
+}
+
+void
+CfgSubnets4::removeSubnetStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
@@ -467,6 +473,52 @@ CfgSubnets4::updateStatistics() {
     }
 }
 
+void
+CfgSubnets4::updateStatistics(const CfgSubnets4& previous) {
+    using namespace isc::stats;
+
+    // The lease statistics of the subnets which haven't changed are kept,
+    // the other subnets are recounted.
+    SubnetIDSet retained;
+    SubnetIDSet recounted;
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        SubnetID subnet_id = (*subnet4)->getID();
+        ConstSubnet4Ptr previous_subnet = previous.getBySubnetId(subnet_id);
+        if (previous_subnet && (*subnet4)->hasSamePools(*previous_subnet)) {
+            retained.insert(subnet_id);
+        } else {
+            recounted.insert(subnet_id);
+        }
+    }
+
+    // Remove the statistics of the previous subnets which are gone or
+    // have changed.
+    for (Subnet4Collection::const_iterator subnet4 = previous.subnets_.begin();
+         subnet4 != previous.subnets_.end(); ++subnet4) {
+        if (retained.count((*subnet4)->getID()) == 0) {
+            removeSubnetStatistics((*subnet4)->getID());
+        }
+    }
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        SubnetID subnet_id = (*subnet4)->getID();
+
+        stats_mgr.setValue(StatsMgr::
+                           generateName("subnet", subnet_id, "total-addresses"),
+                                        static_cast<int64_t>
+                                        ((*subnet4)->getPoolCapacity(Lease::
+                                                                     TYPE_V4)));
+    }
+
+    // Only recount the stats if we have subnets.
+    if (subnets_.begin() != subnets_.end()) {
+        LeaseMgrFactory::instance().recountLeaseStats4(recounted);
+    }
+}
+
 ElementPtr
 CfgSubnets4::toElement() const {
     ElementPtr result = Element::createList();
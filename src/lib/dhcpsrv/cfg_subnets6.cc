@@ -327,30 +327,36 @@ void
 CfgSubnets6::removeStatistics() {
     using namespace isc::stats;
 
-    StatsMgr& stats_mgr = StatsMgr::instance();
     // For each v6 subnet currently configured, remove the statistics.
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
+        removeSubnetStatistics((*subnet6)->getID());
+    }
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+void
+CfgSubnets6::removeSubnetStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
@@ -380,6 +386,56 @@ CfgSubnets6::updateStatistics() {
     }
 }
 
+void
+CfgSubnets6::updateStatistics(const CfgSubnets6& previous) {
+    using namespace isc::stats;
+
+    // The lease statistics of the subnets which haven't changed are kept,
+    // the other subnets are recounted.
+    SubnetIDSet retained;
+    SubnetIDSet recounted;
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        SubnetID subnet_id = (*subnet6)->getID();
+        ConstSubnet6Ptr previous_subnet = previous.getBySubnetId(subnet_id);
+        if (previous_subnet && (*subnet6)->hasSamePools(*previous_subnet)) {
+            retained.insert(subnet_id);
+        } else {
+            recounted.insert(subnet_id);
+        }
+    }
+
+    // Remove the statistics of the previous subnets which are gone or
+    // have changed.
+    for (Subnet6Collection::const_iterator subnet6 = previous.subnets_.begin();
+         subnet6 != previous.subnets_.end(); ++subnet6) {
+        if (retained.count((*subnet6)->getID()) == 0) {
+            removeSubnetStatistics((*subnet6)->getID());
+        }
+    }
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        SubnetID subnet_id = (*subnet6)->getID();
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "total-nas"),
+                           static_cast<int64_t>
+                           ((*subnet6)->getPoolCapacity(Lease::TYPE_NA)));
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "total-pds"),
+                            static_cast<int64_t>
+                            ((*subnet6)->getPoolCapacity(Lease::TYPE_PD)));
+    }
+
+    // Only recount the stats if we have subnets.
+    if (subnets_.begin() != subnets_.end()) {
+        LeaseMgrFactory::instance().recountLeaseStats6(recounted);
+    }
+}
+
 ElementPtr
 CfgSubnets6::toElement() const {
     ElementPtr result = Element::createList();
@@ -246,6 +246,20 @@ public:
     /// they are not expected to change until the next reconfiguration event.
     void updateStatistics();
 
+    /// @brief Updates statistics after reconfiguration.
+    ///
+    /// This method is used instead of @ref removeStatistics called for the
+    /// previous configuration followed by @ref updateStatistics when the
+    /// lease database hasn't changed across the reconfiguration. The lease
+    /// statistics of the subnets which have the same identifier, prefix and
+    /// pools as in the previous configuration are still valid, so only
+    /// the remaining subnets are recounted from the lease database. The
+    /// statistics of the previous subnets which are not in this
+    /// configuration are removed.
+    ///
+    /// @param previous Previous subnets configuration.
+    void updateStatistics(const CfgSubnets6& previous);
+
     /// @brief Removes statistics.
     ///
     /// During commitment of a new configuration, we need to get rid of the old
@@ -261,6 +275,11 @@ public:
 
 private:
 
+    /// @brief Removes statistics of a subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    static void removeSubnetStatistics(const SubnetID& subnet_id);
+
     /// @brief Selects a subnet using the interface name.
     ///
     /// This method searches for the subnet using the name of the interface.
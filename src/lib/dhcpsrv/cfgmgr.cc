@@ -91,10 +91,10 @@ CfgMgr::commit() {
 
     ensureCurrentAllocated();
 
-    // First we need to remove statistics. The new configuration can have fewer
-    // subnets. Also, it may change subnet-ids. So we need to remove them all
-    // and add it back.
-    configuration_->removeStatistics();
+    // The new configuration can have fewer subnets and it may change
+    // subnet-ids, so the statistics are updated against the previous
+    // configuration once the new one is in place.
+    SrvConfigPtr previous = configuration_;
 
     if (!configs_.back()->sequenceEquals(*configuration_)) {
         configuration_ = configs_.back();
@@ -108,7 +108,13 @@ CfgMgr::commit() {
     }
 
     // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    configuration_->updateStatistics(*previous);
+
+    // The flattened option lists of the previous configuration are no
+    // longer used. Release the options they hold.
+    if (previous != configuration_) {
+        previous->getCfgOptionFlatCache()->clear();
+    }
 }
 
 void
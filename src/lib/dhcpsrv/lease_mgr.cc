@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,6 +21,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <time.h>
 
@@ -125,6 +126,92 @@ LeaseMgr::recountLeaseStats4() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats4(const SubnetIDSet& subnet_ids) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    const Subnet4Collection* subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
+
+    // A single query is cheaper than a query per subnet.
+    if (subnet_ids.size() >= subnets->size()) {
+        recountLeaseStats4();
+        return;
+    }
+
+    // Run the queries before any statistics is modified, so as all subnets
+    // are recounted if the backend doesn't support them.
+    std::vector<LeaseStatsQueryPtr> queries;
+    for (SubnetIDSet::const_iterator subnet_id = subnet_ids.begin();
+         subnet_id != subnet_ids.end(); ++subnet_id) {
+        LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery4(*subnet_id);
+        if (!query) {
+            recountLeaseStats4();
+            return;
+        }
+        queries.push_back(query);
+    }
+
+    // Zero out the global stats. The declined addresses are set below.
+    int64_t zero = 0;
+    stats_mgr.setValue("reclaimed-declined-addresses", zero);
+    stats_mgr.setValue("reclaimed-leases", zero);
+
+    // Clear subnet level stats of the subnets being recounted, and the
+    // reclaimed stats of all subnets.
+    for (Subnet4Collection::const_iterator subnet = subnets->begin();
+         subnet != subnets->end(); ++subnet) {
+        SubnetID subnet_id = (*subnet)->getID();
+        if (subnet_ids.count(subnet_id) > 0) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-addresses"),
+                               zero);
+
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "declined-addresses"),
+                               zero);
+        }
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-leases"),
+                           zero);
+    }
+
+    // Get counts per state for each subnet being recounted.
+    LeaseStatsRow row;
+    for (auto query = queries.begin(); query != queries.end(); ++query) {
+        while ((*query)->getNextRow(row)) {
+            if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                          "assigned-addresses"),
+                                   row.state_count_);
+            } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+                stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                          "declined-addresses"),
+                                   row.state_count_);
+            }
+        }
+    }
+
+    // The global value is the sum of the subnet values.
+    int64_t declined = 0;
+    for (Subnet4Collection::const_iterator subnet = subnets->begin();
+         subnet != subnets->end(); ++subnet) {
+        ObservationPtr stat = stats_mgr.getObservation(StatsMgr::
+            generateName("subnet", (*subnet)->getID(), "declined-addresses"));
+        if (stat) {
+            declined += stat->getInteger().first;
+        }
+    }
+    stats_mgr.setValue("declined-addresses", declined);
+}
+
 LeaseStatsQuery::LeaseStatsQuery()
     : first_subnet_id_(0), last_subnet_id_(0), select_mode_(ALL_SUBNETS) {
 }
@@ -270,6 +357,116 @@ LeaseMgr::recountLeaseStats6() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats6(const SubnetIDSet& subnet_ids) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    const Subnet6Collection* subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets6()->getAll();
+
+    // A single query is cheaper than a query per subnet.
+    if (subnet_ids.size() >= subnets->size()) {
+        recountLeaseStats6();
+        return;
+    }
+
+    // Run the queries before any statistics is modified, so as all subnets
+    // are recounted if the backend doesn't support them.
+    std::vector<LeaseStatsQueryPtr> queries;
+    for (SubnetIDSet::const_iterator subnet_id = subnet_ids.begin();
+         subnet_id != subnet_ids.end(); ++subnet_id) {
+        LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery6(*subnet_id);
+        if (!query) {
+            recountLeaseStats6();
+            return;
+        }
+        queries.push_back(query);
+    }
+
+    // Zero out the global stats. The declined addresses are set below.
+    int64_t zero = 0;
+    stats_mgr.setValue("reclaimed-declined-addresses", zero);
+    stats_mgr.setValue("reclaimed-leases", zero);
+
+    // Clear subnet level stats of the subnets being recounted, and the
+    // reclaimed stats of all subnets.
+    for (Subnet6Collection::const_iterator subnet = subnets->begin();
+         subnet != subnets->end(); ++subnet) {
+        SubnetID subnet_id = (*subnet)->getID();
+        if (subnet_ids.count(subnet_id) > 0) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-nas"),
+                               zero);
+
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "declined-addresses"),
+                               zero);
+
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-pds"),
+                               zero);
+        }
+
+        stats_mgr.setValue(StatsMgr::
+                           generateName("subnet", subnet_id,
+                                        "reclaimed-declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "reclaimed-leases"),
+                           zero);
+    }
+
+    // Get counts per state for each subnet being recounted.
+    LeaseStatsRow row;
+    for (auto query = queries.begin(); query != queries.end(); ++query) {
+        while ((*query)->getNextRow(row)) {
+            switch(row.lease_type_) {
+                case Lease::TYPE_NA:
+                    if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                        stats_mgr.setValue(StatsMgr::
+                                           generateName("subnet", row.subnet_id_,
+                                                        "assigned-nas"),
+                                           row.state_count_);
+                    } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+                        stats_mgr.setValue(StatsMgr::
+                                           generateName("subnet", row.subnet_id_,
+                                                        "declined-addresses"),
+                                           row.state_count_);
+                    }
+                    break;
+
+                case Lease::TYPE_PD:
+                    if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                        stats_mgr.setValue(StatsMgr::
+                                           generateName("subnet", row.subnet_id_,
+                                                        "assigned-pds"),
+                                           row.state_count_);
+                    }
+                    break;
+
+                default:
+                    // We dont' support TYPE_TAs yet
+                    break;
+            }
+        }
+    }
+
+    // The global value is the sum of the subnet values.
+    int64_t declined = 0;
+    for (Subnet6Collection::const_iterator subnet = subnets->begin();
+         subnet != subnets->end(); ++subnet) {
+        ObservationPtr stat = stats_mgr.getObservation(StatsMgr::
+            generateName("subnet", (*subnet)->getID(), "declined-addresses"));
+        if (stat) {
+            declined += stat->getInteger().first;
+        }
+    }
+    stats_mgr.setValue("declined-addresses", declined);
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -579,6 +579,21 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates per-subnet and global stats for IPv4 leases
+    /// of the specified subnets
+    ///
+    /// This is used after a reconfiguration, when the statistics of the
+    /// subnets which haven't changed are up to date. The assigned and
+    /// declined addresses are only counted for the specified subnets, using
+    /// startSubnetLeaseStatsQuery4(), and the global declined addresses are
+    /// set to the sum of the per-subnet values. The reclaimed statistics
+    /// are reset to zero for all subnets. All subnets are recounted if
+    /// the backend doesn't support the queries for a single subnet or if
+    /// all configured subnets are specified.
+    ///
+    /// @param subnet_ids identifiers of the subnets to recount
+    void recountLeaseStats4(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv4 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -636,6 +651,16 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates per-subnet and global stats for IPv6 leases
+    /// of the specified subnets
+    ///
+    /// This is the IPv6 version of @ref recountLeaseStats4(const SubnetIDSet&).
+    /// The assigned NAs, assigned PDs and declined addresses are only
+    /// counted for the specified subnets.
+    ///
+    /// @param subnet_ids identifiers of the subnets to recount
+    void recountLeaseStats6(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -697,6 +722,17 @@ public:
     /// @return Type of the backend.
     virtual std::string getType() const = 0;
 
+    /// @brief Checks if the leases outlive the lease manager
+    ///
+    /// The servers re-create the lease manager on every reconfiguration.
+    /// The lease statistics are only kept across the reconfiguration if
+    /// the new lease manager holds the same leases as the previous one.
+    ///
+    /// @return true, unless the derivation holds the leases in memory only
+    virtual bool isPersistent() const {
+        return (true);
+    }
+
     /// @brief Returns backend name.
     ///
     /// If the backend is a database, this is the name of the database or the
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,8 @@
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
@@ -42,10 +44,170 @@ const char* KEA_LFC_EXECUTABLE_ENV_NAME = "KEA_LFC_EXECUTABLE";
 using namespace isc::asiolink;
 using namespace isc::db;
 using namespace isc::util;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace dhcp {
 
+namespace {
+
+/// @brief Writes a snapshot of leases as the new previous lease file.
+///
+/// This function performs the work of the @c kea-lfc program without
+/// reading the lease files: the snapshot already holds the result of
+/// merging the previous lease file and the lease file copy. The leases
+/// are written to the output file which is then moved to the finish file.
+/// Finally, the previous lease file and the lease file copy are removed
+/// and the finish file becomes the new previous lease file.
+///
+/// @param lease_file_name Name of the current lease file.
+/// @param leases Pointer to the snapshot of leases to be written.
+///
+/// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+/// @tparam CollectionType A @c Lease4Collection or @c Lease6Collection.
+///
+/// @throw Unexpected if any of the file operations fails.
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename CollectionType>
+void
+compactLeaseFile(const std::string& lease_file_name,
+                 const boost::shared_ptr<CollectionType>& leases) {
+    std::string output = Memfile_LeaseMgr::appendSuffix(lease_file_name,
+                                                        Memfile_LeaseMgr::FILE_OUTPUT);
+    std::string finish = Memfile_LeaseMgr::appendSuffix(lease_file_name,
+                                                        Memfile_LeaseMgr::FILE_FINISH);
+    std::string previous = Memfile_LeaseMgr::appendSuffix(lease_file_name,
+                                                          Memfile_LeaseMgr::FILE_PREVIOUS);
+    std::string copy = Memfile_LeaseMgr::appendSuffix(lease_file_name,
+                                                      Memfile_LeaseMgr::FILE_INPUT);
+
+    LeaseFileType lf_output(output);
+    LeaseFileLoader::write<LeaseObjectType>(lf_output, *leases);
+
+    if (rename(output.c_str(), finish.c_str()) != 0) {
+        isc_throw(Unexpected, "unable to move output (" << output
+                  << ") to complete (" << finish << ") error: "
+                  << strerror(errno));
+    }
+
+    if ((remove(previous.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(Unexpected, "unable to delete previous file '"
+                  << previous << "' error: " << strerror(errno));
+    }
+
+    if ((remove(copy.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(Unexpected, "unable to delete copy file '"
+                  << copy << "' error: " << strerror(errno));
+    }
+
+    if (rename(finish.c_str(), previous.c_str()) != 0) {
+        isc_throw(Unexpected, "unable to move finish (" << finish
+                  << ") to previous (" << previous << ") error: "
+                  << strerror(errno));
+    }
+}
+
+/// @brief Returns the type of an IPv4 lease.
+Lease::Type
+getLeaseType(const Lease4&) {
+    return (Lease::TYPE_V4);
+}
+
+/// @brief Returns the type of an IPv6 lease.
+///
+/// @param lease IPv6 lease.
+Lease::Type
+getLeaseType(const Lease6& lease) {
+    return (lease.type_);
+}
+
+/// @brief Adjusts the counts of the leases of the subnet of a lease.
+///
+/// Only the assigned and declined leases are counted.
+///
+/// @param counts Per subnet lease counts.
+/// @param lease Lease added (delta 1) to or removed (delta -1) from the
+/// storage.
+/// @param delta Value added to the count of the lease's kind.
+/// @tparam LeaseType @c Lease4 or @c Lease6.
+template<typename LeaseType>
+void
+countLease(SubnetLeaseCountsMap& counts, const LeaseType& lease,
+           const int64_t delta) {
+    const Lease::Type type = getLeaseType(lease);
+    int64_t SubnetLeaseCounts::* count = 0;
+    if (lease.state_ == Lease::STATE_DEFAULT) {
+        if ((type == Lease::TYPE_V4) || (type == Lease::TYPE_NA)) {
+            count = &SubnetLeaseCounts::assigned_;
+        } else if (type == Lease::TYPE_PD) {
+            count = &SubnetLeaseCounts::assigned_pds_;
+        }
+    } else if (lease.state_ == Lease::STATE_DECLINED) {
+        // In theory only addresses can be declined.
+        if ((type == Lease::TYPE_V4) || (type == Lease::TYPE_NA)) {
+            count = &SubnetLeaseCounts::declined_;
+        }
+    }
+
+    if (!count) {
+        return;
+    }
+
+    // Drop the subnets which no longer have any leases counted, so as the
+    // statistics queries don't return empty rows.
+    SubnetLeaseCountsMap::iterator subnet =
+        counts.insert(std::make_pair(lease.subnet_id_,
+                                     SubnetLeaseCounts())).first;
+    subnet->second.*count += delta;
+    if ((subnet->second.assigned_ == 0) && (subnet->second.declined_ == 0) &&
+        (subnet->second.assigned_pds_ == 0)) {
+        counts.erase(subnet);
+    }
+}
+
+/// @brief Counts all leases in the storage.
+///
+/// This is used after the leases have been loaded from the lease files.
+/// Afterwards, the counts are adjusted as the leases are modified.
+///
+/// @param storage Lease storage.
+/// @param [out] counts Per subnet lease counts.
+/// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+template<typename StorageType>
+void
+countLeases(const StorageType& storage, SubnetLeaseCountsMap& counts) {
+    counts.clear();
+    for (auto lease = storage.begin(); lease != storage.end(); ++lease) {
+        countLease(counts, **lease, 1);
+    }
+}
+
+/// @brief Returns the range of the lease counts selected by a query.
+///
+/// @param counts Per subnet lease counts.
+/// @param query Lease statistics query.
+///
+/// @return Pair of the iterators to the first and past the last counts.
+std::pair<SubnetLeaseCountsMap::const_iterator,
+          SubnetLeaseCountsMap::const_iterator>
+selectLeaseCounts(const SubnetLeaseCountsMap& counts,
+                  const LeaseStatsQuery& query) {
+    switch (query.getSelectMode()) {
+    case LeaseStatsQuery::SINGLE_SUBNET:
+        return (counts.equal_range(query.getFirstSubnetID()));
+
+    case LeaseStatsQuery::SUBNET_RANGE:
+        return (std::make_pair(counts.lower_bound(query.getFirstSubnetID()),
+                               counts.upper_bound(query.getLastSubnetID())));
+
+    default:
+        return (std::make_pair(counts.begin(), counts.end()));
+    }
+}
+
+} // end of anonymous namespace
+
 /// @brief Represents a configuration for Lease File Cleanup.
 ///
 /// This class is solely used by the @c Memfile_LeaseMgr as a configuration
@@ -56,6 +218,10 @@ namespace dhcp {
 /// and maintaining the object which is used to spawn the new process which
 /// executes the @c kea-lfc program.
 ///
+/// When the in-process cleanup is enabled, the cleanup is instead performed
+/// by a thread of the server process which writes a snapshot of the leases
+/// held in memory. This avoids re-reading and parsing the lease files.
+///
 /// This functionality is enclosed in a separate class so as the implementation
 /// details are not exposed in the @c Memfile_LeaseMgr header file and
 /// to maintain a single place with the LFC configuration, instead of multiple
@@ -88,14 +254,32 @@ public:
     /// @param run_once_now A flag that causes LFC to be invoked immediately,
     /// regardless of the value of lfc_interval.  This is primarily used to
     /// cause lease file schema upgrades upon startup.
+    /// @param in_process A flag indicating if the cleanup should be performed
+    /// by the server process rather than by the spawned @c kea-lfc.
     void setup(const uint32_t lfc_interval,
                const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-               bool run_once_now = false);
+               bool run_once_now = false,
+               bool in_process = false);
 
     /// @brief Spawns a new process.
     void execute();
 
+    /// @brief Runs the in-process cleanup in a background thread.
+    ///
+    /// If the previous in-process cleanup is still in progress, this
+    /// method does nothing.
+    ///
+    /// @param compaction Function writing the cleaned up lease file.
+    void executeInProcess(const boost::function<void()>& compaction);
+
+    /// @brief Checks if the cleanup is performed in-process.
+    ///
+    /// @return true if the cleanup is performed by the server process.
+    bool isInProcess() const {
+        return (in_process_);
+    }
+
     /// @brief Checks if the lease file cleanup is in progress.
     ///
     /// @return true if the lease file cleanup is being executed.
@@ -106,6 +290,16 @@ public:
 
 private:
 
+    /// @brief Thread function running the in-process cleanup.
+    ///
+    /// @param compaction Function writing the cleaned up lease file.
+    void runCompaction(const boost::function<void()>& compaction);
+
+    /// @brief Waits for the completed in-process cleanup thread.
+    ///
+    /// It logs an error if the cleanup has failed.
+    void reapCompaction();
+
     /// @brief A pointer to the @c ProcessSpawn object used to execute
     /// the LFC.
     boost::scoped_ptr<util::ProcessSpawn> process_;
@@ -116,6 +310,24 @@ private:
     /// @brief A PID of the last executed LFC process.
     pid_t pid_;
 
+    /// @brief Indicates if the cleanup is performed in-process.
+    bool in_process_;
+
+    /// @brief Thread performing the in-process cleanup.
+    boost::scoped_ptr<Thread> thread_;
+
+    /// @brief Mutex protecting the in-process cleanup state.
+    mutable Mutex mutex_;
+
+    /// @brief Indicates if the in-process cleanup is in progress.
+    bool running_;
+
+    /// @brief Exit status of the last in-process cleanup.
+    int exit_status_;
+
+    /// @brief Error message of the last failed in-process cleanup.
+    std::string error_;
+
     /// @brief Pointer to the timer manager.
     ///
     /// We have to hold this pointer here to make sure that the timer
@@ -124,11 +336,21 @@ private:
 };
 
 LFCSetup::LFCSetup(asiolink::IntervalTimer::Callback callback)
-    : process_(), callback_(callback), pid_(0),
-      timer_mgr_(TimerMgr::instance()) {
+    : process_(), callback_(callback), pid_(0), in_process_(false),
+      thread_(), mutex_(), running_(false), exit_status_(EXIT_SUCCESS),
+      error_(), timer_mgr_(TimerMgr::instance()) {
 }
 
 LFCSetup::~LFCSetup() {
+    try {
+        // Do not leave the cleanup thread behind while the lease files
+        // may be reopened by another instance of the backend.
+        reapCompaction();
+
+    } catch (...) {
+        // Nothing we can do here.
+    }
+
     try {
         // Remove the timer. This will throw an exception if the timer does not
         // exist.  There are several possible reasons for this:
@@ -155,58 +377,64 @@ void
 LFCSetup::setup(const uint32_t lfc_interval,
                 const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                 const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-                bool run_once_now) {
+                bool run_once_now,
+                bool in_process) {
 
     // If to nothing to do, punt
     if (lfc_interval == 0 && !run_once_now) {
         return;
     }
 
-    // Start preparing the command line for kea-lfc.
-    std::string executable;
-    char* c_executable = getenv(KEA_LFC_EXECUTABLE_ENV_NAME);
-    if (c_executable == NULL) {
-        executable = KEA_LFC_EXECUTABLE;
-    } else {
-        executable = c_executable;
-    }
-
-    // Gather the base file name.
-    std::string lease_file = lease_file4 ? lease_file4->getFilename() :
-                                           lease_file6->getFilename();
-
-    // Create the other names by appending suffixes to the base name.
-    util::ProcessArgs args;
-    // Universe: v4 or v6.
-    args.push_back(lease_file4 ? "-4" : "-6");
-
-    // Previous file.
-    args.push_back("-x");
-    args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
-                                                  Memfile_LeaseMgr::FILE_PREVIOUS));
-    // Input file.
-    args.push_back("-i");
-    args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
-                                                  Memfile_LeaseMgr::FILE_INPUT));
-    // Output file.
-    args.push_back("-o");
-    args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
-                                                  Memfile_LeaseMgr::FILE_OUTPUT));
-    // Finish file.
-    args.push_back("-f");
-    args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
-                                                  Memfile_LeaseMgr::FILE_FINISH));
-    // PID file.
-    args.push_back("-p");
-    args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
-                                                  Memfile_LeaseMgr::FILE_PID));
-
-    // The configuration file is currently unused.
-    args.push_back("-c");
-    args.push_back("ignored-path");
-
-    // Create the process (do not start it yet).
-    process_.reset(new util::ProcessSpawn(executable, args));
+    in_process_ = in_process;
+
+    // The in-process cleanup doesn't need the kea-lfc.
+    if (!in_process_) {
+        // Start preparing the command line for kea-lfc.
+        std::string executable;
+        char* c_executable = getenv(KEA_LFC_EXECUTABLE_ENV_NAME);
+        if (c_executable == NULL) {
+            executable = KEA_LFC_EXECUTABLE;
+        } else {
+            executable = c_executable;
+        }
+
+        // Gather the base file name.
+        std::string lease_file = lease_file4 ? lease_file4->getFilename() :
+                                               lease_file6->getFilename();
+
+        // Create the other names by appending suffixes to the base name.
+        util::ProcessArgs args;
+        // Universe: v4 or v6.
+        args.push_back(lease_file4 ? "-4" : "-6");
+
+        // Previous file.
+        args.push_back("-x");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_PREVIOUS));
+        // Input file.
+        args.push_back("-i");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_INPUT));
+        // Output file.
+        args.push_back("-o");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_OUTPUT));
+        // Finish file.
+        args.push_back("-f");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_FINISH));
+        // PID file.
+        args.push_back("-p");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_PID));
+
+        // The configuration file is currently unused.
+        args.push_back("-c");
+        args.push_back("ignored-path");
+
+        // Create the process (do not start it yet).
+        process_.reset(new util::ProcessSpawn(executable, args));
+    }
 
     // If we've been told to run it once now, invoke the callback directly.
     if (run_once_now) {
@@ -239,13 +467,74 @@ LFCSetup::execute() {
     }
 }
 
+void
+LFCSetup::executeInProcess(const boost::function<void()>& compaction) {
+    if (isRunning()) {
+        return;
+    }
+    reapCompaction();
+
+    Mutex::Locker lock(mutex_);
+    running_ = true;
+    try {
+        thread_.reset(new Thread(boost::bind(&LFCSetup::runCompaction,
+                                             this, compaction)));
+    } catch (const std::exception& ex) {
+        running_ = false;
+        exit_status_ = EXIT_FAILURE;
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL)
+            .arg(ex.what());
+    }
+}
+
+void
+LFCSetup::runCompaction(const boost::function<void()>& compaction) {
+    int exit_status = EXIT_SUCCESS;
+    std::string error;
+    try {
+        compaction();
+
+    } catch (const std::exception& ex) {
+        exit_status = EXIT_FAILURE;
+        error = ex.what();
+    }
+
+    Mutex::Locker lock(mutex_);
+    exit_status_ = exit_status;
+    error_ = error;
+    running_ = false;
+}
+
+void
+LFCSetup::reapCompaction() {
+    if (!thread_) {
+        return;
+    }
+    thread_->wait();
+    thread_.reset();
+
+    Mutex::Locker lock(mutex_);
+    if (exit_status_ != EXIT_SUCCESS) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL)
+            .arg(error_);
+    }
+}
+
 bool
 LFCSetup::isRunning() const {
+    if (in_process_) {
+        Mutex::Locker lock(mutex_);
+        return (running_);
+    }
     return (process_ && process_->isRunning(pid_));
 }
 
 int
 LFCSetup::getExitStatus() const {
+    if (in_process_) {
+        Mutex::Locker lock(mutex_);
+        return (exit_status_);
+    }
     if (!process_) {
         isc_throw(InvalidOperation, "unable to obtain LFC process exit code: "
                   " the process is NULL");
@@ -321,37 +610,39 @@ protected:
 /// @brief Memfile derivation of the IPv4 statistical lease data query
 ///
 /// This class is used to recalculate IPv4 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  It does so by copying the counts of leases in each of
+/// the monitored lease states, which are maintained by the lease manager
+/// as the leases are modified, for each selected subnet. The populated
+/// result set will contain one entry per monitored state per subnet.
 ///
 class MemfileLeaseStatsQuery4 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor for an all subnets query
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4)
-        : MemfileLeaseStatsQuery(), storage4_(storage4) {
+    /// @param counts4 The per subnet counts of the v4 leases
+    MemfileLeaseStatsQuery4(const SubnetLeaseCountsMap& counts4)
+        : MemfileLeaseStatsQuery(), counts4_(counts4) {
     };
 
     /// @brief Constructor for a single subnet query
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
+    /// @param counts4 The per subnet counts of the v4 leases
     /// @param subnet_id ID of the desired subnet
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4, const SubnetID& subnet_id)
-        : MemfileLeaseStatsQuery(subnet_id), storage4_(storage4) {
+    MemfileLeaseStatsQuery4(const SubnetLeaseCountsMap& counts4,
+                            const SubnetID& subnet_id)
+        : MemfileLeaseStatsQuery(subnet_id), counts4_(counts4) {
     };
 
     /// @brief Constructor for a subnet range query
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
+    /// @param counts4 The per subnet counts of the v4 leases
     /// @param first_subnet_id ID of the first subnet in the desired range
     /// @param last_subnet_id ID of the last subnet in the desired range
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4, const SubnetID& first_subnet_id,
+    MemfileLeaseStatsQuery4(const SubnetLeaseCountsMap& counts4,
+                            const SubnetID& first_subnet_id,
                             const SubnetID& last_subnet_id)
-        : MemfileLeaseStatsQuery(first_subnet_id, last_subnet_id), storage4_(storage4) {
+        : MemfileLeaseStatsQuery(first_subnet_id, last_subnet_id),
+          counts4_(counts4) {
     };
 
     /// @brief Destructor
@@ -359,12 +650,10 @@ public:
 
     /// @brief Creates the IPv4 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv4 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet.
-    /// At the completion of all entries for a given subnet, the counts are
-    /// used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
+    /// The result set is populated from the lease counts of the selected
+    /// subnets, in ascending order by subnet id, so the cost depends on
+    /// the number of the selected subnets rather than the number of
+    /// leases. The process results in a vector containing one entry
     /// per state per subnet.
     ///
     /// Currently the states counted are:
@@ -372,128 +661,68 @@ public:
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     void start() {
-        const Lease4StorageSubnetIdIndex& idx
-            = storage4_.get<SubnetIdIndexTag>();
-
-        // Set lower and upper bounds based on select mode
-        Lease4StorageSubnetIdIndex::const_iterator lower;
-        Lease4StorageSubnetIdIndex::const_iterator upper;
-        switch (getSelectMode()) {
-        case ALL_SUBNETS:
-            lower = idx.begin();
-            upper = idx.end();
-            break;
-
-        case SINGLE_SUBNET:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getFirstSubnetID());
-            break;
-
-        case SUBNET_RANGE:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getLastSubnetID());
-            break;
-        }
-
-        // Return an empty set if there are no rows.
-        if (lower == upper) {
-            return;
-        }
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        for(Lease4StorageSubnetIdIndex::const_iterator lease = lower;
-            lease != upper; ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    if (assigned > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id,
-                                                      Lease::STATE_DEFAULT,
-                                                      assigned));
-                        assigned = 0;
-                    }
-
-                    if (declined > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id,
-                                                      Lease::STATE_DECLINED,
-                                                      declined));
-                        declined = 0;
-                    }
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
+        auto range = selectLeaseCounts(counts4_, *this);
+        for (auto subnet = range.first; subnet != range.second; ++subnet) {
+            if (subnet->second.assigned_ > 0) {
+                rows_.push_back(LeaseStatsRow(subnet->first,
+                                              Lease::STATE_DEFAULT,
+                                              subnet->second.assigned_));
             }
 
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                ++assigned;
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                ++declined;
+            if (subnet->second.declined_ > 0) {
+                rows_.push_back(LeaseStatsRow(subnet->first,
+                                              Lease::STATE_DECLINED,
+                                              subnet->second.declined_));
             }
         }
 
-        // Make the rows for last subnet
-        if (assigned > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                          assigned));
-        }
-
-        if (declined > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                          declined));
-        }
-
         // Reset the next row position back to the beginning of the rows.
         next_pos_ = rows_.begin();
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv4 leases to analyze
-    Lease4Storage& storage4_;
+    /// @brief The per subnet counts of the v4 leases
+    const SubnetLeaseCountsMap& counts4_;
 };
 
 
 /// @brief Memfile derivation of the IPv6 statistical lease data query
 ///
 /// This class is used to recalculate IPv6 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
+/// lease storage.  It does so by copying the counts of leases in each of
+/// the monitored lease states, which are maintained by the lease manager
+/// as the leases are modified, for each selected subnet. The populated
+/// result set will contain one entry per monitored state per lease type
 /// per subnet.
 ///
 class MemfileLeaseStatsQuery6 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6)
-        : MemfileLeaseStatsQuery(), storage6_(storage6) {
+    /// @param counts6 The per subnet counts of the v6 leases
+    MemfileLeaseStatsQuery6(const SubnetLeaseCountsMap& counts6)
+        : MemfileLeaseStatsQuery(), counts6_(counts6) {
     };
 
     /// @brief Constructor for a single subnet query
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
+    /// @param counts6 The per subnet counts of the v6 leases
     /// @param subnet_id ID of the desired subnet
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6, const SubnetID& subnet_id)
-        : MemfileLeaseStatsQuery(subnet_id), storage6_(storage6) {
+    MemfileLeaseStatsQuery6(const SubnetLeaseCountsMap& counts6,
+                            const SubnetID& subnet_id)
+        : MemfileLeaseStatsQuery(subnet_id), counts6_(counts6) {
     };
 
     /// @brief Constructor for a subnet range query
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
+    /// @param counts6 The per subnet counts of the v6 leases
     /// @param first_subnet_id ID of the first subnet in the desired range
     /// @param last_subnet_id ID of the last subnet in the desired range
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6, const SubnetID& first_subnet_id,
+    MemfileLeaseStatsQuery6(const SubnetLeaseCountsMap& counts6,
+                            const SubnetID& first_subnet_id,
                             const SubnetID& last_subnet_id)
-        : MemfileLeaseStatsQuery(first_subnet_id, last_subnet_id), storage6_(storage6) {
+        : MemfileLeaseStatsQuery(first_subnet_id, last_subnet_id),
+          counts6_(counts6) {
     };
 
     /// @brief Destructor
@@ -501,120 +730,34 @@ public:
 
     /// @brief Creates the IPv6 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv6 leases in
-    /// storage, in ascending order by subnet id, accumulating the lease state
-    /// counts per subnet. At the completion of all entries for a given subnet,
-    /// the counts are used to create LeaseStatsRow instances which are appended
-    /// to an internal vector.  The process results in a vector containing one
-    /// entry per state per lease type per subnet.
+    /// The result set is populated from the lease counts of the selected
+    /// subnets, in ascending order by subnet id. The process results in
+    /// a vector containing one entry per state per lease type per subnet.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     virtual void start() {
-        // Get the subnet_id index
-        const Lease6StorageSubnetIdIndex& idx
-            = storage6_.get<SubnetIdIndexTag>();
-
-        // Set lower and upper bounds based on select mode
-        Lease6StorageSubnetIdIndex::const_iterator lower;
-        Lease6StorageSubnetIdIndex::const_iterator upper;
-        switch (getSelectMode()) {
-        case ALL_SUBNETS:
-            lower = idx.begin();
-            upper = idx.end();
-            break;
-
-        case SINGLE_SUBNET:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getFirstSubnetID());
-            break;
-
-        case SUBNET_RANGE:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getLastSubnetID());
-            break;
-        }
-
-        // Return an empty set if there are no rows.
-        if (lower == upper) {
-            return;
-        }
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        int64_t assigned_pds = 0;
-        for(Lease6StorageSubnetIdIndex::const_iterator lease = lower;
-            lease != upper; ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    if (assigned > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                      Lease::STATE_DEFAULT,
-                                                      assigned));
-                        assigned = 0;
-                    }
-
-                    if (declined > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                      Lease::STATE_DECLINED,
-                                                      declined));
-                        declined = 0;
-                    }
-
-                    if (assigned_pds > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                                      Lease::STATE_DEFAULT,
-                                                      assigned_pds));
-                        assigned_pds = 0;
-                    }
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
+        auto range = selectLeaseCounts(counts6_, *this);
+        for (auto subnet = range.first; subnet != range.second; ++subnet) {
+            if (subnet->second.assigned_ > 0) {
+                rows_.push_back(LeaseStatsRow(subnet->first, Lease::TYPE_NA,
+                                              Lease::STATE_DEFAULT,
+                                              subnet->second.assigned_));
             }
 
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                switch((*lease)->type_) {
-                case Lease::TYPE_NA:
-                    ++assigned;
-                    break;
-                case Lease::TYPE_PD:
-                    ++assigned_pds;
-                    break;
-                default:
-                    break;
-                }
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                // In theory only NAs can be declined
-                if (((*lease)->type_) == Lease::TYPE_NA) {
-                    ++declined;
-                }
+            if (subnet->second.declined_ > 0) {
+                rows_.push_back(LeaseStatsRow(subnet->first, Lease::TYPE_NA,
+                                              Lease::STATE_DECLINED,
+                                              subnet->second.declined_));
             }
-        }
-
-        // Make the rows for last subnet, unless there were no rows
-        if (assigned > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                          Lease::STATE_DEFAULT, assigned));
-        }
-
-        if (declined > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                          Lease::STATE_DECLINED, declined));
-        }
 
-        if (assigned_pds > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                          Lease::STATE_DEFAULT, assigned_pds));
+            if (subnet->second.assigned_pds_ > 0) {
+                rows_.push_back(LeaseStatsRow(subnet->first, Lease::TYPE_PD,
+                                              Lease::STATE_DEFAULT,
+                                              subnet->second.assigned_pds_));
+            }
         }
 
         // Set the next row position to the beginning of the rows.
@@ -622,8 +765,8 @@ public:
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv6 leases to analyze
-    Lease6Storage& storage6_;
+    /// @brief The per subnet counts of the v6 leases
+    const SubnetLeaseCountsMap& counts6_;
 };
 
 // Explicit definition of class static constants.  Values are given in the
@@ -646,6 +789,7 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                                 lease_file4_,
                                                                 storage4_);
         }
+        countLeases(storage4_, counts4_);
     } else {
         std::string file6 = initLeaseFilePath(V6);
         if (!file6.empty()) {
@@ -654,6 +798,7 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                                 lease_file6_,
                                                                 storage6_);
         }
+        countLeases(storage6_, counts6_);
     }
 
     // If lease persistence have been disabled for both v4 and v6,
@@ -708,7 +853,9 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
-    storage4_.insert(lease);
+    if (storage4_.insert(lease).second) {
+        countLease(counts4_, *lease, 1);
+    }
     return (true);
 }
 
@@ -729,7 +876,9 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
-    storage6_.insert(lease);
+    if (storage6_.insert(lease).second) {
+        countLease(counts6_, *lease, 1);
+    }
     return (true);
 }
 
@@ -1141,7 +1290,11 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    Lease4Ptr old_lease = *lease_it;
+    if (index.replace(lease_it, Lease4Ptr(new Lease4(*lease)))) {
+        countLease(counts4_, *old_lease, -1);
+        countLease(counts4_, *lease, 1);
+    }
 }
 
 void
@@ -1167,7 +1320,11 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    Lease6Ptr old_lease = *lease_it;
+    if (index.replace(lease_it, Lease6Ptr(new Lease6(*lease)))) {
+        countLease(counts6_, *old_lease, -1);
+        countLease(counts6_, *lease, 1);
+    }
 }
 
 bool
@@ -1190,6 +1347,7 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_copy.valid_lft_ = 0;
                 lease_file4_->append(lease_copy);
             }
+            countLease(counts4_, **l, -1);
             storage4_.erase(l);
             return (true);
         }
@@ -1211,6 +1369,7 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_file6_->append(lease_copy);
             }
 
+            countLease(counts6_, **l, -1);
             storage6_.erase(l);
             return (true);
         }
@@ -1292,7 +1451,8 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
             }
         }
 
-        // Erase leases from memory.
+        // Erase leases from memory. The reclaimed leases are not counted
+        // in the lease statistics, so the counts are not affected.
         index.erase(lower_limit, upper_limit);
     }
     // Return number of leases deleted.
@@ -1501,16 +1661,71 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
                   << lfc_interval_str << " specified");
     }
 
+    std::string lfc_in_process_str = "false";
+    try {
+        lfc_in_process_str = conn_.getParameter("lfc-in-process");
+    } catch (const std::exception&) {
+        // Ignore and default to false.
+    }
+
+    if ((lfc_in_process_str != "true") && (lfc_in_process_str != "false")) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-in-process "
+                  << lfc_in_process_str << " specified");
+    }
+
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(boost::bind(&Memfile_LeaseMgr::lfcCallback, this)));
-        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed);
+        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed,
+                          lfc_in_process_str == "true");
+    }
+}
+
+boost::function<void()>
+Memfile_LeaseMgr::lfcSnapshot(const boost::shared_ptr<CSVLeaseFile4>& lease_file) const {
+    // Leases held in the storage are updated in place, so the snapshot
+    // must consist of copies of the leases.
+    boost::shared_ptr<Lease4Collection> leases(new Lease4Collection());
+    leases->reserve(storage4_.size());
+    for (auto lease = storage4_.begin(); lease != storage4_.end(); ++lease) {
+        leases->push_back(Lease4Ptr(new Lease4(**lease)));
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE)
+        .arg(lease_file->getFilename())
+        .arg(leases->size());
+
+    return (boost::bind(&compactLeaseFile<Lease4, CSVLeaseFile4, Lease4Collection>,
+                        lease_file->getFilename(), leases));
+}
+
+boost::function<void()>
+Memfile_LeaseMgr::lfcSnapshot(const boost::shared_ptr<CSVLeaseFile6>& lease_file) const {
+    // Leases held in the storage are updated in place, so the snapshot
+    // must consist of copies of the leases.
+    boost::shared_ptr<Lease6Collection> leases(new Lease6Collection());
+    leases->reserve(storage6_.size());
+    for (auto lease = storage6_.begin(); lease != storage6_.end(); ++lease) {
+        leases->push_back(Lease6Ptr(new Lease6(**lease)));
     }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE)
+        .arg(lease_file->getFilename())
+        .arg(leases->size());
+
+    return (boost::bind(&compactLeaseFile<Lease6, CSVLeaseFile6, Lease6Collection>,
+                        lease_file->getFilename(), leases));
 }
 
 template<typename LeaseFileType>
 void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file) {
     bool do_lfc = true;
 
+    // The in-process cleanup removes the lease file copy when it is done,
+    // so don't rotate the files until it completes.
+    if (lfc_setup_->isInProcess() && lfc_setup_->isRunning()) {
+        return;
+    }
+
     // Check the status of the LFC instance.
     // If the finish file exists or the copy of the lease file exists it
     // is an indication that another LFC instance may be in progress or
@@ -1561,22 +1776,29 @@ void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file)
         }
     }
     // Once the files have been rotated, or untouched if another LFC had
-    // not finished, a new process is started.
+    // not finished, a new process is started. The in-process cleanup
+    // writes the leases held in memory, which at this point are equal
+    // to the contents of the previous lease file and the lease file copy.
     if (do_lfc) {
-        lfc_setup_->execute();
+        if (lfc_setup_->isInProcess()) {
+            lfc_setup_->executeInProcess(lfcSnapshot(lease_file));
+
+        } else {
+            lfc_setup_->execute();
+        }
     }
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(counts4_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_, subnet_id));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(counts4_, subnet_id));
     query->start();
     return(query);
 }
@@ -1584,7 +1806,7 @@ Memfile_LeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_, first_subnet_id,
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(counts4_, first_subnet_id,
                                                          last_subnet_id));
     query->start();
     return(query);
@@ -1592,14 +1814,14 @@ Memfile_LeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(counts6_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_, subnet_id));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(counts6_, subnet_id));
     query->start();
     return(query);
 }
@@ -1607,7 +1829,7 @@ Memfile_LeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_, first_subnet_id,
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(counts6_, first_subnet_id,
                                                          last_subnet_id));
     query->start();
     return(query);
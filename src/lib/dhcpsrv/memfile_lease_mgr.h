@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,7 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <util/process_spawn.h>
 
+#include <boost/function.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -74,6 +75,12 @@ class LFCSetup;
 /// is not specified, the default location in the installation
 /// directory is used: var/kea/kea-leases4.csv and
 /// var/kea/kea-leases6.csv.
+///
+/// The "lfc-in-process=true|false" parameter selects whether the
+/// Lease File Cleanup is performed by the server itself. The in-process
+/// cleanup writes the leases held in memory directly to the cleaned up
+/// lease file from a background thread, rather than spawning the
+/// @c kea-lfc which would read and parse the lease files again.
 class Memfile_LeaseMgr : public LeaseMgr {
 public:
 
@@ -484,6 +491,13 @@ public:
         return (std::string("memfile"));
     }
 
+    /// @brief Checks if the leases outlive the lease manager.
+    ///
+    /// @return true if the leases are written to a lease file.
+    virtual bool isPersistent() const {
+        return (persistLeases(V4) || persistLeases(V6));
+    }
+
     /// @brief Returns backend name.
     ///
     /// For now, memfile can only store data in memory.
@@ -681,6 +695,12 @@ private:
     /// @brief stores IPv6 leases
     Lease6Storage storage6_;
 
+    /// @brief Per subnet counts of the IPv4 leases
+    SubnetLeaseCountsMap counts4_;
+
+    /// @brief Per subnet counts of the IPv6 leases
+    SubnetLeaseCountsMap counts6_;
+
     /// @brief Holds the pointer to the DHCPv4 lease file IO.
     boost::shared_ptr<CSVLeaseFile4> lease_file4_;
 
@@ -829,6 +849,11 @@ private:
     /// any lease entries. If the file has been successfully moved, it runs
     /// the @c kea-lfc application.
     ///
+    /// If the @c lfc-in-process parameter is set to true, the method
+    /// doesn't run the @c kea-lfc application. Instead, it takes a snapshot
+    /// of the leases held in memory and writes it as the new Previous
+    /// %Lease File from a background thread.
+    ///
     /// @param lease_file A pointer to the object representing the Current
     /// %Lease File (DHCPv4 or DHCPv6 lease file).
     ///
@@ -836,6 +861,26 @@ private:
     template<typename LeaseFileType>
     void lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file);
 
+    /// @brief Creates a snapshot of the DHCPv4 leases for the in-process
+    /// %Lease File Cleanup.
+    ///
+    /// @param lease_file A pointer to the object representing the Current
+    /// %Lease File.
+    ///
+    /// @return Function writing the snapshot as the new Previous %Lease File.
+    boost::function<void()>
+    lfcSnapshot(const boost::shared_ptr<CSVLeaseFile4>& lease_file) const;
+
+    /// @brief Creates a snapshot of the DHCPv6 leases for the in-process
+    /// %Lease File Cleanup.
+    ///
+    /// @param lease_file A pointer to the object representing the Current
+    /// %Lease File.
+    ///
+    /// @return Function writing the snapshot as the new Previous %Lease File.
+    boost::function<void()>
+    lfcSnapshot(const boost::shared_ptr<CSVLeaseFile6>& lease_file) const;
+
     /// @brief A pointer to the Lease File Cleanup configuration.
     boost::scoped_ptr<LFCSetup> lfc_setup_;
 
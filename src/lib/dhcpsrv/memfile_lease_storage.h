@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,6 +18,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/composite_key.hpp>
 
+#include <map>
 #include <vector>
 
 namespace isc {
@@ -287,6 +288,31 @@ Lease4StorageClientIdHWAddressSubnetIdIndex;
 typedef Lease4Storage::index<SubnetIdIndexTag>::type Lease4StorageSubnetIdIndex;
 
 //@}
+
+/// @brief Numbers of the leases of a subnet reported by the lease statistics.
+///
+/// The Memfile backend keeps these counts up to date as the leases are
+/// added, updated and deleted, so the lease statistics queries don't have
+/// to iterate over the leases.
+struct SubnetLeaseCounts {
+    /// @brief Constructor.
+    SubnetLeaseCounts()
+        : assigned_(0), declined_(0), assigned_pds_(0) {
+    }
+
+    /// @brief Number of assigned IPv4 addresses or IPv6 non-temporary
+    /// addresses.
+    int64_t assigned_;
+
+    /// @brief Number of declined addresses.
+    int64_t declined_;
+
+    /// @brief Number of assigned IPv6 prefixes.
+    int64_t assigned_pds_;
+};
+
+/// @brief Lease counts indexed by the subnet identifier.
+typedef std::map<SubnetID, SubnetLeaseCounts> SubnetLeaseCountsMap;
 } // end of isc::dhcp namespace
 } // end of isc namespace
 
@@ -384,6 +384,11 @@ void OptionDataListParser::parse(const CfgOptionPtr& cfg,
     BOOST_FOREACH(ConstElementPtr data, option_data_list->listValue()) {
         std::pair<OptionDescriptor, std::string> option =
             option_parser.parse(data);
+        // Configured options are packed as is in every response so
+        // keep their wire format.
+        if (option.first.option_) {
+            option.first.option_->setWireCacheEnabled(true);
+        }
         // Use the option description to keep the formatted value
         cfg->add(option.first, option.second);
         cfg->encapsulate();
@@ -28,6 +28,7 @@ namespace dhcp {
 SrvConfig::SrvConfig()
     : sequence_(0), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_flat_cache_(new CfgOptionFlatCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -46,6 +47,7 @@ SrvConfig::SrvConfig()
 SrvConfig::SrvConfig(const uint32_t sequence)
     : sequence_(sequence), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_flat_cache_(new CfgOptionFlatCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -272,6 +274,30 @@ SrvConfig::updateStatistics() {
     }
 }
 
+void
+SrvConfig::updateStatistics(SrvConfig& previous) {
+    // The lease statistics can only be carried over when the leases are
+    // kept across the reconfiguration, i.e. the new lease manager uses
+    // the same lease database as the previous one and this database isn't
+    // lost when the previous lease manager is destroyed. They must also
+    // not have been changed behind the server's back: a SQL database may
+    // be shared with other servers or edited directly, so only the leases
+    // of the memfile backend are trusted.
+    if ((&previous == this) || !LeaseMgrFactory::haveInstance() ||
+        (LeaseMgrFactory::instance().getType() != "memfile") ||
+        !LeaseMgrFactory::instance().isPersistent() ||
+        (getCfgDbAccess()->getLeaseDbAccessString() !=
+         previous.getCfgDbAccess()->getLeaseDbAccessString())) {
+        previous.removeStatistics();
+        updateStatistics();
+        return;
+    }
+
+    getCfgSubnets4()->updateStatistics(*previous.getCfgSubnets4());
+
+    getCfgSubnets6()->updateStatistics(*previous.getCfgSubnets6());
+}
+
 void
 SrvConfig::clearConfiguredGlobals() {
     configured_globals_ = isc::data::Element::createMap();
@@ -16,6 +16,7 @@
 #include <dhcpsrv/cfg_iface.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfg_option_def.h>
+#include <dhcpsrv/cfg_option_flat.h>
 #include <dhcpsrv/cfg_rsoo.h>
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/cfg_subnets4.h>
@@ -181,6 +182,17 @@ public:
         return (cfg_option_);
     }
 
+    /// @brief Returns pointer to the cache of flattened option lists.
+    ///
+    /// The cache holds the flattened views of the option configuration
+    /// lists built for the clients and is used to find the options to
+    /// send to them.
+    ///
+    /// @return Pointer to the cache.
+    CfgOptionFlatCachePtr getCfgOptionFlatCache() const {
+        return (cfg_option_flat_cache_);
+    }
+
     /// @brief Returns pointer to non-const object holding subnets configuration
     /// for DHCPv4.
     ///
@@ -529,6 +541,20 @@ public:
     /// @ref CfgSubnets6::updateStatistics for details.
     void updateStatistics();
 
+    /// @brief Updates statistics after reconfiguration.
+    ///
+    /// When the memfile lease database is the same as in the previous
+    /// configuration and it outlives the lease manager instances, i.e. the
+    /// leases are written to a lease file, the lease statistics of
+    /// the subnets which haven't changed are kept and only the other subnets
+    /// are recounted. See @ref CfgSubnets4::updateStatistics(const CfgSubnets4&)
+    /// and @ref CfgSubnets6::updateStatistics(const CfgSubnets6&) for details.
+    /// Otherwise, the statistics of the previous configuration are removed
+    /// and all lease statistics are recounted.
+    ///
+    /// @param previous Previous configuration.
+    void updateStatistics(SrvConfig& previous);
+
     /// @brief Removes statistics.
     ///
     /// This method calls appropriate methods in child objects that remove
@@ -694,6 +720,9 @@ private:
     /// connected to any subnet.
     CfgOptionPtr cfg_option_;
 
+    /// @brief Pointer to the cache of flattened option lists.
+    CfgOptionFlatCachePtr cfg_option_flat_cache_;
+
     /// @brief Pointer to subnets configuration for IPv4.
     CfgSubnets4Ptr cfg_subnets4_;
 
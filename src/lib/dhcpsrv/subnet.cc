@@ -22,6 +22,25 @@ using namespace isc::util;
 
 namespace {
 
+/// @brief Checks if two collections hold the same pools in the same order.
+///
+/// @param pools1 First collection.
+/// @param pools2 Second collection.
+///
+/// @return true if the pools have the same text representations.
+bool
+samePools(const PoolCollection& pools1, const PoolCollection& pools2) {
+    if (pools1.size() != pools2.size()) {
+        return (false);
+    }
+    for (size_t i = 0; i < pools1.size(); ++i) {
+        if (pools1[i]->toText() != pools2[i]->toText()) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
 /// @brief Function used in calls to std::upper_bound to check
 /// if the specified prefix is lower than the first address a pool.
 ///
@@ -145,6 +164,14 @@ Subnet::toText() const {
     return (tmp.str());
 }
 
+bool
+Subnet::hasSamePools(const Subnet& other) const {
+    return ((toText() == other.toText()) &&
+            samePools(pools_, other.pools_) &&
+            samePools(pools_ta_, other.pools_ta_) &&
+            samePools(pools_pd_, other.pools_pd_));
+}
+
 uint64_t
 Subnet::getPoolCapacity(Lease::Type type) const {
     switch (type) {
@@ -217,6 +217,17 @@ public:
     /// @return textual representation
     virtual std::string toText() const;
 
+    /// @brief Checks if the subnet has the same prefix and pools as another
+    /// subnet.
+    ///
+    /// The lease statistics of a subnet which has the same identifier,
+    /// prefix and pools as in the previous configuration are kept across
+    /// the reconfiguration rather than recounted.
+    ///
+    /// @param other Subnet to compare with.
+    /// @return true if the prefixes and the pools of all types are equal.
+    bool hasSamePools(const Subnet& other) const;
+
     /// @brief Resets subnet-id counter to its initial value (1)
     ///
     /// This should be called during reconfiguration, before any new
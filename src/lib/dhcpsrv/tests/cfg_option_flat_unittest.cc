@@ -0,0 +1,287 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/cfg_option_flat.h>
+#include <boost/weak_ptr.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Creates an option with a given code and a one byte payload.
+///
+/// @param code option code.
+/// @param value payload value, used to tell options apart.
+OptionPtr
+createOption(const uint16_t code, const uint8_t value) {
+    OptionBuffer buf(1, value);
+    return (OptionPtr(new Option(Option::V6, code, buf)));
+}
+
+/// @brief Returns the payload value of an option.
+uint8_t
+valueOf(const OptionPtr& option) {
+    return (option->getData()[0]);
+}
+
+// This test verifies that the first configuration holding an option takes
+// precedence and that the persistent options are listed.
+TEST(CfgOptionFlatTest, precedence) {
+    CfgOptionPtr first(new CfgOption());
+    CfgOptionPtr second(new CfgOption());
+
+    ASSERT_NO_THROW(first->add(createOption(100, 1), false,
+                               DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(first->add(createOption(101, 1), true,
+                               DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(second->add(createOption(100, 2), false,
+                                DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(second->add(createOption(1000, 2), true,
+                                DHCP6_OPTION_SPACE));
+    // Options in other spaces are ignored.
+    ASSERT_NO_THROW(second->add(createOption(102, 2), true, "foo"));
+
+    CfgOptionList co_list;
+    co_list.push_back(first);
+    co_list.push_back(second);
+    CfgOptionFlat flat(DHCP6_OPTION_SPACE, co_list.begin(), co_list.end());
+
+    EXPECT_FALSE(flat.empty());
+    EXPECT_EQ(DHCP6_OPTION_SPACE, flat.getOptionSpace());
+    // One entry per option code, whatever the highest code.
+    EXPECT_EQ(3, flat.size());
+
+    ASSERT_TRUE(flat.get(100));
+    EXPECT_EQ(1, valueOf(flat.get(100)));
+    ASSERT_TRUE(flat.get(101));
+    EXPECT_EQ(1, valueOf(flat.get(101)));
+    ASSERT_TRUE(flat.get(1000));
+    EXPECT_EQ(2, valueOf(flat.get(1000)));
+    EXPECT_FALSE(flat.get(102));
+    EXPECT_FALSE(flat.get(999));
+    EXPECT_FALSE(flat.get(65535));
+
+    std::vector<uint16_t> persistent = flat.getPersistent();
+    ASSERT_EQ(2, persistent.size());
+    EXPECT_EQ(101, persistent[0]);
+    EXPECT_EQ(1000, persistent[1]);
+
+    // Resolution is the same as walking the list.
+    for (uint16_t code = 0; code < 1100; ++code) {
+        OptionPtr expected;
+        for (CfgOptionList::const_iterator copts = co_list.begin();
+             copts != co_list.end(); ++copts) {
+            OptionDescriptor desc = (*copts)->get(DHCP6_OPTION_SPACE, code);
+            if (desc.option_) {
+                expected = desc.option_;
+                break;
+            }
+        }
+        EXPECT_EQ(expected, flat.get(code)) << " code: " << code;
+    }
+}
+
+// This test verifies that the options of a base view have the lowest
+// precedence.
+TEST(CfgOptionFlatTest, base) {
+    CfgOptionPtr first(new CfgOption());
+    CfgOptionPtr second(new CfgOption());
+    ASSERT_NO_THROW(first->add(createOption(100, 1), true,
+                               DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(second->add(createOption(100, 2), false,
+                                DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(second->add(createOption(200, 2), true,
+                                DHCP6_OPTION_SPACE));
+
+    CfgOptionList head;
+    head.push_back(first);
+    CfgOptionList tail;
+    tail.push_back(second);
+    ConstCfgOptionFlatPtr base(new CfgOptionFlat(DHCP6_OPTION_SPACE,
+                                                 tail.begin(), tail.end()));
+    CfgOptionFlat flat(DHCP6_OPTION_SPACE, head.begin(), head.end(), base);
+
+    EXPECT_EQ(2, flat.size());
+    ASSERT_TRUE(flat.get(100));
+    EXPECT_EQ(1, valueOf(flat.get(100)));
+    ASSERT_TRUE(flat.get(200));
+    EXPECT_EQ(2, valueOf(flat.get(200)));
+
+    std::vector<uint16_t> persistent = flat.getPersistent();
+    ASSERT_EQ(2, persistent.size());
+    EXPECT_EQ(100, persistent[0]);
+    EXPECT_EQ(200, persistent[1]);
+}
+
+// This test verifies that an empty list gives an empty view.
+TEST(CfgOptionFlatTest, empty) {
+    CfgOptionList co_list;
+    co_list.push_back(CfgOptionPtr(new CfgOption()));
+    CfgOptionFlat flat(DHCP6_OPTION_SPACE, co_list.begin(), co_list.end());
+    EXPECT_TRUE(flat.empty());
+    EXPECT_TRUE(flat.getPersistent().empty());
+    EXPECT_FALSE(flat.get(1));
+}
+
+// This test verifies that the cache returns the same view for the same
+// list and option space.
+TEST(CfgOptionFlatCacheTest, get) {
+    CfgOptionPtr first(new CfgOption());
+    CfgOptionPtr second(new CfgOption());
+    ASSERT_NO_THROW(first->add(createOption(100, 1), false,
+                               DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(second->add(createOption(100, 2), false,
+                                DHCP6_OPTION_SPACE));
+
+    CfgOptionList co_list;
+    co_list.push_back(first);
+    co_list.push_back(second);
+
+    CfgOptionFlatCache cache;
+    EXPECT_EQ(CfgOptionFlatCache::MAX_ENTRIES_DEFAULT, cache.getMaxEntries());
+
+    ConstCfgOptionFlatPtr flat = cache.get(DHCP6_OPTION_SPACE, co_list);
+    ASSERT_TRUE(flat);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(flat, cache.get(DHCP6_OPTION_SPACE, co_list));
+    EXPECT_EQ(1, cache.size());
+
+    // Another order is another entry.
+    CfgOptionList reversed(co_list.rbegin(), co_list.rend());
+    ConstCfgOptionFlatPtr other = cache.get(DHCP6_OPTION_SPACE, reversed);
+    ASSERT_TRUE(other);
+    EXPECT_NE(flat, other);
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(1, valueOf(flat->get(100)));
+    EXPECT_EQ(2, valueOf(other->get(100)));
+
+    // Another option space is another entry.
+    ConstCfgOptionFlatPtr v4 = cache.get(DHCP4_OPTION_SPACE, co_list);
+    EXPECT_NE(flat, v4);
+    EXPECT_EQ(3, cache.size());
+
+    // Modifying an option configuration makes the entry stale.
+    ASSERT_NO_THROW(second->add(createOption(200, 2), false,
+                                DHCP6_OPTION_SPACE));
+    ConstCfgOptionFlatPtr updated = cache.get(DHCP6_OPTION_SPACE, co_list);
+    EXPECT_NE(flat, updated);
+    EXPECT_FALSE(flat->get(200));
+    ASSERT_TRUE(updated->get(200));
+    EXPECT_EQ(3, cache.size());
+    EXPECT_EQ(updated, cache.get(DHCP6_OPTION_SPACE, co_list));
+    flat = updated;
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+    EXPECT_NE(flat, cache.get(DHCP6_OPTION_SPACE, co_list));
+}
+
+// This test verifies that the cache is cleared when full.
+TEST(CfgOptionFlatCacheTest, maxEntries) {
+    CfgOptionFlatCache cache(2);
+    std::vector<CfgOptionList> lists;
+    for (int i = 0; i < 3; ++i) {
+        CfgOptionList co_list;
+        co_list.push_back(CfgOptionPtr(new CfgOption()));
+        lists.push_back(co_list);
+    }
+
+    ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, lists[0]));
+    ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, lists[1]));
+    EXPECT_EQ(2, cache.size());
+    ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, lists[2]));
+    EXPECT_EQ(1, cache.size());
+
+    // A cache of size zero caches nothing.
+    CfgOptionFlatCache none(0);
+    ASSERT_TRUE(none.get(DHCP6_OPTION_SPACE, lists[0]));
+    EXPECT_EQ(0, none.size());
+}
+
+// This test verifies that the client specific configurations at the head
+// of the list are not cached.
+TEST(CfgOptionFlatCacheTest, uncached) {
+    CfgOptionPtr host(new CfgOption());
+    CfgOptionPtr subnet(new CfgOption());
+    ASSERT_NO_THROW(host->add(createOption(100, 1), false,
+                              DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(subnet->add(createOption(100, 2), false,
+                                DHCP6_OPTION_SPACE));
+    ASSERT_NO_THROW(subnet->add(createOption(200, 2), false,
+                                DHCP6_OPTION_SPACE));
+
+    CfgOptionList co_list;
+    co_list.push_back(host);
+    co_list.push_back(subnet);
+
+    CfgOptionFlatCache cache;
+    ConstCfgOptionFlatPtr flat = cache.get(DHCP6_OPTION_SPACE, co_list, 1);
+    ASSERT_TRUE(flat);
+    ASSERT_TRUE(flat->get(100));
+    EXPECT_EQ(1, valueOf(flat->get(100)));
+    ASSERT_TRUE(flat->get(200));
+    EXPECT_EQ(2, valueOf(flat->get(200)));
+
+    // Only the view of the subnet options is cached.
+    EXPECT_EQ(1, cache.size());
+    CfgOptionList subnet_list;
+    subnet_list.push_back(subnet);
+    ConstCfgOptionFlatPtr subnet_flat = cache.get(DHCP6_OPTION_SPACE,
+                                                  subnet_list);
+    EXPECT_EQ(1, cache.size());
+    ASSERT_TRUE(subnet_flat->get(100));
+    EXPECT_EQ(2, valueOf(subnet_flat->get(100)));
+
+    // Another host shares the cached entry.
+    CfgOptionList other_list;
+    other_list.push_back(CfgOptionPtr(new CfgOption()));
+    other_list.push_back(subnet);
+    ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, other_list, 1));
+    EXPECT_EQ(1, cache.size());
+}
+
+// This test verifies that the cache doesn't keep the option configurations
+// alive and drops the entries referring to freed configurations.
+TEST(CfgOptionFlatCacheTest, freedConfiguration) {
+    CfgOptionFlatCache cache(2);
+    CfgOptionPtr kept(new CfgOption());
+    CfgOptionList kept_list;
+    kept_list.push_back(kept);
+    ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, kept_list));
+
+    boost::weak_ptr<CfgOption> freed;
+    {
+        CfgOptionPtr cfg(new CfgOption());
+        ASSERT_NO_THROW(cfg->add(createOption(100, 1), false,
+                                 DHCP6_OPTION_SPACE));
+        freed = cfg;
+        CfgOptionList co_list;
+        co_list.push_back(cfg);
+        ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, co_list));
+        EXPECT_EQ(2, cache.size());
+    }
+    EXPECT_TRUE(freed.expired());
+
+    // The entry of the freed configuration makes room for a new one,
+    // the other entry is kept.
+    CfgOptionPtr other(new CfgOption());
+    CfgOptionList other_list;
+    other_list.push_back(other);
+    ConstCfgOptionFlatPtr kept_flat = cache.get(DHCP6_OPTION_SPACE, kept_list);
+    ASSERT_TRUE(cache.get(DHCP6_OPTION_SPACE, other_list));
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(kept_flat, cache.get(DHCP6_OPTION_SPACE, kept_list));
+}
+
+} // end of anonymous namespace
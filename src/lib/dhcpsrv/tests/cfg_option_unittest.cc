@@ -176,6 +176,28 @@ TEST_F(CfgOptionTest, equals) {
 
 // This test verifies that multiple options can be added to the configuration
 // and that they can be retrieved using the option space name.
+// This test verifies that the generation is incremented by the methods
+// modifying the configuration.
+TEST_F(CfgOptionTest, generation) {
+    CfgOption cfg;
+    EXPECT_EQ(0, cfg.getGeneration());
+
+    OptionPtr option(new Option(Option::V6, 100));
+    ASSERT_NO_THROW(cfg.add(option, false, DHCP6_OPTION_SPACE));
+    EXPECT_EQ(1, cfg.getGeneration());
+
+    OptionDescriptor desc(OptionPtr(new Option(Option::V6, 100)), true);
+    ASSERT_NO_THROW(cfg.replace(desc, DHCP6_OPTION_SPACE));
+    EXPECT_EQ(2, cfg.getGeneration());
+
+    CfgOption other;
+    cfg.copyTo(other);
+    EXPECT_EQ(1, other.getGeneration());
+
+    EXPECT_EQ(1, cfg.del(DHCP6_OPTION_SPACE, 100));
+    EXPECT_EQ(3, cfg.getGeneration());
+}
+
 TEST_F(CfgOptionTest, add) {
     CfgOption cfg;
 
@@ -8,6 +8,7 @@
 
 #include <exceptions/exceptions.h>
 #include <dhcp/dhcp6.h>
+#include <dhcp/option_space.h>
 #include <dhcp/tests/iface_mgr_test_config.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
@@ -559,6 +560,23 @@ TEST_F(CfgMgrTest, revert) {
     EXPECT_EQ(12, cfg_mgr.getCurrentCfg()->getLoggingInfo()[0].debuglevel_);
 }
 
+// This test verifies that the cache of flattened option lists of the
+// previous configuration is cleared upon commit.
+TEST_F(CfgMgrTest, commitClearsCfgOptionFlatCache) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    SrvConfigPtr previous = cfg_mgr.getCurrentCfg();
+    CfgOptionList co_list;
+    co_list.push_back(previous->getCfgOption());
+    ASSERT_TRUE(previous->getCfgOptionFlatCache()->get(DHCP4_OPTION_SPACE,
+                                                       co_list));
+    EXPECT_EQ(1, previous->getCfgOptionFlatCache()->size());
+
+    cfg_mgr.getStagingCfg();
+    cfg_mgr.commit();
+    ASSERT_NE(previous, cfg_mgr.getCurrentCfg());
+    EXPECT_EQ(0, previous->getCfgOptionFlatCache()->size());
+}
+
 // This test verifies that the address family can be set and obtained
 // from the configuration manager.
 TEST_F(CfgMgrTest, family) {
@@ -611,6 +629,70 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ(128, total_addrs->getInteger().first);
 }
 
+// This test verifies that the lease statistics of the subnets which haven't
+// changed are kept when the statistics are updated against the previous
+// configuration, while the other subnets are recounted.
+TEST_F(CfgMgrTest, updateStatsPrevious4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    // The "old" configuration has three subnets.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet1->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    subnet2->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 25)));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.1.4.0"), 24, 1, 2, 3, 125));
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet1);
+    subnets->add(subnet2);
+    subnets->add(subnet3);
+    cfg_mgr.commit();
+    SrvConfigPtr previous = cfg_mgr.getCurrentCfg();
+
+    // In the new configuration, the first subnet is unchanged, the pool
+    // of the second subnet is smaller, the third subnet is gone and there
+    // is a new subnet.
+    subnet1.reset(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet1->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    subnet2.reset(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    subnet2->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 26)));
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.1.5.0"), 24, 1, 2, 3, 126));
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet1);
+    subnets->add(subnet2);
+    subnets->add(subnet4);
+    cfg_mgr.commit();
+
+    // Pretend there were addresses assigned before the reconfiguration.
+    stats_mgr.setValue("subnet[123].assigned-addresses", static_cast<int64_t>(150));
+    stats_mgr.setValue("subnet[124].assigned-addresses", static_cast<int64_t>(20));
+    stats_mgr.setValue("subnet[125].assigned-addresses", static_cast<int64_t>(10));
+
+    ASSERT_NO_THROW(cfg_mgr.getCurrentCfg()->getCfgSubnets4()->
+                    updateStatistics(*previous->getCfgSubnets4()));
+
+    // The unchanged subnet keeps its statistics.
+    ObservationPtr stat = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(150, stat->getInteger().first);
+
+    // The changed and new subnets are recounted.
+    stat = stats_mgr.getObservation("subnet[124].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(0, stat->getInteger().first);
+    stat = stats_mgr.getObservation("subnet[124].total-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(64, stat->getInteger().first);
+
+    stat = stats_mgr.getObservation("subnet[126].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(0, stat->getInteger().first);
+
+    // The statistics of the removed subnet are gone.
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[125].assigned-addresses"));
+}
+
 // This test verifies that once the configuration is merged into the current
 // configuration, statistics are updated appropriately.
 TEST_F(CfgMgrTest, mergeIntoCurrentStats4) {
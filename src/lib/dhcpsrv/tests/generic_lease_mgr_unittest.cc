@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -2825,6 +2825,26 @@ GenericLeaseMgrTest::testRecountLeaseStats4() {
 
     // Make sure stats are as expected.
     ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // Set a bogus value for subnet 2 which must be left alone by the
+    // recount of subnet 1 only.
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 2,
+                                                         "assigned-addresses"),
+                                  static_cast<int64_t>(5));
+    expectedStats[1]["assigned-addresses"] = 5;
+
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("192.0.1.4")));
+    expectedStats[0]["assigned-addresses"] = 0;
+
+    SubnetIDSet subnet_ids;
+    subnet_ids.insert(1);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats4(subnet_ids));
+
+    // Make sure stats are as expected.
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // The global declined addresses is the sum over the subnets.
+    checkStat("declined-addresses", 1);
 }
 
 
@@ -2947,6 +2967,26 @@ GenericLeaseMgrTest::testRecountLeaseStats6() {
 
     // Make sure stats are as expected.
     ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // Set a bogus value for subnet 1 which must be left alone by the
+    // recount of subnet 2 only.
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 1,
+                                                         "assigned-nas"),
+                                  static_cast<int64_t>(7));
+    expectedStats[0]["assigned-nas"] = 7;
+
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("2001:db81::1")));
+    expectedStats[1]["assigned-nas"] = 1;
+
+    SubnetIDSet subnet_ids;
+    subnet_ids.insert(2);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats6(subnet_ids));
+
+    // Make sure stats are as expected.
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // The global declined addresses is the sum over the subnets.
+    checkStat("declined-addresses", 2);
 }
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -382,6 +382,11 @@ TEST_F(MemfileLeaseMgrTest, constructor) {
     pmap["persist"] = "true";
     pmap["lfc-interval"] = "bogus";
     EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The lfc-in-process must be a boolean.
+    pmap["lfc-interval"] = "10";
+    pmap["lfc-in-process"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
 }
 
 // Checks if there is no lease manager NoLeaseManager is thrown.
@@ -652,6 +657,155 @@ TEST_F(MemfileLeaseMgrTest, leaseFileCleanup6) {
     EXPECT_EQ(result_file_contents, input_file.readFile());
 }
 
+// This test checks that the in-process cleanup of the DHCPv4 lease file
+// writes the leases held in memory to the previous lease file.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess4) {
+    // This string contains the lease file header, which matches
+    // the contents of the new file in which no leases have been
+    // stored.
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+
+    // This string contains the contents of the lease file with exactly
+    // one lease, but two entries. One of the entries should be removed
+    // as a result of lease file cleanup.
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1,{ \"foo\": true }\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1,\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,{ \"bar\": true }\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    // Make sure that the kea-lfc is not used.
+    setenv("KEA_LFC_EXECUTABLE", "foobar", 1);
+
+    // Create the backend.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-in-process"] = "true";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    // Try to run the lease file cleanup.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+
+    // The new lease file should have been created and it should contain
+    // no leases.
+    ASSERT_TRUE(current_file.exists());
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    // Wait for the cleanup to complete.
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // Check if we can still write to the lease file.
+    std::vector<uint8_t> hwaddr_vec(6);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    Lease4Ptr new_lease(new Lease4(IOAddress("192.0.2.45"), hwaddr,
+                                   static_cast<const uint8_t*>(0), 0,
+                                   100, 50, 60, 0, 1));
+    ASSERT_NO_THROW(lease_mgr->addLease(new_lease));
+
+    std::string updated_file_contents = new_file_contents +
+        "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0,\n";
+    EXPECT_EQ(updated_file_contents, current_file.readFile());
+
+    // The cleanup should have written the two leases held in memory
+    // at the time it was started to leasefile4_0.csv.2.
+    std::string result_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,{ \"bar\": true }\n";
+
+    LeaseFileIO input_file(getLeaseFilePath("leasefile4_0.csv.2"), false);
+    ASSERT_TRUE(input_file.exists());
+    EXPECT_EQ(result_file_contents, input_file.readFile());
+
+    // The lease file copy and the products of the cleanup should be gone.
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.1"),
+                             false).exists());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.completed"),
+                             false).exists());
+}
+
+// This test checks that the in-process cleanup of the DHCPv6 lease file
+// writes the leases held in memory to the previous lease file.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess6) {
+    // This string contains the lease file header, which matches
+    // the contents of the new file in which no leases have been
+    // stored.
+    std::string new_file_contents =
+        "address,duid,valid_lifetime,expire,subnet_id,"
+        "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+        "fqdn_rev,hostname,hwaddr,state,user_context\n";
+
+    // This string contains the contents of the lease file with exactly
+    // one lease, but two entries. One of the entries should be removed
+    // as a result of lease file cleanup.
+    std::string current_file_contents = new_file_contents +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,200,"
+        "8,100,0,7,0,1,1,,,1,\n"
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+        "8,100,0,7,0,1,1,,,1,{ \"foo\": true }\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile6_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,200,"
+        "8,100,0,7,0,1,1,,,1,{ \"bar\": true }\n"
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+        "8,100,0,7,0,1,1,,,1,\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile6_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    // Make sure that the kea-lfc is not used.
+    setenv("KEA_LFC_EXECUTABLE", "foobar", 1);
+
+    // Create the backend.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "6";
+    pmap["name"] = getLeaseFilePath("leasefile6_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-in-process"] = "true";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    // Try to run the lease file cleanup.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+
+    // The new lease file should have been created and it should contain
+    // no leases.
+    ASSERT_TRUE(current_file.exists());
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    // Wait for the cleanup to complete.
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // The cleanup should have written the two leases held in memory
+    // at the time it was started to leasefile6_0.csv.2.
+    std::string result_file_contents = new_file_contents +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+        "8,100,0,7,0,1,1,,,1,{ \"foo\": true }\n"
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+        "8,100,0,7,0,1,1,,,1,\n";
+
+    LeaseFileIO input_file(getLeaseFilePath("leasefile6_0.csv.2"), false);
+    ASSERT_TRUE(input_file.exists());
+    EXPECT_EQ(result_file_contents, input_file.readFile());
+
+    // The lease file copy should be gone.
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile6_0.csv.1"),
+                             false).exists());
+}
+
 // This test verifies that EXIT_FAILURE status code is returned when
 // the LFC process fails to start.
 TEST_F(MemfileLeaseMgrTest, leaseFileCleanupStartFail) {
@@ -1967,5 +2121,53 @@ TEST_F(MemfileLeaseMgrTest, leaseStatsQuery6) {
     testLeaseStatsQuery6();
 }
 
+// Verifies that the lease counts returned by the v4 lease stats queries
+// follow the lease updates and are restored from the lease file.
+TEST_F(MemfileLeaseMgrTest, leaseStatsQueryCounts4) {
+    startBackend(V4);
+
+    makeLease4("192.0.1.1", 1);
+    makeLease4("192.0.1.2", 1);
+    makeLease4("192.0.1.3", 1, Lease::STATE_EXPIRED_RECLAIMED);
+    makeLease4("192.0.2.1", 2);
+    makeLease4("192.0.3.1", 3, Lease::STATE_DECLINED);
+
+    // Decline an assigned lease and reclaim the declined one.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.1.2"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    lease = lmptr_->getLease4(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    // Assign the reclaimed lease and delete the only lease of subnet 2.
+    lease = lmptr_->getLease4(IOAddress("192.0.1.3"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_DEFAULT;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("192.0.2.1")));
+
+    RowSet expected_rows;
+    expected_rows.insert(LeaseStatsRow(1, Lease::STATE_DEFAULT, 2));
+    expected_rows.insert(LeaseStatsRow(1, Lease::STATE_DECLINED, 1));
+
+    LeaseStatsQueryPtr query;
+    ASSERT_NO_THROW(query = lmptr_->startLeaseStatsQuery4());
+    checkQueryAgainstRowSet(query, expected_rows);
+
+    // The subnets without leases have no rows.
+    ASSERT_NO_THROW(query = lmptr_->startSubnetRangeLeaseStatsQuery4(2, 3));
+    checkQueryAgainstRowSet(query, RowSet());
+
+    // The counts are the same after the leases are loaded from the file.
+    reopen(V4);
+    ASSERT_NO_THROW(query = lmptr_->startSubnetLeaseStatsQuery4(1));
+    checkQueryAgainstRowSet(query, expected_rows);
+}
+
 
 }  // namespace
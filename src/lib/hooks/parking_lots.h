@@ -9,11 +9,15 @@
 
 #include <exceptions/exceptions.h>
 #include <boost/any.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 #include <functional>
 #include <list>
+#include <iterator>
 #include <map>
+#include <stdint.h>
+#include <unordered_map>
 
 #include <iostream>
 
@@ -57,9 +61,66 @@ namespace hooks {
 /// functions are most often shared pointers. One should not use references
 /// to parked objects nor references to shared pointers to avoid premature
 /// destruction of the parked objects.
+///
+/// The parked objects are indexed by their hash, i.e. by the pointed
+/// object for shared pointers, so they are found in constant time. The
+/// number of parked objects may be limited with @c setLimit. When the
+/// limit is reached, referencing a new object either fails or drops the
+/// oldest parked object without invoking its callback, depending on the
+/// drop policy.
 class ParkingLot {
 public:
 
+    /// @brief Policy applied when referencing an object while the parking
+    /// lot is full.
+    enum DropPolicy {
+        DROP_NEW,    ///< The new object is not referenced.
+        DROP_OLDEST  ///< The oldest object is dropped to make room.
+    };
+
+    /// @brief Constructor.
+    ///
+    /// The number of parked objects is not limited.
+    ParkingLot()
+        : parking_(), index_(), max_parked_(0), drop_policy_(DROP_NEW),
+          overflows_(0) {
+    }
+
+    /// @brief Sets the maximum number of parked objects.
+    ///
+    /// The objects parked when the limit is lowered remain parked.
+    ///
+    /// @param max_parked maximum number of parked (or referenced) objects.
+    /// A value of 0 means no limit.
+    /// @param drop_policy policy applied when the limit is reached.
+    void setLimit(const size_t max_parked,
+                  const DropPolicy& drop_policy = DROP_NEW) {
+        max_parked_ = max_parked;
+        drop_policy_ = drop_policy;
+    }
+
+    /// @brief Returns the maximum number of parked objects, 0 meaning
+    /// no limit.
+    size_t getLimit() const {
+        return (max_parked_);
+    }
+
+    /// @brief Returns the policy applied when the parking lot is full.
+    DropPolicy getDropPolicy() const {
+        return (drop_policy_);
+    }
+
+    /// @brief Returns the number of parked (or referenced) objects.
+    size_t size() const {
+        return (parking_.size());
+    }
+
+    /// @brief Returns the number of objects dropped or not referenced
+    /// because the parking lot was full.
+    uint64_t getOverflowCount() const {
+        return (overflows_);
+    }
+
     /// @brief Parks an object.
     ///
     /// @tparam Type of the parked object.
@@ -86,18 +147,58 @@ public:
     /// on the object to be parked. It must be called before the object is
     /// actually parked.
     ///
+    /// If the object is not referenced yet and the parking lot is full,
+    /// the drop policy is applied.
+    ///
     /// @tparam Type of the parked object.
     /// @param parked_object object which will be parked.
+    /// @return false if the object couldn't be referenced because the
+    /// parking lot is full, true otherwise.
     template<typename T>
-    void reference(T parked_object) {
+    bool reference(T parked_object) {
+        auto it = find(parked_object);
+        if (it != parking_.end()) {
+            ++it->refcount_;
+            return (true);
+        }
+
+        if ((max_parked_ > 0) && (parking_.size() >= max_parked_)) {
+            ++overflows_;
+            if (drop_policy_ == DROP_NEW) {
+                return (false);
+            }
+
+            // The oldest objects are in front of the list.
+            erase(parking_.begin());
+        }
+
+        size_t key = boost::hash<T>()(parked_object);
+        parking_.push_back(ParkingInfo(parked_object, key));
+        index_.insert(std::make_pair(key, std::prev(parking_.end())));
+        return (true);
+    }
+
+    /// @brief Decreases reference counter for the object.
+    ///
+    /// This method is called by the callouts which referenced the object
+    /// but finally don't need it to be parked. The object is removed,
+    /// without invoking its callback, when the reference count drops to 0.
+    /// The references of the other callouts are preserved.
+    ///
+    /// @tparam Type of the parked object.
+    /// @param parked_object object which was referenced.
+    /// @return false if there is no such object, true otherwise.
+    template<typename T>
+    bool dereference(T parked_object) {
         auto it = find(parked_object);
         if (it == parking_.end()) {
-            ParkingInfo parking_info(parked_object);
-            parking_.push_back(parking_info);
+            return (false);
+        }
 
-        } else {
-            ++it->refcount_;
+        if (--it->refcount_ <= 0) {
+            erase(it);
         }
+        return (true);
     }
 
     /// @brief Signals that the object should be unparked.
@@ -127,7 +228,7 @@ public:
             if (it->refcount_ <= 0) {
                 // Unpark the packet and invoke the callback.
                 std::function<void()> cb = it->unpark_callback_;
-                parking_.erase(it);
+                erase(it);
                 cb();
             }
 
@@ -153,7 +254,7 @@ public:
         auto it = find(parked_object);
         if (it != parking_.end()) {
             // Parked object found.
-            parking_.erase(it);
+            erase(it);
             return (true);
         }
 
@@ -168,15 +269,17 @@ private:
         boost::any parked_object_;               ///< parked object
         std::function<void()> unpark_callback_;  ///< pointer to the callback
         int refcount_;                           ///< current reference count
+        size_t key_;                             ///< hash of the object
 
         /// @brief Constructor.
         ///
         /// @param parked_object object being parked.
+        /// @param key hash of the object.
         /// @param callback pointer to the callback.
-        ParkingInfo(const boost::any& parked_object,
+        ParkingInfo(const boost::any& parked_object, const size_t key,
                     std::function<void()> callback = 0)
             : parked_object_(parked_object), unpark_callback_(callback),
-              refcount_(1) {
+              refcount_(1), key_(key) {
         }
 
         /// @brief Update parking information.
@@ -194,10 +297,26 @@ private:
     typedef std::list<ParkingInfo> ParkingInfoList;
     /// @brief Type of the iterator in the list of parked objects.
     typedef ParkingInfoList::iterator ParkingInfoListIterator;
+    /// @brief Type of the index of parked objects by hash.
+    typedef std::unordered_multimap<size_t, ParkingInfoListIterator> ParkingInfoIndex;
 
-    /// @brief Container holding parked objects for this parking lot.
+    /// @brief Container holding parked objects for this parking lot, the
+    /// oldest first.
     ParkingInfoList parking_;
 
+    /// @brief Index of the parked objects.
+    ParkingInfoIndex index_;
+
+    /// @brief Maximum number of parked objects, 0 meaning no limit.
+    size_t max_parked_;
+
+    /// @brief Policy applied when the parking lot is full.
+    DropPolicy drop_policy_;
+
+    /// @brief Number of objects dropped or refused because the parking lot
+    /// was full.
+    uint64_t overflows_;
+
     /// @brief Search for the information about the parked object.
     ///
     /// @tparam T parked object type.
@@ -206,13 +325,30 @@ private:
     /// no such object found.
     template<typename T>
     ParkingInfoListIterator find(T parked_object) {
-        for (auto it = parking_.begin(); it != parking_.end(); ++it) {
-            if (boost::any_cast<T>(it->parked_object_) == parked_object) {
-                return (it);
+        auto range = index_.equal_range(boost::hash<T>()(parked_object));
+        for (auto it = range.first; it != range.second; ++it) {
+            // Objects of other types may have the same hash.
+            const T* object = boost::any_cast<T>(&it->second->parked_object_);
+            if (object && (*object == parked_object)) {
+                return (it->second);
             }
         }
         return (parking_.end());
     }
+
+    /// @brief Removes the information about the parked object.
+    ///
+    /// @param it Iterator pointing to the parked object.
+    void erase(ParkingInfoListIterator it) {
+        auto range = index_.equal_range(it->key_);
+        for (auto idx = range.first; idx != range.second; ++idx) {
+            if (idx->second == it) {
+                index_.erase(idx);
+                break;
+            }
+        }
+        parking_.erase(it);
+    }
 };
 
 /// @brief Type of the pointer to the parking lot.
@@ -247,9 +383,25 @@ public:
     ///
     /// @tparam Type of the parked object.
     /// @param parked_object object which will be parked.
+    /// @return false if the object couldn't be referenced because the
+    /// parking lot is full, true otherwise.
+    template<typename T>
+    bool reference(T parked_object) {
+        return (parking_lot_->reference(parked_object));
+    }
+
+    /// @brief Decreases reference counter for the object.
+    ///
+    /// This method is called by the callouts which referenced the object
+    /// but finally don't need it to be parked, instead of @c drop which
+    /// ignores the references of the other callouts.
+    ///
+    /// @tparam Type of the parked object.
+    /// @param parked_object object which was referenced.
+    /// @return false if there is no such object, true otherwise.
     template<typename T>
-    void reference(T parked_object) {
-        parking_lot_->reference(parked_object);
+    bool dereference(T parked_object) {
+        return (parking_lot_->dereference(parked_object));
     }
 
     /// @brief Signals that the object should be unparked.
@@ -281,6 +433,27 @@ public:
         return (parking_lot_->drop(parked_object));
     }
 
+    /// @brief Sets the maximum number of parked objects.
+    ///
+    /// @param max_parked maximum number of parked (or referenced) objects.
+    /// A value of 0 means no limit.
+    /// @param drop_policy policy applied when the limit is reached.
+    void setLimit(const size_t max_parked,
+                  const ParkingLot::DropPolicy& drop_policy = ParkingLot::DROP_NEW) {
+        parking_lot_->setLimit(max_parked, drop_policy);
+    }
+
+    /// @brief Returns the number of parked (or referenced) objects.
+    size_t size() const {
+        return (parking_lot_->size());
+    }
+
+    /// @brief Returns the number of objects dropped or not referenced
+    /// because the parking lot was full.
+    uint64_t getOverflowCount() const {
+        return (parking_lot_->getOverflowCount());
+    }
+
 private:
 
     /// @brief Parking lot to which this handle points.
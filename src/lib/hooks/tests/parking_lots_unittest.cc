@@ -8,8 +8,11 @@
 
 #include <exceptions/exceptions.h>
 #include <hooks/parking_lots.h>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 #include <string>
+#include <vector>
 
 using namespace isc;
 using namespace isc::hooks;
@@ -111,4 +114,115 @@ TEST(ParkingLotTest, drop) {
     EXPECT_FALSE(parking_lot_handle->unpark(parked_object));
 }
 
+// Test that dereferencing an object preserves the other references.
+TEST(ParkingLotTest, dereference) {
+    ParkingLotPtr parking_lot = boost::make_shared<ParkingLot>();
+    ParkingLotHandlePtr parking_lot_handle =
+        boost::make_shared<ParkingLotHandle>(parking_lot);
+
+    std::string parked_object = "foo";
+
+    // Two callouts reference the object and one of them changes its mind.
+    ASSERT_TRUE(parking_lot_handle->reference(parked_object));
+    ASSERT_TRUE(parking_lot_handle->reference(parked_object));
+    EXPECT_TRUE(parking_lot_handle->dereference(parked_object));
+    EXPECT_EQ(1, parking_lot_handle->size());
+
+    // The object can still be parked and is unparked by the other callout.
+    bool unparked = false;
+    ASSERT_NO_THROW(parking_lot->park(parked_object, [&unparked] {
+        unparked = true;
+    }));
+    EXPECT_TRUE(parking_lot_handle->unpark(parked_object));
+    EXPECT_TRUE(unparked);
+    EXPECT_EQ(0, parking_lot_handle->size());
+
+    // The last reference removes the object without invoking a callback.
+    ASSERT_TRUE(parking_lot_handle->reference(parked_object));
+    EXPECT_TRUE(parking_lot_handle->dereference(parked_object));
+    EXPECT_EQ(0, parking_lot_handle->size());
+    EXPECT_FALSE(parking_lot_handle->dereference(parked_object));
+}
+
+// Test that parked shared pointers are found by the pointed object.
+TEST(ParkingLotTest, sharedPointers) {
+    ParkingLot parking_lot;
+    std::vector<boost::shared_ptr<int> > objects;
+    std::vector<int> unparked;
+    for (int i = 0; i < 100; ++i) {
+        objects.push_back(boost::make_shared<int>(i));
+        ASSERT_TRUE(parking_lot.reference(objects.back()));
+        ASSERT_NO_THROW(parking_lot.park(objects.back(), [&unparked, i] {
+            unparked.push_back(i);
+        }));
+    }
+    EXPECT_EQ(100, parking_lot.size());
+
+    // Another pointer to an equal value is not parked.
+    EXPECT_FALSE(parking_lot.unpark(boost::make_shared<int>(5)));
+
+    // Unpark in reverse order.
+    for (int i = 99; i >= 0; --i) {
+        EXPECT_TRUE(parking_lot.unpark(objects[i]));
+    }
+    ASSERT_EQ(100, unparked.size());
+    EXPECT_EQ(99, unparked.front());
+    EXPECT_EQ(0, unparked.back());
+    EXPECT_EQ(0, parking_lot.size());
+}
+
+// Test that new objects are not referenced when the parking lot is full.
+TEST(ParkingLotTest, limitDropNew) {
+    ParkingLotPtr parking_lot = boost::make_shared<ParkingLot>();
+    ParkingLotHandlePtr parking_lot_handle =
+        boost::make_shared<ParkingLotHandle>(parking_lot);
+    parking_lot_handle->setLimit(2);
+    EXPECT_EQ(2, parking_lot->getLimit());
+    EXPECT_EQ(ParkingLot::DROP_NEW, parking_lot->getDropPolicy());
+
+    EXPECT_TRUE(parking_lot_handle->reference(std::string("foo")));
+    EXPECT_TRUE(parking_lot_handle->reference(std::string("bar")));
+
+    // An object which is already referenced can be referenced again.
+    EXPECT_TRUE(parking_lot_handle->reference(std::string("foo")));
+    EXPECT_EQ(0, parking_lot_handle->getOverflowCount());
+
+    EXPECT_FALSE(parking_lot_handle->reference(std::string("baz")));
+    EXPECT_EQ(2, parking_lot_handle->size());
+    EXPECT_EQ(1, parking_lot_handle->getOverflowCount());
+    EXPECT_THROW(parking_lot->park(std::string("baz"), [] {
+    }), InvalidOperation);
+
+    // There is room once an object is removed.
+    EXPECT_TRUE(parking_lot_handle->drop(std::string("bar")));
+    EXPECT_TRUE(parking_lot_handle->reference(std::string("baz")));
+
+    // Zero limit removes the limit.
+    parking_lot_handle->setLimit(0);
+    EXPECT_TRUE(parking_lot_handle->reference(std::string("bar")));
+    EXPECT_EQ(3, parking_lot_handle->size());
+}
+
+// Test that the oldest object is dropped when the parking lot is full.
+TEST(ParkingLotTest, limitDropOldest) {
+    ParkingLot parking_lot;
+    parking_lot.setLimit(2, ParkingLot::DROP_OLDEST);
+
+    bool unparked = false;
+    ASSERT_TRUE(parking_lot.reference(std::string("foo")));
+    ASSERT_NO_THROW(parking_lot.park(std::string("foo"), [&unparked] {
+        unparked = true;
+    }));
+    ASSERT_TRUE(parking_lot.reference(std::string("bar")));
+    ASSERT_TRUE(parking_lot.reference(std::string("baz")));
+    EXPECT_EQ(2, parking_lot.size());
+    EXPECT_EQ(1, parking_lot.getOverflowCount());
+
+    // The oldest object was dropped without invoking its callback.
+    EXPECT_FALSE(parking_lot.unpark(std::string("foo")));
+    EXPECT_FALSE(unparked);
+    EXPECT_TRUE(parking_lot.drop(std::string("bar")));
+    EXPECT_TRUE(parking_lot.drop(std::string("baz")));
+}
+
 }
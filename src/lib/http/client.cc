@@ -18,8 +18,10 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/weak_ptr.hpp>
 #include <array>
+#include <deque>
 #include <map>
 #include <queue>
+#include <vector>
 
 #include <iostream>
 
@@ -88,9 +90,13 @@ typedef boost::shared_ptr<ConnectionPool> ConnectionPoolPtr;
 /// the TCP connection (e.g. after sending a response), the connection can
 /// be re-established (using the same @c Connection object).
 ///
-/// If new request is created while the previous request is still in progress,
-/// the new request is stored in the FIFO queue. The queued requests to the
-/// particular URL are sent to the server when the current transaction ends.
+/// If HTTP/1.1 pipelining is enabled, new persistent requests may be sent
+/// over an established connection before the responses to the previous
+/// requests have been received. The server sends the responses in the order
+/// in which it received the requests, so the responses are matched with the
+/// transactions in FIFO order. The request timeout applies to the oldest
+/// transaction. An error terminates all transactions in progress over the
+/// connection.
 ///
 /// The communication over the TCP socket is asynchronous. The caller is notified
 /// about the completion of the transaction via a callback that the caller supplies
@@ -104,8 +110,10 @@ public:
     /// @param conn_pool Back pointer to the connection pool to which this connection
     /// belongs.
     /// @param url URL associated with this connection.
+    /// @param idle_timeout Time in milliseconds after which an idle connection
+    /// is closed. The value of 0 disables the idle timeout.
     explicit Connection(IOService& io_service, const ConnectionPoolPtr& conn_pool,
-                        const Url& url);
+                        const Url& url, const long idle_timeout);
 
     /// @brief Destructor.
     ~Connection();
@@ -113,6 +121,10 @@ public:
     /// @brief Starts new asynchronous transaction (HTTP request and response).
     ///
     /// This method expects that all pointers provided as argument are non-null.
+    /// If there are transactions in progress over the connection, the request
+    /// is pipelined, i.e. sent after the previous requests without waiting
+    /// for their responses. The caller checks that this is possible with
+    /// @c canPipeline.
     ///
     /// @param request Pointer to the request to be sent to the server.
     /// @param response Pointer to the object into which the response is stored. The
@@ -128,7 +140,7 @@ public:
                        const long request_timeout, const HttpClient::RequestHandler& callback,
                        const HttpClient::ConnectHandler& connect_callback);
 
-    /// @brief Closes the socket and cancels the request timer.
+    /// @brief Closes the socket and cancels the timers.
     void close();
 
     /// @brief Checks if a transaction has been initiated over this connection.
@@ -136,20 +148,56 @@ public:
     /// @return true if transaction has been initiated, false otherwise.
     bool isTransactionOngoing() const;
 
+    /// @brief Returns the number of transactions in progress.
+    size_t getTransactionCount() const {
+        return (transactions_.size());
+    }
+
+    /// @brief Checks if a request can be pipelined over this connection.
+    ///
+    /// A request can be pipelined if the connection is established, the
+    /// request and the requests in progress are persistent and the number
+    /// of requests in progress is lower than the pipeline depth.
+    ///
+    /// @param request Pointer to the request to be sent.
+    /// @param pipeline_depth Maximum number of requests in progress.
+    ///
+    /// @return true if the request can be sent over this connection without
+    /// waiting for the transactions in progress to complete.
+    bool canPipeline(const HttpRequestPtr& request,
+                     const size_t pipeline_depth) const;
+
 private:
 
+    /// @brief Transaction in progress over the connection.
+    struct Transaction {
+        /// @brief Holds the sent request.
+        HttpRequestPtr request_;
+        /// @brief Holds pointer to an object where response is to be stored.
+        HttpResponsePtr response_;
+        /// @brief Pointer to the HTTP response parser.
+        HttpResponseParserPtr parser_;
+        /// @brief User supplied callback.
+        HttpClient::RequestHandler callback_;
+        /// @brief Request timeout in milliseconds.
+        long request_timeout_;
+    };
+
     /// @brief Resets the state of the object.
     ///
-    /// In particular, it removes instances of objects provided for the previous
-    /// transaction by a caller. It doesn't close the socket, though.
+    /// In particular, it removes instances of objects provided for the
+    /// transactions by a caller. It doesn't close the socket, though.
     void resetState();
 
     /// @brief Performs tasks required after receiving a response or after an
     /// error.
     ///
-    /// This method triggers user's callback, resets the state of the connection
-    /// and initiates next transaction if there is any transaction queued for the
-    /// URL associated with this connection.
+    /// This method triggers user's callback for the oldest transaction. An
+    /// error also terminates the other transactions in progress. If the
+    /// response has been received, the data following it are passed to the
+    /// parser of the next transaction. Finally, it lets the connection pool
+    /// start the transactions queued for the URL associated with this
+    /// connection. It does nothing if there is no transaction in progress.
     ///
     /// @param ec Error code received as a result of the IO operation.
     /// @param parsing_error Message parsing error.
@@ -203,6 +251,11 @@ private:
     /// @brief Local callback invoked when request timeout occurs.
     void timerCallback();
 
+    /// @brief Local callback invoked when idle timeout occurs.
+    ///
+    /// It closes the socket if there is no transaction in progress.
+    void idleTimerCallback();
+
     /// @brief Pointer to the connection pool owning this connection.
     ///
     /// This is a weak pointer to avoid circular dependency between the
@@ -218,17 +271,20 @@ private:
     /// @brief Interval timer used for detecting request timeouts.
     IntervalTimer timer_;
 
-    /// @brief Holds currently sent request.
-    HttpRequestPtr current_request_;
+    /// @brief Interval timer used for closing idle connections.
+    IntervalTimer idle_timer_;
+
+    /// @brief Idle timeout in milliseconds.
+    long idle_timeout_;
 
-    /// @brief Holds pointer to an object where response is to be stored.
-    HttpResponsePtr current_response_;
+    /// @brief Transactions in progress, the oldest first.
+    std::deque<Transaction> transactions_;
 
-    /// @brief Pointer to the HTTP response parser.
-    HttpResponseParserPtr parser_;
+    /// @brief Indicates if the connection with the server is established.
+    bool connected_;
 
-    /// @brief User supplied callback.
-    HttpClient::RequestHandler current_callback_;
+    /// @brief Indicates if an asynchronous receive is in progress.
+    bool receiving_;
 
     /// @brief Output buffer.
     std::string buf_;
@@ -244,9 +300,12 @@ typedef boost::shared_ptr<Connection> ConnectionPtr;
 ///
 /// Connection pool creates and destroys connections. It holds pointers
 /// to all created connections and can verify whether the particular
-/// connection is currently busy or idle. If the connection is idle, it
-/// uses this connection for new requests. If the connection is busy, it
-/// queues new requests until the connection becomes available.
+/// connection is currently busy or idle. A new request for a given URL
+/// is sent over an idle connection with this URL. If all connections are
+/// busy, a new connection is created unless the maximum number of
+/// connections per URL has been reached. Otherwise, the request is
+/// pipelined over the least loaded connection, if pipelining is enabled,
+/// or queued until a connection becomes available.
 class ConnectionPool : public boost::enable_shared_from_this<ConnectionPool> {
 public:
 
@@ -254,8 +313,15 @@ public:
     ///
     /// @param io_service Reference to the IO service to be used by the
     /// connections.
-    explicit ConnectionPool(IOService& io_service)
-        : io_service_(io_service), conns_(), queue_() {
+    /// @param max_url_connections Maximum number of connections per URL.
+    /// @param pipeline_depth Maximum number of requests in progress over
+    /// a connection.
+    /// @param idle_timeout Idle timeout of the connections in milliseconds.
+    ConnectionPool(IOService& io_service, const size_t max_url_connections,
+                   const size_t pipeline_depth, const long idle_timeout)
+        : io_service_(io_service), max_url_connections_(max_url_connections),
+          pipeline_depth_(pipeline_depth), idle_timeout_(idle_timeout),
+          conns_(), queue_(), stats_() {
     }
 
     /// @brief Destructor.
@@ -265,49 +331,33 @@ public:
         closeAll();
     }
 
-    /// @brief Returns next queued request for the given URL.
+    /// @brief Starts the transactions queued for the given URL.
     ///
-    /// @param url URL for which next queued request should be retrieved.
-    /// @param [out] request Pointer to the queued request.
-    /// @param [out] response Pointer to the object into which response should
-    /// be stored.
-    /// @param request_timeout Requested timeout for the transaction.
-    /// @param callback Pointer to the user callback for this request.
-    /// @param connect_callback Pointer to the user callback invoked when
-    /// the client connects to the server.
+    /// The queued requests are started in the FIFO order as long as there
+    /// is a connection which can accept them.
     ///
-    /// @return true if the request for the given URL has been retrieved,
-    /// false if there are no more requests queued for this URL.
-    bool getNextRequest(const Url& url,
-                        HttpRequestPtr& request,
-                        HttpResponsePtr& response,
-                        long& request_timeout,
-                        HttpClient::RequestHandler& callback,
-                        HttpClient::ConnectHandler& connect_callback) {
-        // Check if there is a queue for this URL. If there is no queue, there
-        // is no request queued either.
+    /// @param url URL for which queued requests should be started.
+    void processQueue(const Url& url) {
         auto it = queue_.find(url);
-        if (it != queue_.end()) {
-            // If the queue is non empty, we take the oldest request.
-            if (!it->second.empty()) {
-                RequestDescriptor desc = it->second.front();
-                it->second.pop();
-                request = desc.request_;
-                response = desc.response_;
-                request_timeout = desc.request_timeout_,
-                callback = desc.callback_;
-                connect_callback = desc.connect_callback_;
-                return (true);
+        while ((it != queue_.end()) && !it->second.empty()) {
+            RequestDescriptor desc = it->second.front();
+            ConnectionPtr conn = getConnection(url, desc.request_);
+            if (!conn) {
+                break;
             }
-        }
 
-        return (false);
+            it->second.pop();
+            startTransaction(url, conn, desc);
+
+            // Starting the transaction may have modified the queue.
+            it = queue_.find(url);
+        }
     }
 
     /// @brief Queue next request for sending to the server.
     ///
-    /// A new transaction is started immediatelly, if there is no other request
-    /// in progress for the given URL. Otherwise, the request is queued.
+    /// A new transaction is started immediatelly, if there is a connection
+    /// which can accept it. Otherwise, the request is queued.
     ///
     /// @param url Destination where the request should be sent.
     /// @param request Pointer to the request to be sent to the server.
@@ -325,43 +375,40 @@ public:
                       const long request_timeout,
                       const HttpClient::RequestHandler& request_callback,
                       const HttpClient::ConnectHandler& connect_callback) {
-        auto it = conns_.find(url);
-        if (it != conns_.end()) {
-            ConnectionPtr conn = it->second;
-            // There is a connection for this URL already. Check if it is idle.
-            if (conn->isTransactionOngoing()) {
-                // Connection is busy, so let's queue the request.
-                queue_[url].push(RequestDescriptor(request, response,
-                                                   request_timeout,
-                                                   request_callback,
-                                                   connect_callback));
-
-            } else {
-                // Connection is idle, so we can start the transaction.
-                conn->doTransaction(request, response, request_timeout,
-                                    request_callback, connect_callback);
-            }
+        RequestDescriptor desc(request, response, request_timeout,
+                               request_callback, connect_callback);
+
+        // Requests queued earlier go first.
+        auto it = queue_.find(url);
+        ConnectionPtr conn;
+        if ((it == queue_.end()) || it->second.empty()) {
+            conn = getConnection(url, request);
+        }
+
+        if (conn) {
+            startTransaction(url, conn, desc);
 
         } else {
-            // There is no connection with this destination yet. Let's create
-            // it and start the transaction.
-            ConnectionPtr conn(new Connection(io_service_, shared_from_this(),
-                                              url));
-            conn->doTransaction(request, response, request_timeout, request_callback,
-                                connect_callback);
-            conns_[url] = conn;
+            std::queue<RequestDescriptor>& url_queue = queue_[url];
+            url_queue.push(desc);
+            HttpClient::Statistics& stats = stats_[url];
+            if (url_queue.size() > stats.max_queued_) {
+                stats.max_queued_ = url_queue.size();
+            }
         }
     }
 
-    /// @brief Closes connection and removes associated information from the
+    /// @brief Closes connections and removes associated information from the
     /// connection pool.
     ///
-    /// @param url URL for which connection shuld be closed.
+    /// @param url URL for which connections shuld be closed.
     void closeConnection(const Url& url) {
-        // Close connection for the specified URL.
+        // Close connections for the specified URL.
         auto conns_it = conns_.find(url);
         if (conns_it != conns_.end()) {
-            conns_it->second->close();
+            for (auto conn : conns_it->second) {
+                conn->close();
+            }
             conns_.erase(conns_it);
         }
 
@@ -377,20 +424,42 @@ public:
     void closeAll() {
         for (auto conns_it = conns_.begin(); conns_it != conns_.end();
              ++conns_it) {
-            conns_it->second->close();
+            for (auto conn : conns_it->second) {
+                conn->close();
+            }
         }
 
         conns_.clear();
         queue_.clear();
     }
 
-private:
+    /// @brief Returns statistics of the transactions with the given URL.
+    ///
+    /// @param url URL for which statistics should be returned.
+    HttpClient::Statistics getStatistics(const Url& url) const {
+        HttpClient::Statistics stats;
+        auto stats_it = stats_.find(url);
+        if (stats_it != stats_.end()) {
+            stats = stats_it->second;
+        }
 
-    /// @brief Holds reference to the IO service.
-    IOService& io_service_;
+        auto conns_it = conns_.find(url);
+        if (conns_it != conns_.end()) {
+            stats.connections_ = conns_it->second.size();
+            for (auto conn : conns_it->second) {
+                stats.in_progress_ += conn->getTransactionCount();
+            }
+        }
 
-    /// @brief Holds mapping of URLs to connections.
-    std::map<Url, ConnectionPtr> conns_;
+        auto queue_it = queue_.find(url);
+        if (queue_it != queue_.end()) {
+            stats.queued_ = queue_it->second.size();
+        }
+
+        return (stats);
+    }
+
+private:
 
     /// @brief Request descriptor holds parameters associated with the
     /// particular request.
@@ -427,16 +496,86 @@ private:
         HttpClient::ConnectHandler connect_callback_;
     };
 
+    /// @brief Returns a connection which can accept a request now.
+    ///
+    /// An idle connection is preferred. If there is none, a new connection
+    /// is created if the maximum number of connections for the URL has not
+    /// been reached. Otherwise, the least loaded connection over which the
+    /// request can be pipelined is returned.
+    ///
+    /// @param url Destination where the request should be sent.
+    /// @param request Pointer to the request to be sent.
+    ///
+    /// @return Pointer to the connection or null if the request must wait.
+    ConnectionPtr getConnection(const Url& url, const HttpRequestPtr& request) {
+        std::vector<ConnectionPtr>& conns = conns_[url];
+        for (auto conn : conns) {
+            if (!conn->isTransactionOngoing()) {
+                return (conn);
+            }
+        }
+
+        if (conns.size() < max_url_connections_) {
+            ConnectionPtr conn(new Connection(io_service_, shared_from_this(),
+                                              url, idle_timeout_));
+            conns.push_back(conn);
+            return (conn);
+        }
+
+        ConnectionPtr least_loaded;
+        for (auto conn : conns) {
+            if (conn->canPipeline(request, pipeline_depth_) &&
+                (!least_loaded || (conn->getTransactionCount() <
+                                   least_loaded->getTransactionCount()))) {
+                least_loaded = conn;
+            }
+        }
+
+        return (least_loaded);
+    }
+
+    /// @brief Starts the transaction over the given connection.
+    ///
+    /// @param url Destination where the request is sent.
+    /// @param conn Pointer to the connection.
+    /// @param desc Descriptor of the request.
+    void startTransaction(const Url& url, const ConnectionPtr& conn,
+                          const RequestDescriptor& desc) {
+        if (conn->isTransactionOngoing()) {
+            ++stats_[url].pipelined_;
+        }
+        conn->doTransaction(desc.request_, desc.response_, desc.request_timeout_,
+                            desc.callback_, desc.connect_callback_);
+    }
+
+    /// @brief Holds reference to the IO service.
+    IOService& io_service_;
+
+    /// @brief Maximum number of connections per URL.
+    size_t max_url_connections_;
+
+    /// @brief Maximum number of requests in progress over a connection.
+    size_t pipeline_depth_;
+
+    /// @brief Idle timeout of the connections in milliseconds.
+    long idle_timeout_;
+
+    /// @brief Holds mapping of URLs to connections.
+    std::map<Url, std::vector<ConnectionPtr> > conns_;
+
     /// @brief Holds the queue of requests for different URLs.
     std::map<Url, std::queue<RequestDescriptor> > queue_;
+
+    /// @brief Holds the counters of the transactions for different URLs.
+    std::map<Url, HttpClient::Statistics> stats_;
 };
 
 Connection::Connection(IOService& io_service,
                        const ConnectionPoolPtr& conn_pool,
-                       const Url& url)
+                       const Url& url, const long idle_timeout)
     : conn_pool_(conn_pool), url_(url), socket_(io_service), timer_(io_service),
-      current_request_(), current_response_(), parser_(), current_callback_(),
-      buf_(), input_buf_() {
+      idle_timer_(io_service), idle_timeout_(idle_timeout), transactions_(),
+      connected_(false), receiving_(false), buf_(), input_buf_() {
 }
 
 Connection::~Connection() {
@@ -445,10 +584,10 @@ Connection::~Connection() {
 
 void
 Connection::resetState() {
-    current_request_.reset();
-    current_response_.reset();
-    parser_.reset();
-    current_callback_ = HttpClient::RequestHandler();
+    transactions_.clear();
+    connected_ = false;
+    receiving_ = false;
+    buf_.clear();
 }
 
 void
@@ -458,23 +597,18 @@ Connection::doTransaction(const HttpRequestPtr& request,
                           const HttpClient::RequestHandler& callback,
                           const HttpClient::ConnectHandler& connect_callback) {
     try {
-        current_request_ = request;
-        current_response_ = response;
-        parser_.reset(new HttpResponseParser(*current_response_));
-        parser_->initModel();
-        current_callback_ = callback;
+        idle_timer_.cancel();
 
-        buf_ = request->toString();
+        Transaction transaction;
+        transaction.request_ = request;
+        transaction.response_ = response;
+        transaction.parser_.reset(new HttpResponseParser(*response));
+        transaction.parser_->initModel();
+        transaction.callback_ = callback;
+        transaction.request_timeout_ = request_timeout;
 
-        // If the socket is open we check if it is possible to transmit the data
-        // over this socket by reading from it with message peeking. If the socket
-        // is not usable, we close it and then re-open it. There is a narrow window of
-        // time between checking the socket usability and actually transmitting the
-        // data over this socket, when the peer may close the connection. In this
-        // case we'll need to re-transmit but we don't handle it here.
-        if (socket_.getASIOSocket().is_open() && !socket_.isUsable()) {
-            socket_.close();
-        }
+        bool pipelined = !transactions_.empty();
+        transactions_.push_back(transaction);
 
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
                   HTTP_CLIENT_REQUEST_SEND)
@@ -487,6 +621,31 @@ Connection::doTransaction(const HttpRequestPtr& request,
             .arg(HttpMessageParserBase::logFormatHttpMessage(request->toString(),
                                                              MAX_LOGGED_MESSAGE_SIZE));
 
+        // The connection is established, so the request is sent after the
+        // requests in progress. Start sending unless sending is already in
+        // progress.
+        if (pipelined) {
+            bool sending = !buf_.empty();
+            buf_ += request->toString();
+            if (!sending) {
+                doSend();
+            }
+            return;
+        }
+
+        buf_ = request->toString();
+
+        // If the socket is open we check if it is possible to transmit the data
+        // over this socket by reading from it with message peeking. If the socket
+        // is not usable, we close it and then re-open it. There is a narrow window of
+        // time between checking the socket usability and actually transmitting the
+        // data over this socket, when the peer may close the connection. In this
+        // case we'll need to re-transmit but we don't handle it here.
+        if (socket_.getASIOSocket().is_open() && !socket_.isUsable()) {
+            socket_.close();
+            connected_ = false;
+        }
+
         // Setup request timer.
         scheduleTimer(request_timeout);
 
@@ -510,13 +669,31 @@ Connection::doTransaction(const HttpRequestPtr& request,
 void
 Connection::close() {
     timer_.cancel();
+    idle_timer_.cancel();
     socket_.close();
     resetState();
 }
 
 bool
 Connection::isTransactionOngoing() const {
-    return (static_cast<bool>(current_request_));
+    return (!transactions_.empty());
+}
+
+bool
+Connection::canPipeline(const HttpRequestPtr& request,
+                        const size_t pipeline_depth) const {
+    if (!connected_ || transactions_.empty() ||
+        (transactions_.size() >= pipeline_depth) || !request->isPersistent()) {
+        return (false);
+    }
+
+    for (const auto& transaction : transactions_) {
+        if (!transaction.request_->isPersistent()) {
+            return (false);
+        }
+    }
+
+    return (true);
 }
 
 void
@@ -524,12 +701,24 @@ Connection::terminate(const boost::system::error_code& ec,
                       const std::string& parsing_error) {
 
     timer_.cancel();
-    socket_.cancel();
 
+    // The transactions may have been terminated already, e.g. by an
+    // error while this connection was still receiving.
+    if (transactions_.empty()) {
+        return;
+    }
+
+    // Keep a pointer to this object as the callbacks may remove this
+    // connection from the pool.
+    ConnectionPtr self = shared_from_this();
+
+    Transaction transaction = transactions_.front();
     HttpResponsePtr response;
+    bool failed = true;
 
-    if (!ec && current_response_->isFinalized()) {
-        response = current_response_;
+    if (!ec && transaction.response_->isFinalized()) {
+        response = transaction.response_;
+        failed = false;
 
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC,
                   HTTP_SERVER_RESPONSE_RECEIVED)
@@ -538,7 +727,7 @@ Connection::terminate(const boost::system::error_code& ec,
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC_DATA,
                   HTTP_SERVER_RESPONSE_RECEIVED_DETAILS)
             .arg(url_.toText())
-            .arg(parser_->getBufferAsString(MAX_LOGGED_MESSAGE_SIZE));
+            .arg(transaction.parser_->getBufferAsString(MAX_LOGGED_MESSAGE_SIZE));
 
     } else {
         std::string err = parsing_error.empty() ? ec.message() : parsing_error;
@@ -554,37 +743,81 @@ Connection::terminate(const boost::system::error_code& ec,
             LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC_DATA,
                       HTTP_BAD_SERVER_RESPONSE_RECEIVED_DETAILS)
                 .arg(url_.toText())
-                .arg(parser_->getBufferAsString());
+                .arg(transaction.parser_->getBufferAsString());
         }
 
     }
 
+    // The data following the response belong to the next response.
+    std::string unparsed;
+    if (!failed) {
+        unparsed = transaction.parser_->getUnparsedData();
+    }
+
     try {
         // The callback should take care of its own exceptions but one
         // never knows.
-        current_callback_(ec, response, parsing_error);
+        transaction.callback_(ec, response, parsing_error);
 
     } catch (...) {
     }
 
-    // If we're not requesting connection persistence, we should close the socket.
-    // We're going to reconnect for the next transaction.
-    if (!current_request_->isPersistent()) {
-        close();
+    // The callback may have closed the connection.
+    if (!transactions_.empty() &&
+        (transactions_.front().request_ == transaction.request_)) {
+        transactions_.pop_front();
     }
 
-    resetState();
+    if (failed) {
+        // The responses to the pipelined requests can't be matched
+        // anymore, so these transactions fail too.
+        std::deque<Transaction> aborted;
+        aborted.swap(transactions_);
+        if (!aborted.empty()) {
+            close();
+        } else {
+            socket_.cancel();
+            receiving_ = false;
+            buf_.clear();
+        }
+
+        for (const auto& t : aborted) {
+            try {
+                t.callback_(ec ? ec : boost::asio::error::connection_aborted,
+                            HttpResponsePtr(), parsing_error);
+            } catch (...) {
+            }
+        }
+
+    } else if (!transaction.request_->isPersistent()) {
+        // If we're not requesting connection persistence, we should close the
+        // socket. We're going to reconnect for the next transaction.
+        close();
 
-    // Check if there are any requests queued for this connection and start
-    // another transaction if there is at least one.
-    HttpRequestPtr request;
-    long request_timeout;
-    HttpClient::RequestHandler callback;
-    HttpClient::ConnectHandler connect_callback;
+    } else if (!transactions_.empty()) {
+        // Continue with the next response.
+        scheduleTimer(transactions_.front().request_timeout_);
+        if (!unparsed.empty()) {
+            transactions_.front().parser_->postBuffer(unparsed.data(),
+                                                      unparsed.size());
+            transactions_.front().parser_->poll();
+        }
+        if (!receiving_) {
+            receiveCallback(boost::system::error_code(), 0);
+        }
+    }
+
+    // Start the transactions queued for this URL.
     ConnectionPoolPtr conn_pool = conn_pool_.lock();
-    if (conn_pool && conn_pool->getNextRequest(url_, request, response, request_timeout,
-                                               callback, connect_callback)) {
-        doTransaction(request, response, request_timeout, callback, connect_callback);
+    if (conn_pool) {
+        conn_pool->processQueue(url_);
+    }
+
+    // Close the connection if it remains unused for too long.
+    if (transactions_.empty() && (idle_timeout_ > 0) &&
+        socket_.getASIOSocket().is_open()) {
+        idle_timer_.setup(boost::bind(&Connection::idleTimerCallback, this),
+                          idle_timeout_, IntervalTimer::ONE_SHOT);
     }
 }
 
@@ -615,9 +848,11 @@ Connection::doReceive() {
                                          _1, _2));
 
     try {
+        receiving_ = true;
         socket_.asyncReceive(static_cast<void*>(input_buf_.data()), input_buf_.size(), 0,
                              &endpoint, socket_cb);
     } catch (...) {
+        receiving_ = false;
         terminate(boost::asio::error::not_connected);
     }
 }
@@ -644,6 +879,8 @@ Connection::connectCallback(HttpClient::ConnectHandler connect_callback,
         terminate(ec);
 
     } else {
+        connected_ = true;
+
         // Start sending the request asynchronously.
         doSend();
     }
@@ -674,10 +911,13 @@ Connection::sendCallback(const boost::system::error_code& ec, size_t length) {
         buf_.erase(0, length);
     }
 
-    // If there is no more data to be sent, start receiving a response. Otherwise,
+    // If there is no more data to be sent, start receiving a response unless
+    // receiving the response to a previous request is in progress. Otherwise,
     // continue sending.
     if (buf_.empty()) {
-        doReceive();
+        if (!receiving_) {
+            doReceive();
+        }
 
     } else {
         doSend();
@@ -686,6 +926,14 @@ Connection::sendCallback(const boost::system::error_code& ec, size_t length) {
 
 void
 Connection::receiveCallback(const boost::system::error_code& ec, size_t length) {
+    receiving_ = false;
+
+    // The receive has been cancelled when the transactions were terminated.
+    if ((ec.value() == boost::asio::error::operation_aborted) ||
+        transactions_.empty()) {
+        return;
+    }
+
     if (ec) {
         // EAGAIN and EWOULDBLOCK don't indicate an error in this case. All
         // other errors should terminate the transaction.
@@ -704,21 +952,24 @@ Connection::receiveCallback(const boost::system::error_code& ec, size_t length)
     // Receiving is in progress, so push back the timeout.
     scheduleTimer(timer_.getInterval());
 
+    // The response belongs to the oldest transaction.
+    Transaction& transaction = transactions_.front();
+
     // If we have received any data, let's feed the parser with it.
     if (length != 0) {
-        parser_->postBuffer(static_cast<void*>(input_buf_.data()), length);
-        parser_->poll();
+        transaction.parser_->postBuffer(static_cast<void*>(input_buf_.data()), length);
+        transaction.parser_->poll();
     }
 
     // If the parser still needs data, let's schedule another receive.
-    if (parser_->needData()) {
+    if (transaction.parser_->needData()) {
         doReceive();
 
-    } else if (parser_->httpParseOk()) {
+    } else if (transaction.parser_->httpParseOk()) {
         // No more data needed and parsing has been successful so far. Let's
         // try to finalize the response parsing.
         try {
-            current_response_->finalize();
+            transaction.response_->finalize();
             terminate(ec);
 
         } catch (const std::exception& ex) {
@@ -729,7 +980,7 @@ Connection::receiveCallback(const boost::system::error_code& ec, size_t length)
     } else {
         // Parsing was unsuccessul. Let's pass the error message held in the
         // parser.
-        terminate(ec, parser_->getErrorMessage());
+        terminate(ec, transaction.parser_->getErrorMessage());
     }
 }
 
@@ -739,6 +990,15 @@ Connection::timerCallback() {
     terminate(boost::asio::error::timed_out);
 }
 
+void
+Connection::idleTimerCallback() {
+    if (!isTransactionOngoing()) {
+        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  HTTP_CLIENT_IDLE_CONNECTION_CLOSED)
+            .arg(url_.toText());
+        close();
+    }
+}
 }
 
 namespace isc {
@@ -751,8 +1011,16 @@ public:
     /// @brief Constructor.
     ///
     /// Creates new connection pool.
-    HttpClientImpl(IOService& io_service)
-        : conn_pool_(new ConnectionPool(io_service)) {
+    ///
+    /// @param io_service IO service to be used by the connections.
+    /// @param max_url_connections Maximum number of connections per URL.
+    /// @param pipeline_depth Maximum number of requests in progress over
+    /// a connection.
+    /// @param idle_timeout Idle timeout of the connections in milliseconds.
+    HttpClientImpl(IOService& io_service, const size_t max_url_connections,
+                   const size_t pipeline_depth, const long idle_timeout)
+        : conn_pool_(new ConnectionPool(io_service, max_url_connections,
+                                        pipeline_depth, idle_timeout)) {
     }
 
     /// @brief Holds a pointer to the connection pool.
@@ -760,8 +1028,29 @@ public:
 
 };
 
-HttpClient::HttpClient(IOService& io_service)
-    : impl_(new HttpClientImpl(io_service)) {
+HttpClient::Statistics::Statistics()
+    : connections_(0), in_progress_(0), queued_(0), max_queued_(0),
+      pipelined_(0) {
+}
+
+HttpClient::HttpClient(IOService& io_service, const size_t max_url_connections,
+                       const size_t pipeline_depth, const long idle_timeout) {
+    if (max_url_connections == 0) {
+        isc_throw(HttpClientError, "maximum number of connections per URL"
+                  " must be greater than 0");
+    }
+
+    if (pipeline_depth == 0) {
+        isc_throw(HttpClientError, "HTTP pipeline depth must be greater than 0");
+    }
+
+    if (idle_timeout < 0) {
+        isc_throw(HttpClientError, "HTTP client idle timeout must not be"
+                  " negative");
+    }
+
+    impl_.reset(new HttpClientImpl(io_service, max_url_connections,
+                                   pipeline_depth, idle_timeout));
 }
 
 void
@@ -795,5 +1084,10 @@ HttpClient::stop() {
     impl_->conn_pool_->closeAll();
 }
 
+HttpClient::Statistics
+HttpClient::getStatistics(const Url& url) const {
+    return (impl_->conn_pool_->getStatistics(url));
+}
+
 } // end of namespace isc::http
 } // end of namespace isc
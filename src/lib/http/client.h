@@ -14,6 +14,7 @@
 #include <http/response.h>
 #include <boost/shared_ptr.hpp>
 #include <functional>
+#include <stdint.h>
 #include <string>
 
 namespace isc {
@@ -55,6 +56,23 @@ class HttpClientImpl;
 /// request is queued in the FIFO queue. When the previous request completes,
 /// the next request in the queue for the particular URL will be initiated.
 ///
+/// The client may be configured to open several connections with the same
+/// URL. In this case a new request is sent over an idle connection or over
+/// a new connection, as long as the number of connections with the URL is
+/// lower than the configured maximum. The client may also be configured to
+/// use HTTP/1.1 pipelining: when all connections with the URL are busy, a
+/// persistent request is sent over an established connection without
+/// waiting for the responses to the requests in progress. The server must
+/// send the responses in order, as required by RFC 7230, so they are
+/// matched with the requests in FIFO order. An error in a connection
+/// terminates all transactions in progress over this connection. The
+/// default configuration, i.e. a single connection per URL without
+/// pipelining, guarantees that the requests to a URL are processed by the
+/// server one after another in the order in which they were sent.
+///
+/// A connection which remains idle for longer than the configured idle
+/// timeout is closed and re-established when the next request is sent.
+///
 /// The client tests the persistent connection for usability before sending
 /// a request by trying to read from the socket (with message peeking). If
 /// the socket is usable the client uses it to transmit the request.
@@ -90,20 +108,51 @@ public:
     /// so a not null error code does not always mean the connect failed.
     typedef std::function<bool(const boost::system::error_code&)> ConnectHandler;
 
+    /// @brief Statistics of the transactions with a URL.
+    struct Statistics {
+        /// @brief Constructor.
+        ///
+        /// Sets all counters to 0.
+        Statistics();
+
+        /// @brief Number of connections with the URL.
+        size_t connections_;
+        /// @brief Number of transactions started and not completed.
+        size_t in_progress_;
+        /// @brief Number of requests waiting for a connection.
+        size_t queued_;
+        /// @brief Highest number of requests waiting for a connection.
+        size_t max_queued_;
+        /// @brief Number of requests sent before receiving the responses
+        /// to the previous requests over the same connection.
+        uint64_t pipelined_;
+    };
+
     /// @brief Constructor.
     ///
     /// @param io_service IO service to be used by the HTTP client.
-    explicit HttpClient(asiolink::IOService& io_service);
+    /// @param max_url_connections Maximum number of connections per URL.
+    /// @param pipeline_depth Maximum number of requests in progress over a
+    /// connection. The value of 1 disables pipelining.
+    /// @param idle_timeout Time in milliseconds after which an idle connection
+    /// is closed. The value of 0 disables the idle timeout.
+    ///
+    /// @throw HttpClientError if the maximum number of connections or the
+    /// pipeline depth is 0 or if the idle timeout is negative.
+    explicit HttpClient(asiolink::IOService& io_service,
+                        const size_t max_url_connections = 1,
+                        const size_t pipeline_depth = 1,
+                        const long idle_timeout = 0);
 
     /// @brief Queues new asynchronous HTTP request.
     ///
-    /// The client creates one connection for the specified URL. If the
-    /// connection with the particular destination already exists, it will be
-    /// re-used for the new transaction scheduled with this call. If another
-    /// transaction is still in progress, the new transaction is queued. The
-    /// queued transactions are started in the FIFO order one after another. If
-    /// the connection is idle or the connection doesn't exist, the new
-    /// transaction is started immediatelly.
+    /// The client re-uses an idle connection with the specified URL for the
+    /// new transaction scheduled with this call, or creates a new connection
+    /// if there is no idle connection and the maximum number of connections
+    /// with the URL has not been reached. Otherwise, the transaction is
+    /// pipelined over a busy connection, if pipelining is enabled, or queued.
+    /// The queued transactions are started in the FIFO order as connections
+    /// become available.
     ///
     /// The existing connection is tested before it is used for the new
     /// transaction by attempting to read (with message peeking) from the open
@@ -172,6 +221,11 @@ public:
     /// @brief Closes all connections.
     void stop();
 
+    /// @brief Returns statistics of the transactions with a URL.
+    ///
+    /// @param url URL for which statistics should be returned.
+    Statistics getStatistics(const Url& url) const;
+
 private:
 
     /// @brief Pointer to the HTTP client implementation.
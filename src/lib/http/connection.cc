@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -135,8 +135,7 @@ HttpConnection::doWrite() {
                 stopThisConnection();
 
             } else {
-                reinitProcessingState();
-                doRead();
+                readNextRequest();
             }
         }
     } catch (...) {
@@ -242,23 +241,37 @@ HttpConnection::socketReadCallback(boost::system::error_code ec, size_t length)
         // Don't want to timeout if creation of the response takes long.
         request_timer_.cancel();
 
-        HttpResponsePtr response = response_creator_->createHttpResponse(request_);
-        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC,
-                  HTTP_SERVER_RESPONSE_SEND)
-            .arg(response->toBriefString())
-            .arg(getRemoteEndpointAddressAsText());
+        // The response may be created asynchronously, e.g. when it carries
+        // answers received from other servers. No other request is read
+        // over this connection until it has been sent.
+        response_creator_->createHttpResponseAsync(request_,
+            boost::bind(&HttpConnection::responseCreatedCallback,
+                        shared_from_this(), _1));
+    }
+}
 
-        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC_DATA,
-                  HTTP_SERVER_RESPONSE_SEND_DETAILS)
-            .arg(getRemoteEndpointAddressAsText())
-            .arg(HttpMessageParserBase::logFormatHttpMessage(response->toString(),
-                                                             MAX_LOGGED_MESSAGE_SIZE));
+void
+HttpConnection::responseCreatedCallback(const HttpResponsePtr& response) {
+    // The connection may have been stopped while the response was created.
+    if (!socket_.getASIOSocket().is_open()) {
+        return;
+    }
 
-        // Response created. Active timer again.
-        setupRequestTimer();
+    LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC,
+              HTTP_SERVER_RESPONSE_SEND)
+        .arg(response->toBriefString())
+        .arg(getRemoteEndpointAddressAsText());
 
-        asyncSendResponse(response);
-    }
+    LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC_DATA,
+              HTTP_SERVER_RESPONSE_SEND_DETAILS)
+        .arg(getRemoteEndpointAddressAsText())
+        .arg(HttpMessageParserBase::logFormatHttpMessage(response->toString(),
+                                                         MAX_LOGGED_MESSAGE_SIZE));
+
+    // Response created. Active timer again.
+    setupRequestTimer();
+
+    asyncSendResponse(response);
 }
 
 void
@@ -300,8 +313,7 @@ HttpConnection::socketWriteCallback(boost::system::error_code ec, size_t length)
             stopThisConnection();
 
         } else {
-            reinitProcessingState();
-            doRead();
+            readNextRequest();
         }
     }
 }
@@ -314,6 +326,29 @@ HttpConnection::reinitProcessingState() {
     setupIdleTimer();
 }
 
+void
+HttpConnection::readNextRequest() {
+    // The client may have sent next request without waiting for the
+    // response (pipelining). Its beginning is held in the parser of the
+    // previous request.
+    std::string unparsed;
+    if (parser_->httpParseOk()) {
+        unparsed = parser_->getUnparsedData();
+    }
+
+    reinitProcessingState();
+
+    if (unparsed.empty()) {
+        doRead();
+
+    } else {
+        parser_->postBuffer(static_cast<const void*>(unparsed.data()),
+                            unparsed.size());
+        parser_->poll();
+        socketReadCallback(boost::system::error_code(), 0);
+    }
+}
+
 void
 HttpConnection::setupRequestTimer() {
     // Pass raw pointer rather than shared_ptr to this object,
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -169,6 +169,15 @@ private:
     void socketWriteCallback(boost::system::error_code ec,
                              size_t length);
 
+    /// @brief Callback invoked when the response to the request has been
+    /// created.
+    ///
+    /// It starts sending the response unless the connection has been
+    /// closed in the meantime.
+    ///
+    /// @param response Pointer to the created response.
+    void responseCreatedCallback(const HttpResponsePtr& response);
+
     /// @brief Reinitializes request processing state after sending a response.
     ///
     /// This method is only called for persistent connections, when the response
@@ -177,6 +186,14 @@ private:
     /// idle timer to monitor the connection timeout.
     void reinitProcessingState();
 
+    /// @brief Starts processing the next request over a persistent connection.
+    ///
+    /// The data received after the previous request, if any, are passed to
+    /// the parser of the next request, so that the requests sent by a client
+    /// without waiting for responses are processed in order. Otherwise, it
+    /// starts reading from the socket.
+    void readNextRequest();
+
     /// @brief Reset timer for detecting request timeouts.
     void setupRequestTimer();
 
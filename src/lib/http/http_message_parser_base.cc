@@ -72,6 +72,14 @@ HttpMessageParserBase::postBuffer(const void* buf, const size_t buf_size) {
     }
 }
 
+std::string
+HttpMessageParserBase::getUnparsedData() const {
+    if (buffer_pos_ < buffer_.size()) {
+        return (buffer_.substr(buffer_pos_));
+    }
+    return (std::string());
+}
+
 std::string
 HttpMessageParserBase::getBufferAsString(const size_t limit) const {
     std::string message(buffer_.begin(), buffer_.end());
@@ -154,9 +162,10 @@ HttpMessageParserBase::stateWithReadHandler(const std::string& handler_name,
 void
 HttpMessageParserBase::stateWithMultiReadHandler(const std::string& handler_name,
                                                  boost::function<void(const std::string&)>
-                                                 after_read_logic) {
+                                                 after_read_logic,
+                                                 const size_t limit) {
     std::string bytes;
-    getNextFromBuffer(bytes, 0);
+    getNextFromBuffer(bytes, limit);
     // Do nothing if we reached the end of buffer.
     if (getNextEvent() != NEED_MORE_DATA_EVT) {
         switch(getNextEvent()) {
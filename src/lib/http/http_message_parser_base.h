@@ -148,6 +148,16 @@ public:
     /// @return Textual representation of the input buffer.
     std::string getBufferAsString(const size_t limit = 0) const;
 
+    /// @brief Returns the data following the parsed message.
+    ///
+    /// The parser doesn't read beyond the end of the message, so when the
+    /// peer sends several messages back to back (HTTP/1.1 pipelining) the
+    /// received data may hold the beginning of the next message. These data
+    /// should be posted to the parser of the next message.
+    ///
+    /// @return Data in the input buffer which haven't been parsed.
+    std::string getUnparsedData() const;
+
     /// @brief Formats provided HTTP message for logging.
     ///
     /// This method is useful in cases when there is a need to log a HTTP message
@@ -212,11 +222,14 @@ protected:
     /// method.
     /// @param after_read_logic Callback function to parse multiple bytes of
     /// data. This callback function implements state specific logic.
+    /// @param limit Maximum number of bytes to be read. If it is 0, all
+    /// bytes in the buffer are read.
     ///
     /// @throw HttpRequestParserError when invalid event occurred.
     void stateWithMultiReadHandler(const std::string& handler_name,
                                    boost::function<void(const std::string&)>
-                                   after_read_logic);
+                                   after_read_logic,
+                                   const size_t limit = 0);
 
     /// @brief Transition parser to failure state.
     ///
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -29,5 +29,27 @@ HttpResponseCreator::createHttpResponse(const ConstHttpRequestPtr& request) {
     return (createDynamicHttpResponse(request));
 }
 
+void
+HttpResponseCreator::createHttpResponseAsync(const ConstHttpRequestPtr& request,
+                                             const HttpResponseHandler& handler) {
+    if (!request) {
+        isc_throw(HttpResponseError, "internal server error: HTTP request is null");
+    }
+
+    if (!request->isFinalized()) {
+        handler(createStockHttpResponse(request, HttpStatusCode::BAD_REQUEST));
+        return;
+    }
+
+    createDynamicHttpResponseAsync(request, handler);
+}
+
+void
+HttpResponseCreator::
+createDynamicHttpResponseAsync(const ConstHttpRequestPtr& request,
+                               const HttpResponseHandler& handler) {
+    handler(createDynamicHttpResponse(request));
+}
+
 }
 }
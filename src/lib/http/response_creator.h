@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 
 #include <http/request.h>
 #include <http/response.h>
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 
 namespace isc {
@@ -19,6 +20,9 @@ class HttpResponseCreator;
 /// @brief Pointer to the @ref HttpResponseCreator object.
 typedef boost::shared_ptr<HttpResponseCreator> HttpResponseCreatorPtr;
 
+/// @brief Type of the callback receiving a response created asynchronously.
+typedef boost::function<void(const HttpResponsePtr&)> HttpResponseHandler;
+
 /// @brief Specifies an interface for classes creating HTTP responses
 /// from HTTP requests.
 ///
@@ -76,6 +80,21 @@ public:
     virtual HttpResponsePtr
     createHttpResponse(const ConstHttpRequestPtr& request) final;
 
+    /// @brief Create HTTP response from HTTP request received asynchronously.
+    ///
+    /// This is the asynchronous counterpart of the @c createHttpResponse.
+    /// The response to a finalized request is created by the
+    /// @c createDynamicHttpResponseAsync which may return before the
+    /// response is available, e.g. when it is waiting for other servers.
+    /// The handler is invoked from the IO service when it is.
+    ///
+    /// @param request Pointer to an object representing HTTP request.
+    /// @param handler Callback invoked with the generated HTTP response.
+    /// @throw HttpResponseError if request is a NULL pointer.
+    virtual void
+    createHttpResponseAsync(const ConstHttpRequestPtr& request,
+                            const HttpResponseHandler& handler) final;
+
     /// @brief Create a new request.
     ///
     /// This method creates an instance of the @ref HttpRequest or derived
@@ -105,6 +124,18 @@ protected:
     virtual HttpResponsePtr
     createDynamicHttpResponse(const ConstHttpRequestPtr& request) = 0;
 
+    /// @brief Creates implementation specific HTTP response asynchronously.
+    ///
+    /// The default implementation calls @c createDynamicHttpResponse and
+    /// invokes the handler at once. The derived classes override it when
+    /// the response can't be created without waiting.
+    ///
+    /// @param request Pointer to an object representing HTTP request.
+    /// @param handler Callback invoked with the generated HTTP response.
+    virtual void
+    createDynamicHttpResponseAsync(const ConstHttpRequestPtr& request,
+                                   const HttpResponseHandler& handler);
+
 };
 
 } // namespace http
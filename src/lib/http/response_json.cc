@@ -110,7 +110,11 @@ HttpResponseJson::parseBodyAsJson() {
    try {
        // Only parse the body if it hasn't been parsed yet.
        if (!json_ && !context_->body_.empty()) {
-           json_ = Element::fromJSON(context_->body_);
+           // Responses are not configurations, so the positions of the
+           // elements are not needed.
+           json_ = Element::fromJSONBuffer(context_->body_.data(),
+                                           context_->body_.size(),
+                                           "<string>", false);
        }
     } catch (const std::exception& ex) {
         isc_throw(HttpResponseJsonError, "unable to parse the body of the HTTP"
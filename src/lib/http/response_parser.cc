@@ -436,22 +436,23 @@ HttpResponseParser::headerValueHandler() {
 
 void
 HttpResponseParser::bodyHandler() {
-    stateWithMultiReadHandler("bodyHandler", [this](const std::string& body) {
+    // Don't read beyond the body. The data following it belong to the
+    // next message.
+    size_t content_length = response_.getHeaderValueAsUint64("Content-Length");
+    size_t remaining = (context_->body_.length() < content_length ?
+                        content_length - context_->body_.length() : 0);
+    stateWithMultiReadHandler("bodyHandler",
+                              [this, content_length](const std::string& body) {
         // We don't validate the body at this stage. Simply record the
         // number of characters specified within "Content-Length".
         context_->body_ += body;
-        size_t content_length = response_.getHeaderValueAsUint64("Content-Length");
         if (context_->body_.length() < content_length) {
             transition(HTTP_BODY_ST, DATA_READ_OK_EVT);
 
         } else {
-            // If there was some extraneous data, ignore it.
-            if (context_->body_.length() > content_length) {
-                context_->body_.resize(content_length);
-            }
             transition(HTTP_PARSE_OK_ST, HTTP_PARSE_OK_EVT);
         }
-    });
+    }, remaining);
 }
 
 
@@ -188,6 +188,39 @@ TEST_F(HttpResponseParserTest, extraneousDataInResponse) {
     EXPECT_TRUE(parser.getErrorMessage().empty());
 }
 
+// This test verifies that the data following the response are not parsed
+// and can be passed to the parser of the next response.
+TEST_F(HttpResponseParserTest, pipelinedResponses) {
+    std::string http_resp = "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n";
+    std::string first = createResponseString(http_resp, "{ \"sequence\": 1 }");
+    std::string second = createResponseString(http_resp, "{ \"sequence\": 2 }");
+
+    // Post both responses and a part of the third one to the parser.
+    std::string data = first + second + second.substr(0, 10);
+    HttpResponseJson response1;
+    HttpResponseParser parser1(response1);
+    ASSERT_NO_THROW(parser1.initModel());
+    parser1.postBuffer(&data[0], data.size());
+    ASSERT_NO_THROW(parser1.poll());
+    ASSERT_TRUE(parser1.httpParseOk());
+    ASSERT_NO_THROW(response1.finalize());
+    EXPECT_EQ(1, response1.getJsonElement("sequence")->intValue());
+
+    std::string unparsed = parser1.getUnparsedData();
+    EXPECT_EQ(second + second.substr(0, 10), unparsed);
+
+    HttpResponseJson response2;
+    HttpResponseParser parser2(response2);
+    ASSERT_NO_THROW(parser2.initModel());
+    parser2.postBuffer(&unparsed[0], unparsed.size());
+    ASSERT_NO_THROW(parser2.poll());
+    ASSERT_TRUE(parser2.httpParseOk());
+    ASSERT_NO_THROW(response2.finalize());
+    EXPECT_EQ(2, response2.getJsonElement("sequence")->intValue());
+    EXPECT_EQ(second.substr(0, 10), parser2.getUnparsedData());
+}
+
 // This test verifies that LWS is parsed correctly. The LWS (linear white
 // space) marks line breaks in the HTTP header values.
 TEST_F(HttpResponseParserTest, getLWS) {
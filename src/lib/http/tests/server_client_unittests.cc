@@ -26,6 +26,7 @@
 #include <list>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace boost::asio::ip;
 using namespace isc::asiolink;
@@ -1003,6 +1004,65 @@ public:
         EXPECT_NE(sequence1->intValue(), sequence2->intValue());
     }
 
+    /// @brief Test that several requests to the same URL are sent over
+    /// a pool of connections.
+    ///
+    /// Each response must carry the sequence number of the request.
+    ///
+    /// @param max_url_connections Maximum number of connections per URL.
+    /// @param pipeline_depth Maximum number of requests in progress over a
+    /// connection.
+    /// @param [out] stats Statistics collected after sending the requests.
+    /// @param [out] stats_done Statistics collected after receiving the
+    /// responses.
+    void testConnectionPool(const size_t max_url_connections,
+                            const size_t pipeline_depth,
+                            HttpClient::Statistics& stats,
+                            HttpClient::Statistics& stats_done) {
+        // Start the server.
+        ASSERT_NO_THROW(listener_.start());
+
+        HttpClient client(io_service_, max_url_connections, pipeline_depth);
+        Url url("http://127.0.0.1:18123");
+
+        const int requests_num = 6;
+        std::vector<HttpResponseJsonPtr> responses;
+        int resp_num = 0;
+        for (int i = 0; i < requests_num; ++i) {
+            PostHttpRequestJsonPtr request = createRequest("sequence", i);
+            HttpResponseJsonPtr response(new HttpResponseJson());
+            responses.push_back(response);
+            ASSERT_NO_THROW(client.asyncSendRequest(url, request, response,
+                [this, &resp_num](const boost::system::error_code& ec,
+                                  const HttpResponsePtr&,
+                                  const std::string&) {
+                if (++resp_num >= requests_num) {
+                    io_service_.stop();
+                }
+                EXPECT_FALSE(ec);
+            }));
+        }
+
+        // Check the requests in progress before any is completed.
+        stats = client.getStatistics(url);
+        EXPECT_EQ(requests_num, stats.in_progress_ + stats.queued_);
+
+        ASSERT_NO_THROW(runIOService());
+        EXPECT_EQ(requests_num, resp_num);
+
+        // Each response must match its request.
+        for (int i = 0; i < requests_num; ++i) {
+            ConstElementPtr sequence = responses[i]->getJsonElement("sequence");
+            ASSERT_TRUE(sequence);
+            EXPECT_EQ(i, sequence->intValue());
+        }
+
+        stats_done = client.getStatistics(url);
+        EXPECT_EQ(0, stats_done.in_progress_);
+        EXPECT_EQ(0, stats_done.queued_);
+        EXPECT_EQ(stats.connections_, stats_done.connections_);
+    }
+
     /// @brief Instance of the listener used in the tests.
     HttpListener listener_;
 
@@ -1084,6 +1144,54 @@ TEST_F(HttpClientTest, multipleDestinations) {
     EXPECT_NE(sequence1->intValue(), sequence2->intValue());
 }
 
+// Test that invalid connection pool parameters are rejected.
+TEST_F(HttpClientTest, invalidPoolParameters) {
+    EXPECT_THROW(HttpClient(io_service_, 0), HttpClientError);
+    EXPECT_THROW(HttpClient(io_service_, 1, 0), HttpClientError);
+    EXPECT_THROW(HttpClient(io_service_, 1, 1, -1), HttpClientError);
+    EXPECT_NO_THROW(HttpClient(io_service_, 4, 8, 1000));
+}
+
+// Test that requests to the same URL are queued with a single connection.
+TEST_F(HttpClientTest, singleConnection) {
+    HttpClient::Statistics stats;
+    HttpClient::Statistics stats_done;
+    ASSERT_NO_FATAL_FAILURE(testConnectionPool(1, 1, stats, stats_done));
+    EXPECT_EQ(1, stats.connections_);
+    EXPECT_EQ(1, stats.in_progress_);
+    EXPECT_EQ(5, stats.queued_);
+    EXPECT_EQ(5, stats.max_queued_);
+    EXPECT_EQ(0, stats_done.pipelined_);
+}
+
+// Test that requests to the same URL are sent over several connections.
+TEST_F(HttpClientTest, multipleConnections) {
+    HttpClient::Statistics stats;
+    HttpClient::Statistics stats_done;
+    ASSERT_NO_FATAL_FAILURE(testConnectionPool(3, 1, stats, stats_done));
+    EXPECT_EQ(3, stats.connections_);
+    EXPECT_EQ(3, stats.in_progress_);
+    EXPECT_EQ(3, stats.queued_);
+    EXPECT_EQ(3, stats_done.max_queued_);
+    EXPECT_EQ(0, stats_done.pipelined_);
+}
+
+// Test that requests to the same URL are pipelined and the responses are
+// matched with the requests.
+TEST_F(HttpClientTest, pipelining) {
+    HttpClient::Statistics stats;
+    HttpClient::Statistics stats_done;
+    ASSERT_NO_FATAL_FAILURE(testConnectionPool(1, 4, stats, stats_done));
+    EXPECT_EQ(1, stats.connections_);
+
+    // The connection is not established yet so nothing is pipelined.
+    EXPECT_EQ(1, stats.in_progress_);
+    EXPECT_EQ(5, stats.queued_);
+
+    // Once established, the queued requests are pipelined.
+    EXPECT_LT(0, stats_done.pipelined_);
+}
+
 // Test that idle connection can be resumed for second request.
 TEST_F(HttpClientTest, idleConnection) {
     // Start the server that has short idle timeout. It closes the idle connection
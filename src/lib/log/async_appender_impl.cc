@@ -0,0 +1,205 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_appender_impl.h>
+
+#include <log4cplus/version.h>
+#include <boost/bind.hpp>
+
+using namespace isc::util::thread;
+
+namespace {
+
+/// Number of events dropped by all asynchronous appenders.
+std::atomic<uint64_t> total_dropped(0);
+
+}
+
+namespace isc {
+namespace log {
+namespace internal {
+
+AsyncAppender::AsyncAppender(const log4cplus::SharedAppenderPtr& appender,
+                             const size_t queue_size,
+                             const OutputOption::Overflow overflow)
+    : appender_(appender), overflow_(overflow), cells_(), mask_(0),
+      enqueue_pos_(0), dequeue_pos_(0), dropped_(0), waiting_(false),
+      full_(false), stopping_(false), mutex_(), cond_var_(),
+      space_cond_var_(), thread_() {
+    size_t cells_num = 2;
+    while (cells_num < queue_size) {
+        cells_num <<= 1;
+    }
+    mask_ = cells_num - 1;
+    cells_.reset(new Cell[cells_num]);
+    for (size_t i = 0; i < cells_num; ++i) {
+        cells_[i].sequence_.store(i);
+    }
+    thread_.reset(new Thread(boost::bind(&AsyncAppender::run, this)));
+}
+
+AsyncAppender::~AsyncAppender() {
+    try {
+        destructorImpl();
+    } catch (...) {
+        // Nothing we can do about it.
+    }
+}
+
+void
+AsyncAppender::close() {
+    if (closed) {
+        return;
+    }
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_.store(true);
+        cond_var_.signal();
+        space_cond_var_.signal();
+    }
+    try {
+        thread_->wait();
+    } catch (...) {
+        // The thread doesn't throw, but the close must go on anyway.
+    }
+    thread_.reset();
+    appender_->close();
+    closed = true;
+}
+
+uint64_t
+AsyncAppender::getTotalDroppedNum() {
+    return (total_dropped.load());
+}
+
+void
+AsyncAppender::append(const log4cplus::spi::InternalLoggingEvent& event) {
+    // The event is cloned while the logging thread is still running so
+    // its thread dependent fields are those of the logging thread.
+#if LOG4CPLUS_VERSION < LOG4CPLUS_MAKE_VERSION(2, 0, 0)
+    std::auto_ptr<log4cplus::spi::InternalLoggingEvent>
+#else
+    std::unique_ptr<log4cplus::spi::InternalLoggingEvent>
+#endif
+        event_aptr = event.clone();
+    LogEventPtr event_ptr(event_aptr.release());
+
+    if (!push(event_ptr)) {
+        if (overflow_ == OutputOption::OVERFLOW_DROP) {
+            ++dropped_;
+            ++total_dropped;
+            return;
+        }
+
+        // Wait for the background thread to write some events. The flag
+        // is set before trying again and the background thread checks it
+        // after freeing a cell, so one of us sees the other's change.
+        Mutex::Locker lock(mutex_);
+        full_.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!push(event_ptr)) {
+            if (stopping_.load()) {
+                full_.store(false);
+                ++dropped_;
+                ++total_dropped;
+                return;
+            }
+            space_cond_var_.wait(mutex_);
+        }
+        full_.store(false);
+    }
+
+    // The background thread sets the flag before checking if the ring
+    // is empty, and we check the flag after publishing the event, so
+    // one of us sees the other's change.
+    if (waiting_.load()) {
+        Mutex::Locker lock(mutex_);
+        cond_var_.signal();
+    }
+}
+
+bool
+AsyncAppender::push(const LogEventPtr& event) {
+    Cell* cell = 0;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        const size_t sequence = cell->sequence_.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            // The cell is free: reserve it.
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                   std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < pos) {
+            // The cell still holds the event added one round ago.
+            return (false);
+        } else {
+            // Another thread has reserved the cell.
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->event_ = event;
+    cell->sequence_.store(pos + 1);
+    return (true);
+}
+
+bool
+AsyncAppender::pop(LogEventPtr& event) {
+    Cell& cell = cells_[dequeue_pos_ & mask_];
+    if (cell.sequence_.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+        return (false);
+    }
+    event.swap(cell.event_);
+    cell.event_.reset();
+    // Free the cell for the next round.
+    cell.sequence_.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    return (true);
+}
+
+bool
+AsyncAppender::ready() const {
+    return (cells_[dequeue_pos_ & mask_].sequence_.load() == dequeue_pos_ + 1);
+}
+
+void
+AsyncAppender::run() {
+    LogEventPtr event;
+    for (;;) {
+        while (pop(event)) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (full_.load()) {
+                Mutex::Locker lock(mutex_);
+                space_cond_var_.signal();
+            }
+            try {
+                appender_->doAppend(*event);
+            } catch (...) {
+                // The appenders report their errors themselves.
+            }
+            event.reset();
+        }
+
+        Mutex::Locker lock(mutex_);
+        waiting_.store(true);
+        if (!ready()) {
+            if (stopping_.load()) {
+                // Everything added before the close has been written.
+                waiting_.store(false);
+                return;
+            }
+            cond_var_.wait(mutex_);
+        }
+        waiting_.store(false);
+    }
+}
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
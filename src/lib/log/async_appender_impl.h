@@ -0,0 +1,177 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LOG_ASYNC_APPENDER_H
+#define LOG_ASYNC_APPENDER_H
+
+#include <log/output_option.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <log4cplus/appender.h>
+#include <log4cplus/spi/loggingevent.h>
+#include <boost/scoped_array.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <stdint.h>
+
+namespace isc {
+namespace log {
+namespace internal {
+
+/// \brief Asynchronous Logger Appender
+///
+/// This class can be set as an Appender for log4cplus loggers in place
+/// of a console, file or syslog appender. It copies the logging events
+/// into a bounded ring and a background thread passes them to the
+/// wrapped appender, so a slow disk or a blocked syslog daemon doesn't
+/// stall the threads which log.
+///
+/// The ring is lock-free: the logging threads reserve a cell with a
+/// compare-and-swap on the enqueue position and publish the event by
+/// setting the sequence number of the cell, the background thread is
+/// the only consumer. The background thread sleeps on a condition
+/// variable when the ring is empty and is only signalled when it sleeps.
+///
+/// Note that log4cplus::Appender::doAppend takes the mutex of the
+/// appender before calling append(), so the logging threads still
+/// serialize on that mutex while an event is cloned and added to the
+/// ring. What the ring saves them is the wait for the write itself,
+/// which is done by the background thread under the mutex of the
+/// wrapped appender.
+///
+/// When the ring is full the event is either dropped and counted, or the
+/// logging thread sleeps on a second condition variable until the
+/// background thread has made room, depending on the overflow policy.
+class AsyncAppender : public log4cplus::Appender {
+public:
+    /// \brief Constructor
+    ///
+    /// Starts the background thread.
+    ///
+    /// \param appender Appender writing the events.
+    /// \param queue_size Number of events held by the ring, rounded up to
+    ///        a power of two.
+    /// \param overflow What to do with an event when the ring is full.
+    AsyncAppender(const log4cplus::SharedAppenderPtr& appender,
+                  const size_t queue_size,
+                  const OutputOption::Overflow overflow);
+
+    /// \brief Destructor
+    ///
+    /// Writes the remaining events and stops the background thread.
+    virtual ~AsyncAppender();
+
+    /// \brief Close the appender
+    ///
+    /// Waits for the background thread to write the events held by the
+    /// ring, stops it and closes the wrapped appender.
+    virtual void close();
+
+    /// \brief Returns the number of events dropped by this appender.
+    uint64_t getDroppedNum() const {
+        return (dropped_.load());
+    }
+
+    /// \brief Returns the number of events dropped by all asynchronous
+    ///        appenders since the program started.
+    static uint64_t getTotalDroppedNum();
+
+protected:
+    /// \brief Copies an event into the ring.
+    ///
+    /// \param event Event to be written.
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event);
+
+private:
+    /// Convenience typedef for a pointer to a log event
+    typedef boost::shared_ptr<log4cplus::spi::InternalLoggingEvent>
+        LogEventPtr;
+
+    /// \brief Cell of the ring
+    struct Cell {
+        /// Equal to the enqueue position when the cell is free and to the
+        /// enqueue position plus one when it holds an event.
+        std::atomic<size_t> sequence_;
+
+        /// Event held by the cell.
+        LogEventPtr event_;
+    };
+
+    /// \brief Adds an event to the ring.
+    ///
+    /// \param event Event to be added.
+    /// \return false if the ring is full.
+    bool push(const LogEventPtr& event);
+
+    /// \brief Removes the oldest event from the ring.
+    ///
+    /// Called by the background thread only.
+    ///
+    /// \param [out] event Removed event.
+    /// \return false if the ring is empty.
+    bool pop(LogEventPtr& event);
+
+    /// \brief Checks if the ring holds an event ready to be removed.
+    bool ready() const;
+
+    /// \brief Main function of the background thread.
+    void run();
+
+    /// \brief Appender writing the events.
+    log4cplus::SharedAppenderPtr appender_;
+
+    /// \brief Overflow policy.
+    OutputOption::Overflow overflow_;
+
+    /// \brief Cells of the ring.
+    boost::scoped_array<Cell> cells_;
+
+    /// \brief Number of cells minus one.
+    size_t mask_;
+
+    /// \brief Position of the next event added.
+    std::atomic<size_t> enqueue_pos_;
+
+    /// \brief Position of the next event removed.
+    size_t dequeue_pos_;
+
+    /// \brief Number of events dropped because the ring was full.
+    std::atomic<uint64_t> dropped_;
+
+    /// \brief Set when the background thread sleeps or is about to.
+    std::atomic<bool> waiting_;
+
+    /// \brief Set when a logging thread sleeps because the ring is full
+    ///        or is about to.
+    ///
+    /// A flag is enough as append() is serialized by the appender mutex.
+    std::atomic<bool> full_;
+
+    /// \brief Set when the background thread must terminate.
+    std::atomic<bool> stopping_;
+
+    /// \brief Protects the sleeps of the background and logging threads.
+    isc::util::thread::Mutex mutex_;
+
+    /// \brief Signalled when an event is added or the appender is closed.
+    isc::util::thread::CondVar cond_var_;
+
+    /// \brief Signalled when an event is removed from a full ring or the
+    ///        appender is closed.
+    isc::util::thread::CondVar space_cond_var_;
+
+    /// \brief Background thread.
+    boost::scoped_ptr<isc::util::thread::Thread> thread_;
+};
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
+
+#endif // LOG_ASYNC_APPENDER_H
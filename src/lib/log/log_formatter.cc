@@ -8,6 +8,7 @@
 #include <log/log_formatter.h>
 
 #include <cassert>
+#include <cstring>
 
 #ifdef ENABLE_LOGGER_CHECKS
 #include <iostream>
@@ -45,6 +46,170 @@ replacePlaceholder(string* message, const string& arg,
 #endif /* ENABLE_LOGGER_CHECKS */
 }
 
+const size_t FormatArgs::INLINE_ARGS;
+const size_t FormatArgs::INLINE_TEXT;
+
+FormatArgs::FormatArgs()
+    : overflow_args_(), size_(0), text_size_(0), overflow_text_() {
+}
+
+FormatArgs::Arg&
+FormatArgs::next() {
+    if (size_ < INLINE_ARGS) {
+        return (args_[size_++]);
+    }
+    overflow_args_.push_back(Arg());
+    ++size_;
+    return (overflow_args_.back());
+}
+
+const FormatArgs::Arg&
+FormatArgs::get(const size_t index) const {
+    if (index < INLINE_ARGS) {
+        return (args_[index]);
+    }
+    return (overflow_args_[index - INLINE_ARGS]);
+}
+
+void
+FormatArgs::addSigned(const int64_t value) {
+    Arg& arg = next();
+    arg.type_ = SIGNED;
+    arg.signed_ = value;
+}
+
+void
+FormatArgs::addUnsigned(const uint64_t value) {
+    Arg& arg = next();
+    arg.type_ = UNSIGNED;
+    arg.unsigned_ = value;
+}
+
+void
+FormatArgs::addChar(const char value) {
+    Arg& arg = next();
+    arg.type_ = CHAR;
+    arg.char_ = value;
+}
+
+void
+FormatArgs::addText(const char* text, const size_t length) {
+    Arg& arg = next();
+    arg.type_ = TEXT;
+    arg.text_.length_ = length;
+    if (length <= INLINE_TEXT - text_size_) {
+        arg.text_.offset_ = text_size_;
+        arg.text_.overflow_ = false;
+        memcpy(text_ + text_size_, text, length);
+        text_size_ += length;
+    } else {
+        arg.text_.offset_ = overflow_text_.size();
+        arg.text_.overflow_ = true;
+        overflow_text_.append(text, length);
+    }
+}
+
+void
+FormatArgs::appendTo(const size_t index, string& output) const {
+    const Arg& arg = get(index);
+    // Large enough for the 20 digits of a 64 bit integer and the sign.
+    char digits[24];
+    char* const end = digits + sizeof(digits);
+    char* begin = end;
+    uint64_t value = 0;
+    switch (arg.type_) {
+    case TEXT:
+        if (arg.text_.overflow_) {
+            output.append(overflow_text_, arg.text_.offset_,
+                          arg.text_.length_);
+        } else {
+            output.append(text_ + arg.text_.offset_, arg.text_.length_);
+        }
+        return;
+
+    case CHAR:
+        output.push_back(arg.char_);
+        return;
+
+    case SIGNED:
+        // The negation is done on the unsigned value so it works for the
+        // lowest value too.
+        value = static_cast<uint64_t>(arg.signed_);
+        if (arg.signed_ < 0) {
+            value = ~value + 1;
+        }
+        break;
+
+    case UNSIGNED:
+        value = arg.unsigned_;
+        break;
+    }
+    do {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    if ((arg.type_ == SIGNED) && (arg.signed_ < 0)) {
+        *--begin = '-';
+    }
+    output.append(begin, end - begin);
+}
+
+void
+FormatArgs::clear() {
+    overflow_args_.clear();
+    size_ = 0;
+    text_size_ = 0;
+    overflow_text_.clear();
+}
+
+void
+formatMessage(const MessageTemplate& message_template, const FormatArgs& args,
+              string& output) {
+    const string& text = message_template.getText();
+    output.clear();
+    output.reserve(text.size());
+    const vector<MessageTemplate::Segment>& segments =
+        message_template.getSegments();
+    for (vector<MessageTemplate::Segment>::const_iterator segment =
+             segments.begin(); segment != segments.end(); ++segment) {
+        if ((segment->placeholder_ > 0) &&
+            (segment->placeholder_ <= args.size())) {
+            args.appendTo(segment->placeholder_ - 1, output);
+        } else {
+            output.append(text, segment->offset_, segment->length_);
+        }
+    }
+
+#ifndef ENABLE_LOGGER_CHECKS
+    // The missing placeholders have been rejected by the Formatter when
+    // the checks are enabled, so complain about them only when they are not.
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (!message_template.hasPlaceholder(i + 1)) {
+            output.append(" @@Missing placeholder %" +
+                          lexical_cast<string>(i + 1) + " for '");
+            args.appendTo(i, output);
+            output.append("'@@");
+        }
+    }
+#endif /* ENABLE_LOGGER_CHECKS */
+
+    if (message_template.hasPlaceholder(args.size() + 1)) {
+        // Excess placeholders were found, see checkExcessPlaceholders.
+#ifdef ENABLE_LOGGER_CHECKS
+        cerr << "Message " << output << endl;
+        assert("Excess logger placeholders still exist in message" == NULL);
+#else
+        output.append(" @@Excess logger placeholders still exist@@");
+#endif /* ENABLE_LOGGER_CHECKS */
+    }
+}
+
+string&
+getFormatBuffer() {
+    static thread_local string buffer;
+    return (buffer);
+}
+
 void
 checkExcessPlaceholders(string* message, unsigned int placeholder) {
     const string mark("%" + lexical_cast<string>(placeholder));
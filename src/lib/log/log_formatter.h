@@ -13,7 +13,15 @@
 
 #include <exceptions/exceptions.h>
 #include <boost/lexical_cast.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
 #include <log/logger_level.h>
+#include <log/message_template.h>
+
+#include <stdint.h>
+#include <vector>
 
 namespace isc {
 namespace log {
@@ -62,6 +70,138 @@ void
 replacePlaceholder(std::string* message, const std::string& replacement,
                    const unsigned placeholder);
 
+///
+/// \brief Arguments of a log message
+///
+/// This is used internally by the Formatter to keep the arguments until
+/// the message is output. The integers are kept in their binary form and
+/// converted to text only when the message is formatted, the text of the
+/// other arguments is copied into an inline buffer, so the usual messages
+/// don't need any memory allocation.
+class FormatArgs {
+public:
+    /// \brief Number of arguments held without memory allocation.
+    static const size_t INLINE_ARGS = 8;
+
+    /// \brief Size of the text held without memory allocation.
+    static const size_t INLINE_TEXT = 256;
+
+    /// \brief Constructor
+    FormatArgs();
+
+    /// \brief Adds a signed integer.
+    void addSigned(const int64_t value);
+
+    /// \brief Adds an unsigned integer.
+    void addUnsigned(const uint64_t value);
+
+    /// \brief Adds a character.
+    void addChar(const char value);
+
+    /// \brief Adds a text.
+    ///
+    /// \param text Text, copied.
+    /// \param length Length of the text.
+    void addText(const char* text, const size_t length);
+
+    /// \brief Returns the number of arguments.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// \brief Appends the text of an argument to a string.
+    ///
+    /// \param index Index of the argument, from 0.
+    /// \param [out] output String the text is appended to.
+    void appendTo(const size_t index, std::string& output) const;
+
+    /// \brief Removes all arguments.
+    void clear();
+
+private:
+    /// \brief Kind of argument
+    enum Type {
+        SIGNED,
+        UNSIGNED,
+        CHAR,
+        TEXT
+    };
+
+    /// \brief Location of a text
+    struct Text {
+        /// Offset in the inline buffer or in the overflow text.
+        size_t offset_;
+
+        /// Length of the text.
+        size_t length_;
+
+        /// True if the text is in the overflow text.
+        bool overflow_;
+    };
+
+    /// \brief Argument
+    struct Arg {
+        /// Kind of the argument.
+        Type type_;
+
+        /// Value of the argument.
+        union {
+            int64_t signed_;
+            uint64_t unsigned_;
+            char char_;
+            Text text_;
+        };
+    };
+
+    /// \brief Returns the argument to be set by the add methods.
+    Arg& next();
+
+    /// \brief Returns an argument.
+    const Arg& get(const size_t index) const;
+
+    /// \brief Arguments held inline.
+    Arg args_[INLINE_ARGS];
+
+    /// \brief Arguments beyond the inline ones.
+    std::vector<Arg> overflow_args_;
+
+    /// \brief Number of arguments.
+    size_t size_;
+
+    /// \brief Text of the arguments held inline.
+    char text_[INLINE_TEXT];
+
+    /// \brief Used size of the inline text buffer.
+    size_t text_size_;
+
+    /// \brief Text of the arguments which don't fit in the inline buffer.
+    std::string overflow_text_;
+};
+
+///
+/// \brief The internal formatting routine
+///
+/// This is used internally by the Formatter. Replaces the placeholders of
+/// a message with the arguments. The arguments which have no placeholder
+/// and the placeholders which have no argument are reported at the end of
+/// the message.
+///
+/// \param message_template Parsed message.
+/// \param args Arguments.
+/// \param [out] output Formatted message, the previous content is replaced.
+void
+formatMessage(const MessageTemplate& message_template, const FormatArgs& args,
+              std::string& output);
+
+///
+/// \brief Returns the buffer the messages are formatted into
+///
+/// This is used internally by the Formatter. Each thread has its own
+/// buffer which keeps its capacity, so formatting a message doesn't
+/// allocate memory once the buffer has grown to the size of the longest
+/// message.
+std::string& getFormatBuffer();
+
 ///
 /// \brief The log message formatter
 ///
@@ -84,6 +224,11 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// Of course, if the logging is turned off, we don't bother with any replacing
 /// and just return.
 ///
+/// The arguments are not converted when .arg is called but kept in the
+/// Formatter, integers in their binary form, and the message is formatted
+/// once when it is output, from the message text parsed when it was added
+/// to the dictionary.
+///
 /// User of logging code should not really care much about this class, only
 /// call the .arg method to generate the correct output.
 ///
@@ -109,11 +254,11 @@ private:
     /// \brief Message severity
     Severity severity_;
 
-    /// \brief The messages with %1, %2... placeholders
-    std::string* message_;
+    /// \brief The message with %1, %2... placeholders
+    MessageTemplatePtr message_;
 
-    /// \brief Which will be the next placeholder to replace
-    unsigned nextPlaceholder_;
+    /// \brief The arguments replacing the placeholders
+    FormatArgs args_;
 
 
 public:
@@ -127,14 +272,38 @@ public:
     ///
     /// \param severity The severity of the message (DEBUG, ERROR etc.)
     /// \param message The message with placeholders. We take ownership of
-    ///     it and we will modify the string. Must not be NULL unless
-    ///     logger is also NULL, but it's not checked.
+    ///     it. Must not be NULL unless logger is also NULL, but it's not
+    ///     checked.
     /// \param logger The logger where the final output will go, or NULL
     ///     if no output is wanted.
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
               Logger* logger = NULL) :
-        logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        logger_(logger), severity_(severity), message_(), args_()
+    {
+        if (message) {
+            try {
+                if (logger_) {
+                    message_.reset(new MessageTemplate(*message));
+                }
+            } catch (...) {
+                logger_ = NULL;
+            }
+            delete message;
+        }
+    }
+
+    /// \brief Constructor of "active" formatter from a parsed message
+    ///
+    /// This is the constructor used by the loggers.
+    ///
+    /// \param severity The severity of the message (DEBUG, ERROR etc.)
+    /// \param message The parsed message with placeholders. Must not be
+    ///     NULL unless logger is also NULL, but it's not checked.
+    /// \param logger The logger where the final output will go, or NULL
+    ///     if no output is wanted.
+    Formatter(const Severity& severity, const MessageTemplatePtr& message,
+              Logger* logger) :
+        logger_(logger), severity_(severity), message_(message), args_()
     {
     }
 
@@ -145,7 +314,7 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        message_(other.message_), args_(other.args_)
     {
         other.logger_ = NULL;
     }
@@ -156,12 +325,12 @@ public:
     ~ Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(message_, ++nextPlaceholder_);
-                logger_->output(severity_, *message_);
+                std::string& output = getFormatBuffer();
+                formatMessage(*message_, args_, output);
+                logger_->output(severity_, output);
             } catch (...) {
                 // Catch and ignore all exceptions here.
             }
-            delete message_;
         }
     }
 
@@ -174,7 +343,7 @@ public:
             logger_ = other.logger_;
             severity_ = other.severity_;
             message_ = other.message_;
-            nextPlaceholder_ = other.nextPlaceholder_;
+            args_ = other.args_;
             other.logger_ = NULL;
         }
 
@@ -187,29 +356,16 @@ public:
     /// Deactivates the current formatter. In case the formatter is not active,
     /// only produces another inactive formatter.
     ///
+    /// The integers are kept as they are and converted when the message
+    /// is output, the other values are converted to text right away.
+    ///
     /// \param value The argument to place into the placeholder.
     template<class Arg> Formatter& arg(const Arg& value) {
         if (logger_) {
-            try {
-                return (arg(boost::lexical_cast<std::string>(value)));
-            } catch (const boost::bad_lexical_cast& ex) {
-                // The formatting of the log message got wrong, we don't want
-                // to output it.
-                deactivate();
-                // A bad_lexical_cast during a conversion to a string is
-                // *extremely* unlikely to fail.  However, there is nothing
-                // in the documentation that rules it out, so we need to handle
-                // it.  As it is a potentially very serious problem, throw the
-                // exception detailing the problem with as much information as
-                // we can.  (Note that this does not include 'value' -
-                // boost::lexical_cast failed to convert it to a string, so an
-                // attempt to do so here would probably fail as well.)
-                isc_throw(FormatFailure, "bad_lexical_cast in call to "
-                          "Formatter::arg(): " << ex.what());
-            }
-        } else {
-            return (*this);
+            checkPlaceholder();
+            addArg(value, boost::is_integral<Arg>());
         }
+        return (*this);
     }
 
     /// \brief String version of arg.
@@ -217,26 +373,22 @@ public:
     /// \param arg The text to place into the placeholder.
     Formatter& arg(const std::string& arg) {
         if (logger_) {
-            // Note that this method does a replacement and returns the
-            // modified string. If there are multiple invocations of arg() (e.g.
-            // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
-            // operates on the string returned by the previous one. This
-            // sequential operation means that if we had a message like "%1 %2",
-            // and called .arg("%2").arg(42), we would get "42 42"; the first
-            // call replaces the %1" with "%2" and the second replaces all
-            // occurrences of "%2" with 42. (Conversely, the sequence
-            // .arg(42).arg("%1") would return "42 %1" - there are no recursive
-            // replacements).
-            try {
-                replacePlaceholder(message_, arg, ++nextPlaceholder_ );
-            }
-            catch (...) {
-                // Something went wrong here, the log message is broken, so
-                // we don't want to output it, nor we want to check all the
-                // placeholders were used (because they won't be).
-                deactivate();
-                throw;
-            }
+            // Unlike the placeholders of the message, the placeholders
+            // which may appear in the arguments are never replaced: with a
+            // message "%1 %2", .arg("%2").arg(42) produces "%2 42".
+            checkPlaceholder();
+            args_.addText(arg.data(), arg.size());
+        }
+        return (*this);
+    }
+
+    /// \brief C string version of arg.
+    ///
+    /// \param arg The text to place into the placeholder.
+    Formatter& arg(const char* arg) {
+        if (logger_) {
+            checkPlaceholder();
+            args_.addText(arg, std::char_traits<char>::length(arg));
         }
         return (*this);
     }
@@ -251,13 +403,71 @@ public:
     /// the arguments for the message.
     void deactivate() {
         if (logger_) {
-            delete message_;
-            message_ = NULL;
+            message_.reset();
+            args_.clear();
             logger_ = NULL;
         }
     }
-};
 
+private:
+    /// \brief Checks the message has a placeholder for the next argument.
+    ///
+    /// When the logger checks are enabled and the placeholder is missing,
+    /// deactivates the formatter and throws MismatchedPlaceholders.
+    /// Otherwise the missing placeholder is reported in the output.
+    void checkPlaceholder() {
+#ifdef ENABLE_LOGGER_CHECKS
+        if (!message_->hasPlaceholder(args_.size() + 1)) {
+            const std::string text(message_->getText());
+            deactivate();
+            isc_throw(MismatchedPlaceholders,
+                      "Missing logger placeholder in message: " << text);
+        }
+#endif /* ENABLE_LOGGER_CHECKS */
+    }
+
+    /// \brief Adds an integer argument.
+    ///
+    /// The character types are output as characters, like
+    /// boost::lexical_cast does, and the other ones as numbers.
+    ///
+    /// \param value The argument.
+    template<class Arg> void addArg(const Arg& value, boost::true_type) {
+        if ((sizeof(Arg) == 1) && !boost::is_same<Arg, bool>::value) {
+            args_.addChar(static_cast<char>(value));
+        } else if (boost::is_signed<Arg>::value) {
+            args_.addSigned(static_cast<int64_t>(value));
+        } else {
+            args_.addUnsigned(static_cast<uint64_t>(value));
+        }
+    }
+
+    /// \brief Adds an argument of any other type.
+    ///
+    /// The argument is converted to text with boost::lexical_cast.
+    ///
+    /// \param value The argument.
+    template<class Arg> void addArg(const Arg& value, boost::false_type) {
+        try {
+            const std::string text(boost::lexical_cast<std::string>(value));
+            args_.addText(text.data(), text.size());
+        } catch (const boost::bad_lexical_cast& ex) {
+            // The formatting of the log message got wrong, we don't want
+            // to output it.
+            deactivate();
+            // A bad_lexical_cast during a conversion to a string is
+            // *extremely* unlikely to fail.  However, there is nothing
+            // in the documentation that rules it out, so we need to handle
+            // it.  As it is a potentially very serious problem, throw the
+            // exception detailing the problem with as much information as
+            // we can.  (Note that this does not include 'value' -
+            // boost::lexical_cast failed to convert it to a string, so an
+            // attempt to do so here would probably fail as well.)
+            isc_throw(FormatFailure, "bad_lexical_cast in call to "
+                      "Formatter::arg(): " << ex.what());
+        }
+    }
+};
 }
 }
 
@@ -127,11 +127,10 @@ LoggerImpl::getEffectiveDebugLevel() {
 }
 
 
-// Output a general message
-string*
-LoggerImpl::lookupMessage(const MessageID& ident) {
-    return (new string(string(ident) + " " +
-                       MessageDictionary::globalDictionary()->getText(ident)));
+// Look up the parsed message
+MessageTemplatePtr
+LoggerImpl::lookupTemplate(const MessageID& ident) {
+    return (MessageDictionary::globalDictionary()->getTemplate(ident));
 }
 
 // Replace the interprocess synchronization object
@@ -164,23 +163,23 @@ LoggerImpl::outputRaw(const Severity& severity, const string& message) {
 
     switch (severity) {
         case DEBUG:
-            LOG4CPLUS_DEBUG(logger_, message);
+            LOG4CPLUS_DEBUG_STR(logger_, message);
             break;
 
         case INFO:
-            LOG4CPLUS_INFO(logger_, message);
+            LOG4CPLUS_INFO_STR(logger_, message);
             break;
 
         case WARN:
-            LOG4CPLUS_WARN(logger_, message);
+            LOG4CPLUS_WARN_STR(logger_, message);
             break;
 
         case ERROR:
-            LOG4CPLUS_ERROR(logger_, message);
+            LOG4CPLUS_ERROR_STR(logger_, message);
             break;
 
         case FATAL:
-            LOG4CPLUS_FATAL(logger_, message);
+            LOG4CPLUS_FATAL_STR(logger_, message);
             break;
 
         case NONE:
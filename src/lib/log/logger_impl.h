@@ -23,6 +23,7 @@
 
 // Kea logger files
 #include <log/logger_level_impl.h>
+#include <log/message_template.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync.h>
 
@@ -160,10 +161,11 @@ public:
     /// \param message Text of the message.
     void outputRaw(const Severity& severity, const std::string& message);
 
-    /// \brief Look up message text in dictionary
+    /// \brief Look up message template in dictionary
     ///
-    /// This gets you the unformatted text of message for given ID.
-    std::string* lookupMessage(const MessageID& id);
+    /// This gets you the parsed text of message for given ID, prefixed
+    /// by the ID.
+    MessageTemplatePtr lookupTemplate(const MessageID& id);
 
     /// \brief Replace the interprocess synchronization object
     ///
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <log/async_appender_impl.h>
 #include <log/logger.h>
 #include <log/logger_manager.h>
 #include <log/logger_manager_impl.h>
@@ -202,5 +203,10 @@ LoggerManager::getMutex() {
     return (mutex);
 }
 
+uint64_t
+LoggerManager::getDroppedMessagesNum() {
+    return (internal::AsyncAppender::getTotalDroppedNum());
+}
+
 } // namespace log
 } // namespace isc
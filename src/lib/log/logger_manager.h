@@ -140,6 +140,12 @@ public:
     /// calls.
     static isc::util::thread::Mutex& getMutex();
 
+    /// \brief Return the number of log messages dropped because the
+    /// queue of an asynchronous output was full.
+    ///
+    /// \return number of messages dropped since the program started.
+    static uint64_t getDroppedMessagesNum();
+
 private:
     /// \brief Initialize Processing
     ///
@@ -26,6 +26,7 @@
 #include <log/log_messages.h>
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
+#include <log/async_appender_impl.h>
 #include <log/buffer_appender_impl.h>
 
 #include <boost/lexical_cast.hpp>
@@ -112,7 +113,7 @@ LoggerManagerImpl::createConsoleAppender(log4cplus::Logger& logger,
         new log4cplus::ConsoleAppender(
             (opt.stream == OutputOption::STR_STDERR), opt.flush));
     setConsoleAppenderLayout(console);
-    logger.addAppender(console);
+    addAppender(logger, console, opt);
 }
 
 // File appender.  Depending on whether a maximum size is given, either
@@ -148,7 +149,23 @@ LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
 
     // use the same console layout for the files.
     setConsoleAppenderLayout(fileapp);
-    logger.addAppender(fileapp);
+    addAppender(logger, fileapp, opt);
+}
+
+void
+LoggerManagerImpl::addAppender(log4cplus::Logger& logger,
+                               const log4cplus::SharedAppenderPtr& appender,
+                               const OutputOption& opt)
+{
+    if (!opt.async) {
+        logger.addAppender(appender);
+        return;
+    }
+    // The layout of the wrapped appender is used, as the events are
+    // passed to it unchanged.
+    log4cplus::SharedAppenderPtr asyncapp(
+        new internal::AsyncAppender(appender, opt.queue_size, opt.overflow));
+    logger.addAppender(asyncapp);
 }
 
 void
@@ -172,7 +189,7 @@ LoggerManagerImpl::createSyslogAppender(log4cplus::Logger& logger,
     log4cplus::SharedAppenderPtr syslogapp(
         new log4cplus::SysLogAppender(properties));
     setSyslogAppenderLayout(syslogapp);
-    logger.addAppender(syslogapp);
+    addAppender(logger, syslogapp, opt);
 }
 
 
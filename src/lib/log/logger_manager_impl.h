@@ -125,6 +125,19 @@ private:
     static void createSyslogAppender(log4cplus::Logger& logger,
                                      const OutputOption& opt);
 
+    /// \brief Attach an appender to a logger
+    ///
+    /// If the output is asynchronous, the appender is wrapped in an
+    /// appender which queues the log events and writes them from a
+    /// background thread.
+    ///
+    /// \param logger Log4cplus logger to which the appender must be attached.
+    /// \param appender Appender writing to the output.
+    /// \param opt Output options for this appender.
+    static void addAppender(log4cplus::Logger& logger,
+                            const log4cplus::SharedAppenderPtr& appender,
+                            const OutputOption& opt);
+
     /// \brief Create buffered appender
     ///
     /// Appends an object to the logger that will store the log events sent
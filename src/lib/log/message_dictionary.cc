@@ -17,7 +17,8 @@ namespace log {
 
 // Constructor
 
-MessageDictionary::MessageDictionary() : dictionary_(), empty_("") {
+MessageDictionary::MessageDictionary()
+    : dictionary_(), templates_(), empty_("") {
 }
 
 // (Virtual) Destructor
@@ -35,6 +36,7 @@ MessageDictionary::add(const std::string& ident, const std::string& text) {
 
         // Message not already in the dictionary, so add it.
         dictionary_[ident] = text;
+        templates_[ident].reset(new MessageTemplate(ident + " " + text));
     }
 
     return (not_found);
@@ -50,6 +52,7 @@ MessageDictionary::replace(const std::string& ident, const std::string& text) {
 
         // Exists, so replace it.
         dictionary_[ident] = text;
+        templates_[ident].reset(new MessageTemplate(ident + " " + text));
     }
 
     return (found);
@@ -62,6 +65,7 @@ MessageDictionary::erase(const std::string& ident, const std::string& text) {
     bool found = (mes != dictionary_.end() && (mes->second == text));
     if (found) {
         dictionary_.erase(mes);
+        templates_.erase(ident);
     }
     return (found);
 }
@@ -107,6 +111,18 @@ MessageDictionary::getText(const std::string& ident) const {
     }
 }
 
+// Return the parsed message. The template is shared, so it remains valid
+// when the message is replaced while it is being formatted.
+
+MessageTemplatePtr
+MessageDictionary::getTemplate(const std::string& ident) const {
+    Templates::const_iterator i = templates_.find(ident);
+    if (i == templates_.end()) {
+        return (MessageTemplatePtr(new MessageTemplate(ident + " ")));
+    }
+    return (i->second);
+}
+
 // Return global dictionary
 
 const MessageDictionaryPtr&
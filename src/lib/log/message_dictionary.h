@@ -15,6 +15,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <log/message_template.h>
 #include <log/message_types.h>
 
 namespace isc {
@@ -43,6 +44,10 @@ typedef boost::shared_ptr<MessageDictionary> MessageDictionaryPtr;
 ///
 /// Although the class can be used stand-alone, it does supply a static method
 /// to return a particular instance - the "global" dictionary.
+///
+/// The text of each message, prefixed by its ID, is also parsed into a
+/// \c MessageTemplate when it is added or replaced, so the loggers format
+/// the messages without searching for the placeholders.
 
 class MessageDictionary {
 public:
@@ -170,6 +175,31 @@ public:
     virtual const std::string& getText(const std::string& ident) const;
 
 
+    /// \brief Get Message Template
+    ///
+    /// Given an ID, retrieve the parsed text of the message prefixed by
+    /// its ID, as it is output by the loggers.
+    ///
+    /// \param ident Message identification
+    ///
+    /// \return Template of the message, or of the ID alone if the ID is not
+    /// recognized.
+    MessageTemplatePtr getTemplate(const MessageID& ident) const {
+        return (getTemplate(std::string(ident)));
+    }
+
+
+    /// \brief Get Message Template
+    ///
+    /// Alternate signature.
+    ///
+    /// \param ident Message identification
+    ///
+    /// \return Template of the message, or of the ID alone if the ID is not
+    /// recognized.
+    MessageTemplatePtr getTemplate(const std::string& ident) const;
+
+
     /// \brief Number of Items in Dictionary
     ///
     /// \return Number of items in the dictionary
@@ -198,7 +228,11 @@ public:
     static const MessageDictionaryPtr& globalDictionary();
 
 private:
+    /// \brief Parsed messages indexed by ID.
+    typedef std::map<std::string, MessageTemplatePtr> Templates;
+
     Dictionary       dictionary_;   ///< Holds the ID to text lookups
+    Templates        templates_;    ///< Holds the ID to template lookups
     const std::string empty_;       ///< Empty string
 };
 
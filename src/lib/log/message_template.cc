@@ -0,0 +1,53 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/message_template.h>
+
+using namespace std;
+
+namespace isc {
+namespace log {
+
+MessageTemplate::MessageTemplate(const string& text)
+    : text_(text), segments_(), placeholders_() {
+    size_t literal = 0;
+    size_t pos = 0;
+    while ((pos = text_.find('%', pos)) != string::npos) {
+        // A placeholder is a % followed by a number, any other % is
+        // part of the text.
+        size_t end = pos + 1;
+        unsigned placeholder = 0;
+        while ((end < text_.size()) && (text_[end] >= '0') &&
+               (text_[end] <= '9')) {
+            placeholder = placeholder * 10 + (text_[end] - '0');
+            ++end;
+        }
+        if (placeholder == 0) {
+            pos = end;
+            continue;
+        }
+        if (pos > literal) {
+            Segment segment = { literal, pos - literal, 0 };
+            segments_.push_back(segment);
+        }
+        Segment segment = { pos, end - pos, placeholder };
+        segments_.push_back(segment);
+        if (placeholders_.size() <= placeholder) {
+            placeholders_.resize(placeholder + 1, false);
+        }
+        placeholders_[placeholder] = true;
+        literal = pos = end;
+    }
+    if (text_.size() > literal) {
+        Segment segment = { literal, text_.size() - literal, 0 };
+        segments_.push_back(segment);
+    }
+}
+
+} // namespace log
+} // namespace isc
@@ -0,0 +1,79 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MESSAGE_TEMPLATE_H
+#define MESSAGE_TEMPLATE_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Parsed message text
+///
+/// The text of a message is split once, when the message is added to the
+/// dictionary, into literal segments and %1, %2... placeholders, so the
+/// formatter doesn't have to search the placeholders in the text of every
+/// message it outputs.
+class MessageTemplate {
+public:
+    /// \brief Segment of the text
+    struct Segment {
+        /// Offset of the segment in the text.
+        size_t offset_;
+
+        /// Length of the segment, including the % for a placeholder.
+        size_t length_;
+
+        /// Number of the placeholder, 0 for a literal segment.
+        unsigned placeholder_;
+    };
+
+    /// \brief Constructor
+    ///
+    /// \param text Message text with placeholders.
+    explicit MessageTemplate(const std::string& text);
+
+    /// \brief Returns the message text.
+    const std::string& getText() const {
+        return (text_);
+    }
+
+    /// \brief Returns the segments of the text in order.
+    const std::vector<Segment>& getSegments() const {
+        return (segments_);
+    }
+
+    /// \brief Checks if the text contains a placeholder.
+    ///
+    /// \param placeholder Number of the placeholder.
+    bool hasPlaceholder(const unsigned placeholder) const {
+        return ((placeholder < placeholders_.size()) &&
+                placeholders_[placeholder]);
+    }
+
+private:
+    /// \brief Message text.
+    std::string text_;
+
+    /// \brief Segments of the text.
+    std::vector<Segment> segments_;
+
+    /// \brief Indexed by the placeholder number, true when present.
+    std::vector<bool> placeholders_;
+};
+
+/// \brief Shared pointer to a \c MessageTemplate.
+typedef boost::shared_ptr<const MessageTemplate> MessageTemplatePtr;
+
+} // namespace log
+} // namespace isc
+
+#endif // MESSAGE_TEMPLATE_H
@@ -17,6 +17,8 @@
 namespace isc {
 namespace log {
 
+const size_t OutputOption::DEFAULT_QUEUE_SIZE;
+
 OutputOption::Destination
 getDestination(const std::string& dest_str) {
     if (boost::iequals(dest_str, "console")) {
@@ -45,5 +47,18 @@ getStream(const std::string& stream_str) {
     }
 }
 
+OutputOption::Overflow
+getOverflow(const std::string& overflow_str) {
+    if (boost::iequals(overflow_str, "drop")) {
+        return OutputOption::OVERFLOW_DROP;
+    } else if (boost::iequals(overflow_str, "block")) {
+        return OutputOption::OVERFLOW_BLOCK;
+    } else {
+        Logger logger("log");
+        LOG_ERROR(logger, LOG_BAD_OVERFLOW).arg(overflow_str);
+        return OutputOption::OVERFLOW_DROP;
+    }
+}
+
 } // namespace log
 } // namespace isc
@@ -50,10 +50,20 @@ struct OutputOption {
         STR_STDERR = 2
     } Stream;
 
+    /// If asynchronous, what to do with a message when the queue is full
+    typedef enum {
+        OVERFLOW_DROP = 0,              ///< Drop the message and count it
+        OVERFLOW_BLOCK = 1              ///< Wait for room in the queue
+    } Overflow;
+
+    /// Default size of the queue of asynchronous output
+    static const size_t DEFAULT_QUEUE_SIZE = 65536;
+
     /// \brief Constructor
     OutputOption() : destination(DEST_CONSOLE), stream(STR_STDERR),
                      flush(true), facility("LOCAL0"), filename(""),
-                     maxsize(0), maxver(0)
+                     maxsize(0), maxver(0), async(false),
+                     queue_size(DEFAULT_QUEUE_SIZE), overflow(OVERFLOW_DROP)
     {}
 
     /// Members. 
@@ -65,10 +75,14 @@ struct OutputOption {
     std::string     filename;           ///< Filename if file output
     size_t          maxsize;            ///< 0 if no maximum size
     unsigned int    maxver;             ///< Maximum versions (none if <= 0)
+    bool            async;              ///< true to write from a thread
+    size_t          queue_size;         ///< Messages queued if asynchronous
+    Overflow        overflow;           ///< Policy if the queue is full
 };
 
 OutputOption::Destination getDestination(const std::string& dest_str);
 OutputOption::Stream getStream(const std::string& stream_str);
+OutputOption::Overflow getOverflow(const std::string& overflow_str);
 
 
 } // namespace log
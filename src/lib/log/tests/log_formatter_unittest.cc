@@ -12,7 +12,9 @@
 
 #include <log/log_formatter.h>
 #include <log/logger_level.h>
+#include <log/message_template.h>
 
+#include <limits>
 #include <vector>
 #include <string>
 
@@ -90,6 +92,40 @@ TEST_F(FormatterTest, intArg) {
     EXPECT_EQ("The answer is 42", outputs[0].second);
 }
 
+// Integers are output as numbers and characters as characters, like
+// boost::lexical_cast does
+TEST_F(FormatterTest, integerArgs) {
+    Formatter(isc::log::INFO, s("%1 %2 %3 %4 %5 %6 %7 %8"), this).
+        arg(numeric_limits<int64_t>::min()).
+        arg(numeric_limits<uint64_t>::max()).
+        arg(static_cast<int16_t>(-7)).arg(0u).arg(true).
+        arg(static_cast<uint8_t>('a')).arg('b').arg(static_cast<size_t>(42));
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("-9223372036854775808 18446744073709551615 -7 0 1 a b 42",
+              outputs[0].second);
+}
+
+// Messages can be formatted from a parsed template, with more arguments
+// and longer texts than the inline storage of the formatter holds
+TEST_F(FormatterTest, templateArgs) {
+    isc::log::MessageTemplatePtr
+        message(new isc::log::MessageTemplate("%10 %9 %8 %7 %6 %5 %4 %3 %2 %1"));
+    const string text(300, 'x');
+    Formatter(isc::log::WARN, message, this).arg(1).arg("two").arg(3.5).
+        arg(string("four")).arg(text).arg(6).arg(text).arg(8).arg("nine").
+        arg(text);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ(isc::log::WARN, outputs[0].first);
+    EXPECT_EQ(text + " nine 8 " + text + " 6 " + text + " four 3.5 two 1",
+              outputs[0].second);
+
+    // The template is not modified and can be used again.
+    Formatter(isc::log::WARN, message, this).arg(1).arg(2).arg(3).arg(4).
+        arg(5).arg(6).arg(7).arg(8).arg(9).arg(10);
+    ASSERT_EQ(2, outputs.size());
+    EXPECT_EQ("10 9 8 7 6 5 4 3 2 1", outputs[1].second);
+}
+
 // Can use multiple arguments at different places
 TEST_F(FormatterTest, multiArg) {
     Formatter(isc::log::INFO, s("The %2 are %1"), this).arg("switched").
@@ -176,4 +212,11 @@ TEST_F(FormatterTest, noRecurse) {
     EXPECT_EQ("%1 %1", outputs[0].second);
 }
 
+// Test the placeholders of an argument are not replaced by the next ones
+TEST_F(FormatterTest, noSequentialReplace) {
+    Formatter(isc::log::INFO, s("%1 %2"), this).arg("%2").arg(42);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("%2 42", outputs[0].second);
+}
+
 }
@@ -199,6 +199,53 @@ TEST_F(MessageDictionaryTest, Lookups) {
     EXPECT_EQ(string(""), dictionary.getText("\n\n\n"));
 }
 
+// Check that the messages are parsed when they are added and replaced.
+
+TEST_F(MessageDictionaryTest, Templates) {
+    MessageDictionary dictionary;
+    EXPECT_TRUE(dictionary.add("ALPHA", "%1 is 100% %2%1"));
+
+    MessageTemplatePtr alpha = dictionary.getTemplate("ALPHA");
+    ASSERT_TRUE(alpha);
+    EXPECT_EQ("ALPHA %1 is 100% %2%1", alpha->getText());
+    EXPECT_FALSE(alpha->hasPlaceholder(0));
+    EXPECT_TRUE(alpha->hasPlaceholder(1));
+    EXPECT_TRUE(alpha->hasPlaceholder(2));
+    EXPECT_FALSE(alpha->hasPlaceholder(3));
+
+    // The % not followed by a number is part of the text.
+    const vector<MessageTemplate::Segment>& segments = alpha->getSegments();
+    ASSERT_EQ(5, segments.size());
+    EXPECT_EQ(0, segments[0].placeholder_);
+    EXPECT_EQ("ALPHA ", alpha->getText().substr(segments[0].offset_,
+                                                segments[0].length_));
+    EXPECT_EQ(1, segments[1].placeholder_);
+    EXPECT_EQ(0, segments[2].placeholder_);
+    EXPECT_EQ(" is 100% ", alpha->getText().substr(segments[2].offset_,
+                                                   segments[2].length_));
+    EXPECT_EQ(2, segments[3].placeholder_);
+    EXPECT_EQ(1, segments[4].placeholder_);
+
+    // The replaced message is parsed again, the previous template is left
+    // untouched for the formatters still using it.
+    EXPECT_TRUE(dictionary.replace("ALPHA", "This is alpha"));
+    MessageTemplatePtr replaced = dictionary.getTemplate("ALPHA");
+    ASSERT_TRUE(replaced);
+    EXPECT_EQ("ALPHA This is alpha", replaced->getText());
+    EXPECT_EQ(1, replaced->getSegments().size());
+    EXPECT_FALSE(replaced->hasPlaceholder(1));
+    EXPECT_EQ("ALPHA %1 is 100% %2%1", alpha->getText());
+
+    // An unknown message is output as its ID.
+    MessageTemplatePtr unknown = dictionary.getTemplate("XYZZY");
+    ASSERT_TRUE(unknown);
+    EXPECT_EQ("XYZZY ", unknown->getText());
+
+    // The template goes away with the message.
+    EXPECT_TRUE(dictionary.erase("ALPHA", "This is alpha"));
+    EXPECT_EQ("ALPHA ", dictionary.getTemplate("ALPHA")->getText());
+}
+
 // Check that the global dictionary is a singleton.
 
 TEST_F(MessageDictionaryTest, GlobalTest) {
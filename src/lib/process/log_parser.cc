@@ -150,6 +150,36 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
             dest.flush_ = flush_ptr->boolValue();
         }
 
+        isc::data::ConstElementPtr async_ptr = output_option->get("async");
+        if (async_ptr) {
+            dest.async_ = async_ptr->boolValue();
+        }
+
+        isc::data::ConstElementPtr queue_size_ptr =
+            output_option->get("queue-size");
+        if (queue_size_ptr) {
+            int64_t queue_size = queue_size_ptr->intValue();
+            if (queue_size <= 0) {
+                isc_throw(BadValue, "queue-size must be greater than zero ("
+                          << queue_size_ptr->getPosition() << ")");
+            }
+            dest.queue_size_ = static_cast<uint64_t>(queue_size);
+        }
+
+        isc::data::ConstElementPtr overflow_ptr = output_option->get("overflow");
+        if (overflow_ptr) {
+            const std::string overflow = overflow_ptr->stringValue();
+            if (overflow == "drop") {
+                dest.overflow_ = isc::log::OutputOption::OVERFLOW_DROP;
+            } else if (overflow == "block") {
+                dest.overflow_ = isc::log::OutputOption::OVERFLOW_BLOCK;
+            } else {
+                isc_throw(BadValue, "unsupported overflow policy '" << overflow
+                          << "', expected 'drop' or 'block' ("
+                          << overflow_ptr->getPosition() << ")");
+            }
+        }
+
         destination.push_back(dest);
     }
 }
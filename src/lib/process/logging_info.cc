@@ -20,7 +20,10 @@ LoggingDestination::equals(const LoggingDestination& other) const {
     return (output_ == other.output_ &&
             maxver_ == other.maxver_ &&
             maxsize_ == other.maxsize_ &&
-            flush_ == other.flush_);
+            flush_ == other.flush_ &&
+            async_ == other.async_ &&
+            queue_size_ == other.queue_size_ &&
+            overflow_ == other.overflow_);
 }
 
 ElementPtr
@@ -35,6 +38,16 @@ LoggingDestination::toElement() const {
     result->set("maxsize", Element::create(static_cast<long long>(maxsize_)));
     // Set flush
     result->set("flush", Element::create(flush_));
+    // Set asynchronous output parameters if enabled
+    if (async_) {
+        result->set("async", Element::create(async_));
+        result->set("queue-size",
+                    Element::create(static_cast<long long>(queue_size_)));
+        result->set("overflow",
+                    Element::create(std::string(overflow_ ==
+                                                OutputOption::OVERFLOW_BLOCK ?
+                                                "block" : "drop")));
+    }
 
     return(result);
 }
@@ -149,6 +162,11 @@ LoggingInfo::toSpec() const {
         // Copy the immediate flush flag
         option.flush = dest->flush_;
 
+        // Copy the asynchronous output parameters
+        option.async = dest->async_;
+        option.queue_size = static_cast<size_t>(dest->queue_size_);
+        option.overflow = dest->overflow_;
+
         // ... and set the destination
         spec.addOutputOption(option);
     }
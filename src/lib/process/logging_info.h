@@ -38,6 +38,15 @@ public:
     /// @brief Immediate flush
     bool flush_;
 
+    /// @brief Write the messages from a background thread
+    bool async_;
+
+    /// @brief Maximum number of messages queued when asynchronous
+    uint64_t queue_size_;
+
+    /// @brief What to do with a message when the queue is full
+    isc::log::OutputOption::Overflow overflow_;
+
     /// @brief Compares two objects for equality.
     ///
     /// @param other Object to be compared with this object.
@@ -47,7 +56,10 @@ public:
 
     /// @brief Default constructor.
     LoggingDestination()
-        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true) {
+        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true),
+          async_(false),
+          queue_size_(isc::log::OutputOption::DEFAULT_QUEUE_SIZE),
+          overflow_(isc::log::OutputOption::OVERFLOW_DROP) {
     }
 
     /// @brief Unparse a configuration object
@@ -67,7 +79,10 @@ public:
 ///                    "output": "/path/to/the/logfile.log",
 ///                    "maxver": 8,
 ///                    "maxsize": 204800,
-///                    "flush": true
+///                    "flush": true,
+///                    "async": true,
+///                    "queue-size": 65536,
+///                    "overflow": "drop"
 ///                }
 ///            ],
 ///            "severity": "WARN",
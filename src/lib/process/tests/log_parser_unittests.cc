@@ -10,11 +10,14 @@
 #include <process/process_messages.h>
 #include <exceptions/exceptions.h>
 #include <log/logger_support.h>
+#include <log/logger_manager.h>
 #include <process/d_log.h>
 #include <testutils/io_utils.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 using namespace isc;
 using namespace isc::process;
 using namespace isc::data;
@@ -370,6 +373,93 @@ TEST_F(LoggingTest, logRotate) {
     wipeFiles();
 }
 
+// Verifies that the asynchronous output parameters are parsed and that
+// the messages logged to an asynchronous output are written.
+TEST_F(LoggingTest, asyncOutput) {
+    wipeFiles();
+
+    std::ostringstream os;
+    os <<
+        "{ \"loggers\": ["
+        "    {"
+        "        \"name\": \"kea\","
+        "        \"output_options\": ["
+        "            {"
+        "                \"output\": \""
+        << TEST_LOG_NAME << "\","  <<
+        "                \"async\": true,"
+        "                \"queue-size\": 1024,"
+        "                \"overflow\": \"block\""
+        "            }"
+        "        ],"
+        "        \"severity\": \"INFO\""
+        "    }"
+        "]}";
+
+    ConfigPtr server_cfg(new ConfigBase());
+    ConstElementPtr config = Element::fromJSON(os.str());
+    config = config->get("loggers");
+
+    LogConfigParser parser(server_cfg);
+    ASSERT_NO_THROW(parser.parseConfiguration(config));
+
+    ASSERT_EQ(1, server_cfg->getLoggingInfo().size());
+    ASSERT_EQ(1, server_cfg->getLoggingInfo()[0].destinations_.size());
+    const LoggingDestination& dest =
+        server_cfg->getLoggingInfo()[0].destinations_[0];
+    EXPECT_TRUE(dest.async_);
+    EXPECT_EQ(1024, dest.queue_size_);
+    EXPECT_EQ(isc::log::OutputOption::OVERFLOW_BLOCK, dest.overflow_);
+
+    // The parameters are unparsed.
+    ConstElementPtr unparsed = dest.toElement();
+    ASSERT_TRUE(unparsed->get("async"));
+    EXPECT_TRUE(unparsed->get("async")->boolValue());
+    ASSERT_TRUE(unparsed->get("queue-size"));
+    EXPECT_EQ(1024, unparsed->get("queue-size")->intValue());
+    ASSERT_TRUE(unparsed->get("overflow"));
+    EXPECT_EQ("block", unparsed->get("overflow")->stringValue());
+
+    ASSERT_NO_THROW(server_cfg->applyLoggingCfg());
+
+    // The messages are queued, and written by the time the output is
+    // closed when the logging is reset.
+    isc::log::Logger logger("kea");
+    for (int i = 0; i < 100; ++i) {
+        LOG_INFO(logger, DCTL_CONFIG_COMPLETE).arg(i);
+    }
+    isc::log::initLogger();
+
+    std::ifstream log_file(TEST_LOG_NAME);
+    ASSERT_TRUE(log_file.good());
+    std::string line;
+    int lines = 0;
+    while (std::getline(log_file, line)) {
+        EXPECT_NE(std::string::npos, line.find("DCTL_CONFIG_COMPLETE"));
+        ++lines;
+    }
+    EXPECT_EQ(100, lines);
+    EXPECT_EQ(0, isc::log::LoggerManager::getDroppedMessagesNum());
+}
+
+// Verifies that invalid asynchronous output parameters are rejected.
+TEST_F(LoggingTest, asyncOutputInvalid) {
+    const char* configs[] = {
+        "[ { \"name\": \"kea\", \"output_options\": [ {"
+        " \"output\": \"stdout\", \"async\": true,"
+        " \"queue-size\": 0 } ] } ]",
+        "[ { \"name\": \"kea\", \"output_options\": [ {"
+        " \"output\": \"stdout\", \"async\": true,"
+        " \"overflow\": \"wait\" } ] } ]"
+    };
+    for (auto config_txt : configs) {
+        ConfigPtr server_cfg(new ConfigBase());
+        LogConfigParser parser(server_cfg);
+        EXPECT_THROW(parser.parseConfiguration(Element::fromJSON(config_txt)),
+                     BadValue) << config_txt;
+    }
+}
+
 /// @todo Add tests for malformed logging configuration
 
 /// @todo There is no easy way to test applyConfiguration() and defaultLogging().